@@ -23,11 +23,25 @@
  *=================*/
 
 /*
- * 当前工程在单独的 FreeRTOS 任务里调用 `lv_timer_handler()`
- * tick 在 SysTick 中断里通过 `lv_tick_inc(1)` 提供
- * 因此 LVGL 侧无需启用 OS 适配层（保持移植面最小）
+ * FreeRTOS OS 适配层（src/osal/lv_freertos.c）：
+ * - lv_timer_handler 内部持有 lv_lock（递归互斥量），其它任务 lv_lock() 后即可操作控件；
+ *   不想被渲染阻塞的一次性动作走 ser_lvgl_cmd 命令队列（无锁，中断里也能投递）
+ * - 软件渲染在单独的 "swdraw" 任务里执行（xTaskCreate，栈从 FreeRTOS 堆分配，
+ *   见 app/app_tasks.h 的表外例外），LVGL 任务等它画完
+ * - 需要 configUSE_MUTEXES / configUSE_RECURSIVE_MUTEXES / configUSE_COUNTING_SEMAPHORES
+ * - tick 由 lv_tick_set_cb(dri_time_now_ms) 直接读单调时钟
  */
-#define LV_USE_OS LV_OS_NONE
+#define LV_USE_OS LV_OS_FREERTOS
+
+/*
+ * 不用任务通知实现 lv_thread_sync：LVGL 任务的通知值已被 subject/命令队列的唤醒占用
+ * （ulTaskNotifyTake 计数），混用会让渲染等待被一次 publish 提前唤醒
+ */
+#define LV_USE_FREERTOS_TASK_NOTIFY 0
+
+/* 渲染任务：与 LVGL 任务同优先级（tskIDLE_PRIORITY + 2），不压过定时器工作任务 */
+#define LV_DRAW_THREAD_STACK_SIZE (8U * 1024U)
+#define LV_DRAW_THREAD_PRIO LV_THREAD_PRIO_MID
 
 /*====================
  * LOG SETTINGS
@@ -112,12 +126,47 @@
 #define LV_USE_XML 0
 #define LV_USE_SPAN 0
 
-/* bin 解码器可能会用到的压缩算法（当前不用，先关掉） */
+/*
+ * bin 解码器可能会用到的压缩算法：对应源码（lv_rle.c / lz4）未拷进来，保持关闭。
+ * 压缩图片走 services/ser_lvgl_img（ser_img565 容器，project/tools/img_gen.py 生成），
+ * 绘制时按裁剪区逐条带解码；LV_CACHE_DEF_SIZE（默认 0）设为非 0 时改为整图解进
+ * 图片缓存（LVGL heap，在 SDRAM 上，注意与 LV_MEM_SIZE 一起调整）
+ */
 #define LV_USE_RLE 0
 #define LV_USE_LZ4 0
 #define LV_USE_LZ4_EXTERNAL 0
 #define LV_USE_LZ4_INTERNAL 0
 
+/*==================
+ * PROFILER
+ *==================*/
+
+/*
+ * 性能分析（默认关闭）：编译定义 SER_PROF_ENABLE=1 时启用，后端为 services/ser_prof
+ * - 时间戳用 DWT CYCCNT；LVGL 自带后端只有 1ms tick 精度，看不出绘制任务耗时
+ * - 只打开 REFR/DRAW 两类：lv_refr 各阶段、每个绘制任务、flush
+ */
+#if defined(SER_PROF_ENABLE) && SER_PROF_ENABLE
+#define LV_USE_PROFILER 1
+#define LV_USE_PROFILER_BUILTIN 0
+#define LV_PROFILER_INCLUDE "ser_prof.h"
+#define LV_PROFILER_BEGIN ser_prof_begin(__func__)
+#define LV_PROFILER_END ser_prof_end(__func__)
+#define LV_PROFILER_BEGIN_TAG(tag) ser_prof_begin(tag)
+#define LV_PROFILER_END_TAG(tag) ser_prof_end(tag)
+#define LV_PROFILER_REFR 1
+#define LV_PROFILER_DRAW 1
+#define LV_PROFILER_LAYOUT 0
+#define LV_PROFILER_INDEV 0
+#define LV_PROFILER_DECODER 0
+#define LV_PROFILER_FONT 0
+#define LV_PROFILER_FS 0
+#define LV_PROFILER_STYLE 0
+#define LV_PROFILER_TIMER 0
+#define LV_PROFILER_CACHE 0
+#define LV_PROFILER_EVENT 0
+#endif
+
 /*==================
  * DRAW SETTINGS
  *==================*/
@@ -1,36 +1,158 @@
 #include "app_main.h"
 
+#include "app_tasks.h"
+
 #include "dev_lcd.h"
 #include "dev_lcd_panel.h"
 #include "dev_sdram.h"
+#include "dev_touch.h"
+#include "ser_boot.h"
+#include "ser_bus.h"
+#include "ser_fbstream.h"
 #include "ser_lvgl.h"
+#include "ser_lvgl_cmd.h"
+#include "ser_prof.h"
+#include "ser_proto.h"
+#include "ser_sdram_bench.h"
+#include "ser_splash.h"
+#include "ser_timer.h"
 #include "ser_ultrasonic.h"
 
+/*
+ * 启动图（见 services/ser_boot.h）：
+ *
+ *   MAIN  sdram -> lcd -> splash                  调度器启动前
+ *   IO    ultrasonic      touch(lcd)              启动工作任务
+ *   LVGL  display(lcd) -> ui(ultrasonic) -> first_frame
+ *         indev(display, touch)
+ *
+ * 首帧只依赖 display/ui，触摸复位与地址探测（~150ms）和建对象并发，
+ * 就绪后再挂输入设备
+ */
+typedef enum
+{
+  APP_BOOT_SDRAM = 0,
+  APP_BOOT_LCD,
+  APP_BOOT_SPLASH,
+  APP_BOOT_ULTRASONIC,
+  APP_BOOT_TOUCH,
+  APP_BOOT_DISPLAY,
+  APP_BOOT_UI,
+  APP_BOOT_FIRST_FRAME,
+  APP_BOOT_INDEV,
+  APP_BOOT_NUM,
+} app_boot_step_t;
+
+static bool boot_sdram(void *arg)
+{
+  (void)arg;
+  /* 帧缓冲在外部 SDRAM */
+  return dev_sdram_init() == HAL_OK;
+}
+
+static bool boot_lcd(void *arg)
+{
+  (void)arg;
+  /* 初始化 LTDC 并点亮背光 */
+  return dev_lcd_init() == HAL_OK;
+}
+
+static bool boot_splash(void *arg)
+{
+  (void)arg;
+  /*
+   * 开机画面：主机预渲染的启动界面（RLE，Flash）直接解到帧缓冲，
+   * LVGL 首帧与之相同；画面与屏幕尺寸不符时退回纯色填充，确认显示链路正常
+   */
+  if (!ser_splash_show())
+  {
+    dev_lcd_fill_rgb565(LCD_COLOR_BLUE_RGB565);
+  }
+  return true;
+}
+
+static bool boot_ultrasonic(void *arg)
+{
+  (void)arg;
+  /* 超声波测距服务：启动采样定时器；硬件失败不拦界面（显示无效值） */
+  (void)ser_ultrasonic_init();
+  return true;
+}
+
+static bool boot_touch(void *arg)
+{
+  (void)arg;
+  /* GT9xx 复位时序 + 地址探测，HAL_Delay 在这里让出 CPU */
+  return dev_touch_init();
+}
+
+static const ser_boot_step_t s_boot_steps[APP_BOOT_NUM] = {
+    [APP_BOOT_SDRAM] = {"sdram", SER_BOOT_LANE_MAIN, 0u, boot_sdram, NULL},
+    [APP_BOOT_LCD] = {"lcd", SER_BOOT_LANE_MAIN, SER_BOOT_BIT(APP_BOOT_SDRAM),
+                      boot_lcd, NULL},
+    [APP_BOOT_SPLASH] = {"splash", SER_BOOT_LANE_MAIN,
+                         SER_BOOT_BIT(APP_BOOT_LCD), boot_splash, NULL},
+    [APP_BOOT_ULTRASONIC] = {"ultrasonic", SER_BOOT_LANE_IO, 0u,
+                             boot_ultrasonic, NULL},
+    [APP_BOOT_TOUCH] = {"touch", SER_BOOT_LANE_IO, SER_BOOT_BIT(APP_BOOT_LCD),
+                        boot_touch, NULL},
+    [APP_BOOT_DISPLAY] = {"display", SER_BOOT_LANE_LVGL,
+                          SER_BOOT_BIT(APP_BOOT_LCD), ser_lvgl_boot_display,
+                          NULL},
+    [APP_BOOT_UI] = {"ui", SER_BOOT_LANE_LVGL,
+                     SER_BOOT_BIT(APP_BOOT_DISPLAY) |
+                         SER_BOOT_BIT(APP_BOOT_ULTRASONIC),
+                     ser_lvgl_boot_ui, NULL},
+    [APP_BOOT_FIRST_FRAME] = {"first_frame", SER_BOOT_LANE_LVGL,
+                              SER_BOOT_BIT(APP_BOOT_UI), NULL, NULL},
+    [APP_BOOT_INDEV] = {"indev", SER_BOOT_LANE_LVGL,
+                        SER_BOOT_BIT(APP_BOOT_DISPLAY) |
+                            SER_BOOT_BIT(APP_BOOT_TOUCH),
+                        ser_lvgl_boot_indev, NULL},
+};
+
+static bool app_on_first_frame(void)
+{
+  return ser_boot_complete(APP_BOOT_FIRST_FRAME);
+}
+
 /*
  * app_init：
- * - 初始化
+ * - 初始化（启动图 MAIN 通道）
  * - 不启动调度器
  */
 void app_init(void)
 {
-  /* 1) 初始化 SDRAM（帧缓冲在外部 SDRAM） */
-  if (dev_sdram_init() != HAL_OK)
+  /* 启动计时从这里开始（时钟配置已完成）；步骤表有误时停在这里 */
+  if (!ser_boot_begin(s_boot_steps, APP_BOOT_NUM, APP_BOOT_FIRST_FRAME))
   {
     while (1)
     {
     }
   }
 
-  /* 2) 初始化 LTDC 并点亮背光 */
-  if (dev_lcd_init() != HAL_OK)
+  /* 事件总线先于各服务就绪（订阅在各服务启动时挂上） */
+  (void)ser_bus_init(NULL);
+
+  /* UI 命令队列：任意任务/中断投递，LVGL 任务每轮批量执行 */
+  (void)ser_lvgl_cmd_init(NULL);
+
+  /* 软件定时器（时间轮 + TIM3）：周期性工作挂在这里，不再各占一个任务 */
+  (void)ser_timer_init();
+
+  /* SDRAM -> LTDC -> 开机画面，任一步失败都无法显示，停在这里 */
+  if (!ser_boot_run(SER_BOOT_LANE_MAIN, 0u) ||
+      ser_boot_state(APP_BOOT_SPLASH) != SER_BOOT_OK)
   {
     while (1)
     {
     }
   }
 
-  /* 3) 上电默认填充一个纯色，确认显示链路正常 */
-  dev_lcd_fill_rgb565(LCD_COLOR_BLUE_RGB565);
+#if defined(SER_SDRAM_BENCH_ENABLE) && SER_SDRAM_BENCH_ENABLE
+  /* SDRAM/FMC 基准：各配置档 x LTDC/DMA2D 负载矩阵，结果经调试串口输出 */
+  ser_sdram_bench_run_board();
+#endif
 }
 
 /*
@@ -40,11 +162,33 @@ void app_init(void)
  */
 void app_start(void)
 {
-  /* 超声波测距服务：独立任务采样，供 UI 显示 */
-  ser_ultrasonic_start();
+#if defined(SER_PROF_ENABLE) && SER_PROF_ENABLE
+  /* LVGL 性能分析数据经调试串口流式输出（解码见 project/tools/prof2trace.py） */
+  (void)ser_prof_init();
+#endif
+
+#if defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE
+  /* 屏幕内容经调试串口流式输出（还原见 project/tools/fbview.py） */
+  (void)ser_fbstream_init();
+#endif
+
+#if defined(SER_PROTO_ENABLE) && SER_PROTO_ENABLE
+  /* 远程配置与遥测（上位机见 project/tools/proto.py） */
+  (void)ser_proto_init();
+#endif
+
+  /* 启动图 IO 通道（超声波、触摸）在启动工作任务里与 LVGL 任务并发 */
+  ser_boot_start();
+  ser_lvgl_set_first_frame_cb(app_on_first_frame);
 
   /*
-   * LVGL 任务启动
+   * 任务表（app_tasks.h）：全部静态分配，这里不会因内存不足失败；
+   * 诊断服务初始化失败时其任务自行退出，不影响界面
    */
-  ser_lvgl_start();
+  if (!app_tasks_start())
+  {
+    while (1)
+    {
+    }
+  }
 }
@@ -0,0 +1,101 @@
+#include "app_tasks.h"
+
+#include <stddef.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "lv_conf.h"
+
+/* 链接脚本中的区域（STM32F429IGTX_*.ld），.ccmbss 为 NOLOAD，启动时不清零也不从 flash 复制 */
+#define APP_REGION_SRAM
+#define APP_REGION_CCM __attribute__((section(".ccmbss"), aligned(8)))
+
+#define APP_CCM_BYTES (64u * 1024u)
+#define APP_SRAM_BYTES (192u * 1024u)
+
+/* 任务栈 + TCB 占用（字节） */
+#define APP_TASK_BYTES(words)                                                  \
+  ((words) * sizeof(StackType_t) + sizeof(StaticTask_t))
+
+#define APP_IN_CCM_CCM(bytes) (bytes)
+#define APP_IN_CCM_SRAM(bytes) 0u
+#define APP_IN_SRAM_CCM(bytes) 0u
+#define APP_IN_SRAM_SRAM(bytes) (bytes)
+
+#define APP_TASK_X_CCM(name, entry, words, prio, region)                       \
+  +APP_IN_CCM_##region(APP_TASK_BYTES(words))
+#define APP_TASK_X_SRAM(name, entry, words, prio, region)                      \
+  +APP_IN_SRAM_##region(APP_TASK_BYTES(words))
+
+/* 空闲任务（configUSE_TIMERS = 0，没有定时器任务）同样静态分配在 CCM */
+#define APP_CCM_TASK_BYTES                                                     \
+  (APP_TASK_BYTES(configMINIMAL_STACK_SIZE) APP_TASK_TABLE(APP_TASK_X_CCM))
+#define APP_SRAM_TASK_BYTES (0u APP_TASK_TABLE(APP_TASK_X_SRAM))
+
+_Static_assert(APP_CCM_TASK_BYTES <= APP_CCM_BYTES,
+               "task stacks/TCBs exceed CCMRAM");
+/* SRAM 还要放 .data/.bss/主栈，任务（含 FreeRTOS 堆）最多用一半；其余由链接器检查 */
+_Static_assert(APP_SRAM_TASK_BYTES + configTOTAL_HEAP_SIZE <=
+                   APP_SRAM_BYTES / 2u,
+               "task stacks/TCBs and the FreeRTOS heap exceed the SRAM budget");
+
+/* 表外的 swdraw 任务（见 app_tasks.h）：栈 + TCB 从堆分配，留 1KB 给互斥量/信号量与块头 */
+#define APP_HEAP_SWDRAW_BYTES                                                  \
+  (LV_DRAW_THREAD_STACK_SIZE + sizeof(StaticTask_t) + 1024u)
+_Static_assert(APP_HEAP_SWDRAW_BYTES <= configTOTAL_HEAP_SIZE,
+               "FreeRTOS heap too small for the LVGL swdraw task");
+
+#define APP_TASK_X_STORAGE(name, entry, words, prio, region)                   \
+  static StackType_t s_stack_##name[words] APP_REGION_##region;                \
+  static StaticTask_t s_tcb_##name APP_REGION_##region;
+APP_TASK_TABLE(APP_TASK_X_STORAGE)
+#undef APP_TASK_X_STORAGE
+
+static StackType_t s_stack_idle[configMINIMAL_STACK_SIZE] APP_REGION_CCM;
+static StaticTask_t s_tcb_idle APP_REGION_CCM;
+
+typedef struct
+{
+  const char *name;
+  TaskFunction_t entry;
+  uint32_t stack_words;
+  UBaseType_t prio;
+  StackType_t *stack;
+  StaticTask_t *tcb;
+} app_task_desc_t;
+
+static const app_task_desc_t s_tasks[APP_TASK_NUM] = {
+#define APP_TASK_X_DESC(name, entry, words, prio, region)                      \
+  [APP_TASK_##name] = {#name,                                                  \
+                       entry,                                                  \
+                       (words),                                                \
+                       tskIDLE_PRIORITY + (prio),                              \
+                       s_stack_##name,                                         \
+                       &s_tcb_##name},
+    APP_TASK_TABLE(APP_TASK_X_DESC)
+#undef APP_TASK_X_DESC
+};
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                   StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer = &s_tcb_idle;
+  *ppxIdleTaskStackBuffer = s_stack_idle;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+bool app_tasks_start(void)
+{
+  for (uint32_t i = 0; i < (uint32_t)APP_TASK_NUM; i++)
+  {
+    const app_task_desc_t *t = &s_tasks[i];
+    if (xTaskCreateStatic(t->entry, t->name, t->stack_words, NULL, t->prio,
+                          t->stack, t->tcb) == NULL)
+    {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "ser_boot.h"
+#include "ser_fbstream.h"
+#include "ser_lvgl.h"
+#include "ser_prof.h"
+#include "ser_proto.h"
+#include "ser_timer.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /*
+   * app 层：任务表（编译期声明，静态分配）
+   *
+   * 每一项 X(name, entry, stack_words, prio, region)：
+   * - prio：相对 tskIDLE_PRIORITY 的优先级
+   * - region：栈与 TCB 所在内存
+   *   - SRAM：.bss
+   *   - CCM ：.ccmbss（NOLOAD，64KB 零等待，只有 CPU 能访问）
+   *   CCM 栈上的缓冲不能交给 DMA；各服务的 DMA 缓冲一律用静态变量（SRAM）
+   * - 栈深度取各服务头文件的 SER_xxx_TASK_STACK（字）
+   * - 周期性工作不单独建任务：挂 ser_timer 定时器，回调在共享的 timer 工作任务里
+   *
+   * app_tasks.c 按表生成 StaticTask_t + 栈数组，编译期检查各区域总量，
+   * app_tasks_start 用 xTaskCreateStatic 逐个创建，不使用 FreeRTOS 堆。
+   * 可选服务按编译开关各占一个子表，关闭时整项（含栈）不存在。
+   *
+   * 表外例外（唯一使用 FreeRTOS 堆的任务）：
+   * - swdraw：LVGL OS 适配层在 lv_init 里用 xTaskCreate 创建的软件渲染任务，
+   *   栈 LV_DRAW_THREAD_STACK_SIZE（8KB）+ TCB；LVGL 没有静态创建接口
+   * - configTOTAL_HEAP_SIZE 因此为 16KB（另含 lv_lock 等互斥量/信号量），
+   *   app_tasks.c 编译期检查堆放得下 swdraw，并把整个堆计入 SRAM 预算
+   */
+
+#if defined(SER_PROTO_ENABLE) && SER_PROTO_ENABLE
+#define APP_TASK_PROTO(X) X(proto, ser_proto_task, SER_PROTO_TASK_STACK, 2, CCM)
+#else
+#define APP_TASK_PROTO(X)
+#endif
+
+#if defined(SER_PROF_ENABLE) && SER_PROF_ENABLE
+#define APP_TASK_PROF(X) X(prof, ser_prof_task, SER_PROF_TASK_STACK, 1, CCM)
+#else
+#define APP_TASK_PROF(X)
+#endif
+
+#if defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE
+#define APP_TASK_FBSTREAM(X)                                                   \
+  X(fbstream, ser_fbstream_task, SER_FBSTREAM_TASK_STACK, 1, CCM)
+#else
+#define APP_TASK_FBSTREAM(X)
+#endif
+
+  // clang-format off
+#define APP_TASK_TABLE(X)                                                      \
+  X(boot,  ser_boot_task,  SER_BOOT_TASK_STACK,  3, CCM)                       \
+  X(timer, ser_timer_task, SER_TIMER_TASK_STACK, 3, CCM)                       \
+  X(lvgl,  ser_lvgl_task,  SER_LVGL_TASK_STACK,  2, CCM)                       \
+  APP_TASK_PROTO(X)                                                            \
+  APP_TASK_PROF(X)                                                             \
+  APP_TASK_FBSTREAM(X)
+  // clang-format on
+
+  typedef enum
+  {
+#define APP_TASK_X_ENUM(name, entry, words, prio, region) APP_TASK_##name,
+    APP_TASK_TABLE(APP_TASK_X_ENUM)
+#undef APP_TASK_X_ENUM
+    APP_TASK_NUM,
+  } app_task_t;
+
+  /* 按表创建全部任务（调度器启动前调用）；任一失败返回 false */
+  bool app_tasks_start(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -106,6 +106,32 @@ void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc)
   HAL_NVIC_DisableIRQ(LTDC_IRQn);
 }
 
+/* ==========================
+ * DMA2D MSP（无引脚，只有时钟与中断）
+ * ========================== */
+void HAL_DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d)
+{
+  if (hdma2d->Instance != DMA2D)
+  {
+    return;
+  }
+
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+  HAL_NVIC_SetPriority(DMA2D_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void HAL_DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d)
+{
+  if (hdma2d->Instance != DMA2D)
+  {
+    return;
+  }
+
+  HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+  __HAL_RCC_DMA2D_CLK_DISABLE();
+}
+
 /* ==========================
  * SDRAM MSP（FMC）
  * ========================== */
@@ -201,7 +227,9 @@ void HAL_SDRAM_MspDeInit(SDRAM_HandleTypeDef *hsdram)
 }
 
 /* ==========================
- * I2C1 MSP（CTP 等外设常用）
+ * I2C1 / I2C2 MSP
+ * - EV/ER 中断优先级 6：低于 configMAX_SYSCALL_INTERRUPT_PRIORITY(5)，
+ *   完成回调里可用 FromISR API
  * ========================== */
 void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
 {
@@ -223,6 +251,11 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
     gpio.Pin = GPIO_PIN_6 | GPIO_PIN_7;
     gpio.Alternate = GPIO_AF4_I2C1;
     HAL_GPIO_Init(GPIOB, &gpio);
+
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 6, 0);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
     return;
   }
 
@@ -239,6 +272,11 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
     gpio.Pin = GPIO_PIN_4 | GPIO_PIN_5;
     gpio.Alternate = GPIO_AF4_I2C2;
     HAL_GPIO_Init(GPIOH, &gpio);
+
+    HAL_NVIC_SetPriority(I2C2_EV_IRQn, 6, 0);
+    HAL_NVIC_SetPriority(I2C2_ER_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(I2C2_EV_IRQn);
+    HAL_NVIC_EnableIRQ(I2C2_ER_IRQn);
     return;
   }
 }
@@ -247,6 +285,8 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
 {
   if (hi2c->Instance == I2C1)
   {
+    HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
     __HAL_RCC_I2C1_CLK_DISABLE();
     HAL_GPIO_DeInit(GPIOB, GPIO_PIN_6 | GPIO_PIN_7);
     return;
@@ -254,8 +294,94 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
 
   if (hi2c->Instance == I2C2)
   {
+    HAL_NVIC_DisableIRQ(I2C2_EV_IRQn);
+    HAL_NVIC_DisableIRQ(I2C2_ER_IRQn);
     __HAL_RCC_I2C2_CLK_DISABLE();
     HAL_GPIO_DeInit(GPIOH, GPIO_PIN_4 | GPIO_PIN_5);
     return;
   }
 }
+
+/* ==========================
+ * USART1 MSP（调试串口，经板载 USB 转串口引出）
+ * ========================== */
+void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance != USART1)
+  {
+    return;
+  }
+
+  __HAL_RCC_USART1_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*
+   * USART1 引脚（底板原理图 USB 转串口）：
+   * - PA9 : USART1_TX
+   * - PA10: USART1_RX
+   */
+  GPIO_InitTypeDef gpio = {0};
+  gpio.Pin = GPIO_PIN_9 | GPIO_PIN_10;
+  gpio.Mode = GPIO_MODE_AF_PP;
+  gpio.Pull = GPIO_PULLUP;
+  gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  gpio.Alternate = GPIO_AF7_USART1;
+  HAL_GPIO_Init(GPIOA, &gpio);
+
+  HAL_NVIC_SetPriority(USART1_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(USART1_IRQn);
+}
+
+void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance != USART1)
+  {
+    return;
+  }
+
+  __HAL_RCC_USART1_CLK_DISABLE();
+  HAL_GPIO_DeInit(GPIOA, GPIO_PIN_9 | GPIO_PIN_10);
+  HAL_NVIC_DisableIRQ(USART1_IRQn);
+}
+
+/* ==========================
+ * TIM MSP（无引脚，只开时钟与中断）
+ * - TIM3：ser_timer 时间轮单次触发
+ * - TIM5：dri_time_wait 截止时间比较
+ * 与其它外设同级，中断里用 FromISR API 唤醒任务
+ * ========================== */
+void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM3)
+  {
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    HAL_NVIC_SetPriority(TIM3_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(TIM3_IRQn);
+    return;
+  }
+
+  if (htim->Instance == TIM5)
+  {
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    HAL_NVIC_SetPriority(TIM5_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(TIM5_IRQn);
+    return;
+  }
+}
+
+void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM3)
+  {
+    __HAL_RCC_TIM3_CLK_DISABLE();
+    HAL_NVIC_DisableIRQ(TIM3_IRQn);
+    return;
+  }
+
+  if (htim->Instance == TIM5)
+  {
+    __HAL_RCC_TIM5_CLK_DISABLE();
+    HAL_NVIC_DisableIRQ(TIM5_IRQn);
+    return;
+  }
+}
@@ -0,0 +1,89 @@
+#include "boa_i2c.h"
+
+typedef struct
+{
+  GPIO_TypeDef *port;
+  uint16_t scl;
+  uint16_t sda;
+} boa_i2c_pins_t;
+
+static bool pins_of(I2C_TypeDef *instance, boa_i2c_pins_t *p)
+{
+  if (instance == I2C1)
+  {
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    p->port = GPIOB;
+    p->scl = GPIO_PIN_6;
+    p->sda = GPIO_PIN_7;
+    return true;
+  }
+  if (instance == I2C2)
+  {
+    __HAL_RCC_GPIOH_CLK_ENABLE();
+    p->port = GPIOH;
+    p->scl = GPIO_PIN_4;
+    p->sda = GPIO_PIN_5;
+    return true;
+  }
+  return false;
+}
+
+/* 半个 SCL 周期，约 5us（100kHz）；只要求不快于标准模式，粗略即可 */
+static void half_period(void)
+{
+  for (volatile uint32_t i = SystemCoreClock / 1600000u; i > 0u; i--)
+  {
+  }
+}
+
+static bool level(const boa_i2c_pins_t *p, uint16_t pin)
+{
+  return HAL_GPIO_ReadPin(p->port, pin) == GPIO_PIN_SET;
+}
+
+static void drive(const boa_i2c_pins_t *p, uint16_t pin, bool high)
+{
+  HAL_GPIO_WritePin(p->port, pin, high ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+bool boa_i2c_bus_clear(I2C_TypeDef *instance)
+{
+  boa_i2c_pins_t p;
+  if (!pins_of(instance, &p))
+  {
+    return false;
+  }
+
+  /* 开漏输出：写 1 即释放，从机仍可拉低，可直接读回线电平 */
+  drive(&p, p.scl, true);
+  drive(&p, p.sda, true);
+  GPIO_InitTypeDef gpio = {0};
+  gpio.Pin = p.scl | p.sda;
+  gpio.Mode = GPIO_MODE_OUTPUT_OD;
+  gpio.Pull = GPIO_PULLUP;
+  gpio.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(p.port, &gpio);
+  half_period();
+
+  for (uint32_t i = 0; i < 9u && !level(&p, p.sda); i++)
+  {
+    drive(&p, p.scl, false);
+    half_period();
+    drive(&p, p.scl, true);
+    half_period();
+  }
+
+  /* STOP：SCL 高期间 SDA 由低变高 */
+  drive(&p, p.scl, false);
+  half_period();
+  drive(&p, p.sda, false);
+  half_period();
+  drive(&p, p.scl, true);
+  half_period();
+  drive(&p, p.sda, true);
+  half_period();
+
+  bool idle = level(&p, p.scl) && level(&p, p.sda);
+  HAL_GPIO_DeInit(p.port, p.scl | p.sda);
+  return idle;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "stm32f4xx_hal.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * board/ 层：I2C 引脚装配与总线解锁
+ *
+ * - I2C1: PB6 SCL / PB7 SDA（AF4）
+ * - I2C2: PH4 SCL / PH5 SDA（AF4，GT9xx 触摸）
+ * 复用功能配置在 boa_hal_msp.c 的 HAL_I2C_MspInit，这里只处理总线异常
+ *
+ * 总线解锁（I2C 规范 3.1.16）：
+ * - 从机在字节中途被打断（主机复位、干扰）会一直拉低 SDA 等待时钟
+ * - 把 SCL/SDA 临时切成开漏 GPIO，SCL 最多补 9 个时钟直到 SDA 释放，再发 STOP
+ * - 调用前外设须已 DeInit；调用后由驱动重新 Init 恢复复用功能
+ */
+
+/* 返回 true 表示结束时 SDA 与 SCL 均为高（总线空闲） */
+bool boa_i2c_bus_clear(I2C_TypeDef *instance);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -137,3 +137,20 @@ void boa_touch_reset_for_gt9xx(bool int_high)
 
   HAL_Delay(10);
 }
+
+void boa_touch_int_irq_enable(void)
+{
+  boa_touch_gpio_init();
+
+  /* GT9xx 的 INT 触发极性由配置区决定，这里两个沿都捕获 */
+  GPIO_InitTypeDef gpio = {0};
+  gpio.Pin = BOA_CTP_INT_PIN;
+  gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
+  gpio.Pull = GPIO_NOPULL;
+  gpio.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(BOA_CTP_INT_PORT, &gpio);
+
+  __HAL_GPIO_EXTI_CLEAR_IT(BOA_CTP_INT_PIN);
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+}
@@ -38,6 +38,13 @@ extern "C"
    */
   void boa_touch_reset_for_gt9xx(bool int_high);
 
+  /*
+   * INT 改为双沿 EXTI 输入（复位/地址选择完成后调用）
+   * - 只用于给触摸报告打时间戳，读取仍按轮询进行
+   * - 中断入口：stm32f4xx_it.c 的 EXTI15_10_IRQHandler（PD13 -> EXTI13）
+   */
+  void boa_touch_int_irq_enable(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -26,56 +26,116 @@ static void gpio_clk_enable(GPIO_TypeDef *port)
     __HAL_RCC_GPIOI_CLK_ENABLE();
 }
 
-void boa_ultrasonic_gpio_init(void)
+typedef struct
+{
+  GPIO_TypeDef *trig_port;
+  uint16_t trig_pin;
+  GPIO_TypeDef *echo_port;
+  uint16_t echo_pin;
+} us_pins_t;
+
+static const us_pins_t s_pins[BOA_US_NUM] = {
+#define BOA_US_X_PINS(name, tp, tpin, ep, epin) {tp, tpin, ep, epin},
+    BOA_US_CHANNEL_TABLE(BOA_US_X_PINS)
+#undef BOA_US_X_PINS
+};
+
+/* 已实现入口的 EXTI 线（见 stm32f4xx_it.c）；其它线返回 false */
+static bool echo_irqn(uint16_t pin, IRQn_Type *irqn)
+{
+  switch (pin)
+  {
+  case GPIO_PIN_2:
+    *irqn = EXTI2_IRQn;
+    return true;
+  case GPIO_PIN_3:
+    *irqn = EXTI3_IRQn;
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool boa_ultrasonic_gpio_init(void)
 {
   if (s_inited)
   {
-    return;
+    return true;
+  }
+
+  uint16_t echo_used = 0;
+  for (uint32_t ch = 0; ch < BOA_US_NUM; ch++)
+  {
+    IRQn_Type irqn;
+    if ((echo_used & s_pins[ch].echo_pin) != 0u ||
+        !echo_irqn(s_pins[ch].echo_pin, &irqn))
+    {
+      return false;
+    }
+    echo_used |= s_pins[ch].echo_pin;
   }
 
-  gpio_clk_enable(BOA_US_TRIG_PORT);
-  gpio_clk_enable(BOA_US_ECHO_PORT);
-
-  GPIO_InitTypeDef gpio = {0};
-
-  /* TRIG：推挽输出 */
-  gpio.Pin = BOA_US_TRIG_PIN;
-  gpio.Mode = GPIO_MODE_OUTPUT_PP;
-  gpio.Pull = GPIO_NOPULL;
-  gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-  HAL_GPIO_Init(BOA_US_TRIG_PORT, &gpio);
-  HAL_GPIO_WritePin(BOA_US_TRIG_PORT, BOA_US_TRIG_PIN, GPIO_PIN_RESET);
-
-  /*
-   * ECHO：输入 + 边沿中断（用于避免任务调度/中断导致的“脉冲丢失”）
-   *
-   * 注意：当前工程在 mcu/core/stm32f4xx_it.c 里实现了 EXTI2_IRQHandler，
-   * 因此默认 ECHO_PIN=GPIO_PIN_2 时可直接工作；若你改为其他 pin，请同步改 IRQ。
-   */
-  gpio.Pin = BOA_US_ECHO_PIN;
-  gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
-  gpio.Pull = BOA_US_ECHO_PULL;
-  gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-  HAL_GPIO_Init(BOA_US_ECHO_PORT, &gpio);
-
-  if (BOA_US_ECHO_PIN == GPIO_PIN_2)
+  for (uint32_t ch = 0; ch < BOA_US_NUM; ch++)
   {
-    HAL_NVIC_SetPriority(EXTI2_IRQn, 5, 0);
-    HAL_NVIC_EnableIRQ(EXTI2_IRQn);
+    const us_pins_t *p = &s_pins[ch];
+    gpio_clk_enable(p->trig_port);
+    gpio_clk_enable(p->echo_port);
+
+    GPIO_InitTypeDef gpio = {0};
+
+    /* TRIG：推挽输出 */
+    gpio.Pin = p->trig_pin;
+    gpio.Mode = GPIO_MODE_OUTPUT_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    HAL_GPIO_Init(p->trig_port, &gpio);
+    HAL_GPIO_WritePin(p->trig_port, p->trig_pin, GPIO_PIN_RESET);
+
+    /* ECHO：输入 + 双边沿中断（用于避免任务调度/中断导致的“脉冲丢失”） */
+    gpio.Pin = p->echo_pin;
+    gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
+    gpio.Pull = BOA_US_ECHO_PULL;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    HAL_GPIO_Init(p->echo_port, &gpio);
+
+    IRQn_Type irqn;
+    (void)echo_irqn(p->echo_pin, &irqn);
+    HAL_NVIC_SetPriority(irqn, 5, 0);
+    HAL_NVIC_EnableIRQ(irqn);
   }
 
   s_inited = true;
+  return true;
 }
 
-void boa_ultrasonic_trig_write(bool high)
+void boa_ultrasonic_trig_write(uint8_t ch, bool high)
 {
-  boa_ultrasonic_gpio_init();
-  HAL_GPIO_WritePin(BOA_US_TRIG_PORT, BOA_US_TRIG_PIN,
+  if (ch >= BOA_US_NUM)
+  {
+    return;
+  }
+  HAL_GPIO_WritePin(s_pins[ch].trig_port, s_pins[ch].trig_pin,
                     high ? GPIO_PIN_SET : GPIO_PIN_RESET);
 }
 
-bool boa_ultrasonic_echo_read(void)
+bool boa_ultrasonic_echo_read(uint8_t ch)
 {
-  boa_ultrasonic_gpio_init();
-  return (HAL_GPIO_ReadPin(BOA_US_ECHO_PORT, BOA_US_ECHO_PIN) == GPIO_PIN_SET);
+  if (ch >= BOA_US_NUM)
+  {
+    return false;
+  }
+  return (HAL_GPIO_ReadPin(s_pins[ch].echo_port, s_pins[ch].echo_pin) ==
+          GPIO_PIN_SET);
+}
+
+int32_t boa_ultrasonic_echo_channel(uint16_t pin)
+{
+  for (uint32_t ch = 0; ch < BOA_US_NUM; ch++)
+  {
+    if (s_pins[ch].echo_pin == pin)
+    {
+      return (int32_t)ch;
+    }
+  }
+  return -1;
 }
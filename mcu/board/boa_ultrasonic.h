@@ -15,7 +15,7 @@ extern "C" {
  * - TRIG：输入一个 >10us 的高电平脉冲开始测距
  * - ECHO：输出高电平脉宽 = 超声往返时间
  *
- * 你需要根据自己接线修改下面的默认引脚（只改这里即可）。
+ * 你需要根据自己接线修改下面的默认引脚与通道表（只改这里即可）。
  */
 
 #ifndef BOA_US_TRIG_PORT
@@ -32,6 +32,32 @@ extern "C" {
 #define BOA_US_ECHO_PIN GPIO_PIN_2
 #endif
 
+/*
+ * 通道表：X(name, trig_port, trig_pin, echo_port, echo_pin)
+ * - 每行一路模块，通道号 BOA_US_CH_<name> 按表顺序从 0 开始
+ * - 各路 ECHO 的引脚号不能相同（同号引脚共用一条 EXTI 线）
+ * - ECHO 的 EXTI 入口：已在 stm32f4xx_it.c 实现 EXTI2/EXTI3；
+ *   用其它引脚号时需补对应的 IRQHandler（调用 HAL_GPIO_EXTI_IRQHandler）
+ *
+ * 例：再接一路后向模块（PC4 TRIG / PC3 ECHO）
+ *   X(front, BOA_US_TRIG_PORT, BOA_US_TRIG_PIN, BOA_US_ECHO_PORT, BOA_US_ECHO_PIN)
+ *   X(rear,  GPIOC, GPIO_PIN_4, GPIOC, GPIO_PIN_3)
+ */
+#ifndef BOA_US_CHANNEL_TABLE
+// clang-format off
+#define BOA_US_CHANNEL_TABLE(X)                                                \
+  X(front, BOA_US_TRIG_PORT, BOA_US_TRIG_PIN, BOA_US_ECHO_PORT, BOA_US_ECHO_PIN)
+// clang-format on
+#endif
+
+enum
+{
+#define BOA_US_X_ENUM(name, tp, tpin, ep, epin) BOA_US_CH_##name,
+  BOA_US_CHANNEL_TABLE(BOA_US_X_ENUM)
+#undef BOA_US_X_ENUM
+  BOA_US_NUM
+};
+
 /*
  * ECHO 输入上下拉配置：
  * - 默认不使能内部上下拉（GPIO_NOPULL）
@@ -41,9 +67,13 @@ extern "C" {
 #define BOA_US_ECHO_PULL GPIO_NOPULL
 #endif
 
-void boa_ultrasonic_gpio_init(void);
-void boa_ultrasonic_trig_write(bool high);
-bool boa_ultrasonic_echo_read(void);
+/* 初始化全部通道；ECHO 引脚号重复或没有 EXTI 入口返回 false */
+bool boa_ultrasonic_gpio_init(void);
+void boa_ultrasonic_trig_write(uint8_t ch, bool high);
+bool boa_ultrasonic_echo_read(uint8_t ch);
+
+/* EXTI 引脚 -> 通道号；不是超声波 ECHO 返回 -1（中断上下文） */
+int32_t boa_ultrasonic_echo_channel(uint16_t pin);
 
 #ifdef __cplusplus
 } /*extern "C"*/
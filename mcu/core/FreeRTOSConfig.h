@@ -154,6 +154,9 @@ extern uint32_t SystemCoreClock;
 // 系统节拍计数器变量数据类型，1表示为16位无符号整形，0表示为32位无符号整形
 #define configUSE_16_BIT_TICKS 0
 
+// 任务栈深度类型（V10 起才有；V9 的 xTaskCreate 取 uint16_t，LVGL 适配层按它换算栈深度）
+#define configSTACK_DEPTH_TYPE uint16_t
+
 // 空闲任务放弃CPU使用权给其他同优先级的用户任务
 #define configIDLE_SHOULD_YIELD 1
 
@@ -163,14 +166,14 @@ extern uint32_t SystemCoreClock;
 // 开启任务通知功能，默认开启
 #define configUSE_TASK_NOTIFICATIONS 1
 
-// 使用互斥信号量
-#define configUSE_MUTEXES 0
+// 使用互斥信号量（LVGL FreeRTOS 适配层：lv_lock 与 lv_thread_sync）
+#define configUSE_MUTEXES 1
 
-// 使用递归互斥信号量
-#define configUSE_RECURSIVE_MUTEXES 0
+// 使用递归互斥信号量（lv_lock 可重入）
+#define configUSE_RECURSIVE_MUTEXES 1
 
-// 为1时使用计数信号量
-#define configUSE_COUNTING_SEMAPHORES 0
+// 为1时使用计数信号量（lv_thread_sync，LV_USE_FREERTOS_TASK_NOTIFY 为 0）
+#define configUSE_COUNTING_SEMAPHORES 1
 
 /* 设置可以注册的信号量和消息队列个数 */
 #define configQUEUE_REGISTRY_SIZE 10
@@ -182,10 +185,11 @@ extern uint32_t SystemCoreClock;
 *****************************************************************/
 // 支持动态内存申请
 #define configSUPPORT_DYNAMIC_ALLOCATION 1
-// 支持静态内存
-#define configSUPPORT_STATIC_ALLOCATION 0
-// 系统所有总的堆大小
-#define configTOTAL_HEAP_SIZE ((size_t)(36 * 1024))
+// 支持静态内存（任务/事件组由 app 任务表与各服务静态分配，见 app/app_tasks.h）
+#define configSUPPORT_STATIC_ALLOCATION 1
+// 系统所有总的堆大小：内核对象不再从堆分配，只给第三方库留余量
+// （LVGL 适配层：swdraw 任务 8KB 栈 + TCB + 若干互斥量/信号量）
+#define configTOTAL_HEAP_SIZE ((size_t)(16 * 1024))
 
 /***************************************************************
              FreeRTOS与钩子函数有关的配置选项
@@ -270,7 +274,7 @@ extern uint32_t SystemCoreClock;
 #define INCLUDE_vTaskDelay 1
 #define INCLUDE_eTaskGetState 1
 #define INCLUDE_xTimerPendFunctionCall 0
-// #define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
 // #define INCLUDE_uxTaskGetStackHighWaterMark     0
 // #define INCLUDE_xTaskGetIdleTaskHandle          0
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * core/：FreeRTOS V10 atomic.h 的子集（本工程内核为 V9，没有该头文件）
+ *
+ * 只提供 LVGL 适配层（Libraries/lvgl/src/osal/lv_freertos.c）用到的函数，
+ * 语义与 V10 相同；实现为 GCC __atomic 内建（Cortex-M4 上为 LDREX/STREX），
+ * 任务与中断上下文均可用，不关中断
+ */
+
+#define ATOMIC_COMPARE_AND_SWAP_SUCCESS 0x1U
+#define ATOMIC_COMPARE_AND_SWAP_FAILURE 0x0U
+
+/* *dst 等于 comparand 时写入 exchange；返回是否写入 */
+static inline uint32_t Atomic_CompareAndSwap_u32(uint32_t volatile *dst,
+                                                 uint32_t exchange,
+                                                 uint32_t comparand)
+{
+  return __atomic_compare_exchange_n(dst, &comparand, exchange, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+             ? ATOMIC_COMPARE_AND_SWAP_SUCCESS
+             : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+}
+
+/* 返回加/减之前的值 */
+static inline uint32_t Atomic_Increment_u32(uint32_t volatile *addend)
+{
+  return __atomic_fetch_add(addend, 1u, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t Atomic_Decrement_u32(uint32_t volatile *addend)
+{
+  return __atomic_fetch_sub(addend, 1u, __ATOMIC_SEQ_CST);
+}
@@ -1,6 +1,8 @@
 /* 引用文件 */
 #include "FreeRTOS.h"
 #include "app_main.h"
+#include "dri_time_us.h"
+#include "dri_time_wait.h"
 #include "stm32f4xx_hal.h"
 #include "task.h"
 
@@ -95,6 +97,31 @@ static void SystemClock_Config(void)
   }
 }
 
+/*
+ * HAL_Delay（覆盖弱定义）：调度器运行后改为 vTaskDelay 让出 CPU
+ * - 触摸复位等毫秒级延时在启动工作任务里执行时，不再忙等占住 LVGL 任务
+ * - 调度器启动前（SDRAM 初始化等）仍按 HAL 原实现忙等 SysTick
+ */
+void HAL_Delay(uint32_t Delay)
+{
+  if (__get_IPSR() == 0u && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    /* 与 HAL 原实现一致至少等满 Delay：vTaskDelay 的第一个 tick 可能不足 1ms */
+    vTaskDelay(pdMS_TO_TICKS(Delay) + 1u);
+    return;
+  }
+
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t wait = Delay;
+  if (wait < HAL_MAX_DELAY)
+  {
+    wait += (uint32_t)(uwTickFreq);
+  }
+  while ((HAL_GetTick() - tickstart) < wait)
+  {
+  }
+}
+
 int main(void)
 {
   HAL_Init();
@@ -102,6 +129,10 @@ int main(void)
   /* 配置系统时钟（必须在外设初始化之前完成） */
   SystemClock_Config();
 
+  /* 时间基准（DWT CYCCNT）依赖 SystemCoreClock，必须在任何计时之前 */
+  (void)dri_time_us_init();
+  (void)dri_time_wait_init(NULL);
+
   /* app 初始化与任务创建（符合 README.md 分层结构） */
   app_init();
   app_start();
@@ -20,12 +20,18 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4xx_it.h"
 #include "FreeRTOS.h"
-#include "ser_lvgl.h"
+#include "dri_time_us.h"
+#include "dri_time_wait.h"
+#include "ser_timer.h"
 #include "stm32f4xx_hal.h"
 #include "task.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "dev_touch.h"
 #include "dev_ultrasonic.h"
+#include "dri_dma2d.h"
+#include "dri_i2c.h"
+#include "dri_usart1.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -58,9 +64,14 @@
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
-  if (GPIO_Pin == GPIO_PIN_2)
+  if (dev_ultrasonic_exti_isr(GPIO_Pin))
   {
-    dev_ultrasonic_echo_edge_isr();
+    return;
+  }
+
+  if (GPIO_Pin == GPIO_PIN_13)
+  {
+    dev_touch_int_isr();
   }
 }
 
@@ -202,8 +213,8 @@ void SysTick_Handler(void)
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
 
-  /* LVGL 时基：若当前工程未集成 LVGL，此函数为空实现 */
-  ser_lvgl_tick_inc_isr(1);
+  /* 64 位时间基准：每个 CYCCNT 周期至少观测一次（LVGL tick 也读它） */
+  dri_time_tick_isr();
 
   xPortSysTickHandler(); // 调度 FreeRTOS 任务
 
@@ -240,6 +251,7 @@ void EXTI3_IRQHandler(void)
   /* USER CODE BEGIN EXTI3_IRQn 0 */
 
   /* USER CODE END EXTI3_IRQn 0 */
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_3);
 
   /* USER CODE BEGIN EXTI3_IRQn 1 */
 
@@ -254,7 +266,8 @@ void TIM3_IRQHandler(void)
   /* USER CODE BEGIN TIM3_IRQn 0 */
 
   /* USER CODE END TIM3_IRQn 0 */
-  // HAL_TIM_IRQHandler(&htim3);
+  /* 软件定时器时间轮（ser_timer） */
+  ser_timer_irq_handler();
   /* USER CODE BEGIN TIM3_IRQn 1 */
 
   /* USER CODE END TIM3_IRQn 1 */
@@ -274,6 +287,22 @@ void TIM4_IRQHandler(void)
   /* USER CODE END TIM4_IRQn 1 */
 }
 
+/**
+ * @brief This function handles TIM5 global interrupt.
+ */
+void TIM5_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIM5_IRQn 0 */
+
+  /* USER CODE END TIM5_IRQn 0 */
+  /* 截止时间等待的比较中断（dri_time_wait） */
+  dri_time_wait_irq_handler();
+
+  /* USER CODE BEGIN TIM5_IRQn 1 */
+
+  /* USER CODE END TIM5_IRQn 1 */
+}
+
 /**
  * @brief This function handles USART1 global interrupt.
  */
@@ -282,6 +311,7 @@ void USART1_IRQHandler(void)
   /* USER CODE BEGIN USART1_IRQn 0 */
 
   /* USER CODE END USART1_IRQn 0 */
+  dri_usart1_irq_handler();
 
   /* USER CODE BEGIN USART1_IRQn 1 */
 
@@ -296,6 +326,7 @@ void EXTI15_10_IRQHandler(void)
   /* USER CODE BEGIN EXTI15_10_IRQn 0 */
 
   /* USER CODE END EXTI15_10_IRQn 0 */
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_13);
 
   /* USER CODE BEGIN EXTI15_10_IRQn 1 */
 
@@ -310,6 +341,7 @@ void DMA2_Stream2_IRQHandler(void)
   /* USER CODE BEGIN DMA2_Stream2_IRQn 0 */
 
   /* USER CODE END DMA2_Stream2_IRQn 0 */
+  dri_usart1_dma_rx_irq_handler();
 
   /* USER CODE BEGIN DMA2_Stream2_IRQn 1 */
 
@@ -324,12 +356,88 @@ void DMA2_Stream7_IRQHandler(void)
   /* USER CODE BEGIN DMA2_Stream7_IRQn 0 */
 
   /* USER CODE END DMA2_Stream7_IRQn 0 */
+  dri_usart1_dma_tx_irq_handler();
 
   /* USER CODE BEGIN DMA2_Stream7_IRQn 1 */
 
   /* USER CODE END DMA2_Stream7_IRQn 1 */
 }
 
+/**
+ * @brief This function handles I2C1 event interrupt.
+ */
+void I2C1_EV_IRQHandler(void)
+{
+  /* USER CODE BEGIN I2C1_EV_IRQn 0 */
+
+  /* USER CODE END I2C1_EV_IRQn 0 */
+  dri_i2c_ev_irq_handler(DRI_I2C_1);
+
+  /* USER CODE BEGIN I2C1_EV_IRQn 1 */
+
+  /* USER CODE END I2C1_EV_IRQn 1 */
+}
+
+/**
+ * @brief This function handles I2C1 error interrupt.
+ */
+void I2C1_ER_IRQHandler(void)
+{
+  /* USER CODE BEGIN I2C1_ER_IRQn 0 */
+
+  /* USER CODE END I2C1_ER_IRQn 0 */
+  dri_i2c_er_irq_handler(DRI_I2C_1);
+
+  /* USER CODE BEGIN I2C1_ER_IRQn 1 */
+
+  /* USER CODE END I2C1_ER_IRQn 1 */
+}
+
+/**
+ * @brief This function handles I2C2 event interrupt.
+ */
+void I2C2_EV_IRQHandler(void)
+{
+  /* USER CODE BEGIN I2C2_EV_IRQn 0 */
+
+  /* USER CODE END I2C2_EV_IRQn 0 */
+  dri_i2c_ev_irq_handler(DRI_I2C_2);
+
+  /* USER CODE BEGIN I2C2_EV_IRQn 1 */
+
+  /* USER CODE END I2C2_EV_IRQn 1 */
+}
+
+/**
+ * @brief This function handles I2C2 error interrupt.
+ */
+void I2C2_ER_IRQHandler(void)
+{
+  /* USER CODE BEGIN I2C2_ER_IRQn 0 */
+
+  /* USER CODE END I2C2_ER_IRQn 0 */
+  dri_i2c_er_irq_handler(DRI_I2C_2);
+
+  /* USER CODE BEGIN I2C2_ER_IRQn 1 */
+
+  /* USER CODE END I2C2_ER_IRQn 1 */
+}
+
+/**
+ * @brief This function handles DMA2D global interrupt.
+ */
+void DMA2D_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA2D_IRQn 0 */
+
+  /* USER CODE END DMA2D_IRQn 0 */
+  dri_dma2d_irq_handler();
+
+  /* USER CODE BEGIN DMA2D_IRQn 1 */
+
+  /* USER CODE END DMA2D_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
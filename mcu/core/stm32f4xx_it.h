@@ -65,10 +65,16 @@ extern "C"
   void EXTI3_IRQHandler(void);
   void TIM3_IRQHandler(void);
   void TIM4_IRQHandler(void);
+  void TIM5_IRQHandler(void);
   void USART1_IRQHandler(void);
   void EXTI15_10_IRQHandler(void);
   void DMA2_Stream2_IRQHandler(void);
   void DMA2_Stream7_IRQHandler(void);
+  void I2C1_EV_IRQHandler(void);
+  void I2C1_ER_IRQHandler(void);
+  void I2C2_EV_IRQHandler(void);
+  void I2C2_ER_IRQHandler(void);
+  void DMA2D_IRQHandler(void);
   /* USER CODE BEGIN EFP */
 
   void EXTI0_IRQHandler(void);
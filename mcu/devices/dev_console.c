@@ -0,0 +1,46 @@
+#include "dev_console.h"
+
+#include "dri_usart1.h"
+
+bool dev_console_init(void)
+{
+  return dri_usart1_init(DEV_CONSOLE_BAUD) == HAL_OK;
+}
+
+bool dev_console_write(const void *data, uint32_t len)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  while (len > 0u)
+  {
+    uint16_t n = (len > 0xFFFFu) ? 0xFFFFu : (uint16_t)len;
+    /* 每字节 10 bit；留 2 倍余量 + 10ms */
+    uint32_t timeout_ms = (uint32_t)n * 20000u / DEV_CONSOLE_BAUD + 10u;
+    if (dri_usart1_write(p, n, timeout_ms) != HAL_OK)
+    {
+      return false;
+    }
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool dev_console_write_async(const void *data, uint16_t len)
+{
+  return dri_usart1_write_dma((const uint8_t *)data, len) == HAL_OK;
+}
+
+bool dev_console_tx_busy(void)
+{
+  return dri_usart1_tx_busy();
+}
+
+bool dev_console_rx_start(uint8_t *buf, uint16_t len, dev_console_rx_cb_t cb)
+{
+  return dri_usart1_rx_start(buf, len, cb) == HAL_OK;
+}
+
+uint16_t dev_console_rx_pos(void)
+{
+  return dri_usart1_rx_pos();
+}
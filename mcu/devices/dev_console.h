@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * devices/ 层：调试控制台（板载 USB 转串口，USART1）
+ *
+ * 用途：
+ * - 日志/性能数据等字节流输出到 PC
+ *
+ * 说明：
+ * - 波特率 DEV_CONSOLE_BAUD（默认 921600，适合二进制数据流）
+ * - write 为阻塞发送；write_async 走 DMA，上一次未完成时返回 false
+ * - rx_start 以循环 DMA 接收到调用方的环形缓冲，进度回调在中断上下文
+ */
+
+/* pos：DMA 下一个要写的位置（0..len-1）；restarted：出错后从 0 重新接收 */
+typedef void (*dev_console_rx_cb_t)(uint16_t pos, bool restarted);
+
+#ifndef DEV_CONSOLE_BAUD
+#define DEV_CONSOLE_BAUD 921600u
+#endif
+
+bool dev_console_init(void);
+
+/* 阻塞发送（超时按波特率估算） */
+bool dev_console_write(const void *data, uint32_t len);
+
+/* DMA 发送：data 在 dev_console_tx_busy() 变为 false 前必须保持有效 */
+bool dev_console_write_async(const void *data, uint16_t len);
+bool dev_console_tx_busy(void);
+
+/* buf 在接收期间归 DMA 使用，不能位于 CCMRAM；只能启动一次 */
+bool dev_console_rx_start(uint8_t *buf, uint16_t len, dev_console_rx_cb_t cb);
+uint16_t dev_console_rx_pos(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -1,14 +1,17 @@
 #include "dev_lcd.h"
 
+#include <string.h>
+
 #include "dev_lcd_panel.h"
 
+#include "dri_dma2d.h"
 #include "dri_lcd_ltdc.h"
 
 /*
  * 当前工程的默认 LCD 配置：
  * - 分辨率：800x480
  * - 帧缓冲：外部 SDRAM Bank2 起始（0xD0000000）
- * - 像素格式：RGB565
+ * - 像素格式：由 dev_lcd_panel.h 的 LCD_FB_FORMAT 决定（默认 RGB565）
  *
  * 如果你更换屏幕/分辨率/帧缓冲位置，请在这里与 dev_lcd_panel.h 中同步修改。
  */
@@ -16,14 +19,28 @@
 #define DEV_LCD_DEFAULT_W 800u
 #define DEV_LCD_DEFAULT_H 480u
 
+/*
+ * Layer1 浮层帧缓冲（ARGB4444）
+ *
+ * SDRAM 布局（见 lv_conf.h）：
+ * - 0xD0000000：Layer0 帧缓冲（L8 375KB / RGB565 750KB；ARGB8888 会越过 1MB，需后移 LVGL heap）
+ * - 0xD0100000：LVGL heap（512KB）
+ * - 0xD0200000：Layer1 浮层（800*480*2 ≈ 750KB）
+ */
+#define DEV_LCD_OVERLAY_FB_ADDR 0xD0200000u
+
 static const dri_lcd_ltdc_cfg_t s_cfg = {
     .width = DEV_LCD_DEFAULT_W,
     .height = DEV_LCD_DEFAULT_H,
     .framebuffer_addr = DEV_LCD_DEFAULT_FB_ADDR,
-#if LCD_FB_FORMAT_RGB565
-    .fb_format = DRI_LCD_FB_RGB565,
-#else
+#if LCD_FB_FORMAT == LCD_FB_FMT_L8
+    .fb_format = DRI_LCD_FB_L8,
+#elif LCD_FB_FORMAT == LCD_FB_FMT_ARGB4444
+    .fb_format = DRI_LCD_FB_ARGB4444,
+#elif LCD_FB_FORMAT == LCD_FB_FMT_ARGB8888
     .fb_format = DRI_LCD_FB_ARGB8888,
+#else
+    .fb_format = DRI_LCD_FB_RGB565,
 #endif
     .timing =
         {
@@ -36,14 +53,368 @@ static const dri_lcd_ltdc_cfg_t s_cfg = {
         },
 };
 
+/*
+ * L8 量化：
+ * - 以 RGB444（12bit）为键的反查表，4096 项 * 1B = 4KB
+ * - 每个像素只需一次移位拼接 + 一次查表，避免逐像素搜索调色板
+ * - 默认调色板为 RGB332（8 级 R/G，4 级 B），可用 dev_lcd_set_palette 替换
+ */
+#define DEV_LCD_QLUT_SIZE 4096u
+
+static uint8_t s_qlut[DEV_LCD_QLUT_SIZE];
+static uint32_t s_palette[DRI_LCD_CLUT_MAX];
+static uint32_t s_palette_n = 0;
+
+/* 显示方向：只影响上层写入与触摸换算，LTDC 始终按面板方向扫描 */
+static dev_lcd_rotation_t s_rotation = DEV_LCD_ROT_0;
+
+static uint16_t qlut_key(uint16_t rgb565)
+{
+  uint16_t r4 = (uint16_t)((rgb565 >> 12) & 0x0Fu);
+  uint16_t g4 = (uint16_t)((rgb565 >> 7) & 0x0Fu);
+  uint16_t b4 = (uint16_t)((rgb565 >> 1) & 0x0Fu);
+  return (uint16_t)((r4 << 8) | (g4 << 4) | b4);
+}
+
+static void palette_build_rgb332(void)
+{
+  for (uint32_t i = 0; i < 256u; i++)
+  {
+    uint32_t r = ((i >> 5) & 0x07u) * 255u / 7u;
+    uint32_t g = ((i >> 2) & 0x07u) * 255u / 7u;
+    uint32_t b = (i & 0x03u) * 255u / 3u;
+    s_palette[i] = (r << 16) | (g << 8) | b;
+  }
+  s_palette_n = 256u;
+
+  /* RGB332 可直接由位截取得到索引，无需最近色搜索 */
+  for (uint32_t k = 0; k < DEV_LCD_QLUT_SIZE; k++)
+  {
+    uint32_t r3 = (k >> 9) & 0x07u;
+    uint32_t g3 = (k >> 5) & 0x07u;
+    uint32_t b2 = (k >> 2) & 0x03u;
+    s_qlut[k] = (uint8_t)((r3 << 5) | (g3 << 2) | b2);
+  }
+}
+
+static void palette_build_qlut(void)
+{
+  for (uint32_t k = 0; k < DEV_LCD_QLUT_SIZE; k++)
+  {
+    /* 键值中心点换算回 8bit 分量 */
+    int32_t r = (int32_t)(((k >> 8) & 0x0Fu) * 17u);
+    int32_t g = (int32_t)(((k >> 4) & 0x0Fu) * 17u);
+    int32_t b = (int32_t)((k & 0x0Fu) * 17u);
+
+    uint32_t best = 0;
+    uint32_t best_d = 0xFFFFFFFFu;
+    for (uint32_t i = 0; i < s_palette_n; i++)
+    {
+      int32_t dr = r - (int32_t)((s_palette[i] >> 16) & 0xFFu);
+      int32_t dg = g - (int32_t)((s_palette[i] >> 8) & 0xFFu);
+      int32_t db = b - (int32_t)(s_palette[i] & 0xFFu);
+      /* 人眼对绿色更敏感：简单加权 2:4:1 */
+      uint32_t d = (uint32_t)(2 * dr * dr + 4 * dg * dg + db * db);
+      if (d < best_d)
+      {
+        best_d = d;
+        best = i;
+        if (d == 0u)
+        {
+          break;
+        }
+      }
+    }
+    s_qlut[k] = (uint8_t)best;
+  }
+}
+
 HAL_StatusTypeDef dev_lcd_init(void)
 {
-  return dri_lcd_ltdc_init(&s_cfg);
+  HAL_StatusTypeDef st = dri_lcd_ltdc_init(&s_cfg);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  if (s_cfg.fb_format == DRI_LCD_FB_L8)
+  {
+    palette_build_rgb332();
+    return dri_lcd_ltdc_load_clut(DRI_LCD_LAYER_0, s_palette, s_palette_n);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dev_lcd_set_palette(const uint32_t *rgb888, uint32_t n)
+{
+  if (rgb888 == NULL || n == 0u || n > DRI_LCD_CLUT_MAX)
+  {
+    return HAL_ERROR;
+  }
+  if (s_cfg.fb_format != DRI_LCD_FB_L8)
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    s_palette[i] = rgb888[i] & 0x00FFFFFFu;
+  }
+  s_palette_n = n;
+  palette_build_qlut();
+
+  return dri_lcd_ltdc_load_clut(DRI_LCD_LAYER_0, s_palette, s_palette_n);
+}
+
+uint8_t dev_lcd_quantize_rgb565(uint16_t rgb565)
+{
+  return s_qlut[qlut_key(rgb565)];
+}
+
+static uint32_t rgb565_to_native(uint16_t c)
+{
+  switch (s_cfg.fb_format)
+  {
+  case DRI_LCD_FB_L8:
+    return dev_lcd_quantize_rgb565(c);
+  case DRI_LCD_FB_ARGB4444:
+    return 0xF000u | ((uint32_t)(c >> 12) << 8) |
+           ((uint32_t)((c >> 7) & 0x0Fu) << 4) | ((uint32_t)(c >> 1) & 0x0Fu);
+  case DRI_LCD_FB_ARGB8888:
+  {
+    uint32_t r = (c >> 11) & 0x1Fu;
+    uint32_t g = (c >> 5) & 0x3Fu;
+    uint32_t b = c & 0x1Fu;
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    return 0xFF000000u | (r << 16) | (g << 8) | b;
+  }
+  case DRI_LCD_FB_RGB565:
+  default:
+    return c;
+  }
 }
 
 void dev_lcd_fill_rgb565(uint16_t rgb565)
 {
-  dri_lcd_fill_rgb565(rgb565);
+  dri_lcd_fill_raw(rgb565_to_native(rgb565));
+}
+
+void dev_lcd_flush_rgb565(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          const uint16_t *px)
+{
+  dev_lcd_flush_rgb565_stride(x1, y1, x2, y2, px, (uint32_t)(x2 - x1 + 1));
+}
+
+void dev_lcd_flush_rgb565_stride(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const uint16_t *px,
+                                 uint32_t src_stride)
+{
+  if (px == NULL || x1 < 0 || y1 < 0 || x2 < x1 || y2 < y1 ||
+      x2 >= (int32_t)s_cfg.width || y2 >= (int32_t)s_cfg.height)
+  {
+    return;
+  }
+
+  const uint32_t w = (uint32_t)(x2 - x1 + 1);
+  const uint32_t stride = s_cfg.width;
+  uint8_t *fb = (uint8_t *)dri_lcd_framebuffer();
+
+  for (int32_t y = y1; y <= y2; y++)
+  {
+    uint32_t row = (uint32_t)y * stride + (uint32_t)x1;
+    switch (s_cfg.fb_format)
+    {
+    case DRI_LCD_FB_L8:
+    {
+      uint8_t *dst = fb + row;
+      for (uint32_t i = 0; i < w; i++)
+      {
+        dst[i] = s_qlut[qlut_key(px[i])];
+      }
+      break;
+    }
+    case DRI_LCD_FB_ARGB8888:
+    {
+      uint32_t *dst = (uint32_t *)fb + row;
+      for (uint32_t i = 0; i < w; i++)
+      {
+        dst[i] = rgb565_to_native(px[i]);
+      }
+      break;
+    }
+    case DRI_LCD_FB_ARGB4444:
+    {
+      uint16_t *dst = (uint16_t *)fb + row;
+      for (uint32_t i = 0; i < w; i++)
+      {
+        uint16_t c = px[i];
+        dst[i] = (uint16_t)(0xF000u | ((c >> 4) & 0x0F00u) |
+                            ((c >> 3) & 0x00F0u) | ((c >> 1) & 0x000Fu));
+      }
+      break;
+    }
+    case DRI_LCD_FB_RGB565:
+    default:
+    {
+      uint16_t *dst = (uint16_t *)fb + row;
+      for (uint32_t i = 0; i < w; i++)
+      {
+        dst[i] = px[i];
+      }
+      break;
+    }
+    }
+    px += src_stride;
+  }
+}
+
+bool dev_lcd_copy_rgb565(uint16_t *dst, const uint16_t *src, uint32_t w,
+                         uint32_t h, uint32_t stride)
+{
+  if (dst == NULL || src == NULL || w == 0u || h == 0u || w > stride ||
+      stride > 0xFFFFu)
+  {
+    return false;
+  }
+
+  HAL_StatusTypeDef st = dri_dma2d_copy_rgb565(
+      (uint32_t)dst, (uint32_t)src, (uint16_t)w, (uint16_t)h,
+      (uint16_t)(stride - w), (uint16_t)(stride - w));
+  if (st == HAL_OK)
+  {
+    return true;
+  }
+  if (st == HAL_TIMEOUT)
+  {
+    /* 已部分搬运：重叠拷贝的源行可能已被覆盖，CPU 补拷只会得到错位的像素 */
+    return false;
+  }
+
+  /* memmove：同一行内左右重叠也安全 */
+  for (uint32_t y = 0; y < h; y++)
+  {
+    memmove(dst, src, w * sizeof(uint16_t));
+    dst += stride;
+    src += stride;
+  }
+  return true;
+}
+
+static uint16_t rgb888_to_rgb565(uint32_t c)
+{
+  return (uint16_t)(((c >> 8) & 0xF800u) | ((c >> 5) & 0x07E0u) |
+                    ((c >> 3) & 0x001Fu));
+}
+
+bool dev_lcd_read_rgb565(int32_t x1, int32_t y, int32_t x2, uint16_t *out)
+{
+  if (out == NULL || x1 < 0 || y < 0 || x2 < x1 ||
+      x2 >= (int32_t)s_cfg.width || y >= (int32_t)s_cfg.height)
+  {
+    return false;
+  }
+
+  const uint32_t n = (uint32_t)(x2 - x1 + 1);
+  const uint32_t off = (uint32_t)y * s_cfg.width + (uint32_t)x1;
+  const uint8_t *base = (const uint8_t *)dri_lcd_framebuffer();
+
+  switch (s_cfg.fb_format)
+  {
+  case DRI_LCD_FB_L8:
+  {
+    const uint8_t *fb = (const uint8_t *)base + off;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      out[i] = rgb888_to_rgb565(s_palette[fb[i]]);
+    }
+    break;
+  }
+  case DRI_LCD_FB_ARGB4444:
+  {
+    const uint16_t *fb = (const uint16_t *)base + off;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      uint32_t c = fb[i];
+      /* 4bit 分量复制到高低位再截成 565 */
+      uint32_t r = ((c >> 8) & 0x0Fu) * 0x11u;
+      uint32_t g = ((c >> 4) & 0x0Fu) * 0x11u;
+      uint32_t b = (c & 0x0Fu) * 0x11u;
+      out[i] = rgb888_to_rgb565((r << 16) | (g << 8) | b);
+    }
+    break;
+  }
+  case DRI_LCD_FB_ARGB8888:
+  {
+    const uint32_t *fb = (const uint32_t *)base + off;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      out[i] = rgb888_to_rgb565(fb[i]);
+    }
+    break;
+  }
+  case DRI_LCD_FB_RGB565:
+  default:
+  {
+    const uint16_t *fb = (const uint16_t *)base + off;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      out[i] = fb[i];
+    }
+    break;
+  }
+  }
+  return true;
+}
+
+bool dev_lcd_is_native_rgb565(void)
+{
+  return s_cfg.fb_format == DRI_LCD_FB_RGB565;
+}
+
+uint32_t dev_lcd_bytes_per_pixel(void)
+{
+  return dri_lcd_fb_bytes_per_pixel(s_cfg.fb_format);
+}
+
+HAL_StatusTypeDef dev_lcd_overlay_enable(uint16_t x, uint16_t y, uint16_t w,
+                                         uint16_t h, uint8_t alpha)
+{
+  if (w == 0u || h == 0u || (uint32_t)x + w > s_cfg.width ||
+      (uint32_t)y + h > s_cfg.height)
+  {
+    return HAL_ERROR;
+  }
+
+  /* 先清成全透明，避免使能瞬间显示 SDRAM 残留数据 */
+  uint16_t *ov = (uint16_t *)DEV_LCD_OVERLAY_FB_ADDR;
+  for (uint32_t i = 0; i < (uint32_t)w * h; i++)
+  {
+    ov[i] = 0x0000u;
+  }
+
+  const dri_lcd_ltdc_layer_cfg_t layer1 = {
+      .framebuffer_addr = DEV_LCD_OVERLAY_FB_ADDR,
+      .fb_format = DRI_LCD_FB_ARGB4444,
+      .x0 = x,
+      .y0 = y,
+      .width = w,
+      .height = h,
+      .alpha = alpha,
+  };
+  return dri_lcd_ltdc_layer_config(DRI_LCD_LAYER_1, &layer1);
+}
+
+HAL_StatusTypeDef dev_lcd_overlay_disable(void)
+{
+  return dri_lcd_ltdc_layer_disable(DRI_LCD_LAYER_1);
+}
+
+void *dev_lcd_overlay_buffer(void)
+{
+  return (void *)DEV_LCD_OVERLAY_FB_ADDR;
 }
 
 void *dev_lcd_framebuffer(void)
@@ -61,3 +432,106 @@ uint16_t dev_lcd_height(void)
   return (uint16_t)s_cfg.height;
 }
 
+void dev_lcd_set_rotation(dev_lcd_rotation_t rot)
+{
+  if ((uint32_t)rot <= (uint32_t)DEV_LCD_ROT_270)
+  {
+    s_rotation = rot;
+  }
+}
+
+dev_lcd_rotation_t dev_lcd_get_rotation(void)
+{
+  return s_rotation;
+}
+
+static bool rotation_swaps_xy(void)
+{
+  return s_rotation == DEV_LCD_ROT_90 || s_rotation == DEV_LCD_ROT_270;
+}
+
+uint16_t dev_lcd_logical_width(void)
+{
+  return rotation_swaps_xy() ? dev_lcd_height() : dev_lcd_width();
+}
+
+uint16_t dev_lcd_logical_height(void)
+{
+  return rotation_swaps_xy() ? dev_lcd_width() : dev_lcd_height();
+}
+
+/*
+ * 逻辑 (x, y) 显示在物理 90 -> (y, H-1-x)，180 -> (W-1-x, H-1-y)，
+ * 270 -> (W-1-y, x)；这里做逆变换（调用方保证 x < W、y < H）
+ */
+void dev_lcd_to_logical(uint16_t *x, uint16_t *y)
+{
+  const uint16_t w = dev_lcd_width();
+  const uint16_t h = dev_lcd_height();
+  const uint16_t px = *x;
+  const uint16_t py = *y;
+
+  switch (s_rotation)
+  {
+  case DEV_LCD_ROT_90:
+    *x = (uint16_t)(h - 1u - py);
+    *y = px;
+    break;
+  case DEV_LCD_ROT_180:
+    *x = (uint16_t)(w - 1u - px);
+    *y = (uint16_t)(h - 1u - py);
+    break;
+  case DEV_LCD_ROT_270:
+    *x = py;
+    *y = (uint16_t)(w - 1u - px);
+    break;
+  default:
+    break;
+  }
+}
+
+
+void dev_lcd_scanout_enable(bool on)
+{
+  dri_lcd_ltdc_enable(on);
+}
+
+bool dev_lcd_dma2d_load_start(void *dst)
+{
+  /* 颜色无所谓，只要产生与 LVGL 全屏填充同量级的写流量 */
+  return dri_dma2d_fill_loop_start((uint32_t)dst, (uint16_t)s_cfg.width,
+                                   (uint16_t)s_cfg.height,
+                                   0xFF808080u) == HAL_OK;
+}
+
+void dev_lcd_dma2d_load_stop(void)
+{
+  dri_dma2d_fill_loop_stop();
+}
+
+uint32_t dev_lcd_scanout_us(int32_t y1, int32_t y2)
+{
+  dri_lcd_ltdc_scan_t scan;
+  if (dri_lcd_ltdc_scan_pos(&scan) != HAL_OK || scan.total_lines == 0u)
+  {
+    return 0u;
+  }
+
+  if (y1 < 0)
+    y1 = 0;
+  if (y2 >= (int32_t)s_cfg.height)
+    y2 = (int32_t)s_cfg.height - 1;
+  if (y2 < y1)
+  {
+    return 0u;
+  }
+
+  uint32_t first = scan.active_y0 + (uint32_t)y1;
+  uint32_t last = scan.active_y0 + (uint32_t)y2;
+  uint32_t cur = scan.line;
+
+  /* 还没扫到区域首行：本帧扫完末行即可；否则等下一帧 */
+  uint32_t lines = (cur <= first) ? (last + 1u - cur)
+                                  : (scan.total_lines - cur + last + 1u);
+  return (uint32_t)(((uint64_t)lines * scan.line_ns) / 1000u);
+}
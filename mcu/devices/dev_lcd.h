@@ -2,6 +2,8 @@
 
 #include "stm32f4xx_hal.h"
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,12 +18,103 @@ extern "C" {
 
 HAL_StatusTypeDef dev_lcd_init(void);
 
+/* 单色填充；非 RGB565 帧缓冲时自动转换为原生格式 */
 void dev_lcd_fill_rgb565(uint16_t rgb565);
 void *dev_lcd_framebuffer(void);
 
+/* 帧缓冲是否为 RGB565（是则上层可直接把帧缓冲当作渲染目标） */
+bool dev_lcd_is_native_rgb565(void);
+uint32_t dev_lcd_bytes_per_pixel(void);
+
+/*
+ * 把一块 RGB565 像素（行连续，宽 x2-x1+1）写入帧缓冲对应区域
+ * - 坐标为闭区间；越界时整块丢弃
+ * - 目标为 L8/ARGB4444/ARGB8888 时逐像素转换（L8 走量化反查表）
+ */
+void dev_lcd_flush_rgb565(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          const uint16_t *px);
+
+/* 同上，源像素行距为 src_stride（像素），用于写出大块缓冲中的子矩形 */
+void dev_lcd_flush_rgb565_stride(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const uint16_t *px,
+                                 uint32_t src_stride);
+
+/*
+ * RGB565 帧缓冲内/帧缓冲之间的矩形拷贝（w x h，行距 stride 像素）
+ * - dst / src 为矩形左上角；两者重叠时要求 dst 地址不高于 src
+ *   （逐行、行内从左到右拷贝是安全的），其它方向由调用方拆分
+ * - 优先 DMA2D（阻塞等待），DMA2D 被占用或没能启动时由 CPU 逐行拷贝
+ * - 返回 false：参数无效，或 DMA2D 传输中途失败（目的区域可能已部分写入，
+ *   重叠时源也可能已被覆盖，不能再补拷），调用方须重绘目的区域
+ */
+bool dev_lcd_copy_rgb565(uint16_t *dst, const uint16_t *src, uint32_t w,
+                         uint32_t h, uint32_t stride);
+
+/*
+ * 读回帧缓冲中一行像素（y 行 x1..x2，闭区间）并转换为 RGB565
+ * - L8 经调色板还原，ARGB 格式丢弃 alpha；越界时返回 false
+ */
+bool dev_lcd_read_rgb565(int32_t x1, int32_t y, int32_t x2, uint16_t *out);
+
+/*
+ * L8 调色板（仅 LCD_FB_FORMAT 为 L8 时有效）
+ * - rgb888 每项 0x00RRGGBB，n <= 256
+ * - 替换后重建量化反查表并重新装载 CLUT（约数毫秒）
+ */
+HAL_StatusTypeDef dev_lcd_set_palette(const uint32_t *rgb888, uint32_t n);
+uint8_t dev_lcd_quantize_rgb565(uint16_t rgb565);
+
+/*
+ * Layer1 ARGB4444 浮层：叠加在主帧缓冲之上，只扫描窗口区域
+ * - 使能时缓冲被清成全透明
+ */
+HAL_StatusTypeDef dev_lcd_overlay_enable(uint16_t x, uint16_t y, uint16_t w,
+                                         uint16_t h, uint8_t alpha);
+HAL_StatusTypeDef dev_lcd_overlay_disable(void);
+void *dev_lcd_overlay_buffer(void);
+
 uint16_t dev_lcd_width(void);
 uint16_t dev_lcd_height(void);
 
+/*
+ * 显示方向（软件旋转，面板与 LTDC 扫描不变）
+ * - 顺时针，坐标约定与 LVGL 的 lv_display_rotation_t 相同
+ * - dev_lcd_width/height 始终是面板（物理）尺寸；logical_* 为旋转后 UI 看到的尺寸
+ * - 只记录方向：像素由上层（ser_lvgl）旋转后写入，触摸坐标由 dev_touch 换算
+ */
+typedef enum
+{
+  DEV_LCD_ROT_0 = 0,
+  DEV_LCD_ROT_90,
+  DEV_LCD_ROT_180,
+  DEV_LCD_ROT_270,
+} dev_lcd_rotation_t;
+
+void dev_lcd_set_rotation(dev_lcd_rotation_t rot);
+dev_lcd_rotation_t dev_lcd_get_rotation(void);
+uint16_t dev_lcd_logical_width(void);
+uint16_t dev_lcd_logical_height(void);
+
+/* 物理（面板）坐标下的点换算为当前方向的逻辑坐标 */
+void dev_lcd_to_logical(uint16_t *x, uint16_t *y);
+
+/*
+ * 估算帧缓冲中 y1..y2 行（已写好）全部被 LTDC 扫描到面板还需多少微秒
+ * - 扫描线已越过 y1 时，要等下一帧才能完整显示该区域
+ * - LTDC 未初始化时返回 0
+ */
+uint32_t dev_lcd_scanout_us(int32_t y1, int32_t y2);
+
+/*
+ * 测试用：制造/去除 SDRAM 上的显示相关流量（ser_sdram_bench）
+ * - scanout_enable(false) 停止 LTDC 扫描（屏幕内容不再刷新）
+ * - dma2d_load_start 让 DMA2D 在 dst 起的一屏 ARGB8888 区域上循环填充，
+ *   stop 返回前等待最后一次填充结束
+ */
+void dev_lcd_scanout_enable(bool on);
+bool dev_lcd_dma2d_load_start(void *dst);
+void dev_lcd_dma2d_load_stop(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
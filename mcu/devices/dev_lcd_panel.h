@@ -24,14 +24,31 @@
  *
  * 注意：即便面板物理接口是 RGB888，LTDC 也可以从内存读 RGB565，再输出到 RGB888
  * 引脚。
+ *
+ * 可选格式（SDRAM 扫描带宽按 800x480@60Hz 估算）：
+ * - RGB565  ：2B/px，约 46MB/s
+ * - ARGB4444：2B/px，约 46MB/s（主要用于 Layer1 半透明浮层）
+ * - L8      ：1B/px，约 23MB/s，颜色由 CLUT（调色板）决定，适合色彩较少的界面
+ * - ARGB8888：4B/px，约 92MB/s
+ *
+ * 非 RGB565 格式时，LVGL 以 PARTIAL 模式渲染 RGB565，再由 dev_lcd 转换写入帧缓冲。
  */
-#define LCD_FB_FORMAT_RGB565 1
+#define LCD_FB_FMT_RGB565 0
+#define LCD_FB_FMT_ARGB8888 1
+#define LCD_FB_FMT_ARGB4444 2
+#define LCD_FB_FMT_L8 3
+
+#ifndef LCD_FB_FORMAT
+#define LCD_FB_FORMAT LCD_FB_FMT_RGB565
+#endif
 
 /* 帧缓冲每像素字节数 */
-#if LCD_FB_FORMAT_RGB565
-#define LCD_FB_BYTES_PER_PIXEL 2u
+#if LCD_FB_FORMAT == LCD_FB_FMT_L8
+#define LCD_FB_BYTES_PER_PIXEL 1u
+#elif LCD_FB_FORMAT == LCD_FB_FMT_ARGB8888
+#define LCD_FB_BYTES_PER_PIXEL 4u
 #else
-#define LCD_FB_BYTES_PER_PIXEL 4u /* ARGB8888 */
+#define LCD_FB_BYTES_PER_PIXEL 2u /* RGB565 / ARGB4444 */
 #endif
 
 /* ==========================
@@ -7,3 +7,25 @@ HAL_StatusTypeDef dev_sdram_init(void)
   return dri_sdram_init();
 }
 
+
+uint32_t dev_sdram_profile_count(void)
+{
+  return dri_sdram_profile_count();
+}
+
+const char *dev_sdram_profile_name(uint32_t idx)
+{
+  const dri_sdram_profile_t *p = dri_sdram_profile(idx);
+  return (p != NULL) ? p->name : "?";
+}
+
+bool dev_sdram_profile_in_spec(uint32_t idx)
+{
+  const dri_sdram_profile_t *p = dri_sdram_profile(idx);
+  return (p != NULL) && p->in_spec;
+}
+
+HAL_StatusTypeDef dev_sdram_apply_profile(uint32_t idx)
+{
+  return dri_sdram_apply_profile(idx);
+}
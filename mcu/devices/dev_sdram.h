@@ -2,6 +2,8 @@
 
 #include "stm32f4xx_hal.h"
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,8 +16,19 @@ extern "C" {
  * - 具体 FMC/SDRAM 的底层实现仍在 drivers/ 中（dri_sdram.*）。
  */
 
+/* 按默认 FMC 配置档初始化（也用于切换测试后恢复） */
 HAL_StatusTypeDef dev_sdram_init(void);
 
+/*
+ * FMC 时序/突发配置档（表见 dri_sdram.c）
+ * - in_spec 为 false 的是压缩余量的试验档，不能未经校验直接使用
+ * - 切换期间不得有 LTDC/DMA2D 访问 SDRAM
+ */
+uint32_t dev_sdram_profile_count(void);
+const char *dev_sdram_profile_name(uint32_t idx);
+bool dev_sdram_profile_in_spec(uint32_t idx);
+HAL_StatusTypeDef dev_sdram_apply_profile(uint32_t idx);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
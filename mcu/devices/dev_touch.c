@@ -4,6 +4,9 @@
 
 #include "dev_lcd.h"
 
+#include "boa_touch.h"
+#include "dri_time_us.h"
+
 #include <stddef.h>
 
 /**
@@ -18,14 +21,21 @@
  * - 初始化：I2C2 + GT9xx/GT615 复位时序（drivers/dri_touch_gt9xx +
  * board/boa_touch）
  * - 读取：轮询 0x814E，解析单点触摸并清状态
+ * - 时间戳：INT 脚走 EXTI，只记录沿到来时刻（读取仍由 LVGL 轮询触发）
  */
 
 static bool s_inited = false;
 
+/* 上次读取之后第一个 INT 沿的时刻（ISR 写，读取时消费） */
+static volatile uint32_t s_int_cycles = 0;
+static volatile bool s_int_seen = false;
+
 /*
  * 触摸坐标变换开关：
  * - 不同模组可能会出现坐标轴交换/镜像
  * - 如果你看到坐标变化但“点不到按钮”，再按现象打开这些宏
+ * - 这些宏只校准触摸面板与 LCD 面板的对应关系；显示方向（竖屏等）
+ *   在此之后按 dev_lcd_get_rotation() 运行时换算
  */
 #ifndef DEV_TOUCH_SWAP_XY
 #define DEV_TOUCH_SWAP_XY 0
@@ -49,10 +59,22 @@ bool dev_touch_init(void)
     return false;
   }
 
+  /* 复位阶段 INT 被用作地址选择输出，初始化完成后才能切到 EXTI */
+  boa_touch_int_irq_enable();
+
   s_inited = true;
   return true;
 }
 
+void dev_touch_int_isr(void)
+{
+  if (!s_int_seen)
+  {
+    s_int_cycles = dri_time_cycles_now();
+    s_int_seen = true;
+  }
+}
+
 bool dev_touch_read(bool *pressed, uint16_t *x, uint16_t *y)
 {
   if (pressed == NULL || x == NULL || y == NULL)
@@ -60,34 +82,54 @@ bool dev_touch_read(bool *pressed, uint16_t *x, uint16_t *y)
     return false;
   }
 
+  dev_touch_sample_t s;
+  bool ok = dev_touch_read_sample(&s);
+  *pressed = s.pressed;
+  *x = s.x;
+  *y = s.y;
+  return ok;
+}
+
+bool dev_touch_read_sample(dev_touch_sample_t *s)
+{
+  if (s == NULL)
+  {
+    return false;
+  }
+
+  s->pressed = false;
+  s->x = 0;
+  s->y = 0;
+  s->t_int = dri_time_cycles_now();
+  s->t_read = s->t_int;
+
   if (!s_inited && !dev_touch_init())
   {
-    *pressed = false;
-    *x = 0;
-    *y = 0;
     return true;
   }
 
+  /* 消费 INT 时间戳：本次读到的就是该沿对应（或更新）的报告 */
+  if (s_int_seen)
+  {
+    s->t_int = s_int_cycles;
+    s_int_seen = false;
+  }
+
   const uint16_t lcd_w = dev_lcd_width();
   const uint16_t lcd_h = dev_lcd_height();
   if (lcd_w == 0u || lcd_h == 0u)
   {
     /* LCD 维度未就绪时不输出触摸（避免后续坐标变换出现下溢/越界） */
-    *pressed = false;
-    *x = 0;
-    *y = 0;
     return true;
   }
 
   int tx = 0;
   int ty = 0;
   int touch_num = dev_gt9xx_read(&tx, &ty);
+  s->t_read = dri_time_cycles_now();
 
   if (touch_num <= 0)
   {
-    *pressed = false;
-    *x = 0;
-    *y = 0;
     return true;
   }
 
@@ -119,8 +161,11 @@ bool dev_touch_read(bool *pressed, uint16_t *x, uint16_t *y)
   if (py >= lcd_h)
     py = (uint16_t)(lcd_h - 1u);
 
-  *pressed = true;
-  *x = px;
-  *y = py;
+  /* 面板坐标 -> 当前显示方向的逻辑坐标（运行时可切换，见 dev_lcd_set_rotation） */
+  dev_lcd_to_logical(&px, &py);
+
+  s->pressed = true;
+  s->x = px;
+  s->y = py;
   return true;
 }
@@ -18,10 +18,32 @@ bool dev_touch_init(void);
 /*
  * 读取单点触摸（本工程用于 LVGL 指针输入）
  * - pressed: true 表示按下
- * - x/y: 触摸点坐标（像素坐标系，原点左上角）
+ * - x/y: 触摸点坐标（像素坐标系，原点左上角）；按当前显示方向
+ *   （dev_lcd_get_rotation）换算为逻辑坐标，范围为 dev_lcd_logical_width/height
  */
 bool dev_touch_read(bool *pressed, uint16_t *x, uint16_t *y);
 
+/*
+ * 带时间戳的读取（用于触摸到显示的延迟统计）
+ * - 时间戳为 DWT cycle（dri_time_cycles_now）
+ * - t_int：上次读取之后第一个 INT 沿的时刻，即 GT9xx 产出这份报告的时刻；
+ *   没捕获到 INT 沿时等于本次读取开始时刻
+ * - t_read：I2C 读回并完成坐标变换的时刻
+ */
+typedef struct
+{
+  bool pressed;
+  uint16_t x;
+  uint16_t y;
+  uint32_t t_int;
+  uint32_t t_read;
+} dev_touch_sample_t;
+
+bool dev_touch_read_sample(dev_touch_sample_t *s);
+
+/* ISR 回调：CTP INT 沿到来时调用（EXTI13） */
+void dev_touch_int_isr(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
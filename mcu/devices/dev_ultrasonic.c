@@ -1,42 +1,68 @@
 #include "dev_ultrasonic.h"
 
+#include <stddef.h>
+
 #include "boa_ultrasonic.h"
 #include "dri_time_us.h"
+#include "dri_time_wait.h"
 
-static bool s_inited = false;
+/* 每路一个实例：ISR 捕获状态 + 等待者（测量任务在等 ECHO 时睡眠，边沿中断把它叫醒） */
+typedef struct
+{
+  volatile uint32_t start_cycles;
+  volatile uint32_t pulse_us;
+  volatile uint8_t rise_seen;
+  volatile uint8_t done;
+  dri_time_waiter_t waiter;
+} dev_ultrasonic_t;
 
-static volatile uint32_t s_isr_start_cycles = 0;
-static volatile uint32_t s_isr_pulse_us = 0;
-static volatile uint8_t s_isr_rise_seen = 0;
-static volatile uint8_t s_isr_done = 0;
+static bool s_inited = false;
+static dev_ultrasonic_t s_dev[BOA_US_NUM];
 
-void dev_ultrasonic_echo_edge_isr(void)
+static void echo_edge_isr(uint8_t ch)
 {
-  if (!s_inited)
-  {
-    return;
-  }
+  dev_ultrasonic_t *us = &s_dev[ch];
 
-  bool level = boa_ultrasonic_echo_read();
+  /* 先取时间戳，唤醒等待者放在最后，不影响脉宽精度 */
+  uint32_t now = dri_time_cycles_now();
+  bool level = boa_ultrasonic_echo_read(ch);
 
   if (level)
   {
     /* 上升沿：记录起点（只记第一次，避免抖动重复覆盖） */
-    if (!s_isr_rise_seen)
+    if (!us->rise_seen)
     {
-      s_isr_rise_seen = 1u;
-      s_isr_start_cycles = dri_time_cycles_now();
+      us->rise_seen = 1u;
+      us->start_cycles = now;
     }
-    return;
   }
+  else if (us->rise_seen && !us->done)
+  {
+    /* 下降沿：只有在已见过上升沿后才计算脉宽 */
+    us->pulse_us = dri_time_cycles_to_us(now - us->start_cycles);
+    us->done = 1u;
+  }
+
+  dri_time_wait_wake(&us->waiter);
+}
 
-  /* 下降沿：只有在已见过上升沿后才计算脉宽 */
-  if (s_isr_rise_seen && !s_isr_done)
+bool dev_ultrasonic_exti_isr(uint16_t pin)
+{
+  int32_t ch = boa_ultrasonic_echo_channel(pin);
+  if (ch < 0)
+  {
+    return false;
+  }
+  if (s_inited)
   {
-    uint32_t pulse = dri_time_cycles_elapsed_us(s_isr_start_cycles);
-    s_isr_pulse_us = pulse;
-    s_isr_done = 1u;
+    echo_edge_isr((uint8_t)ch);
   }
+  return true;
+}
+
+uint8_t dev_ultrasonic_count(void)
+{
+  return (uint8_t)BOA_US_NUM;
 }
 
 bool dev_ultrasonic_init(void)
@@ -46,8 +72,7 @@ bool dev_ultrasonic_init(void)
     return true;
   }
 
-  boa_ultrasonic_gpio_init();
-  if (dri_time_us_init() != HAL_OK)
+  if (!boa_ultrasonic_gpio_init())
   {
     return false;
   }
@@ -56,35 +81,89 @@ bool dev_ultrasonic_init(void)
   return true;
 }
 
-static bool wait_echo_level(bool level, uint32_t timeout_us)
+/* 等待条件的 arg 为通道号 */
+static bool echo_is_high(void *arg)
 {
-  uint32_t start = dri_time_cycles_now();
-  while (dri_time_cycles_elapsed_us(start) < timeout_us)
+  return boa_ultrasonic_echo_read((uint8_t)(uintptr_t)arg);
+}
+
+static bool echo_is_low(void *arg)
+{
+  return !boa_ultrasonic_echo_read((uint8_t)(uintptr_t)arg);
+}
+
+static bool isr_flag_set(void *arg)
+{
+  return *(volatile uint8_t *)arg != 0u;
+}
+
+/* ECHO 每个边沿都进 EXTI 中断并唤醒等待者，电平/标志变化后立即返回 */
+static bool wait_echo_level(uint8_t ch, bool level, uint32_t timeout_us)
+{
+  return dri_time_wait_us(&s_dev[ch].waiter, timeout_us,
+                          level ? echo_is_high : echo_is_low,
+                          (void *)(uintptr_t)ch);
+}
+
+static bool wait_isr_flag(uint8_t ch, volatile uint8_t *flag,
+                          uint32_t timeout_us)
+{
+  return dri_time_wait_us(&s_dev[ch].waiter, timeout_us, isr_flag_set,
+                          (void *)flag);
+}
+
+bool dev_ultrasonic_trigger(uint8_t ch)
+{
+  if (ch >= BOA_US_NUM || (!s_inited && !dev_ultrasonic_init()))
   {
-    if (boa_ultrasonic_echo_read() == level)
-    {
-      return true;
-    }
+    return false;
   }
-  return false;
+
+  dev_ultrasonic_t *us = &s_dev[ch];
+
+  /* 触发前，确保 TRIG 为低，且 ECHO 已回到低电平 */
+  boa_ultrasonic_trig_write(ch, false);
+  if (boa_ultrasonic_echo_read(ch))
+  {
+    /* ECHO 一直高：可能是接线/电平不匹配/上一帧没结束 */
+    return false;
+  }
+
+  /* TRIG > 10us（手册建议 50us 左右），这里取 60us */
+  us->pulse_us = 0;
+  us->rise_seen = 0u;
+  us->done = 0u;
+  boa_ultrasonic_trig_write(ch, true);
+  (void)dri_time_wait_us(NULL, 60u, NULL, NULL);
+  boa_ultrasonic_trig_write(ch, false);
+  return true;
 }
 
-static bool wait_isr_flag(volatile uint8_t *flag, uint32_t timeout_us)
+bool dev_ultrasonic_result_mm(uint8_t ch, uint32_t *mm)
 {
-  uint32_t start = dri_time_cycles_now();
-  while (dri_time_cycles_elapsed_us(start) < timeout_us)
+  if (mm == NULL || ch >= BOA_US_NUM || !s_dev[ch].done)
   {
-    if (*flag)
-    {
-      return true;
-    }
+    return false;
   }
-  return false;
+
+  uint32_t pulse_us = s_dev[ch].pulse_us;
+  if (pulse_us == 0u)
+  {
+    return false;
+  }
+
+  /*
+   * 常用换算：
+   * - 距离(cm) ≈ pulse_us / 58
+   * - 距离(mm) ≈ pulse_us * 10 / 58
+   */
+  *mm = (pulse_us * 10u + 29u) / 58u;
+  return true;
 }
 
-bool dev_ultrasonic_measure_mm(uint32_t *mm)
+bool dev_ultrasonic_measure_mm(uint8_t ch, uint32_t *mm)
 {
-  if (mm == NULL)
+  if (mm == NULL || ch >= BOA_US_NUM)
   {
     return false;
   }
@@ -94,50 +173,28 @@ bool dev_ultrasonic_measure_mm(uint32_t *mm)
     return false;
   }
 
-  /* 触发前，确保 TRIG 为低，且 ECHO 回到低电平 */
-  boa_ultrasonic_trig_write(false);
-  if (!wait_echo_level(false, 2000u))
+  /* 上一帧回波可能还没结束：最多等 2ms 让 ECHO 回到低电平 */
+  boa_ultrasonic_trig_write(ch, false);
+  if (!wait_echo_level(ch, false, 2000u) || !dev_ultrasonic_trigger(ch))
   {
-    /* ECHO 一直高：可能是接线/电平不匹配/上一帧没结束 */
     return false;
   }
 
-  /* TRIG > 10us（手册建议 50us 左右），这里取 60us */
-  s_isr_pulse_us = 0;
-  s_isr_rise_seen = 0u;
-  s_isr_done = 0u;
-  boa_ultrasonic_trig_write(true);
-  dri_time_delay_us(60u);
-  boa_ultrasonic_trig_write(false);
-
   /* 等待回波开始（上升沿） */
   /*
    * 大部分模块 ECHO 会很快拉高；但为了兼容“直到接收到回波才拉高”的实现，
    * 这里把等待上升沿的超时放宽到 40ms。
    */
-  if (!wait_isr_flag(&s_isr_rise_seen, 40000u))
+  if (!wait_isr_flag(ch, &s_dev[ch].rise_seen, 40000u))
   {
     return false;
   }
 
   /* 等待回波结束（下降沿）；5.6m 往返约 33ms，这里给 40ms */
-  if (!wait_isr_flag(&s_isr_done, 40000u))
-  {
-    return false;
-  }
-
-  uint32_t pulse_us = s_isr_pulse_us;
-  if (pulse_us == 0u)
+  if (!wait_isr_flag(ch, &s_dev[ch].done, 40000u))
   {
     return false;
   }
 
-  /*
-   * 常用换算：
-   * - 距离(cm) ≈ pulse_us / 58
-   * - 距离(mm) ≈ pulse_us * 10 / 58
-   */
-  uint32_t mm_v = (pulse_us * 10u + 29u) / 58u;
-  *mm = mm_v;
-  return true;
+  return dev_ultrasonic_result_mm(ch, mm);
 }
@@ -11,19 +11,35 @@ extern "C" {
  * devices/ 层：超声波测距模块（CS100A/HC-SR04 类）
  *
  * 对外提供“距离(mm)”读取，内部通过 TRIG/ECHO 脉宽计算。
+ * 多路模块按 board/ 通道表各为一个实例（通道号 0..count-1），
+ * 捕获状态与等待者互相独立，可由不同任务同时测量。
  */
 
+/* 初始化全部通道 */
 bool dev_ultrasonic_init(void);
 
+/* 通道数（board/ 通道表的行数） */
+uint8_t dev_ultrasonic_count(void);
+
 /* 阻塞测一次距离；成功返回 true，mm 输出距离（单位：毫米） */
-bool dev_ultrasonic_measure_mm(uint32_t *mm);
+bool dev_ultrasonic_measure_mm(uint8_t ch, uint32_t *mm);
+
+/*
+ * 非阻塞测距（任务上下文，如定时器回调）：
+ * - trigger：ECHO 为低时发出 TRIG 脉冲并开始捕获（约 60us）；ECHO 仍为高返回 false
+ * - result：回波已结束（下降沿已到）返回 true 并输出 mm；应在 trigger 后
+ *   留足最大回波时间（5.6m 往返约 33ms）再取
+ */
+bool dev_ultrasonic_trigger(uint8_t ch);
+bool dev_ultrasonic_result_mm(uint8_t ch, uint32_t *mm);
 
 /*
- * ISR 回调：ECHO 上下沿（EXTI）到来时调用。
- * - 由 core/ 中断入口转发（见 mcu/core/stm32f4xx_it.c）
- * - 仅用于捕获脉宽，不调用 FreeRTOS API
+ * ISR 回调：EXTI 边沿到来时调用（HAL_GPIO_EXTI_Callback 转发全部引脚）。
+ * - 引脚是某一路的 ECHO 时捕获脉宽并返回 true，否则返回 false
+ * - 捕获后经 dri_time_wait_wake 唤醒正在等待该路的测量任务
+ *   （EXTI 优先级 5，不高于 configMAX_SYSCALL_INTERRUPT_PRIORITY）
  */
-void dev_ultrasonic_echo_edge_isr(void);
+bool dev_ultrasonic_exti_isr(uint16_t pin);
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -0,0 +1,162 @@
+#include "dri_dma2d.h"
+
+static DMA2D_HandleTypeDef hdma2d;
+static bool s_inited = false;
+
+static volatile bool s_loop = false;
+static volatile uint32_t s_loop_count = 0;
+static uint32_t s_dst = 0;
+static uint32_t s_color = 0;
+static uint16_t s_w = 0;
+static uint16_t s_h = 0;
+
+static void fill_cplt_cb(DMA2D_HandleTypeDef *h)
+{
+  s_loop_count++;
+  if (s_loop)
+  {
+    (void)HAL_DMA2D_Start_IT(h, s_color, s_dst, s_w, s_h);
+  }
+}
+
+/* 填充与拷贝共用一个句柄，每次启动前按用途重新配置 */
+static HAL_StatusTypeDef dma2d_config(uint32_t mode, uint32_t color_mode,
+                                      uint32_t out_offset)
+{
+  hdma2d.Init.Mode = mode;
+  hdma2d.Init.ColorMode = color_mode;
+  hdma2d.Init.OutputOffset = out_offset;
+  return HAL_DMA2D_Init(&hdma2d);
+}
+
+HAL_StatusTypeDef dri_dma2d_init(void)
+{
+  if (s_inited)
+  {
+    return HAL_OK;
+  }
+
+  hdma2d.Instance = DMA2D;
+  HAL_StatusTypeDef st = dma2d_config(DMA2D_R2M, DMA2D_OUTPUT_ARGB8888, 0u);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+  hdma2d.XferCpltCallback = fill_cplt_cb;
+
+  s_inited = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dri_dma2d_fill_loop_start(uint32_t dst_addr, uint16_t width,
+                                            uint16_t height, uint32_t argb8888)
+{
+  if (dri_dma2d_init() != HAL_OK || s_loop || width == 0u || height == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  if (dma2d_config(DMA2D_R2M, DMA2D_OUTPUT_ARGB8888, 0u) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  s_dst = dst_addr;
+  s_color = argb8888;
+  s_w = width;
+  s_h = height;
+  s_loop_count = 0;
+  s_loop = true;
+
+  HAL_StatusTypeDef st = HAL_DMA2D_Start_IT(&hdma2d, s_color, s_dst, s_w, s_h);
+  if (st != HAL_OK)
+  {
+    s_loop = false;
+  }
+  return st;
+}
+
+void dri_dma2d_fill_loop_stop(void)
+{
+  if (!s_inited)
+  {
+    return;
+  }
+
+  s_loop = false;
+
+  /* 一屏 ARGB8888 填充约 10ms，留足余量 */
+  uint32_t t0 = HAL_GetTick();
+  while (HAL_DMA2D_GetState(&hdma2d) == HAL_DMA2D_STATE_BUSY &&
+         (HAL_GetTick() - t0) < 100u)
+  {
+  }
+  if (HAL_DMA2D_GetState(&hdma2d) == HAL_DMA2D_STATE_BUSY)
+  {
+    (void)HAL_DMA2D_Abort(&hdma2d);
+  }
+}
+
+HAL_StatusTypeDef dri_dma2d_copy_rgb565(uint32_t dst_addr, uint32_t src_addr,
+                                        uint16_t width, uint16_t height,
+                                        uint16_t dst_offset,
+                                        uint16_t src_offset)
+{
+  if (dri_dma2d_init() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  if (s_loop || HAL_DMA2D_GetState(&hdma2d) == HAL_DMA2D_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  if (width == 0u || height == 0u)
+  {
+    return HAL_OK;
+  }
+
+  HAL_StatusTypeDef st = dma2d_config(DMA2D_M2M, DMA2D_OUTPUT_RGB565, dst_offset);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_RGB565;
+  hdma2d.LayerCfg[1].InputOffset = src_offset;
+  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hdma2d.LayerCfg[1].InputAlpha = 0xFFu;
+  st = HAL_DMA2D_ConfigLayer(&hdma2d, 1u);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  st = HAL_DMA2D_Start(&hdma2d, src_addr, dst_addr, width, height);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  /* 一屏 RGB565 SDRAM 到 SDRAM 约 5ms */
+  st = HAL_DMA2D_PollForTransfer(&hdma2d, 50u);
+  if (st != HAL_OK)
+  {
+    /* 已经开始搬运：与未启动的失败区分开，调用方不能再补拷 */
+    (void)HAL_DMA2D_Abort(&hdma2d);
+    return HAL_TIMEOUT;
+  }
+  return HAL_OK;
+}
+
+uint32_t dri_dma2d_fill_loop_count(void)
+{
+  return s_loop_count;
+}
+
+void dri_dma2d_irq_handler(void)
+{
+  if (s_inited)
+  {
+    HAL_DMA2D_IRQHandler(&hdma2d);
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "stm32f4xx_hal.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * drivers/ 层：DMA2D（片上外设）驱动
+ *
+ * 说明：
+ * - 提供寄存器到存储器（R2M）填充与 RGB565 存储器到存储器（M2M）拷贝，
+ *   LVGL 未启用 DMA2D 绘制
+ * - 时钟与中断优先级由 board/ 层的 HAL_DMA2D_MspInit 负责
+ *
+ * 循环填充：
+ * - fill_loop_start 启动一次填充，传输完成中断里立即重启，持续占用 SDRAM 写带宽
+ * - fill_loop_stop 停止重启并等待在途填充结束
+ */
+
+HAL_StatusTypeDef dri_dma2d_init(void);
+
+HAL_StatusTypeDef dri_dma2d_fill_loop_start(uint32_t dst_addr, uint16_t width,
+                                            uint16_t height, uint32_t argb8888);
+void dri_dma2d_fill_loop_stop(void);
+
+/*
+ * RGB565 矩形拷贝（阻塞，轮询等待完成）：
+ * - dst_offset / src_offset：行尾到下一行起点的像素数（行宽 - width）
+ * - DMA2D 逐行、行内从左到右搬运，先读后写：dst 地址不高于 src 时区域可以重叠
+ * - 返回 HAL_BUSY（被占用，含循环填充进行中）/ HAL_ERROR（初始化或配置失败）时
+ *   传输没有启动，目的区域未被改写
+ * - 启动后出错或超时（已中止）一律返回 HAL_TIMEOUT：目的区域可能已部分写入，
+ *   原地重叠拷贝时源像素也可能已被覆盖
+ */
+HAL_StatusTypeDef dri_dma2d_copy_rgb565(uint32_t dst_addr, uint32_t src_addr,
+                                        uint16_t width, uint16_t height,
+                                        uint16_t dst_offset,
+                                        uint16_t src_offset);
+
+/* 循环填充已完成的次数 */
+uint32_t dri_dma2d_fill_loop_count(void);
+
+/* 由 stm32f4xx_it.c 中的 DMA2D_IRQHandler 调用 */
+void dri_dma2d_irq_handler(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
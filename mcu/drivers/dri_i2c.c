@@ -0,0 +1,341 @@
+#include "dri_i2c.h"
+
+#include "boa_i2c.h"
+
+#include <stddef.h>
+
+typedef struct
+{
+  I2C_HandleTypeDef h;
+  bool inited;
+  dri_i2c_done_cb_t cb;
+  void *arg;
+
+  /* write_read 的读阶段：写完成回调里接着发起 */
+  uint16_t rd_addr;
+  uint8_t *rd_buf;
+  uint16_t rd_len;
+} dri_i2c_ctx_t;
+
+static I2C_TypeDef *const s_instance[DRI_I2C_NUM] = {I2C1, I2C2};
+static dri_i2c_ctx_t s_i2c[DRI_I2C_NUM];
+
+static uint16_t to_hal_addr(uint16_t dev_addr_7bit)
+{
+  return (uint16_t)(dev_addr_7bit << 1);
+}
+
+static dri_i2c_ctx_t *ctx_of(dri_i2c_id_t id)
+{
+  if ((uint32_t)id >= (uint32_t)DRI_I2C_NUM)
+  {
+    return NULL;
+  }
+  return &s_i2c[id];
+}
+
+static dri_i2c_ctx_t *ctx_ready(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_of(id);
+  return (c != NULL && c->inited) ? c : NULL;
+}
+
+static dri_i2c_ctx_t *ctx_from_handle(I2C_HandleTypeDef *hi2c, dri_i2c_id_t *id)
+{
+  for (uint32_t i = 0; i < (uint32_t)DRI_I2C_NUM; i++)
+  {
+    if (hi2c == &s_i2c[i].h)
+    {
+      *id = (dri_i2c_id_t)i;
+      return &s_i2c[i];
+    }
+  }
+  return NULL;
+}
+
+static void notify_done(dri_i2c_id_t id, dri_i2c_ctx_t *c, uint32_t err)
+{
+  c->rd_len = 0;
+  if (c->cb != NULL)
+  {
+    c->cb(id, err, c->arg);
+  }
+}
+
+static HAL_StatusTypeDef hw_init(dri_i2c_ctx_t *c, I2C_TypeDef *instance)
+{
+  c->h.Instance = instance;
+
+  /* 为兼容性优先，默认 100k */
+  c->h.Init.ClockSpeed = 100000;
+  c->h.Init.DutyCycle = I2C_DUTYCYCLE_2;
+  c->h.Init.OwnAddress1 = 0;
+  c->h.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+  c->h.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  c->h.Init.OwnAddress2 = 0;
+  c->h.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  c->h.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+
+  /* HAL_I2C_Init 内部先做 SWRST，可清掉 BUSY 卡死的状态位 */
+  return HAL_I2C_Init(&c->h);
+}
+
+HAL_StatusTypeDef dri_i2c_init(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_of(id);
+  if (c == NULL)
+  {
+    return HAL_ERROR;
+  }
+  if (c->inited)
+  {
+    return HAL_OK;
+  }
+
+  HAL_StatusTypeDef st = hw_init(c, s_instance[id]);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  c->inited = true;
+  return HAL_OK;
+}
+
+I2C_HandleTypeDef *dri_i2c_handle(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_of(id);
+  return (c != NULL) ? &c->h : NULL;
+}
+
+void dri_i2c_set_done_cb(dri_i2c_id_t id, dri_i2c_done_cb_t cb, void *arg)
+{
+  dri_i2c_ctx_t *c = ctx_of(id);
+  if (c == NULL)
+  {
+    return;
+  }
+  c->cb = cb;
+  c->arg = arg;
+}
+
+HAL_StatusTypeDef dri_i2c_write_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                   const uint8_t *data, uint16_t len)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL || data == NULL || len == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  c->rd_len = 0;
+  return HAL_I2C_Master_Transmit_IT(&c->h, to_hal_addr(dev_addr_7bit),
+                                    (uint8_t *)data, len);
+}
+
+HAL_StatusTypeDef dri_i2c_read_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                  uint8_t *data, uint16_t len)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL || data == NULL || len == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  c->rd_len = 0;
+  return HAL_I2C_Master_Receive_IT(&c->h, to_hal_addr(dev_addr_7bit), data,
+                                   len);
+}
+
+HAL_StatusTypeDef dri_i2c_write_read_it(dri_i2c_id_t id,
+                                        uint16_t dev_addr_7bit,
+                                        const uint8_t *wbuf, uint16_t wlen,
+                                        uint8_t *rbuf, uint16_t rlen)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL || wbuf == NULL || wlen == 0u || rbuf == NULL || rlen == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  /* 写阶段不发 STOP（FIRST_FRAME），读阶段以重复起始开始、STOP 结束 */
+  c->rd_addr = to_hal_addr(dev_addr_7bit);
+  c->rd_buf = rbuf;
+  c->rd_len = rlen;
+  HAL_StatusTypeDef st = HAL_I2C_Master_Seq_Transmit_IT(
+      &c->h, c->rd_addr, (uint8_t *)wbuf, wlen, I2C_FIRST_FRAME);
+  if (st != HAL_OK)
+  {
+    c->rd_len = 0;
+  }
+  return st;
+}
+
+HAL_StatusTypeDef dri_i2c_mem_read_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                      uint16_t mem_addr,
+                                      uint16_t mem_addr_size, uint8_t *data,
+                                      uint16_t len)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL || data == NULL || len == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  c->rd_len = 0;
+  return HAL_I2C_Mem_Read_IT(&c->h, to_hal_addr(dev_addr_7bit), mem_addr,
+                             mem_addr_size, data, len);
+}
+
+HAL_StatusTypeDef dri_i2c_mem_write_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                       uint16_t mem_addr,
+                                       uint16_t mem_addr_size,
+                                       const uint8_t *data, uint16_t len)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL || data == NULL || len == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  c->rd_len = 0;
+  return HAL_I2C_Mem_Write_IT(&c->h, to_hal_addr(dev_addr_7bit), mem_addr,
+                              mem_addr_size, (uint8_t *)data, len);
+}
+
+HAL_StatusTypeDef dri_i2c_is_device_ready(dri_i2c_id_t id,
+                                          uint16_t dev_addr_7bit,
+                                          uint32_t trials,
+                                          uint32_t timeout_ms)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_I2C_IsDeviceReady(&c->h, to_hal_addr(dev_addr_7bit), trials,
+                               timeout_ms);
+}
+
+void dri_i2c_abort(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL)
+  {
+    return;
+  }
+
+  /* 不走 HAL_I2C_Master_Abort_IT：总线卡死时它等不到 STOP，直接停外设 */
+  IRQn_Type ev = (id == DRI_I2C_1) ? I2C1_EV_IRQn : I2C2_EV_IRQn;
+  IRQn_Type er = (id == DRI_I2C_1) ? I2C1_ER_IRQn : I2C2_ER_IRQn;
+  HAL_NVIC_DisableIRQ(ev);
+  HAL_NVIC_DisableIRQ(er);
+  __HAL_I2C_DISABLE(&c->h);
+  c->rd_len = 0;
+}
+
+HAL_StatusTypeDef dri_i2c_recover(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  c->rd_len = 0;
+  (void)HAL_I2C_DeInit(&c->h);
+  bool idle = boa_i2c_bus_clear(s_instance[id]);
+
+  /* MspInit 重新配置复用功能并打开 EV/ER 中断 */
+  HAL_StatusTypeDef st = hw_init(c, s_instance[id]);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+  return idle ? HAL_OK : HAL_ERROR;
+}
+
+bool dri_i2c_err_is_bus_fault(uint32_t err)
+{
+  return (err & ~(uint32_t)HAL_I2C_ERROR_AF) != HAL_I2C_ERROR_NONE;
+}
+
+void dri_i2c_ev_irq_handler(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c != NULL)
+  {
+    HAL_I2C_EV_IRQHandler(&c->h);
+  }
+}
+
+void dri_i2c_er_irq_handler(dri_i2c_id_t id)
+{
+  dri_i2c_ctx_t *c = ctx_ready(id);
+  if (c != NULL)
+  {
+    HAL_I2C_ER_IRQHandler(&c->h);
+  }
+}
+
+/* ==========================
+ * HAL 回调（覆盖弱定义）
+ * ========================== */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  dri_i2c_id_t id;
+  dri_i2c_ctx_t *c = ctx_from_handle(hi2c, &id);
+  if (c == NULL)
+  {
+    return;
+  }
+
+  if (c->rd_len > 0u)
+  {
+    uint16_t len = c->rd_len;
+    c->rd_len = 0;
+    if (HAL_I2C_Master_Seq_Receive_IT(hi2c, c->rd_addr, c->rd_buf, len,
+                                      I2C_LAST_FRAME) == HAL_OK)
+    {
+      return;
+    }
+    notify_done(id, c, HAL_I2C_ERROR_BERR);
+    return;
+  }
+
+  notify_done(id, c, HAL_I2C_ERROR_NONE);
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  dri_i2c_id_t id;
+  dri_i2c_ctx_t *c = ctx_from_handle(hi2c, &id);
+  if (c != NULL)
+  {
+    notify_done(id, c, HAL_I2C_ERROR_NONE);
+  }
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  HAL_I2C_MasterRxCpltCallback(hi2c);
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  HAL_I2C_MasterRxCpltCallback(hi2c);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  dri_i2c_id_t id;
+  dri_i2c_ctx_t *c = ctx_from_handle(hi2c, &id);
+  if (c == NULL)
+  {
+    return;
+  }
+
+  uint32_t err = hi2c->ErrorCode;
+  notify_done(id, c, (err != HAL_I2C_ERROR_NONE) ? err : HAL_I2C_ERROR_BERR);
+}
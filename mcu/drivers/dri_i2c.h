@@ -0,0 +1,80 @@
+#pragma once
+
+#include "stm32f4xx_hal.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * drivers/ 层：I2C（片上外设）驱动，按实例编号统一 I2C1 / I2C2
+ *
+ * 说明：
+ * - 只封装 I2C 外设能力：init、中断方式的非阻塞传输、探测、总线恢复
+ * - 引脚映射与 EV/ER 中断优先级由 board/ 层的 HAL_I2C_MspInit 负责
+ * - 同一实例同一时刻只允许一个传输；排队/优先级/统计由 dri_i2c_bus 负责，
+ *   业务代码不要直接调用 *_it 接口
+ *
+ * 完成通知：
+ * - 每次 *_it 传输结束（成功或失败）调用一次 dri_i2c_set_done_cb 注册的回调
+ * - 回调在中断上下文执行；err 为 HAL_I2C_ERROR_xxx 位组合，NONE 表示成功
+ * - write_read 先写后读，中间为重复起始条件（不释放总线）
+ */
+
+typedef enum
+{
+  DRI_I2C_1 = 0,
+  DRI_I2C_2,
+  DRI_I2C_NUM
+} dri_i2c_id_t;
+
+typedef void (*dri_i2c_done_cb_t)(dri_i2c_id_t id, uint32_t err, void *arg);
+
+HAL_StatusTypeDef dri_i2c_init(dri_i2c_id_t id);
+I2C_HandleTypeDef *dri_i2c_handle(dri_i2c_id_t id);
+void dri_i2c_set_done_cb(dri_i2c_id_t id, dri_i2c_done_cb_t cb, void *arg);
+
+HAL_StatusTypeDef dri_i2c_write_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                   const uint8_t *data, uint16_t len);
+HAL_StatusTypeDef dri_i2c_read_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                  uint8_t *data, uint16_t len);
+HAL_StatusTypeDef dri_i2c_write_read_it(dri_i2c_id_t id,
+                                        uint16_t dev_addr_7bit,
+                                        const uint8_t *wbuf, uint16_t wlen,
+                                        uint8_t *rbuf, uint16_t rlen);
+HAL_StatusTypeDef dri_i2c_mem_read_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                      uint16_t mem_addr,
+                                      uint16_t mem_addr_size, uint8_t *data,
+                                      uint16_t len);
+HAL_StatusTypeDef dri_i2c_mem_write_it(dri_i2c_id_t id, uint16_t dev_addr_7bit,
+                                       uint16_t mem_addr,
+                                       uint16_t mem_addr_size,
+                                       const uint8_t *data, uint16_t len);
+
+/* 阻塞探测（地址 ACK），调用方需保证总线空闲 */
+HAL_StatusTypeDef dri_i2c_is_device_ready(dri_i2c_id_t id,
+                                          uint16_t dev_addr_7bit,
+                                          uint32_t trials,
+                                          uint32_t timeout_ms);
+
+/* 立即停止当前传输（关 EV/ER 中断与外设，不产生完成回调），之后需 recover */
+void dri_i2c_abort(dri_i2c_id_t id);
+
+/*
+ * 总线恢复：DeInit -> SCL 补 9 个时钟 + STOP（释放被从机拉住的 SDA）-> Init
+ * - 返回 HAL_OK 表示外设已重新初始化且 SDA 为高
+ */
+HAL_StatusTypeDef dri_i2c_recover(dri_i2c_id_t id);
+
+/* NACK 以外的错误（BERR/ARLO/OVR/TIMEOUT）视为总线故障，需要恢复 */
+bool dri_i2c_err_is_bus_fault(uint32_t err);
+
+/* 由 stm32f4xx_it.c 中的 I2Cx_EV_IRQHandler / I2Cx_ER_IRQHandler 调用 */
+void dri_i2c_ev_irq_handler(dri_i2c_id_t id);
+void dri_i2c_er_irq_handler(dri_i2c_id_t id);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
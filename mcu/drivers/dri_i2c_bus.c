@@ -0,0 +1,889 @@
+#include "dri_i2c_bus.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if !defined(DRI_I2C_BUS_HOST) || !DRI_I2C_BUS_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dri_time_us.h"
+
+/* 临界区只保护队列指针与统计，持续时间为几十个周期，直接关中断 */
+static inline uint32_t bus_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static inline void bus_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+
+static void *current_waiter(void)
+{
+  if (__get_IPSR() != 0u ||
+      xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+  {
+    return NULL;
+  }
+  return (void *)xTaskGetCurrentTaskHandle();
+}
+
+static void notify_waiter(void *waiter)
+{
+  if (waiter == NULL)
+  {
+    return;
+  }
+
+  if (__get_IPSR() != 0u)
+  {
+    BaseType_t woken = pdFALSE;
+    (void)xTaskNotifyFromISR((TaskHandle_t)waiter, DRI_I2C_BUS_NOTIFY_BIT,
+                             eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+  else
+  {
+    (void)xTaskNotify((TaskHandle_t)waiter, DRI_I2C_BUS_NOTIFY_BIT, eSetBits);
+  }
+}
+
+static void wait_notify(uint32_t left_us)
+{
+  TickType_t ticks = pdMS_TO_TICKS(left_us / 1000u) + 1u;
+  (void)xTaskNotifyWait(0u, DRI_I2C_BUS_NOTIFY_BIT, NULL, ticks);
+}
+#else
+static inline uint32_t bus_lock(void) { return 0u; }
+static inline void bus_unlock(uint32_t key) { (void)key; }
+static void *current_waiter(void) { return NULL; }
+static void notify_waiter(void *waiter) { (void)waiter; }
+static void wait_notify(uint32_t left_us) { (void)left_us; }
+#endif
+
+static uint32_t ticks_to_us(const dri_i2c_bus_t *bus, uint32_t ticks)
+{
+  return ticks / bus->ticks_per_us;
+}
+
+static uint32_t req_timeout_us(const dri_i2c_req_t *req)
+{
+  return (req->timeout_us != 0u) ? req->timeout_us
+                                 : DRI_I2C_BUS_DEFAULT_TIMEOUT_US;
+}
+
+static bool req_expired(const dri_i2c_bus_t *bus, const dri_i2c_req_t *req,
+                        uint32_t now)
+{
+  return ticks_to_us(bus, now - req->t_submit) >= req_timeout_us(req);
+}
+
+static bool step_valid(const dri_i2c_req_t *s)
+{
+  bool mem_ok = (s->mem_addr_size == 1u || s->mem_addr_size == 2u);
+  switch ((dri_i2c_op_t)s->op)
+  {
+  case DRI_I2C_OP_WRITE:
+    return s->wbuf != NULL && s->wlen > 0u;
+  case DRI_I2C_OP_READ:
+    return s->rbuf != NULL && s->rlen > 0u;
+  case DRI_I2C_OP_WRITE_READ:
+    return s->wbuf != NULL && s->wlen > 0u && s->rbuf != NULL && s->rlen > 0u;
+  case DRI_I2C_OP_MEM_READ:
+    return mem_ok && s->rbuf != NULL && s->rlen > 0u;
+  case DRI_I2C_OP_MEM_WRITE:
+    return mem_ok && s->wbuf != NULL && s->wlen > 0u;
+  default:
+    return false;
+  }
+}
+
+static bool req_valid(const dri_i2c_req_t *req)
+{
+  if (req->op == DRI_I2C_OP_HOLD)
+  {
+    return req->chain == NULL;
+  }
+
+  uint32_t n = 0;
+  for (const dri_i2c_req_t *s = req; s != NULL; s = s->chain)
+  {
+    /* 链长度上限同时防止误接成环 */
+    if (!step_valid(s) || ++n > 16u)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* ==========================
+ * 统计（调用方持锁）
+ * ========================== */
+static dri_i2c_dev_stats_t *dev_find(dri_i2c_bus_t *bus, uint16_t addr,
+                                     bool create)
+{
+  for (uint32_t i = 0; i < bus->dev_used; i++)
+  {
+    if (bus->dev[i].addr == addr)
+    {
+      return &bus->dev[i];
+    }
+  }
+  if (!create || bus->dev_used >= DRI_I2C_BUS_MAX_DEV)
+  {
+    return NULL;
+  }
+
+  dri_i2c_dev_stats_t *d = &bus->dev[bus->dev_used++];
+  memset(d, 0, sizeof(*d));
+  d->addr = addr;
+  d->lat_min_us = UINT32_MAX;
+  return d;
+}
+
+static void record_xfer(dri_i2c_bus_t *bus, uint16_t addr,
+                        dri_i2c_result_t res, uint32_t t_start, uint32_t now)
+{
+  dri_i2c_dev_stats_t *d = dev_find(bus, addr, true);
+  if (d == NULL)
+  {
+    bus->stats.untracked++;
+    return;
+  }
+
+  d->xfers++;
+  switch (res)
+  {
+  case DRI_I2C_OK:
+  {
+    uint32_t us = ticks_to_us(bus, now - t_start);
+    d->lat_last_us = us;
+    d->lat_sum_us += us;
+    if (us < d->lat_min_us)
+      d->lat_min_us = us;
+    if (us > d->lat_max_us)
+      d->lat_max_us = us;
+    break;
+  }
+  case DRI_I2C_NACK:
+    d->nacks++;
+    break;
+  case DRI_I2C_FAULT:
+    d->faults++;
+    break;
+  case DRI_I2C_TIMEOUT:
+    d->timeouts++;
+    break;
+  default:
+    break;
+  }
+}
+
+static void record_wait(dri_i2c_bus_t *bus, const dri_i2c_req_t *req)
+{
+  dri_i2c_dev_stats_t *d = dev_find(bus, req->addr, true);
+  if (d == NULL)
+  {
+    return;
+  }
+
+  uint32_t us = ticks_to_us(bus, req->t_start - req->t_submit);
+  if (us > d->wait_max_us)
+  {
+    d->wait_max_us = us;
+  }
+}
+
+/* ==========================
+ * 队列与状态机
+ * ========================== */
+static void enqueue(dri_i2c_bus_t *bus, dri_i2c_req_t *req)
+{
+  dri_i2c_req_t **pp = &bus->queue;
+  while (*pp != NULL && (*pp)->prio >= req->prio)
+  {
+    pp = &(*pp)->next;
+  }
+  req->next = *pp;
+  *pp = req;
+  req->state = DRI_I2C_REQ_QUEUED;
+
+  bus->queue_len++;
+  if (bus->queue_len > bus->stats.queue_peak)
+  {
+    bus->stats.queue_peak = bus->queue_len;
+  }
+}
+
+static bool dequeue(dri_i2c_bus_t *bus, dri_i2c_req_t *req)
+{
+  for (dri_i2c_req_t **pp = &bus->queue; *pp != NULL; pp = &(*pp)->next)
+  {
+    if (*pp == req)
+    {
+      *pp = req->next;
+      req->next = NULL;
+      bus->queue_len--;
+      return true;
+    }
+  }
+  return false;
+}
+
+/* 链首已出队且 result 已写入：置 DONE 并通知（锁外调用） */
+static void finish(dri_i2c_req_t *req)
+{
+  dri_i2c_req_cb_t cb = req->done;
+  void *arg = req->arg;
+  void *waiter = req->waiter;
+
+  if (waiter != NULL)
+  {
+    /* 同步等待者看到 DONE 后 req 可能随栈帧失效，回调必须在这之前 */
+    if (cb != NULL)
+    {
+      cb(req, arg);
+    }
+    req->state = DRI_I2C_REQ_DONE;
+    notify_waiter(waiter);
+    return;
+  }
+
+  /* 异步：先置 DONE，回调里可以直接重新提交同一个 req */
+  req->state = DRI_I2C_REQ_DONE;
+  if (cb != NULL)
+  {
+    cb(req, arg);
+  }
+}
+
+static void do_recover(dri_i2c_bus_t *bus)
+{
+  bool ok = (bus->port->recover != NULL) ? bus->port->recover(bus->ctx) : true;
+
+  uint32_t key = bus_lock();
+  bus->stats.recoveries++;
+  if (!ok)
+  {
+    bus->stats.recover_failed++;
+  }
+  bus_unlock(key);
+}
+
+/*
+ * 当前段结束：链中还有下一段则接着启动；
+ * 返回已结束的链首（需要 finish），仍在传输或已被取消时返回 NULL
+ */
+static dri_i2c_req_t *step_end(dri_i2c_bus_t *bus, dri_i2c_result_t res)
+{
+  for (;;)
+  {
+    uint32_t now = bus->port->now(bus->ctx);
+    uint32_t key = bus_lock();
+    dri_i2c_req_t *req = bus->active;
+    dri_i2c_req_t *step = bus->step;
+    if (req == NULL || step == NULL)
+    {
+      bus_unlock(key);
+      return NULL;
+    }
+
+    record_xfer(bus, step->addr, res, step->t_start, now);
+
+    if (res == DRI_I2C_OK && step->chain != NULL)
+    {
+      step = step->chain;
+      bus->step = step;
+      bus_unlock(key);
+
+      step->t_start = bus->port->now(bus->ctx);
+      res = bus->port->start(bus->ctx, step);
+      if (res == DRI_I2C_OK)
+      {
+        return NULL;
+      }
+      continue;
+    }
+
+    bus->active = NULL;
+    bus->step = NULL;
+    if (res == DRI_I2C_FAULT || res == DRI_I2C_TIMEOUT)
+    {
+      bus->need_recover = true;
+    }
+    bus->stats.completed++;
+    req->result = (uint8_t)res;
+    bus_unlock(key);
+    return req;
+  }
+}
+
+static void kick(dri_i2c_bus_t *bus)
+{
+  for (;;)
+  {
+    uint32_t key = bus_lock();
+    dri_i2c_req_t *req = bus->queue;
+    if (bus->active != NULL || req == NULL)
+    {
+      bus_unlock(key);
+      return;
+    }
+
+    bus->queue = req->next;
+    req->next = NULL;
+    bus->queue_len--;
+    bus->active = req;
+    bus->step = req;
+    req->state = DRI_I2C_REQ_ACTIVE;
+    bool recover = bus->need_recover;
+    bus->need_recover = false;
+    bus_unlock(key);
+
+    /* 上一次故障后的恢复推迟到这里做：总线已归当前请求所有 */
+    if (recover)
+    {
+      do_recover(bus);
+    }
+
+    req->t_start = bus->port->now(bus->ctx);
+    if (req->op == DRI_I2C_OP_HOLD)
+    {
+      notify_waiter(req->waiter);
+      return;
+    }
+
+    key = bus_lock();
+    record_wait(bus, req);
+    bus_unlock(key);
+
+    dri_i2c_result_t res = bus->port->start(bus->ctx, req);
+    if (res == DRI_I2C_OK)
+    {
+      return;
+    }
+
+    dri_i2c_req_t *done = step_end(bus, res);
+    if (done != NULL)
+    {
+      finish(done);
+    }
+  }
+}
+
+void dri_i2c_bus_init(dri_i2c_bus_t *bus, const dri_i2c_bus_port_t *port,
+                      void *ctx, uint32_t ticks_per_us)
+{
+  if (bus == NULL)
+  {
+    return;
+  }
+
+  memset(bus, 0, sizeof(*bus));
+  bus->port = port;
+  bus->ctx = ctx;
+  bus->ticks_per_us = (ticks_per_us != 0u) ? ticks_per_us : 1u;
+}
+
+static dri_i2c_result_t submit_ex(dri_i2c_bus_t *bus, dri_i2c_req_t *req,
+                                  void *waiter)
+{
+  if (bus == NULL || bus->port == NULL || req == NULL || !req_valid(req))
+  {
+    return DRI_I2C_INVALID;
+  }
+
+  uint32_t now = bus->port->now(bus->ctx);
+  uint32_t key = bus_lock();
+  if (req->state == DRI_I2C_REQ_QUEUED || req->state == DRI_I2C_REQ_ACTIVE)
+  {
+    bus_unlock(key);
+    return DRI_I2C_INVALID;
+  }
+  req->waiter = waiter;
+  req->result = DRI_I2C_OK;
+  req->t_submit = now;
+  req->t_start = now;
+  enqueue(bus, req);
+  bus->stats.submitted++;
+  bus_unlock(key);
+
+  kick(bus);
+  return DRI_I2C_OK;
+}
+
+dri_i2c_result_t dri_i2c_bus_submit(dri_i2c_bus_t *bus, dri_i2c_req_t *req)
+{
+  return submit_ex(bus, req, NULL);
+}
+
+bool dri_i2c_bus_cancel(dri_i2c_bus_t *bus, dri_i2c_req_t *req,
+                        dri_i2c_result_t why)
+{
+  if (bus == NULL || req == NULL)
+  {
+    return false;
+  }
+
+  uint32_t now = bus->port->now(bus->ctx);
+  uint32_t key = bus_lock();
+  if (req->state == DRI_I2C_REQ_QUEUED)
+  {
+    if (!dequeue(bus, req))
+    {
+      bus_unlock(key);
+      return false;
+    }
+  }
+  else if (req->state == DRI_I2C_REQ_ACTIVE && bus->active == req)
+  {
+    if (req->op != DRI_I2C_OP_HOLD)
+    {
+      /* 在锁内停外设：之后不会再有该传输的完成中断 */
+      bus->port->abort(bus->ctx);
+      bus->need_recover = true;
+      if (why == DRI_I2C_TIMEOUT)
+      {
+        record_xfer(bus, bus->step->addr, why, bus->step->t_start, now);
+      }
+    }
+    bus->active = NULL;
+    bus->step = NULL;
+  }
+  else
+  {
+    bus_unlock(key);
+    return false;
+  }
+
+  bus->stats.completed++;
+  req->result = (uint8_t)why;
+  bus_unlock(key);
+
+  finish(req);
+  kick(bus);
+  return true;
+}
+
+static dri_i2c_req_t *find_expired(dri_i2c_bus_t *bus, uint32_t now)
+{
+  uint32_t key = bus_lock();
+  dri_i2c_req_t *victim = NULL;
+
+  dri_i2c_req_t *a = bus->active;
+  if (a != NULL && a->op != DRI_I2C_OP_HOLD && req_expired(bus, a, now))
+  {
+    victim = a;
+  }
+  for (dri_i2c_req_t *q = bus->queue; victim == NULL && q != NULL; q = q->next)
+  {
+    if (req_expired(bus, q, now))
+    {
+      victim = q;
+    }
+  }
+
+  bus_unlock(key);
+  return victim;
+}
+
+void dri_i2c_bus_poll(dri_i2c_bus_t *bus)
+{
+  if (bus == NULL || bus->port == NULL)
+  {
+    return;
+  }
+
+  dri_i2c_req_t *victim;
+  while ((victim = find_expired(bus, bus->port->now(bus->ctx))) != NULL)
+  {
+    (void)dri_i2c_bus_cancel(bus, victim, DRI_I2C_TIMEOUT);
+  }
+}
+
+void dri_i2c_bus_complete(dri_i2c_bus_t *bus, dri_i2c_result_t res)
+{
+  if (bus == NULL)
+  {
+    return;
+  }
+
+  dri_i2c_req_t *done = step_end(bus, res);
+  if (done != NULL)
+  {
+    finish(done);
+    kick(bus);
+  }
+}
+
+/* 等到 req->state 达到 target（或被超时结束） */
+static void wait_state(dri_i2c_bus_t *bus, dri_i2c_req_t *req, uint8_t target)
+{
+  while (req->state < target)
+  {
+    dri_i2c_bus_poll(bus);
+    if (req->state >= target)
+    {
+      break;
+    }
+
+    if (req->waiter != NULL)
+    {
+      /* 最多睡到超时点，超时由下一轮 poll 处理；被其它通知提前唤醒时继续等 */
+      uint32_t spent = ticks_to_us(bus, bus->port->now(bus->ctx) - req->t_submit);
+      uint32_t limit = req_timeout_us(req);
+      wait_notify((spent < limit) ? (limit - spent) : 0u);
+    }
+    else if (bus->port->poll != NULL)
+    {
+      bus->port->poll(bus->ctx);
+    }
+  }
+}
+
+dri_i2c_result_t dri_i2c_bus_xfer(dri_i2c_bus_t *bus, dri_i2c_req_t *req)
+{
+  dri_i2c_result_t res = submit_ex(bus, req, current_waiter());
+  if (res != DRI_I2C_OK)
+  {
+    return res;
+  }
+
+  wait_state(bus, req, DRI_I2C_REQ_DONE);
+  return (dri_i2c_result_t)req->result;
+}
+
+dri_i2c_result_t dri_i2c_bus_acquire(dri_i2c_bus_t *bus, dri_i2c_req_t *hold,
+                                     uint8_t prio, uint32_t timeout_us)
+{
+  if (hold == NULL)
+  {
+    return DRI_I2C_INVALID;
+  }
+
+  memset(hold, 0, sizeof(*hold));
+  hold->op = DRI_I2C_OP_HOLD;
+  hold->prio = prio;
+  hold->timeout_us = timeout_us;
+
+  dri_i2c_result_t res = submit_ex(bus, hold, current_waiter());
+  if (res != DRI_I2C_OK)
+  {
+    return res;
+  }
+
+  wait_state(bus, hold, DRI_I2C_REQ_ACTIVE);
+  return (hold->state == DRI_I2C_REQ_ACTIVE) ? DRI_I2C_OK
+                                             : (dri_i2c_result_t)hold->result;
+}
+
+void dri_i2c_bus_release(dri_i2c_bus_t *bus, dri_i2c_req_t *hold)
+{
+  if (bus == NULL || hold == NULL)
+  {
+    return;
+  }
+
+  uint32_t key = bus_lock();
+  if (bus->active != hold)
+  {
+    bus_unlock(key);
+    return;
+  }
+  bus->active = NULL;
+  bus->step = NULL;
+  bus->stats.completed++;
+  hold->result = DRI_I2C_OK;
+  hold->state = DRI_I2C_REQ_DONE;
+  bus_unlock(key);
+
+  kick(bus);
+}
+
+dri_i2c_result_t dri_i2c_bus_probe(dri_i2c_bus_t *bus, uint16_t addr,
+                                   uint32_t trials, uint32_t timeout_us)
+{
+  if (bus == NULL || bus->port == NULL || bus->port->probe == NULL)
+  {
+    return DRI_I2C_INVALID;
+  }
+
+  dri_i2c_req_t hold;
+  dri_i2c_result_t res = dri_i2c_bus_acquire(bus, &hold, 0u, timeout_us);
+  if (res != DRI_I2C_OK)
+  {
+    return res;
+  }
+
+  uint32_t t0 = bus->port->now(bus->ctx);
+  res = bus->port->probe(bus->ctx, addr, trials, timeout_us);
+  uint32_t now = bus->port->now(bus->ctx);
+
+  uint32_t key = bus_lock();
+  record_xfer(bus, addr, res, t0, now);
+  if (res == DRI_I2C_FAULT || res == DRI_I2C_TIMEOUT)
+  {
+    bus->need_recover = true;
+  }
+  bus_unlock(key);
+
+  dri_i2c_bus_release(bus, &hold);
+  return res;
+}
+
+static dri_i2c_result_t xfer_simple(dri_i2c_bus_t *bus, dri_i2c_op_t op,
+                                    uint16_t addr, const uint8_t *wbuf,
+                                    uint16_t wlen, uint8_t *rbuf,
+                                    uint16_t rlen, uint32_t timeout_us)
+{
+  dri_i2c_req_t req;
+  memset(&req, 0, sizeof(req));
+  req.op = (uint8_t)op;
+  req.addr = addr;
+  req.wbuf = wbuf;
+  req.wlen = wlen;
+  req.rbuf = rbuf;
+  req.rlen = rlen;
+  req.timeout_us = timeout_us;
+  return dri_i2c_bus_xfer(bus, &req);
+}
+
+dri_i2c_result_t dri_i2c_bus_write(dri_i2c_bus_t *bus, uint16_t addr,
+                                   const uint8_t *data, uint16_t len,
+                                   uint32_t timeout_us)
+{
+  return xfer_simple(bus, DRI_I2C_OP_WRITE, addr, data, len, NULL, 0u,
+                     timeout_us);
+}
+
+dri_i2c_result_t dri_i2c_bus_write_read(dri_i2c_bus_t *bus, uint16_t addr,
+                                        const uint8_t *wbuf, uint16_t wlen,
+                                        uint8_t *rbuf, uint16_t rlen,
+                                        uint32_t timeout_us)
+{
+  return xfer_simple(bus, DRI_I2C_OP_WRITE_READ, addr, wbuf, wlen, rbuf, rlen,
+                     timeout_us);
+}
+
+dri_i2c_result_t dri_i2c_bus_mem_read(dri_i2c_bus_t *bus, uint16_t addr,
+                                      uint16_t mem_addr,
+                                      uint8_t mem_addr_size, uint8_t *data,
+                                      uint16_t len, uint32_t timeout_us)
+{
+  dri_i2c_req_t req;
+  memset(&req, 0, sizeof(req));
+  req.op = DRI_I2C_OP_MEM_READ;
+  req.addr = addr;
+  req.mem_addr = mem_addr;
+  req.mem_addr_size = mem_addr_size;
+  req.rbuf = data;
+  req.rlen = len;
+  req.timeout_us = timeout_us;
+  return dri_i2c_bus_xfer(bus, &req);
+}
+
+dri_i2c_result_t dri_i2c_bus_mem_write(dri_i2c_bus_t *bus, uint16_t addr,
+                                       uint16_t mem_addr,
+                                       uint8_t mem_addr_size,
+                                       const uint8_t *data, uint16_t len,
+                                       uint32_t timeout_us)
+{
+  dri_i2c_req_t req;
+  memset(&req, 0, sizeof(req));
+  req.op = DRI_I2C_OP_MEM_WRITE;
+  req.addr = addr;
+  req.mem_addr = mem_addr;
+  req.mem_addr_size = mem_addr_size;
+  req.wbuf = data;
+  req.wlen = len;
+  req.timeout_us = timeout_us;
+  return dri_i2c_bus_xfer(bus, &req);
+}
+
+void dri_i2c_bus_get_stats(dri_i2c_bus_t *bus, dri_i2c_bus_stats_t *stats)
+{
+  if (bus == NULL || stats == NULL)
+  {
+    return;
+  }
+
+  uint32_t key = bus_lock();
+  *stats = bus->stats;
+  bus_unlock(key);
+}
+
+bool dri_i2c_bus_get_dev_stats(dri_i2c_bus_t *bus, uint16_t addr,
+                               dri_i2c_dev_stats_t *stats)
+{
+  if (bus == NULL || stats == NULL)
+  {
+    return false;
+  }
+
+  uint32_t key = bus_lock();
+  dri_i2c_dev_stats_t *d = dev_find(bus, addr, false);
+  if (d != NULL)
+  {
+    *stats = *d;
+  }
+  bus_unlock(key);
+
+  if (d != NULL && stats->lat_min_us == UINT32_MAX)
+  {
+    stats->lat_min_us = 0;
+  }
+  return d != NULL;
+}
+
+void dri_i2c_bus_reset_stats(dri_i2c_bus_t *bus)
+{
+  if (bus == NULL)
+  {
+    return;
+  }
+
+  uint32_t key = bus_lock();
+  memset(&bus->stats, 0, sizeof(bus->stats));
+  memset(bus->dev, 0, sizeof(bus->dev));
+  bus->dev_used = 0;
+  bus_unlock(key);
+}
+
+/* ==========================
+ * MCU：绑定 dri_i2c 的实例
+ * ========================== */
+#if !defined(DRI_I2C_BUS_HOST) || !DRI_I2C_BUS_HOST
+
+typedef struct
+{
+  dri_i2c_bus_t bus;
+  dri_i2c_id_t id;
+  bool inited;
+} hw_bus_t;
+
+static hw_bus_t s_hw[DRI_I2C_NUM];
+
+static dri_i2c_result_t hw_result(uint32_t err)
+{
+  if (err == HAL_I2C_ERROR_NONE)
+  {
+    return DRI_I2C_OK;
+  }
+  return dri_i2c_err_is_bus_fault(err) ? DRI_I2C_FAULT : DRI_I2C_NACK;
+}
+
+static void hw_done(dri_i2c_id_t id, uint32_t err, void *arg)
+{
+  (void)id;
+  dri_i2c_bus_complete(&((hw_bus_t *)arg)->bus, hw_result(err));
+}
+
+static dri_i2c_result_t hw_start(void *ctx, const dri_i2c_req_t *s)
+{
+  hw_bus_t *hw = (hw_bus_t *)ctx;
+  uint16_t msize =
+      (s->mem_addr_size == 2u) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+  HAL_StatusTypeDef st = HAL_ERROR;
+
+  switch ((dri_i2c_op_t)s->op)
+  {
+  case DRI_I2C_OP_WRITE:
+    st = dri_i2c_write_it(hw->id, s->addr, s->wbuf, s->wlen);
+    break;
+  case DRI_I2C_OP_READ:
+    st = dri_i2c_read_it(hw->id, s->addr, s->rbuf, s->rlen);
+    break;
+  case DRI_I2C_OP_WRITE_READ:
+    st = dri_i2c_write_read_it(hw->id, s->addr, s->wbuf, s->wlen, s->rbuf,
+                               s->rlen);
+    break;
+  case DRI_I2C_OP_MEM_READ:
+    st = dri_i2c_mem_read_it(hw->id, s->addr, s->mem_addr, msize, s->rbuf,
+                             s->rlen);
+    break;
+  case DRI_I2C_OP_MEM_WRITE:
+    st = dri_i2c_mem_write_it(hw->id, s->addr, s->mem_addr, msize, s->wbuf,
+                              s->wlen);
+    break;
+  default:
+    break;
+  }
+
+  /* HAL_BUSY 多为 BUSY 位卡死（从机拉住 SDA），按总线故障处理以触发恢复 */
+  return (st == HAL_OK) ? DRI_I2C_OK : DRI_I2C_FAULT;
+}
+
+static void hw_abort(void *ctx)
+{
+  dri_i2c_abort(((hw_bus_t *)ctx)->id);
+}
+
+static bool hw_recover(void *ctx)
+{
+  return dri_i2c_recover(((hw_bus_t *)ctx)->id) == HAL_OK;
+}
+
+static dri_i2c_result_t hw_probe(void *ctx, uint16_t addr, uint32_t trials,
+                                 uint32_t timeout_us)
+{
+  uint32_t ms = (timeout_us + 999u) / 1000u;
+  HAL_StatusTypeDef st =
+      dri_i2c_is_device_ready(((hw_bus_t *)ctx)->id, addr, trials, ms);
+  if (st == HAL_OK)
+  {
+    return DRI_I2C_OK;
+  }
+  return (st == HAL_ERROR) ? DRI_I2C_NACK : DRI_I2C_FAULT;
+}
+
+static uint32_t hw_now(void *ctx)
+{
+  (void)ctx;
+  return dri_time_cycles_now();
+}
+
+/* 调度器启动前没有任务通知可等，直接轮询中断处理函数推进传输 */
+static void hw_poll(void *ctx)
+{
+  dri_i2c_id_t id = ((hw_bus_t *)ctx)->id;
+  dri_i2c_ev_irq_handler(id);
+  dri_i2c_er_irq_handler(id);
+}
+
+static const dri_i2c_bus_port_t s_hw_port = {
+    .start = hw_start,
+    .abort = hw_abort,
+    .recover = hw_recover,
+    .probe = hw_probe,
+    .now = hw_now,
+    .poll = hw_poll,
+};
+
+dri_i2c_bus_t *dri_i2c_bus_get(dri_i2c_id_t id)
+{
+  if ((uint32_t)id >= (uint32_t)DRI_I2C_NUM)
+  {
+    return NULL;
+  }
+
+  hw_bus_t *hw = &s_hw[id];
+  if (!hw->inited)
+  {
+    if (dri_i2c_init(id) != HAL_OK)
+    {
+      return NULL;
+    }
+    hw->id = id;
+    dri_i2c_bus_init(&hw->bus, &s_hw_port, hw, SystemCoreClock / 1000000u);
+    dri_i2c_set_done_cb(id, hw_done, hw);
+    hw->inited = true;
+  }
+  return &hw->bus;
+}
+
+#endif
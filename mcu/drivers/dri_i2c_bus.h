@@ -0,0 +1,224 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if !defined(DRI_I2C_BUS_HOST) || !DRI_I2C_BUS_HOST
+#include "dri_i2c.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * drivers/ 层：I2C 总线管理（每个 I2C 实例一个，多个任务/器件共享）
+ *
+ * 做法：
+ * - 请求结构由调用方持有（可放在栈上或静态区），按 prio 插入队列（高优先在前，同级 FIFO），
+ *   总线空闲时取队首，经 port->start 以中断方式传输，完成中断里接着启动下一个
+ * - chain：本请求成功后不让出总线、立即执行 chain 指向的请求（多段事务），
+ *   结果与回调只在链首请求上体现
+ * - 完成通知：done 回调（中断上下文）；同步接口 dri_i2c_bus_xfer 用任务通知等待
+ * - 超时从提交开始计；排队中的直接出队，传输中的立即停外设并标记需恢复
+ * - 总线故障（BERR/ARLO/超时等）后，下一次传输前自动执行总线恢复
+ * - 按器件地址统计：传输次数、NACK/故障/超时次数、传输耗时与最长排队等待
+ * - HOLD：独占总线，用于需要阻塞 HAL 接口的地址探测
+ *
+ * 可移植性：
+ * - 状态机只通过 dri_i2c_bus_port_t 访问硬件，本头文件不依赖 HAL
+ * - 主机构建（DRI_I2C_BUS_HOST=1）用模拟从机实现 port，即可驱动同一套状态机；
+ *   锁与任务通知在主机上为空操作，同步等待时循环调用 port->poll 推进模拟
+ * - MCU 上 dri_i2c_bus_get() 返回绑定到 dri_i2c 的实例
+ *
+ * 同步等待占用调用任务通知值的 DRI_I2C_BUS_NOTIFY_BIT 位（eSetBits），
+ * 其它位/计数语义不受影响（ser_lvgl_bind 用 ulTaskNotifyTake 计数唤醒 LVGL 任务）
+ */
+
+#ifndef DRI_I2C_BUS_MAX_DEV
+#define DRI_I2C_BUS_MAX_DEV 8u
+#endif
+
+/* req->timeout_us 为 0 时使用 */
+#ifndef DRI_I2C_BUS_DEFAULT_TIMEOUT_US
+#define DRI_I2C_BUS_DEFAULT_TIMEOUT_US 50000u
+#endif
+
+#define DRI_I2C_BUS_NOTIFY_BIT (1ul << 31)
+
+typedef enum
+{
+  DRI_I2C_OK = 0,
+  DRI_I2C_NACK,      /* 地址或数据未应答（器件不在/忙） */
+  DRI_I2C_FAULT,     /* 总线故障，已安排恢复 */
+  DRI_I2C_TIMEOUT,   /* 提交后超时 */
+  DRI_I2C_CANCELLED, /* 被 dri_i2c_bus_cancel 取消 */
+  DRI_I2C_INVALID,   /* 参数错误 / 请求仍在使用中 */
+} dri_i2c_result_t;
+
+typedef enum
+{
+  DRI_I2C_OP_WRITE = 0,
+  DRI_I2C_OP_READ,
+  DRI_I2C_OP_WRITE_READ, /* wbuf 后重复起始读 rbuf */
+  DRI_I2C_OP_MEM_READ,   /* mem_addr(1/2 字节) 后读 rbuf */
+  DRI_I2C_OP_MEM_WRITE,  /* mem_addr(1/2 字节) 后写 wbuf */
+  DRI_I2C_OP_HOLD,       /* 不传输，只独占总线（内部用于探测） */
+} dri_i2c_op_t;
+
+typedef enum
+{
+  DRI_I2C_REQ_IDLE = 0,
+  DRI_I2C_REQ_QUEUED,
+  DRI_I2C_REQ_ACTIVE,
+  DRI_I2C_REQ_DONE,
+} dri_i2c_req_state_t;
+
+typedef struct dri_i2c_req dri_i2c_req_t;
+typedef void (*dri_i2c_req_cb_t)(dri_i2c_req_t *req, void *arg);
+
+struct dri_i2c_req
+{
+  /* 调用方填写 */
+  uint8_t op;            /* dri_i2c_op_t */
+  uint8_t prio;          /* 越大越先执行 */
+  uint8_t mem_addr_size; /* MEM_READ/MEM_WRITE：寄存器地址字节数 1 或 2 */
+  uint16_t addr;         /* 7-bit 器件地址 */
+  uint16_t mem_addr;
+  const uint8_t *wbuf;
+  uint16_t wlen;
+  uint8_t *rbuf;
+  uint16_t rlen;
+  uint32_t timeout_us;   /* 0：DRI_I2C_BUS_DEFAULT_TIMEOUT_US */
+  dri_i2c_req_t *chain;  /* 可为 NULL */
+  dri_i2c_req_cb_t done; /* 可为 NULL；中断上下文 */
+  void *arg;
+
+  /* 以下由总线管理维护 */
+  dri_i2c_req_t *next;
+  volatile uint8_t state;  /* dri_i2c_req_state_t */
+  volatile uint8_t result; /* dri_i2c_result_t，state 为 DONE 后有效 */
+  uint32_t t_submit;
+  uint32_t t_start;
+  void *waiter;
+};
+
+/*
+ * 硬件抽象：
+ * - start：非阻塞启动一次传输（chain 的每一段各调用一次）；返回 OK 表示已启动，
+ *   结束时（任意上下文）调用 dri_i2c_bus_complete；返回其它值表示未启动
+ * - abort：立即停止当前传输，之后不得再调用 complete
+ * - recover：总线恢复，返回 false 表示总线仍异常
+ * - probe：阻塞探测地址 ACK（总线已由 HOLD 独占）
+ * - now：单调递增计数（回绕按差值处理），ticks_per_us 由 dri_i2c_bus_init 给出
+ * - poll：可为 NULL；调度器未运行（或主机仿真）时同步等待期间循环调用
+ */
+typedef struct
+{
+  dri_i2c_result_t (*start)(void *ctx, const dri_i2c_req_t *step);
+  void (*abort)(void *ctx);
+  bool (*recover)(void *ctx);
+  dri_i2c_result_t (*probe)(void *ctx, uint16_t addr, uint32_t trials,
+                            uint32_t timeout_us);
+  uint32_t (*now)(void *ctx);
+  void (*poll)(void *ctx);
+} dri_i2c_bus_port_t;
+
+typedef struct
+{
+  uint16_t addr;
+  uint32_t xfers;       /* 结束的传输段数（含失败） */
+  uint32_t nacks;
+  uint32_t faults;
+  uint32_t timeouts;
+  uint32_t lat_last_us; /* 成功传输：启动 -> 完成 */
+  uint32_t lat_min_us;
+  uint32_t lat_max_us;
+  uint64_t lat_sum_us;
+  uint32_t wait_max_us; /* 提交 -> 启动 */
+} dri_i2c_dev_stats_t;
+
+typedef struct
+{
+  uint32_t submitted;
+  uint32_t completed;
+  uint32_t recoveries;
+  uint32_t recover_failed;
+  uint32_t queue_peak;
+  uint32_t untracked; /* 统计表满，未记录的传输段数 */
+} dri_i2c_bus_stats_t;
+
+/* 总线实例：字段仅供本模块使用，调用方只分配存储 */
+typedef struct
+{
+  const dri_i2c_bus_port_t *port;
+  void *ctx;
+  uint32_t ticks_per_us;
+  dri_i2c_req_t *queue;
+  dri_i2c_req_t *active; /* 链首 */
+  dri_i2c_req_t *step;   /* 链中正在传输的一段 */
+  uint32_t queue_len;
+  bool need_recover;
+  dri_i2c_bus_stats_t stats;
+  dri_i2c_dev_stats_t dev[DRI_I2C_BUS_MAX_DEV];
+  uint8_t dev_used;
+} dri_i2c_bus_t;
+
+void dri_i2c_bus_init(dri_i2c_bus_t *bus, const dri_i2c_bus_port_t *port,
+                      void *ctx, uint32_t ticks_per_us);
+
+/* 异步提交；req 在 done 回调前必须保持有效且不得修改 */
+dri_i2c_result_t dri_i2c_bus_submit(dri_i2c_bus_t *bus, dri_i2c_req_t *req);
+
+/* 提交并等待完成（任务上下文） */
+dri_i2c_result_t dri_i2c_bus_xfer(dri_i2c_bus_t *bus, dri_i2c_req_t *req);
+
+/* 取消排队中或传输中的请求；返回 false 表示已结束或不属于本总线 */
+bool dri_i2c_bus_cancel(dri_i2c_bus_t *bus, dri_i2c_req_t *req,
+                        dri_i2c_result_t why);
+
+/* 超时检查；同步等待内部会调用，纯异步使用时由调用方周期调用 */
+void dri_i2c_bus_poll(dri_i2c_bus_t *bus);
+
+/* 传输段结束，由 port 调用（任意上下文） */
+void dri_i2c_bus_complete(dri_i2c_bus_t *bus, dri_i2c_result_t res);
+
+/* 独占总线：hold 在 release 前必须保持有效 */
+dri_i2c_result_t dri_i2c_bus_acquire(dri_i2c_bus_t *bus, dri_i2c_req_t *hold,
+                                     uint8_t prio, uint32_t timeout_us);
+void dri_i2c_bus_release(dri_i2c_bus_t *bus, dri_i2c_req_t *hold);
+
+/* 常用同步封装 */
+dri_i2c_result_t dri_i2c_bus_probe(dri_i2c_bus_t *bus, uint16_t addr,
+                                   uint32_t trials, uint32_t timeout_us);
+dri_i2c_result_t dri_i2c_bus_write(dri_i2c_bus_t *bus, uint16_t addr,
+                                   const uint8_t *data, uint16_t len,
+                                   uint32_t timeout_us);
+dri_i2c_result_t dri_i2c_bus_write_read(dri_i2c_bus_t *bus, uint16_t addr,
+                                        const uint8_t *wbuf, uint16_t wlen,
+                                        uint8_t *rbuf, uint16_t rlen,
+                                        uint32_t timeout_us);
+dri_i2c_result_t dri_i2c_bus_mem_read(dri_i2c_bus_t *bus, uint16_t addr,
+                                      uint16_t mem_addr,
+                                      uint8_t mem_addr_size, uint8_t *data,
+                                      uint16_t len, uint32_t timeout_us);
+dri_i2c_result_t dri_i2c_bus_mem_write(dri_i2c_bus_t *bus, uint16_t addr,
+                                       uint16_t mem_addr,
+                                       uint8_t mem_addr_size,
+                                       const uint8_t *data, uint16_t len,
+                                       uint32_t timeout_us);
+
+/* 统计查询；dev_stats 找不到该地址时返回 false */
+void dri_i2c_bus_get_stats(dri_i2c_bus_t *bus, dri_i2c_bus_stats_t *stats);
+bool dri_i2c_bus_get_dev_stats(dri_i2c_bus_t *bus, uint16_t addr,
+                               dri_i2c_dev_stats_t *stats);
+void dri_i2c_bus_reset_stats(dri_i2c_bus_t *bus);
+
+#if !defined(DRI_I2C_BUS_HOST) || !DRI_I2C_BUS_HOST
+/* 绑定到片上 I2C 实例的总线（首次调用时初始化外设） */
+dri_i2c_bus_t *dri_i2c_bus_get(dri_i2c_id_t id);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
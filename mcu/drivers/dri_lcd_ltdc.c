@@ -9,6 +9,37 @@ static uint32_t s_w = 0;
 static uint32_t s_h = 0;
 static dri_lcd_fb_format_t s_fb_format = DRI_LCD_FB_RGB565;
 
+static uint32_t to_ltdc_pixel_format(dri_lcd_fb_format_t fmt)
+{
+  switch (fmt)
+  {
+  case DRI_LCD_FB_ARGB8888:
+    return LTDC_PIXEL_FORMAT_ARGB8888;
+  case DRI_LCD_FB_ARGB4444:
+    return LTDC_PIXEL_FORMAT_ARGB4444;
+  case DRI_LCD_FB_L8:
+    return LTDC_PIXEL_FORMAT_L8;
+  case DRI_LCD_FB_RGB565:
+  default:
+    return LTDC_PIXEL_FORMAT_RGB565;
+  }
+}
+
+uint32_t dri_lcd_fb_bytes_per_pixel(dri_lcd_fb_format_t fmt)
+{
+  switch (fmt)
+  {
+  case DRI_LCD_FB_ARGB8888:
+    return 4u;
+  case DRI_LCD_FB_L8:
+    return 1u;
+  case DRI_LCD_FB_ARGB4444:
+  case DRI_LCD_FB_RGB565:
+  default:
+    return 2u;
+  }
+}
+
 HAL_StatusTypeDef dri_lcd_ltdc_init(const dri_lcd_ltdc_cfg_t *cfg)
 {
   if (cfg == NULL || cfg->width == 0 || cfg->height == 0)
@@ -73,64 +104,161 @@ HAL_StatusTypeDef dri_lcd_ltdc_init(const dri_lcd_ltdc_cfg_t *cfg)
   /*
    * 配置 Layer0 读取帧缓冲并输出到面板
    */
-  LTDC_LayerCfgTypeDef layer_cfg = {0};
-  layer_cfg.WindowX0 = 0;
-  layer_cfg.WindowX1 = cfg->width;
-  layer_cfg.WindowY0 = 0;
-  layer_cfg.WindowY1 = cfg->height;
-
-  if (cfg->fb_format == DRI_LCD_FB_RGB565)
+  const dri_lcd_ltdc_layer_cfg_t layer0 = {
+      .framebuffer_addr = cfg->framebuffer_addr,
+      .fb_format = cfg->fb_format,
+      .x0 = 0,
+      .y0 = 0,
+      .width = (uint16_t)cfg->width,
+      .height = (uint16_t)cfg->height,
+      .alpha = 255,
+  };
+  status = dri_lcd_ltdc_layer_config(DRI_LCD_LAYER_0, &layer0);
+  if (status != HAL_OK)
   {
-    layer_cfg.PixelFormat = LTDC_PIXEL_FORMAT_RGB565;
+    return status;
   }
-  else
+
+  boa_lcd_backlight_on();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_layer_config(uint32_t layer_idx,
+                                            const dri_lcd_ltdc_layer_cfg_t *cfg)
+{
+  if (cfg == NULL || layer_idx > DRI_LCD_LAYER_1 || cfg->width == 0u ||
+      cfg->height == 0u)
   {
-    layer_cfg.PixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
+    return HAL_ERROR;
   }
 
-  layer_cfg.FBStartAdress = (uint32_t)cfg->framebuffer_addr;
-  layer_cfg.Alpha = 255;
+  LTDC_LayerCfgTypeDef layer_cfg = {0};
+  layer_cfg.WindowX0 = cfg->x0;
+  layer_cfg.WindowX1 = (uint32_t)cfg->x0 + cfg->width;
+  layer_cfg.WindowY0 = cfg->y0;
+  layer_cfg.WindowY1 = (uint32_t)cfg->y0 + cfg->height;
+  layer_cfg.PixelFormat = to_ltdc_pixel_format(cfg->fb_format);
+  layer_cfg.FBStartAdress = cfg->framebuffer_addr;
+  layer_cfg.Alpha = cfg->alpha;
   layer_cfg.Alpha0 = 0;
   layer_cfg.Backcolor.Red = 0;
   layer_cfg.Backcolor.Green = 0;
   layer_cfg.Backcolor.Blue = 0;
+  /*
+   * 混合因子：
+   * - Layer0 直接与背景色混合，恒定 alpha=255 时等价于不混合
+   * - Layer1 使用 像素alpha x 常量alpha，便于 ARGB4444 浮层做半透明
+   */
   layer_cfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
   layer_cfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
   layer_cfg.ImageWidth = cfg->width;
   layer_cfg.ImageHeight = cfg->height;
 
-  status = HAL_LTDC_ConfigLayer(&hltdc, &layer_cfg, 0);
+  HAL_StatusTypeDef status = HAL_LTDC_ConfigLayer(&hltdc, &layer_cfg, layer_idx);
   if (status != HAL_OK)
   {
     return status;
   }
 
-  boa_lcd_backlight_on();
+  if (layer_idx == DRI_LCD_LAYER_0)
+  {
+    s_fb_addr = cfg->framebuffer_addr;
+    s_fb_format = cfg->fb_format;
+  }
   return HAL_OK;
 }
 
-void dri_lcd_fill_rgb565(uint16_t rgb565)
+HAL_StatusTypeDef dri_lcd_ltdc_layer_disable(uint32_t layer_idx)
+{
+  if (layer_idx > DRI_LCD_LAYER_1)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LTDC_LAYER_DISABLE(&hltdc, layer_idx);
+  return HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+void dri_lcd_ltdc_enable(bool on)
+{
+  if (on)
+  {
+    __HAL_LTDC_ENABLE(&hltdc);
+  }
+  else
+  {
+    __HAL_LTDC_DISABLE(&hltdc);
+  }
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_load_clut(uint32_t layer_idx,
+                                         const uint32_t *clut, uint32_t n)
 {
-  if (s_fb_format != DRI_LCD_FB_RGB565)
+  if (clut == NULL || n == 0u || n > DRI_LCD_CLUT_MAX ||
+      layer_idx > DRI_LCD_LAYER_1)
   {
-    (void)rgb565;
-    return;
+    return HAL_ERROR;
   }
 
+  /*
+   * CLUT 写入 LTDC_LxCLUTWR，HAL 会逐项写入并立即重载。
+   * 256 项只需几微秒，可在运行中切换调色板（下一帧生效）。
+   */
+  HAL_StatusTypeDef status = HAL_LTDC_ConfigCLUT(&hltdc, clut, n, layer_idx);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  return HAL_LTDC_EnableCLUT(&hltdc, layer_idx);
+}
+
+dri_lcd_fb_format_t dri_lcd_fb_format(void)
+{
+  return s_fb_format;
+}
+
+void dri_lcd_fill_raw(uint32_t value)
+{
   /*
    * 最简单的“单色填充”：
-   * - 直接把帧缓冲每个像素写成同一个 RGB565 值
+   * - 直接把帧缓冲每个像素写成同一个原生像素值
    *
    * 注意：
    * - 帧缓冲位于外部 SDRAM，地址为 LTDC_BUFF_ADDR
    * - 在 LTDC 已经启动读取之前填充，能更直观地看到效果
    */
-  volatile uint16_t *fb = (volatile uint16_t *)(s_fb_addr);
   uint32_t pixel_count = (uint32_t)s_w * (uint32_t)s_h;
 
-  for (uint32_t i = 0; i < pixel_count; i++)
+  switch (dri_lcd_fb_bytes_per_pixel(s_fb_format))
+  {
+  case 1u:
+  {
+    volatile uint8_t *fb = (volatile uint8_t *)(s_fb_addr);
+    for (uint32_t i = 0; i < pixel_count; i++)
+    {
+      fb[i] = (uint8_t)value;
+    }
+    break;
+  }
+  case 4u:
+  {
+    volatile uint32_t *fb = (volatile uint32_t *)(s_fb_addr);
+    for (uint32_t i = 0; i < pixel_count; i++)
+    {
+      fb[i] = value;
+    }
+    break;
+  }
+  default:
   {
-    fb[i] = rgb565;
+    volatile uint16_t *fb = (volatile uint16_t *)(s_fb_addr);
+    for (uint32_t i = 0; i < pixel_count; i++)
+    {
+      fb[i] = (uint16_t)value;
+    }
+    break;
+  }
   }
 }
 
@@ -143,3 +271,51 @@ LTDC_HandleTypeDef *dri_lcd_ltdc_handle(void)
 {
   return &hltdc;
 }
+
+uint32_t dri_lcd_ltdc_pixel_clock_hz(void)
+{
+  /* LTDCclk = (PLL 输入 / PLLM) * PLLSAIN / PLLSAIR / PLLSAIDIVR */
+  uint32_t pllm = (RCC->PLLCFGR & RCC_PLLCFGR_PLLM_Msk) >> RCC_PLLCFGR_PLLM_Pos;
+  uint32_t n = (RCC->PLLSAICFGR & RCC_PLLSAICFGR_PLLSAIN_Msk) >>
+               RCC_PLLSAICFGR_PLLSAIN_Pos;
+  uint32_t r = (RCC->PLLSAICFGR & RCC_PLLSAICFGR_PLLSAIR_Msk) >>
+               RCC_PLLSAICFGR_PLLSAIR_Pos;
+  uint32_t divr = 2u << ((RCC->DCKCFGR & RCC_DCKCFGR_PLLSAIDIVR_Msk) >>
+                         RCC_DCKCFGR_PLLSAIDIVR_Pos);
+  if (pllm == 0u || n == 0u || r == 0u)
+  {
+    return 0u;
+  }
+
+  uint32_t src = ((RCC->PLLCFGR & RCC_PLLCFGR_PLLSRC) != 0u) ? HSE_VALUE
+                                                              : HSI_VALUE;
+  return (uint32_t)(((uint64_t)src * n) / pllm / r / divr);
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_scan_pos(dri_lcd_ltdc_scan_t *out)
+{
+  if (out == NULL || s_w == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  uint32_t pclk = dri_lcd_ltdc_pixel_clock_hz();
+  if (pclk == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  /* BPCR/TWCR 保存的是“累计值 - 1” */
+  uint32_t total_w =
+      ((LTDC->TWCR & LTDC_TWCR_TOTALW_Msk) >> LTDC_TWCR_TOTALW_Pos) + 1u;
+  uint32_t total_h =
+      ((LTDC->TWCR & LTDC_TWCR_TOTALH_Msk) >> LTDC_TWCR_TOTALH_Pos) + 1u;
+  uint32_t avbp = ((LTDC->BPCR & LTDC_BPCR_AVBP_Msk) >> LTDC_BPCR_AVBP_Pos);
+
+  out->line = (uint16_t)((LTDC->CPSR & LTDC_CPSR_CYPOS_Msk) >>
+                         LTDC_CPSR_CYPOS_Pos);
+  out->active_y0 = (uint16_t)(avbp + 1u);
+  out->total_lines = (uint16_t)total_h;
+  out->line_ns = (uint32_t)(((uint64_t)total_w * 1000000000ull) / pclk);
+  return HAL_OK;
+}
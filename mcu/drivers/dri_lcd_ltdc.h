@@ -2,6 +2,8 @@
 
 #include "stm32f4xx_hal.h"
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -19,8 +21,17 @@ typedef enum
 {
   DRI_LCD_FB_RGB565 = 0,
   DRI_LCD_FB_ARGB8888 = 1,
+  DRI_LCD_FB_ARGB4444 = 2,
+  DRI_LCD_FB_L8 = 3, /* 8-bit 索引色，颜色由 CLUT 决定 */
 } dri_lcd_fb_format_t;
 
+/* LTDC 共有两个图层：Layer0 为底层，Layer1 叠加在其上 */
+#define DRI_LCD_LAYER_0 0u
+#define DRI_LCD_LAYER_1 1u
+
+/* LTDC 每个图层的 CLUT 最多 256 项 */
+#define DRI_LCD_CLUT_MAX 256u
+
 typedef struct
 {
   uint16_t hsync;
@@ -40,10 +51,56 @@ typedef struct
   dri_lcd_ltdc_timing_t timing;
 } dri_lcd_ltdc_cfg_t;
 
+/*
+ * 单个图层的配置（窗口 + 帧缓冲 + 像素格式）
+ * - 窗口坐标相对于有效显示区左上角
+ * - 帧缓冲行宽等于窗口宽度（不支持额外 pitch）
+ */
+typedef struct
+{
+  uint32_t framebuffer_addr;
+  dri_lcd_fb_format_t fb_format;
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t width;
+  uint16_t height;
+  uint8_t alpha; /* 图层整体透明度：255 不透明 */
+} dri_lcd_ltdc_layer_cfg_t;
+
 HAL_StatusTypeDef dri_lcd_ltdc_init(const dri_lcd_ltdc_cfg_t *cfg);
 
-/* 仅示例：RGB565 单色填充 */
-void dri_lcd_fill_rgb565(uint16_t rgb565);
+/*
+ * 配置/重配置某个图层（Layer0 由 dri_lcd_ltdc_init 按 cfg 配好）
+ * - 常见用法：Layer0 放 L8/RGB565 背景，Layer1 放 ARGB4444 半透明浮层
+ */
+HAL_StatusTypeDef dri_lcd_ltdc_layer_config(uint32_t layer_idx,
+                                            const dri_lcd_ltdc_layer_cfg_t *cfg);
+
+/* 关闭某个图层（不再占用 SDRAM 扫描带宽） */
+HAL_StatusTypeDef dri_lcd_ltdc_layer_disable(uint32_t layer_idx);
+
+/* 整体开关 LTDC 扫描（关闭后面板保持最后一帧若干毫秒后变暗/花屏，仅供测试） */
+void dri_lcd_ltdc_enable(bool on);
+
+/*
+ * 装载 CLUT（仅对 L8 图层有意义）
+ * - clut 每项为 0x00RRGGBB
+ * - n 不超过 DRI_LCD_CLUT_MAX；装载后自动使能该图层的 CLUT
+ */
+HAL_StatusTypeDef dri_lcd_ltdc_load_clut(uint32_t layer_idx,
+                                         const uint32_t *clut, uint32_t n);
+
+/* 像素格式对应的每像素字节数 */
+uint32_t dri_lcd_fb_bytes_per_pixel(dri_lcd_fb_format_t fmt);
+
+/* Layer0 当前像素格式 */
+dri_lcd_fb_format_t dri_lcd_fb_format(void);
+
+/*
+ * 仅示例：Layer0 单色填充
+ * - value 为帧缓冲原生像素值（RGB565/ARGB4444/L8 索引/ARGB8888），由上层完成颜色转换
+ */
+void dri_lcd_fill_raw(uint32_t value);
 
 /* 返回 LTDC 帧缓冲指针（用于 LVGL 等上层） */
 void *dri_lcd_framebuffer(void);
@@ -51,6 +108,24 @@ void *dri_lcd_framebuffer(void);
 /* 返回内部保存的 LTDC handle，便于调试/扩展 */
 LTDC_HandleTypeDef *dri_lcd_ltdc_handle(void);
 
+/*
+ * 当前扫描位置（读 LTDC CPSR，可在任意上下文调用）
+ * - 行号从 VSYNC 开始计数：0..total_lines-1，有效区为 active_y0..active_y0+height-1
+ * - line_ns 由 PLLSAI 实际配置反推像素时钟再乘总行宽得到
+ */
+typedef struct
+{
+  uint16_t line;
+  uint16_t active_y0;
+  uint16_t total_lines;
+  uint32_t line_ns;
+} dri_lcd_ltdc_scan_t;
+
+HAL_StatusTypeDef dri_lcd_ltdc_scan_pos(dri_lcd_ltdc_scan_t *out);
+
+/* LTDC 像素时钟（Hz），PLLSAI 未配置时返回 0 */
+uint32_t dri_lcd_ltdc_pixel_clock_hz(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,8 +9,30 @@
  */
 
 static SDRAM_HandleTypeDef hsdram;
+static uint32_t s_profile = DRI_SDRAM_PROFILE_DEFAULT;
 
-static void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram_handle)
+/*
+ * 配置档表（180MHz HCLK）
+ * - 0 号与原硬编码参数一致；调整默认档请改 DRI_SDRAM_PROFILE_DEFAULT
+ * - 60MHz 档每个参数按 16.7ns 周期重新取整，用作带宽下限参考
+ */
+static const dri_sdram_profile_t s_profiles[] = {
+    {"default", 2, 3, 1, true, true, 2, 7, 4, 7, 2, 2, 2},
+    {"cas2", 2, 2, 1, true, true, 2, 7, 4, 6, 2, 2, 2},
+    {"cas2_rpipe0", 2, 2, 0, true, false, 2, 7, 4, 6, 2, 2, 2},
+    {"no_rburst", 2, 3, 1, false, true, 2, 7, 4, 7, 2, 2, 2},
+    {"sdclk60", 3, 2, 1, true, true, 2, 5, 3, 4, 2, 1, 1},
+};
+
+#define PROFILE_NUM (sizeof(s_profiles) / sizeof(s_profiles[0]))
+
+static uint32_t sdclk_hz(const dri_sdram_profile_t *p)
+{
+  return HAL_RCC_GetHCLKFreq() / p->sdclk_div;
+}
+
+static void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram_handle,
+                                          const dri_sdram_profile_t *p)
 {
   FMC_SDRAM_CommandTypeDef command;
 
@@ -43,13 +65,13 @@ static void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram_handle)
    * W9825G6KH 等常见 SDRAM：
    * - Burst Length = 1 (0x0000)
    * - Burst Type = Sequential (0x0000)
-   * - CAS Latency = 3 (0x0030)
+   * - CAS Latency = 2/3 (0x0020/0x0030)，必须与 FMC 的 CASLatency 一致
    * - Operating Mode = Standard (0x0000)
    * - Write Burst Mode = Single (0x0200)
    *
-   * 如果你的 SDRAM CAS/突发配置不同，需要按芯片手册修改该值。
+   * 默认档得到 0x0230，与原先硬编码值相同。
    */
-  uint32_t mode_register = 0x0230;
+  uint32_t mode_register = 0x0200u | ((uint32_t)p->cas << 4);
 
   command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
   command.CommandTarget = FMC_SDRAM_CMD_TARGET_BANK2;
@@ -60,16 +82,14 @@ static void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram_handle)
   /*
    * 5) 设置刷新计数器
    *
-   * 刷新计数器的计算依赖 SDRAM 时钟频率（FMC 时钟）与刷新周期。
-   * 这里给出一组常见参考值（90MHz 时钟、7.81us 刷新周期）：
-   *   RefreshRate = 683
-   *
-   * 如果你修改了系统时钟 / FMC 时钟，请重新计算。
+   * 64ms / 8192 行 = 7.81us 刷新周期：
+   *   RefreshRate = 7.81us * SDCLK - 20（90MHz 时为 682，60MHz 时为 448）
    */
-  HAL_SDRAM_ProgramRefreshRate(hsdram_handle, 683);
+  uint32_t refresh = (uint32_t)((uint64_t)sdclk_hz(p) * 781u / 100000000u);
+  HAL_SDRAM_ProgramRefreshRate(hsdram_handle, refresh - 20u);
 }
 
-HAL_StatusTypeDef dri_sdram_init(void)
+static HAL_StatusTypeDef sdram_setup(const dri_sdram_profile_t *p)
 {
   FMC_SDRAM_TimingTypeDef sdram_timing;
 
@@ -86,14 +106,19 @@ HAL_StatusTypeDef dri_sdram_init(void)
   hsdram.Init.RowBitsNumber = FMC_SDRAM_ROW_BITS_NUM_12;
   hsdram.Init.MemoryDataWidth = FMC_SDRAM_MEM_BUS_WIDTH_16;
   hsdram.Init.InternalBankNumber = FMC_SDRAM_INTERN_BANKS_NUM_4;
-  hsdram.Init.CASLatency = FMC_SDRAM_CAS_LATENCY_3;
+  hsdram.Init.CASLatency =
+      (p->cas == 2u) ? FMC_SDRAM_CAS_LATENCY_2 : FMC_SDRAM_CAS_LATENCY_3;
   hsdram.Init.WriteProtection = FMC_SDRAM_WRITE_PROTECTION_DISABLE;
-  hsdram.Init.SDClockPeriod = FMC_SDRAM_CLOCK_PERIOD_2;
-  hsdram.Init.ReadBurst = FMC_SDRAM_RBURST_ENABLE;
-  hsdram.Init.ReadPipeDelay = FMC_SDRAM_RPIPE_DELAY_1;
+  hsdram.Init.SDClockPeriod = (p->sdclk_div == 3u) ? FMC_SDRAM_CLOCK_PERIOD_3
+                                                   : FMC_SDRAM_CLOCK_PERIOD_2;
+  hsdram.Init.ReadBurst =
+      p->read_burst ? FMC_SDRAM_RBURST_ENABLE : FMC_SDRAM_RBURST_DISABLE;
+  hsdram.Init.ReadPipeDelay = (p->rpipe == 0u)   ? FMC_SDRAM_RPIPE_DELAY_0
+                              : (p->rpipe == 2u) ? FMC_SDRAM_RPIPE_DELAY_2
+                                                 : FMC_SDRAM_RPIPE_DELAY_1;
 
   /*
-   * SDRAM 时序（以 90MHz SDRAM 时钟为例的常见值）
+   * SDRAM 时序（见配置档表）
    *
    * 这些参数强依赖：
    * - FMC 时钟频率
@@ -101,13 +126,13 @@ HAL_StatusTypeDef dri_sdram_init(void)
    *
    * 如果 SDRAM 访问异常（HardFault/数据错乱/LTDC 花屏），请优先校准这里。
    */
-  sdram_timing.LoadToActiveDelay = 2;
-  sdram_timing.ExitSelfRefreshDelay = 7;
-  sdram_timing.SelfRefreshTime = 4;
-  sdram_timing.RowCycleDelay = 7;
-  sdram_timing.WriteRecoveryTime = 2;
-  sdram_timing.RPDelay = 2;
-  sdram_timing.RCDDelay = 2;
+  sdram_timing.LoadToActiveDelay = p->t_mrd;
+  sdram_timing.ExitSelfRefreshDelay = p->t_xsr;
+  sdram_timing.SelfRefreshTime = p->t_ras;
+  sdram_timing.RowCycleDelay = p->t_rc;
+  sdram_timing.WriteRecoveryTime = p->t_wr;
+  sdram_timing.RPDelay = p->t_rp;
+  sdram_timing.RCDDelay = p->t_rcd;
 
   HAL_StatusTypeDef status = HAL_SDRAM_Init(&hsdram, &sdram_timing);
   if (status != HAL_OK)
@@ -115,10 +140,45 @@ HAL_StatusTypeDef dri_sdram_init(void)
     return status;
   }
 
-  SDRAM_Initialization_Sequence(&hsdram);
+  SDRAM_Initialization_Sequence(&hsdram, p);
   return HAL_OK;
 }
 
+HAL_StatusTypeDef dri_sdram_init(void)
+{
+  return dri_sdram_apply_profile(DRI_SDRAM_PROFILE_DEFAULT);
+}
+
+uint32_t dri_sdram_profile_count(void)
+{
+  return (uint32_t)PROFILE_NUM;
+}
+
+const dri_sdram_profile_t *dri_sdram_profile(uint32_t idx)
+{
+  return (idx < PROFILE_NUM) ? &s_profiles[idx] : NULL;
+}
+
+uint32_t dri_sdram_profile_active(void)
+{
+  return s_profile;
+}
+
+HAL_StatusTypeDef dri_sdram_apply_profile(uint32_t idx)
+{
+  if (idx >= PROFILE_NUM)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_StatusTypeDef st = sdram_setup(&s_profiles[idx]);
+  if (st == HAL_OK)
+  {
+    s_profile = idx;
+  }
+  return st;
+}
+
 SDRAM_HandleTypeDef *dri_sdram_handle(void)
 {
   return &hsdram;
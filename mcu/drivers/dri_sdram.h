@@ -2,6 +2,8 @@
 
 #include "stm32f4xx_hal.h"
 
+#include <stdbool.h>
+
 /*
  * 外部 SDRAM 初始化（FMC SDRAM）
  *
@@ -18,8 +20,52 @@ extern "C"
 {
 #endif
 
+/*
+ * FMC 时序/突发配置档
+ *
+ * - 时序单位为 SDCLK 周期；SDCLK = HCLK / sdclk_div（180MHz 下 2 -> 90MHz，3 -> 60MHz）
+ * - read_burst：FMC 读 FIFO 预取（RBURST），连续读时把后续列一并取回
+ * - 芯片模式寄存器的突发长度固定为 1：FMC 自己把 AHB 突发拆成连续列命令，
+ *   模式寄存器只随 cas 变化（写突发位对 BL=1 无影响）
+ * - in_spec：按 W9825G6KH-6 数据手册（tRC 60ns、tRCD/tRP 15ns、tRAS 42ns、
+ *   tXSR 72ns、CL2 <= 133MHz）核对过的档；其余为压缩余量的试验档，
+ *   只有在 ser_sdram_bench 的读写校验全部通过后才可采用
+ */
+typedef struct
+{
+  const char *name;
+  uint8_t sdclk_div;
+  uint8_t cas;
+  uint8_t rpipe; /* 读数据采样延迟（HCLK 周期，0..2） */
+  bool read_burst;
+  bool in_spec;
+  uint8_t t_mrd; /* LoadToActiveDelay */
+  uint8_t t_xsr; /* ExitSelfRefreshDelay */
+  uint8_t t_ras; /* SelfRefreshTime */
+  uint8_t t_rc;  /* RowCycleDelay */
+  uint8_t t_wr;  /* WriteRecoveryTime */
+  uint8_t t_rp;  /* RPDelay */
+  uint8_t t_rcd; /* RCDDelay */
+} dri_sdram_profile_t;
+
+/* dri_sdram_init 使用的配置档（与原先硬编码的参数一致） */
+#ifndef DRI_SDRAM_PROFILE_DEFAULT
+#define DRI_SDRAM_PROFILE_DEFAULT 0u
+#endif
+
 HAL_StatusTypeDef dri_sdram_init(void);
 
+uint32_t dri_sdram_profile_count(void);
+const dri_sdram_profile_t *dri_sdram_profile(uint32_t idx);
+uint32_t dri_sdram_profile_active(void);
+
+/*
+ * 切换配置档：重写 FMC 控制/时序寄存器并重发预充电 + 刷新 + 模式寄存器
+ * - SDRAM 内容在切换过程中保持（刷新不中断超过几微秒）
+ * - 调用方须保证切换期间没有其它主机（LTDC/DMA2D）访问 SDRAM
+ */
+HAL_StatusTypeDef dri_sdram_apply_profile(uint32_t idx);
+
 /* 返回内部保存的 SDRAM handle，便于调试/扩展 */
 SDRAM_HandleTypeDef *dri_sdram_handle(void);
 
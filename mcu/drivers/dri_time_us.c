@@ -1,10 +1,136 @@
 #include "dri_time_us.h"
 
+#include <stdbool.h>
+#include <stddef.h>
+
+#if !defined(DRI_TIME_HOST) || !DRI_TIME_HOST
 #include "core_cm4.h"
+#endif
+
+/* x * num / den = x * i + x * f / 2^64（f 为 0.64 定点小数，向上取整） */
+typedef struct
+{
+  uint32_t i;
+  uint64_t f;
+} time_scale_t;
+
+static bool s_inited = false;
+static uint32_t s_hz = 0;
+
+static time_scale_t s_to_ms;
+static time_scale_t s_to_us;
+static time_scale_t s_to_ns;
+static time_scale_t s_us_to_cycles;
+
+/* 64 位扩展：上次观测到的低 32 位与当前高 32 位 */
+static uint32_t s_last_lo = 0;
+static uint32_t s_hi = 0;
+
+#if defined(DRI_TIME_HOST) && DRI_TIME_HOST
+static dri_time_port_t s_port;
+
+uint32_t dri_time_cycles_now(void)
+{
+  return s_port.read();
+}
+
+static uint32_t time_lock(void)
+{
+  return (s_port.lock != NULL) ? s_port.lock() : 0u;
+}
+
+static void time_unlock(uint32_t key)
+{
+  if (s_port.unlock != NULL)
+  {
+    s_port.unlock(key);
+  }
+}
+#else
+static uint32_t time_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static void time_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+#endif
+
+static void scale_init(time_scale_t *s, uint32_t num, uint32_t den)
+{
+  uint64_t r = num % den;
+  uint64_t f_hi = (r << 32) / den;
+  uint64_t r1 = (r << 32) % den;
+  uint64_t f_lo = (r1 << 32) / den;
+  uint64_t r2 = (r1 << 32) % den;
+
+  s->i = num / den;
+  s->f = (f_hi << 32) | f_lo;
+  if (r2 != 0u)
+  {
+    s->f++; /* r < den，f 不会溢出 */
+  }
+}
+
+/* (x * f) >> 64，x 为 32 位：两次 UMULL */
+static inline uint64_t mulhi_32x64(uint32_t x, uint64_t f)
+{
+  uint64_t lo = (uint64_t)x * (uint32_t)f;
+  uint64_t hi = (uint64_t)x * (uint32_t)(f >> 32);
+  return (hi + (lo >> 32)) >> 32;
+}
+
+/* (x * f) >> 64，x 为 64 位：四次 UMULL */
+static inline uint64_t mulhi_64x64(uint64_t x, uint64_t f)
+{
+  uint64_t x_lo = (uint32_t)x;
+  uint64_t x_hi = x >> 32;
+  uint64_t f_lo = (uint32_t)f;
+  uint64_t f_hi = f >> 32;
 
-static uint8_t s_inited = 0;
-static uint32_t s_cycles_per_us = 0;
+  uint64_t ll = x_lo * f_lo;
+  uint64_t lh = x_lo * f_hi;
+  uint64_t hl = x_hi * f_lo;
+  uint64_t hh = x_hi * f_hi;
+
+  uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+  return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+static inline uint64_t scale32(const time_scale_t *s, uint32_t x)
+{
+  return (uint64_t)x * s->i + mulhi_32x64(x, s->f);
+}
+
+static inline uint64_t scale64(const time_scale_t *s, uint64_t x)
+{
+  return x * s->i + mulhi_64x64(x, s->f);
+}
+
+static void time_setup(uint32_t hz)
+{
+  s_hz = hz;
+  scale_init(&s_to_ms, 1000u, hz);
+  scale_init(&s_to_us, 1000000u, hz);
+  scale_init(&s_to_ns, 1000000000u, hz);
+  scale_init(&s_us_to_cycles, hz, 1000000u);
+  s_last_lo = 0u;
+  s_hi = 0u;
+}
 
+#if defined(DRI_TIME_HOST) && DRI_TIME_HOST
+void dri_time_host_init(const dri_time_port_t *port)
+{
+  s_port = *port;
+  time_setup(port->hz);
+  s_last_lo = s_port.read();
+  s_inited = true;
+}
+#else
 HAL_StatusTypeDef dri_time_us_init(void)
 {
   if (s_inited)
@@ -12,48 +138,101 @@ HAL_StatusTypeDef dri_time_us_init(void)
     return HAL_OK;
   }
 
-  if (SystemCoreClock == 0u)
+  if (SystemCoreClock < 1000000u)
   {
     return HAL_ERROR;
   }
 
-  s_cycles_per_us = SystemCoreClock / 1000000u;
-  if (s_cycles_per_us == 0u)
-  {
-    return HAL_ERROR;
-  }
+  time_setup(SystemCoreClock);
 
   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
   DWT->CYCCNT = 0u;
   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
-  s_inited = 1u;
+  s_inited = true;
   return HAL_OK;
 }
 
-uint32_t dri_time_cycles_now(void)
+void dri_time_tick_isr(void)
 {
-  (void)dri_time_us_init();
-  return DWT->CYCCNT;
+  if (s_inited)
+  {
+    (void)dri_time_cycles64();
+  }
 }
+#endif
 
-uint32_t dri_time_cycles_elapsed_us(uint32_t start_cycles)
+uint32_t dri_time_hz(void)
 {
-  (void)dri_time_us_init();
+  return s_hz;
+}
 
-  uint32_t now = DWT->CYCCNT;
-  uint32_t diff = now - start_cycles; /* unsigned wrap OK */
-  return diff / s_cycles_per_us;
+uint64_t dri_time_cycles64(void)
+{
+  uint32_t key = time_lock();
+  uint32_t lo = dri_time_cycles_now();
+  if (lo < s_last_lo)
+  {
+    s_hi++;
+  }
+  s_last_lo = lo;
+  uint32_t hi = s_hi;
+  time_unlock(key);
+
+  return ((uint64_t)hi << 32) | lo;
 }
 
-void dri_time_delay_us(uint32_t us)
+uint64_t dri_time_now_us64(void)
 {
-  (void)dri_time_us_init();
+  return scale64(&s_to_us, dri_time_cycles64());
+}
+
+uint64_t dri_time_now_ns64(void)
+{
+  return scale64(&s_to_ns, dri_time_cycles64());
+}
+
+uint32_t dri_time_now_ms(void)
+{
+  return (uint32_t)scale64(&s_to_ms, dri_time_cycles64());
+}
 
-  uint32_t start = DWT->CYCCNT;
-  uint32_t wait_cycles = us * s_cycles_per_us;
-  while ((uint32_t)(DWT->CYCCNT - start) < wait_cycles)
+uint32_t dri_time_cycles_to_us(uint32_t cycles)
+{
+  return (uint32_t)scale32(&s_to_us, cycles);
+}
+
+uint64_t dri_time_cycles_to_ns(uint32_t cycles)
+{
+  return scale32(&s_to_ns, cycles);
+}
+
+uint64_t dri_time_cycles64_to_us(uint64_t cycles)
+{
+  return scale64(&s_to_us, cycles);
+}
+
+uint64_t dri_time_cycles64_to_ns(uint64_t cycles)
+{
+  return scale64(&s_to_ns, cycles);
+}
+
+uint32_t dri_time_us_to_cycles(uint32_t us)
+{
+  return (uint32_t)scale32(&s_us_to_cycles, us);
+}
+
+uint32_t dri_time_cycles_elapsed_us(uint32_t start_cycles)
+{
+  uint32_t diff = dri_time_cycles_now() - start_cycles; /* unsigned wrap OK */
+  return dri_time_cycles_to_us(diff);
+}
+
+void dri_time_delay_us(uint32_t us)
+{
+  uint32_t start = dri_time_cycles_now();
+  uint32_t wait_cycles = dri_time_us_to_cycles(us);
+  while ((uint32_t)(dri_time_cycles_now() - start) < wait_cycles)
   {
   }
 }
-
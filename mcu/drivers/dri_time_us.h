@@ -1,28 +1,92 @@
 #pragma once
 
+#include <stdint.h>
+
+#if !defined(DRI_TIME_HOST) || !DRI_TIME_HOST
 #include "stm32f4xx_hal.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /*
- * drivers/ 层：微秒级时间基准（DWT CYCCNT）
+ * drivers/ 层：系统时间基准（DWT CYCCNT 扩展为 64 位单调时钟）
  *
  * 用途：
- * - 生成 10~50us 量级 TRIG 脉冲
- * - 采集 ECHO 脉宽（超声波测距）
+ * - 生成 10~50us 量级 TRIG 脉冲、采集 ECHO 脉宽（超声波测距）
+ * - 短时间差（32 位 cycle，热路径只读一次 CYCCNT）：ser_prof / ser_bus / ser_boot 等
+ * - 全局单调时钟（64 位）：LVGL tick（lv_tick_set_cb）及其日志时间戳、协议 uptime
+ *
+ * 64 位扩展：
+ * - 记录上次读到的低 32 位，读数变小即高 32 位加一；读-比较-更新在 PRIMASK 临界区内
+ *   完成（十几个周期），任务与任意优先级中断都可调用
+ * - 前提是每个 CYCCNT 周期（180MHz 下约 23.8s）至少被观测一次：
+ *   SysTick_Handler 每 1ms 调 dri_time_tick_isr 保证这一点
+ *
+ * 换算：
+ * - 初始化时按 SystemCoreClock 预计算 cycles -> ms/us/ns 的倒数（整数部分 + 0.64 定点小数，
+ *   小数向上取整），换算只用乘法和移位，不做除法
+ * - 结果为向下取整；约 9.5 分钟（2^64/hz 个 cycle）以内的输入是精确值，
+ *   更长时最多多 1 个单位，不累积漂移
+ *
+ * 可移植性：
+ * - 主机构建（DRI_TIME_HOST=1）不依赖 HAL：计数器、锁与频率经 dri_time_port_t 注入，
+ *   用于回绕与并发测试
  *
  * 注意：
- * - DWT CYCCNT 是 32-bit，会溢出；本驱动只保证“短时间差”的正确性
+ * - dri_time_us_init 由 main 在时钟配置后调用一次，其余接口不再惰性初始化
+ * - 32 位接口只保证“短时间差”（< 一个 CYCCNT 周期）的正确性
  */
 
+#if defined(DRI_TIME_HOST) && DRI_TIME_HOST
+typedef struct
+{
+  uint32_t (*read)(void);       /* 32 位自由运行计数器 */
+  uint32_t (*lock)(void);       /* 返回 key，可为 NULL（单线程） */
+  void (*unlock)(uint32_t key);
+  uint32_t hz;
+} dri_time_port_t;
+
+/* 换算表按 port->hz 重新计算，64 位扩展状态清零 */
+void dri_time_host_init(const dri_time_port_t *port);
+
+uint32_t dri_time_cycles_now(void);
+#else
 HAL_StatusTypeDef dri_time_us_init(void);
 
 /* 返回当前 cycle counter（非 us），用于做短时间差计算 */
-uint32_t dri_time_cycles_now(void);
+static inline uint32_t dri_time_cycles_now(void)
+{
+  return DWT->CYCCNT;
+}
 
-/* 从 start_cycles 到现在经过的微秒数（适合 <~1s 的短时差） */
+/* SysTick_Handler 中调用：保证 64 位扩展每个 CYCCNT 周期至少更新一次 */
+void dri_time_tick_isr(void);
+#endif
+
+/* cycle 频率（Hz） */
+uint32_t dri_time_hz(void);
+
+/* 64 位单调 cycle 计数（任务/中断均可调用） */
+uint64_t dri_time_cycles64(void);
+
+/* 单调时钟（自 dri_time_us_init 起） */
+uint64_t dri_time_now_us64(void);
+uint64_t dri_time_now_ns64(void);
+/* 32 位毫秒（约 49.7 天回绕），签名与 lv_tick_get_cb_t 一致 */
+uint32_t dri_time_now_ms(void);
+
+/* cycle 数换算（向下取整） */
+uint32_t dri_time_cycles_to_us(uint32_t cycles);
+uint64_t dri_time_cycles_to_ns(uint32_t cycles);
+uint64_t dri_time_cycles64_to_us(uint64_t cycles);
+uint64_t dri_time_cycles64_to_ns(uint64_t cycles);
+
+/* 微秒 -> cycle 数（用于轮询超时：先换算一次，循环里只比较 cycle 差） */
+uint32_t dri_time_us_to_cycles(uint32_t us);
+
+/* 从 start_cycles 到现在经过的微秒数（适合 < 一个 CYCCNT 周期的短时差） */
 uint32_t dri_time_cycles_elapsed_us(uint32_t start_cycles);
 
 /* 忙等延时（微秒） */
@@ -31,4 +95,3 @@ void dri_time_delay_us(uint32_t us);
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
-
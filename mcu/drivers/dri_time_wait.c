@@ -0,0 +1,304 @@
+#include "dri_time_wait.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "dri_time_us.h"
+
+#if !defined(DRI_TIME_WAIT_HOST) || !DRI_TIME_WAIT_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "stm32f4xx_hal.h"
+#endif
+
+/* 单次睡眠上限：更长的等待分段睡眠（比较值与通知超时都在 32 位内） */
+#define WAIT_MAX_SLEEP_US 1000000u
+
+static const dri_time_wait_port_t *s_port = NULL;
+static uint32_t s_spin_cycles = 0;
+
+/* 统计不加锁，仅供观测 */
+static dri_time_wait_stats_t s_stats;
+
+#if !defined(DRI_TIME_WAIT_HOST) || !DRI_TIME_WAIT_HOST
+/* TIM5：32 位自由运行，1MHz；CC1..CC4 各服务一个睡眠中的任务 */
+#define WAIT_CHANNELS 4u
+
+static TIM_HandleTypeDef s_htim5;
+static bool s_tim_ok = false;
+static TaskHandle_t s_ch_task[WAIT_CHANNELS];
+
+static const uint32_t s_ch_it[WAIT_CHANNELS] = {TIM_IT_CC1, TIM_IT_CC2,
+                                                TIM_IT_CC3, TIM_IT_CC4};
+static const uint32_t s_ch_flag[WAIT_CHANNELS] = {TIM_FLAG_CC1, TIM_FLAG_CC2,
+                                                  TIM_FLAG_CC3, TIM_FLAG_CC4};
+
+static volatile uint32_t *ch_ccr(uint32_t ch)
+{
+  return &(&s_htim5.Instance->CCR1)[ch];
+}
+
+static uint32_t wait_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static void wait_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+
+static void notify(TaskHandle_t task)
+{
+  if (__get_IPSR() != 0u)
+  {
+    BaseType_t woken = pdFALSE;
+    (void)xTaskNotifyFromISR(task, DRI_TIME_WAIT_NOTIFY_BIT, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+  else
+  {
+    (void)xTaskNotify(task, DRI_TIME_WAIT_NOTIFY_BIT, eSetBits);
+  }
+}
+
+/* 占一个空闲比较通道并在 now + us 处触发；没有空闲通道返回 -1 */
+static int32_t arm_channel(TaskHandle_t task, uint32_t us)
+{
+  if (!s_tim_ok)
+  {
+    return -1;
+  }
+
+  uint32_t key = wait_lock();
+  for (uint32_t ch = 0; ch < WAIT_CHANNELS; ch++)
+  {
+    if (s_ch_task[ch] == NULL)
+    {
+      s_ch_task[ch] = task;
+      /* us >= 自旋余量，比较值一定在计数器前方 */
+      *ch_ccr(ch) = __HAL_TIM_GET_COUNTER(&s_htim5) + us;
+      __HAL_TIM_CLEAR_FLAG(&s_htim5, s_ch_flag[ch]);
+      __HAL_TIM_ENABLE_IT(&s_htim5, s_ch_it[ch]);
+      wait_unlock(key);
+      return (int32_t)ch;
+    }
+  }
+  wait_unlock(key);
+  return -1;
+}
+
+static void disarm_channel(uint32_t ch)
+{
+  uint32_t key = wait_lock();
+  __HAL_TIM_DISABLE_IT(&s_htim5, s_ch_it[ch]);
+  s_ch_task[ch] = NULL;
+  wait_unlock(key);
+}
+
+void dri_time_wait_irq_handler(void)
+{
+  for (uint32_t ch = 0; ch < WAIT_CHANNELS; ch++)
+  {
+    if (__HAL_TIM_GET_FLAG(&s_htim5, s_ch_flag[ch]) &&
+        __HAL_TIM_GET_IT_SOURCE(&s_htim5, s_ch_it[ch]))
+    {
+      __HAL_TIM_CLEAR_FLAG(&s_htim5, s_ch_flag[ch]);
+      __HAL_TIM_DISABLE_IT(&s_htim5, s_ch_it[ch]);
+      if (s_ch_task[ch] != NULL)
+      {
+        notify(s_ch_task[ch]);
+      }
+    }
+  }
+}
+
+static void *board_self(void)
+{
+  if (__get_IPSR() != 0u ||
+      xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+  {
+    return NULL;
+  }
+  return (void *)xTaskGetCurrentTaskHandle();
+}
+
+static bool board_sleep_until(void *task, uint64_t wake_at)
+{
+  uint64_t now = dri_time_cycles64();
+  if (wake_at <= now)
+  {
+    return true;
+  }
+
+  uint64_t left64 = dri_time_cycles64_to_us(wake_at - now);
+  uint32_t left_us =
+      (left64 > WAIT_MAX_SLEEP_US) ? WAIT_MAX_SLEEP_US : (uint32_t)left64;
+
+  int32_t ch = arm_channel((TaskHandle_t)task, left_us);
+  if (ch >= 0)
+  {
+    /* 比较中断丢失时的保底超时 */
+    TickType_t ticks = pdMS_TO_TICKS(left_us / 1000u) + 2u;
+    (void)xTaskNotifyWait(0u, DRI_TIME_WAIT_NOTIFY_BIT, NULL, ticks);
+    disarm_channel((uint32_t)ch);
+    return true;
+  }
+
+  /* 没有空闲通道：只睡整 tick（超时可能比设定早不到 1 tick，由调用方重新计算） */
+  TickType_t ticks = (TickType_t)(left_us / (1000000u / configTICK_RATE_HZ));
+  if (ticks == 0u)
+  {
+    return false;
+  }
+  (void)xTaskNotifyWait(0u, DRI_TIME_WAIT_NOTIFY_BIT, NULL, ticks);
+  return true;
+}
+
+static void board_wake(void *task)
+{
+  notify((TaskHandle_t)task);
+}
+
+static const dri_time_wait_port_t s_board_port = {
+    .self = board_self,
+    .sleep_until = board_sleep_until,
+    .wake = board_wake,
+};
+
+static bool tim5_init(void)
+{
+  /* APB1 分频不为 1 时定时器时钟为 PCLK1 的 2 倍（本工程 45MHz -> 90MHz） */
+  uint32_t clk = HAL_RCC_GetPCLK1Freq();
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1)
+  {
+    clk *= 2u;
+  }
+
+  s_htim5.Instance = TIM5;
+  s_htim5.Init.Prescaler = clk / 1000000u - 1u;
+  s_htim5.Init.CounterMode = TIM_COUNTERMODE_UP;
+  s_htim5.Init.Period = 0xFFFFFFFFu;
+  s_htim5.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  s_htim5.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&s_htim5) != HAL_OK)
+  {
+    return false;
+  }
+
+  /* 通道保持复位值（冻结输出比较）：只用匹配标志产生中断 */
+  return HAL_TIM_Base_Start(&s_htim5) == HAL_OK;
+}
+#endif
+
+bool dri_time_wait_init(const dri_time_wait_port_t *port)
+{
+#if !defined(DRI_TIME_WAIT_HOST) || !DRI_TIME_WAIT_HOST
+  if (port == NULL)
+  {
+    /* 定时器失败时仍可用：退化为 tick 睡眠 + 自旋 */
+    s_tim_ok = tim5_init();
+    port = &s_board_port;
+  }
+#endif
+  if (port == NULL || dri_time_hz() == 0u)
+  {
+    return false;
+  }
+
+  s_port = port;
+  s_spin_cycles = dri_time_us_to_cycles(DRI_TIME_WAIT_SPIN_US);
+  memset(&s_stats, 0, sizeof(s_stats));
+  return true;
+}
+
+bool dri_time_wait_until(dri_time_waiter_t *w, uint64_t deadline,
+                         dri_time_wait_cond_t cond, void *arg)
+{
+  uint64_t start = dri_time_cycles64();
+  void *task = (s_port != NULL) ? s_port->self() : NULL;
+
+  /* 先登记再查条件：查完之后才发生的变化一定能唤醒睡眠 */
+  if (w != NULL)
+  {
+    w->task = task;
+  }
+
+  bool ok;
+  uint64_t now;
+  for (;;)
+  {
+    if (cond != NULL && cond(arg))
+    {
+      ok = true;
+      s_stats.cond_hits++;
+      now = dri_time_cycles64();
+      break;
+    }
+
+    now = dri_time_cycles64();
+    if (now >= deadline)
+    {
+      ok = (cond == NULL);
+      uint64_t late = now - deadline;
+      if (late > s_stats.late_max_cycles)
+      {
+        s_stats.late_max_cycles = (late > 0xFFFFFFFFu) ? 0xFFFFFFFFu
+                                                       : (uint32_t)late;
+      }
+      break;
+    }
+
+    if (task != NULL && deadline - now > s_spin_cycles)
+    {
+      if (s_port->sleep_until(task, deadline - s_spin_cycles))
+      {
+        s_stats.sleeps++;
+        s_stats.sleep_cycles += dri_time_cycles64() - now;
+        continue;
+      }
+      /* 睡不了（不足 1 tick 且无通道）：余下全部自旋 */
+      task = NULL;
+    }
+  }
+
+  if (w != NULL)
+  {
+    w->task = NULL;
+  }
+  s_stats.waits++;
+  s_stats.wait_cycles += now - start;
+  return ok;
+}
+
+bool dri_time_wait_us(dri_time_waiter_t *w, uint32_t us,
+                      dri_time_wait_cond_t cond, void *arg)
+{
+  uint64_t deadline = dri_time_cycles64() + dri_time_us_to_cycles(us);
+  return dri_time_wait_until(w, deadline, cond, arg);
+}
+
+void dri_time_wait_wake(dri_time_waiter_t *w)
+{
+  void *task = (w != NULL) ? w->task : NULL;
+  if (task != NULL && s_port != NULL)
+  {
+    s_port->wake(task);
+  }
+}
+
+void dri_time_wait_get_stats(dri_time_wait_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void dri_time_wait_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * drivers/ 层：截止时间等待（先睡眠、后自旋）
+ *
+ * 背景：
+ * - dri_time_delay_us 与超声波的 wait_* 轮询全程占住 CPU，等回波时一次就是几十毫秒
+ *
+ * 做法：
+ * - 截止时间用 64 位 cycle（dri_time_cycles64）表示
+ * - 距截止时间还多于 DRI_TIME_WAIT_SPIN_US 时，调用任务阻塞到“截止时间 - 自旋余量”：
+ *   - 首选 TIM5（32 位，1MHz）比较通道：比较中断以任务通知唤醒，唤醒精度微秒级；
+ *     4 个通道即最多 4 个任务同时睡眠
+ *   - 通道用完时退化为 RTOS tick 超时（只睡整 tick，不足 1 tick 的部分自旋）
+ * - 余下的几微秒自旋读 CYCCNT，保证返回时刻的精度
+ * - 可带一个完成条件：每次醒来及自旋时检查，成立即提前返回；
+ *   改变条件的中断调用 dri_time_wait_wake 唤醒等待者，不必等到截止时间
+ * - 中断里或调度器启动前调用时不睡眠，直接自旋（行为与原忙等一致）
+ *
+ * 可移植性：
+ * - 睡眠/唤醒经 dri_time_wait_port_t 注入，时钟用 dri_time_us；主机构建
+ *   （DRI_TIME_WAIT_HOST=1，配合 DRI_TIME_HOST=1 注入的虚拟计数器）模拟唤醒延迟，
+ *   测量返回抖动与省下的 CPU 时间
+ *
+ * 睡眠占用调用任务通知值的 DRI_TIME_WAIT_NOTIFY_BIT 位（eSetBits），
+ * 与 ulTaskNotifyTake 计数语义及其它位互不影响
+ */
+
+/* 自旋余量：需覆盖比较中断 + 任务切换的唤醒延迟 */
+#ifndef DRI_TIME_WAIT_SPIN_US
+#define DRI_TIME_WAIT_SPIN_US 20u
+#endif
+
+#define DRI_TIME_WAIT_NOTIFY_BIT (1ul << 30)
+
+/* 完成条件：等待者上下文中调用，应无副作用 */
+typedef bool (*dri_time_wait_cond_t)(void *arg);
+
+/* 可被中断提前唤醒的等待者（调用方持有，通常为静态变量） */
+typedef struct
+{
+  void *volatile task; /* 正在睡眠的任务，没有时为 NULL */
+} dri_time_waiter_t;
+
+typedef struct
+{
+  /* 当前可阻塞的任务句柄；中断里或调度器未运行返回 NULL */
+  void *(*self)(void);
+  /* 阻塞到 wake_at（可被 wake 提前唤醒）；无法睡眠（余量不足 1 tick 且无比较通道）返回 false */
+  bool (*sleep_until)(void *task, uint64_t wake_at);
+  void (*wake)(void *task); /* 任务或中断上下文 */
+} dri_time_wait_port_t;
+
+typedef struct
+{
+  uint32_t waits;
+  uint32_t sleeps;          /* sleep_until 次数 */
+  uint32_t cond_hits;       /* 条件成立提前返回 */
+  uint32_t late_max_cycles; /* 超时返回时超过截止时间的最大值 */
+  uint64_t wait_cycles;     /* 全部等待时长 */
+  uint64_t sleep_cycles;    /* 其中阻塞（让出 CPU）的时长 */
+} dri_time_wait_stats_t;
+
+/* port 为 NULL 时使用 MCU 实现（TIM5 + FreeRTOS 任务通知），需在 dri_time_us_init 之后调用 */
+bool dri_time_wait_init(const dri_time_wait_port_t *port);
+
+/*
+ * 等到 deadline（dri_time_cycles64 的时刻）
+ * - cond 为 NULL：到达截止时间返回 true
+ * - cond 非 NULL：条件成立返回 true，超时返回 false
+ * - w 非 NULL 时，等待期间其它上下文可用 dri_time_wait_wake(w) 让它立即重查条件
+ */
+bool dri_time_wait_until(dri_time_waiter_t *w, uint64_t deadline,
+                         dri_time_wait_cond_t cond, void *arg);
+
+/* 同上，截止时间为现在起 us 微秒（不超过一个 CYCCNT 周期） */
+bool dri_time_wait_us(dri_time_waiter_t *w, uint32_t us,
+                      dri_time_wait_cond_t cond, void *arg);
+
+/* 唤醒正在睡眠的等待者（任务或中断上下文；没有等待者时为空操作） */
+void dri_time_wait_wake(dri_time_waiter_t *w);
+
+void dri_time_wait_get_stats(dri_time_wait_stats_t *stats);
+void dri_time_wait_reset_stats(void);
+
+#if !defined(DRI_TIME_WAIT_HOST) || !DRI_TIME_WAIT_HOST
+/* TIM5_IRQHandler 中调用 */
+void dri_time_wait_irq_handler(void);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -1,7 +1,7 @@
 #include "dri_touch_gt9xx.h"
 
 #include "boa_touch.h"
-#include "dri_i2c2.h"
+#include "dri_i2c_bus.h"
 
 /**
  * @file dri_touch_gt9xx.c
@@ -9,8 +9,45 @@
  * @author ssw12
  */
 
+/* 触摸读在 LVGL 任务里同步等待，排在同总线其它器件之前 */
+#define GT9XX_I2C_PRIO 8u
+
 static uint16_t s_addr_7bit = DRI_TOUCH_GT9XX_ADDR_7BIT_5D;
 static bool s_inited = false;
+static dri_i2c_bus_t *s_bus = NULL;
+
+static HAL_StatusTypeDef to_hal(dri_i2c_result_t res)
+{
+  if (res == DRI_I2C_OK)
+  {
+    return HAL_OK;
+  }
+  return (res == DRI_I2C_TIMEOUT) ? HAL_TIMEOUT : HAL_ERROR;
+}
+
+static HAL_StatusTypeDef gt9xx_probe(uint16_t addr, uint32_t trials,
+                                     uint32_t timeout_ms)
+{
+  return to_hal(dri_i2c_bus_probe(s_bus, addr, trials, timeout_ms * 1000u));
+}
+
+static HAL_StatusTypeDef gt9xx_xfer(uint8_t op, uint16_t reg, uint8_t *rbuf,
+                                    const uint8_t *wbuf, uint16_t len,
+                                    uint32_t timeout_ms)
+{
+  dri_i2c_req_t req = {0};
+  req.op = op;
+  req.prio = GT9XX_I2C_PRIO;
+  req.addr = s_addr_7bit;
+  req.mem_addr = reg;
+  req.mem_addr_size = 2u;
+  req.rbuf = rbuf;
+  req.rlen = (rbuf != NULL) ? len : 0u;
+  req.wbuf = wbuf;
+  req.wlen = (wbuf != NULL) ? len : 0u;
+  req.timeout_us = timeout_ms * 1000u;
+  return to_hal(dri_i2c_bus_xfer(s_bus, &req));
+}
 
 uint16_t dri_touch_gt9xx_addr_7bit(void) { return s_addr_7bit; }
 
@@ -21,12 +58,12 @@ static bool dri_touch_gt9xx_probe_addr(void)
    * - Goodix 常见 7-bit 地址：0x5D / 0x14
    * - 地址通常由上电复位阶段 INT 的电平选择（不同模组可能相反）
    */
-  if (dri_i2c2_is_device_ready(DRI_TOUCH_GT9XX_ADDR_7BIT_5D, 2, 20) == HAL_OK)
+  if (gt9xx_probe(DRI_TOUCH_GT9XX_ADDR_7BIT_5D, 2, 20) == HAL_OK)
   {
     s_addr_7bit = DRI_TOUCH_GT9XX_ADDR_7BIT_5D;
     return true;
   }
-  if (dri_i2c2_is_device_ready(DRI_TOUCH_GT9XX_ADDR_7BIT_14, 2, 20) == HAL_OK)
+  if (gt9xx_probe(DRI_TOUCH_GT9XX_ADDR_7BIT_14, 2, 20) == HAL_OK)
   {
     s_addr_7bit = DRI_TOUCH_GT9XX_ADDR_7BIT_14;
     return true;
@@ -45,13 +82,16 @@ static void dri_touch_gt9xx_reset_and_probe(bool int_high)
 
 void dri_touch_gt9xx_init(void)
 {
-  (void)dri_i2c2_init();
+  if (s_bus == NULL)
+  {
+    s_bus = dri_i2c_bus_get(DRI_I2C_2);
+  }
 
   /*
    * 已初始化时做一次轻量级检查：
    * - 若当前地址不应答，则进行一次复位并复探测
    */
-  if (s_inited && dri_i2c2_is_device_ready(s_addr_7bit, 1, 5) == HAL_OK)
+  if (s_inited && gt9xx_probe(s_addr_7bit, 1, 5) == HAL_OK)
   {
     return;
   }
@@ -62,7 +102,7 @@ void dri_touch_gt9xx_init(void)
    * - 若未探测到 ACK，再按 “INT=1” 方案复位再试一次
    */
   dri_touch_gt9xx_reset_and_probe(false);
-  if (dri_i2c2_is_device_ready(s_addr_7bit, 1, 5) != HAL_OK)
+  if (gt9xx_probe(s_addr_7bit, 1, 5) != HAL_OK)
   {
     dri_touch_gt9xx_reset_and_probe(true);
   }
@@ -74,16 +114,14 @@ HAL_StatusTypeDef dri_touch_gt9xx_mem_read(uint16_t reg, uint8_t *buf,
                                            uint16_t len, uint32_t timeout_ms)
 {
   dri_touch_gt9xx_init();
-  return dri_i2c2_mem_read(s_addr_7bit, reg, I2C_MEMADD_SIZE_16BIT, buf, len,
-                           timeout_ms);
+  return gt9xx_xfer(DRI_I2C_OP_MEM_READ, reg, buf, NULL, len, timeout_ms);
 }
 
 HAL_StatusTypeDef dri_touch_gt9xx_mem_write(uint16_t reg, const uint8_t *buf,
                                             uint16_t len, uint32_t timeout_ms)
 {
   dri_touch_gt9xx_init();
-  return dri_i2c2_mem_write(s_addr_7bit, reg, I2C_MEMADD_SIZE_16BIT, buf, len,
-                            timeout_ms);
+  return gt9xx_xfer(DRI_I2C_OP_MEM_WRITE, reg, NULL, buf, len, timeout_ms);
 }
 
 HAL_StatusTypeDef dri_touch_gt9xx_write_u8(uint16_t reg, uint8_t v,
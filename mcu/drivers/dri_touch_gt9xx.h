@@ -11,7 +11,7 @@
  * 分层说明：
  * - drivers/：负责“把片上外设能力 + 板级装配”组合成可被 devices/ 使用的能力
  * - 本模块依赖：
- *   - `dri_i2c2`（I2C2 片上外设驱动）
+ *   - `dri_i2c_bus`（I2C2 总线管理，与同总线其它器件排队共享）
  *   - `boa_touch`（RST/INT 引脚与复位时序）
  *
  * devices/（如 dev_gt9xx）通过本模块完成：
@@ -31,7 +31,7 @@ extern "C"
 #define DRI_TOUCH_GT9XX_ADDR_7BIT_5D 0x5Du
 #define DRI_TOUCH_GT9XX_ADDR_7BIT_14 0x14u
 
-  /* 初始化 I2C2 + 触摸复位 + 地址探测（幂等） */
+  /* 初始化 I2C2 总线 + 触摸复位 + 地址探测（幂等） */
   void dri_touch_gt9xx_init(void);
 
   /* 返回当前探测到的 7-bit I2C 地址（默认 0x5D） */
@@ -0,0 +1,202 @@
+#include "dri_usart1.h"
+
+static UART_HandleTypeDef huart1;
+static DMA_HandleTypeDef hdma_usart1_tx;
+static DMA_HandleTypeDef hdma_usart1_rx;
+static bool s_inited = false;
+
+static uint8_t *s_rx_buf = NULL;
+static uint16_t s_rx_len = 0;
+static dri_usart1_rx_cb_t s_rx_cb = NULL;
+
+HAL_StatusTypeDef dri_usart1_init(uint32_t baud)
+{
+  if (s_inited)
+  {
+    return HAL_OK;
+  }
+
+  /* DMA2 Stream7 Channel4：USART1_TX（RM0090 DMA2 请求映射表） */
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  hdma_usart1_tx.Instance = DMA2_Stream7;
+  hdma_usart1_tx.Init.Channel = DMA_CHANNEL_4;
+  hdma_usart1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_usart1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart1_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.Mode = DMA_NORMAL;
+  hdma_usart1_tx.Init.Priority = DMA_PRIORITY_LOW;
+  hdma_usart1_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+  HAL_StatusTypeDef st = HAL_DMA_Init(&hdma_usart1_tx);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+  __HAL_LINKDMA(&huart1, hdmatx, hdma_usart1_tx);
+
+  /* 中断优先级不高于 configMAX_SYSCALL_INTERRUPT_PRIORITY(5)，回调里可用 FromISR API */
+  HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+
+  huart1.Instance = USART1;
+  huart1.Init.BaudRate = baud;
+  huart1.Init.WordLength = UART_WORDLENGTH_8B;
+  huart1.Init.StopBits = UART_STOPBITS_1;
+  huart1.Init.Parity = UART_PARITY_NONE;
+  huart1.Init.Mode = UART_MODE_TX_RX;
+  huart1.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  /* APB2=90MHz：16 倍过采样下 921600 的误差约 0.2% */
+  huart1.Init.OverSampling = UART_OVERSAMPLING_16;
+
+  st = HAL_UART_Init(&huart1);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+
+  s_inited = true;
+  return HAL_OK;
+}
+
+UART_HandleTypeDef *dri_usart1_handle(void)
+{
+  return &huart1;
+}
+
+HAL_StatusTypeDef dri_usart1_write(const uint8_t *data, uint16_t len,
+                                   uint32_t timeout_ms)
+{
+  if (!s_inited || data == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_UART_Transmit(&huart1, (uint8_t *)data, len, timeout_ms);
+}
+
+HAL_StatusTypeDef dri_usart1_write_dma(const uint8_t *data, uint16_t len)
+{
+  if (!s_inited || data == NULL || len == 0u)
+  {
+    return HAL_ERROR;
+  }
+
+  if (huart1.gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  return HAL_UART_Transmit_DMA(&huart1, (uint8_t *)data, len);
+}
+
+bool dri_usart1_tx_busy(void)
+{
+  return s_inited && (huart1.gState != HAL_UART_STATE_READY);
+}
+
+/* HAL 在 IDLE 之外还打开 DMA 半满/满中断：两次回调之间最多半个缓冲 */
+static HAL_StatusTypeDef rx_arm(void)
+{
+  return HAL_UARTEx_ReceiveToIdle_DMA(&huart1, s_rx_buf, s_rx_len);
+}
+
+HAL_StatusTypeDef dri_usart1_rx_start(uint8_t *buf, uint16_t len,
+                                      dri_usart1_rx_cb_t cb)
+{
+  if (!s_inited || buf == NULL || len < 2u)
+  {
+    return HAL_ERROR;
+  }
+  if (s_rx_buf != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* DMA2 Stream2 Channel4：USART1_RX，循环模式，由 IDLE/HT/TC 报告进度 */
+  hdma_usart1_rx.Instance = DMA2_Stream2;
+  hdma_usart1_rx.Init.Channel = DMA_CHANNEL_4;
+  hdma_usart1_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_usart1_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart1_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart1_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart1_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart1_rx.Init.Mode = DMA_CIRCULAR;
+  hdma_usart1_rx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_usart1_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+  HAL_StatusTypeDef st = HAL_DMA_Init(&hdma_usart1_rx);
+  if (st != HAL_OK)
+  {
+    return st;
+  }
+  __HAL_LINKDMA(&huart1, hdmarx, hdma_usart1_rx);
+
+  HAL_NVIC_SetPriority(DMA2_Stream2_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream2_IRQn);
+
+  s_rx_buf = buf;
+  s_rx_len = len;
+  s_rx_cb = cb;
+
+  st = rx_arm();
+  if (st != HAL_OK)
+  {
+    s_rx_buf = NULL;
+  }
+  return st;
+}
+
+uint16_t dri_usart1_rx_pos(void)
+{
+  if (s_rx_buf == NULL)
+  {
+    return 0u;
+  }
+
+  uint16_t pos = (uint16_t)(s_rx_len - __HAL_DMA_GET_COUNTER(&hdma_usart1_rx));
+  return (pos >= s_rx_len) ? 0u : pos;
+}
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  if (huart != &huart1 || s_rx_cb == NULL)
+  {
+    return;
+  }
+
+  /* 循环模式下 Size 是写位置；满中断报告 len，折回 0 */
+  s_rx_cb((Size >= s_rx_len) ? 0u : Size, false);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart != &huart1 || s_rx_buf == NULL)
+  {
+    return;
+  }
+
+  /* 溢出/噪声等会中止接收：重新启动，写位置回到 0 */
+  if (huart->RxState == HAL_UART_STATE_READY && rx_arm() == HAL_OK &&
+      s_rx_cb != NULL)
+  {
+    s_rx_cb(0u, true);
+  }
+}
+
+void dri_usart1_irq_handler(void)
+{
+  HAL_UART_IRQHandler(&huart1);
+}
+
+void dri_usart1_dma_tx_irq_handler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart1_tx);
+}
+
+void dri_usart1_dma_rx_irq_handler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart1_rx);
+}
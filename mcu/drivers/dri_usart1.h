@@ -0,0 +1,58 @@
+#pragma once
+
+#include "stm32f4xx_hal.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * drivers/ 层：USART1（片上外设）驱动
+ *
+ * 说明：
+ * - 只封装 USART1 + DMA2 Stream7(Channel4, TX) 能力
+ * - 引脚映射（PA9/PA10）与 USART1 中断由 board/ 层的 HAL_UART_MspInit 负责
+ *
+ * 发送：
+ * - dri_usart1_write：阻塞发送（轮询），任意上下文可用，适合少量调试输出
+ * - dri_usart1_write_dma：非阻塞 DMA 发送；上一次未完成时返回 HAL_BUSY
+ *   data 在发送完成前必须保持有效，且不能位于 CCMRAM（DMA 访问不到）
+ *
+ * 接收：
+ * - dri_usart1_rx_start：DMA2 Stream2(Channel4, RX) 循环模式写入调用方的环形缓冲，
+ *   半满/满/线路空闲（IDLE）时在中断里回调当前写位置 pos（0..len-1 之后回到 0）
+ * - 两次回调之间最多收到半个缓冲，调用方据此把 pos 换算成累计字节数
+ * - 出错（溢出/帧错误等）时 HAL 会停掉 DMA，这里自动重新启动，写位置从 0 开始
+ *   （回调 restarted = true）
+ */
+
+/*
+ * 接收回调：中断上下文；pos 为 DMA 下一个要写的位置
+ * restarted 为 true 时接收出错后已从 0 重新开始，之前的位置作废
+ */
+typedef void (*dri_usart1_rx_cb_t)(uint16_t pos, bool restarted);
+
+HAL_StatusTypeDef dri_usart1_init(uint32_t baud);
+UART_HandleTypeDef *dri_usart1_handle(void);
+
+HAL_StatusTypeDef dri_usart1_write(const uint8_t *data, uint16_t len,
+                                   uint32_t timeout_ms);
+HAL_StatusTypeDef dri_usart1_write_dma(const uint8_t *data, uint16_t len);
+bool dri_usart1_tx_busy(void);
+
+/* buf 在整个接收期间归 DMA 使用，不能位于 CCMRAM */
+HAL_StatusTypeDef dri_usart1_rx_start(uint8_t *buf, uint16_t len,
+                                      dri_usart1_rx_cb_t cb);
+/* 当前写位置（轮询用，任意上下文） */
+uint16_t dri_usart1_rx_pos(void);
+
+/* 由 stm32f4xx_it.c 中的 USART1_IRQHandler / DMA2_Stream7/2_IRQHandler 调用 */
+void dri_usart1_irq_handler(void);
+void dri_usart1_dma_tx_irq_handler(void);
+void dri_usart1_dma_rx_irq_handler(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
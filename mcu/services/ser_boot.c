@@ -0,0 +1,520 @@
+#include "ser_boot.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(SER_BOOT_HOST) || !SER_BOOT_HOST
+#include "FreeRTOS.h"
+#include "event_groups.h"
+#include "task.h"
+
+#include "dev_console.h"
+#include "dri_time_us.h"
+
+/*
+ * 完成位在 main()（调度器前）和多个任务里更新，临界区只有几条指令；
+ * 不用 taskENTER_CRITICAL：调度器启动前调用它会一直屏蔽 SysTick，HAL_Delay 卡死
+ */
+static inline uint32_t boot_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static inline void boot_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+#else
+static inline uint32_t boot_lock(void)
+{
+  return 0u;
+}
+
+static inline void boot_unlock(uint32_t key)
+{
+  (void)key;
+}
+#endif
+
+/* ser_boot_graph_next 的特殊返回值 */
+#define BOOT_BLOCKED (-1)
+#define BOOT_LANE_DONE (-2)
+
+static const char *const s_state_name[] = {
+    [SER_BOOT_PENDING] = "pending", [SER_BOOT_RUNNING] = "running",
+    [SER_BOOT_OK] = "ok",           [SER_BOOT_FAILED] = "fail",
+    [SER_BOOT_SKIPPED] = "skip",
+};
+
+int32_t ser_boot_graph_check(const ser_boot_step_t *steps, uint32_t n)
+{
+  if (steps == NULL || n == 0u || n > SER_BOOT_MAX_STEPS)
+  {
+    return 0;
+  }
+
+  const uint32_t all = (n == 32u) ? 0xFFFFFFFFu : (SER_BOOT_BIT(n) - 1u);
+  uint32_t main_mask = 0;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    if (steps[i].lane == SER_BOOT_LANE_MAIN)
+    {
+      main_mask |= SER_BOOT_BIT(i);
+    }
+  }
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    const ser_boot_step_t *s = &steps[i];
+    if (s->lane >= SER_BOOT_LANE_NUM || (s->deps & ~all) != 0u ||
+        (s->deps & SER_BOOT_BIT(i)) != 0u)
+    {
+      return (int32_t)i;
+    }
+    /* MAIN 在调度器启动前一次跑完，不能等其它通道 */
+    if (s->lane == SER_BOOT_LANE_MAIN && (s->deps & ~main_mask) != 0u)
+    {
+      return (int32_t)i;
+    }
+  }
+
+  /* 成环检查：反复解析依赖已全部解析的步骤，没有进展时剩下的都在环上 */
+  uint32_t resolved = 0;
+  for (;;)
+  {
+    uint32_t before = resolved;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      if ((resolved & SER_BOOT_BIT(i)) == 0u &&
+          (steps[i].deps & ~resolved) == 0u)
+      {
+        resolved |= SER_BOOT_BIT(i);
+      }
+    }
+    if (resolved == all)
+    {
+      return -1;
+    }
+    if (resolved == before)
+    {
+      break;
+    }
+  }
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    if ((resolved & SER_BOOT_BIT(i)) == 0u)
+    {
+      return (int32_t)i;
+    }
+  }
+  return -1;
+}
+
+bool ser_boot_graph_init(ser_boot_graph_t *g, const ser_boot_step_t *steps,
+                         uint32_t n, int32_t ttff_idx,
+                         const ser_boot_port_t *port, void *ctx)
+{
+  if (g == NULL || port == NULL || port->now == NULL ||
+      ser_boot_graph_check(steps, n) >= 0 ||
+      (ttff_idx >= 0 && (uint32_t)ttff_idx >= n))
+  {
+    return false;
+  }
+
+  memset(g, 0, sizeof(*g));
+  g->steps = steps;
+  g->n = n;
+  g->port = port;
+  g->ctx = ctx;
+  g->ttff_idx = ttff_idx;
+  g->t0 = port->now(ctx);
+  return true;
+}
+
+static void finish(ser_boot_graph_t *g, uint32_t idx, bool ok)
+{
+  uint32_t t = g->port->now(g->ctx);
+
+  uint32_t key = boot_lock();
+  g->t_end[idx] = t;
+  g->done |= SER_BOOT_BIT(idx);
+  if (!ok)
+  {
+    g->failed |= SER_BOOT_BIT(idx);
+  }
+  uint32_t done = g->done;
+  boot_unlock(key);
+
+  if (g->port->signal != NULL)
+  {
+    g->port->signal(g->ctx, done);
+  }
+}
+
+/*
+ * 领取本通道下一个就绪步骤：返回步骤编号，或 BOOT_BLOCKED（*blocked_on 为缺的依赖），
+ * 或 BOOT_LANE_DONE；依赖失败的步骤在这里直接标记 skip
+ */
+static int32_t graph_next(ser_boot_graph_t *g, uint8_t lane,
+                          uint32_t *blocked_on)
+{
+  for (;;)
+  {
+    bool pending = false;
+    int32_t skip = -1;
+    uint32_t missing = 0;
+
+    uint32_t key = boot_lock();
+    for (uint32_t i = 0; i < g->n; i++)
+    {
+      const ser_boot_step_t *s = &g->steps[i];
+      if (s->lane != lane || s->fn == NULL ||
+          (g->started & SER_BOOT_BIT(i)) != 0u)
+      {
+        continue;
+      }
+
+      if ((s->deps & g->failed) != 0u)
+      {
+        g->started |= SER_BOOT_BIT(i);
+        g->t_start[i] = g->port->now(g->ctx);
+        skip = (int32_t)i;
+        break;
+      }
+      if ((s->deps & ~g->done) == 0u)
+      {
+        g->started |= SER_BOOT_BIT(i);
+        boot_unlock(key);
+        g->t_start[i] = g->port->now(g->ctx);
+        return (int32_t)i;
+      }
+
+      pending = true;
+      missing |= s->deps & ~g->done;
+    }
+    boot_unlock(key);
+
+    if (skip >= 0)
+    {
+      finish(g, (uint32_t)skip, false);
+      continue;
+    }
+    if (!pending)
+    {
+      return BOOT_LANE_DONE;
+    }
+    *blocked_on = missing;
+    return BOOT_BLOCKED;
+  }
+}
+
+bool ser_boot_graph_run(ser_boot_graph_t *g, uint8_t lane, uint32_t wait_ms)
+{
+  if (g == NULL || g->steps == NULL || lane >= SER_BOOT_LANE_NUM)
+  {
+    return false;
+  }
+
+  for (;;)
+  {
+    uint32_t missing = 0;
+    int32_t idx = graph_next(g, lane, &missing);
+    if (idx >= 0)
+    {
+      const ser_boot_step_t *s = &g->steps[idx];
+      finish(g, (uint32_t)idx, s->fn(s->arg));
+      continue;
+    }
+    if (idx == BOOT_LANE_DONE)
+    {
+      return true;
+    }
+    if (wait_ms == 0u || g->port->wait == NULL ||
+        !g->port->wait(g->ctx, missing, wait_ms))
+    {
+      return false;
+    }
+  }
+}
+
+bool ser_boot_graph_complete(ser_boot_graph_t *g, uint32_t idx)
+{
+  if (g == NULL || idx >= g->n || g->steps[idx].fn != NULL)
+  {
+    return false;
+  }
+
+  const uint32_t bit = SER_BOOT_BIT(idx);
+  uint32_t key = boot_lock();
+  const uint32_t deps = g->steps[idx].deps;
+  if ((g->started & bit) != 0u || (deps & ~g->done) != 0u ||
+      (deps & g->failed) != 0u)
+  {
+    boot_unlock(key);
+    return false;
+  }
+  g->started |= bit;
+  boot_unlock(key);
+
+  g->t_start[idx] = g->port->now(g->ctx);
+  finish(g, idx, true);
+  return true;
+}
+
+void ser_boot_graph_mark_sched(ser_boot_graph_t *g)
+{
+  if (g != NULL && g->port != NULL && g->t_sched == 0u)
+  {
+    g->t_sched = g->port->now(g->ctx);
+  }
+}
+
+ser_boot_state_t ser_boot_graph_state(const ser_boot_graph_t *g, uint32_t idx)
+{
+  if (g == NULL || idx >= g->n)
+  {
+    return SER_BOOT_PENDING;
+  }
+
+  const uint32_t bit = SER_BOOT_BIT(idx);
+  if ((g->done & bit) == 0u)
+  {
+    return ((g->started & bit) != 0u) ? SER_BOOT_RUNNING : SER_BOOT_PENDING;
+  }
+  if ((g->failed & bit) == 0u)
+  {
+    return SER_BOOT_OK;
+  }
+  /* 执行失败与依赖失败：后者的依赖里必有失败位 */
+  return ((g->steps[idx].deps & g->failed) != 0u) ? SER_BOOT_SKIPPED
+                                                  : SER_BOOT_FAILED;
+}
+
+uint32_t ser_boot_graph_us(const ser_boot_graph_t *g, uint32_t cycles)
+{
+  if (g == NULL || g->port == NULL || g->port->hz == 0u)
+  {
+    return 0u;
+  }
+  return (uint32_t)((uint64_t)(uint32_t)(cycles - g->t0) * 1000000u /
+                    g->port->hz);
+}
+
+bool ser_boot_graph_all_done(const ser_boot_graph_t *g)
+{
+  if (g == NULL || g->n == 0u)
+  {
+    return false;
+  }
+
+  /* 依赖失败的里程碑永远不会 complete，视为已结束 */
+  for (uint32_t i = 0; i < g->n; i++)
+  {
+    if ((g->done & SER_BOOT_BIT(i)) == 0u &&
+        !(g->steps[i].fn == NULL && (g->steps[i].deps & g->failed) != 0u))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int ser_boot_graph_format(const ser_boot_graph_t *g, uint32_t line_idx,
+                          char *buf, uint32_t cap)
+{
+  if (g == NULL || buf == NULL || cap == 0u)
+  {
+    return 0;
+  }
+
+  int n = 0;
+  if (line_idx == 0u)
+  {
+    n = snprintf(buf, cap, "# boot,step,lane,start_us,end_us,state");
+  }
+  else if (line_idx <= g->n)
+  {
+    uint32_t i = line_idx - 1u;
+    ser_boot_state_t st = ser_boot_graph_state(g, i);
+    bool ended = (st != SER_BOOT_PENDING && st != SER_BOOT_RUNNING);
+    bool began = (st != SER_BOOT_PENDING);
+    n = snprintf(buf, cap, "boot,%s,%u,%lu,%lu,%s",
+                 (g->steps[i].name != NULL) ? g->steps[i].name : "?",
+                 (unsigned)g->steps[i].lane,
+                 began ? (unsigned long)ser_boot_graph_us(g, g->t_start[i])
+                       : 0ul,
+                 ended ? (unsigned long)ser_boot_graph_us(g, g->t_end[i])
+                       : 0ul,
+                 s_state_name[st]);
+  }
+  else if (line_idx == g->n + 1u)
+  {
+    n = snprintf(buf, cap, "boot,sched_us,%lu",
+                 (unsigned long)ser_boot_graph_us(g, g->t_sched));
+  }
+  else if (line_idx == g->n + 2u && g->ttff_idx >= 0)
+  {
+    uint32_t i = (uint32_t)g->ttff_idx;
+    if (ser_boot_graph_state(g, i) == SER_BOOT_OK)
+    {
+      n = snprintf(buf, cap, "boot,ttff_us,%lu",
+                   (unsigned long)ser_boot_graph_us(g, g->t_end[i]));
+    }
+    else
+    {
+      n = snprintf(buf, cap, "boot,ttff_us,none");
+    }
+  }
+  else
+  {
+    return 0;
+  }
+
+  return (n < 0) ? 0 : ((uint32_t)n >= cap ? (int)cap - 1 : n);
+}
+
+/* ==========================
+ * MCU：全局实例
+ * ========================== */
+#if !defined(SER_BOOT_HOST) || !SER_BOOT_HOST
+
+/* 等其余步骤（首帧等）结束的上限，超时照样输出报告 */
+#define SER_BOOT_REPORT_WAIT_MS 5000u
+
+static ser_boot_graph_t s_graph;
+static bool s_begun = false;
+static StaticEventGroup_t s_events_buf;
+static EventGroupHandle_t s_events = NULL;
+
+static uint32_t board_now(void *ctx)
+{
+  (void)ctx;
+  return dri_time_cycles_now();
+}
+
+static void board_signal(void *ctx, uint32_t done)
+{
+  (void)ctx;
+  /* 事件组在 ser_boot_start 中创建；调度器前的 MAIN 通道不需要唤醒任何人 */
+  if (s_events != NULL && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    (void)xEventGroupSetBits(s_events, (EventBits_t)done);
+  }
+}
+
+static bool board_wait(void *ctx, uint32_t mask, uint32_t timeout_ms)
+{
+  (void)ctx;
+  if (s_events == NULL || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+  {
+    return false;
+  }
+
+  TickType_t ticks = (timeout_ms == SER_BOOT_WAIT_FOREVER)
+                         ? portMAX_DELAY
+                         : pdMS_TO_TICKS(timeout_ms);
+  EventBits_t bits = xEventGroupWaitBits(s_events, (EventBits_t)mask, pdFALSE,
+                                         pdFALSE, ticks);
+  return (bits & mask) != 0u;
+}
+
+static ser_boot_port_t s_port = {
+    .now = board_now,
+    .signal = board_signal,
+    .wait = board_wait,
+};
+
+bool ser_boot_begin(const ser_boot_step_t *steps, uint32_t n,
+                    int32_t ttff_idx)
+{
+  /* main 在时钟配置完成后初始化 DWT（CYCCNT 清零），t0 即那一刻 */
+  s_port.hz = dri_time_hz();
+
+  s_begun = ser_boot_graph_init(&s_graph, steps, n, ttff_idx, &s_port, NULL);
+  return s_begun;
+}
+
+bool ser_boot_run(uint8_t lane, uint32_t wait_ms)
+{
+  if (!s_begun)
+  {
+    return true;
+  }
+  return ser_boot_graph_run(&s_graph, lane, wait_ms);
+}
+
+bool ser_boot_complete(uint32_t idx)
+{
+  return s_begun && ser_boot_graph_complete(&s_graph, idx);
+}
+
+ser_boot_state_t ser_boot_state(uint32_t idx)
+{
+  return ser_boot_graph_state(&s_graph, idx);
+}
+
+static void boot_report(void)
+{
+#if SER_BOOT_REPORT
+  if (!dev_console_init())
+  {
+    return;
+  }
+
+  char line[80];
+  for (uint32_t i = 0;; i++)
+  {
+    int n = ser_boot_graph_format(&s_graph, i, line, sizeof(line) - 2u);
+    if (n <= 0)
+    {
+      break;
+    }
+    line[n++] = '\r';
+    line[n++] = '\n';
+    (void)dev_console_write(line, (uint32_t)n);
+  }
+#endif
+}
+
+void ser_boot_task(void *argument)
+{
+  (void)argument;
+  if (s_events == NULL)
+  {
+    /* 没有调用 ser_boot_begin/ser_boot_start：无事可做 */
+    vTaskDelete(NULL);
+  }
+
+  ser_boot_graph_mark_sched(&s_graph);
+  (void)ser_boot_graph_run(&s_graph, SER_BOOT_LANE_IO, SER_BOOT_WAIT_FOREVER);
+
+  /* 其余通道/里程碑：每有步骤完成就醒一次，直到全部结束或超时 */
+  TickType_t start = xTaskGetTickCount();
+  while (!ser_boot_graph_all_done(&s_graph) &&
+         (xTaskGetTickCount() - start) < pdMS_TO_TICKS(SER_BOOT_REPORT_WAIT_MS))
+  {
+    uint32_t all = SER_BOOT_BIT(s_graph.n) - 1u;
+    (void)board_wait(NULL, all & ~s_graph.done, 100u);
+  }
+
+  boot_report();
+  vTaskDelete(NULL);
+}
+
+void ser_boot_start(void)
+{
+  if (!s_begun)
+  {
+    return;
+  }
+
+  s_events = xEventGroupCreateStatic(&s_events_buf);
+  /* 调度器前完成的步骤（MAIN 通道）先同步到事件组 */
+  (void)xEventGroupSetBits(s_events, (EventBits_t)s_graph.done);
+}
+
+#endif
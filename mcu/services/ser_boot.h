@@ -0,0 +1,181 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：启动阶段编排与计时
+ *
+ * 做法：
+ * - 启动过程拆成步骤表（由 app 层给出），每步声明依赖（位掩码）与执行通道（lane）
+ * - 同一通道内按表顺序执行已就绪的步骤；跨通道依赖由完成位同步，
+ *   互不依赖的步骤在不同任务里并发（如触摸复位/探测与 LVGL 建对象）
+ * - 依赖失败的步骤不执行，标记为 skip（如触摸探测失败则不挂输入设备）
+ * - fn 为 NULL 的步骤是里程碑（如首帧），由外部调用 complete 标记，依赖未满足时忽略
+ * - 每步记录开始/结束时刻（DWT 周期），报告换算为相对 t0 的微秒
+ *
+ * 通道：
+ * - MAIN：main() 中调度器启动前顺序执行，只能依赖 MAIN 通道的步骤
+ * - LVGL：LVGL 任务主循环内非阻塞推进
+ * - IO：启动工作任务（输入设备/传感器），跑完并输出报告后退出
+ *
+ * 报告（调试串口，每步一行）：
+ *   # boot,step,lane,start_us,end_us,state
+ *   boot,sdram,0,3,412,ok
+ *   ...
+ *   boot,sched_us,30512
+ *   boot,ttff_us,52034
+ *
+ * 可移植性：
+ * - 图检查/调度/格式化只通过 ser_boot_port_t 访问计时与等待，
+ *   主机构建（SER_BOOT_HOST=1）可用模拟 port 驱动同一套逻辑验证执行顺序
+ * - MCU 上 ser_boot_begin/start/run 等用全局实例 + FreeRTOS 事件组实现
+ */
+
+/* 完成位与 FreeRTOS 事件组位对应（configUSE_16_BIT_TICKS=0 时可用 24 位） */
+#define SER_BOOT_MAX_STEPS 24u
+
+#define SER_BOOT_BIT(idx) (1ul << (idx))
+
+/* run 的等待参数：一直等到通道跑完 */
+#define SER_BOOT_WAIT_FOREVER 0xFFFFFFFFu
+
+/* 启动报告经调试串口输出；性能分析/帧缓冲流占用该串口时默认关闭 */
+#ifndef SER_BOOT_REPORT
+#if (defined(SER_PROF_ENABLE) && SER_PROF_ENABLE) || \
+    (defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE)
+#define SER_BOOT_REPORT 0
+#else
+#define SER_BOOT_REPORT 1
+#endif
+#endif
+
+typedef enum
+{
+  SER_BOOT_LANE_MAIN = 0,
+  SER_BOOT_LANE_LVGL,
+  SER_BOOT_LANE_IO,
+  SER_BOOT_LANE_NUM,
+} ser_boot_lane_t;
+
+typedef enum
+{
+  SER_BOOT_PENDING = 0,
+  SER_BOOT_RUNNING,
+  SER_BOOT_OK,
+  SER_BOOT_FAILED,
+  SER_BOOT_SKIPPED, /* 依赖失败，未执行 */
+} ser_boot_state_t;
+
+typedef bool (*ser_boot_fn_t)(void *arg);
+
+typedef struct
+{
+  const char *name;
+  uint8_t lane;     /* ser_boot_lane_t */
+  uint32_t deps;    /* SER_BOOT_BIT(依赖步骤编号) 的组合 */
+  ser_boot_fn_t fn; /* NULL：里程碑 */
+  void *arg;
+} ser_boot_step_t;
+
+/*
+ * 平台抽象：
+ * - now / hz：周期计数与频率
+ * - signal：完成位有更新（done 为当前全部完成位），可为 NULL
+ * - wait：等待 mask 中任一位完成，超时返回 false；可为 NULL（不支持等待）
+ */
+typedef struct
+{
+  uint32_t (*now)(void *ctx);
+  uint32_t hz;
+  void (*signal)(void *ctx, uint32_t done);
+  bool (*wait)(void *ctx, uint32_t mask, uint32_t timeout_ms);
+} ser_boot_port_t;
+
+/* 图实例：字段仅供本模块使用，调用方只分配存储 */
+typedef struct
+{
+  const ser_boot_step_t *steps;
+  uint32_t n;
+  const ser_boot_port_t *port;
+  void *ctx;
+  int32_t ttff_idx;
+  volatile uint32_t started;
+  volatile uint32_t done;
+  volatile uint32_t failed;
+  uint32_t t0;
+  uint32_t t_sched;
+  uint32_t t_start[SER_BOOT_MAX_STEPS];
+  uint32_t t_end[SER_BOOT_MAX_STEPS];
+} ser_boot_graph_t;
+
+/*
+ * 检查步骤表：依赖越界/自依赖/成环/通道越界/MAIN 依赖其它通道
+ * 返回 -1 表示合法，否则返回第一个有问题的步骤编号
+ */
+int32_t ser_boot_graph_check(const ser_boot_step_t *steps, uint32_t n);
+
+/* 检查并初始化（记 t0）；ttff_idx 为首帧里程碑编号（没有时传 -1） */
+bool ser_boot_graph_init(ser_boot_graph_t *g, const ser_boot_step_t *steps,
+                         uint32_t n, int32_t ttff_idx,
+                         const ser_boot_port_t *port, void *ctx);
+
+/*
+ * 推进一个通道：依次执行就绪步骤；遇到未就绪的依赖时
+ * wait_ms 为 0 直接返回，否则经 port->wait 每次最多等 wait_ms
+ * 返回 true 表示该通道的步骤已全部结束
+ */
+bool ser_boot_graph_run(ser_boot_graph_t *g, uint8_t lane, uint32_t wait_ms);
+
+/* 标记里程碑完成；已完成或依赖未全部成功时返回 false */
+bool ser_boot_graph_complete(ser_boot_graph_t *g, uint32_t idx);
+
+/* 记录调度器启动时刻（报告用） */
+void ser_boot_graph_mark_sched(ser_boot_graph_t *g);
+
+ser_boot_state_t ser_boot_graph_state(const ser_boot_graph_t *g, uint32_t idx);
+
+/* 相对 t0 的微秒 */
+uint32_t ser_boot_graph_us(const ser_boot_graph_t *g, uint32_t cycles);
+
+/* 全部步骤（含里程碑）都已结束 */
+bool ser_boot_graph_all_done(const ser_boot_graph_t *g);
+
+/*
+ * 报告：header + 每步一行 + sched_us / ttff_us
+ * line_idx 从 0 起逐行取，超出范围返回 0；返回写入长度（不含 '\0'）
+ */
+int ser_boot_graph_format(const ser_boot_graph_t *g, uint32_t line_idx,
+                          char *buf, uint32_t cap);
+
+#if !defined(SER_BOOT_HOST) || !SER_BOOT_HOST
+/* 板上全局实例：app_init 开头调用（时钟配置完成后，DWT 从这里开始计） */
+bool ser_boot_begin(const ser_boot_step_t *steps, uint32_t n,
+                    int32_t ttff_idx);
+
+/* 推进本任务所属通道；MAIN 通道在调度器启动前调用，不会等待 */
+bool ser_boot_run(uint8_t lane, uint32_t wait_ms);
+
+/* 创建事件组（静态）并同步 MAIN 通道结果；app_start 中、调度器启动前调用 */
+void ser_boot_start(void);
+
+/*
+ * IO 通道工作任务入口（由 app 任务表静态创建，优先级高于其余服务任务）：
+ * 跑完 IO 通道后等待其余步骤结束、输出报告并退出
+ */
+#ifndef SER_BOOT_TASK_STACK
+#define SER_BOOT_TASK_STACK 512u
+#endif
+void ser_boot_task(void *argument);
+
+bool ser_boot_complete(uint32_t idx);
+ser_boot_state_t ser_boot_state(uint32_t idx);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
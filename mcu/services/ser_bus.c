@@ -0,0 +1,414 @@
+#include "ser_bus.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if !defined(SER_BUS_HOST) || !SER_BUS_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dri_time_us.h"
+
+/* 临界区只有几条指令（领槽位/改序号/挂订阅），直接关中断，任务与中断都能用 */
+static inline uint32_t bus_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static inline void bus_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+
+#define bus_barrier() __DMB()
+#else
+static inline uint32_t bus_lock(void)
+{
+  return 0u;
+}
+
+static inline void bus_unlock(uint32_t key)
+{
+  (void)key;
+}
+
+#define bus_barrier() __sync_synchronize()
+#endif
+
+#define SLOT_MASK (SER_BUS_SLOTS - 1u)
+
+#if (SER_BUS_SLOTS & SLOT_MASK) != 0u || SER_BUS_SLOTS < 2u
+#error "SER_BUS_SLOTS must be a power of two >= 2"
+#endif
+
+/* 全部主题的槽位：编译期按主题表展开，负载类型决定各自大小 */
+typedef struct
+{
+#define SER_BUS_X_SLOTS(name, type) type name[SER_BUS_SLOTS];
+  SER_BUS_TOPIC_TABLE(SER_BUS_X_SLOTS)
+#undef SER_BUS_X_SLOTS
+} bus_slots_t;
+
+static bus_slots_t s_slots;
+
+typedef struct
+{
+  const char *name;
+  uint8_t *base;
+  uint16_t size;
+} bus_desc_t;
+
+static const bus_desc_t s_desc[SER_BUS_TOPIC_NUM] = {
+#define SER_BUS_X_DESC(name, type)                                             \
+  [SER_BUS_TOPIC_##name] = {#name, (uint8_t *)s_slots.name, sizeof(type)},
+    SER_BUS_TOPIC_TABLE(SER_BUS_X_DESC)
+#undef SER_BUS_X_DESC
+};
+
+/*
+ * 槽位序号：ticket t 写入槽位 (t & SLOT_MASK)，写入中为 2t-1，生效后为 2t；
+ * 读方记下 2t，读完再比对，不相等说明被后来的 claim 覆盖了
+ */
+typedef struct
+{
+  volatile uint32_t slot_seq[SER_BUS_SLOTS];
+  volatile uint32_t t_pub[SER_BUS_SLOTS];
+  volatile uint32_t claimed; /* 已领取的 ticket 数 */
+  volatile uint32_t latest;  /* 最近 commit 的 ticket，0 为未发布 */
+  ser_bus_sub_t *volatile subs;
+
+  /* 统计值不加锁，仅供调试观察 */
+  ser_bus_stats_t stats;
+  uint64_t t_reset;
+} bus_topic_t;
+
+static bus_topic_t s_topics[SER_BUS_TOPIC_NUM];
+static const ser_bus_port_t *s_port = NULL;
+
+static uint32_t cycles_to_us(uint32_t cycles)
+{
+  return (uint32_t)((uint64_t)cycles * 1000000u / s_port->hz);
+}
+
+static bus_topic_t *topic_of(ser_bus_topic_t topic)
+{
+  if (s_port == NULL || (uint32_t)topic >= (uint32_t)SER_BUS_TOPIC_NUM)
+  {
+    return NULL;
+  }
+  return &s_topics[topic];
+}
+
+#if !defined(SER_BUS_HOST) || !SER_BUS_HOST
+static uint32_t board_now(void)
+{
+  return dri_time_cycles_now();
+}
+
+static uint64_t board_now64(void)
+{
+  return dri_time_cycles64();
+}
+
+static void board_notify(void *task, uint32_t bits, bool from_isr)
+{
+  if (from_isr)
+  {
+    BaseType_t woken = pdFALSE;
+    (void)xTaskNotifyFromISR((TaskHandle_t)task, bits, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+  else if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    (void)xTaskNotify((TaskHandle_t)task, bits, eSetBits);
+  }
+}
+
+static bool board_in_isr(void)
+{
+  return __get_IPSR() != 0u;
+}
+
+static ser_bus_port_t s_board_port = {
+    .now = board_now,
+    .now64 = board_now64,
+    .notify = board_notify,
+    .in_isr = board_in_isr,
+};
+#endif
+
+bool ser_bus_init(const ser_bus_port_t *port)
+{
+#if !defined(SER_BUS_HOST) || !SER_BUS_HOST
+  if (port == NULL)
+  {
+    s_board_port.hz = dri_time_hz();
+    port = &s_board_port;
+  }
+#endif
+  if (port == NULL || port->now == NULL || port->now64 == NULL ||
+      port->hz == 0u)
+  {
+    return false;
+  }
+
+  s_port = port;
+  memset(s_topics, 0, sizeof(s_topics));
+  memset(&s_slots, 0, sizeof(s_slots));
+  uint64_t now = port->now64();
+  for (uint32_t i = 0; i < (uint32_t)SER_BUS_TOPIC_NUM; i++)
+  {
+    s_topics[i].t_reset = now;
+  }
+  return true;
+}
+
+void *ser_bus_claim(ser_bus_topic_t topic, uint32_t *ticket)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL || ticket == NULL)
+  {
+    return NULL;
+  }
+
+  uint32_t key = bus_lock();
+  uint32_t tk = t->claimed + 1u;
+  if (tk == 0x80000000u)
+  {
+    /* 序号 2t 需要放进 32 位；回绕到 1 时槽位 0 上的旧值不会被误认 */
+    tk = 1u;
+  }
+  t->claimed = tk;
+  t->slot_seq[tk & SLOT_MASK] = tk * 2u - 1u;
+  bus_unlock(key);
+
+  *ticket = tk;
+  return s_desc[topic].base + (tk & SLOT_MASK) * s_desc[topic].size;
+}
+
+void ser_bus_commit(ser_bus_topic_t topic, uint32_t ticket)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL || ticket == 0u)
+  {
+    return;
+  }
+
+  const uint32_t idx = ticket & SLOT_MASK;
+  const uint32_t now = s_port->now();
+
+  uint32_t key = bus_lock();
+  if (t->slot_seq[idx] != ticket * 2u - 1u)
+  {
+    /* 写入期间被更新的 claim 占用了同一槽位（发布者之间相差一整圈），丢弃 */
+    bus_unlock(key);
+    return;
+  }
+  t->t_pub[idx] = now;
+  bus_barrier();
+  t->slot_seq[idx] = ticket * 2u;
+  t->latest = ticket;
+  t->stats.publishes++;
+  ser_bus_sub_t *sub = t->subs;
+  bus_unlock(key);
+
+  const bool isr = (s_port->in_isr != NULL) && s_port->in_isr();
+  const void *payload = s_desc[topic].base + idx * s_desc[topic].size;
+  for (; sub != NULL; sub = sub->next)
+  {
+    if (sub->cb != NULL)
+    {
+      uint32_t t0 = s_port->now();
+      sub->cb(topic, payload, sub->arg);
+      uint32_t us = cycles_to_us(s_port->now() - t0);
+      t->stats.callbacks++;
+      if (us > t->stats.cb_max_us)
+      {
+        t->stats.cb_max_us = us;
+      }
+    }
+    if (sub->task != NULL && s_port->notify != NULL)
+    {
+      s_port->notify(sub->task, sub->bits, isr);
+      t->stats.notifies++;
+    }
+  }
+}
+
+bool ser_bus_publish(ser_bus_topic_t topic, const void *payload)
+{
+  if (payload == NULL)
+  {
+    return false;
+  }
+
+  uint32_t ticket;
+  void *slot = ser_bus_claim(topic, &ticket);
+  if (slot == NULL)
+  {
+    return false;
+  }
+  memcpy(slot, payload, s_desc[topic].size);
+  ser_bus_commit(topic, ticket);
+  return true;
+}
+
+const void *ser_bus_read_begin(ser_bus_topic_t topic, uint32_t *token)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL || token == NULL)
+  {
+    return NULL;
+  }
+
+  const uint32_t tk = t->latest;
+  if (tk == 0u)
+  {
+    return NULL;
+  }
+  /* latest 读出后槽位若已被新的 claim 占用，read_end 比对序号时会失败 */
+  const uint32_t idx = tk & SLOT_MASK;
+  bus_barrier();
+
+  *token = tk;
+  return s_desc[topic].base + idx * s_desc[topic].size;
+}
+
+bool ser_bus_read_end(ser_bus_topic_t topic, uint32_t token)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL || token == 0u)
+  {
+    return false;
+  }
+
+  const uint32_t idx = token & SLOT_MASK;
+  const uint32_t t_pub = t->t_pub[idx];
+  bus_barrier();
+  if (t->slot_seq[idx] != token * 2u)
+  {
+    t->stats.stale++;
+    return false;
+  }
+
+  uint32_t lat = cycles_to_us(s_port->now() - t_pub);
+  t->stats.reads++;
+  t->stats.lat_last_us = lat;
+  t->stats.lat_sum_us += lat;
+  if (lat > t->stats.lat_max_us)
+  {
+    t->stats.lat_max_us = lat;
+  }
+  return true;
+}
+
+bool ser_bus_read(ser_bus_topic_t topic, void *out)
+{
+  if (out == NULL)
+  {
+    return false;
+  }
+
+  /* 被覆盖就重读：发布者每次最多领先 SLOTS-1 个槽位，重试次数有界 */
+  for (uint32_t retry = 0; retry < 8u; retry++)
+  {
+    uint32_t token;
+    const void *p = ser_bus_read_begin(topic, &token);
+    if (p == NULL)
+    {
+      return false;
+    }
+    memcpy(out, p, s_desc[topic].size);
+    if (ser_bus_read_end(topic, token))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t ser_bus_seq(ser_bus_topic_t topic)
+{
+  bus_topic_t *t = topic_of(topic);
+  return (t != NULL) ? t->latest : 0u;
+}
+
+bool ser_bus_subscribe(ser_bus_topic_t topic, ser_bus_sub_t *sub)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL || sub == NULL || (sub->cb == NULL && sub->task == NULL))
+  {
+    return false;
+  }
+
+  uint32_t key = bus_lock();
+  for (ser_bus_sub_t *s = t->subs; s != NULL; s = s->next)
+  {
+    if (s == sub)
+    {
+      bus_unlock(key);
+      return false;
+    }
+  }
+  /* 头插：commit 在锁外遍历时看到的要么是旧表头，要么是完整的新节点 */
+  sub->next = t->subs;
+  t->subs = sub;
+  bus_unlock(key);
+  return true;
+}
+
+const char *ser_bus_topic_name(ser_bus_topic_t topic)
+{
+  if ((uint32_t)topic >= (uint32_t)SER_BUS_TOPIC_NUM)
+  {
+    return NULL;
+  }
+  return s_desc[topic].name;
+}
+
+uint32_t ser_bus_payload_size(ser_bus_topic_t topic)
+{
+  if ((uint32_t)topic >= (uint32_t)SER_BUS_TOPIC_NUM)
+  {
+    return 0u;
+  }
+  return s_desc[topic].size;
+}
+
+void ser_bus_get_stats(ser_bus_topic_t topic, ser_bus_stats_t *stats)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (stats == NULL)
+  {
+    return;
+  }
+  if (t == NULL)
+  {
+    memset(stats, 0, sizeof(*stats));
+    return;
+  }
+
+  *stats = t->stats;
+  /* 先换算成微秒：清零后可能已过数小时，publishes * hz * 1000 会溢出 64 位 */
+  const uint64_t dt = s_port->now64() - t->t_reset;
+  const uint64_t dt_us = (dt / s_port->hz) * 1000000u +
+                         (dt % s_port->hz) * 1000000u / s_port->hz;
+  stats->rate_mhz =
+      (dt_us != 0u)
+          ? (uint32_t)((uint64_t)stats->publishes * 1000000000u / dt_us)
+          : 0u;
+}
+
+void ser_bus_reset_stats(ser_bus_topic_t topic)
+{
+  bus_topic_t *t = topic_of(topic);
+  if (t == NULL)
+  {
+    return;
+  }
+
+  memset(&t->stats, 0, sizeof(t->stats));
+  t->t_reset = s_port->now64();
+}
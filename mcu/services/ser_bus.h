@@ -0,0 +1,148 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ser_bus_topics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：事件总线（静态主题表 + 零拷贝发布/订阅）
+ *
+ * 做法：
+ * - 主题在 ser_bus_topics.h 中编译期声明，负载类型固定；每个主题 SER_BUS_SLOTS 个静态槽位
+ * - 发布：claim 领取下一个槽位、直接写入负载、commit 生效；除这一次写入外无拷贝
+ *   （ser_bus_publish 是 claim + memcpy + commit 的便捷封装）
+ * - 槽位带序号（seqlock）：读方直接读槽位（read_begin/read_end），读期间被发布者追上
+ *   一圈时 read_end 返回 false；ser_bus_read 为拷贝版本，失败自动重读
+ * - 订阅：
+ *   - 回调：在发布者上下文（任务或中断）直接拿到槽位指针，应当很短
+ *   - 任务通知：按订阅给出的位 eSetBits，任务醒来后再 read 最新值
+ *   订阅结构由调用方持有（静态存储），没有取消订阅
+ * - 每主题统计：发布次数与平均频率、回调/通知次数、发布 -> 读取延迟、读到一半被覆盖次数
+ *
+ * 上下文：
+ * - claim/commit/publish/read 可在任务或中断（优先级不高于 configMAX_SYSCALL）中调用
+ * - subscribe 在任务上下文（或调度器启动前）调用
+ *
+ * 可移植性：
+ * - 只通过 ser_bus_port_t 访问计时与任务通知；主机构建（SER_BUS_HOST=1）
+ *   关中断为空操作，由调用方给出 port，可直接驱动同一套逻辑
+ */
+
+/* 每主题槽位数（2 的幂）：读方必须在发布者再写 SLOTS-1 次之前读完 */
+#ifndef SER_BUS_SLOTS
+#define SER_BUS_SLOTS 4u
+#endif
+
+typedef enum
+{
+#define SER_BUS_X_ENUM(name, type) SER_BUS_TOPIC_##name,
+  SER_BUS_TOPIC_TABLE(SER_BUS_X_ENUM)
+#undef SER_BUS_X_ENUM
+  SER_BUS_TOPIC_NUM,
+} ser_bus_topic_t;
+
+typedef void (*ser_bus_cb_t)(ser_bus_topic_t topic, const void *payload,
+                             void *arg);
+
+typedef struct ser_bus_sub ser_bus_sub_t;
+struct ser_bus_sub
+{
+  /* 调用方填写：cb 与 task 至少一个非 NULL */
+  ser_bus_cb_t cb;
+  void *arg;
+  void *task;    /* TaskHandle_t */
+  uint32_t bits; /* 任务通知位 */
+
+  /* 以下由总线维护 */
+  ser_bus_sub_t *next;
+};
+
+typedef struct
+{
+  uint32_t publishes;
+  uint32_t rate_mhz;  /* 自上次清零起的平均发布频率（0.001Hz） */
+  uint32_t callbacks;
+  uint32_t notifies;
+  uint32_t cb_max_us; /* 单次回调最长耗时 */
+  uint32_t reads;
+  uint32_t stale;     /* 读期间槽位被覆盖 */
+  uint32_t lat_last_us; /* commit -> read_end */
+  uint32_t lat_max_us;
+  uint64_t lat_sum_us;
+} ser_bus_stats_t;
+
+/*
+ * 平台抽象：
+ * - now / hz：周期计数与频率（32 位，只用于短时差：回调耗时、发布 -> 读取延迟）
+ * - now64：同一时钟的 64 位计数，统计平均频率用（清零间隔可能超过 32 位回绕周期，
+ *   168MHz 下约 25s）
+ * - notify：给任务置通知位；from_isr 为 true 时在中断上下文
+ * - in_isr：可为 NULL（视为任务上下文）
+ */
+typedef struct
+{
+  uint32_t (*now)(void);
+  uint64_t (*now64)(void);
+  uint32_t hz;
+  void (*notify)(void *task, uint32_t bits, bool from_isr);
+  bool (*in_isr)(void);
+} ser_bus_port_t;
+
+/* 初始化；port 为 NULL 时 MCU 上使用 DWT + FreeRTOS 任务通知（调度器启动前调用） */
+bool ser_bus_init(const ser_bus_port_t *port);
+
+/* 领取槽位（*ticket 交给 commit）；返回 NULL 表示主题无效 */
+void *ser_bus_claim(ser_bus_topic_t topic, uint32_t *ticket);
+
+/* 发布已写好的槽位并通知订阅者 */
+void ser_bus_commit(ser_bus_topic_t topic, uint32_t ticket);
+
+/* claim + 拷贝 + commit */
+bool ser_bus_publish(ser_bus_topic_t topic, const void *payload);
+
+/*
+ * 原地读最新值：返回槽位指针（从未发布时为 NULL），*token 交给 read_end；
+ * read_end 返回 false 表示读期间被覆盖，读到的内容不可用
+ */
+const void *ser_bus_read_begin(ser_bus_topic_t topic, uint32_t *token);
+bool ser_bus_read_end(ser_bus_topic_t topic, uint32_t token);
+
+/* 拷贝最新值到 out；从未发布过返回 false */
+bool ser_bus_read(ser_bus_topic_t topic, void *out);
+
+/* 最近一次 commit 的序号（从 1 开始，0 表示未发布），可用于判断是否有新值 */
+uint32_t ser_bus_seq(ser_bus_topic_t topic);
+
+bool ser_bus_subscribe(ser_bus_topic_t topic, ser_bus_sub_t *sub);
+
+const char *ser_bus_topic_name(ser_bus_topic_t topic);
+uint32_t ser_bus_payload_size(ser_bus_topic_t topic);
+
+void ser_bus_get_stats(ser_bus_topic_t topic, ser_bus_stats_t *stats);
+void ser_bus_reset_stats(ser_bus_topic_t topic);
+
+/* 类型化封装：ser_bus_publish_<name>(const type *) / ser_bus_read_<name>(type *) */
+#define SER_BUS_X_API(name, type)                                              \
+  static inline bool ser_bus_publish_##name(const type *v)                    \
+  {                                                                            \
+    return ser_bus_publish(SER_BUS_TOPIC_##name, v);                           \
+  }                                                                            \
+  static inline bool ser_bus_read_##name(type *out)                            \
+  {                                                                            \
+    return ser_bus_read(SER_BUS_TOPIC_##name, out);                            \
+  }                                                                            \
+  static inline type *ser_bus_claim_##name(uint32_t *ticket)                   \
+  {                                                                            \
+    return (type *)ser_bus_claim(SER_BUS_TOPIC_##name, ticket);                \
+  }
+SER_BUS_TOPIC_TABLE(SER_BUS_X_API)
+#undef SER_BUS_X_API
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * services/ 层：事件总线主题表（声明式描述）
+ *
+ * 每一项 X(name, type) 在编译期展开为：
+ * - 主题编号 SER_BUS_TOPIC_<name>
+ * - 静态槽位 type[SER_BUS_SLOTS]（发布者直接写槽位，无堆分配）
+ * - 类型化接口 ser_bus_publish_<name> / ser_bus_read_<name>
+ *
+ * 约定：
+ * - 负载类型为定长 POD 结构体，定义在本文件表上方
+ * - 新增主题只改本文件；发布/订阅方各自 #include "ser_bus.h"
+ *
+ * 本文件只能被 ser_bus.h 包含。
+ */
+
+/* 超声波测距结果（ser_ultrasonic 每周期发布，取第 0 路） */
+typedef struct
+{
+  int32_t mm; /* 距离，无有效测距时为 -1 */
+} ser_bus_distance_t;
+
+/* 多路超声波一个周期的全部读数（ser_ultrasonic 每周期发布一次） */
+#define SER_BUS_RANGES_MAX 8u
+
+typedef struct
+{
+  uint32_t cycle;   /* 周期序号 */
+  uint8_t n;        /* 路数 */
+  uint8_t valid;    /* 位图：mm[i] 有效 */
+  uint8_t rejected; /* 位图：有回波但被串扰门限拒绝 */
+  uint8_t reserved;
+  int32_t mm[SER_BUS_RANGES_MAX]; /* 无效为 -1 */
+} ser_bus_ranges_t;
+
+// clang-format off
+#define SER_BUS_TOPIC_TABLE(X)                                                 \
+  X(distance, ser_bus_distance_t)                                              \
+  X(ranges,   ser_bus_ranges_t)
+// clang-format on
@@ -0,0 +1,362 @@
+#include "ser_fbstream.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dev_console.h"
+#include "dev_lcd.h"
+#include "dri_time_us.h"
+#include "ser_rle565.h"
+
+#define FB_TX_MAX                                                              \
+  ((SER_FBSTREAM_MAX_W + SER_FBSTREAM_TILE - 1u) / SER_FBSTREAM_TILE)
+#define FB_TY_MAX                                                              \
+  ((SER_FBSTREAM_MAX_H + SER_FBSTREAM_TILE - 1u) / SER_FBSTREAM_TILE)
+
+#define FB_PKT_HDR 5u
+#define FB_RECT_HDR 8u
+
+#define FB_PKT_FRAME 0x10u
+#define FB_PKT_RECT 0x11u
+#define FB_PKT_END 0x12u
+
+#define FB_FRAME_KEY 0x01u
+
+_Static_assert(FB_TX_MAX <= 32u, "one uint32_t dirty mask per tile row");
+_Static_assert(SER_FBSTREAM_PKT_BYTES >=
+                   FB_PKT_HDR + FB_RECT_HDR +
+                       SER_RLE565_ROW_MAX_BYTES(SER_FBSTREAM_MAX_W),
+               "packet buffer must hold one worst-case row");
+_Static_assert(SER_FBSTREAM_PKT_BYTES <= 0xFFFFu + FB_PKT_HDR,
+               "payload length is 16-bit");
+
+/* 脏位图：LVGL 上下文写，发送任务取走 */
+static uint32_t s_dirty[FB_TY_MAX];
+static volatile bool s_key_req = true;
+
+static ser_fbstream_stats_t s_stats;
+
+/* 发送任务私有：行缓冲（当前/上一行）与 DMA 双缓冲 */
+static uint16_t s_line[2][SER_FBSTREAM_MAX_W];
+static uint8_t s_pkt[2][SER_FBSTREAM_PKT_BYTES];
+static uint32_t s_pkt_idx = 0;
+static uint32_t s_seq = 0;
+
+void ser_fbstream_mark(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+  const int32_t w = (int32_t)dev_lcd_width();
+  const int32_t h = (int32_t)dev_lcd_height();
+  if (x1 < 0)
+    x1 = 0;
+  if (y1 < 0)
+    y1 = 0;
+  if (x2 >= w)
+    x2 = w - 1;
+  if (y2 >= h)
+    y2 = h - 1;
+  if (x2 < x1 || y2 < y1)
+  {
+    return;
+  }
+
+  uint32_t tx1 = (uint32_t)x1 / SER_FBSTREAM_TILE;
+  uint32_t tx2 = (uint32_t)x2 / SER_FBSTREAM_TILE;
+  uint32_t ty1 = (uint32_t)y1 / SER_FBSTREAM_TILE;
+  uint32_t ty2 = (uint32_t)y2 / SER_FBSTREAM_TILE;
+  if (tx2 >= FB_TX_MAX || ty2 >= FB_TY_MAX)
+  {
+    return;
+  }
+
+  /* tx1..tx2 位全 1（tx2 可能为 31） */
+  uint32_t mask = (0xFFFFFFFFu >> (31u - tx2)) & ~((1u << tx1) - 1u);
+
+  taskENTER_CRITICAL();
+  for (uint32_t ty = ty1; ty <= ty2; ty++)
+  {
+    s_dirty[ty] |= mask;
+  }
+  taskEXIT_CRITICAL();
+}
+
+void ser_fbstream_keyframe(void)
+{
+  s_key_req = true;
+}
+
+void ser_fbstream_get_stats(ser_fbstream_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  taskENTER_CRITICAL();
+  *stats = s_stats;
+  taskEXIT_CRITICAL();
+}
+
+/* ==========================
+ * 打包与发送
+ * ========================== */
+static uint8_t *put_u16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t)(v & 0xFFu);
+  p[1] = (uint8_t)(v >> 8);
+  return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+  p = put_u16(p, (uint16_t)(v & 0xFFFFu));
+  return put_u16(p, (uint16_t)(v >> 16));
+}
+
+static uint8_t *put_hdr(uint8_t *p, uint8_t type, uint16_t len)
+{
+  *p++ = 0xA5u;
+  *p++ = 0x5Au;
+  *p++ = type;
+  return put_u16(p, len);
+}
+
+static uint8_t *pkt_buf(void)
+{
+  return s_pkt[s_pkt_idx];
+}
+
+/*
+ * 交给 DMA 发送并切到另一块缓冲
+ * - write_async 只有上一次传输完成才会接受，因此切回的缓冲一定已发完
+ * - 发送后按 SER_FBSTREAM_MAX_BPS 让出 CPU，平均速率不超过上限
+ */
+static void pkt_send(uint32_t n)
+{
+  while (!dev_console_write_async(s_pkt[s_pkt_idx], (uint16_t)n))
+  {
+    vTaskDelay(1);
+  }
+  s_pkt_idx ^= 1u;
+
+  taskENTER_CRITICAL();
+  s_stats.sent_bytes += n;
+  taskEXIT_CRITICAL();
+
+  uint32_t ms = n * 1000u / SER_FBSTREAM_MAX_BPS;
+  vTaskDelay(pdMS_TO_TICKS(ms > 0u ? ms : 1u));
+}
+
+static void send_frame_hdr(bool key)
+{
+  uint8_t *p = pkt_buf();
+  uint8_t *q = put_hdr(p, FB_PKT_FRAME, 9u);
+  q = put_u32(q, s_seq);
+  q = put_u16(q, dev_lcd_width());
+  q = put_u16(q, dev_lcd_height());
+  *q++ = key ? FB_FRAME_KEY : 0u;
+  pkt_send((uint32_t)(q - p));
+}
+
+static void send_frame_end(void)
+{
+  uint8_t *p = pkt_buf();
+  uint8_t *q = put_hdr(p, FB_PKT_END, 4u);
+  q = put_u32(q, s_seq);
+  pkt_send((uint32_t)(q - p));
+}
+
+/* 补写 RECT 包头（行数在编码结束后才知道） */
+static uint32_t rect_close(uint8_t *p, uint32_t len, int32_t x, int32_t y,
+                           int32_t w, int32_t rows)
+{
+  uint8_t *q = put_hdr(p, FB_PKT_RECT, (uint16_t)(len - FB_PKT_HDR));
+  q = put_u16(q, (uint16_t)x);
+  q = put_u16(q, (uint16_t)y);
+  q = put_u16(q, (uint16_t)w);
+  (void)put_u16(q, (uint16_t)rows);
+  return len;
+}
+
+/* 编码并发送矩形 [x, x+w) x [y, y+h)，超过包长时按行拆包 */
+static void send_rect(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  uint32_t t0 = dri_time_cycles_now();
+  uint32_t enc_us = 0;
+
+  uint8_t *p = pkt_buf();
+  uint32_t len = FB_PKT_HDR + FB_RECT_HDR;
+  int32_t y0 = y;
+  int32_t rows = 0;
+  uint32_t cur = 0;
+
+  for (int32_t yy = y; yy < y + h; yy++)
+  {
+    uint16_t *row = s_line[cur];
+    (void)dev_lcd_read_rgb565(x, yy, x + w - 1, row);
+
+    /* 每包第一行不参考上一行，包可独立解码 */
+    const uint16_t *prev = (rows > 0) ? s_line[cur ^ 1u] : NULL;
+    uint32_t n = ser_rle565_encode_row(row, prev, (uint32_t)w, p + len,
+                                       SER_FBSTREAM_PKT_BYTES - len);
+    if (n == 0u)
+    {
+      /* 本包放不下：先发出已编码的行，本行在新包里重新编码 */
+      enc_us += dri_time_cycles_elapsed_us(t0);
+      pkt_send(rect_close(p, len, x, y0, w, rows));
+      t0 = dri_time_cycles_now();
+
+      p = pkt_buf();
+      len = FB_PKT_HDR + FB_RECT_HDR;
+      y0 = yy;
+      rows = 0;
+      n = ser_rle565_encode_row(row, NULL, (uint32_t)w, p + len,
+                                SER_FBSTREAM_PKT_BYTES - len);
+    }
+
+    len += n;
+    rows++;
+    cur ^= 1u;
+  }
+
+  enc_us += dri_time_cycles_elapsed_us(t0);
+  taskENTER_CRITICAL();
+  s_stats.rects++;
+  s_stats.raw_bytes += (uint32_t)w * (uint32_t)h * 2u;
+  s_stats.encode_us += enc_us;
+  taskEXIT_CRITICAL();
+
+  pkt_send(rect_close(p, len, x, y0, w, rows));
+}
+
+static void send_frame(const uint32_t *dirty, uint32_t ty_n, bool key)
+{
+  const int32_t scr_w = (int32_t)dev_lcd_width();
+  const int32_t scr_h = (int32_t)dev_lcd_height();
+
+  send_frame_hdr(key);
+
+  uint32_t ty = 0;
+  while (ty < ty_n)
+  {
+    uint32_t mask = dirty[ty];
+    if (mask == 0u)
+    {
+      ty++;
+      continue;
+    }
+
+    /* 脏位相同的相邻瓦片行合并成一个带 */
+    uint32_t ty_end = ty + 1u;
+    while (ty_end < ty_n && dirty[ty_end] == mask)
+    {
+      ty_end++;
+    }
+
+    int32_t y = (int32_t)(ty * SER_FBSTREAM_TILE);
+    int32_t y2 = (int32_t)(ty_end * SER_FBSTREAM_TILE);
+    if (y2 > scr_h)
+      y2 = scr_h;
+
+    /* 带内每段连续脏瓦片一个矩形 */
+    while (mask != 0u)
+    {
+      uint32_t tx = (uint32_t)__builtin_ctz(mask);
+      uint32_t inv = ~(mask >> tx);
+      uint32_t run = (inv == 0u) ? (32u - tx) : (uint32_t)__builtin_ctz(inv);
+
+      int32_t x = (int32_t)(tx * SER_FBSTREAM_TILE);
+      int32_t x2 = (int32_t)((tx + run) * SER_FBSTREAM_TILE);
+      if (x2 > scr_w)
+        x2 = scr_w;
+      if (x2 > x)
+      {
+        send_rect(x, y, x2 - x, y2 - y);
+      }
+
+      mask &= (run >= 32u) ? 0u : ~(((1u << run) - 1u) << tx);
+    }
+
+    ty = ty_end;
+  }
+
+  send_frame_end();
+
+  taskENTER_CRITICAL();
+  s_stats.frames++;
+  taskEXIT_CRITICAL();
+  s_seq++;
+}
+
+static bool s_started = false;
+
+void ser_fbstream_task(void *argument)
+{
+  (void)argument;
+  if (!s_started)
+  {
+    vTaskDelete(NULL);
+  }
+
+  const uint32_t tx_n =
+      ((uint32_t)dev_lcd_width() + SER_FBSTREAM_TILE - 1u) / SER_FBSTREAM_TILE;
+  const uint32_t ty_n =
+      ((uint32_t)dev_lcd_height() + SER_FBSTREAM_TILE - 1u) / SER_FBSTREAM_TILE;
+  if (tx_n == 0u || tx_n > FB_TX_MAX || ty_n == 0u || ty_n > FB_TY_MAX)
+  {
+    vTaskDelete(NULL);
+    return;
+  }
+  const uint32_t all = (tx_n >= 32u) ? 0xFFFFFFFFu : ((1u << tx_n) - 1u);
+
+  static uint32_t snap[FB_TY_MAX];
+  TickType_t last_key = xTaskGetTickCount();
+
+  for (;;)
+  {
+    vTaskDelay(pdMS_TO_TICKS(SER_FBSTREAM_PERIOD_MS));
+
+    bool key = s_key_req ||
+               (xTaskGetTickCount() - last_key) >=
+                   pdMS_TO_TICKS(SER_FBSTREAM_KEYFRAME_MS);
+
+    bool any = false;
+    taskENTER_CRITICAL();
+    for (uint32_t ty = 0; ty < ty_n; ty++)
+    {
+      snap[ty] = key ? all : s_dirty[ty];
+      s_dirty[ty] = 0u;
+      any = any || (snap[ty] != 0u);
+    }
+    s_key_req = false;
+    taskEXIT_CRITICAL();
+
+    if (key)
+    {
+      last_key = xTaskGetTickCount();
+    }
+    if (any)
+    {
+      send_frame(snap, ty_n, key);
+    }
+  }
+}
+
+bool ser_fbstream_init(void)
+{
+  if (s_started)
+  {
+    return true;
+  }
+
+  if (!dev_console_init())
+  {
+    return false;
+  }
+
+  s_started = true;
+  return true;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：远程帧缓冲流（现场诊断时不用摄像头也能看到屏幕内容）
+ *
+ * 做法：
+ * - LVGL 每次 flush 后调用 ser_fbstream_mark 记下脏区（按 TILE 对齐记位图，开销 O(瓦片数)）
+ *   ser_lvgl_scroll 在帧缓冲内搬移像素（不经过 flush）后同样标记目的区域
+ * - 低优先级任务按 SER_FBSTREAM_PERIOD_MS 取走位图，从帧缓冲读回脏瓦片
+ *   （dev_lcd_read_rgb565，非 RGB565 帧缓冲自动还原），用 ser_rle565 编码后
+ *   经 dev_console DMA 发出；脏位相同的相邻瓦片行合并成一个矩形带
+ * - 每 SER_FBSTREAM_KEYFRAME_MS 发一次整屏，上位机中途接入也能拼出完整画面
+ *
+ * 包格式（与 ser_prof 相同的帧头，type 不重叠）：
+ *     A5 5A | type(u8) | len(u16 LE) | payload
+ *   0x10 FRAME {u32 seq, u16 width, u16 height, u8 flags(bit0=整屏)}
+ *   0x11 RECT  {u16 x, u16 y, u16 w, u16 h, rle565 行数据 * h}
+ *              一个矩形带超过包长时按行拆成多个 RECT，每包第一行不使用 ROW
+ *   0x12 END   {u32 seq}
+ * 上位机：project/tools/fbview.py 还原为 PNG 序列，并统计压缩率
+ *
+ * 不抢渲染：
+ * - 任务优先级低于 LVGL，只在 LVGL 空闲时编码
+ * - 发送速率限制在 SER_FBSTREAM_MAX_BPS，给同一串口上的其它数据留余量
+ * - DIRECT 模式下编码读取的是 LVGL 正在使用的帧缓冲，可能看到撕裂；
+ *   被再次绘制的区域会在下一帧重新发送
+ *
+ * 启用：编译定义 SER_FBSTREAM_ENABLE=1（CMake 选项同名）
+ */
+
+#ifndef SER_FBSTREAM_TILE
+#define SER_FBSTREAM_TILE 32u
+#endif
+
+#ifndef SER_FBSTREAM_MAX_W
+#define SER_FBSTREAM_MAX_W 800u
+#endif
+#ifndef SER_FBSTREAM_MAX_H
+#define SER_FBSTREAM_MAX_H 480u
+#endif
+
+/* 两次取脏区的最小间隔（即最高帧率） */
+#ifndef SER_FBSTREAM_PERIOD_MS
+#define SER_FBSTREAM_PERIOD_MS 200u
+#endif
+
+#ifndef SER_FBSTREAM_KEYFRAME_MS
+#define SER_FBSTREAM_KEYFRAME_MS 10000u
+#endif
+
+/* 单个包缓冲大小（双缓冲，必须放得下一整行最坏编码） */
+#ifndef SER_FBSTREAM_PKT_BYTES
+#define SER_FBSTREAM_PKT_BYTES 2048u
+#endif
+
+/* 发送速率上限（字节/秒）；921600 波特约 92KB/s，默认用其 3/4 */
+#ifndef SER_FBSTREAM_MAX_BPS
+#define SER_FBSTREAM_MAX_BPS 69000u
+#endif
+
+/* 标记脏区（闭区间，屏幕坐标）；任意任务上下文 */
+void ser_fbstream_mark(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+
+/* 请求下一帧发送整屏 */
+void ser_fbstream_keyframe(void);
+
+/* 初始化控制台（调度器启动前调用）；发送任务由 app 任务表静态创建 */
+bool ser_fbstream_init(void);
+
+#ifndef SER_FBSTREAM_TASK_STACK
+#define SER_FBSTREAM_TASK_STACK 384u
+#endif
+void ser_fbstream_task(void *argument);
+
+typedef struct
+{
+  uint32_t frames;        /* 发出的帧数 */
+  uint32_t rects;         /* 发出的 RECT 包数 */
+  uint32_t raw_bytes;     /* 编码前字节数（RGB565） */
+  uint32_t sent_bytes;    /* 实际发送字节数（含包头） */
+  uint32_t encode_us;     /* 读回 + 编码累计耗时（吞吐 = raw_bytes / encode_us） */
+} ser_fbstream_stats_t;
+
+void ser_fbstream_get_stats(ser_fbstream_stats_t *stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
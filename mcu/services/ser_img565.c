@@ -0,0 +1,203 @@
+#include "ser_img565.h"
+
+#include <stddef.h>
+
+#include "ser_rle565.h"
+
+static void put_u16(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)(v & 0xFFu);
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+  put_u16(p, v & 0xFFFFu);
+  put_u16(p + 2, v >> 16);
+}
+
+static uint32_t get_u16(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return get_u16(p) | (get_u16(p + 2) << 16);
+}
+
+static uint32_t key_count(uint32_t h, uint32_t key_rows)
+{
+  return (h + key_rows - 1u) / key_rows;
+}
+
+uint32_t ser_img565_bound(uint32_t w, uint32_t h, uint32_t key_rows)
+{
+  if (key_rows == 0u)
+  {
+    return 0u;
+  }
+  return SER_IMG565_HDR_BYTES + key_count(h, key_rows) * 4u +
+         h * SER_RLE565_ROW_MAX_BYTES(w);
+}
+
+uint32_t ser_img565_encode(const uint16_t *px, uint32_t w, uint32_t h,
+                           uint32_t stride, uint32_t key_rows, uint8_t *out,
+                           uint32_t cap)
+{
+  if (px == NULL || out == NULL || w == 0u || h == 0u || w > 0xFFFFu ||
+      h > 0xFFFFu || key_rows == 0u || key_rows > 0xFFFFu)
+  {
+    return 0u;
+  }
+
+  const uint32_t n_keys = key_count(h, key_rows);
+  const uint32_t head = SER_IMG565_HDR_BYTES + n_keys * 4u;
+  if (cap < head)
+  {
+    return 0u;
+  }
+
+  put_u32(out, SER_IMG565_MAGIC);
+  put_u16(out + 4, w);
+  put_u16(out + 6, h);
+  put_u16(out + 8, key_rows);
+  put_u16(out + 10, n_keys);
+
+  uint32_t n = head;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    const uint16_t *row = px + (size_t)y * stride;
+    const uint16_t *prev = NULL;
+    if ((y % key_rows) == 0u)
+    {
+      put_u32(out + SER_IMG565_HDR_BYTES + (y / key_rows) * 4u, n - head);
+    }
+    else
+    {
+      prev = row - stride;
+    }
+
+    uint32_t k = ser_rle565_encode_row(row, prev, w, out + n, cap - n);
+    if (k == 0u)
+    {
+      return 0u;
+    }
+    n += k;
+  }
+  return n;
+}
+
+bool ser_img565_open(ser_img565_t *img, const uint8_t *data, uint32_t len)
+{
+  if (img == NULL || data == NULL || len < SER_IMG565_HDR_BYTES ||
+      get_u32(data) != SER_IMG565_MAGIC)
+  {
+    return false;
+  }
+
+  const uint32_t w = get_u16(data + 4);
+  const uint32_t h = get_u16(data + 6);
+  const uint32_t key_rows = get_u16(data + 8);
+  const uint32_t n_keys = get_u16(data + 10);
+  if (w == 0u || h == 0u || key_rows == 0u ||
+      n_keys != key_count(h, key_rows))
+  {
+    return false;
+  }
+
+  const uint32_t head = SER_IMG565_HDR_BYTES + n_keys * 4u;
+  if (len < head)
+  {
+    return false;
+  }
+
+  /* 偏移必须递增且落在码流内：之后 seek 不再检查 */
+  uint32_t last = 0;
+  for (uint32_t k = 0; k < n_keys; k++)
+  {
+    uint32_t off = get_u32(data + SER_IMG565_HDR_BYTES + k * 4u);
+    if (off < last || off >= len - head)
+    {
+      return false;
+    }
+    last = off;
+  }
+
+  img->w = (uint16_t)w;
+  img->h = (uint16_t)h;
+  img->key_rows = (uint16_t)key_rows;
+  img->n_keys = (uint16_t)n_keys;
+  img->index = data + SER_IMG565_HDR_BYTES;
+  img->stream = data + head;
+  img->end = data + len;
+  return true;
+}
+
+bool ser_img565_seek(ser_img565_cursor_t *cur, const ser_img565_t *img,
+                     uint32_t x1, uint32_t x2, uint32_t y, uint16_t *scratch)
+{
+  if (cur == NULL || img == NULL || scratch == NULL || x1 > x2 ||
+      x2 >= img->w || y >= img->h)
+  {
+    return false;
+  }
+
+  const uint32_t k = y / img->key_rows;
+  cur->img = img;
+  cur->src = img->stream + get_u32(img->index + k * 4u);
+  cur->prev = NULL;
+  cur->x1 = (uint16_t)x1;
+  cur->x2 = (uint16_t)x2;
+  cur->y = (uint16_t)(k * img->key_rows);
+  cur->skipped = (uint16_t)(y - cur->y);
+
+  /* 定位用的行只需要留下最后一行当作 y 的上一行：原地覆盖 */
+  while (cur->y < y)
+  {
+    if (!ser_rle565_decode_row_clip(&cur->src, img->end, scratch, cur->prev,
+                                    img->w, x1, x2))
+    {
+      return false;
+    }
+    cur->prev = scratch;
+    cur->y++;
+  }
+  return true;
+}
+
+bool ser_img565_read(ser_img565_cursor_t *cur, uint16_t *dst,
+                     uint32_t dst_stride, uint32_t n)
+{
+  if (cur == NULL || cur->img == NULL || dst == NULL ||
+      (uint32_t)cur->y + n > cur->img->h)
+  {
+    return false;
+  }
+
+  const ser_img565_t *img = cur->img;
+  for (uint32_t r = 0; r < n; r++)
+  {
+    uint16_t *row = dst + (size_t)r * dst_stride;
+    if (!ser_rle565_decode_row_clip(&cur->src, img->end, row, cur->prev,
+                                    img->w, cur->x1, cur->x2))
+    {
+      return false;
+    }
+    cur->prev = row;
+    cur->y++;
+  }
+  return true;
+}
+
+bool ser_img565_decode_area(const ser_img565_t *img, uint32_t x1, uint32_t y1,
+                            uint32_t x2, uint32_t y2, uint16_t *dst,
+                            uint32_t dst_stride)
+{
+  ser_img565_cursor_t cur;
+  if (y1 > y2 || !ser_img565_seek(&cur, img, x1, x2, y1, dst))
+  {
+    return false;
+  }
+  return ser_img565_read(&cur, dst, dst_stride, y2 - y1 + 1u);
+}
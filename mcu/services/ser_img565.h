@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：压缩 RGB565 图片容器（与平台无关，主机/MCU 共用）
+ *
+ * 背景：
+ * - 图片原样放 Flash 是 w*h*2 字节；UI 图片大块纯色/上下行重复，ser_rle565 能压到很小
+ * - 但 rle565 码流只能从头顺序解：ROW 引用上一行，绘制时只露出一角也得解整张图
+ *
+ * 做法：
+ * - 每 key_rows 行强制一个“重启行”（编码时不用 ROW），并记下各重启行的码流偏移；
+ *   解 y 行只需从 y 之前最近的重启行开始，最多多解 key_rows-1 行
+ * - 列方向用 ser_rle565_decode_row_clip：ROW 只引用同一列，只保留窗口内的列即可，
+ *   窗口外的操作码只解析不写
+ * - 解码直接写到调用方给的目标（LVGL 绘制条带 / 帧缓冲 / 缓存），不需要整图中间副本
+ *
+ * 容器格式（小端）：
+ *   0   u32 magic（SER_IMG565_MAGIC）
+ *   4   u16 w, u16 h
+ *   8   u16 key_rows, u16 n_keys（= ceil(h / key_rows)）
+ *   12  u32 key_off[n_keys]   第 k*key_rows 行相对码流起点的偏移
+ *   ..  rle565 码流（逐行，见 ser_rle565.h）
+ */
+
+#define SER_IMG565_MAGIC 0x35364C52u /* "RL65" */
+#define SER_IMG565_HDR_BYTES 12u
+
+/* 默认重启间隔：裁剪解码最多多解 15 行，索引每 16 行 4 字节 */
+#ifndef SER_IMG565_KEY_ROWS
+#define SER_IMG565_KEY_ROWS 16u
+#endif
+
+typedef struct
+{
+  uint16_t w;
+  uint16_t h;
+  uint16_t key_rows;
+  uint16_t n_keys;
+  const uint8_t *index;  /* key_off[] */
+  const uint8_t *stream; /* 码流起点 */
+  const uint8_t *end;
+} ser_img565_t;
+
+/* 编码 w x h 所需的最坏容量（字节） */
+uint32_t ser_img565_bound(uint32_t w, uint32_t h, uint32_t key_rows);
+
+/*
+ * 编码 w x h RGB565（源行距 stride 像素）为容器
+ * - 返回写入字节数；参数非法或 cap 不足时返回 0
+ */
+uint32_t ser_img565_encode(const uint16_t *px, uint32_t w, uint32_t h,
+                           uint32_t stride, uint32_t key_rows, uint8_t *out,
+                           uint32_t cap);
+
+/* 解析容器头与索引；格式不对（magic/尺寸/偏移越界）时返回 false */
+bool ser_img565_open(ser_img565_t *img, const uint8_t *data, uint32_t len);
+
+/*
+ * 裁剪解码游标：按行向下解 x1..x2 列
+ * - prev 指向上一行的窗口像素（调用方缓冲内），read 之间调用方不要改动它
+ */
+typedef struct
+{
+  const ser_img565_t *img;
+  const uint8_t *src;
+  const uint16_t *prev;
+  uint16_t x1;
+  uint16_t x2;
+  uint16_t y;       /* 下一次 read 的第一行 */
+  uint16_t skipped; /* seek 为定位多解的行数 */
+} ser_img565_cursor_t;
+
+/*
+ * 定位到第 y 行、x1..x2 列（闭区间）
+ * - 从 y 之前最近的重启行解到 y-1，逐行原地写进 scratch（至少 x2-x1+1 像素）
+ * - 之后第一次 read 的 dst 可以就是 scratch
+ */
+bool ser_img565_seek(ser_img565_cursor_t *cur, const ser_img565_t *img,
+                     uint32_t x1, uint32_t x2, uint32_t y, uint16_t *scratch);
+
+/* 解接下来 n 行到 dst（行距 dst_stride 像素）；越过图片底部或码流损坏时返回 false */
+bool ser_img565_read(ser_img565_cursor_t *cur, uint16_t *dst,
+                     uint32_t dst_stride, uint32_t n);
+
+/* 解码矩形 x1..x2, y1..y2（闭区间）到 dst（行距 dst_stride 像素） */
+bool ser_img565_decode_area(const ser_img565_t *img, uint32_t x1, uint32_t y1,
+                            uint32_t x2, uint32_t y2, uint16_t *dst,
+                            uint32_t dst_stride);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
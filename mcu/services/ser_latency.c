@@ -0,0 +1,397 @@
+#include "ser_latency.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(SER_LATENCY_HOST) || !SER_LATENCY_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
+/*
+ * 直方图分桶：
+ * - 0..7us 每个值一个桶
+ * - 之后每个 2 的幂区间 [2^e, 2^(e+1)) 按高 3 位再分 8 桶
+ */
+#define LAT_SUB_BITS 3u
+#define LAT_SUB (1u << LAT_SUB_BITS)
+#define LAT_BUCKETS (LAT_SUB + (SER_LATENCY_HIST_MAX_LOG2 - LAT_SUB_BITS) * LAT_SUB)
+#define LAT_MAX_US ((1u << SER_LATENCY_HIST_MAX_LOG2) - 1u)
+
+typedef struct
+{
+  uint32_t bucket[LAT_BUCKETS];
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t sum_us;
+} lat_hist_t;
+
+typedef enum
+{
+  LAT_IDLE = 0,
+  LAT_QUEUED,  /* 输入已处理，等待刷新 */
+  LAT_IN_REFR, /* 刷新进行中 */
+} lat_state_t;
+
+static lat_hist_t s_hist[SER_LATENCY_STAGE_NUM];
+static ser_latency_stats_t s_stats;
+
+static uint32_t s_clock_hz = 0;
+static uint32_t (*s_scanout_us)(int32_t y1, int32_t y2) = NULL;
+
+/* 当前跟踪中的样本（同一时刻只跟踪一个） */
+static lat_state_t s_state = LAT_IDLE;
+static bool s_input_done = false;
+static uint32_t s_t_int;
+static uint32_t s_t_read;
+static uint32_t s_t_input;
+static uint32_t s_t_refr;
+static uint32_t s_t_flush;
+static bool s_flushed;
+static int32_t s_y1;
+static int32_t s_y2;
+
+static const char *const s_stage_name[SER_LATENCY_STAGE_NUM] = {
+    "touch", "indev", "wait", "render", "scanout", "total",
+};
+
+/* ==========================
+ * 平台相关：查询与记录互斥
+ * ========================== */
+#if defined(SER_LATENCY_HOST) && SER_LATENCY_HOST
+
+static void lat_lock(void)
+{
+}
+
+static void lat_unlock(void)
+{
+}
+
+#else
+
+/* 记录只发生在任务上下文（LVGL 任务），挂起调度器即可，不关中断 */
+static void lat_lock(void)
+{
+  vTaskSuspendAll();
+}
+
+static void lat_unlock(void)
+{
+  (void)xTaskResumeAll();
+}
+
+#endif
+
+/* ==========================
+ * 直方图
+ * ========================== */
+static uint32_t bucket_of(uint32_t us)
+{
+  if (us > LAT_MAX_US)
+  {
+    us = LAT_MAX_US;
+  }
+  if (us < LAT_SUB)
+  {
+    return us;
+  }
+
+  uint32_t e = 31u - (uint32_t)__builtin_clz(us);
+  uint32_t m = (us >> (e - LAT_SUB_BITS)) & (LAT_SUB - 1u);
+  return LAT_SUB + (e - LAT_SUB_BITS) * LAT_SUB + m;
+}
+
+/* 桶内最大值：百分位按上界报告（偏保守） */
+static uint32_t bucket_upper(uint32_t idx)
+{
+  if (idx < LAT_SUB)
+  {
+    return idx;
+  }
+
+  uint32_t e = (idx - LAT_SUB) / LAT_SUB + LAT_SUB_BITS;
+  uint32_t m = (idx - LAT_SUB) % LAT_SUB;
+  uint32_t shift = e - LAT_SUB_BITS;
+  return ((LAT_SUB + m + 1u) << shift) - 1u;
+}
+
+static void hist_add(lat_hist_t *h, uint32_t us)
+{
+  h->bucket[bucket_of(us)]++;
+  if (h->count == 0u || us < h->min_us)
+  {
+    h->min_us = us;
+  }
+  if (us > h->max_us)
+  {
+    h->max_us = us;
+  }
+  h->count++;
+  h->sum_us += us;
+}
+
+static uint32_t hist_percentile(const lat_hist_t *h, uint32_t pct)
+{
+  /* 第 ceil(count * pct / 100) 个样本所在的桶 */
+  uint32_t rank = (uint32_t)(((uint64_t)h->count * pct + 99u) / 100u);
+  if (rank == 0u)
+  {
+    rank = 1u;
+  }
+
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < LAT_BUCKETS; i++)
+  {
+    acc += h->bucket[i];
+    if (acc >= rank)
+    {
+      uint32_t v = bucket_upper(i);
+      return (v > h->max_us) ? h->max_us : v;
+    }
+  }
+  return h->max_us;
+}
+
+/* ==========================
+ * 管线
+ * ========================== */
+static uint32_t cycles_to_us(uint32_t cycles)
+{
+  if (s_clock_hz == 0u)
+  {
+    return 0u;
+  }
+  return (uint32_t)(((uint64_t)cycles * 1000000u) / s_clock_hz);
+}
+
+static bool sample_expired(uint32_t t)
+{
+  return cycles_to_us(t - s_t_int) > SER_LATENCY_TIMEOUT_MS * 1000u;
+}
+
+static void sample_commit(uint32_t scanout_us)
+{
+  uint32_t us[SER_LATENCY_STAGE_NUM];
+  us[SER_LATENCY_TOUCH] = cycles_to_us(s_t_read - s_t_int);
+  us[SER_LATENCY_INDEV] = cycles_to_us(s_t_input - s_t_read);
+  us[SER_LATENCY_WAIT] = cycles_to_us(s_t_refr - s_t_input);
+  us[SER_LATENCY_RENDER] = cycles_to_us(s_t_flush - s_t_refr);
+  us[SER_LATENCY_SCANOUT] = scanout_us;
+  us[SER_LATENCY_TOTAL] = cycles_to_us(s_t_flush - s_t_int) + scanout_us;
+
+  lat_lock();
+  for (uint32_t i = 0; i < SER_LATENCY_STAGE_NUM; i++)
+  {
+    hist_add(&s_hist[i], us[i]);
+  }
+  s_stats.samples++;
+  lat_unlock();
+}
+
+void ser_latency_init(uint32_t clock_hz,
+                      uint32_t (*scanout_us)(int32_t y1, int32_t y2))
+{
+  s_clock_hz = clock_hz;
+  s_scanout_us = scanout_us;
+  s_state = LAT_IDLE;
+  ser_latency_reset();
+}
+
+void ser_latency_input(uint32_t t_int, uint32_t t_read, bool changed)
+{
+  if (!changed)
+  {
+    return;
+  }
+
+  if (s_state != LAT_IDLE)
+  {
+    if (!sample_expired(t_read))
+    {
+      s_stats.coalesced++;
+      return;
+    }
+    s_stats.no_frame++;
+  }
+
+  s_state = LAT_QUEUED;
+  s_input_done = false;
+  s_t_int = t_int;
+  s_t_read = t_read;
+  s_t_input = t_read;
+}
+
+void ser_latency_input_done(uint32_t t)
+{
+  if (s_state == LAT_QUEUED && !s_input_done)
+  {
+    s_t_input = t;
+    s_input_done = true;
+  }
+}
+
+void ser_latency_refr_start(uint32_t t)
+{
+  /* 事件回调还没跑完的刷新不可能包含这次输入的结果 */
+  if (s_state != LAT_QUEUED || !s_input_done)
+  {
+    return;
+  }
+
+  s_state = LAT_IN_REFR;
+  s_t_refr = t;
+  s_flushed = false;
+}
+
+void ser_latency_flush(uint32_t t, int32_t y1, int32_t y2)
+{
+  if (s_state != LAT_IN_REFR)
+  {
+    return;
+  }
+
+  if (!s_flushed)
+  {
+    s_y1 = y1;
+    s_y2 = y2;
+    s_flushed = true;
+  }
+  else
+  {
+    if (y1 < s_y1)
+      s_y1 = y1;
+    if (y2 > s_y2)
+      s_y2 = y2;
+  }
+  s_t_flush = t;
+}
+
+void ser_latency_refr_ready(uint32_t t)
+{
+  if (s_state != LAT_IN_REFR)
+  {
+    return;
+  }
+
+  if (!s_flushed)
+  {
+    /* 本次刷新没有内容：继续等下一次，超时则放弃 */
+    s_state = LAT_QUEUED;
+    if (sample_expired(t))
+    {
+      s_stats.no_frame++;
+      s_state = LAT_IDLE;
+    }
+    return;
+  }
+
+  uint32_t scan = (s_scanout_us != NULL) ? s_scanout_us(s_y1, s_y2) : 0u;
+  /* 扫描位置是在 refr_ready 时读取的，补上最后一次 flush 之后经过的时间 */
+  uint32_t since_flush = cycles_to_us(t - s_t_flush);
+  sample_commit(scan + since_flush);
+  s_state = LAT_IDLE;
+}
+
+/* ==========================
+ * 查询
+ * ========================== */
+bool ser_latency_get(ser_latency_stage_t stage, ser_latency_summary_t *out)
+{
+  if (out == NULL || (uint32_t)stage >= SER_LATENCY_STAGE_NUM)
+  {
+    return false;
+  }
+
+  memset(out, 0, sizeof(*out));
+
+  lat_lock();
+  const lat_hist_t *h = &s_hist[stage];
+  if (h->count != 0u)
+  {
+    out->count = h->count;
+    out->min_us = h->min_us;
+    out->max_us = h->max_us;
+    out->mean_us = (uint32_t)(h->sum_us / h->count);
+    out->p50_us = hist_percentile(h, 50u);
+    out->p95_us = hist_percentile(h, 95u);
+    out->p99_us = hist_percentile(h, 99u);
+  }
+  lat_unlock();
+
+  return out->count != 0u;
+}
+
+void ser_latency_get_stats(ser_latency_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  lat_lock();
+  *stats = s_stats;
+  lat_unlock();
+}
+
+const char *ser_latency_stage_name(ser_latency_stage_t stage)
+{
+  if ((uint32_t)stage >= SER_LATENCY_STAGE_NUM)
+  {
+    return "?";
+  }
+  return s_stage_name[stage];
+}
+
+uint32_t ser_latency_format(char *buf, uint32_t cap)
+{
+  if (buf == NULL || cap == 0u)
+  {
+    return 0u;
+  }
+
+  uint32_t n = 0;
+  int w = snprintf(buf, cap, "%-8s %6s %7s %7s %7s %7s\n", "us", "n",
+                   "p50", "p95", "p99", "max");
+  n = (w > 0) ? (uint32_t)w : 0u;
+
+  for (uint32_t i = 0; i < SER_LATENCY_STAGE_NUM && n < cap; i++)
+  {
+    ser_latency_summary_t s;
+    (void)ser_latency_get((ser_latency_stage_t)i, &s);
+    w = snprintf(buf + n, cap - n, "%-8s %6lu %7lu %7lu %7lu %7lu\n",
+                 s_stage_name[i], (unsigned long)s.count,
+                 (unsigned long)s.p50_us, (unsigned long)s.p95_us,
+                 (unsigned long)s.p99_us, (unsigned long)s.max_us);
+    if (w <= 0)
+    {
+      break;
+    }
+    n += (uint32_t)w;
+  }
+
+  if (n < cap)
+  {
+    ser_latency_stats_t st;
+    ser_latency_get_stats(&st);
+    w = snprintf(buf + n, cap - n, "coalesced %lu, no_frame %lu\n",
+                 (unsigned long)st.coalesced, (unsigned long)st.no_frame);
+    if (w > 0)
+    {
+      n += (uint32_t)w;
+    }
+  }
+
+  /* snprintf 截断时 n 可能越过 cap，按实际写入长度返回 */
+  return (n >= cap) ? cap - 1u : n;
+}
+
+void ser_latency_reset(void)
+{
+  lat_lock();
+  memset(s_hist, 0, sizeof(s_hist));
+  memset(&s_stats, 0, sizeof(s_stats));
+  lat_unlock();
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：触摸到显示（touch-to-photon）延迟统计
+ *
+ * 管线与时间戳（均为 cycle 计数，MCU 上为 DWT CYCCNT）：
+ *   t_int    GT9xx INT 沿（dev_touch 的 EXTI 时间戳）
+ *   t_read   I2C 读回坐标（dev_touch_read_sample）
+ *   t_input  lv_indev 处理与事件回调完成（indev 读定时器返回）
+ *   t_refr   之后第一次有内容的刷新开始（LV_EVENT_REFR_START）
+ *   t_flush  该次刷新最后一块 flush ready
+ *   photon   t_flush + LTDC 扫完变化区域的估算时间
+ *
+ * 做法：
+ * - 只跟踪“状态或坐标发生变化”的输入；前一个样本还没上屏时，新输入只计数（coalesced）
+ * - 没有产生任何 flush 的刷新不结束样本；超过 SER_LATENCY_TIMEOUT_MS 仍未上屏则丢弃（no_frame）
+ * - 各段耗时按对数分桶直方图累计（每个 2 的幂分 8 桶，误差 <12.5%），可随时查询 p50/p95/p99
+ *
+ * 本模块不依赖 LVGL/HAL：时间戳与扫描估算都由调用者提供，
+ * 主机构建（SER_LATENCY_HOST=1）可直接用模拟的触摸/刷新序列驱动同一套统计
+ */
+
+#ifndef SER_LATENCY_TIMEOUT_MS
+#define SER_LATENCY_TIMEOUT_MS 500u
+#endif
+
+/* 直方图上限：2^20us ≈ 1s，更大的值计入最后一个桶 */
+#ifndef SER_LATENCY_HIST_MAX_LOG2
+#define SER_LATENCY_HIST_MAX_LOG2 20u
+#endif
+
+typedef enum
+{
+  SER_LATENCY_TOUCH = 0, /* INT 沿 -> I2C 读回 */
+  SER_LATENCY_INDEV,     /* 读回 -> indev 处理与事件回调完成 */
+  SER_LATENCY_WAIT,      /* 事件完成 -> 刷新开始 */
+  SER_LATENCY_RENDER,    /* 刷新开始 -> flush ready */
+  SER_LATENCY_SCANOUT,   /* flush ready -> 像素上屏（估算） */
+  SER_LATENCY_TOTAL,     /* INT 沿 -> 像素上屏 */
+  SER_LATENCY_STAGE_NUM,
+} ser_latency_stage_t;
+
+typedef struct
+{
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint32_t mean_us;
+  uint32_t p50_us;
+  uint32_t p95_us;
+  uint32_t p99_us;
+} ser_latency_summary_t;
+
+typedef struct
+{
+  uint32_t samples;   /* 完整上屏的样本数 */
+  uint32_t coalesced; /* 前一个样本未上屏期间到来的输入 */
+  uint32_t no_frame;  /* 超时未上屏而丢弃的样本 */
+} ser_latency_stats_t;
+
+/*
+ * clock_hz：时间戳频率
+ * scanout_us：估算 y1..y2 行上屏还需多少微秒（可为 NULL，此时按 0 计）
+ */
+void ser_latency_init(uint32_t clock_hz,
+                      uint32_t (*scanout_us)(int32_t y1, int32_t y2));
+
+/* 管线各点（单一上下文调用，通常为 LVGL 任务） */
+void ser_latency_input(uint32_t t_int, uint32_t t_read, bool changed);
+void ser_latency_input_done(uint32_t t);
+void ser_latency_refr_start(uint32_t t);
+void ser_latency_flush(uint32_t t, int32_t y1, int32_t y2);
+void ser_latency_refr_ready(uint32_t t);
+
+/* 查询（任意任务；count 为 0 时返回 false） */
+bool ser_latency_get(ser_latency_stage_t stage, ser_latency_summary_t *out);
+void ser_latency_get_stats(ser_latency_stats_t *stats);
+const char *ser_latency_stage_name(ser_latency_stage_t stage);
+
+/* 把全部阶段格式化为文本表（微秒），返回写入长度（不含结尾 0） */
+uint32_t ser_latency_format(char *buf, uint32_t cap);
+
+void ser_latency_reset(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
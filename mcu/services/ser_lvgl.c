@@ -5,6 +5,17 @@
 
 #include "dev_lcd.h"
 #include "dev_touch.h"
+#include "dri_time_us.h"
+#include "ser_boot.h"
+#include "ser_fbstream.h"
+#include "ser_lvgl_bind.h"
+#include "ser_lvgl_cmd.h"
+#include "ser_lvgl_damage.h"
+#include "ser_lvgl_img.h"
+#include "ser_lvgl_latency.h"
+#include "ser_lvgl_scroll.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_rot565.h"
 #include "ser_ultrasonic.h"
 
 /*
@@ -24,418 +35,428 @@
 #define SER_LVGL_HAS_LIB 0
 #endif
 
-#if SER_LVGL_HAS_LIB
-#include "lvgl.h"
-
-typedef struct
-{
-  lv_obj_t *bar_bg;
-  lv_obj_t *bar_fill;
-
-  /* 超声波距离显示 */
-  lv_obj_t *dist_label;
-
-  /* 动画参数缓存 */
-  uint32_t bar_pulse_ms;
-} ui_boot_t;
+#if SER_LVGL_ROTATION != 0 && SER_LVGL_ROTATION != 90 &&                      \
+    SER_LVGL_ROTATION != 180 && SER_LVGL_ROTATION != 270
+#error "SER_LVGL_ROTATION must be 0, 90, 180 or 270"
+#endif
 
-static void ui_ultrasonic_timer_cb(lv_timer_t *t);
+/* dev_lcd 的方向直接作为旋转内核参数使用 */
+_Static_assert((int)DEV_LCD_ROT_90 == (int)SER_ROT565_90 &&
+                   (int)DEV_LCD_ROT_180 == (int)SER_ROT565_180 &&
+                   (int)DEV_LCD_ROT_270 == (int)SER_ROT565_270,
+               "dev_lcd_rotation_t and ser_rot565_t must match");
 
-static void ui_set_width(void *obj, int32_t v)
+static bool rotation_from_degrees(uint16_t degrees, dev_lcd_rotation_t *rot)
 {
-  lv_obj_set_width((lv_obj_t *)obj, v);
+  switch (degrees)
+  {
+  case 0:
+    *rot = DEV_LCD_ROT_0;
+    return true;
+  case 90:
+    *rot = DEV_LCD_ROT_90;
+    return true;
+  case 180:
+    *rot = DEV_LCD_ROT_180;
+    return true;
+  case 270:
+    *rot = DEV_LCD_ROT_270;
+    return true;
+  default:
+    return false;
+  }
 }
 
-static void ui_set_bg_opa(void *obj, int32_t v)
-{
-  if (v < 0)
-    v = 0;
-  if (v > 255)
-    v = 255;
-  lv_obj_set_style_bg_opa((lv_obj_t *)obj, (lv_opa_t)v, 0);
-}
+#if SER_LVGL_HAS_LIB
+#include "lvgl.h"
+/* lv_lock / lv_unlock：lvgl.h 不包含 OS 适配层 */
+#include "src/osal/lv_os.h"
+
+static TaskHandle_t s_lvgl_task = NULL;
+static lv_display_t *s_disp = NULL;
+static bool s_direct = false;
+/* PARTIAL 条带缓冲大小（字节）；非 RGB565 帧缓冲旋转时的中间缓冲同样大小 */
+static uint32_t s_strip_size = 0;
+static void *s_strip_buf = NULL;
+static uint16_t *s_rot_buf = NULL;
+static ser_lvgl_ui_boot_t s_ui;
+static volatile bool s_ui_ready = false;
+static ser_lvgl_first_frame_cb_t s_first_frame_cb = NULL;
 
-static uint32_t ui_clamp_u32(uint32_t v, uint32_t lo, uint32_t hi)
+static void lvgl_indev_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
 {
-  if (v < lo)
-    return lo;
-  if (v > hi)
-    return hi;
-  return v;
-}
+  (void)indev;
 
-static lv_color_t ui_color_lerp(lv_color_t a, lv_color_t b, uint32_t t_0_1000)
-{
-  uint32_t t = ui_clamp_u32(t_0_1000, 0u, 1000u);
-  uint32_t ia = 1000u - t;
-  uint32_t r = (uint32_t)a.red * ia + (uint32_t)b.red * t;
-  uint32_t g = (uint32_t)a.green * ia + (uint32_t)b.green * t;
-  uint32_t bl = (uint32_t)a.blue * ia + (uint32_t)b.blue * t;
-  return lv_color_make((uint8_t)(r / 1000u), (uint8_t)(g / 1000u),
-                       (uint8_t)(bl / 1000u));
-}
+  /* 带 INT/I2C 时间戳读取，供触摸到显示的延迟统计使用 */
+  dev_touch_sample_t s;
+  (void)dev_touch_read_sample(&s);
 
-static void ui_bar_set_color(ui_boot_t *ui, uint32_t mm, bool valid)
-{
-  if (ui == NULL || ui->bar_fill == NULL)
+  data->state = s.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+  /* 防止触摸坐标超出屏幕导致“点到了但控件收不到”（逻辑坐标，已按方向换算） */
+  const uint16_t w = dev_lcd_logical_width();
+  const uint16_t h = dev_lcd_logical_height();
+  if (w == 0u || h == 0u)
   {
+    data->state = LV_INDEV_STATE_RELEASED;
+    data->point.x = 0;
+    data->point.y = 0;
     return;
   }
+  if (s.x >= w)
+    s.x = (uint16_t)(w - 1u);
+  if (s.y >= h)
+    s.y = (uint16_t)(h - 1u);
 
-  if (!valid)
-  {
-    lv_obj_set_style_bg_color(ui->bar_fill, lv_color_hex(0x56607A), 0);
-    lv_obj_set_style_bg_grad_color(ui->bar_fill, lv_color_hex(0x7A86A3), 0);
-    return;
-  }
+  data->point.x = (int32_t)s.x;
+  data->point.y = (int32_t)s.y;
 
-  /* 0mm(近)->红；4000mm(远)->蓝 */
-  const uint32_t max_mm = 4000u;
-  uint32_t t = ui_clamp_u32(mm, 0u, max_mm) * 1000u / max_mm;
-  lv_color_t near_c = lv_color_hex(0xFF4D4D);
-  lv_color_t far_c = lv_color_hex(0x3D7BFF);
-  lv_color_t c = ui_color_lerp(near_c, far_c, t);
-
-  lv_obj_set_style_bg_color(ui->bar_fill, c, 0);
-  /* 渐变色稍微偏亮，增强“流光”感 */
-  lv_color_t c2 = ui_color_lerp(c, lv_color_hex(0xFFFFFF), 220u);
-  lv_obj_set_style_bg_grad_color(ui->bar_fill, c2, 0);
+  ser_lvgl_latency_touch(&s);
 }
 
-static void ui_bar_set_width(ui_boot_t *ui, uint32_t mm, bool valid)
+/*
+ * 旋转显示：area 为逻辑坐标，*phys 返回帧缓冲中的区域
+ * - RGB565 帧缓冲：条带直接旋转写进帧缓冲
+ * - 其它格式：先旋转到中间缓冲，再经瓦片哈希/格式转换写出
+ */
+static void lvgl_flush_rotated(const lv_area_t *area, const uint16_t *px,
+                               dev_lcd_rotation_t rot, lv_area_t *phys)
 {
-  if (ui == NULL || ui->bar_bg == NULL || ui->bar_fill == NULL)
+  const uint32_t w = (uint32_t)lv_area_get_width(area);
+  const uint32_t h = (uint32_t)lv_area_get_height(area);
+  const int32_t fb_w = (int32_t)dev_lcd_width();
+  const int32_t fb_h = (int32_t)dev_lcd_height();
+
+  *phys = *area;
+  ser_rot565_map_area((ser_rot565_t)rot, fb_w, fb_h, &phys->x1, &phys->y1,
+                      &phys->x2, &phys->y2);
+  if (phys->x1 < 0 || phys->y1 < 0 || phys->x2 >= fb_w || phys->y2 >= fb_h)
   {
     return;
   }
 
-  int32_t bg_w = lv_obj_get_width(ui->bar_bg);
-  if (bg_w <= 1)
+  if (dev_lcd_is_native_rgb565())
   {
-    return;
+    uint16_t *fb = (uint16_t *)dev_lcd_framebuffer() +
+                   (uint32_t)phys->y1 * (uint32_t)fb_w + (uint32_t)phys->x1;
+    ser_rot565_rotate(fb, (uint32_t)fb_w, px, w, w, h, (ser_rot565_t)rot);
   }
-
-  uint32_t target_w = 1u;
-  if (valid)
+  else if (s_rot_buf != NULL)
   {
-    /*
-     * 更直观的“接近感”：
-     * - 越近条越满
-     * - 越远条越空
-     */
-    const uint32_t max_mm = 4000u; /* 400cm */
-    uint32_t mm_c = ui_clamp_u32(mm, 0u, max_mm);
-    uint32_t danger = max_mm - mm_c;
-    target_w = 1u + (danger * (uint32_t)(bg_w - 1)) / max_mm;
+    ser_rot565_rotate(s_rot_buf, (uint32_t)lv_area_get_width(phys), px, w, w,
+                      h, (ser_rot565_t)rot);
+    (void)ser_lvgl_damage_flush(phys, s_rot_buf);
   }
+}
 
-  uint32_t cur_w = (uint32_t)lv_obj_get_width(ui->bar_fill);
-  if (cur_w == target_w)
+static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area,
+                          uint8_t *px_map)
+{
+  /*
+   * 帧缓冲为 RGB565 且不旋转时走“帧缓冲直写”模式：
+   * - 使用 LV_DISPLAY_RENDER_MODE_DIRECT：framebuffer 直接作为 LVGL 的渲染目标
+   * - flush 回调只需要告诉 LVGL “刷新完成”
+   *
+   * 其它情况（L8/ARGB4444 等格式，或旋转显示）走 PARTIAL 模式：
+   * - LVGL 先渲染到 RGB565 条带缓冲（逻辑坐标）
+   * - 旋转时先按块旋转到帧缓冲坐标
+   * - 再由 dev_lcd 转换（L8 为调色板量化）后写入帧缓冲
+   */
+  lv_area_t phys = *area;
+  const dev_lcd_rotation_t rot = dev_lcd_get_rotation();
+  if (!s_direct && rot != DEV_LCD_ROT_0)
   {
-    return;
+    lvgl_flush_rotated(area, (const uint16_t *)px_map, rot, &phys);
+  }
+  else if (!s_direct)
+  {
+    /* 按瓦片写出，渲染结果与上次相同的瓦片跳过转换与写入 */
+    (void)ser_lvgl_damage_flush(area, (const uint16_t *)px_map);
   }
 
-  lv_anim_delete(ui->bar_fill, ui_set_width);
+  lv_display_flush_ready(disp);
+  ser_lvgl_latency_flush_ready(&phys);
+
+  /* 首帧：一次刷新的最后一块写完，回调返回 true 后不再调用 */
+  if (s_first_frame_cb != NULL && lv_display_flush_is_last(disp) &&
+      s_first_frame_cb())
+  {
+    s_first_frame_cb = NULL;
+  }
 
-  lv_anim_t a;
-  lv_anim_init(&a);
-  lv_anim_set_var(&a, ui->bar_fill);
-  lv_anim_set_exec_cb(&a, ui_set_width);
-  lv_anim_set_duration(&a, 160);
-  lv_anim_set_values(&a, (int32_t)cur_w, (int32_t)target_w);
-  lv_anim_start(&a);
+#if defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE
+  /* 远程帧缓冲流：只记脏区，编码与发送在低优先级任务里 */
+  ser_fbstream_mark(phys.x1, phys.y1, phys.x2, phys.y2);
+#endif
 }
 
-static void ui_bar_set_pulse(ui_boot_t *ui, uint32_t mm, bool valid)
+/* PARTIAL 模式下 RGB565 条带缓冲的行数（800 * 48 * 2 ≈ 75KB，放 LVGL heap） */
+#define SER_LVGL_PARTIAL_LINES 48u
+
+/*
+ * 按方向准备缓冲（按需分配，之后保留）：
+ * - RGB565 帧缓冲不旋转时用 DIRECT，不需要额外缓冲
+ * - 其它情况需要 PARTIAL 条带；非 RGB565 帧缓冲旋转时另需中间缓冲
+ */
+static bool lvgl_buffers_ensure(dev_lcd_rotation_t rot)
 {
-  if (ui == NULL || ui->bar_fill == NULL)
+  if (dev_lcd_is_native_rgb565() && rot == DEV_LCD_ROT_0)
   {
-    return;
+    return true;
   }
-
-  uint32_t pulse_ms = 1200u;
-  if (!valid)
+  if (s_strip_buf == NULL)
   {
-    pulse_ms = 1200u;
+    s_strip_buf = lv_malloc(s_strip_size);
+    if (s_strip_buf == NULL)
+    {
+      return false;
+    }
   }
-  else
+  if (rot == DEV_LCD_ROT_0 || dev_lcd_is_native_rgb565() || s_rot_buf != NULL)
   {
-    /* 越近闪烁越快：200ms~1200ms */
-    const uint32_t max_mm = 4000u;
-    uint32_t mm_c = ui_clamp_u32(mm, 0u, max_mm);
-    pulse_ms = 200u + (mm_c * 1000u) / max_mm;
+    return true;
   }
+  s_rot_buf = (uint16_t *)lv_malloc(s_strip_size);
+  return s_rot_buf != NULL;
+}
 
-  /* 变化不大就不重建动画，避免频繁重启 */
-  if (ui->bar_pulse_ms != 0u)
+/*
+ * 按方向设置渲染模式（缓冲已由 lvgl_buffers_ensure 准备好）
+ * - 在 lv_display_set_resolution 之后调用：DIRECT 按当前（面板）分辨率检查缓冲大小
+ * - DIRECT 与 PARTIAL 写的是同一块帧缓冲，切换后整屏失效重画即可
+ */
+static void lvgl_buffers_apply(lv_display_t *disp, dev_lcd_rotation_t rot)
+{
+  s_direct = dev_lcd_is_native_rgb565() && (rot == DEV_LCD_ROT_0);
+  if (s_direct)
   {
-    uint32_t diff = (ui->bar_pulse_ms > pulse_ms) ? (ui->bar_pulse_ms - pulse_ms)
-                                                  : (pulse_ms - ui->bar_pulse_ms);
-    if (diff < 80u)
-    {
-      return;
-    }
+    /*
+     * DIRECT 模式：framebuffer 直接作为 LVGL 绘制目标
+     * - buf_size 以“字节”为单位
+     */
+    void *fb = dev_lcd_framebuffer();
+    uint32_t fb_size =
+        (uint32_t)dev_lcd_width() * (uint32_t)dev_lcd_height() * 2u;
+    lv_display_set_buffers(disp, fb, NULL, fb_size,
+                           LV_DISPLAY_RENDER_MODE_DIRECT);
+  }
+  else
+  {
+    /*
+     * PARTIAL 模式：帧缓冲不是 RGB565（如 L8 省一半扫描带宽），或旋转显示
+     * - 条带缓冲从 LVGL heap（SDRAM）分配
+     */
+    lv_display_set_buffers(disp, s_strip_buf, NULL, s_strip_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
   }
-  ui->bar_pulse_ms = pulse_ms;
-
-  lv_anim_delete(ui->bar_fill, ui_set_bg_opa);
-
-  lv_anim_t a;
-  lv_anim_init(&a);
-  lv_anim_set_var(&a, ui->bar_fill);
-  lv_anim_set_exec_cb(&a, ui_set_bg_opa);
-  lv_anim_set_duration(&a, (uint32_t)pulse_ms);
-  lv_anim_set_reverse_duration(&a, (uint32_t)pulse_ms);
-  lv_anim_set_values(&a, 110, 255);
-  lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
-  lv_anim_start(&a);
 }
 
-static void ui_ultrasonic_timer_cb(lv_timer_t *t)
+bool ser_lvgl_boot_display(void *arg)
 {
-  ui_boot_t *ui = (ui_boot_t *)lv_timer_get_user_data(t);
-  if (ui == NULL || ui->dist_label == NULL)
+  (void)arg;
+
+  lv_init();
+
+  /* LVGL tick 直接读系统单调时钟（DWT 64 位扩展），不再由 SysTick 累加 */
+  lv_tick_set_cb(dri_time_now_ms);
+
+  /* 压缩图片资源（ser_img565）解码器 */
+  (void)ser_lvgl_img_init();
+
+  /*
+   * 先按 0 度建 display 并挂接瓦片脏区 / 滚动搬移（后者要求 DIRECT），
+   * 启动方向最后经 ser_lvgl_set_rotation 切换，与运行时切换同一路径
+   */
+  dev_lcd_set_rotation(DEV_LCD_ROT_0);
+
+  /* 创建并配置 display（LVGL v9 API） */
+  lv_display_t *disp = lv_display_create(dev_lcd_width(), dev_lcd_height());
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, lvgl_flush_cb);
+
+  /* PARTIAL 条带按面板长边分配，横竖屏下都是 SER_LVGL_PARTIAL_LINES 行 */
+  s_strip_size = (uint32_t)LV_MAX(dev_lcd_width(), dev_lcd_height()) *
+                 SER_LVGL_PARTIAL_LINES * 2u;
+  if (!lvgl_buffers_ensure(DEV_LCD_ROT_0))
   {
-    return;
+    return false;
   }
+  lvgl_buffers_apply(disp, DEV_LCD_ROT_0);
 
-  uint32_t mm = 0;
-  if (ser_ultrasonic_get_latest_mm(&mm))
+  /*
+   * 瓦片脏区：失效区域按瓦片对齐记位图，避免 inv_areas 溢出退化为整屏重绘
+   * - PARTIAL 模式额外启用瓦片输出哈希，内容未变的瓦片不写帧缓冲
+   */
+  if (ser_lvgl_damage_attach(disp, !dev_lcd_is_native_rgb565()))
   {
-    uint32_t cm_int = mm / 10u;
-    uint32_t cm_frac = mm % 10u;
-    lv_label_set_text_fmt(ui->dist_label, "Dist: %lu.%01lu cm",
-                          (unsigned long)cm_int, (unsigned long)cm_frac);
-
-    ui_bar_set_width(ui, mm, true);
-    ui_bar_set_color(ui, mm, true);
-    ui_bar_set_pulse(ui, mm, true);
+    /* DIRECT 模式：attach 的容器滚动时搬移已渲染像素，只渲染新露出的窄条 */
+    (void)ser_lvgl_scroll_init(disp);
   }
-  else
-  {
-    lv_label_set_text(ui->dist_label, "Dist: -- cm");
 
-    ui_bar_set_width(ui, 0u, false);
-    ui_bar_set_color(ui, 0u, false);
-    ui_bar_set_pulse(ui, 0u, false);
-  }
+  s_disp = disp;
+  return ser_lvgl_set_rotation(SER_LVGL_ROTATION);
 }
 
-static void lvgl_indev_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+bool ser_lvgl_boot_ui(void *arg)
 {
-  (void)indev;
+  (void)arg;
+  if (s_disp == NULL)
+  {
+    return false;
+  }
 
-  bool pressed = false;
-  uint16_t x = 0, y = 0;
-  (void)dev_touch_read(&pressed, &x, &y);
+  /* 启动界面（含中文字体验证） */
+  ser_lvgl_ui_boot_create(&s_ui);
 
-  data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-  /* 防止触摸坐标超出屏幕导致“点到了但控件收不到” */
-  const uint16_t w = dev_lcd_width();
-  const uint16_t h = dev_lcd_height();
-  if (w == 0u || h == 0u)
+  /* 数据绑定 / 命令队列：publish、post 后通过任务通知唤醒本任务 */
+  ser_lvgl_bind_set_consumer(s_lvgl_task);
+  ser_lvgl_cmd_set_consumer(s_lvgl_task);
+  (void)ser_lvgl_subject_add_observer(ser_ultrasonic_distance_subject(),
+                                      ser_lvgl_ui_boot_set_distance, &s_ui);
+
+  s_ui_ready = true;
+  return true;
+}
+
+bool ser_lvgl_boot_indev(void *arg)
+{
+  (void)arg;
+  if (s_disp == NULL)
   {
-    data->state = LV_INDEV_STATE_RELEASED;
-    data->point.x = 0;
-    data->point.y = 0;
-    return;
+    return false;
   }
-  if (x >= w)
-    x = (uint16_t)(w - 1u);
-  if (y >= h)
-    y = (uint16_t)(h - 1u);
 
-  data->point.x = (int32_t)x;
-  data->point.y = (int32_t)y;
+  /* 绑定触摸输入（电容屏）：dev_touch_init 已在启动图的 IO 通道完成 */
+  lv_indev_t *indev = lv_indev_create();
+  lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+  lv_indev_set_display(indev, s_disp);
+  lv_indev_set_read_cb(indev, lvgl_indev_read_cb);
+
+  /* 触摸到显示延迟统计（INT 沿 -> 事件 -> 刷新 -> flush -> 扫描上屏） */
+  (void)ser_lvgl_latency_attach(s_disp, indev);
+  return true;
 }
 
-static void ui_boot_screen_create(ui_boot_t *ui)
+void ser_lvgl_set_first_frame_cb(ser_lvgl_first_frame_cb_t cb)
 {
-  /* ===== 背景 ===== */
-  lv_obj_t *scr = lv_screen_active();
-  lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
-
-  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
-  lv_obj_set_style_bg_color(scr, lv_color_hex(0x0B1020), 0);
-  lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x121A33), 0);
-  lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
-
-  /* ===== 中央卡片 ===== */
-  int32_t card_w = (int32_t)dev_lcd_width() * 72 / 100;
-  int32_t card_h = (int32_t)dev_lcd_height() * 58 / 100;
-  if (card_w > 520)
-    card_w = 520;
-  if (card_h > 320)
-    card_h = 320;
-
-  lv_obj_t *card = lv_obj_create(scr);
-  lv_obj_set_size(card, card_w, card_h);
-  lv_obj_center(card);
-  lv_obj_remove_flag(card, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_set_style_radius(card, 22, 0);
-  lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
-  lv_obj_set_style_bg_color(card, lv_color_hex(0x16213E), 0);
-  lv_obj_set_style_bg_grad_color(card, lv_color_hex(0x1E2B52), 0);
-  lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_VER, 0);
-  lv_obj_set_style_border_width(card, 1, 0);
-  lv_obj_set_style_border_color(card, lv_color_hex(0x2B3A67), 0);
-  lv_obj_set_style_shadow_width(card, 24, 0);
-  lv_obj_set_style_shadow_opa(card, LV_OPA_30, 0);
-  lv_obj_set_style_shadow_color(card, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_pad_all(card, 24, 0);
-  lv_obj_set_style_pad_row(card, 10, 0);
-
-  /* ===== Logo（简易圆形徽章） ===== */
-  lv_obj_t *badge = lv_obj_create(card);
-  lv_obj_set_size(badge, 64, 64);
-  lv_obj_set_style_radius(badge, 32, 0);
-  lv_obj_set_style_bg_opa(badge, LV_OPA_COVER, 0);
-  lv_obj_set_style_bg_color(badge, lv_color_hex(0x3D7BFF), 0);
-  lv_obj_set_style_bg_grad_color(badge, lv_color_hex(0x67D7FF), 0);
-  /* LVGL v9.4.0 不支持对角渐变方向，使用径向渐变来增强“徽章”质感 */
-  lv_obj_set_style_bg_grad_dir(badge, LV_GRAD_DIR_RADIAL, 0);
-  lv_obj_set_style_border_width(badge, 0, 0);
-  lv_obj_set_style_shadow_width(badge, 18, 0);
-  /* v9 中透明度常量以 5/10/20/30... 为主，这里选一个相近值 */
-  lv_obj_set_style_shadow_opa(badge, LV_OPA_30, 0);
-  lv_obj_set_style_shadow_color(badge, lv_color_hex(0x3D7BFF), 0);
-  lv_obj_align(badge, LV_ALIGN_TOP_MID, 0, 0);
-
-  /* ===== 标题 ===== */
-  lv_obj_t *title = lv_label_create(card);
-  /* 这里用到的汉字确保已在内置字体中包含（例如：歡/迎/使/用）。 */
-  lv_label_set_text(title, "歡迎使用");
-  lv_obj_set_style_text_color(title, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_letter_space(title, 2, 0);
-  lv_obj_align_to(title, badge, LV_ALIGN_OUT_BOTTOM_MID, 0, 12);
-
-  /* ===== 副标题（包含中文与版本） ===== */
-  lv_obj_t *sub = lv_label_create(card);
-  /* 避免使用字体里可能不存在的符号（如 '·'），分隔符用 ASCII '|' 更稳妥。 */
-  lv_label_set_text(sub, "STM32F429 | LVGL 9.4.0 | 中文可用");
-  lv_obj_set_style_text_color(sub, lv_color_hex(0xB8C7FF), 0);
-  lv_obj_set_style_text_opa(sub, LV_OPA_90, 0);
-  lv_obj_set_style_text_letter_space(sub, 1, 0);
-  lv_obj_align_to(sub, title, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
-
-  /* ===== 超声波距离显示 ===== */
-  ui->dist_label = lv_label_create(card);
-  lv_label_set_text(ui->dist_label, "Dist: -- cm");
-  lv_obj_set_style_text_color(ui->dist_label, lv_color_hex(0xE6EEFF), 0);
-  lv_obj_set_style_text_opa(ui->dist_label, LV_OPA_90, 0);
-  lv_obj_set_style_text_letter_space(ui->dist_label, 1, 0);
-  lv_obj_align_to(ui->dist_label, sub, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
-
-  /* ===== 进度条（纯 lv_obj 实现） ===== */
-  ui->bar_bg = lv_obj_create(card);
-  lv_obj_set_height(ui->bar_bg, 12);
-  lv_obj_set_width(ui->bar_bg, card_w - 48);
-  lv_obj_set_style_radius(ui->bar_bg, 6, 0);
-  lv_obj_set_style_bg_opa(ui->bar_bg, LV_OPA_30, 0);
-  lv_obj_set_style_bg_color(ui->bar_bg, lv_color_hex(0x0A1024), 0);
-  lv_obj_set_style_border_width(ui->bar_bg, 0, 0);
-  lv_obj_align(ui->bar_bg, LV_ALIGN_BOTTOM_MID, 0, 0);
-
-  ui->bar_fill = lv_obj_create(ui->bar_bg);
-  lv_obj_set_height(ui->bar_fill, 12);
-  lv_obj_set_width(ui->bar_fill, 1);
-  lv_obj_set_style_radius(ui->bar_fill, 6, 0);
-  lv_obj_set_style_bg_opa(ui->bar_fill, LV_OPA_COVER, 0);
-  lv_obj_set_style_bg_color(ui->bar_fill, lv_color_hex(0x3D7BFF), 0);
-  lv_obj_set_style_bg_grad_color(ui->bar_fill, lv_color_hex(0x67D7FF), 0);
-  lv_obj_set_style_bg_grad_dir(ui->bar_fill, LV_GRAD_DIR_HOR, 0);
-  lv_obj_set_style_border_width(ui->bar_fill, 0, 0);
-  lv_obj_align(ui->bar_fill, LV_ALIGN_LEFT_MID, 0, 0);
-
-  /* 初始：等数据时显示最小值 + 慢速呼吸 */
-  ui->bar_pulse_ms = 0u;
-  ui_bar_set_width(ui, 0u, false);
-  ui_bar_set_color(ui, 0u, false);
-  ui_bar_set_pulse(ui, 0u, false);
+  s_first_frame_cb = cb;
 }
 
-static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area,
-                          uint8_t *px_map)
+bool ser_lvgl_set_rotation(uint16_t degrees)
 {
-  (void)area;
-  (void)px_map;
+  dev_lcd_rotation_t rot;
+  if (s_disp == NULL || !rotation_from_degrees(degrees, &rot))
+  {
+    return false;
+  }
+  if (rot == dev_lcd_get_rotation())
+  {
+    return true;
+  }
+  if (!lvgl_buffers_ensure(rot))
+  {
+    return false;
+  }
 
   /*
-   * 当前先走“帧缓冲直写”模式：
-   * - 使用 LV_DISPLAY_RENDER_MODE_DIRECT：framebuffer 直接作为 LVGL 的渲染目标
-   * - flush 回调只需要告诉 LVGL “刷新完成”
-   *
-   * 后续你若需要提升性能，可改为：
-   * - 双缓冲 + DMA2D（拷贝/混合加速）
-   * - 或者 PARTIAL 模式做区域刷新
+   * 触摸换算与 flush 都读 dev_lcd 的方向，二者在本任务内同步切换；
+   * RGB565 帧缓冲在 0 度（DIRECT）与旋转（PARTIAL）之间切换渲染模式，
+   * 旋转期间滚动搬移退回整块重绘；
+   * 0 <-> 180 分辨率不变，lv_display_set_resolution 不会失效，另行整屏失效
    */
-  lv_display_flush_ready(disp);
+  dev_lcd_set_rotation(rot);
+  lv_display_set_resolution(s_disp, dev_lcd_logical_width(),
+                            dev_lcd_logical_height());
+  lvgl_buffers_apply(s_disp, rot);
+  lv_obj_invalidate(lv_display_get_layer_sys(s_disp));
+  return true;
 }
 
-static void lvgl_task(void *argument)
+void ser_lvgl_task(void *argument)
 {
   (void)argument;
 
-  lv_init();
-
-  /* 创建并配置 display（LVGL v9 API） */
-  lv_display_t *disp = lv_display_create(dev_lcd_width(), dev_lcd_height());
-  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
-  lv_display_set_flush_cb(disp, lvgl_flush_cb);
-
-  /*
-   * DIRECT 模式：framebuffer 直接作为 LVGL 绘制目标
-   * - buf_size 以“字节”为单位
-   */
-  void *fb = dev_lcd_framebuffer();
-  uint32_t fb_size =
-      (uint32_t)dev_lcd_width() * (uint32_t)dev_lcd_height() * 2u;
-  lv_display_set_buffers(disp, fb, NULL, fb_size,
-                         LV_DISPLAY_RENDER_MODE_DIRECT);
-
-  /* 绑定触摸输入（电容屏） */
-  (void)dev_touch_init();
-  lv_indev_t *indev = lv_indev_create();
-  lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
-  lv_indev_set_display(indev, disp);
-  lv_indev_set_read_cb(indev, lvgl_indev_read_cb);
-
-  /* 启动界面（含中文字体验证） */
-  ui_boot_t ui = {0};
-  ui_boot_screen_create(&ui);
-  (void)lv_timer_create(ui_ultrasonic_timer_cb, 200, &ui);
+  /* subject 发布时通知本任务（ser_lvgl_boot_ui 里登记） */
+  s_lvgl_task = xTaskGetCurrentTaskHandle();
 
+  bool boot_done = false;
   for (;;)
   {
     /*
-     * LVGL 轮询处理：
-     * - 默认推荐 5~10ms 调一次
-     * - 这里用 vTaskDelay 实现，后续你也可以换成更精确的定时器/notify 机制
+     * 启动图中属于本任务的步骤（display / ui / indev）非阻塞推进：
+     * - 界面建好就开始刷新，首帧不等触摸探测
+     * - 触摸就绪后的下一轮再挂输入设备
      */
-    lv_timer_handler();
-    vTaskDelay(pdMS_TO_TICKS(5));
+    if (!boot_done)
+    {
+      boot_done = ser_boot_run(SER_BOOT_LANE_LVGL, 0u);
+    }
+
+    TickType_t wait = pdMS_TO_TICKS(SER_LVGL_IDLE_MAX_MS);
+    if (s_ui_ready)
+    {
+      /*
+       * subject 分发与一批 UI 命令：其它任务可能同时 lv_lock() 操作控件，
+       * 这里同样在锁内执行（lv_timer_handler 自己持锁）
+       */
+      lv_lock();
+      (void)ser_lvgl_bind_process();
+      (void)ser_lvgl_cmd_drain(SER_LVGL_CMD_BATCH);
+      lv_unlock();
+
+      /*
+       * 返回值为距下一个 LVGL 定时器的时间：
+       * - 命令没执行完不睡眠，下一轮接着执行
+       * - 否则睡到下一个定时器（至多 SER_LVGL_IDLE_MAX_MS），
+       *   期间 publish / post 的任务通知会立即唤醒
+       */
+      uint32_t next_ms = lv_timer_handler();
+      if (ser_lvgl_cmd_pending())
+      {
+        wait = 0;
+      }
+      else if (next_ms < SER_LVGL_IDLE_MAX_MS)
+      {
+        wait = pdMS_TO_TICKS(next_ms);
+      }
+    }
+    (void)ulTaskNotifyTake(pdTRUE, wait);
   }
 }
 
-void ser_lvgl_start(void)
+#else /* SER_LVGL_HAS_LIB == 0 */
+
+void ser_lvgl_task(void *argument)
 {
-  (void)xTaskCreate(lvgl_task, "lvgl", 4096, NULL, tskIDLE_PRIORITY + 2, NULL);
+  /* LVGL 未集成时只把启动图 LVGL 通道（空步骤）走完，便于你分阶段移植 */
+  (void)argument;
+  (void)ser_boot_run(SER_BOOT_LANE_LVGL, SER_BOOT_WAIT_FOREVER);
+  vTaskDelete(NULL);
 }
 
-void ser_lvgl_tick_inc_isr(uint32_t ms)
+bool ser_lvgl_boot_display(void *arg)
 {
-  /*
-   * SysTick_Handler 里调用该函数即可：
-   * - 本工程 tick 频率为 1000Hz（1ms）
-   * - ms 参数通常传 1
-   */
-  lv_tick_inc(ms);
+  (void)arg;
+  return true;
 }
 
-#else /* SER_LVGL_HAS_LIB == 0 */
+bool ser_lvgl_boot_ui(void *arg)
+{
+  (void)arg;
+  return true;
+}
 
-void ser_lvgl_start(void) { /* LVGL 未集成时保持空实现，便于你分阶段移植 */ }
+bool ser_lvgl_boot_indev(void *arg)
+{
+  (void)arg;
+  return true;
+}
+
+void ser_lvgl_set_first_frame_cb(ser_lvgl_first_frame_cb_t cb) { (void)cb; }
 
-void ser_lvgl_tick_inc_isr(uint32_t ms) { (void)ms; }
+bool ser_lvgl_set_rotation(uint16_t degrees)
+{
+  dev_lcd_rotation_t rot;
+  return rotation_from_degrees(degrees, &rot) && rot == DEV_LCD_ROT_0;
+}
 
 #endif
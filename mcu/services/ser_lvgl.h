@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -18,11 +19,52 @@ extern "C"
  * - app -> services(ser_lvgl) -> drivers(dri_lcd_*)
  */
 
-/* 创建 LVGL 任务（若 LVGL 未集成则为空实现） */
-void ser_lvgl_start(void);
+/*
+ * LVGL 任务入口（由 app 任务表静态创建）
+ * - 推进启动图 LVGL 通道，界面就绪后每轮：lv_lock 内分发 subject、执行一批 UI 命令
+ *   （ser_lvgl_cmd），再调用 lv_timer_handler
+ * - 两轮之间睡到下一个 LVGL 定时器（至多 SER_LVGL_IDLE_MAX_MS），
+ *   subject publish / 命令 post 的任务通知会立即唤醒
+ * - LVGL 未集成时只推进启动图（步骤均为空实现）后退出
+ */
+#ifndef SER_LVGL_IDLE_MAX_MS
+#define SER_LVGL_IDLE_MAX_MS 5u
+#endif
+#ifndef SER_LVGL_TASK_STACK
+#define SER_LVGL_TASK_STACK 4096u
+#endif
+void ser_lvgl_task(void *argument);
+
+/*
+ * 启动图步骤（ser_boot，LVGL 通道，在 LVGL 任务内执行）：
+ * - display：lv_init + display/缓冲 + 瓦片脏区
+ * - ui：创建启动界面并绑定 subject（依赖超声波服务的 subject 已初始化）
+ * - indev：挂触摸输入与延迟统计（依赖 dev_touch_init 完成）
+ * ui 完成前 LVGL 任务不调用 lv_timer_handler，首帧即完整界面
+ */
+bool ser_lvgl_boot_display(void *arg);
+bool ser_lvgl_boot_ui(void *arg);
+bool ser_lvgl_boot_indev(void *arg);
+
+/*
+ * 显示方向（顺时针角度：0/90/180/270，90/270 为竖屏 480x800）
+ * - SER_LVGL_ROTATION 为启动方向；LVGL 只看到旋转后的逻辑分辨率，
+ *   flush 时把渲染好的条带按块旋转（ser_rot565）后写入帧缓冲，
+ *   触摸坐标由 dev_touch 按同一方向换算
+ * - 帧缓冲为 RGB565 且方向为 0 时使用 DIRECT 模式（滚动搬移依赖它），
+ *   旋转时切到 PARTIAL 条带（首次旋转时从 LVGL heap 分配），回到 0 度再切回 DIRECT；
+ *   旋转期间滚动搬移退回整块重绘
+ * - ser_lvgl_set_rotation 只能在 LVGL 上下文调用（持有 lv_lock，或经 ser_lvgl_cmd）；
+ *   角度非法或缓冲分配失败时返回 false（方向不变）
+ */
+#ifndef SER_LVGL_ROTATION
+#define SER_LVGL_ROTATION 0
+#endif
+bool ser_lvgl_set_rotation(uint16_t degrees);
 
-/* 给 SysTick/RTOS tick 调用：每 ms 调一次即可（若 LVGL 未集成则为空实现） */
-void ser_lvgl_tick_inc_isr(uint32_t ms);
+/* 每次完整刷新的最后一块 flush 后调用，返回 true 后不再调用（LVGL 任务上下文） */
+typedef bool (*ser_lvgl_first_frame_cb_t)(void);
+void ser_lvgl_set_first_frame_cb(ser_lvgl_first_frame_cb_t cb);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,405 @@
+#include "ser_lvgl_anim.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+static ser_lvgl_anim_stats_t s_stats;
+
+void ser_lvgl_anim_get_stats(ser_lvgl_anim_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_lvgl_anim_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#if SER_LVGL_HAS_LIB
+
+/* 查找表：ANIM_LUT_N 段，Q10（1024 = 终值），进度为 Q16 */
+#define ANIM_LUT_SHIFT 8u
+#define ANIM_LUT_N (1u << ANIM_LUT_SHIFT)
+#define ANIM_P_ONE 65536u
+
+/*
+ * 每个动画的字段（SoA，下标相同即同一个动画）：
+ * - t0：本轮播放开始时刻（含首次延时）
+ * - step/rstep：每毫秒的进度增量（Q24），正向/回放
+ * - last：最近一次写入的值
+ * - repeat：剩余播放次数（含本轮）
+ */
+#define ANIM_FIELDS(X)                                                         \
+  X(lv_obj_t *, obj)                                                           \
+  X(uint32_t, t0)                                                              \
+  X(uint32_t, step)                                                            \
+  X(uint32_t, rstep)                                                           \
+  X(int32_t, from)                                                             \
+  X(int32_t, delta)                                                            \
+  X(int32_t, last)                                                             \
+  X(uint16_t, dur)                                                             \
+  X(uint16_t, rev)                                                             \
+  X(uint16_t, repeat)                                                          \
+  X(uint8_t, prop)                                                             \
+  X(uint8_t, path)
+
+#define ANIM_DECL(type, name) static type s_##name[SER_LVGL_ANIM_MAX];
+ANIM_FIELDS(ANIM_DECL)
+#undef ANIM_DECL
+
+static uint32_t s_n = 0;
+static lv_timer_t *s_timer = NULL;
+static int16_t s_lut[SER_LVGL_ANIM_PATH_COUNT][ANIM_LUT_N + 1u];
+
+/*
+ * 属性表：
+ * - rank 决定一帧内多个属性变化时用哪个做那一次 lv_obj_refresh_style：
+ *   2 = 影响自身与父对象布局（translate），1 = 影响布局，0 = 只需重绘
+ */
+typedef struct
+{
+  lv_style_prop_t style;
+  uint8_t rank;
+  bool opa;
+} anim_prop_info_t;
+
+static const anim_prop_info_t s_props[SER_LVGL_ANIM_PROP_COUNT] = {
+    [SER_LVGL_ANIM_X] = {LV_STYLE_X, 1u, false},
+    [SER_LVGL_ANIM_Y] = {LV_STYLE_Y, 1u, false},
+    [SER_LVGL_ANIM_WIDTH] = {LV_STYLE_WIDTH, 1u, false},
+    [SER_LVGL_ANIM_HEIGHT] = {LV_STYLE_HEIGHT, 1u, false},
+    [SER_LVGL_ANIM_TRANSLATE_X] = {LV_STYLE_TRANSLATE_X, 2u, false},
+    [SER_LVGL_ANIM_TRANSLATE_Y] = {LV_STYLE_TRANSLATE_Y, 2u, false},
+    [SER_LVGL_ANIM_OPA] = {LV_STYLE_OPA, 0u, true},
+    [SER_LVGL_ANIM_BG_OPA] = {LV_STYLE_BG_OPA, 0u, true},
+};
+
+/* 与 lv_anim_path_* 相同的贝塞尔控制点（Q10） */
+static const int16_t s_bezier[SER_LVGL_ANIM_PATH_COUNT][4] = {
+    [SER_LVGL_ANIM_PATH_LINEAR] = {0, 0, 1024, 1024},
+    [SER_LVGL_ANIM_PATH_EASE_IN] = {430, 0, 1024, 1024},
+    [SER_LVGL_ANIM_PATH_EASE_OUT] = {0, 0, 593, 1024},
+    [SER_LVGL_ANIM_PATH_EASE_IN_OUT] = {430, 0, 593, 1024},
+    [SER_LVGL_ANIM_PATH_OVERSHOOT] = {341, 0, 683, 1300},
+};
+
+static void anim_timer_cb(lv_timer_t *t);
+
+static bool anim_init(void)
+{
+  if (s_timer != NULL)
+  {
+    return true;
+  }
+
+  for (uint32_t p = 0; p < SER_LVGL_ANIM_PATH_COUNT; p++)
+  {
+    const int16_t *c = s_bezier[p];
+    for (uint32_t i = 0; i <= ANIM_LUT_N; i++)
+    {
+      const int32_t x = (int32_t)((i * LV_BEZIER_VAL_MAX) >> ANIM_LUT_SHIFT);
+      s_lut[p][i] = (p == SER_LVGL_ANIM_PATH_LINEAR)
+                        ? (int16_t)x
+                        : (int16_t)lv_cubic_bezier(x, c[0], c[1], c[2], c[3]);
+    }
+  }
+
+  s_timer = lv_timer_create(anim_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+  if (s_timer == NULL)
+  {
+    return false;
+  }
+  lv_timer_pause(s_timer);
+  return true;
+}
+
+/* 进度（Q16）-> 路径值（Q10）：查表 + 线性插值 */
+static inline int32_t path_eval(uint8_t path, uint32_t p16)
+{
+  if (p16 >= ANIM_P_ONE)
+  {
+    return s_lut[path][ANIM_LUT_N];
+  }
+  const int16_t *l = &s_lut[path][p16 >> (16u - ANIM_LUT_SHIFT)];
+  const int32_t frac = (int32_t)(p16 & ((1u << (16u - ANIM_LUT_SHIFT)) - 1u));
+  return l[0] + ((((int32_t)l[1] - l[0]) * frac) >> (16u - ANIM_LUT_SHIFT));
+}
+
+static void anim_move(uint32_t dst, uint32_t src)
+{
+#define ANIM_MOVE(type, name) s_##name[dst] = s_##name[src];
+  ANIM_FIELDS(ANIM_MOVE)
+#undef ANIM_MOVE
+}
+
+static void anim_open_slot(uint32_t at)
+{
+#define ANIM_SHIFT(type, name)                                                 \
+  memmove(&s_##name[at + 1u], &s_##name[at], (s_n - at) * sizeof(type));
+  ANIM_FIELDS(ANIM_SHIFT)
+#undef ANIM_SHIFT
+  s_n++;
+}
+
+static void prop_write(lv_obj_t *obj, uint8_t prop, int32_t v)
+{
+  if (s_props[prop].opa)
+  {
+    v = LV_CLAMP(0, v, 255);
+  }
+  lv_style_value_t sv = {.num = v};
+  lv_obj_set_local_style_prop(obj, s_props[prop].style, sv, LV_PART_MAIN);
+}
+
+static void anim_delete_cb(lv_event_t *e);
+
+/* 删除 obj 上 prop（PROP_COUNT 为全部）的动画；保持其余动画的相对顺序 */
+static void anim_remove(lv_obj_t *obj, uint32_t prop, bool detach)
+{
+  uint32_t w = 0;
+  bool left = false;
+  for (uint32_t i = 0; i < s_n; i++)
+  {
+    if (s_obj[i] == obj &&
+        (prop == SER_LVGL_ANIM_PROP_COUNT || s_prop[i] == prop))
+    {
+      continue;
+    }
+    left |= (s_obj[i] == obj);
+    if (w != i)
+    {
+      anim_move(w, i);
+    }
+    w++;
+  }
+  s_n = w;
+
+  if (detach && !left)
+  {
+    (void)lv_obj_remove_event_cb(obj, anim_delete_cb);
+  }
+}
+
+static void anim_delete_cb(lv_event_t *e)
+{
+  /* 对象已在删除中，不再摘回调 */
+  anim_remove((lv_obj_t *)lv_event_get_target(e), SER_LVGL_ANIM_PROP_COUNT,
+              false);
+}
+
+/*
+ * 计算下标 i 在 now 时刻的值
+ * - 返回 false：还在首次延时中
+ * - *done：全部播放结束（值为最终值）
+ */
+static bool anim_value(uint32_t i, uint32_t now, int32_t *v, bool *done)
+{
+  const int32_t e = (int32_t)(now - s_t0[i]);
+  if (e < 0)
+  {
+    return false;
+  }
+
+  const uint32_t cycle = (uint32_t)s_dur[i] + s_rev[i];
+  *done = false;
+  if ((uint32_t)e >= cycle)
+  {
+    /* 与 lv_anim 相同：跨轮的这一帧停在本轮终值，下一帧再按新一轮取值 */
+    const uint32_t k = (uint32_t)e / cycle;
+    *v = (s_rev[i] != 0u) ? s_from[i] : s_from[i] + s_delta[i];
+    if (s_repeat[i] != SER_LVGL_ANIM_REPEAT_INFINITE && k >= s_repeat[i])
+    {
+      *done = true;
+      return true;
+    }
+    if (s_repeat[i] != SER_LVGL_ANIM_REPEAT_INFINITE)
+    {
+      s_repeat[i] = (uint16_t)(s_repeat[i] - k);
+    }
+    /* 新一轮从整轮边界算起，不累积帧间误差 */
+    s_t0[i] += k * cycle;
+    return true;
+  }
+
+  /* 与 lv_anim_path_cubic_bezier 相同：start + (path * diff) >> 10；回放段起止互换 */
+  if ((uint32_t)e < s_dur[i])
+  {
+    const int32_t y = path_eval(s_path[i], ((uint32_t)e * s_step[i]) >> 8);
+    *v = s_from[i] + ((y * s_delta[i]) >> LV_BEZIER_VAL_SHIFT);
+  }
+  else
+  {
+    const uint32_t r = (uint32_t)e - s_dur[i];
+    const int32_t y = path_eval(s_path[i], (r * s_rstep[i]) >> 8);
+    *v = s_from[i] + s_delta[i] + ((y * -s_delta[i]) >> LV_BEZIER_VAL_SHIFT);
+  }
+  return true;
+}
+
+static void anim_timer_cb(lv_timer_t *t)
+{
+  (void)t;
+  const uint32_t now = lv_tick_get();
+  uint32_t w = 0;
+  uint32_t i = 0;
+
+  if (s_n != 0u)
+  {
+    s_stats.frames++;
+  }
+
+  while (i < s_n)
+  {
+    /* 一个对象的动画相邻：本组写完后只刷新一次样式 */
+    lv_obj_t *obj = s_obj[i];
+    int32_t rank = -1;
+    lv_style_prop_t refresh = LV_STYLE_PROP_INV;
+    bool left = false;
+
+    lv_obj_enable_style_refresh(false);
+    for (; i < s_n && s_obj[i] == obj; i++)
+    {
+      int32_t v;
+      bool done = false;
+      if (anim_value(i, now, &v, &done))
+      {
+        s_stats.steps++;
+        if (v != s_last[i])
+        {
+          prop_write(obj, s_prop[i], v);
+          s_last[i] = v;
+          s_stats.writes++;
+          if ((int32_t)s_props[s_prop[i]].rank > rank)
+          {
+            rank = (int32_t)s_props[s_prop[i]].rank;
+            refresh = s_props[s_prop[i]].style;
+          }
+        }
+      }
+      if (done)
+      {
+        continue;
+      }
+      if (w != i)
+      {
+        anim_move(w, i);
+      }
+      w++;
+      left = true;
+    }
+    lv_obj_enable_style_refresh(true);
+
+    if (rank >= 0)
+    {
+      lv_obj_refresh_style(obj, LV_PART_MAIN, refresh);
+      s_stats.refreshes++;
+    }
+    if (!left)
+    {
+      (void)lv_obj_remove_event_cb(obj, anim_delete_cb);
+    }
+  }
+  s_n = w;
+
+  if (s_n == 0u)
+  {
+    lv_timer_pause(s_timer);
+  }
+}
+
+bool ser_lvgl_anim_start(const ser_lvgl_anim_cfg_t *cfg)
+{
+  if (cfg == NULL || cfg->obj == NULL ||
+      (uint32_t)cfg->prop >= SER_LVGL_ANIM_PROP_COUNT ||
+      (uint32_t)cfg->path >= SER_LVGL_ANIM_PATH_COUNT || !anim_init())
+  {
+    return false;
+  }
+
+  /* 同对象同属性：原位替换；否则插到该对象的动画组末尾（没有则追加） */
+  uint32_t at = s_n;
+  bool found = false;
+  bool grouped = false;
+  for (uint32_t i = 0; i < s_n; i++)
+  {
+    if (s_obj[i] != cfg->obj)
+    {
+      continue;
+    }
+    grouped = true;
+    at = i + 1u;
+    if (s_prop[i] == (uint8_t)cfg->prop)
+    {
+      at = i;
+      found = true;
+      break;
+    }
+  }
+
+  if (!found)
+  {
+    if (s_n >= SER_LVGL_ANIM_MAX)
+    {
+      s_stats.full++;
+      return false;
+    }
+    if (!grouped)
+    {
+      lv_obj_add_event_cb(cfg->obj, anim_delete_cb, LV_EVENT_DELETE, NULL);
+    }
+    anim_open_slot(at);
+  }
+
+  const uint16_t dur = (cfg->duration_ms != 0u) ? cfg->duration_ms : 1u;
+  s_obj[at] = cfg->obj;
+  s_prop[at] = (uint8_t)cfg->prop;
+  s_path[at] = (uint8_t)cfg->path;
+  s_from[at] = cfg->from;
+  s_delta[at] = cfg->to - cfg->from;
+  s_last[at] = cfg->from;
+  s_dur[at] = dur;
+  s_rev[at] = cfg->reverse_ms;
+  s_step[at] = (1u << 24) / dur;
+  s_rstep[at] = (cfg->reverse_ms != 0u) ? (1u << 24) / cfg->reverse_ms : 0u;
+  s_repeat[at] = (cfg->repeat != 0u) ? cfg->repeat : 1u;
+  s_t0[at] = lv_tick_get() + cfg->delay_ms;
+
+  if (s_n > s_stats.active_max)
+  {
+    s_stats.active_max = s_n;
+  }
+
+  /* 与 lv_anim 的 early_apply 相同：立即应用起始值 */
+  prop_write(cfg->obj, s_prop[at], cfg->from);
+  lv_timer_resume(s_timer);
+  return true;
+}
+
+void ser_lvgl_anim_stop(lv_obj_t *obj, ser_lvgl_anim_prop_t prop)
+{
+  if (obj == NULL || (uint32_t)prop > SER_LVGL_ANIM_PROP_COUNT)
+  {
+    return;
+  }
+  anim_remove(obj, (uint32_t)prop, true);
+}
+
+uint32_t ser_lvgl_anim_count(void)
+{
+  return s_n;
+}
+
+#endif
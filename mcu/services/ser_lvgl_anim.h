@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：批量动画（样式属性动画的轻量后端，替代逐个 lv_anim_t）
+ *
+ * 背景：
+ * - LVGL 的 anim_timer 每帧遍历 lv_anim_t 链表，每个动画各自计算一次
+ *   lv_anim_path_cubic_bezier（定点迭代求解）并调用 exec_cb
+ * - exec_cb（lv_obj_set_width、lv_obj_set_style_bg_opa ...）每次都完整走一遍
+ *   lv_obj_refresh_style：同一对象的两个动画每帧就是两次样式刷新、四次失效
+ *
+ * 做法：
+ * - 活动动画按字段分开存放在定长数组里（SoA），同一对象的动画相邻；
+ *   每帧一个定时器顺序扫一遍，结束的动画原地压缩掉
+ * - 路径曲线在首次使用时按 LVGL 同样的贝塞尔控制点采样成 257 点定点查找表
+ *   （Q10，与 lv_anim 的 1024 = 1.0 相同），每帧只做查表 + 线性插值
+ * - 同一对象本帧所有变化的属性写入本地样式时关闭样式刷新，
+ *   写完后只调用一次 lv_obj_refresh_style（取其中影响最大的属性），
+ *   值没变的属性不写
+ *
+ * 语义与 lv_anim 对齐：启动时立即应用起始值；回放段从终值按同一路径回到起始值；
+ * 跨过一轮播放的那一帧停在本轮终值；同一对象同一属性再次 start 时替换原动画。
+ * 不要与 lv_anim 同时驱动同一属性。
+ *
+ * 只能在 LVGL 上下文调用。
+ */
+
+/* 同时活动的动画数 */
+#ifndef SER_LVGL_ANIM_MAX
+#define SER_LVGL_ANIM_MAX 32u
+#endif
+
+#define SER_LVGL_ANIM_REPEAT_INFINITE 0xFFFFu
+
+/* 可动画的属性（LV_PART_MAIN 本地样式） */
+typedef enum
+{
+  SER_LVGL_ANIM_X = 0,
+  SER_LVGL_ANIM_Y,
+  SER_LVGL_ANIM_WIDTH,
+  SER_LVGL_ANIM_HEIGHT,
+  SER_LVGL_ANIM_TRANSLATE_X,
+  SER_LVGL_ANIM_TRANSLATE_Y,
+  SER_LVGL_ANIM_OPA,    /* 0..255，越界夹紧 */
+  SER_LVGL_ANIM_BG_OPA, /* 0..255，越界夹紧 */
+  SER_LVGL_ANIM_PROP_COUNT,
+} ser_lvgl_anim_prop_t;
+
+/* 路径：与 lv_anim_path_linear / ease_in / ease_out / ease_in_out / overshoot 相同 */
+typedef enum
+{
+  SER_LVGL_ANIM_PATH_LINEAR = 0,
+  SER_LVGL_ANIM_PATH_EASE_IN,
+  SER_LVGL_ANIM_PATH_EASE_OUT,
+  SER_LVGL_ANIM_PATH_EASE_IN_OUT,
+  SER_LVGL_ANIM_PATH_OVERSHOOT,
+  SER_LVGL_ANIM_PATH_COUNT,
+} ser_lvgl_anim_path_t;
+
+typedef struct
+{
+  uint32_t frames;     /* 有活动动画的定时器轮数 */
+  uint32_t steps;      /* 计算的动画步数 */
+  uint32_t writes;     /* 值变化、写入样式的次数 */
+  uint32_t refreshes;  /* 对象样式刷新次数（每对象每帧至多一次） */
+  uint32_t full;       /* 数组满而失败的 start */
+  uint32_t active_max;
+} ser_lvgl_anim_stats_t;
+
+void ser_lvgl_anim_get_stats(ser_lvgl_anim_stats_t *stats);
+void ser_lvgl_anim_reset_stats(void);
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+typedef struct
+{
+  lv_obj_t *obj;
+  ser_lvgl_anim_prop_t prop;
+  ser_lvgl_anim_path_t path;
+  int32_t from;
+  int32_t to;
+  uint16_t duration_ms;
+  uint16_t reverse_ms; /* 0：不回放 */
+  uint16_t delay_ms;   /* 只在第一次播放前等待 */
+  uint16_t repeat;     /* 播放次数：0/1 一次，SER_LVGL_ANIM_REPEAT_INFINITE 无限 */
+} ser_lvgl_anim_cfg_t;
+
+/* 启动（或替换）obj 上 prop 的动画；参数非法或数组满时返回 false */
+bool ser_lvgl_anim_start(const ser_lvgl_anim_cfg_t *cfg);
+
+/* 停止动画（属性保持当前值）；prop 为 SER_LVGL_ANIM_PROP_COUNT 时停止该对象全部动画 */
+void ser_lvgl_anim_stop(lv_obj_t *obj, ser_lvgl_anim_prop_t prop);
+
+uint32_t ser_lvgl_anim_count(void);
+
+#endif
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
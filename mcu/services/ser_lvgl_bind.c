@@ -0,0 +1,197 @@
+#include "ser_lvgl_bind.h"
+
+#include "dri_time_us.h"
+
+#include <stddef.h>
+
+#if !defined(SER_LVGL_BIND_HOST) || !SER_LVGL_BIND_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define bind_enter() taskENTER_CRITICAL()
+#define bind_exit() taskEXIT_CRITICAL()
+#define bind_barrier() __DMB()
+#else
+/* 主机构建：subject 在启动阶段单线程登记，屏障用编译器内建 */
+#define bind_enter() ((void)0)
+#define bind_exit() ((void)0)
+#define bind_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+typedef struct
+{
+  ser_lvgl_subject_t *subject;
+  ser_lvgl_observer_cb_t cb;
+  void *target;
+} bind_observer_t;
+
+static ser_lvgl_subject_t *s_subjects[SER_LVGL_BIND_MAX_SUBJECTS];
+static uint32_t s_subject_count = 0;
+
+static bind_observer_t s_observers[SER_LVGL_BIND_MAX_OBSERVERS];
+static uint32_t s_observer_count = 0;
+
+static void *s_consumer = NULL;
+/* 统计值不加锁，仅供调试观察 */
+static ser_lvgl_bind_stats_t s_stats;
+
+void ser_lvgl_subject_init(ser_lvgl_subject_t *subject, int32_t initial)
+{
+  if (subject == NULL)
+  {
+    return;
+  }
+
+  bind_enter();
+  subject->pending_value = initial;
+  subject->pending_cycles = dri_time_cycles_now();
+  subject->pending = 1u;
+  subject->value = initial;
+  subject->has_value = 0u;
+
+  if (!subject->registered && s_subject_count < SER_LVGL_BIND_MAX_SUBJECTS)
+  {
+    s_subjects[s_subject_count++] = subject;
+    subject->registered = 1u;
+  }
+  bind_exit();
+}
+
+static void subject_store(ser_lvgl_subject_t *subject, int32_t value)
+{
+  /*
+   * 先写值再置标志：消费者先清标志再读值，
+   * 即使两者交错，消费者最终也会读到最新值（最多多分发一次，会被“值未变”过滤）
+   */
+  subject->pending_value = value;
+  subject->pending_cycles = dri_time_cycles_now();
+  bind_barrier();
+  subject->pending = 1u;
+  s_stats.publishes++;
+}
+
+void ser_lvgl_subject_publish(ser_lvgl_subject_t *subject, int32_t value)
+{
+  if (subject == NULL)
+  {
+    return;
+  }
+
+  subject_store(subject, value);
+  if (s_consumer != NULL)
+  {
+#if !defined(SER_LVGL_BIND_HOST) || !SER_LVGL_BIND_HOST
+    xTaskNotifyGive((TaskHandle_t)s_consumer);
+#else
+    ser_lvgl_bind_host_notify(s_consumer);
+#endif
+  }
+}
+
+void ser_lvgl_subject_publish_from_isr(ser_lvgl_subject_t *subject,
+                                       int32_t value)
+{
+  if (subject == NULL)
+  {
+    return;
+  }
+
+  subject_store(subject, value);
+  if (s_consumer != NULL)
+  {
+#if !defined(SER_LVGL_BIND_HOST) || !SER_LVGL_BIND_HOST
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)s_consumer, &woken);
+    portYIELD_FROM_ISR(woken);
+#else
+    ser_lvgl_bind_host_notify(s_consumer);
+#endif
+  }
+}
+
+bool ser_lvgl_subject_add_observer(ser_lvgl_subject_t *subject,
+                                   ser_lvgl_observer_cb_t cb, void *target)
+{
+  if (subject == NULL || cb == NULL ||
+      s_observer_count >= SER_LVGL_BIND_MAX_OBSERVERS)
+  {
+    return false;
+  }
+
+  s_observers[s_observer_count].subject = subject;
+  s_observers[s_observer_count].cb = cb;
+  s_observers[s_observer_count].target = target;
+  s_observer_count++;
+
+  if (subject->has_value)
+  {
+    cb(target, subject->value);
+  }
+  return true;
+}
+
+void ser_lvgl_bind_set_consumer(void *task_handle)
+{
+  s_consumer = task_handle;
+}
+
+static void subject_notify(ser_lvgl_subject_t *subject)
+{
+  for (uint32_t i = 0; i < s_observer_count; i++)
+  {
+    if (s_observers[i].subject == subject)
+    {
+      s_observers[i].cb(s_observers[i].target, subject->value);
+    }
+  }
+}
+
+uint32_t ser_lvgl_bind_process(void)
+{
+  uint32_t delivered = 0;
+
+  for (uint32_t i = 0; i < s_subject_count; i++)
+  {
+    ser_lvgl_subject_t *subject = s_subjects[i];
+    if (!subject->pending)
+    {
+      continue;
+    }
+
+    subject->pending = 0u;
+    bind_barrier();
+    int32_t v = subject->pending_value;
+    uint32_t t0 = subject->pending_cycles;
+
+    if (subject->has_value && subject->value == v)
+    {
+      s_stats.unchanged++;
+      continue;
+    }
+
+    subject->value = v;
+    subject->has_value = 1u;
+    subject_notify(subject);
+    delivered++;
+
+    uint32_t lat = dri_time_cycles_elapsed_us(t0);
+    s_stats.deliveries++;
+    s_stats.last_latency_us = lat;
+    if (lat > s_stats.max_latency_us)
+    {
+      s_stats.max_latency_us = lat;
+    }
+  }
+
+  return delivered;
+}
+
+void ser_lvgl_bind_get_stats(ser_lvgl_bind_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  *stats = s_stats;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：LVGL 数据绑定（subject/observer）
+ *
+ * 背景：
+ * - LVGL 只能在 lvgl_task 中调用；以前 UI 用 lv_timer 每 200ms 轮询各服务的数据，
+ *   数据没变也会重设文本/动画，新数据最多要等 200ms 才显示
+ *
+ * 做法：
+ * - 服务在自己的任务（或中断）里 publish 一个 int32 值到 subject：
+ *   只写值 + 置 pending 标志 + 通知 lvgl_task，无锁、不阻塞、不分配内存
+ * - lvgl_task 每轮循环调用 ser_lvgl_bind_process()，把有变化的值分发给 observer
+ *   （observer 回调在 LVGL 上下文中执行，可以安全地操作控件）
+ * - 值没变化的 publish 不会触发 observer
+ *
+ * 说明：
+ * - 工程内精简版 LVGL 未带 lv_observer.c（LV_USE_OBSERVER 无法直接打开），
+ *   这里提供同样语义的最小实现，并额外解决了跨任务投递问题
+ * - subject/observer 均为静态存储；observer 数量上限见 SER_LVGL_BIND_MAX_OBSERVERS
+ * - 主机构建（SER_LVGL_BIND_HOST=1）不依赖 FreeRTOS：唤醒由测试实现
+ *   ser_lvgl_bind_host_notify，时间戳来自 DRI_TIME_HOST 的注入计数器
+ */
+
+#ifndef SER_LVGL_BIND_MAX_SUBJECTS
+#define SER_LVGL_BIND_MAX_SUBJECTS 8u
+#endif
+#ifndef SER_LVGL_BIND_MAX_OBSERVERS
+#define SER_LVGL_BIND_MAX_OBSERVERS 16u
+#endif
+
+/* observer 回调：target 一般为控件指针，value 为 subject 的新值 */
+typedef void (*ser_lvgl_observer_cb_t)(void *target, int32_t value);
+
+typedef struct
+{
+  volatile int32_t pending_value;
+  volatile uint32_t pending_cycles; /* publish 时刻（DWT cycles） */
+  volatile uint8_t pending;
+
+  /* 以下字段只在 LVGL 上下文访问 */
+  int32_t value;
+  uint8_t has_value;
+  uint8_t registered;
+} ser_lvgl_subject_t;
+
+typedef struct
+{
+  uint32_t publishes;  /* publish 次数（含被合并/未变化的） */
+  uint32_t deliveries; /* 实际分发给 observer 的次数 */
+  uint32_t unchanged;  /* 因值未变化而被丢弃的次数 */
+  uint32_t last_latency_us; /* 最近一次 publish -> observer 的延迟 */
+  uint32_t max_latency_us;
+} ser_lvgl_bind_stats_t;
+
+/* 初始化 subject（服务启动时调用一次；初值会在首次 process 时分发） */
+void ser_lvgl_subject_init(ser_lvgl_subject_t *subject, int32_t initial);
+
+/* 任务上下文发布新值（可在任意任务调用） */
+void ser_lvgl_subject_publish(ser_lvgl_subject_t *subject, int32_t value);
+
+/* 中断上下文发布新值 */
+void ser_lvgl_subject_publish_from_isr(ser_lvgl_subject_t *subject,
+                                       int32_t value);
+
+/*
+ * 以下函数只能在 LVGL 上下文调用
+ */
+
+/* 绑定 observer；若 subject 已有值会立即回调一次 */
+bool ser_lvgl_subject_add_observer(ser_lvgl_subject_t *subject,
+                                   ser_lvgl_observer_cb_t cb, void *target);
+
+/* 登记消费者任务（通常为 lvgl_task），publish 时用任务通知唤醒它 */
+void ser_lvgl_bind_set_consumer(void *task_handle);
+
+/* 分发所有待处理的 publish；返回本轮分发的次数 */
+uint32_t ser_lvgl_bind_process(void);
+
+void ser_lvgl_bind_get_stats(ser_lvgl_bind_stats_t *stats);
+
+#if defined(SER_LVGL_BIND_HOST) && SER_LVGL_BIND_HOST
+/* 主机构建由测试提供：publish 后唤醒 set_consumer 登记的消费者 */
+void ser_lvgl_bind_host_notify(void *consumer);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,258 @@
+#include "ser_lvgl_cmd.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if !defined(SER_LVGL_CMD_HOST) || !SER_LVGL_CMD_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dri_time_us.h"
+#endif
+
+#define CMD_MASK (SER_LVGL_CMD_DEPTH - 1u)
+
+#if (SER_LVGL_CMD_DEPTH & CMD_MASK) != 0u || SER_LVGL_CMD_DEPTH < 2u
+#error "SER_LVGL_CMD_DEPTH must be a power of two >= 2"
+#endif
+
+/*
+ * 格子序号（位置 pos 对应格子 pos & CMD_MASK）：
+ * - seq == pos：空闲，等待位置 pos 的生产者
+ * - seq == pos + 1：位置 pos 的命令已写好，等待消费
+ * - 消费后置为 pos + DEPTH，留给下一圈的生产者
+ */
+typedef struct
+{
+  uint32_t seq;
+  uint32_t t_post;
+  ser_lvgl_cmd_fn_t fn;
+  void *obj;
+  int32_t value;
+} cmd_cell_t;
+
+static cmd_cell_t s_cells[SER_LVGL_CMD_DEPTH];
+static uint32_t s_tail; /* 生产者共享，CAS 推进 */
+static uint32_t s_head; /* 只有消费者访问 */
+
+static const ser_lvgl_cmd_port_t *s_port = NULL;
+
+/* 生产者侧计数用原子加（多个生产者并发），消费者侧计数只有一个写者 */
+static ser_lvgl_cmd_stats_t s_stats;
+
+#define stat_add(field, n) (void)__atomic_fetch_add(&(field), (n), __ATOMIC_RELAXED)
+
+#if !defined(SER_LVGL_CMD_HOST) || !SER_LVGL_CMD_HOST
+static TaskHandle_t s_consumer = NULL;
+
+static uint32_t board_now(void)
+{
+  return dri_time_cycles_now();
+}
+
+static void board_notify(bool from_isr)
+{
+  TaskHandle_t task = s_consumer;
+  if (task == NULL)
+  {
+    return;
+  }
+
+  if (from_isr)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+  else if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    xTaskNotifyGive(task);
+  }
+}
+
+static bool board_in_isr(void)
+{
+  return __get_IPSR() != 0u;
+}
+
+static ser_lvgl_cmd_port_t s_board_port = {
+    .now = board_now,
+    .notify = board_notify,
+    .in_isr = board_in_isr,
+};
+
+void ser_lvgl_cmd_set_consumer(void *task_handle)
+{
+  s_consumer = (TaskHandle_t)task_handle;
+}
+#else
+void ser_lvgl_cmd_set_consumer(void *task_handle)
+{
+  (void)task_handle;
+}
+#endif
+
+bool ser_lvgl_cmd_init(const ser_lvgl_cmd_port_t *port)
+{
+#if !defined(SER_LVGL_CMD_HOST) || !SER_LVGL_CMD_HOST
+  if (port == NULL)
+  {
+    s_board_port.hz = dri_time_hz();
+    port = &s_board_port;
+  }
+#endif
+  if (port == NULL || port->now == NULL || port->hz == 0u)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < SER_LVGL_CMD_DEPTH; i++)
+  {
+    s_cells[i].seq = i;
+  }
+  s_tail = 0;
+  s_head = 0;
+  memset(&s_stats, 0, sizeof(s_stats));
+  __atomic_store_n(&s_port, port, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool ser_lvgl_cmd_post(ser_lvgl_cmd_fn_t fn, void *obj, int32_t value)
+{
+  const ser_lvgl_cmd_port_t *port = __atomic_load_n(&s_port, __ATOMIC_ACQUIRE);
+  if (port == NULL || fn == NULL)
+  {
+    return false;
+  }
+
+  uint32_t retries = 0;
+  uint32_t pos = __atomic_load_n(&s_tail, __ATOMIC_RELAXED);
+  cmd_cell_t *c;
+  for (;;)
+  {
+    c = &s_cells[pos & CMD_MASK];
+    uint32_t seq = __atomic_load_n(&c->seq, __ATOMIC_ACQUIRE);
+    int32_t diff = (int32_t)(seq - pos);
+
+    if (diff == 0)
+    {
+      /* 格子空闲：抢这个位置；失败时 pos 被更新为最新的 tail */
+      if (__atomic_compare_exchange_n(&s_tail, &pos, pos + 1u, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      {
+        break;
+      }
+      retries++;
+    }
+    else if (diff < 0)
+    {
+      /* 上一圈的命令还没被消费：满 */
+      stat_add(s_stats.full, 1u);
+      if (retries != 0u)
+      {
+        stat_add(s_stats.retries, retries);
+      }
+      return false;
+    }
+    else
+    {
+      /* 别的生产者已经抢走这个位置 */
+      pos = __atomic_load_n(&s_tail, __ATOMIC_RELAXED);
+      retries++;
+    }
+  }
+
+  c->t_post = port->now();
+  c->fn = fn;
+  c->obj = obj;
+  c->value = value;
+  __atomic_store_n(&c->seq, pos + 1u, __ATOMIC_RELEASE);
+
+  stat_add(s_stats.posts, 1u);
+  if (retries != 0u)
+  {
+    stat_add(s_stats.retries, retries);
+  }
+
+  port->notify((port->in_isr != NULL) && port->in_isr());
+  return true;
+}
+
+uint32_t ser_lvgl_cmd_drain(uint32_t max)
+{
+  const ser_lvgl_cmd_port_t *port = __atomic_load_n(&s_port, __ATOMIC_ACQUIRE);
+  if (port == NULL)
+  {
+    return 0;
+  }
+
+  uint32_t depth = __atomic_load_n(&s_tail, __ATOMIC_RELAXED) - s_head;
+  if (depth > s_stats.depth_max)
+  {
+    s_stats.depth_max = depth;
+  }
+
+  uint32_t n = 0;
+  while (n < max)
+  {
+    cmd_cell_t *c = &s_cells[s_head & CMD_MASK];
+    if (__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != s_head + 1u)
+    {
+      /* 位置已被抢占但还没写完（生产者被抢占），留到它发布后的下一轮 */
+      if (__atomic_load_n(&s_tail, __ATOMIC_RELAXED) != s_head)
+      {
+        s_stats.stalls++;
+      }
+      break;
+    }
+
+    ser_lvgl_cmd_fn_t fn = c->fn;
+    void *obj = c->obj;
+    int32_t value = c->value;
+    uint32_t t_post = c->t_post;
+
+    /* 先还格子再执行：回调里再投递不会自己把队列占满 */
+    __atomic_store_n(&c->seq, s_head + SER_LVGL_CMD_DEPTH, __ATOMIC_RELEASE);
+    s_head++;
+
+    fn(obj, value);
+    n++;
+
+    uint32_t lat =
+        (uint32_t)((uint64_t)(port->now() - t_post) * 1000000u / port->hz);
+    if (lat > s_stats.lat_max_us)
+    {
+      s_stats.lat_max_us = lat;
+    }
+  }
+
+  if (n != 0u)
+  {
+    s_stats.executed += n;
+    s_stats.batches++;
+    if (n > s_stats.batch_max)
+    {
+      s_stats.batch_max = n;
+    }
+  }
+  return n;
+}
+
+bool ser_lvgl_cmd_pending(void)
+{
+  const cmd_cell_t *c = &s_cells[s_head & CMD_MASK];
+  return __atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) == s_head + 1u;
+}
+
+void ser_lvgl_cmd_get_stats(ser_lvgl_cmd_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_lvgl_cmd_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：UI 命令队列（任意任务/中断投递，LVGL 任务批量执行）
+ *
+ * 背景：
+ * - LVGL 启用 FreeRTOS OSAL 后，其它任务可以 lv_lock() 后直接操作控件，
+ *   但 lv_timer_handler 整轮（含渲染，几到几十毫秒）都持有这把锁，调用方会被阻塞；
+ *   中断里则根本不能拿锁
+ * - subject（ser_lvgl_bind）只适合“一个 int32 的最新值”，不适合一次性的动作
+ *   （切页面、弹提示、追加一行日志）
+ *
+ * 做法：
+ * - 命令 = 回调 + 对象 + 一个 int32 参数，定长，投递时拷贝进环形队列
+ * - 多生产者单消费者、无锁：每个格子带序号（Vyukov 有界队列），
+ *   生产者只用一次 CAS 抢占写位置，写完用 release 发布序号；不关中断、不拿锁，
+ *   中断里也能投递；队列满时投递失败（返回 false），不阻塞
+ * - 投递后任务通知唤醒 LVGL 任务，LVGL 任务不必等满轮询间隔
+ * - LVGL 任务每轮 lv_timer_handler 之前在 lv_lock 内执行一批（至多 max 条），
+ *   没执行完的留到下一轮（本轮不睡眠），一个慢生产者不会拖住渲染
+ *
+ * 可移植性：
+ * - 原子操作用 GCC __atomic 内建（Cortex-M4 上为 LDREX/STREX），计时与唤醒经
+ *   ser_lvgl_cmd_port_t 注入；主机构建（SER_LVGL_CMD_HOST=1）用多线程测争用与批量大小
+ */
+
+/* 队列深度（2 的幂） */
+#ifndef SER_LVGL_CMD_DEPTH
+#define SER_LVGL_CMD_DEPTH 64u
+#endif
+
+/* LVGL 任务每轮最多执行的命令数 */
+#ifndef SER_LVGL_CMD_BATCH
+#define SER_LVGL_CMD_BATCH 16u
+#endif
+
+/* 命令回调：在 LVGL 任务中执行（已持有 lv_lock），可以安全地操作控件 */
+typedef void (*ser_lvgl_cmd_fn_t)(void *obj, int32_t value);
+
+typedef struct
+{
+  uint32_t posts;
+  uint32_t full;       /* 队列满而失败的投递 */
+  uint32_t retries;    /* 抢写位置 CAS 失败重试次数（生产者之间的争用） */
+  uint32_t executed;
+  uint32_t batches;    /* 执行到至少一条命令的轮数 */
+  uint32_t batch_max;
+  uint32_t depth_max;  /* 消费时观察到的最大积压 */
+  uint32_t stalls;     /* 消费时遇到已占位但尚未写完的格子（本轮到此为止） */
+  uint32_t lat_max_us; /* 投递 -> 执行 */
+} ser_lvgl_cmd_stats_t;
+
+/*
+ * 平台抽象：
+ * - now / hz：周期计数与频率（只用于延迟统计）
+ * - notify：唤醒消费者；from_isr 为 true 时在中断上下文
+ * - in_isr：可为 NULL（视为任务上下文）
+ */
+typedef struct
+{
+  uint32_t (*now)(void);
+  uint32_t hz;
+  void (*notify)(bool from_isr);
+  bool (*in_isr)(void);
+} ser_lvgl_cmd_port_t;
+
+/* 初始化；port 为 NULL 时 MCU 上使用 DWT + 任务通知（调度器启动前调用） */
+bool ser_lvgl_cmd_init(const ser_lvgl_cmd_port_t *port);
+
+/* 登记消费者任务（LVGL 任务），MCU 实现投递后用任务通知唤醒它 */
+void ser_lvgl_cmd_set_consumer(void *task_handle);
+
+/* 投递（任意任务或中断）；未初始化或队列满返回 false */
+bool ser_lvgl_cmd_post(ser_lvgl_cmd_fn_t fn, void *obj, int32_t value);
+
+/* 执行至多 max 条（只能由一个消费者调用）；返回执行的条数 */
+uint32_t ser_lvgl_cmd_drain(uint32_t max);
+
+/* 是否还有未执行的命令（消费者据此决定本轮是否睡眠） */
+bool ser_lvgl_cmd_pending(void);
+
+void ser_lvgl_cmd_get_stats(ser_lvgl_cmd_stats_t *stats);
+void ser_lvgl_cmd_reset_stats(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
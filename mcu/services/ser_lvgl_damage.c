@@ -0,0 +1,543 @@
+#include "ser_lvgl_damage.h"
+
+#include <string.h>
+
+#include "dev_lcd.h"
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+#define DAMAGE_TX_MAX                                                          \
+  ((SER_LVGL_DAMAGE_MAX_W + SER_LVGL_DAMAGE_TILE - 1u) / SER_LVGL_DAMAGE_TILE)
+#define DAMAGE_TY_MAX                                                          \
+  ((SER_LVGL_DAMAGE_MAX_H + SER_LVGL_DAMAGE_TILE - 1u) / SER_LVGL_DAMAGE_TILE)
+
+_Static_assert(DAMAGE_TX_MAX <= 32u, "one uint32_t dirty mask per tile row");
+
+static ser_lvgl_damage_stats_t s_stats;
+
+/* 每个瓦片最近一次写出内容的哈希；s_hash_valid 每行一个位掩码 */
+static uint32_t s_hash[DAMAGE_TY_MAX][DAMAGE_TX_MAX];
+static uint32_t s_hash_valid[DAMAGE_TY_MAX];
+
+void ser_lvgl_damage_forget(void)
+{
+  memset(s_hash_valid, 0, sizeof(s_hash_valid));
+}
+
+void ser_lvgl_damage_get_stats(ser_lvgl_damage_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  *stats = s_stats;
+}
+
+#if SER_LVGL_HAS_LIB
+
+/* inv_areas/inv_p 未在 lvgl.h 公开 */
+#include "src/display/lv_display_private.h"
+#include "src/misc/lv_area_private.h"
+
+_Static_assert(DAMAGE_TY_MAX + SER_LVGL_DAMAGE_EXACT_MAX <= LV_INV_BUF_SIZE,
+               "coarse mode emits one area per tile row band plus exact areas");
+
+/* 脏位图：每个瓦片行一个掩码，bit tx 对应第 tx 列瓦片 */
+static uint32_t s_dirty[DAMAGE_TY_MAX];
+static uint32_t s_tx_n = 0;
+static uint32_t s_ty_n = 0;
+static bool s_hash_en = false;
+static lv_display_t *s_disp = NULL;
+
+/* 精确区域：原样输出，不并入瓦片位图 */
+static lv_area_t s_exact[SER_LVGL_DAMAGE_EXACT_MAX];
+static uint32_t s_exact_n = 0;
+
+/* ignore_once 的目标区域 */
+static bool s_ignore = false;
+static lv_area_t s_ignore_area;
+
+/* 统计掩码中连续 1 段的个数 */
+static uint32_t mask_runs(uint32_t m)
+{
+  return (uint32_t)__builtin_popcount(m & ~(m << 1));
+}
+
+static void area_from_tiles(lv_display_t *disp, lv_area_t *a, uint32_t tx1,
+                            uint32_t tx2, uint32_t ty1, uint32_t ty2)
+{
+  const int32_t hor = lv_display_get_horizontal_resolution(disp);
+  const int32_t ver = lv_display_get_vertical_resolution(disp);
+
+  a->x1 = (int32_t)(tx1 * SER_LVGL_DAMAGE_TILE);
+  a->y1 = (int32_t)(ty1 * SER_LVGL_DAMAGE_TILE);
+  a->x2 = (int32_t)((tx2 + 1u) * SER_LVGL_DAMAGE_TILE) - 1;
+  a->y2 = (int32_t)((ty2 + 1u) * SER_LVGL_DAMAGE_TILE) - 1;
+  if (a->x2 >= hor)
+    a->x2 = hor - 1;
+  if (a->y2 >= ver)
+    a->y2 = ver - 1;
+}
+
+/* inv_p 为 0：上一帧已刷新完成（或被 lv_inv_area(NULL) 清空），位图从头开始 */
+static void damage_begin(lv_display_t *disp)
+{
+  if (disp->inv_p == 0u)
+  {
+    memset(s_dirty, 0, sizeof(s_dirty));
+    s_exact_n = 0;
+  }
+}
+
+static void tile_range(const lv_area_t *a, uint32_t *tx1, uint32_t *tx2,
+                       uint32_t *ty1, uint32_t *ty2, uint32_t *m)
+{
+  *tx1 = (uint32_t)a->x1 / SER_LVGL_DAMAGE_TILE;
+  *tx2 = (uint32_t)a->x2 / SER_LVGL_DAMAGE_TILE;
+  *ty1 = (uint32_t)a->y1 / SER_LVGL_DAMAGE_TILE;
+  *ty2 = (uint32_t)a->y2 / SER_LVGL_DAMAGE_TILE;
+  if (*tx2 >= s_tx_n)
+    *tx2 = s_tx_n - 1u;
+  if (*ty2 >= s_ty_n)
+    *ty2 = s_ty_n - 1u;
+
+  uint32_t width = *tx2 - *tx1 + 1u;
+  *m = ((width < 32u) ? ((1u << width) - 1u) : 0xFFFFFFFFu) << *tx1;
+}
+
+/* 标记 a 覆盖的瓦片；返回位图是否变化 */
+static bool mark_tiles(const lv_area_t *a)
+{
+  uint32_t tx1, tx2, ty1, ty2, m;
+  tile_range(a, &tx1, &tx2, &ty1, &ty2, &m);
+
+  bool changed = false;
+  for (uint32_t ty = ty1; ty <= ty2; ty++)
+  {
+    changed |= (s_dirty[ty] & m) != m;
+    s_dirty[ty] |= m;
+  }
+  return changed;
+}
+
+/* a 覆盖的瓦片是否已全部标脏 */
+static bool tiles_cover(const lv_area_t *a)
+{
+  uint32_t tx1, tx2, ty1, ty2, m;
+  tile_range(a, &tx1, &tx2, &ty1, &ty2, &m);
+
+  for (uint32_t ty = ty1; ty <= ty2; ty++)
+  {
+    if ((s_dirty[ty] & m) != m)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* 带：掩码相同的相邻瓦片行 */
+typedef struct
+{
+  uint32_t mask;
+  uint8_t ty1;
+  uint8_t ty2;
+} damage_band_t;
+
+/* 带内两段之间的空隙；cost 为合并后多画的瓦片数 */
+typedef struct
+{
+  uint16_t cost;
+  uint8_t band;
+  uint8_t tx;
+  uint8_t w;
+} damage_gap_t;
+
+static damage_band_t s_band[DAMAGE_TY_MAX];
+static damage_gap_t s_gap[DAMAGE_TY_MAX * (DAMAGE_TX_MAX / 2u)];
+
+/* 收集各带的空隙并按 cost 升序排列（插入排序，空隙数很少）；返回空隙数 */
+static uint32_t collect_gaps(uint32_t bands)
+{
+  uint32_t n = 0;
+  for (uint32_t b = 0; b < bands; b++)
+  {
+    uint32_t m = s_band[b].mask;
+    const uint32_t rows = (uint32_t)s_band[b].ty2 - s_band[b].ty1 + 1u;
+    while (m != 0u)
+    {
+      /* 跳过一段连续 1，再量出其后的空隙 */
+      const uint32_t tx1 = (uint32_t)__builtin_ctz(m);
+      const uint32_t end = tx1 + (uint32_t)__builtin_ctz(~(m >> tx1));
+      if (end >= 32u || (m >> end) == 0u)
+      {
+        break;
+      }
+      const uint32_t w = (uint32_t)__builtin_ctz(m >> end);
+      m &= ~((1u << end) - 1u);
+
+      damage_gap_t g = {(uint16_t)(w * rows), (uint8_t)b, (uint8_t)end,
+                        (uint8_t)w};
+      uint32_t i = n++;
+      for (; i > 0u && s_gap[i - 1u].cost > g.cost; i--)
+      {
+        s_gap[i] = s_gap[i - 1u];
+      }
+      s_gap[i] = g;
+    }
+  }
+  return n;
+}
+
+/*
+ * 由脏位图重建 disp->inv_areas
+ * - 掩码相同的相邻行组成一个带；带内每段连续 1 输出一个矩形
+ * - 矩形总数超过 LV_INV_BUF_SIZE 时，按多画瓦片数从少到多填平带内空隙，
+ *   直到放得下（最坏每个带一个包围矩形）
+ * - 精确区域排在最后，已被脏瓦片覆盖的不再输出
+ */
+static void damage_rebuild(lv_display_t *disp)
+{
+  uint32_t bands = 0;
+  uint32_t total = 0;
+  for (uint32_t ty = 0; ty < s_ty_n;)
+  {
+    const uint32_t m = s_dirty[ty];
+    uint32_t end = ty + 1u;
+    while (end < s_ty_n && s_dirty[end] == m)
+    {
+      end++;
+    }
+    if (m != 0u)
+    {
+      s_band[bands].mask = m;
+      s_band[bands].ty1 = (uint8_t)ty;
+      s_band[bands].ty2 = (uint8_t)(end - 1u);
+      bands++;
+      total += mask_runs(m);
+    }
+    ty = end;
+  }
+
+  if (total + s_exact_n > LV_INV_BUF_SIZE)
+  {
+    s_stats.coarse_rebuilds++;
+    const uint32_t gaps = collect_gaps(bands);
+    const uint32_t merge = total + s_exact_n - LV_INV_BUF_SIZE;
+    for (uint32_t i = 0; i < merge && i < gaps; i++)
+    {
+      const damage_gap_t *g = &s_gap[i];
+      s_band[g->band].mask |= ((1u << g->w) - 1u) << g->tx;
+    }
+  }
+
+  uint32_t n = 0;
+  for (uint32_t b = 0; b < bands; b++)
+  {
+    uint32_t m = s_band[b].mask;
+    while (m != 0u)
+    {
+      uint32_t tx1 = (uint32_t)__builtin_ctz(m);
+      uint32_t run = (uint32_t)__builtin_ctz(~(m >> tx1));
+      area_from_tiles(disp, &disp->inv_areas[n++], tx1, tx1 + run - 1u,
+                      s_band[b].ty1, s_band[b].ty2);
+      m &= ~(((run < 32u) ? ((1u << run) - 1u) : 0xFFFFFFFFu) << tx1);
+    }
+  }
+
+  for (uint32_t i = 0; i < s_exact_n; i++)
+  {
+    if (!tiles_cover(&s_exact[i]))
+    {
+      disp->inv_areas[n++] = s_exact[i];
+    }
+  }
+
+  disp->inv_p = (uint16_t)n;
+  s_stats.last_areas = n;
+}
+
+/*
+ * LV_EVENT_INVALIDATE_AREA：
+ * - param 为已裁剪到屏幕内的失效区域（可修改）
+ * - 标记瓦片并重建 inv_areas 后，把 param 改成 inv_areas[0]，
+ *   lv_inv_area 随后的“已包含”检查会直接返回，不再追加
+ */
+static void damage_invalidate_cb(lv_event_t *e)
+{
+  lv_display_t *disp = (lv_display_t *)lv_event_get_target(e);
+  lv_area_t *a = (lv_area_t *)lv_event_get_param(e);
+  if (disp == NULL || a == NULL || s_tx_n == 0u)
+  {
+    return;
+  }
+
+  /*
+   * 渲染中收到的是 PARTIAL 模式计算条带行数时的取整询问（get_max_row 拿一个
+   * 条带区域发本事件），不是失效；改写成整屏区域会让条带行数算成 0、刷新死循环
+   */
+  if (disp->rendering_in_progress)
+  {
+    return;
+  }
+
+  damage_begin(disp);
+
+  /* 已由精确区域代替的整块失效：改成已保存的区域，lv_inv_area 随即返回 */
+  if (s_ignore && disp->inv_p != 0u && a->x1 == s_ignore_area.x1 &&
+      a->y1 == s_ignore_area.y1 && a->x2 == s_ignore_area.x2 &&
+      a->y2 == s_ignore_area.y2)
+  {
+    s_ignore = false;
+    s_stats.ignored++;
+    *a = disp->inv_areas[0];
+    return;
+  }
+
+  s_stats.invalidations++;
+  bool changed = mark_tiles(a);
+
+  /* 全部落在已脏瓦片内：inv_areas 不变 */
+  if (changed || disp->inv_p == 0u)
+  {
+    damage_rebuild(disp);
+  }
+
+  *a = disp->inv_areas[0];
+  /* 区域不会再被 lv_inv_area 保存，刷新请求由这里发出 */
+  lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
+/* 按当前分辨率设置瓦片行列数并清空位图；超出支持范围时置 0（失效回调不再接管） */
+static bool damage_resize(lv_display_t *disp)
+{
+  const int32_t hor = lv_display_get_horizontal_resolution(disp);
+  const int32_t ver = lv_display_get_vertical_resolution(disp);
+
+  memset(s_dirty, 0, sizeof(s_dirty));
+  s_exact_n = 0;
+  s_ignore = false;
+
+  if (hor <= 0 || ver <= 0 || (uint32_t)hor > SER_LVGL_DAMAGE_MAX_W ||
+      (uint32_t)ver > SER_LVGL_DAMAGE_MAX_H)
+  {
+    s_tx_n = 0;
+    s_ty_n = 0;
+    return false;
+  }
+
+  s_tx_n = ((uint32_t)hor + SER_LVGL_DAMAGE_TILE - 1u) / SER_LVGL_DAMAGE_TILE;
+  s_ty_n = ((uint32_t)ver + SER_LVGL_DAMAGE_TILE - 1u) / SER_LVGL_DAMAGE_TILE;
+  return true;
+}
+
+/*
+ * LV_EVENT_RESOLUTION_CHANGED（如切换竖屏）：
+ * - LVGL 在发出本事件之前已清空 inv_areas 并整屏失效，那次失效按旧的瓦片行列数
+ *   记录，可能没覆盖新屏幕；这里按新尺寸重新整屏标脏
+ */
+static void damage_resolution_cb(lv_event_t *e)
+{
+  lv_display_t *disp = (lv_display_t *)lv_event_get_target(e);
+  if (disp == NULL || !damage_resize(disp))
+  {
+    return;
+  }
+
+  const lv_area_t scr = {
+      0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+      lv_display_get_vertical_resolution(disp) - 1};
+  (void)mark_tiles(&scr);
+  damage_rebuild(disp);
+  lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
+bool ser_lvgl_damage_attach(lv_display_t *disp, bool tile_hash)
+{
+  if (disp == NULL || !damage_resize(disp))
+  {
+    return false;
+  }
+
+  s_hash_en = tile_hash;
+  ser_lvgl_damage_forget();
+  s_disp = disp;
+
+  lv_display_add_event_cb(disp, damage_invalidate_cb, LV_EVENT_INVALIDATE_AREA,
+                          NULL);
+  lv_display_add_event_cb(disp, damage_resolution_cb,
+                          LV_EVENT_RESOLUTION_CHANGED, NULL);
+  return true;
+}
+
+bool ser_lvgl_damage_mark_exact(lv_display_t *disp, const lv_area_t *area)
+{
+  if (disp == NULL || disp != s_disp || area == NULL || s_tx_n == 0u ||
+      !lv_display_is_invalidation_enabled(disp))
+  {
+    return false;
+  }
+
+  const lv_area_t scr = {
+      0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+      lv_display_get_vertical_resolution(disp) - 1};
+  lv_area_t a;
+  if (!lv_area_intersect(&a, area, &scr))
+  {
+    return true;
+  }
+
+  damage_begin(disp);
+  if (tiles_cover(&a))
+  {
+    return true;
+  }
+  for (uint32_t i = 0; i < s_exact_n; i++)
+  {
+    if (lv_area_is_in(&a, &s_exact[i], 0))
+    {
+      return true;
+    }
+  }
+
+  if (s_exact_n < SER_LVGL_DAMAGE_EXACT_MAX)
+  {
+    s_exact[s_exact_n++] = a;
+    s_stats.exact_marks++;
+  }
+  else
+  {
+    (void)mark_tiles(&a);
+    s_stats.exact_overflow++;
+  }
+
+  damage_rebuild(disp);
+  lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+  return true;
+}
+
+void ser_lvgl_damage_ignore_once(const lv_area_t *area)
+{
+  s_ignore = (area != NULL);
+  if (area != NULL)
+  {
+    s_ignore_area = *area;
+  }
+}
+
+/* FNV-1a（按像素），w x h 子块，stride 以像素计 */
+static uint32_t tile_hash(const uint16_t *px, uint32_t stride, uint32_t w,
+                          uint32_t h)
+{
+  uint32_t hash = 2166136261u;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    for (uint32_t x = 0; x < w; x++)
+    {
+      hash = (hash ^ px[x]) * 16777619u;
+    }
+    px += stride;
+  }
+  return hash;
+}
+
+uint32_t ser_lvgl_damage_flush(const lv_area_t *area, const uint16_t *px)
+{
+  if (area == NULL || px == NULL)
+  {
+    return 0u;
+  }
+
+  const uint32_t stride = (uint32_t)lv_area_get_width(area);
+  if (!s_hash_en || s_tx_n == 0u)
+  {
+    dev_lcd_flush_rgb565_stride(area->x1, area->y1, area->x2, area->y2, px,
+                                stride);
+    return stride * (uint32_t)lv_area_get_height(area);
+  }
+
+  const int32_t hor = (int32_t)dev_lcd_width();
+  const int32_t ver = (int32_t)dev_lcd_height();
+  const int32_t T = (int32_t)SER_LVGL_DAMAGE_TILE;
+  uint32_t written = 0u;
+
+  for (int32_t ty = area->y1 / T; ty <= area->y2 / T; ty++)
+  {
+    /* 本瓦片行与 area 的交集（行范围） */
+    const int32_t tile_y1 = ty * T;
+    const int32_t tile_y2 = LV_MIN(tile_y1 + T - 1, ver - 1);
+    const int32_t y1 = LV_MAX(tile_y1, area->y1);
+    const int32_t y2 = LV_MIN(tile_y2, area->y2);
+    const bool full_rows = (y1 == tile_y1) && (y2 == tile_y2);
+    const uint16_t *row_px = px + (uint32_t)(y1 - area->y1) * stride;
+
+    /* 连续需要写出的瓦片合并成一段再写 */
+    int32_t run_x1 = -1;
+    int32_t run_x2 = -1;
+
+    for (int32_t tx = area->x1 / T; tx <= area->x2 / T; tx++)
+    {
+      const int32_t tile_x1 = tx * T;
+      const int32_t tile_x2 = LV_MIN(tile_x1 + T - 1, hor - 1);
+      const int32_t x1 = LV_MAX(tile_x1, area->x1);
+      const int32_t x2 = LV_MIN(tile_x2, area->x2);
+      const uint32_t bit = 1u << (uint32_t)tx;
+
+      bool skip = false;
+      if (full_rows && x1 == tile_x1 && x2 == tile_x2)
+      {
+        uint32_t h = tile_hash(row_px + (x1 - area->x1), stride,
+                               (uint32_t)(x2 - x1 + 1), (uint32_t)(y2 - y1 + 1));
+        skip = ((s_hash_valid[ty] & bit) != 0u) && (s_hash[ty][tx] == h);
+        s_hash[ty][tx] = h;
+        s_hash_valid[ty] |= bit;
+      }
+      else
+      {
+        /* 部分写入后瓦片内容与记录的哈希不再对应 */
+        s_hash_valid[ty] &= ~bit;
+      }
+
+      if (skip)
+      {
+        s_stats.tiles_skipped++;
+        continue;
+      }
+
+      s_stats.tiles_flushed++;
+      if (run_x1 >= 0 && run_x2 + 1 == x1)
+      {
+        run_x2 = x2;
+        continue;
+      }
+      if (run_x1 >= 0)
+      {
+        dev_lcd_flush_rgb565_stride(run_x1, y1, run_x2, y2,
+                                    row_px + (run_x1 - area->x1), stride);
+        written += (uint32_t)(run_x2 - run_x1 + 1) * (uint32_t)(y2 - y1 + 1);
+      }
+      run_x1 = x1;
+      run_x2 = x2;
+    }
+
+    if (run_x1 >= 0)
+    {
+      dev_lcd_flush_rgb565_stride(run_x1, y1, run_x2, y2,
+                                  row_px + (run_x1 - area->x1), stride);
+      written += (uint32_t)(run_x2 - run_x1 + 1) * (uint32_t)(y2 - y1 + 1);
+    }
+  }
+
+  return written;
+}
+
+#endif
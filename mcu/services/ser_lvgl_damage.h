@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：LVGL 瓦片（tile）脏区管理
+ *
+ * 背景：
+ * - lv_inv_area 把每个失效矩形存进固定大小的 inv_areas[LV_INV_BUF_SIZE]，
+ *   刷新前 lv_refr_join_area 做 O(n^2) 合并；缓冲溢出时直接整屏重绘
+ * - 大量零散的小失效（多个读数、动画）很容易触发整屏重绘
+ *
+ * 做法（不修改 LVGL 源码）：
+ * - 挂在 display 的 LV_EVENT_INVALIDATE_AREA 上：失效区域按 TILE x TILE 对齐，
+ *   记入每行一个 uint32_t 的脏位图
+ * - 每次标记后由位图重建 inv_areas：相同掩码的相邻瓦片行合并成一个带，
+ *   带内每段连续脏瓦片输出一个矩形；总数超过 LV_INV_BUF_SIZE 时按多画的瓦片数
+ *   从少到多填平带内空隙，直到放得下（最坏每带一个包围矩形，带数 <= 瓦片行数），
+ *   因此不会再退化成整屏重绘
+ * - PARTIAL 模式（帧缓冲非 RGB565）flush 时可选按瓦片计算渲染结果哈希：
+ *   与上次写出的内容相同的瓦片跳过格式转换与 SDRAM 写入
+ *   （例如动画回到原值、读数变回原来的数字）
+ *
+ * 限制：
+ * - 渲染本身无法跳过：输出哈希只有渲染完成后才知道，省下的是 flush 的转换与写入
+ * - 只有完整落在本次 flush 区域内的瓦片参与哈希比较；被部分覆盖的瓦片照常写出
+ * - DIRECT 模式（LVGL 直接画进帧缓冲）没有 flush 拷贝，只使用脏区对齐部分
+ *
+ * 精确区域（ser_lvgl_damage_mark_exact）：
+ * - 几像素高的窄条（滚动露出的内容、滚动条）按瓦片对齐会放大到 32 行，
+ *   这类区域原样输出，至多 SER_LVGL_DAMAGE_EXACT_MAX 个，超出后退回瓦片标记
+ * - ser_lvgl_damage_ignore_once 丢弃随后一次完全相同的失效请求，
+ *   用于以精确区域替换 LVGL 自己发出的整块失效（见 ser_lvgl_scroll）
+ * - 帧缓冲被 LVGL 以外的路径改写后需调用 ser_lvgl_damage_forget()
+ *
+ * 只能在 LVGL 上下文调用。
+ */
+
+#ifndef SER_LVGL_DAMAGE_TILE
+#define SER_LVGL_DAMAGE_TILE 32u
+#endif
+
+/*
+ * 支持的最大分辨率（决定位图/哈希表大小；每行瓦片数不能超过 32）
+ * - 横屏 800x480 与竖屏 480x800（ser_lvgl 旋转 90/270）都在范围内
+ */
+#ifndef SER_LVGL_DAMAGE_MAX_W
+#define SER_LVGL_DAMAGE_MAX_W 800u
+#endif
+#ifndef SER_LVGL_DAMAGE_MAX_H
+#define SER_LVGL_DAMAGE_MAX_H 800u
+#endif
+
+/* 精确区域个数上限（与瓦片带数之和不能超过 LV_INV_BUF_SIZE：25 + 7 = 32） */
+#ifndef SER_LVGL_DAMAGE_EXACT_MAX
+#define SER_LVGL_DAMAGE_EXACT_MAX 7u
+#endif
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+/*
+ * 挂接到 display：
+ * - tile_hash=true 时启用 ser_lvgl_damage_flush 的输出哈希比较
+ * - 分辨率超过 SER_LVGL_DAMAGE_MAX_W/H 时返回 false（不挂接，LVGL 行为不变）
+ * - 分辨率变化（旋转）后按新尺寸重建；超出范围时停止接管失效
+ */
+bool ser_lvgl_damage_attach(lv_display_t *disp, bool tile_hash);
+
+/*
+ * PARTIAL 模式 flush：把 px（RGB565，行连续，宽为 area 宽）写入帧缓冲
+ * - area 为帧缓冲（物理）坐标：旋转显示时为旋转后的区域
+ * - 启用哈希时跳过内容未变化的瓦片
+ * - 返回实际写出的像素数
+ */
+uint32_t ser_lvgl_damage_flush(const lv_area_t *area, const uint16_t *px);
+
+/*
+ * 标记一个不按瓦片对齐的失效区域（裁剪到屏幕内），并请求刷新
+ * - 未挂接或失效被禁用时返回 false
+ */
+bool ser_lvgl_damage_mark_exact(lv_display_t *disp, const lv_area_t *area);
+
+/*
+ * 丢弃下一次与 area（已裁剪到屏幕内）完全相同的失效请求；area 为 NULL 时取消
+ * - 只在已有待刷新区域时生效，否则照常标记
+ */
+void ser_lvgl_damage_ignore_once(const lv_area_t *area);
+
+#endif
+#endif
+
+/* 清空瓦片哈希（下一次 flush 全部写出） */
+void ser_lvgl_damage_forget(void);
+
+typedef struct
+{
+  uint32_t invalidations;  /* 收到的失效请求次数 */
+  uint32_t coarse_rebuilds; /* 矩形数超限、填平空隙后输出的次数 */
+  uint32_t last_areas;     /* 最近一次重建输出的矩形数 */
+  uint32_t tiles_flushed;  /* flush 时写出的瓦片（含部分瓦片） */
+  uint32_t tiles_skipped;  /* 哈希命中、跳过写出的瓦片 */
+  uint32_t exact_marks;    /* 按精确区域记录的标记 */
+  uint32_t exact_overflow; /* 精确区域已满、退回瓦片的标记 */
+  uint32_t ignored;        /* 被 ignore_once 丢弃的失效请求 */
+} ser_lvgl_damage_stats_t;
+
+void ser_lvgl_damage_get_stats(ser_lvgl_damage_stats_t *stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,34 @@
+/* 由 project/tools/ui_xml2c.py 根据 boot.xml 生成，请勿手工修改 */
+
+#include "ser_lvgl_gen_boot.h"
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "ser_lvgl_style.h"
+
+void ser_lvgl_gen_boot_create(lv_obj_t *parent, ser_lvgl_gen_boot_t *out)
+{
+  out->card = lv_obj_create(parent);
+  lv_obj_add_style(out->card, &ser_lvgl_style_card, 0);
+  lv_obj_set_size(out->card, lv_pct(72), lv_pct(58));
+  lv_obj_remove_flag(out->card, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_align(out->card, LV_ALIGN_CENTER, 0, 0);
+
+  out->badge = lv_obj_create(out->card);
+  lv_obj_add_style(out->badge, &ser_lvgl_style_badge, 0);
+  lv_obj_set_size(out->badge, 64, 64);
+  lv_obj_align(out->badge, LV_ALIGN_TOP_MID, 0, 0);
+
+  out->title = lv_label_create(out->card);
+  lv_obj_add_style(out->title, &ser_lvgl_style_title, 0);
+  lv_label_set_text(out->title, "歡迎使用");
+  lv_obj_align_to(out->title, out->badge, LV_ALIGN_OUT_BOTTOM_MID, 0, 12);
+
+  out->subtitle = lv_label_create(out->card);
+  lv_obj_add_style(out->subtitle, &ser_lvgl_style_subtitle, 0);
+  lv_label_set_text(out->subtitle, "STM32F429 | LVGL 9.4.0 | 中文可用");
+  lv_obj_align_to(out->subtitle, out->title, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
+}
+
+#endif
+#endif
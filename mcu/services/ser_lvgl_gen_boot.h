@@ -0,0 +1,29 @@
+#pragma once
+
+/* 由 project/tools/ui_xml2c.py 根据 boot.xml 生成，请勿手工修改 */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+typedef struct
+{
+  lv_obj_t *card;
+  lv_obj_t *badge;
+  lv_obj_t *title;
+  lv_obj_t *subtitle;
+} ser_lvgl_gen_boot_t;
+
+/* 在 parent 下创建对象树；带 name 的对象指针写入 out（只能在 LVGL 上下文调用） */
+void ser_lvgl_gen_boot_create(lv_obj_t *parent, ser_lvgl_gen_boot_t *out);
+
+#endif
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,301 @@
+#include "ser_lvgl_img.h"
+
+#include <string.h>
+
+#include "ser_img565.h"
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+static ser_lvgl_img_stats_t s_stats;
+
+void ser_lvgl_img_get_stats(ser_lvgl_img_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_lvgl_img_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#if SER_LVGL_HAS_LIB
+
+/* 解码描述符、图片缓存条目未在 lvgl.h 公开 */
+#include "src/draw/lv_image_decoder_private.h"
+#include "src/misc/cache/instance/lv_image_cache.h"
+
+/* 一次 open 的解码状态（不走缓存时） */
+typedef struct
+{
+  ser_img565_t img;
+  ser_img565_cursor_t cur;
+  lv_draw_buf_t *band; /* 条带缓冲，close 时释放 */
+} img_data_t;
+
+static lv_image_decoder_t *s_decoder = NULL;
+
+/* 是本解码器的资源则解析容器；尺寸与 lv_image_dsc_t 头不一致视为损坏 */
+static const lv_image_dsc_t *img_src(const lv_image_decoder_dsc_t *dsc,
+                                     ser_img565_t *img)
+{
+  if (dsc->src_type != LV_IMAGE_SRC_VARIABLE)
+  {
+    return NULL;
+  }
+
+  const lv_image_dsc_t *src = (const lv_image_dsc_t *)dsc->src;
+  if ((src->header.flags & SER_LVGL_IMG_FLAG) == 0u ||
+      src->header.cf != LV_COLOR_FORMAT_RGB565)
+  {
+    return NULL;
+  }
+  if (!ser_img565_open(img, src->data, src->data_size) ||
+      img->w != src->header.w || img->h != src->header.h)
+  {
+    return NULL;
+  }
+  return src;
+}
+
+static lv_result_t img_info_cb(lv_image_decoder_t *decoder,
+                               lv_image_decoder_dsc_t *dsc,
+                               lv_image_header_t *header)
+{
+  (void)decoder;
+  ser_img565_t img;
+  const lv_image_dsc_t *src = img_src(dsc, &img);
+  if (src == NULL)
+  {
+    return LV_RESULT_INVALID;
+  }
+
+  *header = src->header;
+  header->stride = (uint32_t)img.w * 2u;
+  return LV_RESULT_OK;
+}
+
+/* 整图解码进图片缓存；缓存关闭、放不下或内存不足时返回 false */
+static bool img_open_cached(lv_image_decoder_t *decoder,
+                            lv_image_decoder_dsc_t *dsc, const img_data_t *d)
+{
+  if (!lv_image_cache_is_enabled() || dsc->args.no_cache)
+  {
+    return false;
+  }
+
+  lv_draw_buf_t *buf =
+      lv_draw_buf_create_ex(lv_draw_buf_get_image_handlers(), d->img.w,
+                            d->img.h, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+  if (buf == NULL)
+  {
+    return false;
+  }
+
+  if (ser_img565_decode_area(&d->img, 0, 0, d->img.w - 1u, d->img.h - 1u,
+                             (uint16_t *)buf->data, buf->header.stride / 2u))
+  {
+    lv_image_cache_data_t key;
+    key.src_type = dsc->src_type;
+    key.src = dsc->src;
+    key.slot.size = buf->data_size;
+
+    lv_cache_entry_t *entry =
+        lv_image_decoder_add_to_cache(decoder, &key, buf, NULL);
+    if (entry != NULL)
+    {
+      dsc->decoded = buf;
+      dsc->cache_entry = entry;
+      s_stats.cached++;
+      s_stats.px += (uint64_t)d->img.w * d->img.h;
+      return true;
+    }
+  }
+
+  lv_draw_buf_destroy(buf);
+  return false;
+}
+
+static lv_result_t img_open_cb(lv_image_decoder_t *decoder,
+                               lv_image_decoder_dsc_t *dsc)
+{
+  img_data_t *d = lv_malloc_zeroed(sizeof(img_data_t));
+  if (d == NULL)
+  {
+    return LV_RESULT_INVALID;
+  }
+  if (img_src(dsc, &d->img) == NULL)
+  {
+    lv_free(d);
+    return LV_RESULT_INVALID;
+  }
+  s_stats.opens++;
+
+  if (img_open_cached(decoder, dsc, d))
+  {
+    lv_free(d);
+    return LV_RESULT_OK;
+  }
+
+  /* decoded 留空：绘制时走 get_area 逐条带解码 */
+  dsc->user_data = d;
+  return LV_RESULT_OK;
+}
+
+static lv_result_t img_get_area_cb(lv_image_decoder_t *decoder,
+                                   lv_image_decoder_dsc_t *dsc,
+                                   const lv_area_t *full_area,
+                                   lv_area_t *decoded_area)
+{
+  (void)decoder;
+  img_data_t *d = (img_data_t *)dsc->user_data;
+  if (d == NULL)
+  {
+    return LV_RESULT_INVALID;
+  }
+
+  const int32_t w = lv_area_get_width(full_area);
+  if (decoded_area->y1 == LV_COORD_MIN)
+  {
+    /* 新的裁剪区（相对图片左上角）：条带宽度即裁剪宽度 */
+    if (full_area->x1 < 0 || full_area->y1 < 0 ||
+        full_area->x2 >= (int32_t)d->img.w ||
+        full_area->y2 >= (int32_t)d->img.h || w <= 0)
+    {
+      return LV_RESULT_INVALID;
+    }
+
+    int32_t rows = lv_area_get_height(full_area);
+    if (rows > (int32_t)SER_LVGL_IMG_BAND_ROWS)
+    {
+      rows = (int32_t)SER_LVGL_IMG_BAND_ROWS;
+    }
+
+    lv_draw_buf_t *band = lv_draw_buf_reshape(d->band, LV_COLOR_FORMAT_RGB565,
+                                              (uint32_t)w, (uint32_t)rows,
+                                              LV_STRIDE_AUTO);
+    if (band == NULL)
+    {
+      if (d->band != NULL)
+      {
+        lv_draw_buf_destroy(d->band);
+      }
+      d->band = lv_draw_buf_create_ex(lv_draw_buf_get_image_handlers(),
+                                      (uint32_t)w, (uint32_t)rows,
+                                      LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+      if (d->band == NULL)
+      {
+        return LV_RESULT_INVALID;
+      }
+    }
+
+    /* 定位行原地写进条带第一行，随后第一条带的第一行也从那里接着解 */
+    if (!ser_img565_seek(&d->cur, &d->img, (uint32_t)full_area->x1,
+                         (uint32_t)full_area->x2, (uint32_t)full_area->y1,
+                         (uint16_t *)d->band->data))
+    {
+      return LV_RESULT_INVALID;
+    }
+    s_stats.rows_skipped += d->cur.skipped;
+
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = full_area->y1;
+  }
+  else
+  {
+    decoded_area->y1 = decoded_area->y2 + 1;
+  }
+
+  if (decoded_area->y1 > full_area->y2)
+  {
+    return LV_RESULT_INVALID;
+  }
+
+  int32_t rows = full_area->y2 - decoded_area->y1 + 1;
+  if (rows > (int32_t)d->band->header.h)
+  {
+    rows = (int32_t)d->band->header.h;
+  }
+  decoded_area->y2 = decoded_area->y1 + rows - 1;
+
+  /* 条带第一行的上一行就是上一条带的最后一行，仍在缓冲里 */
+  if (!ser_img565_read(&d->cur, (uint16_t *)d->band->data,
+                       d->band->header.stride / 2u, (uint32_t)rows))
+  {
+    return LV_RESULT_INVALID;
+  }
+
+  s_stats.bands++;
+  s_stats.rows += (uint32_t)rows;
+  s_stats.px += (uint64_t)rows * (uint64_t)w;
+  dsc->decoded = d->band;
+  return LV_RESULT_OK;
+}
+
+static void img_close_cb(lv_image_decoder_t *decoder,
+                         lv_image_decoder_dsc_t *dsc)
+{
+  (void)decoder;
+  img_data_t *d = (img_data_t *)dsc->user_data;
+  if (d == NULL)
+  {
+    return;
+  }
+  if (d->band != NULL)
+  {
+    lv_draw_buf_destroy(d->band);
+  }
+  lv_free(d);
+  dsc->user_data = NULL;
+}
+
+bool ser_lvgl_img_init(void)
+{
+  if (s_decoder != NULL)
+  {
+    return true;
+  }
+
+  /* 新解码器插在链表头：先于 bin 解码器认领带 SER_LVGL_IMG_FLAG 的资源 */
+  s_decoder = lv_image_decoder_create();
+  if (s_decoder == NULL)
+  {
+    return false;
+  }
+  lv_image_decoder_set_info_cb(s_decoder, img_info_cb);
+  lv_image_decoder_set_open_cb(s_decoder, img_open_cb);
+  lv_image_decoder_set_get_area_cb(s_decoder, img_get_area_cb);
+  lv_image_decoder_set_close_cb(s_decoder, img_close_cb);
+  return true;
+}
+
+lv_obj_t *ser_lvgl_img_create(lv_obj_t *parent, const lv_image_dsc_t *src)
+{
+  if (src == NULL)
+  {
+    return NULL;
+  }
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  if (obj == NULL)
+  {
+    return NULL;
+  }
+  lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_size(obj, (int32_t)src->header.w, (int32_t)src->header.h);
+  lv_obj_set_style_bg_image_src(obj, src, 0);
+  return obj;
+}
+
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：LVGL 压缩图片解码器（ser_img565 容器，见 ser_img565.h）
+ *
+ * 背景：
+ * - lv_conf.h 里 LV_USE_RLE / LV_USE_LZ4 与各图片解码库都关着（对应源码也没拷进来），
+ *   图片只能原样（w*h*2 字节）放 Flash
+ *
+ * 做法（lv_image_decoder_create 注册在 bin 解码器之前，不修改 LVGL 源码）：
+ * - 资源是普通的 lv_image_dsc_t：cf = RGB565，header.flags 带 SER_LVGL_IMG_FLAG，
+ *   data 为 ser_img565 容器；由 project/tools/img_gen.py 从 PNG 生成
+ * - 图片缓存开启（LV_CACHE_DEF_SIZE > 0）且放得下时：open 时整图解到 LVGL 堆
+ *   （SDRAM）并加入图片缓存，之后各帧直接命中缓存
+ * - 否则不在 open 时解码：绘制时 LVGL 逐次调用 get_area，每次只把裁剪区内
+ *   SER_LVGL_IMG_BAND_ROWS 行、裁剪宽度的像素解进条带缓冲，随即混合进绘制层；
+ *   裁剪区之上的行从最近的重启行开始解（最多多解 key_rows-1 行），左右窗口外不解
+ *
+ * 工程里没有 lv_image 控件：用 ser_lvgl_img_create 建一个图片大小的普通对象，
+ * 图片作为它的背景图（bg_image_src）绘制，同样经 lv_draw_image 与本解码器。
+ *
+ * 限制：旋转/缩放绘制需要整图，只在走图片缓存时正确。
+ */
+
+/* 条带行数：条带缓冲为 裁剪宽度 x BAND_ROWS 个像素 */
+#ifndef SER_LVGL_IMG_BAND_ROWS
+#define SER_LVGL_IMG_BAND_ROWS 16u
+#endif
+
+typedef struct
+{
+  uint32_t opens;        /* 实际解码的 open（不含命中缓存） */
+  uint32_t cached;       /* 整图解码并放入图片缓存 */
+  uint32_t bands;        /* get_area 解出的条带 */
+  uint32_t rows;         /* 条带内的行 */
+  uint32_t rows_skipped; /* 定位裁剪区多解的行 */
+  uint64_t px;           /* 解码输出像素（条带 + 整图） */
+} ser_lvgl_img_stats_t;
+
+void ser_lvgl_img_get_stats(ser_lvgl_img_stats_t *stats);
+void ser_lvgl_img_reset_stats(void);
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+/* lv_image_dsc_t.header.flags 中标记 ser_img565 资源 */
+#define SER_LVGL_IMG_FLAG LV_IMAGE_FLAGS_USER1
+
+/* 注册解码器（lv_init 之后、创建图片对象之前调用一次） */
+bool ser_lvgl_img_init(void);
+
+/* 创建显示 src 的对象：尺寸等于图片，不可滚动/点击；src 须在对象存续期间有效 */
+lv_obj_t *ser_lvgl_img_create(lv_obj_t *parent, const lv_image_dsc_t *src);
+
+#endif
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,95 @@
+#include "ser_lvgl_latency.h"
+
+#include "dev_lcd.h"
+#include "dri_time_us.h"
+#include "ser_latency.h"
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+#if SER_LVGL_HAS_LIB
+
+static bool s_last_pressed = false;
+static uint16_t s_last_x = 0;
+static uint16_t s_last_y = 0;
+
+/* indev 读定时器：先让 LVGL 读取并分发事件，返回即“事件处理完成” */
+static void latency_indev_timer_cb(lv_timer_t *timer)
+{
+  lv_indev_read_timer_cb(timer);
+  ser_latency_input_done(dri_time_cycles_now());
+}
+
+static void latency_display_event_cb(lv_event_t *e)
+{
+  switch (lv_event_get_code(e))
+  {
+  case LV_EVENT_REFR_START:
+    ser_latency_refr_start(dri_time_cycles_now());
+    break;
+  case LV_EVENT_REFR_READY:
+    ser_latency_refr_ready(dri_time_cycles_now());
+    break;
+  default:
+    break;
+  }
+}
+
+bool ser_lvgl_latency_attach(lv_display_t *disp, lv_indev_t *indev)
+{
+  if (disp == NULL || indev == NULL)
+  {
+    return false;
+  }
+
+  lv_timer_t *timer = lv_indev_get_read_timer(indev);
+  if (timer == NULL)
+  {
+    return false;
+  }
+
+  ser_latency_init(dri_time_hz(), dev_lcd_scanout_us);
+
+  lv_timer_set_cb(timer, latency_indev_timer_cb);
+  lv_display_add_event_cb(disp, latency_display_event_cb, LV_EVENT_REFR_START,
+                          NULL);
+  lv_display_add_event_cb(disp, latency_display_event_cb, LV_EVENT_REFR_READY,
+                          NULL);
+  return true;
+}
+
+void ser_lvgl_latency_touch(const dev_touch_sample_t *s)
+{
+  if (s == NULL)
+  {
+    return;
+  }
+
+  /* 抬起状态下坐标无意义，只比较按下/抬起的切换 */
+  bool changed = (s->pressed != s_last_pressed) ||
+                 (s->pressed && (s->x != s_last_x || s->y != s_last_y));
+  s_last_pressed = s->pressed;
+  s_last_x = s->x;
+  s_last_y = s->y;
+
+  ser_latency_input(s->t_int, s->t_read, changed);
+}
+
+void ser_lvgl_latency_flush_ready(const lv_area_t *area)
+{
+  if (area == NULL)
+  {
+    return;
+  }
+
+  ser_latency_flush(dri_time_cycles_now(), area->y1, area->y2);
+}
+
+#endif
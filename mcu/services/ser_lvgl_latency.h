@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dev_touch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：把 LVGL 的输入/刷新时间点接到 ser_latency（触摸到显示延迟）
+ *
+ * 挂接点（不修改 LVGL 源码）：
+ * - 触摸读取：indev read 回调把 dev_touch 样本（含 INT/I2C 时间戳）交给本模块，
+ *   与上一次样本比较，按下/抬起/坐标变化才开始一个延迟样本
+ * - 事件处理完成：替换 indev 读定时器回调，lv_indev_read_timer_cb 返回时打点
+ * - 刷新：display 的 LV_EVENT_REFR_START / LV_EVENT_REFR_READY
+ * - flush ready：flush 回调在 lv_display_flush_ready 之后调用 ser_lvgl_latency_flush_ready
+ * - 扫描：dev_lcd_scanout_us 读 LTDC 当前扫描行估算变化区域上屏时间
+ *
+ * 统计结果通过 ser_latency_get / ser_latency_format 查询。
+ * 只能在 LVGL 上下文调用。
+ */
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+bool ser_lvgl_latency_attach(lv_display_t *disp, lv_indev_t *indev);
+
+/* 在 indev read 回调里调用（样本坐标已是最终交给 LVGL 的坐标） */
+void ser_lvgl_latency_touch(const dev_touch_sample_t *s);
+
+/* 在 flush 回调里、lv_display_flush_ready 之后调用 */
+void ser_lvgl_latency_flush_ready(const lv_area_t *area);
+
+#endif
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
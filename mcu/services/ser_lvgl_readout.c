@@ -0,0 +1,313 @@
+#include "ser_lvgl_readout.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "ser_lvgl_style.h"
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+static ser_lvgl_readout_stats_t s_stats;
+
+#if SER_LVGL_HAS_LIB
+
+/* lv_area_intersect/lv_area_join 未在 lvgl.h 公开 */
+#include "src/misc/lv_area_private.h"
+
+typedef struct
+{
+  char text[SER_LVGL_READOUT_MAX_CHARS + 1u];
+  int16_t x[SER_LVGL_READOUT_MAX_CHARS]; /* 字形左边界（相对控件 x1） */
+  uint8_t adv[SER_LVGL_READOUT_MAX_CHARS];
+  uint8_t len;
+  uint8_t digit_w;
+  ser_lvgl_style_cache_t style; /* 绘制参数（每次重绘都要用，状态/样式变化时失效） */
+} readout_t;
+
+static bool is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static uint8_t font_digit_width(const lv_font_t *font)
+{
+  uint16_t w = 0;
+  for (char c = '0'; c <= '9'; c++)
+  {
+    uint16_t gw = lv_font_get_glyph_width(font, (uint32_t)c, 0);
+    if (gw > w)
+    {
+      w = gw;
+    }
+  }
+  return (uint8_t)w;
+}
+
+/*
+ * 计算每个字形的步进与 x 位置（居中）
+ * - 数字统一用 digit_w（等宽数字），其它字符用字体自然步进
+ */
+static void readout_layout(lv_obj_t *obj, readout_t *r)
+{
+  const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+  int32_t ls = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+
+  r->digit_w = font_digit_width(font);
+
+  int32_t x = 0;
+  for (uint32_t i = 0; i < r->len; i++)
+  {
+    char c = r->text[i];
+    uint16_t a = is_digit(c) ? r->digit_w
+                             : lv_font_get_glyph_width(font, (uint32_t)c, 0);
+    r->adv[i] = (uint8_t)a;
+    r->x[i] = (int16_t)x;
+    x += (int32_t)a + ls;
+  }
+
+  int32_t total_w = (r->len > 0u) ? (x - ls) : 0;
+  int32_t offset = (lv_obj_get_content_width(obj) - total_w) / 2;
+  for (uint32_t i = 0; i < r->len; i++)
+  {
+    r->x[i] = (int16_t)(r->x[i] + offset);
+  }
+}
+
+static void readout_glyph_area(lv_obj_t *obj, int32_t x, int32_t w,
+                               lv_area_t *area)
+{
+  lv_area_t content;
+  lv_obj_get_content_coords(obj, &content);
+
+  /* 左右各留 1px，覆盖字形少量越出步进宽度的情况 */
+  area->x1 = content.x1 + x - 1;
+  area->x2 = content.x1 + x + w;
+  area->y1 = content.y1;
+  area->y2 = content.y2;
+}
+
+static uint32_t readout_invalidate_run(lv_obj_t *obj, lv_area_t *run)
+{
+  lv_area_t coords;
+  lv_obj_get_coords(obj, &coords);
+
+  lv_area_t clipped;
+  if (!lv_area_intersect(&clipped, run, &coords))
+  {
+    return 0;
+  }
+
+  lv_obj_invalidate_area(obj, &clipped);
+  return lv_area_get_size(&clipped);
+}
+
+static void readout_event_cb(lv_event_t *e)
+{
+  lv_obj_t *obj = lv_event_get_target_obj(e);
+  readout_t *r = (readout_t *)lv_obj_get_user_data(obj);
+  lv_event_code_t code = lv_event_get_code(e);
+
+  if (code == LV_EVENT_DELETE)
+  {
+    lv_obj_set_user_data(obj, NULL);
+    lv_free(r);
+    return;
+  }
+
+  if (code != LV_EVENT_DRAW_MAIN || r == NULL || r->len == 0u)
+  {
+    return;
+  }
+
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_draw_label_dsc_t dsc = *ser_lvgl_style_cache_label(obj, &r->style);
+
+  lv_area_t content;
+  lv_obj_get_content_coords(obj, &content);
+
+  for (uint32_t i = 0; i < r->len; i++)
+  {
+    lv_area_t box;
+    readout_glyph_area(obj, r->x[i], r->adv[i], &box);
+
+    /* 只为落在本次重绘区域内的字形创建绘制任务 */
+    lv_area_t tmp;
+    if (!lv_area_intersect(&tmp, &box, &layer->_clip_area))
+    {
+      continue;
+    }
+
+    char c = r->text[i];
+    lv_point_t pt;
+    pt.x = content.x1 + r->x[i];
+    pt.y = content.y1;
+    if (is_digit(c))
+    {
+      /* 数字在等宽格内居中 */
+      uint16_t gw = lv_font_get_glyph_width(dsc.font, (uint32_t)c, 0);
+      pt.x += ((int32_t)r->digit_w - (int32_t)gw) / 2;
+    }
+    lv_draw_character(layer, &dsc, &pt, (uint32_t)(uint8_t)c);
+  }
+}
+
+lv_obj_t *ser_lvgl_readout_create(lv_obj_t *parent, uint32_t max_chars)
+{
+  if (max_chars == 0u || max_chars > SER_LVGL_READOUT_MAX_CHARS)
+  {
+    max_chars = SER_LVGL_READOUT_MAX_CHARS;
+  }
+
+  readout_t *r = (readout_t *)lv_malloc_zeroed(sizeof(readout_t));
+  if (r == NULL)
+  {
+    return NULL;
+  }
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_user_data(obj, r);
+  lv_obj_add_event_cb(obj, readout_event_cb, LV_EVENT_ALL, NULL);
+  ser_lvgl_style_cache_attach(obj, &r->style);
+
+  /* 宽度按“最宽可打印 ASCII 字形 * 字符数”预留，避免文本变长时改尺寸 */
+  const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+  uint16_t max_w = font_digit_width(font);
+  for (uint32_t c = 0x20u; c < 0x7Fu; c++)
+  {
+    uint16_t gw = lv_font_get_glyph_width(font, c, 0);
+    if (gw > max_w)
+    {
+      max_w = gw;
+    }
+  }
+  lv_obj_set_size(obj, (int32_t)(max_w * max_chars),
+                  lv_font_get_line_height(font));
+
+  return obj;
+}
+
+uint32_t ser_lvgl_readout_set_text(lv_obj_t *obj, const char *text)
+{
+  readout_t *r = (obj != NULL) ? (readout_t *)lv_obj_get_user_data(obj)
+                               : NULL;
+  if (r == NULL || text == NULL)
+  {
+    return 0;
+  }
+
+  readout_t old = *r;
+
+  uint32_t n = 0;
+  while (text[n] != '\0' && n < SER_LVGL_READOUT_MAX_CHARS)
+  {
+    r->text[n] = text[n];
+    n++;
+  }
+  r->text[n] = '\0';
+  r->len = (uint8_t)n;
+
+  /* 布局依赖控件尺寸，确保坐标已更新 */
+  lv_obj_update_layout(obj);
+  readout_layout(obj, r);
+
+  /*
+   * 逐字形比较：字符或位置变化即失效旧框 + 新框；
+   * 相邻的变化字形合并成一个区域，减少失效区数量
+   */
+  uint32_t px = 0;
+  bool in_run = false;
+  lv_area_t run = {0};
+  uint32_t count = (old.len > r->len) ? old.len : r->len;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    bool changed = (i >= old.len) || (i >= r->len) ||
+                   (old.text[i] != r->text[i]) || (old.x[i] != r->x[i]);
+    if (!changed)
+    {
+      if (in_run)
+      {
+        px += readout_invalidate_run(obj, &run);
+        in_run = false;
+      }
+      continue;
+    }
+
+    lv_area_t a;
+    bool has = false;
+    if (i < old.len)
+    {
+      readout_glyph_area(obj, old.x[i], old.adv[i], &a);
+      has = true;
+    }
+    if (i < r->len)
+    {
+      lv_area_t b;
+      readout_glyph_area(obj, r->x[i], r->adv[i], &b);
+      if (has)
+      {
+        lv_area_join(&a, &a, &b);
+      }
+      else
+      {
+        a = b;
+      }
+    }
+
+    if (in_run)
+    {
+      lv_area_join(&run, &run, &a);
+    }
+    else
+    {
+      run = a;
+      in_run = true;
+    }
+  }
+  if (in_run)
+  {
+    px += readout_invalidate_run(obj, &run);
+  }
+
+  s_stats.updates++;
+  s_stats.invalidated_px += px;
+  s_stats.last_invalid_px = px;
+  s_stats.full_px = (uint32_t)lv_obj_get_width(obj) *
+                    (uint32_t)lv_obj_get_height(obj);
+  return px;
+}
+
+uint32_t ser_lvgl_readout_set_fmt(lv_obj_t *obj, const char *fmt, ...)
+{
+  char buf[SER_LVGL_READOUT_MAX_CHARS + 1u];
+
+  va_list ap;
+  va_start(ap, fmt);
+  lv_vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+
+  return ser_lvgl_readout_set_text(obj, buf);
+}
+
+#endif /* SER_LVGL_HAS_LIB */
+
+void ser_lvgl_readout_get_stats(ser_lvgl_readout_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  *stats = s_stats;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：数值读数控件（readout）
+ *
+ * 用途：
+ * - 替代频繁 lv_label_set_text_fmt 的数值标签（如 "Dist: 123.4 cm"）
+ * - lv_label 每次改文本都会整块失效、整块重新光栅化；读数往往只变一两位数字
+ *
+ * 做法：
+ * - 数字 '0'..'9' 使用等宽（tabular）步进：取所有数字中最宽的字形宽度，
+ *   数字变化时其余字形位置不动
+ * - 设置新文本时逐字形比较（字符 + x 位置），只对变化的字形框调用
+ *   lv_obj_invalidate_area；绘制时跳过不在裁剪区内的字形
+ * - 文本居中；只有字符数变化导致整体平移时才会大范围失效
+ *
+ * 限制：
+ * - 仅支持单行 ASCII 文本，长度上限 SER_LVGL_READOUT_MAX_CHARS
+ * - 字体/颜色/透明度/字间距取自对象的 text 样式（LV_PART_MAIN），绘制参数按对象缓存：
+ *   运行中用 lv_obj_set_style_text_color 等改本地文本属性后需调用
+ *   ser_lvgl_style_cache_invalidate（见 ser_lvgl_style.h）
+ *
+ * 只能在 LVGL 上下文调用。
+ */
+
+#ifndef SER_LVGL_READOUT_MAX_CHARS
+#define SER_LVGL_READOUT_MAX_CHARS 24u
+#endif
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+/*
+ * 创建读数控件：
+ * - max_chars 用于确定控件宽度（按最宽字形估算），高度为一行
+ * - 创建后再设置 text 样式时，需要重新调用 ser_lvgl_readout_set_text 刷新布局
+ */
+lv_obj_t *ser_lvgl_readout_create(lv_obj_t *parent, uint32_t max_chars);
+
+/* 设置文本；返回本次失效的像素数（0 表示文本未变化） */
+uint32_t ser_lvgl_readout_set_text(lv_obj_t *obj, const char *text);
+
+/* printf 风格设置文本 */
+uint32_t ser_lvgl_readout_set_fmt(lv_obj_t *obj, const char *fmt, ...);
+
+#endif
+#endif
+
+typedef struct
+{
+  uint32_t updates;          /* set_text 次数 */
+  uint32_t invalidated_px;   /* 累计失效像素 */
+  uint32_t last_invalid_px;  /* 最近一次失效像素 */
+  uint32_t full_px;          /* 整个控件的像素数（作为对比基准） */
+} ser_lvgl_readout_stats_t;
+
+/* 所有 readout 控件的累计统计 */
+void ser_lvgl_readout_get_stats(ser_lvgl_readout_stats_t *stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
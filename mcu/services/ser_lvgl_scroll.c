@@ -0,0 +1,527 @@
+#include "ser_lvgl_scroll.h"
+
+#include <string.h>
+
+#include "dev_lcd.h"
+#include "ser_lvgl_damage.h"
+#if defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE
+#include "ser_fbstream.h"
+#endif
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+static ser_lvgl_scroll_stats_t s_stats;
+
+void ser_lvgl_scroll_get_stats(ser_lvgl_scroll_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_lvgl_scroll_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#if SER_LVGL_HAS_LIB
+
+/* 显示缓冲、inv_areas、spec_attr 未在 lvgl.h 公开 */
+#include "src/core/lv_obj_draw_private.h"
+#include "src/core/lv_obj_private.h"
+#include "src/display/lv_display_private.h"
+#include "src/misc/lv_area_private.h"
+
+typedef struct
+{
+  lv_obj_t *obj;
+  int32_t sx; /* 上次事件时的滚动位置 */
+  int32_t sy;
+  lv_area_t sb_hor; /* 上次事件时的滚动条区域 */
+  lv_area_t sb_ver;
+} scroll_slot_t;
+
+static scroll_slot_t s_slot[SER_LVGL_SCROLL_MAX];
+static lv_display_t *s_disp = NULL;
+
+/* 搬移前的待刷新区域快照 */
+static lv_area_t s_pending[LV_INV_BUF_SIZE];
+
+static bool area_valid(const lv_area_t *a)
+{
+  return a->x1 <= a->x2 && a->y1 <= a->y2;
+}
+
+static uint32_t area_px(const lv_area_t *a)
+{
+  return area_valid(a) ? (uint32_t)lv_area_get_size(a) : 0u;
+}
+
+static void mark(const lv_area_t *a)
+{
+  if (area_valid(a) && ser_lvgl_damage_mark_exact(s_disp, a))
+  {
+    s_stats.px_exposed += area_px(a);
+  }
+}
+
+/* a 与 clip 的交集精确失效 */
+static void mark_clipped(const lv_area_t *a, const lv_area_t *clip)
+{
+  lv_area_t c;
+  if (area_valid(a) && lv_area_intersect(&c, a, clip))
+  {
+    mark(&c);
+  }
+}
+
+static bool copy_rect(uint16_t *fb, uint32_t stride, const lv_area_t *dst,
+                      int32_t dx, int32_t dy)
+{
+  const uint32_t w = (uint32_t)lv_area_get_width(dst);
+  const uint32_t h = (uint32_t)lv_area_get_height(dst);
+  uint16_t *d = fb + (uint32_t)dst->y1 * stride + (uint32_t)dst->x1;
+  const uint16_t *s =
+      fb + (uint32_t)(dst->y1 - dy) * stride + (uint32_t)(dst->x1 - dx);
+
+  s_stats.copies++;
+  return dev_lcd_copy_rgb565(d, s, w, h, stride);
+}
+
+/*
+ * 把帧缓冲中 dst - (dx, dy) 的像素原地搬到 dst
+ * - 目的地址低于源（向上、同行向左）：一次拷贝
+ * - 向下：自下而上按 dy 行分块，每块源与目的不重叠
+ * - 同行向右：自右向左按 dx 列分块
+ * 某块拷贝失败即停止并返回 false（dst 内容已不可用）
+ */
+static bool move_pixels(uint16_t *fb, uint32_t stride, const lv_area_t *dst,
+                        int32_t dx, int32_t dy)
+{
+  if (dy < 0 || (dy == 0 && dx < 0))
+  {
+    return copy_rect(fb, stride, dst, dx, dy);
+  }
+
+  lv_area_t band = *dst;
+  if (dy > 0)
+  {
+    for (int32_t y2 = dst->y2; y2 >= dst->y1; y2 -= dy)
+    {
+      band.y2 = y2;
+      band.y1 = LV_MAX(y2 - dy + 1, dst->y1);
+      if (!copy_rect(fb, stride, &band, dx, dy))
+      {
+        return false;
+      }
+    }
+  }
+  else
+  {
+    for (int32_t x2 = dst->x2; x2 >= dst->x1; x2 -= dx)
+    {
+      band.x2 = x2;
+      band.x1 = LV_MAX(x2 - dx + 1, dst->x1);
+      if (!copy_rect(fb, stride, &band, dx, dy))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/* LVGL 随后 lv_obj_invalidate(obj) 时传给 lv_inv_area 的区域（与其计算一致） */
+static bool full_invalidate_area(lv_obj_t *obj, lv_area_t *out)
+{
+  int32_t ext = lv_obj_get_ext_draw_size(obj);
+  lv_obj_get_coords(obj, out);
+  lv_area_increase(out, ext, ext);
+  if (!lv_obj_area_is_visible(obj, out))
+  {
+    return false;
+  }
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+  lv_area_increase(out, 5, 5);
+#endif
+
+  const lv_area_t scr = {0, 0, lv_display_get_horizontal_resolution(s_disp) - 1,
+                         lv_display_get_vertical_resolution(s_disp) - 1};
+  return lv_area_intersect(out, out, &scr);
+}
+
+/* 在 obj 之后绘制、与 r 相交的对象（兄弟、祖先的兄弟、top/sys 层） */
+static bool occluded(lv_obj_t *obj, const lv_area_t *r)
+{
+  for (lv_obj_t *o = obj; lv_obj_get_parent(o) != NULL; o = lv_obj_get_parent(o))
+  {
+    lv_obj_t *parent = lv_obj_get_parent(o);
+    uint32_t n = lv_obj_get_child_count(parent);
+    for (uint32_t i = (uint32_t)lv_obj_get_index(o) + 1u; i < n; i++)
+    {
+      lv_obj_t *sib = lv_obj_get_child(parent, (int32_t)i);
+      if (lv_obj_has_flag(sib, LV_OBJ_FLAG_HIDDEN))
+      {
+        continue;
+      }
+      lv_area_t a;
+      int32_t ext = lv_obj_get_ext_draw_size(sib);
+      lv_obj_get_coords(sib, &a);
+      lv_area_increase(&a, ext, ext);
+      if (lv_area_is_on(&a, r))
+      {
+        return true;
+      }
+    }
+  }
+
+  lv_obj_t *layers[2] = {lv_display_get_layer_top(s_disp),
+                         lv_display_get_layer_sys(s_disp)};
+  for (uint32_t l = 0; l < 2u; l++)
+  {
+    lv_obj_t *layer = layers[l];
+    if (layer == NULL)
+    {
+      continue;
+    }
+    if (lv_obj_get_style_bg_opa(layer, LV_PART_MAIN) != LV_OPA_TRANSP)
+    {
+      return true;
+    }
+    uint32_t n = lv_obj_get_child_count(layer);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      lv_obj_t *c = lv_obj_get_child(layer, (int32_t)i);
+      if (lv_obj_has_flag(c, LV_OBJ_FLAG_HIDDEN))
+      {
+        continue;
+      }
+      lv_area_t a;
+      int32_t ext = lv_obj_get_ext_draw_size(c);
+      lv_obj_get_coords(c, &a);
+      lv_area_increase(&a, ext, ext);
+      if (lv_area_is_on(&a, r))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/*
+ * 纯平移检查；通过时给出可见区域 vis（容器坐标裁剪到祖先）
+ * 与内容区 r（再去掉边框与圆角）
+ */
+static bool translatable(lv_obj_t *obj, lv_area_t *vis, lv_area_t *r)
+{
+  /* ser_lvgl 旋转显示时切到 PARTIAL，帧缓冲不再是渲染目标 */
+  if (s_disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT ||
+      s_disp->rendering_in_progress || s_disp->prev_scr != NULL ||
+      lv_obj_get_screen(obj) != lv_display_get_screen_active(s_disp))
+  {
+    return false;
+  }
+
+  for (lv_obj_t *o = obj; o != NULL; o = lv_obj_get_parent(o))
+  {
+    if (lv_obj_get_layer_type(o) != LV_LAYER_TYPE_NONE)
+    {
+      return false;
+    }
+  }
+  if (lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) != LV_OPA_COVER ||
+      lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) ||
+      lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) != LV_OPA_COVER ||
+      lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE ||
+      lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL)
+  {
+    return false;
+  }
+
+  uint32_t n = lv_obj_get_child_count(obj);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    lv_obj_t *c = lv_obj_get_child(obj, (int32_t)i);
+    if (lv_obj_has_flag(c, LV_OBJ_FLAG_FLOATING) &&
+        !lv_obj_has_flag(c, LV_OBJ_FLAG_HIDDEN))
+    {
+      return false;
+    }
+  }
+
+  lv_obj_get_coords(obj, vis);
+  if (!lv_obj_area_is_visible(obj, vis))
+  {
+    return false;
+  }
+
+  int32_t inset = lv_obj_get_style_border_width(obj, LV_PART_MAIN) +
+                  LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN),
+                         LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj)) / 2);
+  lv_obj_get_coords(obj, r);
+  lv_area_increase(r, -inset, -inset);
+  if (!lv_area_intersect(r, r, vis))
+  {
+    return false;
+  }
+
+  return !occluded(obj, r);
+}
+
+static scroll_slot_t *slot_of(const lv_obj_t *obj)
+{
+  for (uint32_t i = 0; i < SER_LVGL_SCROLL_MAX; i++)
+  {
+    if (s_slot[i].obj == obj)
+    {
+      return &s_slot[i];
+    }
+  }
+  return NULL;
+}
+
+/*
+ * 执行搬移并精确失效；返回 false 时由 LVGL 整块重绘
+ * （只有拷贝中途失败时帧缓冲已被改动，改动限于内容区，整块重绘会覆盖）
+ * - vis / r 见 translatable，(dx, dy) 为内容在屏幕上的位移
+ */
+static bool blit_scroll(scroll_slot_t *sl, const lv_area_t *vis,
+                        const lv_area_t *r, int32_t dx, int32_t dy)
+{
+  lv_display_t *disp = s_disp;
+
+  if (LV_ABS(dx) >= lv_area_get_width(r) || LV_ABS(dy) >= lv_area_get_height(r))
+  {
+    return false;
+  }
+
+  /* 内容区已被整块标脏（样式刷新等）：本来就要重绘，搬移没有意义 */
+  const uint32_t pending_n = disp->inv_p;
+  for (uint32_t i = 0; i < pending_n; i++)
+  {
+    if (lv_area_is_in(r, &disp->inv_areas[i], 0))
+    {
+      return false;
+    }
+  }
+
+  lv_draw_buf_t *fb = disp->buf_act;
+
+  lv_area_t full;
+  if (!full_invalidate_area(sl->obj, &full))
+  {
+    return false;
+  }
+
+  memcpy(s_pending, disp->inv_areas, pending_n * sizeof(lv_area_t));
+
+  /* 目的区域：内容区中源像素也在内容区内的部分 */
+  lv_area_t dst = *r;
+  if (dx > 0)
+    dst.x1 += dx;
+  else
+    dst.x2 += dx;
+  if (dy > 0)
+    dst.y1 += dy;
+  else
+    dst.y2 += dy;
+
+  if (!move_pixels((uint16_t *)fb->data, fb->header.stride / sizeof(uint16_t),
+                   &dst, dx, dy))
+  {
+    s_stats.copy_failed++;
+    return false;
+  }
+  s_stats.px_moved += area_px(&dst);
+#if defined(SER_FBSTREAM_ENABLE) && SER_FBSTREAM_ENABLE
+  /* 搬移不经过 flush：远端画面同样要更新（无旋转，逻辑坐标即物理坐标） */
+  ser_fbstream_mark(dst.x1, dst.y1, dst.x2, dst.y2);
+#endif
+
+  /* 露出的窄条（至多两条，L 形） */
+  lv_area_t strip = *r;
+  if (dy > 0)
+  {
+    strip.y2 = r->y1 + dy - 1;
+    mark(&strip);
+  }
+  else if (dy < 0)
+  {
+    strip.y1 = r->y2 + dy + 1;
+    mark(&strip);
+  }
+  strip = *r;
+  if (dx > 0)
+  {
+    strip.x2 = r->x1 + dx - 1;
+    mark(&strip);
+  }
+  else if (dx < 0)
+  {
+    strip.x1 = r->x2 + dx + 1;
+    mark(&strip);
+  }
+
+  /* 可见区域中内容区以外的部分（边框、圆角）：子对象在这里也移动了 */
+  lv_area_t edges[4];
+  int8_t edge_n = lv_area_diff(edges, vis, r);
+  for (int8_t i = 0; i < edge_n; i++)
+  {
+    mark(&edges[i]);
+  }
+
+  /* 还没渲染的旧失效：过期像素被搬到了平移后的位置 */
+  for (uint32_t i = 0; i < pending_n; i++)
+  {
+    lv_area_t a;
+    if (lv_area_intersect(&a, &s_pending[i], r))
+    {
+      lv_area_move(&a, dx, dy);
+      mark_clipped(&a, r);
+    }
+  }
+
+  /* 滚动条：旧位置、被搬走的旧像素、新位置 */
+  lv_area_t hor, ver;
+  lv_obj_get_scrollbar_area(sl->obj, &hor, &ver);
+  const lv_area_t *bars[4] = {&sl->sb_hor, &sl->sb_ver, &hor, &ver};
+  for (uint32_t i = 0; i < 4u; i++)
+  {
+    if (!area_valid(bars[i]))
+    {
+      continue;
+    }
+    mark_clipped(bars[i], r);
+    if (i < 2u)
+    {
+      lv_area_t moved = *bars[i];
+      lv_area_move(&moved, dx, dy);
+      mark_clipped(&moved, r);
+    }
+  }
+
+  ser_lvgl_damage_ignore_once(&full);
+  s_stats.px_replaced += area_px(&full);
+  return true;
+}
+
+static void scroll_cb(lv_event_t *e)
+{
+  scroll_slot_t *sl = (scroll_slot_t *)lv_event_get_user_data(e);
+  lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
+  if (sl == NULL || obj != sl->obj)
+  {
+    return;
+  }
+
+  const int32_t sx = lv_obj_get_scroll_x(obj);
+  const int32_t sy = lv_obj_get_scroll_y(obj);
+  const int32_t dx = sl->sx - sx;
+  const int32_t dy = sl->sy - sy;
+  s_stats.scrolls++;
+
+  lv_area_t vis, r;
+  if (s_disp != NULL && (dx != 0 || dy != 0) && translatable(obj, &vis, &r) &&
+      blit_scroll(sl, &vis, &r, dx, dy))
+  {
+    s_stats.blits++;
+  }
+  else
+  {
+    s_stats.fallbacks++;
+  }
+
+  sl->sx = sx;
+  sl->sy = sy;
+  lv_obj_get_scrollbar_area(obj, &sl->sb_hor, &sl->sb_ver);
+}
+
+static void delete_cb(lv_event_t *e)
+{
+  scroll_slot_t *sl = (scroll_slot_t *)lv_event_get_user_data(e);
+  if (sl != NULL && lv_event_get_target(e) == sl->obj)
+  {
+    sl->obj = NULL;
+  }
+}
+
+/* REFR_START：未被消费的 ignore_once 作废（LVGL 的整块失效没有发生） */
+static void display_cb(lv_event_t *e)
+{
+  (void)e;
+  ser_lvgl_damage_ignore_once(NULL);
+}
+
+bool ser_lvgl_scroll_init(lv_display_t *disp)
+{
+  if (disp == NULL || s_disp != NULL ||
+      disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT ||
+      lv_display_get_color_format(disp) != LV_COLOR_FORMAT_RGB565 ||
+      lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0 ||
+      disp->buf_act == NULL || disp->buf_2 != NULL)
+  {
+    return false;
+  }
+
+  /* 探测是否已挂接瓦片脏区（空区域不会产生失效） */
+  const lv_area_t probe = {0, 0, -1, -1};
+  if (!ser_lvgl_damage_mark_exact(disp, &probe))
+  {
+    return false;
+  }
+
+  lv_display_add_event_cb(disp, display_cb, LV_EVENT_REFR_START, NULL);
+  s_disp = disp;
+  return true;
+}
+
+bool ser_lvgl_scroll_attach(lv_obj_t *obj)
+{
+  if (s_disp == NULL || obj == NULL || lv_obj_get_display(obj) != s_disp)
+  {
+    return false;
+  }
+  if (slot_of(obj) != NULL)
+  {
+    return true;
+  }
+
+  scroll_slot_t *sl = slot_of(NULL);
+  if (sl == NULL)
+  {
+    return false;
+  }
+
+  sl->obj = obj;
+  sl->sx = lv_obj_get_scroll_x(obj);
+  sl->sy = lv_obj_get_scroll_y(obj);
+  lv_obj_get_scrollbar_area(obj, &sl->sb_hor, &sl->sb_ver);
+  lv_obj_add_event_cb(obj, scroll_cb, LV_EVENT_SCROLL, sl);
+  lv_obj_add_event_cb(obj, delete_cb, LV_EVENT_DELETE, sl);
+  return true;
+}
+
+void ser_lvgl_scroll_detach(lv_obj_t *obj)
+{
+  scroll_slot_t *sl = (obj != NULL) ? slot_of(obj) : NULL;
+  if (sl == NULL)
+  {
+    return;
+  }
+
+  (void)lv_obj_remove_event_cb_with_user_data(obj, scroll_cb, sl);
+  (void)lv_obj_remove_event_cb_with_user_data(obj, delete_cb, sl);
+  sl->obj = NULL;
+}
+
+#endif
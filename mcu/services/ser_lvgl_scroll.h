@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：LVGL 滚动加速（搬移帧缓冲中已渲染的像素，只渲染新露出的窄条）
+ *
+ * 背景：
+ * - lv_obj_scroll_by_raw 移动子对象后 lv_obj_invalidate 整个容器，
+ *   每滚动一步都要重新渲染整个可视区域（列表、长文本几十万像素）
+ *
+ * 做法（挂在 LV_EVENT_SCROLL 上，不修改 LVGL 源码）：
+ * - 滚动事件在子对象坐标已更新、整块失效之前发出：这时把容器内容区已渲染的像素
+ *   按滚动位移搬移（DMA2D，忙时 CPU；重叠方向不安全时按位移拆成多块），
+ *   露出的窄条、容器边框/圆角区、新旧滚动条用 ser_lvgl_damage_mark_exact 精确失效，
+ *   随后 LVGL 自己的整块失效由 ser_lvgl_damage_ignore_once 丢弃
+ * - 搬移之前还没渲染的失效区域（内容是旧的）随像素一起被搬走，平移后的位置同样失效
+ * - DMA2D 搬移中途失败（内容区已部分改写）时不做精确失效，保留 LVGL 的整块失效
+ * - 只用于 DIRECT 单缓冲（ser_lvgl 的帧缓冲直写）：帧缓冲内原地搬移；
+ *   固件没有换页，双缓冲 DIRECT 不会出现，init 直接拒绝；
+ *   之后 display 切到其它渲染模式（ser_lvgl 旋转显示）期间退回整块重绘
+ *
+ * 只在“纯平移”时搬移，否则退回整块重绘：
+ * - 容器背景不透明、无渐变/背景图，无 opa/变换/混合层（含祖先），不溢出显示子对象，
+ *   没有浮动（FLOATING）子对象
+ * - 内容区（去掉边框与圆角）不被后绘制的兄弟对象、top/sys 层遮挡，不在切屏动画中
+ * - 位移小于内容区尺寸，且内容区没有被整块标脏（例如滚动开始时的状态样式刷新）
+ * - 容器自己只画背景、边框与滚动条（普通容器、lv_list、lv_textarea 等）；
+ *   自绘内容不随子对象移动的控件不要 attach
+ *
+ * 只能在 LVGL 上下文调用。
+ */
+
+/* 可同时 attach 的容器数 */
+#ifndef SER_LVGL_SCROLL_MAX
+#define SER_LVGL_SCROLL_MAX 4u
+#endif
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+/*
+ * 挂接到 display（在 ser_lvgl_damage_attach 成功之后）：
+ * - 只支持 DIRECT 模式、RGB565、无旋转、单缓冲，否则返回 false
+ */
+bool ser_lvgl_scroll_init(lv_display_t *disp);
+
+/* 为容器启用滚动搬移；容器删除时自动解除 */
+bool ser_lvgl_scroll_attach(lv_obj_t *obj);
+void ser_lvgl_scroll_detach(lv_obj_t *obj);
+
+#endif
+#endif
+
+typedef struct
+{
+  uint32_t scrolls;     /* attach 容器收到的滚动事件 */
+  uint32_t blits;       /* 以搬移代替整块重绘的次数 */
+  uint32_t fallbacks;   /* 不满足条件、整块重绘的次数 */
+  uint32_t copies;      /* 拷贝调用次数（重叠拆块后） */
+  uint32_t copy_failed; /* 拷贝中途失败、退回整块重绘的次数（计入 fallbacks） */
+  uint64_t px_moved;    /* 搬移的像素 */
+  uint64_t px_exposed;  /* 精确失效的像素（露出窄条、边框、滚动条、平移的旧失效） */
+  uint64_t px_replaced; /* 被丢弃的整块失效的像素 */
+} ser_lvgl_scroll_stats_t;
+
+void ser_lvgl_scroll_get_stats(ser_lvgl_scroll_stats_t *stats);
+void ser_lvgl_scroll_reset_stats(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,107 @@
+#include "ser_lvgl_style.h"
+
+#include <stddef.h>
+
+static ser_lvgl_style_cache_stats_t s_cache_stats;
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+
+/*
+ * 展开样式表：
+ * - s_<name>_props：属性数组（以 LV_STYLE_CONST_PROPS_END 结尾）
+ * - ser_lvgl_style_<name>：指向该数组的常量样式
+ */
+#define SER_LVGL_STYLE_DEFINE(name, ...)                                       \
+  static const lv_style_const_prop_t s_##name##_props[] = {                    \
+      __VA_ARGS__, LV_STYLE_CONST_PROPS_END};                                  \
+  LV_STYLE_CONST_INIT(ser_lvgl_style_##name, s_##name##_props);
+
+SER_LVGL_STYLE_TABLE(SER_LVGL_STYLE_DEFINE)
+
+#undef SER_LVGL_STYLE_DEFINE
+
+static void style_cache_event_cb(lv_event_t *e)
+{
+  ser_lvgl_style_cache_t *cache =
+      (ser_lvgl_style_cache_t *)lv_event_get_user_data(e);
+  if (cache->valid)
+  {
+    cache->valid = false;
+    s_cache_stats.invalidations++;
+  }
+}
+
+void ser_lvgl_style_cache_attach(lv_obj_t *obj, ser_lvgl_style_cache_t *cache)
+{
+  if (obj == NULL || cache == NULL)
+  {
+    return;
+  }
+
+  cache->valid = false;
+  lv_obj_add_event_cb(obj, style_cache_event_cb, LV_EVENT_STYLE_CHANGED, cache);
+}
+
+const lv_draw_label_dsc_t *ser_lvgl_style_cache_label(lv_obj_t *obj,
+                                                      ser_lvgl_style_cache_t *cache)
+{
+  const lv_state_t state = lv_obj_get_state(obj);
+  if (!cache->valid || cache->state != state)
+  {
+    cache->state = state;
+    lv_draw_label_dsc_init(&cache->label);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &cache->label);
+    cache->valid = true;
+    s_cache_stats.misses++;
+  }
+  else
+  {
+    s_cache_stats.hits++;
+  }
+  return &cache->label;
+}
+
+void ser_lvgl_style_cache_invalidate(lv_obj_t *obj)
+{
+  if (obj == NULL)
+  {
+    return;
+  }
+
+  const uint32_t n = lv_obj_get_event_count(obj);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    lv_event_dsc_t *dsc = lv_obj_get_event_dsc(obj, i);
+    if (lv_event_dsc_get_cb(dsc) == style_cache_event_cb)
+    {
+      ser_lvgl_style_cache_t *cache =
+          (ser_lvgl_style_cache_t *)lv_event_dsc_get_user_data(dsc);
+      if (cache->valid)
+      {
+        cache->valid = false;
+        s_cache_stats.invalidations++;
+      }
+      break;
+    }
+  }
+
+  const uint32_t children = lv_obj_get_child_count(obj);
+  for (uint32_t i = 0; i < children; i++)
+  {
+    ser_lvgl_style_cache_invalidate(lv_obj_get_child(obj, (int32_t)i));
+  }
+}
+
+#endif
+#endif
+
+void ser_lvgl_style_cache_get_stats(ser_lvgl_style_cache_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  *stats = s_cache_stats;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：编译期常量样式（const lv_style_t，位于 Flash）
+ *
+ * 背景：
+ * - lv_obj_set_style_* 每调用一次都会在 LVGL heap（SDRAM）里新增/扩展对象的本地样式，
+ *   启动界面几十次调用 = 几十次分配；绘制时属性查找也要遍历这些本地样式
+ *
+ * 做法：
+ * - 样式在 ser_lvgl_style_table.h 里声明式描述，预处理器展开为常量样式表
+ * - 对象创建时 lv_obj_add_style(obj, &ser_lvgl_style_xxx, 0) 一次挂上，
+ *   不分配样式内存，查找时每个对象只需遍历一个紧凑的常量属性数组
+ *
+ * 解析结果缓存（服务层自绘控件用，如 readout）：
+ * - LVGL 绘制时逐个属性查找：遍历对象的样式列表，文本属性沿父对象继承，
+ *   透明度/重着色沿父链累乘；自绘控件每次重绘都要解析一整套
+ * - 缓存挂在对象上，按对象状态（lv_state_t）做键，收到 LV_EVENT_STYLE_CHANGED 时失效：
+ *   LVGL 9.4 没有单独的状态变化事件，影响样式的状态切换、增删样式、
+ *   lv_obj_report_style_change、影响布局的属性（字体等）都发 STYLE_CHANGED，
+ *   父对象的同类变化会转发给子对象
+ * - LVGL 对“不影响布局的单个本地属性”不发事件（lv_obj_set_style_text_color、
+ *   祖先的 opa/recolor、样式过渡动画）：运行中改这类属性后需调用
+ *   ser_lvgl_style_cache_invalidate
+ */
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+/* 常量颜色：0xRRGGBB -> lv_color_t 初始化器 */
+#define SER_LVGL_HEX(c)                                                        \
+  LV_COLOR_MAKE((uint8_t)(((c) >> 16) & 0xFFu), (uint8_t)(((c) >> 8) & 0xFFu), \
+                (uint8_t)((c) & 0xFFu))
+
+#include "ser_lvgl_style_table.h"
+
+#define SER_LVGL_STYLE_DECLARE(name, ...) extern const lv_style_t ser_lvgl_style_##name;
+SER_LVGL_STYLE_TABLE(SER_LVGL_STYLE_DECLARE)
+#undef SER_LVGL_STYLE_DECLARE
+
+typedef struct
+{
+  lv_draw_label_dsc_t label; /* LV_PART_MAIN 的文本绘制参数 */
+  lv_state_t state;          /* 解析时的对象状态 */
+  bool valid;
+} ser_lvgl_style_cache_t;
+
+/* 把缓存挂到对象上（cache 的生命周期不短于对象，一般放在控件的 user_data 里） */
+void ser_lvgl_style_cache_attach(lv_obj_t *obj, ser_lvgl_style_cache_t *cache);
+
+/* 取文本绘制参数；未命中时用 lv_obj_init_draw_label_dsc 解析并缓存 */
+const lv_draw_label_dsc_t *ser_lvgl_style_cache_label(lv_obj_t *obj,
+                                                      ser_lvgl_style_cache_t *cache);
+
+/* 让对象及其子对象上挂的缓存失效 */
+void ser_lvgl_style_cache_invalidate(lv_obj_t *obj);
+
+#endif
+#endif
+
+typedef struct
+{
+  uint32_t hits;
+  uint32_t misses;        /* 重新解析次数 */
+  uint32_t invalidations; /* 事件或显式调用导致的失效次数 */
+} ser_lvgl_style_cache_stats_t;
+
+void ser_lvgl_style_cache_get_stats(ser_lvgl_style_cache_stats_t *stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
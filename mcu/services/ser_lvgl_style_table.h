@@ -0,0 +1,83 @@
+#pragma once
+
+/*
+ * services/ 层：启动界面样式表（声明式描述）
+ *
+ * 每一项 X(name, props...) 在编译期展开为：
+ * - 一个 const lv_style_const_prop_t 数组（位于 Flash）
+ * - 一个 const lv_style_t ser_lvgl_style_<name>
+ *
+ * 约定：
+ * - 只放“创建后不变”的属性；运行中会变的属性（动画透明度、随距离变化的颜色、
+ *   依赖屏幕尺寸的宽高）仍用 lv_obj_set_style_* 本地样式
+ * - 颜色用 SER_LVGL_HEX(0xRRGGBB)，保证是常量表达式
+ * - pad_all 在这里需要拆成 4 个方向
+ *
+ * 本文件只能被 ser_lvgl_style.h / ser_lvgl_style.c 包含。
+ */
+
+// clang-format off
+#define SER_LVGL_STYLE_TABLE(X)                                                \
+  X(screen,                                                                    \
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),                                       \
+    LV_STYLE_CONST_BG_COLOR(SER_LVGL_HEX(0x0B1020)),                           \
+    LV_STYLE_CONST_BG_GRAD_COLOR(SER_LVGL_HEX(0x121A33)),                      \
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER))                               \
+                                                                               \
+  /* 尺寸上限：大屏上卡片不超过 520x320（宽高百分比见 ui/boot.xml） */       \
+  X(card,                                                                      \
+    LV_STYLE_CONST_MAX_WIDTH(520),                                             \
+    LV_STYLE_CONST_MAX_HEIGHT(320),                                            \
+    LV_STYLE_CONST_RADIUS(22),                                                 \
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),                                       \
+    LV_STYLE_CONST_BG_COLOR(SER_LVGL_HEX(0x16213E)),                           \
+    LV_STYLE_CONST_BG_GRAD_COLOR(SER_LVGL_HEX(0x1E2B52)),                      \
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),                               \
+    LV_STYLE_CONST_BORDER_WIDTH(1),                                            \
+    LV_STYLE_CONST_BORDER_COLOR(SER_LVGL_HEX(0x2B3A67)),                       \
+    LV_STYLE_CONST_SHADOW_WIDTH(24),                                           \
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),                                      \
+    LV_STYLE_CONST_SHADOW_COLOR(SER_LVGL_HEX(0x000000)),                       \
+    LV_STYLE_CONST_PAD_TOP(24),                                                \
+    LV_STYLE_CONST_PAD_BOTTOM(24),                                             \
+    LV_STYLE_CONST_PAD_LEFT(24),                                               \
+    LV_STYLE_CONST_PAD_RIGHT(24),                                              \
+    LV_STYLE_CONST_PAD_ROW(10))                                                \
+                                                                               \
+  /* LVGL v9.4.0 不支持对角渐变方向，使用径向渐变来增强“徽章”质感 */          \
+  X(badge,                                                                     \
+    LV_STYLE_CONST_RADIUS(32),                                                 \
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),                                       \
+    LV_STYLE_CONST_BG_COLOR(SER_LVGL_HEX(0x3D7BFF)),                           \
+    LV_STYLE_CONST_BG_GRAD_COLOR(SER_LVGL_HEX(0x67D7FF)),                      \
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_RADIAL),                            \
+    LV_STYLE_CONST_BORDER_WIDTH(0),                                            \
+    LV_STYLE_CONST_SHADOW_WIDTH(18),                                           \
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),                                      \
+    LV_STYLE_CONST_SHADOW_COLOR(SER_LVGL_HEX(0x3D7BFF)))                       \
+                                                                               \
+  X(title,                                                                     \
+    LV_STYLE_CONST_TEXT_COLOR(SER_LVGL_HEX(0xFFFFFF)),                         \
+    LV_STYLE_CONST_TEXT_LETTER_SPACE(2))                                       \
+                                                                               \
+  X(subtitle,                                                                  \
+    LV_STYLE_CONST_TEXT_COLOR(SER_LVGL_HEX(0xB8C7FF)),                         \
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_90),                                        \
+    LV_STYLE_CONST_TEXT_LETTER_SPACE(1))                                       \
+                                                                               \
+  X(readout,                                                                   \
+    LV_STYLE_CONST_TEXT_COLOR(SER_LVGL_HEX(0xE6EEFF)),                         \
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_90),                                        \
+    LV_STYLE_CONST_TEXT_LETTER_SPACE(1))                                       \
+                                                                               \
+  X(bar_bg,                                                                    \
+    LV_STYLE_CONST_RADIUS(6),                                                  \
+    LV_STYLE_CONST_BG_OPA(LV_OPA_30),                                          \
+    LV_STYLE_CONST_BG_COLOR(SER_LVGL_HEX(0x0A1024)),                           \
+    LV_STYLE_CONST_BORDER_WIDTH(0))                                            \
+                                                                               \
+  X(bar_fill,                                                                  \
+    LV_STYLE_CONST_RADIUS(6),                                                  \
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_HOR),                               \
+    LV_STYLE_CONST_BORDER_WIDTH(0))
+// clang-format on
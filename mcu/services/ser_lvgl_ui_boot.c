@@ -0,0 +1,236 @@
+#include "ser_lvgl_ui_boot.h"
+
+#include <stdbool.h>
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#define SER_LVGL_HAS_LIB 1
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+#else
+#define SER_LVGL_HAS_LIB 0
+#endif
+
+#if SER_LVGL_HAS_LIB
+#include "ser_lvgl_anim.h"
+#include "ser_lvgl_gen_boot.h"
+#include "ser_lvgl_readout.h"
+#include "ser_lvgl_style.h"
+
+static uint32_t ui_clamp_u32(uint32_t v, uint32_t lo, uint32_t hi)
+{
+  if (v < lo)
+    return lo;
+  if (v > hi)
+    return hi;
+  return v;
+}
+
+static lv_color_t ui_color_lerp(lv_color_t a, lv_color_t b, uint32_t t_0_1000)
+{
+  uint32_t t = ui_clamp_u32(t_0_1000, 0u, 1000u);
+  uint32_t ia = 1000u - t;
+  uint32_t r = (uint32_t)a.red * ia + (uint32_t)b.red * t;
+  uint32_t g = (uint32_t)a.green * ia + (uint32_t)b.green * t;
+  uint32_t bl = (uint32_t)a.blue * ia + (uint32_t)b.blue * t;
+  return lv_color_make((uint8_t)(r / 1000u), (uint8_t)(g / 1000u),
+                       (uint8_t)(bl / 1000u));
+}
+
+static void ui_bar_set_color(ser_lvgl_ui_boot_t *ui, uint32_t mm, bool valid)
+{
+  if (ui == NULL || ui->bar_fill == NULL)
+  {
+    return;
+  }
+
+  if (!valid)
+  {
+    lv_obj_set_style_bg_color(ui->bar_fill, lv_color_hex(0x56607A), 0);
+    lv_obj_set_style_bg_grad_color(ui->bar_fill, lv_color_hex(0x7A86A3), 0);
+    return;
+  }
+
+  /* 0mm(近)->红；4000mm(远)->蓝 */
+  const uint32_t max_mm = 4000u;
+  uint32_t t = ui_clamp_u32(mm, 0u, max_mm) * 1000u / max_mm;
+  lv_color_t near_c = lv_color_hex(0xFF4D4D);
+  lv_color_t far_c = lv_color_hex(0x3D7BFF);
+  lv_color_t c = ui_color_lerp(near_c, far_c, t);
+
+  lv_obj_set_style_bg_color(ui->bar_fill, c, 0);
+  /* 渐变色稍微偏亮，增强“流光”感 */
+  lv_color_t c2 = ui_color_lerp(c, lv_color_hex(0xFFFFFF), 220u);
+  lv_obj_set_style_bg_grad_color(ui->bar_fill, c2, 0);
+}
+
+static void ui_bar_set_width(ser_lvgl_ui_boot_t *ui, uint32_t mm, bool valid)
+{
+  if (ui == NULL || ui->bar_bg == NULL || ui->bar_fill == NULL)
+  {
+    return;
+  }
+
+  int32_t bg_w = lv_obj_get_width(ui->bar_bg);
+  if (bg_w <= 1)
+  {
+    return;
+  }
+
+  uint32_t target_w = 1u;
+  if (valid)
+  {
+    /*
+     * 更直观的“接近感”：
+     * - 越近条越满
+     * - 越远条越空
+     */
+    const uint32_t max_mm = 4000u; /* 400cm */
+    uint32_t mm_c = ui_clamp_u32(mm, 0u, max_mm);
+    uint32_t danger = max_mm - mm_c;
+    target_w = 1u + (danger * (uint32_t)(bg_w - 1)) / max_mm;
+  }
+
+  uint32_t cur_w = (uint32_t)lv_obj_get_width(ui->bar_fill);
+  if (cur_w == target_w)
+  {
+    return;
+  }
+
+  /* 宽度与下面的呼吸透明度同属 bar_fill：批量动画每帧合并成一次样式刷新 */
+  const ser_lvgl_anim_cfg_t a = {
+      .obj = ui->bar_fill,
+      .prop = SER_LVGL_ANIM_WIDTH,
+      .path = SER_LVGL_ANIM_PATH_LINEAR,
+      .from = (int32_t)cur_w,
+      .to = (int32_t)target_w,
+      .duration_ms = 160u,
+  };
+  (void)ser_lvgl_anim_start(&a);
+}
+
+static void ui_bar_set_pulse(ser_lvgl_ui_boot_t *ui, uint32_t mm, bool valid)
+{
+  if (ui == NULL || ui->bar_fill == NULL)
+  {
+    return;
+  }
+
+  uint32_t pulse_ms = 1200u;
+  if (!valid)
+  {
+    pulse_ms = 1200u;
+  }
+  else
+  {
+    /* 越近闪烁越快：200ms~1200ms */
+    const uint32_t max_mm = 4000u;
+    uint32_t mm_c = ui_clamp_u32(mm, 0u, max_mm);
+    pulse_ms = 200u + (mm_c * 1000u) / max_mm;
+  }
+
+  /* 变化不大就不重建动画，避免频繁重启 */
+  if (ui->bar_pulse_ms != 0u)
+  {
+    uint32_t diff = (ui->bar_pulse_ms > pulse_ms) ? (ui->bar_pulse_ms - pulse_ms)
+                                                  : (pulse_ms - ui->bar_pulse_ms);
+    if (diff < 80u)
+    {
+      return;
+    }
+  }
+  ui->bar_pulse_ms = pulse_ms;
+
+  const ser_lvgl_anim_cfg_t a = {
+      .obj = ui->bar_fill,
+      .prop = SER_LVGL_ANIM_BG_OPA,
+      .path = SER_LVGL_ANIM_PATH_LINEAR,
+      .from = 110,
+      .to = 255,
+      .duration_ms = (uint16_t)pulse_ms,
+      .reverse_ms = (uint16_t)pulse_ms,
+      .repeat = SER_LVGL_ANIM_REPEAT_INFINITE,
+  };
+  (void)ser_lvgl_anim_start(&a);
+}
+
+void ser_lvgl_ui_boot_set_distance(void *target, int32_t mm)
+{
+  ser_lvgl_ui_boot_t *ui = (ser_lvgl_ui_boot_t *)target;
+  if (ui == NULL || ui->dist_label == NULL)
+  {
+    return;
+  }
+
+  if (mm >= 0)
+  {
+    uint32_t v = (uint32_t)mm;
+    uint32_t cm_int = v / 10u;
+    uint32_t cm_frac = v % 10u;
+    (void)ser_lvgl_readout_set_fmt(ui->dist_label, "Dist: %lu.%01lu cm",
+                                   (unsigned long)cm_int,
+                                   (unsigned long)cm_frac);
+
+    ui_bar_set_width(ui, v, true);
+    ui_bar_set_color(ui, v, true);
+    ui_bar_set_pulse(ui, v, true);
+  }
+  else
+  {
+    (void)ser_lvgl_readout_set_text(ui->dist_label, "Dist: -- cm");
+
+    ui_bar_set_width(ui, 0u, false);
+    ui_bar_set_color(ui, 0u, false);
+    ui_bar_set_pulse(ui, 0u, false);
+  }
+}
+
+void ser_lvgl_ui_boot_create(ser_lvgl_ui_boot_t *ui)
+{
+  /* ===== 背景 ===== */
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+
+  lv_obj_add_style(scr, &ser_lvgl_style_screen, 0);
+
+  /*
+   * ===== 中央卡片（徽章 + 标题 + 副标题） =====
+   * 由 services/ui/boot.xml 在构建时生成（ser_lvgl_gen_boot.c），无运行时 XML 解析
+   */
+  ser_lvgl_gen_boot_t gen;
+  ser_lvgl_gen_boot_create(scr, &gen);
+  lv_obj_t *card = gen.card;
+
+  /* ===== 超声波距离显示 ===== */
+  ui->dist_label = ser_lvgl_readout_create(card, 16u);
+  lv_obj_add_style(ui->dist_label, &ser_lvgl_style_readout, 0);
+  lv_obj_align_to(ui->dist_label, gen.subtitle, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
+  (void)ser_lvgl_readout_set_text(ui->dist_label, "Dist: -- cm");
+
+  /* ===== 进度条（纯 lv_obj 实现） ===== */
+  ui->bar_bg = lv_obj_create(card);
+  lv_obj_set_height(ui->bar_bg, 12);
+  /* 卡片尺寸已在生成代码的 align_to 中完成布局计算；宽度 = 卡片宽 - 左右 pad */
+  lv_obj_set_width(ui->bar_bg, lv_obj_get_width(card) - 48);
+  lv_obj_add_style(ui->bar_bg, &ser_lvgl_style_bar_bg, 0);
+  lv_obj_align(ui->bar_bg, LV_ALIGN_BOTTOM_MID, 0, 0);
+
+  ui->bar_fill = lv_obj_create(ui->bar_bg);
+  lv_obj_set_height(ui->bar_fill, 12);
+  lv_obj_set_width(ui->bar_fill, 1);
+  lv_obj_add_style(ui->bar_fill, &ser_lvgl_style_bar_fill, 0);
+  /* 透明度（呼吸动画）与颜色（随距离变化）是运行时属性，保留为本地样式 */
+  lv_obj_set_style_bg_opa(ui->bar_fill, LV_OPA_COVER, 0);
+  lv_obj_set_style_bg_color(ui->bar_fill, lv_color_hex(0x3D7BFF), 0);
+  lv_obj_set_style_bg_grad_color(ui->bar_fill, lv_color_hex(0x67D7FF), 0);
+  lv_obj_align(ui->bar_fill, LV_ALIGN_LEFT_MID, 0, 0);
+
+  /* 初始：等数据时显示最小值 + 慢速呼吸 */
+  ui->bar_pulse_ms = 0u;
+  ui_bar_set_width(ui, 0u, false);
+  ui_bar_set_color(ui, 0u, false);
+  ui_bar_set_pulse(ui, 0u, false);
+}
+
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：启动界面（卡片 + 距离读数 + 距离进度条）
+ *
+ * - 只依赖 LVGL 与 ser_lvgl_gen_boot/readout/style，不依赖 RTOS/外设，
+ *   project/tools/splash_gen.py 在主机上用同一份代码渲染开机画面
+ * - 只能在 LVGL 上下文调用
+ */
+
+#if defined(__has_include)
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+
+typedef struct
+{
+  lv_obj_t *bar_bg;
+  lv_obj_t *bar_fill;
+
+  /* 超声波距离显示（readout：只重绘变化的数字） */
+  lv_obj_t *dist_label;
+
+  /* 动画参数缓存 */
+  uint32_t bar_pulse_ms;
+} ser_lvgl_ui_boot_t;
+
+/* 在当前活动屏幕上创建启动界面（初始为“无测距数据”状态） */
+void ser_lvgl_ui_boot_create(ser_lvgl_ui_boot_t *ui);
+
+/*
+ * 距离 subject 的 observer：只有距离值变化时才会被调用（在 LVGL 上下文中）
+ * - target 为 ser_lvgl_ui_boot_t*
+ * - mm < 0 表示当前无有效测距
+ */
+void ser_lvgl_ui_boot_set_distance(void *target, int32_t mm);
+
+#endif
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,482 @@
+#include "ser_prof.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(SER_PROF_HOST) && SER_PROF_HOST
+#include <time.h>
+#else
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dev_console.h"
+#include "dri_time_us.h"
+#endif
+
+_Static_assert((SER_PROF_RING_EVENTS & (SER_PROF_RING_EVENTS - 1u)) == 0u,
+               "SER_PROF_RING_EVENTS must be a power of two");
+_Static_assert((SER_PROF_MAX_TAGS & (SER_PROF_MAX_TAGS - 1u)) == 0u,
+               "SER_PROF_MAX_TAGS must be a power of two");
+
+#define PROF_VERSION 1u
+
+#define PROF_PKT_INFO 1u
+#define PROF_PKT_NAME 2u
+#define PROF_PKT_EVENTS 3u
+#define PROF_PKT_DROP 4u
+#define PROF_PKT_HDR 5u
+
+#define PROF_NAME_TAG 0u
+#define PROF_NAME_THREAD 1u
+
+#define PROF_PHASE_BEGIN 0u
+#define PROF_PHASE_END 1u
+
+/* 特殊线程号：ISR / 调度器启动前 */
+#define PROF_TID_ISR 0xFFu
+#define PROF_TID_MAIN 0xFEu
+#define PROF_THREAD_NAME_LEN 16u
+
+/* 每隔多少次 drain 重新发送 INFO 与全部名字（上位机中途接入也能解码） */
+#define PROF_RESYNC_DRAINS 64u
+
+typedef struct
+{
+  uint32_t ts;
+  uint16_t id;
+  uint8_t phase;
+  uint8_t tid;
+} prof_event_t;
+
+_Static_assert(sizeof(prof_event_t) == 8u, "event record is 8 bytes");
+
+static prof_event_t s_ring[SER_PROF_RING_EVENTS];
+static volatile uint32_t s_head = 0; /* 生产者写入位置（单调递增） */
+static volatile uint32_t s_tail = 0; /* 消费者读取位置（单调递增） */
+
+static const char *s_tag_ptr[SER_PROF_MAX_TAGS];
+static uint32_t s_tag_pending[SER_PROF_MAX_TAGS / 32u];
+
+static char s_thr_name[SER_PROF_MAX_THREADS][PROF_THREAD_NAME_LEN];
+static uint32_t s_thr_pending;
+static uint32_t s_thr_n;
+
+static bool s_info_pending = true;
+static uint32_t s_drop_sent = 0;
+static uint32_t s_drains = 0;
+
+static ser_prof_stats_t s_stats;
+
+/* ==========================
+ * 平台相关：临界区 / 时间戳 / 线程识别
+ * ========================== */
+#if defined(SER_PROF_HOST) && SER_PROF_HOST
+
+/* 主机构建按单线程使用（与 LVGL 相同） */
+static uint32_t prof_lock(void)
+{
+  return 0u;
+}
+
+static void prof_unlock(uint32_t key)
+{
+  (void)key;
+}
+
+static uint32_t prof_clock_hz(void)
+{
+  return 1000000000u;
+}
+
+static uint32_t prof_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+static uint8_t prof_tid(void)
+{
+  return PROF_TID_MAIN;
+}
+
+#else
+
+/* 只屏蔽中断几十个周期，ISR 与任务都可记录 */
+static uint32_t prof_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static void prof_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+
+static uint32_t prof_clock_hz(void)
+{
+  return dri_time_hz();
+}
+
+static uint32_t prof_now(void)
+{
+  return dri_time_cycles_now();
+}
+
+static void *s_thr_handle[SER_PROF_MAX_THREADS];
+
+/* 调用方已持锁 */
+static uint8_t prof_tid(void)
+{
+  if (__get_IPSR() != 0u)
+  {
+    return PROF_TID_ISR;
+  }
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+  {
+    return PROF_TID_MAIN;
+  }
+
+  void *h = (void *)xTaskGetCurrentTaskHandle();
+  for (uint32_t i = 0; i < s_thr_n; i++)
+  {
+    if (s_thr_handle[i] == h)
+    {
+      return (uint8_t)i;
+    }
+  }
+  if (s_thr_n >= SER_PROF_MAX_THREADS)
+  {
+    return PROF_TID_MAIN;
+  }
+
+  /* 名字在登记时拷贝：任务之后被删除也不会读到悬空指针 */
+  uint32_t i = s_thr_n++;
+  s_thr_handle[i] = h;
+  strncpy(s_thr_name[i], pcTaskGetName((TaskHandle_t)h),
+          PROF_THREAD_NAME_LEN - 1u);
+  s_thr_pending |= 1u << i;
+  return (uint8_t)i;
+}
+
+#endif
+
+/* ==========================
+ * 记录
+ * ========================== */
+
+/* 标签指针 -> 编号（开放寻址；调用方已持锁）；表满返回 -1 */
+static int32_t tag_id(const char *tag)
+{
+  uint32_t h = (uint32_t)(((uintptr_t)tag >> 2) * 2654435761u);
+  uint32_t i = h & (SER_PROF_MAX_TAGS - 1u);
+  for (uint32_t n = 0; n < SER_PROF_MAX_TAGS; n++)
+  {
+    if (s_tag_ptr[i] == tag)
+    {
+      return (int32_t)i;
+    }
+    if (s_tag_ptr[i] == NULL)
+    {
+      s_tag_ptr[i] = tag;
+      s_tag_pending[i / 32u] |= 1u << (i % 32u);
+      s_stats.tags++;
+      return (int32_t)i;
+    }
+    i = (i + 1u) & (SER_PROF_MAX_TAGS - 1u);
+  }
+  return -1;
+}
+
+static void prof_record(const char *tag, uint8_t phase)
+{
+  const uint32_t ts = prof_now();
+
+  uint32_t key = prof_lock();
+  int32_t id = (tag != NULL) ? tag_id(tag) : -1;
+  uint32_t head = s_head;
+  if (id < 0 || (uint32_t)(head - s_tail) >= SER_PROF_RING_EVENTS)
+  {
+    s_stats.dropped++;
+  }
+  else
+  {
+    prof_event_t *e = &s_ring[head & (SER_PROF_RING_EVENTS - 1u)];
+    e->ts = ts;
+    e->id = (uint16_t)id;
+    e->phase = phase;
+    e->tid = prof_tid();
+    s_head = head + 1u;
+    s_stats.recorded++;
+  }
+  prof_unlock(key);
+}
+
+void ser_prof_begin(const char *tag)
+{
+  prof_record(tag, PROF_PHASE_BEGIN);
+}
+
+void ser_prof_end(const char *tag)
+{
+  prof_record(tag, PROF_PHASE_END);
+}
+
+/* ==========================
+ * 打包输出
+ * ========================== */
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+  return p + 4;
+}
+
+static uint8_t *put_hdr(uint8_t *p, uint8_t type, uint16_t len)
+{
+  p[0] = 0xA5u;
+  p[1] = 0x5Au;
+  p[2] = type;
+  return put_u16(p + 3, len);
+}
+
+/* NAME 包；空间不足返回 NULL */
+static uint8_t *put_name(uint8_t *p, const uint8_t *end, uint16_t id,
+                         uint8_t kind, const char *name)
+{
+  size_t n = strlen(name);
+  if (n > 255u)
+  {
+    n = 255u;
+  }
+  if ((size_t)(end - p) < PROF_PKT_HDR + 3u + n)
+  {
+    return NULL;
+  }
+  p = put_hdr(p, PROF_PKT_NAME, (uint16_t)(3u + n));
+  p = put_u16(p, id);
+  *p++ = kind;
+  memcpy(p, name, n);
+  return p + n;
+}
+
+static void resync_all(void)
+{
+  uint32_t key = prof_lock();
+  for (uint32_t i = 0; i < SER_PROF_MAX_TAGS; i++)
+  {
+    if (s_tag_ptr[i] != NULL)
+    {
+      s_tag_pending[i / 32u] |= 1u << (i % 32u);
+    }
+  }
+  s_thr_pending = (s_thr_n >= 32u) ? 0xFFFFFFFFu : ((1u << s_thr_n) - 1u);
+  s_info_pending = true;
+  prof_unlock(key);
+}
+
+uint32_t ser_prof_drain(uint8_t *out, uint32_t cap)
+{
+  if (out == NULL || cap < 64u)
+  {
+    return 0u;
+  }
+
+  if ((s_drains++ % PROF_RESYNC_DRAINS) == 0u && s_drains > 1u)
+  {
+    resync_all();
+  }
+
+  uint8_t *p = out;
+  const uint8_t *end = out + cap;
+
+  if (s_info_pending)
+  {
+    p = put_hdr(p, PROF_PKT_INFO, 6u);
+    p = put_u32(p, prof_clock_hz());
+    p = put_u16(p, PROF_VERSION);
+    s_info_pending = false;
+  }
+
+  /* 线程名 */
+  uint32_t key = prof_lock();
+  uint32_t thr = s_thr_pending;
+  prof_unlock(key);
+  uint32_t thr_sent = 0u;
+  for (uint32_t i = 0; i < SER_PROF_MAX_THREADS; i++)
+  {
+    if ((thr & (1u << i)) == 0u)
+    {
+      continue;
+    }
+    uint8_t *q = put_name(p, end, (uint16_t)i, PROF_NAME_THREAD, s_thr_name[i]);
+    if (q == NULL)
+    {
+      break;
+    }
+    p = q;
+    thr_sent |= 1u << i;
+  }
+
+  /* 标签名（事件前发出，解码时名字总是先到） */
+  bool names_done = true;
+  for (uint32_t w = 0; w < SER_PROF_MAX_TAGS / 32u && names_done; w++)
+  {
+    key = prof_lock();
+    uint32_t bits = s_tag_pending[w];
+    prof_unlock(key);
+
+    uint32_t sent = 0u;
+    while (bits != 0u)
+    {
+      uint32_t b = (uint32_t)__builtin_ctz(bits);
+      uint32_t i = w * 32u + b;
+      uint8_t *q = put_name(p, end, (uint16_t)i, PROF_NAME_TAG, s_tag_ptr[i]);
+      if (q == NULL)
+      {
+        names_done = false;
+        break;
+      }
+      p = q;
+      sent |= 1u << b;
+      bits &= bits - 1u;
+    }
+
+    key = prof_lock();
+    s_tag_pending[w] &= ~sent;
+    prof_unlock(key);
+  }
+
+  key = prof_lock();
+  s_thr_pending &= ~thr_sent;
+  const uint32_t dropped = s_stats.dropped;
+  prof_unlock(key);
+
+  if (dropped != s_drop_sent && (size_t)(end - p) >= PROF_PKT_HDR + 4u)
+  {
+    p = put_hdr(p, PROF_PKT_DROP, 4u);
+    p = put_u32(p, dropped);
+    s_drop_sent = dropped;
+  }
+
+  /* 名字没发完时先不发事件，保证“名字先于引用它的事件” */
+  if (!names_done)
+  {
+    return (uint32_t)(p - out);
+  }
+
+  const uint32_t head = s_head;
+  uint32_t tail = s_tail;
+  uint32_t avail = head - tail;
+  uint32_t room = (uint32_t)(end - p);
+  if (avail == 0u || room < PROF_PKT_HDR + sizeof(prof_event_t))
+  {
+    return (uint32_t)(p - out);
+  }
+
+  uint32_t n = (room - PROF_PKT_HDR) / sizeof(prof_event_t);
+  if (n > avail)
+  {
+    n = avail;
+  }
+  if (n > 0xFFFFu / sizeof(prof_event_t))
+  {
+    n = 0xFFFFu / sizeof(prof_event_t);
+  }
+
+  p = put_hdr(p, PROF_PKT_EVENTS, (uint16_t)(n * sizeof(prof_event_t)));
+  for (uint32_t k = 0; k < n; k++)
+  {
+    const prof_event_t *e = &s_ring[(tail + k) & (SER_PROF_RING_EVENTS - 1u)];
+    p = put_u32(p, e->ts);
+    p = put_u16(p, e->id);
+    *p++ = e->phase;
+    *p++ = e->tid;
+  }
+  /* 拷贝完成后再推进 tail，生产者才可能复用这些槽位 */
+  s_tail = tail + n;
+  s_stats.sent += n;
+
+  return (uint32_t)(p - out);
+}
+
+void ser_prof_get_stats(ser_prof_stats_t *stats)
+{
+  if (stats == NULL)
+  {
+    return;
+  }
+
+  uint32_t key = prof_lock();
+  *stats = s_stats;
+  prof_unlock(key);
+}
+
+/* ==========================
+ * MCU：控制台发送任务
+ * ========================== */
+#if !defined(SER_PROF_HOST) || !SER_PROF_HOST
+
+#ifndef SER_PROF_TX_BYTES
+#define SER_PROF_TX_BYTES 1024u
+#endif
+
+#ifndef SER_PROF_PERIOD_MS
+#define SER_PROF_PERIOD_MS 20u
+#endif
+
+/* 双缓冲：一块 DMA 发送中，另一块打包下一批（均在 SRAM，DMA 可访问） */
+static uint8_t s_tx[2][SER_PROF_TX_BYTES];
+
+static bool s_started = false;
+
+void ser_prof_task(void *argument)
+{
+  (void)argument;
+  if (!s_started)
+  {
+    vTaskDelete(NULL);
+  }
+
+  uint32_t idx = 0u;
+  for (;;)
+  {
+    uint32_t n = ser_prof_drain(s_tx[idx], SER_PROF_TX_BYTES);
+    if (n == 0u)
+    {
+      vTaskDelay(pdMS_TO_TICKS(SER_PROF_PERIOD_MS));
+      continue;
+    }
+
+    while (dev_console_tx_busy())
+    {
+      vTaskDelay(1);
+    }
+    (void)dev_console_write_async(s_tx[idx], (uint16_t)n);
+    idx ^= 1u;
+  }
+}
+
+bool ser_prof_init(void)
+{
+  if (!s_started)
+  {
+    s_started = dev_console_init();
+  }
+  return s_started;
+}
+
+#endif
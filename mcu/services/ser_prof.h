@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：LVGL 性能分析后端（begin/end 事件 -> 环形缓冲 -> 二进制流）
+ *
+ * 背景：
+ * - LVGL 自带的 lv_profiler_builtin 只能用 1ms 的 LVGL tick 计时，
+ *   亚毫秒级的绘制任务全部落在同一个 tick 里，看不出耗时
+ *
+ * 做法：
+ * - 时间戳：MCU 上为 DWT CYCCNT（dri_time_cycles_now），主机构建为
+ *   clock_gettime(CLOCK_MONOTONIC) 纳秒；时钟频率随 INFO 包发出
+ * - 记录：每个事件 8 字节 {u32 ts, u16 tag_id, u8 phase, u8 tid}，写入 RAM 环形缓冲；
+ *   满时丢弃新事件并计数（不覆盖未发出的数据）
+ * - 标签：按 const char* 指针去重编号，首次出现时排队发送 NAME 包
+ * - 输出：ser_prof_drain 把待发数据打包成
+ *     A5 5A | type(u8) | len(u16 LE) | payload
+ *   type: 1=INFO{u32 clock_hz, u16 version} 2=NAME{u16 id, u8 kind, name}
+ *         3=EVENTS{n*8B} 4=DROP{u32 dropped_total}
+ *   MCU 上 ser_prof_task 低优先级任务经 dev_console 以 DMA 流式发出
+ * - 主机解码：project/tools/prof2trace.py 输出 Chrome / Perfetto trace JSON
+ *
+ * 启用：
+ * - 编译定义 SER_PROF_ENABLE=1 后，lv_conf.h 打开 LV_USE_PROFILER，
+ *   并把 LV_PROFILER_BEGIN/END 指向本模块（只打开 REFR 与 DRAW 两类：
+ *   覆盖 lv_refr 各阶段、每个绘制任务与 flush）
+ * - 主机构建额外定义 SER_PROF_HOST=1，自行调用 ser_prof_drain 写文件
+ *
+ * 限制：
+ * - 32-bit 时间戳在 180MHz 下约 23.8s 回绕，解码器按“相邻事件间隔小于一个周期”展开
+ */
+
+#ifndef SER_PROF_RING_EVENTS
+#define SER_PROF_RING_EVENTS 2048u /* 必须为 2 的幂；每个事件 8 字节 */
+#endif
+
+#ifndef SER_PROF_MAX_TAGS
+#define SER_PROF_MAX_TAGS 128u
+#endif
+
+#ifndef SER_PROF_MAX_THREADS
+#define SER_PROF_MAX_THREADS 8u
+#endif
+
+/* 记录事件（任意任务上下文；ISR 中调用时 tid 记为“isr”） */
+void ser_prof_begin(const char *tag);
+void ser_prof_end(const char *tag);
+
+/*
+ * 把待发送的数据打包写入 out（不超过 cap 字节），返回写入字节数
+ * - 单消费者：同一时刻只能有一个调用者
+ * - cap 至少 64 字节
+ */
+uint32_t ser_prof_drain(uint8_t *out, uint32_t cap);
+
+#if !defined(SER_PROF_HOST) || !SER_PROF_HOST
+/* 初始化控制台（调度器启动前调用）；发送任务由 app 任务表静态创建 */
+bool ser_prof_init(void);
+
+#ifndef SER_PROF_TASK_STACK
+#define SER_PROF_TASK_STACK 256u
+#endif
+void ser_prof_task(void *argument);
+#endif
+
+typedef struct
+{
+  uint32_t recorded; /* 写入环形缓冲的事件数 */
+  uint32_t dropped;  /* 缓冲满/标签表满时丢弃的事件数 */
+  uint32_t sent;     /* 已打包发出的事件数 */
+  uint32_t tags;     /* 已登记的标签数 */
+} ser_prof_stats_t;
+
+void ser_prof_get_stats(ser_prof_stats_t *stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
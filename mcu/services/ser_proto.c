@@ -0,0 +1,485 @@
+#include "ser_proto.h"
+
+#include <stddef.h>
+#include <string.h>
+
+typedef struct
+{
+  ser_proto_handler_t fn;
+  void *arg;
+} proto_handler_t;
+
+static proto_handler_t s_handlers[SER_PROTO_MSG_NUM];
+static ser_proto_stats_t s_stats;
+
+/* 跨越环形缓冲末尾的帧解码到这里（其余帧原地解码） */
+static uint8_t s_scratch[SER_PROTO_MAX_RAW];
+
+static const uint8_t s_msg_id[SER_PROTO_MSG_NUM] = {
+#define SER_PROTO_X_ID(name, id, type) [SER_PROTO_MSG_##name] = (id),
+    SER_PROTO_MSG_TABLE(SER_PROTO_X_ID)
+#undef SER_PROTO_X_ID
+};
+
+static const uint16_t s_msg_size[SER_PROTO_MSG_NUM] = {
+#define SER_PROTO_X_SIZE(name, id, type) [SER_PROTO_MSG_##name] = sizeof(type),
+    SER_PROTO_MSG_TABLE(SER_PROTO_X_SIZE)
+#undef SER_PROTO_X_SIZE
+};
+
+ser_proto_msg_t ser_proto_msg_of_id(uint8_t id)
+{
+  switch (id)
+  {
+#define SER_PROTO_X_CASE(name, id, type)                                       \
+  case (id):                                                                   \
+    return SER_PROTO_MSG_##name;
+    SER_PROTO_MSG_TABLE(SER_PROTO_X_CASE)
+#undef SER_PROTO_X_CASE
+  default:
+    return SER_PROTO_MSG_NUM;
+  }
+}
+
+uint8_t ser_proto_msg_id(ser_proto_msg_t msg)
+{
+  return ((uint32_t)msg < (uint32_t)SER_PROTO_MSG_NUM) ? s_msg_id[msg] : 0u;
+}
+
+uint16_t ser_proto_msg_size(ser_proto_msg_t msg)
+{
+  return ((uint32_t)msg < (uint32_t)SER_PROTO_MSG_NUM) ? s_msg_size[msg] : 0u;
+}
+
+bool ser_proto_on(ser_proto_msg_t msg, ser_proto_handler_t fn, void *arg)
+{
+  if ((uint32_t)msg >= (uint32_t)SER_PROTO_MSG_NUM)
+  {
+    return false;
+  }
+
+  s_handlers[msg].arg = arg;
+  s_handlers[msg].fn = fn;
+  return true;
+}
+
+uint32_t ser_proto_encode(ser_proto_msg_t msg, const void *payload,
+                          uint8_t *out, uint32_t cap)
+{
+  if ((uint32_t)msg >= (uint32_t)SER_PROTO_MSG_NUM || out == NULL || cap < 2u)
+  {
+    return 0u;
+  }
+
+  const uint8_t id = s_msg_id[msg];
+  const uint16_t size = s_msg_size[msg];
+  if (size != 0u && payload == NULL)
+  {
+    return 0u;
+  }
+
+  /* id / 负载 / crc 分段送进 COBS，不拼接原文 */
+  uint16_t crc = ser_crc16(SER_CRC16_INIT, &id, 1u);
+  crc = ser_crc16(crc, (const uint8_t *)payload, size);
+  const uint8_t crc_le[2] = {(uint8_t)crc, (uint8_t)(crc >> 8)};
+
+  ser_cobs_enc_t e;
+  ser_cobs_enc_begin(&e, out, cap - 1u);
+  ser_cobs_enc_put(&e, &id, 1u);
+  ser_cobs_enc_put(&e, (const uint8_t *)payload, size);
+  ser_cobs_enc_put(&e, crc_le, 2u);
+  uint32_t n = ser_cobs_enc_end(&e);
+  if (n == 0u)
+  {
+    return 0u;
+  }
+
+  out[n] = 0u;
+  return n + 1u;
+}
+
+/* 已解码的原文：校验 + 分发 */
+static bool proto_dispatch(const uint8_t *raw, int32_t n)
+{
+  if (n < 0)
+  {
+    s_stats.cobs_err++;
+    return false;
+  }
+  if (n < 3 || (uint32_t)n > SER_PROTO_MAX_RAW)
+  {
+    s_stats.len_err++;
+    return false;
+  }
+
+  const uint32_t len = (uint32_t)n;
+  const uint16_t crc = (uint16_t)(raw[len - 2u] | (raw[len - 1u] << 8));
+  if (ser_crc16(SER_CRC16_INIT, raw, len - 2u) != crc)
+  {
+    s_stats.crc_err++;
+    return false;
+  }
+
+  const ser_proto_msg_t msg = ser_proto_msg_of_id(raw[0]);
+  if (msg == SER_PROTO_MSG_NUM)
+  {
+    s_stats.unknown++;
+    return false;
+  }
+  if (len - 3u != s_msg_size[msg])
+  {
+    s_stats.len_err++;
+    return false;
+  }
+
+  const proto_handler_t h = s_handlers[msg];
+  if (h.fn == NULL)
+  {
+    s_stats.unhandled++;
+    return false;
+  }
+
+  s_stats.frames++;
+  h.fn(msg, raw + 1, h.arg);
+  return true;
+}
+
+bool ser_proto_frame(uint8_t *frame, uint32_t len)
+{
+  if (frame == NULL || len == 0u)
+  {
+    return false;
+  }
+  if (len >= SER_PROTO_MAX_WIRE)
+  {
+    s_stats.too_long++;
+    return false;
+  }
+
+  return proto_dispatch(frame, ser_cobs_decode(frame, len, NULL, 0u, frame, len));
+}
+
+void ser_proto_rx_init(ser_proto_rx_t *rx, uint8_t *buf, uint32_t size)
+{
+  rx->buf = buf;
+  rx->size = size;
+  rx->rd = 0u;
+  rx->scan = 0u;
+  /* 中途接入时第一个分隔符之前是半帧 */
+  rx->discard = true;
+}
+
+void ser_proto_rx_resync(ser_proto_rx_t *rx, uint32_t wr_total)
+{
+  rx->rd = wr_total;
+  rx->scan = wr_total;
+  rx->discard = true;
+}
+
+/* 环内一帧 [start, start + n)，不含分隔符 */
+static bool rx_frame(ser_proto_rx_t *rx, uint32_t start, uint32_t n)
+{
+  const uint32_t idx = start & (rx->size - 1u);
+  const uint32_t n1 = rx->size - idx;
+  if (n <= n1)
+  {
+    return ser_proto_frame(rx->buf + idx, n);
+  }
+
+  /* 跨越末尾：两段直接解码到暂存区 */
+  if (n >= SER_PROTO_MAX_WIRE)
+  {
+    s_stats.too_long++;
+    return false;
+  }
+  return proto_dispatch(s_scratch, ser_cobs_decode(rx->buf + idx, n1, rx->buf,
+                                                   n - n1, s_scratch,
+                                                   sizeof(s_scratch)));
+}
+
+uint32_t ser_proto_rx_poll(ser_proto_rx_t *rx, uint32_t wr_total)
+{
+  if (rx == NULL || rx->buf == NULL)
+  {
+    return 0u;
+  }
+
+  if (wr_total - rx->rd > rx->size)
+  {
+    /* 未处理的数据已被覆盖 */
+    s_stats.overrun++;
+    ser_proto_rx_resync(rx, wr_total);
+    return 0u;
+  }
+
+  const uint32_t mask = rx->size - 1u;
+  uint32_t frames = 0u;
+  while (rx->scan != wr_total)
+  {
+    const uint32_t idx = rx->scan & mask;
+    uint32_t chunk = wr_total - rx->scan;
+    if (chunk > rx->size - idx)
+    {
+      chunk = rx->size - idx;
+    }
+
+    const uint8_t *p = rx->buf + idx;
+    const uint8_t *z = (const uint8_t *)memchr(p, 0, chunk);
+    if (z == NULL)
+    {
+      rx->scan += chunk;
+      if (rx->scan - rx->rd >= SER_PROTO_MAX_WIRE)
+      {
+        /* 不可能是合法帧：不再保留，丢到下一个分隔符 */
+        if (!rx->discard)
+        {
+          s_stats.too_long++;
+        }
+        rx->discard = true;
+        rx->rd = rx->scan;
+      }
+      continue;
+    }
+
+    const uint32_t end = rx->scan + (uint32_t)(z - p);
+    if (!rx->discard && end != rx->rd &&
+        rx_frame(rx, rx->rd, end - rx->rd))
+    {
+      frames++;
+    }
+    rx->discard = false;
+    rx->rd = end + 1u;
+    rx->scan = rx->rd;
+  }
+  return frames;
+}
+
+void ser_proto_get_stats(ser_proto_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_proto_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#if !defined(SER_PROTO_HOST) || !SER_PROTO_HOST
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+
+#include "dev_console.h"
+#include "dri_time_us.h"
+#include "ser_bus.h"
+
+#define RX_MASK (SER_PROTO_RX_BYTES - 1u)
+
+#if (SER_PROTO_RX_BYTES & RX_MASK) != 0u || SER_PROTO_RX_BYTES > 0xFFFFu
+#error "SER_PROTO_RX_BYTES must be a power of two <= 32K"
+#endif
+
+/* DMA 直接写入，放在 SRAM（.bss）里，不能进 CCMRAM */
+static uint8_t s_rx_buf[SER_PROTO_RX_BYTES];
+static ser_proto_rx_t s_rx;
+
+/* 中断里累计的写位置 */
+static volatile uint32_t s_wr_total = 0u;
+static volatile uint32_t s_rx_restarts = 0u;
+static uint16_t s_last_pos = 0u;
+
+/*
+ * 发送缓冲只在持有 s_tx_lock 且串口空闲时写入：DMA 仍在发上一帧时不能覆盖，
+ * 两个发送任务也不能同时编码。互斥量只挡任务，编码期间中断照常响应
+ */
+static uint8_t s_tx_buf[SER_PROTO_MAX_WIRE];
+static StaticSemaphore_t s_tx_lock_buf;
+static SemaphoreHandle_t s_tx_lock = NULL;
+
+static TaskHandle_t s_task = NULL;
+static bool s_started = false;
+static volatile bool s_telemetry_distance = false;
+static ser_bus_sub_t s_distance_sub;
+
+static void proto_rx_cb(uint16_t pos, bool restarted)
+{
+  if (restarted)
+  {
+    /* DMA 从 0 重新开始：累计值对齐到环首，任务侧丢弃到下一个分隔符 */
+    s_wr_total += (SER_PROTO_RX_BYTES - (s_wr_total & RX_MASK)) & RX_MASK;
+    s_rx_restarts++;
+  }
+  else
+  {
+    s_wr_total += (uint16_t)(pos - s_last_pos) & RX_MASK;
+  }
+  s_last_pos = pos;
+
+  if (s_task != NULL)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(s_task, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+static void tx_count(bool ok)
+{
+  /* 统计由多个发送任务更新，只在这里短暂屏蔽（BASEPRI） */
+  taskENTER_CRITICAL();
+  if (ok)
+  {
+    s_stats.tx_frames++;
+  }
+  else
+  {
+    s_stats.tx_drop++;
+  }
+  taskEXIT_CRITICAL();
+}
+
+bool ser_proto_send(ser_proto_msg_t msg, const void *payload)
+{
+  /* 另一个任务正在发：串口反正是忙的，直接丢弃，不等待 */
+  if (s_tx_lock == NULL || xSemaphoreTake(s_tx_lock, 0) != pdTRUE)
+  {
+    tx_count(false);
+    return false;
+  }
+
+  bool ok = false;
+  if (!dev_console_tx_busy())
+  {
+    uint32_t n = ser_proto_encode(msg, payload, s_tx_buf, sizeof(s_tx_buf));
+    if (n != 0u)
+    {
+      /*
+       * ser_prof / ser_fbstream 的任务也会启动发送：查忙 + 启动 DMA 不能被它们打断，
+       * 只有启动 DMA 的几十条指令，用 BASEPRI 临界区；串口已被占用时返回失败
+       */
+      taskENTER_CRITICAL();
+      ok = dev_console_write_async(s_tx_buf, (uint16_t)n);
+      taskEXIT_CRITICAL();
+    }
+  }
+
+  (void)xSemaphoreGive(s_tx_lock);
+  tx_count(ok);
+  return ok;
+}
+
+static void on_ping(ser_proto_msg_t msg, const void *payload, void *arg)
+{
+  (void)msg;
+  (void)arg;
+  const ser_proto_ping_t *req = (const ser_proto_ping_t *)payload;
+
+  ser_proto_pong_t rsp = {
+      .token = req->token,
+      .uptime_ms = dri_time_now_ms(),
+  };
+  (void)ser_proto_send_pong(&rsp);
+}
+
+static void on_bus_stats_req(ser_proto_msg_t msg, const void *payload,
+                             void *arg)
+{
+  (void)msg;
+  (void)arg;
+  const ser_proto_bus_stats_req_t *req =
+      (const ser_proto_bus_stats_req_t *)payload;
+  if (req->topic >= (uint8_t)SER_BUS_TOPIC_NUM)
+  {
+    return;
+  }
+
+  ser_bus_stats_t st;
+  ser_bus_get_stats((ser_bus_topic_t)req->topic, &st);
+  ser_proto_bus_stats_t rsp = {
+      .topic = req->topic,
+      .publishes = st.publishes,
+      .rate_mhz = st.rate_mhz,
+      .lat_last_us = st.lat_last_us,
+      .lat_max_us = st.lat_max_us,
+      .stale = st.stale,
+  };
+  (void)ser_proto_send_bus_stats(&rsp);
+}
+
+static void on_telemetry_cfg(ser_proto_msg_t msg, const void *payload,
+                             void *arg)
+{
+  (void)msg;
+  (void)arg;
+  s_telemetry_distance =
+      ((const ser_proto_telemetry_cfg_t *)payload)->distance != 0u;
+}
+
+/* 总线回调（定时器工作任务上下文）：按配置转发为遥测 */
+static void distance_to_telemetry(ser_bus_topic_t topic, const void *payload,
+                                  void *arg)
+{
+  (void)topic;
+  (void)arg;
+  if (!s_telemetry_distance)
+  {
+    return;
+  }
+
+  ser_proto_distance_t d = {.mm = ((const ser_bus_distance_t *)payload)->mm};
+  (void)ser_proto_send_distance(&d);
+}
+
+void ser_proto_task(void *argument)
+{
+  (void)argument;
+
+  /* 接收回调要通知本任务：先登记句柄再启动 DMA */
+  s_task = xTaskGetCurrentTaskHandle();
+  if (!s_started ||
+      !dev_console_rx_start(s_rx_buf, SER_PROTO_RX_BYTES, proto_rx_cb))
+  {
+    vTaskDelete(NULL);
+  }
+  uint32_t restarts = s_rx_restarts;
+
+  for (;;)
+  {
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    if (s_rx_restarts != restarts)
+    {
+      restarts = s_rx_restarts;
+      ser_proto_rx_resync(&s_rx, s_wr_total);
+    }
+    (void)ser_proto_rx_poll(&s_rx, s_wr_total);
+  }
+}
+
+bool ser_proto_init(void)
+{
+  if (s_started)
+  {
+    return true;
+  }
+  if (!dev_console_init())
+  {
+    return false;
+  }
+
+  s_tx_lock = xSemaphoreCreateMutexStatic(&s_tx_lock_buf);
+  ser_proto_rx_init(&s_rx, s_rx_buf, SER_PROTO_RX_BYTES);
+  (void)ser_proto_on(SER_PROTO_MSG_ping, on_ping, NULL);
+  (void)ser_proto_on(SER_PROTO_MSG_bus_stats_req, on_bus_stats_req, NULL);
+  (void)ser_proto_on(SER_PROTO_MSG_telemetry_cfg, on_telemetry_cfg, NULL);
+
+  s_distance_sub.cb = distance_to_telemetry;
+  (void)ser_bus_subscribe(SER_BUS_TOPIC_distance, &s_distance_sub);
+
+  s_started = true;
+  return true;
+}
+#endif
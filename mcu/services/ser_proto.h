@@ -0,0 +1,146 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ser_proto_codec.h"
+#include "ser_proto_msgs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：二进制协议（远程配置与遥测，经调试串口 USART1）
+ *
+ * 帧格式（线上）：
+ *     COBS( id(u8) | payload | crc16(u16 LE) ) | 0x00
+ *   crc16 为 CRC-16/CCITT-FALSE，覆盖 id + payload；消息见 ser_proto_msgs.h
+ *
+ * 接收（零拷贝）：
+ * - USART1 以循环 DMA 写入 SER_PROTO_RX_BYTES 的环形缓冲，IDLE/半满/满中断只更新写位置并唤醒任务
+ * - 任务在环里找分隔符，帧不跨越末尾时直接在环内原地 COBS 解码、校验，
+ *   handler 拿到的负载指针就指向环内；只有跨越末尾的帧解码到一个小的暂存区
+ * - 写指针追上未处理数据（溢出）或超长帧：丢到下一个分隔符重新同步
+ *
+ * 发送：
+ * - ser_proto_send 编码到发送缓冲后经 dev_console DMA 发出；上一帧未发完或另一任务
+ *   正在发送时丢弃并计数（发送方之间用互斥量，编码期间不关中断）
+ *   （遥测允许丢，请求/应答由上位机超时重发）
+ * - 与 ser_prof / ser_fbstream 共用串口，同时启用时数据交织，上位机按帧头/分隔符各取所需
+ *
+ * 可移植性：
+ * - 编解码、环形缓冲解析与分发与平台无关；主机构建（SER_PROTO_HOST=1）
+ *   只去掉任务/串口部分，可直接喂字节做模糊测试与吞吐测试
+ *
+ * 启用：编译定义 SER_PROTO_ENABLE=1（CMake 选项同名），上位机见 project/tools/proto.py
+ */
+
+/* 接收环大小（2 的幂）：至少能容纳任务一次调度延迟内收到的数据 */
+#ifndef SER_PROTO_RX_BYTES
+#define SER_PROTO_RX_BYTES 512u
+#endif
+
+typedef enum
+{
+#define SER_PROTO_X_ENUM(name, id, type) SER_PROTO_MSG_##name,
+  SER_PROTO_MSG_TABLE(SER_PROTO_X_ENUM)
+#undef SER_PROTO_X_ENUM
+  SER_PROTO_MSG_NUM,
+} ser_proto_msg_t;
+
+/* 所有负载的联合：只用于求最大负载长度 */
+typedef union
+{
+#define SER_PROTO_X_UNION(name, id, type) type name;
+  SER_PROTO_MSG_TABLE(SER_PROTO_X_UNION)
+#undef SER_PROTO_X_UNION
+} ser_proto_any_t;
+
+/* 解码后最大帧长（id + 负载 + crc）与线上最大帧长（含分隔符） */
+#define SER_PROTO_MAX_RAW (1u + sizeof(ser_proto_any_t) + 2u)
+#define SER_PROTO_MAX_WIRE (SER_COBS_MAX_ENC(SER_PROTO_MAX_RAW) + 1u)
+
+/* 负载指针指向接收缓冲（可能未对齐，消息结构体均为 packed），仅在回调期间有效 */
+typedef void (*ser_proto_handler_t)(ser_proto_msg_t msg, const void *payload,
+                                    void *arg);
+
+typedef struct
+{
+  uint32_t frames;    /* 校验通过并分发的帧 */
+  uint32_t unhandled; /* 校验通过但没有 handler */
+  uint32_t crc_err;
+  uint32_t cobs_err;  /* COBS 码流损坏 */
+  uint32_t len_err;   /* 负载长度与消息表不符 / 帧太短 */
+  uint32_t unknown;   /* 未知 id */
+  uint32_t too_long;  /* 超过 SER_PROTO_MAX_WIRE 未见分隔符 */
+  uint32_t overrun;   /* 接收环被写指针追上 */
+  uint32_t tx_frames;
+  uint32_t tx_drop;   /* 串口忙，丢弃的发送帧 */
+} ser_proto_stats_t;
+
+/* 接收环状态：计数均为累计字节数（32 位回绕），下标 = 计数 & (size - 1) */
+typedef struct
+{
+  uint8_t *buf;
+  uint32_t size;
+  uint32_t rd;   /* 当前帧起点 */
+  uint32_t scan; /* 已找过分隔符的位置 */
+  bool discard;  /* 丢弃到下一个分隔符 */
+} ser_proto_rx_t;
+
+/* handler 注册（调度器启动前或任务上下文）；同一消息只保留最后一次注册 */
+bool ser_proto_on(ser_proto_msg_t msg, ser_proto_handler_t fn, void *arg);
+
+/* id <-> 消息编号；未知 id 返回 SER_PROTO_MSG_NUM */
+ser_proto_msg_t ser_proto_msg_of_id(uint8_t id);
+uint8_t ser_proto_msg_id(ser_proto_msg_t msg);
+uint16_t ser_proto_msg_size(ser_proto_msg_t msg);
+
+/* 编码一帧（含结尾分隔符），返回写入字节数，cap 不足返回 0 */
+uint32_t ser_proto_encode(ser_proto_msg_t msg, const void *payload,
+                          uint8_t *out, uint32_t cap);
+
+/*
+ * 处理一个已切出的帧（不含分隔符）：原地解码、校验、分发
+ * 任意字节序列都可以安全喂入（模糊测试入口）
+ */
+bool ser_proto_frame(uint8_t *frame, uint32_t len);
+
+/* 接收环：size 为 2 的幂 */
+void ser_proto_rx_init(ser_proto_rx_t *rx, uint8_t *buf, uint32_t size);
+
+/* 处理 [rd, wr_total) 之间的数据，返回分发的帧数 */
+uint32_t ser_proto_rx_poll(ser_proto_rx_t *rx, uint32_t wr_total);
+
+/* 写指针跳变（接收重启）后从 wr_total 重新同步 */
+void ser_proto_rx_resync(ser_proto_rx_t *rx, uint32_t wr_total);
+
+void ser_proto_get_stats(ser_proto_stats_t *stats);
+void ser_proto_reset_stats(void);
+
+#if !defined(SER_PROTO_HOST) || !SER_PROTO_HOST
+/* 初始化控制台、注册内置 handler（调度器启动前调用） */
+bool ser_proto_init(void);
+
+/* 协议任务入口（由 app 任务表静态创建）：启动循环 DMA 接收并处理收到的帧 */
+#ifndef SER_PROTO_TASK_STACK
+#define SER_PROTO_TASK_STACK 384u
+#endif
+void ser_proto_task(void *argument);
+
+/* 发送一帧（任务上下文）；串口忙时丢弃并返回 false */
+bool ser_proto_send(ser_proto_msg_t msg, const void *payload);
+
+#define SER_PROTO_X_SEND(name, id, type)                                       \
+  static inline bool ser_proto_send_##name(const type *v)                     \
+  {                                                                            \
+    return ser_proto_send(SER_PROTO_MSG_##name, v);                            \
+  }
+SER_PROTO_MSG_TABLE(SER_PROTO_X_SEND)
+#undef SER_PROTO_X_SEND
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
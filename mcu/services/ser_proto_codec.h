@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：协议帧编解码（COBS + CRC-16，与平台无关，主机/MCU 共用）
+ *
+ * COBS（Consistent Overhead Byte Stuffing）：
+ * - 编码后不含 0x00，0x00 只作帧分隔符；任意位置丢字节/插入噪声，下一个 0x00 即可重新同步
+ * - 开销固定：每 254 字节最多多 1 字节
+ * - 解码输出总比输入慢至少 1 字节，可以原地解码（dst == src）
+ *
+ * CRC-16/CCITT-FALSE：poly 0x1021，init 0xFFFF，不反射，无异或输出（查表，表在 flash）
+ */
+
+/* n 字节原文 COBS 编码后的最大长度（不含分隔符） */
+#define SER_COBS_MAX_ENC(n) ((n) + (n) / 254u + 1u)
+
+uint16_t ser_crc16(uint16_t crc, const uint8_t *data, uint32_t len);
+
+#define SER_CRC16_INIT 0xFFFFu
+
+/*
+ * 增量编码：原文可以分几段 put（例如 id / 负载 / CRC 三段，不必先拼接）
+ * - 输出不含分隔符，end 返回编码长度；cap 不足时返回 0
+ */
+typedef struct
+{
+  uint8_t *out;
+  uint32_t cap;
+  uint32_t n;
+  uint32_t code_pos; /* 当前码字节位置 */
+  uint8_t code;
+  bool overflow;
+} ser_cobs_enc_t;
+
+void ser_cobs_enc_begin(ser_cobs_enc_t *e, uint8_t *out, uint32_t cap);
+void ser_cobs_enc_put(ser_cobs_enc_t *e, const uint8_t *data, uint32_t len);
+uint32_t ser_cobs_enc_end(ser_cobs_enc_t *e);
+
+/*
+ * 解码（src 不含分隔符）：
+ * - 源可以分两段（环形缓冲跨越末尾时），seg1 在前；只有一段时 n2 = 0
+ * - dst 可以等于 src1（原地解码，仅限只有一段时）
+ * - 返回解码长度；码流含 0x00、码字节越界或超出 cap 时返回 -1
+ */
+int32_t ser_cobs_decode(const uint8_t *src1, uint32_t n1, const uint8_t *src2,
+                        uint32_t n2, uint8_t *dst, uint32_t cap);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * services/ 层：协议消息表（声明式描述）
+ *
+ * 每一项 X(name, id, type) 在编译期展开为：
+ * - 消息编号 SER_PROTO_MSG_<name>，以及 id -> 编号的查找（switch）
+ * - 负载长度校验（收到的负载必须正好 sizeof(type)）
+ * - 发送接口 ser_proto_send_<name>(const type *)
+ *
+ * 约定：
+ * - id 0x01..0x7F：上位机 -> MCU（请求/配置）；0x80..0xFF：MCU -> 上位机（应答/遥测）
+ * - 负载为 packed 定长结构体，多字节字段小端
+ * - 改动本表需同步 project/tools/proto.py
+ *
+ * 本文件只能被 ser_proto.h 包含。
+ */
+
+typedef struct __attribute__((packed))
+{
+  uint32_t token;
+} ser_proto_ping_t;
+
+typedef struct __attribute__((packed))
+{
+  uint8_t topic; /* ser_bus_topic_t */
+} ser_proto_bus_stats_req_t;
+
+typedef struct __attribute__((packed))
+{
+  uint8_t distance; /* 非 0：每次测距后发送 distance 遥测 */
+} ser_proto_telemetry_cfg_t;
+
+typedef struct __attribute__((packed))
+{
+  uint32_t token;     /* 原样回送 ping.token */
+  uint32_t uptime_ms;
+} ser_proto_pong_t;
+
+typedef struct __attribute__((packed))
+{
+  uint8_t topic;
+  uint32_t publishes;
+  uint32_t rate_mhz;
+  uint32_t lat_last_us;
+  uint32_t lat_max_us;
+  uint32_t stale;
+} ser_proto_bus_stats_t;
+
+typedef struct __attribute__((packed))
+{
+  int32_t mm; /* 无有效测距为 -1 */
+} ser_proto_distance_t;
+
+// clang-format off
+#define SER_PROTO_MSG_TABLE(X)                                                 \
+  X(ping,          0x01u, ser_proto_ping_t)                                    \
+  X(bus_stats_req, 0x02u, ser_proto_bus_stats_req_t)                           \
+  X(telemetry_cfg, 0x03u, ser_proto_telemetry_cfg_t)                           \
+  X(pong,          0x81u, ser_proto_pong_t)                                    \
+  X(bus_stats,     0x82u, ser_proto_bus_stats_t)                               \
+  X(distance,      0x90u, ser_proto_distance_t)
+// clang-format on
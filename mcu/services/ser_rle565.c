@@ -0,0 +1,279 @@
+#include "ser_rle565.h"
+
+#include <stddef.h>
+
+/* RUN 至少 3 个像素才划算（2 个像素与 LIT 同为 4 字节） */
+#define RLE_RUN_MIN 3u
+
+static uint8_t *put_px(uint8_t *p, uint16_t c)
+{
+  p[0] = (uint8_t)(c & 0xFFu);
+  p[1] = (uint8_t)(c >> 8);
+  return p + 2;
+}
+
+static uint16_t get_px(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t count_row(const uint16_t *row, const uint16_t *prev,
+                          uint32_t i, uint32_t w)
+{
+  uint32_t n = 0;
+  while (i + n < w && n < SER_RLE565_MAX_COUNT && row[i + n] == prev[i + n])
+  {
+    n++;
+  }
+  return n;
+}
+
+static uint32_t count_run(const uint16_t *row, uint32_t i, uint32_t w)
+{
+  uint32_t n = 1;
+  while (i + n < w && n < SER_RLE565_MAX_COUNT && row[i + n] == row[i])
+  {
+    n++;
+  }
+  return n;
+}
+
+uint32_t ser_rle565_encode_row(const uint16_t *row, const uint16_t *prev,
+                               uint32_t w, uint8_t *out, uint32_t cap)
+{
+  if (row == NULL || out == NULL)
+  {
+    return 0u;
+  }
+
+  uint8_t *p = out;
+  uint8_t *const end = out + cap;
+  uint32_t i = 0;
+
+  while (i < w)
+  {
+    /* 与上一行相同：1 字节覆盖最多 64 像素 */
+    uint32_t n = (prev != NULL) ? count_row(row, prev, i, w) : 0u;
+    if (n > 0u)
+    {
+      if (p >= end)
+        return 0u;
+      *p++ = (uint8_t)(SER_RLE565_OP_ROW | (n - 1u));
+      i += n;
+      continue;
+    }
+
+    n = count_run(row, i, w);
+    if (n >= RLE_RUN_MIN)
+    {
+      if (end - p < 3)
+        return 0u;
+      *p++ = (uint8_t)(SER_RLE565_OP_RUN | (n - 1u));
+      p = put_px(p, row[i]);
+      i += n;
+      continue;
+    }
+
+    /* LIT：一直吃到下一个可用 ROW/RUN 的位置 */
+    uint32_t start = i;
+    n = 0;
+    while (i < w && n < SER_RLE565_MAX_COUNT)
+    {
+      if (n > 0u && ((prev != NULL && row[i] == prev[i]) ||
+                     (i + 2u < w && row[i] == row[i + 1u] &&
+                      row[i] == row[i + 2u])))
+      {
+        break;
+      }
+      i++;
+      n++;
+    }
+
+    if ((uint32_t)(end - p) < 1u + n * 2u)
+      return 0u;
+    *p++ = (uint8_t)(SER_RLE565_OP_LIT | (n - 1u));
+    for (uint32_t k = 0; k < n; k++)
+    {
+      p = put_px(p, row[start + k]);
+    }
+  }
+
+  return (uint32_t)(p - out);
+}
+
+uint32_t ser_rle565_encode(const uint16_t *px, uint32_t w, uint32_t h,
+                           uint32_t stride, uint8_t *out, uint32_t cap)
+{
+  if (px == NULL || out == NULL || w == 0u || h == 0u)
+  {
+    return 0u;
+  }
+
+  uint32_t n = 0;
+  const uint16_t *prev = NULL;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    const uint16_t *row = px + (size_t)y * stride;
+    uint32_t k = ser_rle565_encode_row(row, prev, w, out + n, cap - n);
+    if (k == 0u)
+    {
+      return 0u;
+    }
+    n += k;
+    prev = row;
+  }
+  return n;
+}
+
+bool ser_rle565_decode_row(const uint8_t **src, const uint8_t *end,
+                           uint16_t *row, const uint16_t *prev, uint32_t w)
+{
+  if (src == NULL || *src == NULL || row == NULL)
+  {
+    return false;
+  }
+
+  const uint8_t *p = *src;
+  uint32_t i = 0;
+  while (i < w)
+  {
+    if (p >= end)
+      return false;
+
+    uint8_t op = *p++;
+    uint32_t n = (uint32_t)(op & ~SER_RLE565_OP_MASK) + 1u;
+    if (i + n > w)
+      return false;
+
+    switch (op & SER_RLE565_OP_MASK)
+    {
+    case SER_RLE565_OP_LIT:
+      if ((uint32_t)(end - p) < n * 2u)
+        return false;
+      for (uint32_t k = 0; k < n; k++)
+      {
+        row[i + k] = get_px(p);
+        p += 2;
+      }
+      break;
+    case SER_RLE565_OP_RUN:
+    {
+      if (end - p < 2)
+        return false;
+      uint16_t c = get_px(p);
+      p += 2;
+      for (uint32_t k = 0; k < n; k++)
+      {
+        row[i + k] = c;
+      }
+      break;
+    }
+    case SER_RLE565_OP_ROW:
+      if (prev == NULL)
+        return false;
+      for (uint32_t k = 0; k < n; k++)
+      {
+        row[i + k] = prev[i + k];
+      }
+      break;
+    default:
+      return false;
+    }
+    i += n;
+  }
+
+  *src = p;
+  return true;
+}
+
+bool ser_rle565_decode_row_clip(const uint8_t **src, const uint8_t *end,
+                                uint16_t *row, const uint16_t *prev,
+                                uint32_t w, uint32_t x1, uint32_t x2)
+{
+  if (src == NULL || *src == NULL || row == NULL || x1 > x2 || x2 >= w)
+  {
+    return false;
+  }
+
+  const uint8_t *p = *src;
+  uint32_t i = 0;
+  while (i < w)
+  {
+    if (p >= end)
+      return false;
+
+    uint8_t op = *p++;
+    uint32_t n = (uint32_t)(op & ~SER_RLE565_OP_MASK) + 1u;
+    if (i + n > w)
+      return false;
+
+    /* 与窗口的交集 [a, b)，相对窗口起点 */
+    const uint32_t a = (i > x1) ? i : x1;
+    const uint32_t b = (i + n <= x2 + 1u) ? i + n : x2 + 1u;
+
+    switch (op & SER_RLE565_OP_MASK)
+    {
+    case SER_RLE565_OP_LIT:
+      if ((uint32_t)(end - p) < n * 2u)
+        return false;
+      for (uint32_t k = a; k < b; k++)
+      {
+        row[k - x1] = get_px(p + (k - i) * 2u);
+      }
+      p += n * 2u;
+      break;
+    case SER_RLE565_OP_RUN:
+    {
+      if (end - p < 2)
+        return false;
+      uint16_t c = get_px(p);
+      p += 2;
+      for (uint32_t k = a; k < b; k++)
+      {
+        row[k - x1] = c;
+      }
+      break;
+    }
+    case SER_RLE565_OP_ROW:
+      if (prev == NULL)
+        return false;
+      if (prev != row)
+      {
+        for (uint32_t k = a; k < b; k++)
+        {
+          row[k - x1] = prev[k - x1];
+        }
+      }
+      break;
+    default:
+      return false;
+    }
+    i += n;
+  }
+
+  *src = p;
+  return true;
+}
+
+bool ser_rle565_decode(const uint8_t *src, uint32_t len, uint16_t *dst,
+                       uint32_t w, uint32_t h, uint32_t dst_stride)
+{
+  if (src == NULL || dst == NULL)
+  {
+    return false;
+  }
+
+  const uint8_t *p = src;
+  const uint8_t *end = src + len;
+  const uint16_t *prev = NULL;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    uint16_t *row = dst + (size_t)y * dst_stride;
+    if (!ser_rle565_decode_row(&p, end, row, prev, w))
+    {
+      return false;
+    }
+    prev = row;
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：RGB565 行内游程 + 行间差分编码（与平台无关，主机/MCU 共用）
+ *
+ * 码流按行组织，操作码不跨行：
+ *   0b00nnnnnn  LIT  n+1 个原始像素，后跟 (n+1) * u16 LE
+ *   0b01nnnnnn  RUN  同一像素重复 n+1 次，后跟 1 * u16 LE
+ *   0b10nnnnnn  ROW  与上一行同位置的 n+1 个像素相同，无负载
+ *   0b11xxxxxx  保留
+ *
+ * 说明：
+ * - UI 画面大块纯色（RUN）与上下行重复（ROW，渐变以外的边框/文字间隙）居多
+ * - 每行独立可解：给出上一行像素即可从任意行开始解码
+ * - 矩形第一行（或没有上一行时）不使用 ROW
+ */
+
+#define SER_RLE565_OP_LIT 0x00u
+#define SER_RLE565_OP_RUN 0x40u
+#define SER_RLE565_OP_ROW 0x80u
+#define SER_RLE565_OP_MASK 0xC0u
+#define SER_RLE565_MAX_COUNT 64u
+
+/* 一行 w 像素的最坏编码长度（全部为 LIT） */
+#define SER_RLE565_ROW_MAX_BYTES(w)                                            \
+  (((w) + SER_RLE565_MAX_COUNT - 1u) / SER_RLE565_MAX_COUNT + (w) * 2u)
+
+/*
+ * 编码一行
+ * - prev 为上一行（同 x 起点），为 NULL 时不使用 ROW
+ * - 返回写入字节数；cap 不足时返回 0（out 内容无效）
+ */
+uint32_t ser_rle565_encode_row(const uint16_t *row, const uint16_t *prev,
+                               uint32_t w, uint8_t *out, uint32_t cap);
+
+/* 编码 w x h 矩形（源行距 stride 像素），返回写入字节数，cap 不足时返回 0 */
+uint32_t ser_rle565_encode(const uint16_t *px, uint32_t w, uint32_t h,
+                           uint32_t stride, uint8_t *out, uint32_t cap);
+
+/*
+ * 解码一行
+ * - *src 前进到下一行起点；码流损坏/越界时返回 false
+ * - prev 为上一行输出（遇到 ROW 且 prev 为 NULL 视为损坏）
+ */
+bool ser_rle565_decode_row(const uint8_t **src, const uint8_t *end,
+                           uint16_t *row, const uint16_t *prev, uint32_t w);
+
+/*
+ * 只解码一行的 x1..x2 列（闭区间，x2 < w），写到 row[0 .. x2-x1]
+ * - prev 同样只含上一行的 x1..x2 列：ROW 只引用同一列，窗口外不需要上一行
+ * - 窗口外的操作码只解析不写（LIT 负载直接跳过）；*src 仍前进到下一行起点
+ * - row 与 prev 可以是同一块缓冲（逐行原地更新）
+ */
+bool ser_rle565_decode_row_clip(const uint8_t **src, const uint8_t *end,
+                                uint16_t *row, const uint16_t *prev,
+                                uint32_t w, uint32_t x1, uint32_t x2);
+
+/* 解码 w x h 矩形到 dst（行距 dst_stride 像素） */
+bool ser_rle565_decode(const uint8_t *src, uint32_t len, uint16_t *dst,
+                       uint32_t w, uint32_t h, uint32_t dst_stride);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,206 @@
+#include "ser_rot565.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if (SER_ROT565_TILE & 1u) != 0u || SER_ROT565_TILE < 2u
+#error "SER_ROT565_TILE must be an even number >= 2"
+#endif
+
+/* 两像素一个字：低半字为地址较低的像素（小端） */
+static inline uint32_t ld2(const uint16_t *p)
+{
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline void st2(uint16_t *p, uint32_t v)
+{
+  memcpy(p, &v, sizeof(v));
+}
+
+static inline uint32_t min_u32(uint32_t a, uint32_t b)
+{
+  return (a < b) ? a : b;
+}
+
+/*
+ * 90：src[j][i] -> dst[w-1-i][j]
+ * - 2x2：a = src[j][i..i+1]，c = src[j+1][i..i+1]
+ *   dst[w-1-i][j..j+1] = (a.lo, c.lo)，dst[w-2-i][j..j+1] = (a.hi, c.hi)
+ */
+static void rot90_tile(uint16_t *dst, uint32_t ds, const uint16_t *src,
+                       uint32_t ss, uint32_t w, uint32_t i0, uint32_t i1,
+                       uint32_t j0, uint32_t j1)
+{
+  uint32_t j = j0;
+  for (; j + 1u < j1; j += 2u)
+  {
+    const uint16_t *s0 = src + j * ss;
+    const uint16_t *s1 = s0 + ss;
+    uint32_t i = i0;
+    for (; i + 1u < i1; i += 2u)
+    {
+      const uint32_t a = ld2(s0 + i);
+      const uint32_t c = ld2(s1 + i);
+      uint16_t *d = dst + (w - 2u - i) * ds + j;
+      st2(d + ds, (a & 0xFFFFu) | (c << 16));
+      st2(d, (a >> 16) | (c & 0xFFFF0000u));
+    }
+    if (i < i1)
+    {
+      uint16_t *d = dst + (w - 1u - i) * ds + j;
+      d[0] = s0[i];
+      d[1] = s1[i];
+    }
+  }
+  if (j < j1)
+  {
+    const uint16_t *s0 = src + j * ss;
+    for (uint32_t i = i0; i < i1; i++)
+    {
+      dst[(w - 1u - i) * ds + j] = s0[i];
+    }
+  }
+}
+
+/*
+ * 270：src[j][i] -> dst[i][h-1-j]
+ * - 2x2：dst[i][h-2-j..h-1-j] = (c.lo, a.lo)，dst[i+1][..] = (c.hi, a.hi)
+ */
+static void rot270_tile(uint16_t *dst, uint32_t ds, const uint16_t *src,
+                        uint32_t ss, uint32_t h, uint32_t i0, uint32_t i1,
+                        uint32_t j0, uint32_t j1)
+{
+  uint32_t j = j0;
+  for (; j + 1u < j1; j += 2u)
+  {
+    const uint16_t *s0 = src + j * ss;
+    const uint16_t *s1 = s0 + ss;
+    uint32_t i = i0;
+    for (; i + 1u < i1; i += 2u)
+    {
+      const uint32_t a = ld2(s0 + i);
+      const uint32_t c = ld2(s1 + i);
+      uint16_t *d = dst + i * ds + (h - 2u - j);
+      st2(d, (c & 0xFFFFu) | (a << 16));
+      st2(d + ds, (c >> 16) | (a & 0xFFFF0000u));
+    }
+    if (i < i1)
+    {
+      uint16_t *d = dst + i * ds + (h - 2u - j);
+      d[0] = s1[i];
+      d[1] = s0[i];
+    }
+  }
+  if (j < j1)
+  {
+    const uint16_t *s0 = src + j * ss;
+    for (uint32_t i = i0; i < i1; i++)
+    {
+      dst[i * ds + (h - 1u - j)] = s0[i];
+    }
+  }
+}
+
+/* 180：src[j][i] -> dst[h-1-j][w-1-i]，一个字内两像素交换 */
+static void rot180(uint16_t *dst, uint32_t ds, const uint16_t *src,
+                   uint32_t ss, uint32_t w, uint32_t h)
+{
+  for (uint32_t j = 0; j < h; j++)
+  {
+    const uint16_t *s = src + j * ss;
+    uint16_t *d = dst + (h - 1u - j) * ds;
+    uint32_t i = 0;
+    for (; i + 1u < w; i += 2u)
+    {
+      const uint32_t v = ld2(s + i);
+      st2(d + (w - 2u - i), (v >> 16) | (v << 16));
+    }
+    if (i < w)
+    {
+      d[0] = s[i];
+    }
+  }
+}
+
+void ser_rot565_rotate(uint16_t *dst, uint32_t dst_stride, const uint16_t *src,
+                       uint32_t src_stride, uint32_t w, uint32_t h,
+                       ser_rot565_t rot)
+{
+  if (dst == NULL || src == NULL || w == 0u || h == 0u)
+  {
+    return;
+  }
+
+  const uint32_t T = SER_ROT565_TILE;
+
+  switch (rot)
+  {
+  case SER_ROT565_0:
+    for (uint32_t j = 0; j < h; j++)
+    {
+      memcpy(dst + j * dst_stride, src + j * src_stride, w * 2u);
+    }
+    break;
+  case SER_ROT565_180:
+    rot180(dst, dst_stride, src, src_stride, w, h);
+    break;
+  case SER_ROT565_90:
+  case SER_ROT565_270:
+    /* 块按源行优先遍历：一条块带内源读取连续，目标写入落在 TILE 行内 */
+    for (uint32_t j0 = 0; j0 < h; j0 += T)
+    {
+      const uint32_t j1 = min_u32(j0 + T, h);
+      for (uint32_t i0 = 0; i0 < w; i0 += T)
+      {
+        const uint32_t i1 = min_u32(i0 + T, w);
+        if (rot == SER_ROT565_90)
+        {
+          rot90_tile(dst, dst_stride, src, src_stride, w, i0, i1, j0, j1);
+        }
+        else
+        {
+          rot270_tile(dst, dst_stride, src, src_stride, h, i0, i1, j0, j1);
+        }
+      }
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+void ser_rot565_map_area(ser_rot565_t rot, int32_t phys_w, int32_t phys_h,
+                         int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2)
+{
+  const int32_t ax1 = *x1;
+  const int32_t ay1 = *y1;
+  const int32_t ax2 = *x2;
+  const int32_t ay2 = *y2;
+
+  switch (rot)
+  {
+  case SER_ROT565_90:
+    *x1 = ay1;
+    *x2 = ay2;
+    *y1 = phys_h - 1 - ax2;
+    *y2 = phys_h - 1 - ax1;
+    break;
+  case SER_ROT565_180:
+    *x1 = phys_w - 1 - ax2;
+    *x2 = phys_w - 1 - ax1;
+    *y1 = phys_h - 1 - ay2;
+    *y2 = phys_h - 1 - ay1;
+    break;
+  case SER_ROT565_270:
+    *x1 = phys_w - 1 - ay2;
+    *x2 = phys_w - 1 - ay1;
+    *y1 = ax1;
+    *y2 = ax2;
+    break;
+  default:
+    break;
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：RGB565 矩形 90/180/270° 旋转（与平台无关，主机/MCU 共用）
+ *
+ * 背景：
+ * - 逐像素转置时读是顺序的、写却每个像素跨一整行（竖屏 480 像素 = 960 字节），
+ *   SDRAM 上每次写都落在不同的行地址，FMC 只能一个半字一个半字地写
+ *
+ * 做法：
+ * - 90/270 按 SER_ROT565_TILE x SER_ROT565_TILE 分块转置：一块内读写各自只涉及
+ *   TILE 行，跨行访问集中在少数几个 SDRAM 行（FMC 每个 bank 保持一行打开）
+ * - 块内以 2x2 像素为单位：两行各读一个字（2 像素），拼成目标两行各一个字写出，
+ *   读写总线访问次数都减半
+ * - 180 不需要转置：逐行倒序，一次读写一个字（两像素交换半字）
+ *
+ * 坐标约定与 LVGL 的 lv_display_rotation_t 相同（顺时针）：
+ * - 逻辑坐标 (x, y) 落在物理坐标：90 -> (y, H-1-x)，180 -> (W-1-x, H-1-y)，
+ *   270 -> (W-1-y, x)，W/H 为物理（面板）尺寸
+ */
+
+/* 分块边长（像素，偶数） */
+#ifndef SER_ROT565_TILE
+#define SER_ROT565_TILE 16u
+#endif
+
+typedef enum
+{
+  SER_ROT565_0 = 0,
+  SER_ROT565_90,
+  SER_ROT565_180,
+  SER_ROT565_270,
+} ser_rot565_t;
+
+/*
+ * 旋转 w x h 的源矩形（行距 src_stride 像素）写入 dst（行距 dst_stride 像素）
+ * - dst 指向目标矩形（物理坐标）的左上角；90/270 时目标为 h x w
+ * - 源与目标不能重叠；不要求 4 字节对齐（Cortex-M4 普通内存支持非对齐字访问）
+ */
+void ser_rot565_rotate(uint16_t *dst, uint32_t dst_stride, const uint16_t *src,
+                       uint32_t src_stride, uint32_t w, uint32_t h,
+                       ser_rot565_t rot);
+
+/*
+ * 逻辑坐标下的矩形（闭区间）换算为物理坐标，phys_w/phys_h 为物理尺寸
+ * - 矩形须在逻辑屏幕范围内
+ */
+void ser_rot565_map_area(ser_rot565_t rot, int32_t phys_w, int32_t phys_h,
+                         int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,427 @@
+#include "ser_sdram_bench.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(SER_SDRAM_BENCH_HOST) || !SER_SDRAM_BENCH_HOST
+#include "dev_console.h"
+#include "dev_lcd.h"
+#include "dev_sdram.h"
+#include "dri_time_us.h"
+#endif
+
+/* 随机访问的槽位步长：大于 FMC 读 FIFO 预取，保证每次都是新的列访问 */
+#define BENCH_SLOT_BYTES 32u
+#define BENCH_SLOT_WORDS (BENCH_SLOT_BYTES / 4u)
+
+/* 防止累加结果被优化掉 */
+static volatile uint32_t s_sink;
+
+static uint32_t xorshift32(uint32_t *s)
+{
+  uint32_t x = *s;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *s = x;
+  return x;
+}
+
+static uint32_t kbps(const ser_sdram_bench_port_t *port, uint32_t bytes,
+                     uint32_t cycles)
+{
+  if (cycles == 0u)
+  {
+    return 0u;
+  }
+  return (uint32_t)((uint64_t)bytes * port->hz / cycles / 1000u);
+}
+
+static uint32_t ns_per(const ser_sdram_bench_port_t *port, uint32_t cycles,
+                       uint32_t n)
+{
+  if (port->hz == 0u || n == 0u)
+  {
+    return 0u;
+  }
+  return (uint32_t)((uint64_t)cycles * 1000000000u / port->hz / n);
+}
+
+static uint32_t seq_read(const ser_sdram_bench_port_t *port, void *ctx,
+                         const volatile uint32_t *p, uint32_t words)
+{
+  uint32_t a = 0, b = 0, c = 0, d = 0;
+  uint32_t t0 = port->now(ctx);
+  for (uint32_t i = 0; i + 8u <= words; i += 8u)
+  {
+    a += p[i + 0];
+    b += p[i + 1];
+    c += p[i + 2];
+    d += p[i + 3];
+    a += p[i + 4];
+    b += p[i + 5];
+    c += p[i + 6];
+    d += p[i + 7];
+  }
+  uint32_t cycles = port->now(ctx) - t0;
+  s_sink = a + b + c + d;
+  return cycles;
+}
+
+static uint32_t seq_write(const ser_sdram_bench_port_t *port, void *ctx,
+                          volatile uint32_t *p, uint32_t words, uint32_t v)
+{
+  uint32_t t0 = port->now(ctx);
+  for (uint32_t i = 0; i + 8u <= words; i += 8u)
+  {
+    p[i + 0] = v;
+    p[i + 1] = v;
+    p[i + 2] = v;
+    p[i + 3] = v;
+    p[i + 4] = v;
+    p[i + 5] = v;
+    p[i + 6] = v;
+    p[i + 7] = v;
+  }
+  return port->now(ctx) - t0;
+}
+
+/*
+ * Sattolo 洗牌得到覆盖全部槽位的单环；每个槽位首字存下一个槽位的字下标
+ * 返回槽位数
+ */
+static uint32_t build_chain(volatile uint32_t *p, uint32_t slots)
+{
+  for (uint32_t i = 0; i < slots; i++)
+  {
+    p[i * BENCH_SLOT_WORDS] = i;
+  }
+
+  uint32_t seed = 0x2545F491u;
+  for (uint32_t i = slots - 1u; i > 0u; i--)
+  {
+    uint32_t j = xorshift32(&seed) % i;
+    uint32_t t = p[i * BENCH_SLOT_WORDS];
+    p[i * BENCH_SLOT_WORDS] = p[j * BENCH_SLOT_WORDS];
+    p[j * BENCH_SLOT_WORDS] = t;
+  }
+
+  for (uint32_t i = 0; i < slots; i++)
+  {
+    p[i * BENCH_SLOT_WORDS] *= BENCH_SLOT_WORDS;
+  }
+  return slots;
+}
+
+static uint32_t rand_read(const ser_sdram_bench_port_t *port, void *ctx,
+                          const volatile uint32_t *p, uint32_t n)
+{
+  uint32_t idx = 0;
+  uint32_t t0 = port->now(ctx);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    idx = p[idx];
+  }
+  uint32_t cycles = port->now(ctx) - t0;
+  s_sink = idx;
+  return cycles;
+}
+
+static uint32_t rand_write(const ser_sdram_bench_port_t *port, void *ctx,
+                           volatile uint32_t *p, uint32_t slots_pow2,
+                           uint32_t n)
+{
+  uint32_t seed = 0x9E3779B9u;
+  uint32_t mask = slots_pow2 - 1u;
+  uint32_t t0 = port->now(ctx);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    p[(xorshift32(&seed) & mask) * BENCH_SLOT_WORDS] = i;
+  }
+  return port->now(ctx) - t0;
+}
+
+static uint32_t verify_pass(volatile uint32_t *p, uint32_t words,
+                            uint32_t invert)
+{
+  for (uint32_t i = 0; i < words; i++)
+  {
+    p[i] = (i * 0x9E3779B1u) ^ invert;
+  }
+
+  uint32_t errors = 0;
+  for (uint32_t i = 0; i < words; i++)
+  {
+    if (p[i] != ((i * 0x9E3779B1u) ^ invert))
+    {
+      errors++;
+    }
+  }
+  return errors;
+}
+
+static uint32_t floor_pow2(uint32_t v)
+{
+  uint32_t p = 1u;
+  while ((p << 1) != 0u && (p << 1) <= v)
+  {
+    p <<= 1;
+  }
+  return p;
+}
+
+void ser_sdram_bench_measure(const ser_sdram_bench_port_t *port, void *ctx,
+                             void *base, uint32_t bytes,
+                             ser_sdram_bench_result_t *out)
+{
+  if (out == NULL)
+  {
+    return;
+  }
+  memset(out, 0, sizeof(*out));
+  if (port == NULL || port->now == NULL || base == NULL || bytes < 4096u)
+  {
+    return;
+  }
+
+  volatile uint32_t *p = (volatile uint32_t *)base;
+  uint32_t words = (bytes / 4u) & ~7u;
+  uint32_t used = words * 4u;
+
+  /* 先写后读：读的是刚写入的有效数据，避免未初始化区域的偶发错误干扰 */
+  out->seq_write_kbps =
+      kbps(port, used, seq_write(port, ctx, p, words, 0x5A5AA5A5u));
+  out->seq_read_kbps = kbps(port, used, seq_read(port, ctx, p, words));
+
+  uint32_t half = (used / 2u) & ~31u;
+  uint32_t t0 = port->now(ctx);
+  memcpy((uint8_t *)base + half, base, half);
+  out->copy_kbps = kbps(port, half * 2u, port->now(ctx) - t0);
+
+  uint32_t slots = used / BENCH_SLOT_BYTES;
+  uint32_t n = build_chain(p, slots);
+  out->rand_read_ns = ns_per(port, rand_read(port, ctx, p, n), n);
+
+  uint32_t slots_pow2 = floor_pow2(slots);
+  out->rand_write_ns =
+      ns_per(port, rand_write(port, ctx, p, slots_pow2, slots_pow2), slots_pow2);
+
+  out->errors = verify_pass(p, words, 0u) + verify_pass(p, words, ~0u);
+}
+
+static int fmt_mbps(char *buf, uint32_t cap, uint32_t kbps_v)
+{
+  return snprintf(buf, cap, "%lu.%lu", (unsigned long)(kbps_v / 1000u),
+                  (unsigned long)((kbps_v % 1000u) / 100u));
+}
+
+int ser_sdram_bench_format_header(char *buf, uint32_t cap)
+{
+  return snprintf(buf, cap,
+                  "# sdram,profile,ltdc,dma2d,seq_rd_MBps,seq_wr_MBps,"
+                  "copy_MBps,rand_rd_ns,rand_wr_ns,errors");
+}
+
+int ser_sdram_bench_format(char *buf, uint32_t cap, const char *profile,
+                           bool ltdc, bool dma2d,
+                           const ser_sdram_bench_result_t *r)
+{
+  if (buf == NULL || cap == 0u || r == NULL)
+  {
+    return 0;
+  }
+
+  char rd[16], wr[16], cp[16];
+  (void)fmt_mbps(rd, sizeof(rd), r->seq_read_kbps);
+  (void)fmt_mbps(wr, sizeof(wr), r->seq_write_kbps);
+  (void)fmt_mbps(cp, sizeof(cp), r->copy_kbps);
+
+  int n = snprintf(buf, cap, "sdram,%s,%d,%d,%s,%s,%s,%lu,%lu,%lu",
+                   (profile != NULL) ? profile : "current", ltdc ? 1 : 0,
+                   dma2d ? 1 : 0, rd, wr, cp,
+                   (unsigned long)r->rand_read_ns,
+                   (unsigned long)r->rand_write_ns, (unsigned long)r->errors);
+  return (n < 0) ? 0 : ((uint32_t)n >= cap ? (int)cap - 1 : n);
+}
+
+static void emit(const ser_sdram_bench_port_t *port, void *ctx,
+                 const char *line)
+{
+  if (port->emit != NULL)
+  {
+    port->emit(ctx, line);
+  }
+}
+
+int32_t ser_sdram_bench_run(const ser_sdram_bench_port_t *port, void *ctx,
+                            void *base, uint32_t bytes)
+{
+  if (port == NULL)
+  {
+    return -1;
+  }
+
+  char line[SER_SDRAM_BENCH_LINE_MAX];
+  (void)ser_sdram_bench_format_header(line, sizeof(line));
+  emit(port, ctx, line);
+
+  uint32_t n_prof = (port->profile_count != 0u) ? port->profile_count : 1u;
+  int32_t best = -1;
+  uint32_t best_score = 0;
+
+  for (uint32_t pi = 0; pi < n_prof; pi++)
+  {
+    const char *name = (port->profile_name != NULL && port->profile_count != 0u)
+                           ? port->profile_name(ctx, pi)
+                           : NULL;
+
+    /* 切换配置档前先撤掉所有负载 */
+    if (port->load_set != NULL)
+    {
+      (void)port->load_set(ctx, false, false);
+    }
+    if (port->profile_apply != NULL && port->profile_count != 0u &&
+        !port->profile_apply(ctx, pi))
+    {
+      (void)snprintf(line, sizeof(line), "# sdram,%s,apply failed",
+                     (name != NULL) ? name : "?");
+      emit(port, ctx, line);
+      continue;
+    }
+
+    bool clean = true;
+    uint32_t score = 0;
+    for (uint32_t cond = 0; cond < 4u; cond++)
+    {
+      bool ltdc = (cond & 1u) != 0u;
+      bool dma2d = (cond & 2u) != 0u;
+      if (cond != 0u &&
+          (port->load_set == NULL || !port->load_set(ctx, ltdc, dma2d)))
+      {
+        continue;
+      }
+
+      ser_sdram_bench_result_t r;
+      ser_sdram_bench_measure(port, ctx, base, bytes, &r);
+      (void)ser_sdram_bench_format(line, sizeof(line), name, ltdc, dma2d, &r);
+      emit(port, ctx, line);
+
+      if (r.errors != 0u)
+      {
+        clean = false;
+      }
+      /* 条件按负载递增，留下的是实际跑到的最重负载下的成绩 */
+      score = r.seq_read_kbps + r.seq_write_kbps;
+    }
+
+    if (port->load_set != NULL)
+    {
+      (void)port->load_set(ctx, false, false);
+    }
+
+    bool in_spec = (port->profile_in_spec == NULL) ||
+                   port->profile_in_spec(ctx, pi);
+    if (clean && in_spec && score > best_score)
+    {
+      best_score = score;
+      best = (int32_t)pi;
+    }
+  }
+
+  if (best >= 0)
+  {
+    const char *name = (port->profile_name != NULL && port->profile_count != 0u)
+                           ? port->profile_name(ctx, (uint32_t)best)
+                           : "current";
+    (void)snprintf(line, sizeof(line), "sdram,best,%s", name);
+  }
+  else
+  {
+    (void)snprintf(line, sizeof(line), "sdram,best,none");
+  }
+  emit(port, ctx, line);
+  return best;
+}
+
+/* ==========================
+ * MCU：板上 port
+ * ========================== */
+#if !defined(SER_SDRAM_BENCH_HOST) || !SER_SDRAM_BENCH_HOST
+
+static uint32_t board_now(void *ctx)
+{
+  (void)ctx;
+  return dri_time_cycles_now();
+}
+
+static const char *board_profile_name(void *ctx, uint32_t idx)
+{
+  (void)ctx;
+  return dev_sdram_profile_name(idx);
+}
+
+static bool board_profile_in_spec(void *ctx, uint32_t idx)
+{
+  (void)ctx;
+  return dev_sdram_profile_in_spec(idx);
+}
+
+static bool board_profile_apply(void *ctx, uint32_t idx)
+{
+  (void)ctx;
+  return dev_sdram_apply_profile(idx) == HAL_OK;
+}
+
+static bool board_load_set(void *ctx, bool ltdc, bool dma2d)
+{
+  (void)ctx;
+  dev_lcd_dma2d_load_stop();
+  dev_lcd_scanout_enable(ltdc);
+  if (dma2d && !dev_lcd_dma2d_load_start((void *)SER_SDRAM_BENCH_LOAD_ADDR))
+  {
+    return false;
+  }
+  return true;
+}
+
+static void board_emit(void *ctx, const char *line)
+{
+  (void)ctx;
+  (void)dev_console_write(line, (uint32_t)strlen(line));
+  (void)dev_console_write("\r\n", 2u);
+}
+
+void ser_sdram_bench_run_board(void)
+{
+  (void)dev_console_init();
+
+  const ser_sdram_bench_port_t port = {
+      .now = board_now,
+      .hz = dri_time_hz(),
+      .profile_count = dev_sdram_profile_count(),
+      .profile_name = board_profile_name,
+      .profile_in_spec = board_profile_in_spec,
+      .profile_apply = board_profile_apply,
+      .load_set = board_load_set,
+      .emit = board_emit,
+  };
+
+  dev_lcd_scanout_enable(false);
+  int32_t best = ser_sdram_bench_run(&port, NULL, (void *)SER_SDRAM_BENCH_ADDR,
+                                     SER_SDRAM_BENCH_BYTES);
+
+  dev_lcd_dma2d_load_stop();
+#if SER_SDRAM_BENCH_APPLY_BEST
+  if (best < 0 || dev_sdram_apply_profile((uint32_t)best) != HAL_OK)
+  {
+    (void)dev_sdram_init();
+  }
+#else
+  (void)best;
+  (void)dev_sdram_init();
+#endif
+  dev_lcd_scanout_enable(true);
+}
+
+#endif
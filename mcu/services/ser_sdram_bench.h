@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：SDRAM 带宽/延迟基准
+ *
+ * 测试项（在同一块测试区上依次执行）：
+ *   seq_rd   32-bit 顺序读（8 路展开累加）           -> MB/s
+ *   seq_wr   32-bit 顺序写                           -> MB/s
+ *   copy     前半区 memcpy 到后半区（读+写各计一次）  -> MB/s
+ *   rand_rd  指针追逐：32 字节步长的随机单环，每次读依赖上一次结果 -> ns/次
+ *   rand_wr  随机槽位单字写（含约 5 周期随机数开销）  -> ns/次
+ *   errors   地址相关图样 + 反码两遍写读校验的错误字数
+ *
+ * 矩阵：FMC 配置档 x {LTDC 关/开} x {DMA2D 关/开}，每个组合输出一行：
+ *   # sdram,profile,ltdc,dma2d,seq_rd_MBps,seq_wr_MBps,copy_MBps,rand_rd_ns,rand_wr_ns,errors
+ *   sdram,default,0,0,95.3,120.4,61.2,121,45,0
+ *   ...
+ *   sdram,best,cas2
+ * best 为：全部组合校验无错、in_spec 且在最重负载下 seq_rd+seq_wr 最高的配置档
+ *
+ * 可移植性：
+ * - 测量与报告只通过 ser_sdram_bench_port_t 访问计时/配置档/负载/输出，
+ *   主机构建（SER_SDRAM_BENCH_HOST=1）可对 malloc 的普通内存跑同一套测量与报告
+ * - MCU 上 ser_sdram_bench_run_board() 用 dev_sdram/dev_lcd/dev_console 实现 port
+ *
+ * 启用：编译定义 SER_SDRAM_BENCH_ENABLE=1（CMake 选项同名），
+ * app_init 在 LCD 初始化后跑一遍并输出到调试串口，耗时数秒，期间屏幕不刷新
+ */
+
+/* 测试区与 DMA2D 负载区（避开帧缓冲 / LVGL heap / 浮层，见 dev_lcd.c 的 SDRAM 布局） */
+#ifndef SER_SDRAM_BENCH_ADDR
+#define SER_SDRAM_BENCH_ADDR 0xD0400000u
+#endif
+#ifndef SER_SDRAM_BENCH_BYTES
+#define SER_SDRAM_BENCH_BYTES (1024u * 1024u)
+#endif
+#ifndef SER_SDRAM_BENCH_LOAD_ADDR
+#define SER_SDRAM_BENCH_LOAD_ADDR 0xD0600000u
+#endif
+
+/* 跑完后是否直接切到 best 档（默认只报告，由人改 DRI_SDRAM_PROFILE_DEFAULT） */
+#ifndef SER_SDRAM_BENCH_APPLY_BEST
+#define SER_SDRAM_BENCH_APPLY_BEST 0
+#endif
+
+/* 报告单行最大长度 */
+#define SER_SDRAM_BENCH_LINE_MAX 128u
+
+typedef struct
+{
+  uint32_t seq_read_kbps; /* 1000 字节/秒 */
+  uint32_t seq_write_kbps;
+  uint32_t copy_kbps;
+  uint32_t rand_read_ns;
+  uint32_t rand_write_ns;
+  uint32_t errors;
+} ser_sdram_bench_result_t;
+
+/*
+ * 平台抽象：
+ * - now / hz：周期计数与频率（MCU 为 DWT，主机为纳秒时钟）
+ * - profile_*：配置档数量/名称/是否在规格内/切换；profile_count 为 0 时只测当前配置
+ * - load_set：打开/关闭 LTDC 扫描与 DMA2D 负载，为 NULL 或返回 false 时跳过该组合
+ * - emit：输出一行报告（不含换行）
+ */
+typedef struct
+{
+  uint32_t (*now)(void *ctx);
+  uint32_t hz;
+  uint32_t profile_count;
+  const char *(*profile_name)(void *ctx, uint32_t idx);
+  bool (*profile_in_spec)(void *ctx, uint32_t idx);
+  bool (*profile_apply)(void *ctx, uint32_t idx);
+  bool (*load_set)(void *ctx, bool ltdc, bool dma2d);
+  void (*emit)(void *ctx, const char *line);
+} ser_sdram_bench_port_t;
+
+/* 在 [base, base+bytes) 上跑一遍全部测试（bytes 至少 4KB，内容被覆盖） */
+void ser_sdram_bench_measure(const ser_sdram_bench_port_t *port, void *ctx,
+                             void *base, uint32_t bytes,
+                             ser_sdram_bench_result_t *out);
+
+/* 报告格式：返回写入长度（不含 '\0'），cap 不足时截断 */
+int ser_sdram_bench_format_header(char *buf, uint32_t cap);
+int ser_sdram_bench_format(char *buf, uint32_t cap, const char *profile,
+                           bool ltdc, bool dma2d,
+                           const ser_sdram_bench_result_t *r);
+
+/* 跑完整矩阵并输出报告，返回 best 配置档编号（没有合格档时返回 -1） */
+int32_t ser_sdram_bench_run(const ser_sdram_bench_port_t *port, void *ctx,
+                            void *base, uint32_t bytes);
+
+#if !defined(SER_SDRAM_BENCH_HOST) || !SER_SDRAM_BENCH_HOST
+/* 板上完整流程：关 LTDC -> 矩阵 -> 恢复默认档（或 best）-> 开 LTDC；调度器启动前调用 */
+void ser_sdram_bench_run_board(void);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,56 @@
+#include "ser_splash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dev_lcd.h"
+#include "dev_lcd_panel.h"
+#include "ser_rle565.h"
+#include "ser_splash_gen.h"
+
+#if LCD_FB_FORMAT != LCD_FB_FMT_RGB565
+/* 非 RGB565 帧缓冲：逐行解码到行缓冲再经 dev_lcd 转换（ROW 操作码需要上一行） */
+#define SER_SPLASH_MAX_W 1024u
+static uint16_t s_rows[2][SER_SPLASH_MAX_W];
+#endif
+
+bool ser_splash_show(void)
+{
+  const uint32_t w = ser_splash_gen_w;
+  const uint32_t h = ser_splash_gen_h;
+  if (w != dev_lcd_width() || h != dev_lcd_height())
+  {
+    return false;
+  }
+
+#if LCD_FB_FORMAT == LCD_FB_FMT_RGB565
+  /* 原地解码：上一行就是帧缓冲里刚写好的那一行 */
+  uint16_t *fb = (uint16_t *)dev_lcd_framebuffer();
+  if (fb == NULL)
+  {
+    return false;
+  }
+  return ser_rle565_decode(ser_splash_gen_rle, ser_splash_gen_len, fb, w, h,
+                           w);
+#else
+  if (w > SER_SPLASH_MAX_W)
+  {
+    return false;
+  }
+
+  const uint8_t *src = ser_splash_gen_rle;
+  const uint8_t *end = ser_splash_gen_rle + ser_splash_gen_len;
+  const uint16_t *prev = NULL;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    uint16_t *row = s_rows[y & 1u];
+    if (!ser_rle565_decode_row(&src, end, row, prev, w))
+    {
+      return false;
+    }
+    dev_lcd_flush_rgb565(0, (int32_t)y, (int32_t)w - 1, (int32_t)y, row);
+    prev = row;
+  }
+  return true;
+#endif
+}
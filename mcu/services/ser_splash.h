@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：开机画面
+ *
+ * - 画面由 project/tools/splash_gen.py 在主机上用 LVGL 渲染启动界面（与固件同一份
+ *   lv_conf.h 和 ser_lvgl_ui_boot.c），ser_rle565 编码后作为 const 数组放 Flash
+ *   （ser_splash_gen.c，800x480 约 13KB）
+ * - 启动时直接解码到帧缓冲（RGB565 帧缓冲原地解码，其它格式逐行经 dev_lcd 转换），
+ *   LVGL 接手后的第一帧与之逐像素相同，不会闪
+ *
+ * 需要 dev_lcd_init 已完成；画面尺寸与 LCD 不一致或码流损坏时返回 false，
+ * 调用方自行回退（如纯色填充）
+ */
+bool ser_splash_show(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
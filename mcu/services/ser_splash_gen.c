@@ -0,0 +1,822 @@
+/* 由 project/tools/splash_gen.py 根据启动界面渲染生成，请勿手工修改 */
+
+#include "ser_splash_gen.h"
+
+const uint16_t ser_splash_gen_w = 800u;
+const uint16_t ser_splash_gen_h = 480u;
+const uint32_t ser_splash_gen_len = 12986u;
+
+const uint8_t ser_splash_gen_rle[12986] = {
+    0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F,
+    0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84,
+    0x08, 0x7F, 0x84, 0x08, 0x5F, 0x84, 0x08, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xA0, 0x7F, 0x63, 0x00, 0x7F, 0x63, 0x00, 0x7F, 0x63, 0x00, 0x7F, 0x63, 0x00, 0x7F,
+    0x63, 0x00, 0x7F, 0x63, 0x00, 0x7F, 0x63, 0x00, 0x5D, 0x63, 0x00, 0xBF, 0xBF, 0xA0, 0xBF, 0xBF,
+    0x9B, 0x7F, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA2, 0x44, 0x63, 0x00, 0xBF, 0xBF,
+    0x9B, 0xBF, 0xBF, 0x97, 0x7F, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0x43, 0x63,
+    0x00, 0xBF, 0xBF, 0x97, 0xBF, 0xBF, 0x95, 0x7F, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xB1, 0x01, 0x63, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x95, 0xBF, 0xBF, 0x93, 0x7F, 0x63, 0x00, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x01, 0x63, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x93, 0xBF, 0xBF,
+    0x92, 0x7F, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0x00, 0x63, 0x00, 0xBF, 0xBF,
+    0x92, 0xBF, 0xBF, 0x90, 0x7F, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB, 0x01, 0x63,
+    0x00, 0x63, 0x00, 0xBF, 0xBF, 0x90, 0xBF, 0xBF, 0x8F, 0x4B, 0x63, 0x00, 0x03, 0xC6, 0x08, 0x28,
+    0x19, 0x8A, 0x21, 0x8A, 0x21, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC,
+    0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x5F, 0xCC, 0x29, 0x03, 0x8A, 0x21,
+    0x8A, 0x21, 0x28, 0x19, 0xC6, 0x08, 0x8A, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x8F, 0xBF, 0xBF, 0x8E,
+    0x49, 0x63, 0x00, 0x06, 0xC6, 0x08, 0x69, 0x19, 0xAB, 0x21, 0x8A, 0x21, 0x69, 0x19, 0x28, 0x11,
+    0x27, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07,
+    0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x5F, 0x07, 0x11, 0x06, 0x27, 0x11, 0x28, 0x11, 0x69,
+    0x19, 0x8A, 0x21, 0xAB, 0x21, 0x69, 0x19, 0xC6, 0x08, 0x88, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x8E,
+    0xBF, 0xBF, 0x8D, 0x48, 0x63, 0x00, 0x03, 0xC6, 0x08, 0x8A, 0x21, 0xAB, 0x21, 0x49, 0x19, 0x7F,
+    0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA4, 0x44, 0x07, 0x11, 0x03, 0x49, 0x19, 0xAB,
+    0x21, 0x8A, 0x21, 0xC6, 0x08, 0x87, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x8D, 0xBF, 0xBF, 0x8C, 0x48,
+    0x63, 0x00, 0x02, 0x69, 0x19, 0xAB, 0x21, 0x48, 0x19, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAB, 0x04, 0x07, 0x11, 0x07, 0x11, 0x48, 0x19, 0xAB, 0x21, 0x69, 0x19, 0x87, 0x00,
+    0x63, 0x00, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x8B, 0x47, 0x63, 0x00, 0x01, 0xC6, 0x08, 0xAB, 0x21,
+    0x80, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x01, 0x07, 0x11, 0x07, 0x11,
+    0x80, 0x01, 0xAB, 0x21, 0xC6, 0x08, 0x86, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF, 0x8A,
+    0x47, 0x63, 0x00, 0x02, 0xE7, 0x08, 0xAB, 0x21, 0x27, 0x11, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xB2, 0x03, 0x07, 0x11, 0x27, 0x11, 0xAB, 0x21, 0xE7, 0x08, 0x86, 0x00, 0x63,
+    0x00, 0xBF, 0xBF, 0x8A, 0xBF, 0xBF, 0x91, 0x01, 0x48, 0x19, 0xCC, 0x29, 0x7F, 0x07, 0x11, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x03, 0x07, 0x11, 0x07, 0x11, 0xCC, 0x29, 0x48, 0x19, 0xBF,
+    0xBF, 0x91, 0xBF, 0xBF, 0x89, 0x46, 0x63, 0x00, 0x01, 0xE7, 0x08, 0xCC, 0x29, 0x7F, 0x07, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0x02, 0x07, 0x11, 0xCC, 0x29, 0xE7, 0x08, 0x85, 0x00,
+    0x63, 0x00, 0xBF, 0xBF, 0x89, 0xBF, 0xBF, 0x88, 0x46, 0x63, 0x00, 0x01, 0xC6, 0x08, 0xAB, 0x21,
+    0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0x02, 0x07, 0x11, 0xAB, 0x21, 0xC6,
+    0x08, 0x85, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x88, 0xBF, 0xBF, 0x8F, 0x01, 0xAB, 0x21, 0x27, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB, 0x01, 0x27, 0x11, 0xAB, 0x21, 0xBF, 0xBF, 0x8F,
+    0xBF, 0xBF, 0x87, 0x46, 0x63, 0x00, 0x01, 0x69, 0x19, 0x69, 0x19, 0x7F, 0x07, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBC, 0x02, 0x07, 0x11, 0x69, 0x19, 0x69, 0x19, 0x85, 0x00, 0x63, 0x00,
+    0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0x8D, 0x01, 0xC6, 0x08, 0xAB, 0x21, 0x7F, 0x07, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBE, 0x02, 0x07, 0x11, 0xAB, 0x21, 0xC6, 0x08, 0xBF, 0xBF, 0x8D, 0xBF,
+    0xBF, 0x8D, 0x01, 0x8A, 0x21, 0x48, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x01,
+    0x48, 0x19, 0x8A, 0x21, 0xBF, 0xBF, 0x8D, 0xBF, 0xBF, 0x86, 0x45, 0x63, 0x00, 0x01, 0xC6, 0x08,
+    0xAB, 0x21, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x80, 0x02, 0x07, 0x11,
+    0xAB, 0x21, 0xC6, 0x08, 0x84, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0x8C, 0x01, 0x69,
+    0x19, 0x49, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x81, 0x01, 0x49, 0x19, 0x69,
+    0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x8C, 0x00, 0xAB, 0x21, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x82, 0x01, 0x07, 0x11, 0xAB, 0x21, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x85,
+    0x45, 0x63, 0x00, 0x01, 0xC6, 0x08, 0x8A, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x83, 0x01, 0x8A, 0x21, 0xC6, 0x08, 0x84, 0x00, 0x63, 0x00, 0xBF, 0xBF, 0x85, 0xBF, 0xBF, 0x8B,
+    0x01, 0x28, 0x19, 0x69, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x01, 0x69,
+    0x19, 0x28, 0x19, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF, 0x8B, 0x01, 0x8A, 0x21, 0x28, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x01, 0x28, 0x11, 0x8A, 0x21, 0xBF, 0xBF, 0x8B, 0xBF,
+    0xBF, 0x8C, 0x00, 0x27, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x00, 0x27,
+    0x11, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x8B, 0x00, 0xCC, 0x29, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x84, 0x01, 0x07, 0x11, 0xCC, 0x29, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF, 0x84,
+    0x46, 0x63, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0x80, 0x45, 0x28, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0x86,
+    0x00, 0x63, 0x00, 0xBF, 0xBF, 0x84, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x51, 0x28, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x44, 0x28,
+    0x11, 0x4D, 0x49, 0x11, 0x81, 0x42, 0x28, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x81, 0x43, 0x28, 0x11, 0x43, 0x49, 0x11, 0x4B, 0x4A, 0x11, 0x80,
+    0x42, 0x49, 0x11, 0x81, 0x01, 0x28, 0x11, 0x28, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x81,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x42, 0x28, 0x11, 0x42, 0x49, 0x11, 0x08, 0x4A, 0x11, 0x4A,
+    0x11, 0x6B, 0x11, 0x70, 0x22, 0x14, 0x2B, 0xD8, 0x33, 0x19, 0x3C, 0xFD, 0x4C, 0x3F, 0x55, 0x42,
+    0x5F, 0x55, 0x07, 0x1D, 0x4D, 0x59, 0x3C, 0x18, 0x3C, 0x54, 0x2B, 0x90, 0x22, 0x8B, 0x11, 0x4A,
+    0x11, 0x4A, 0x11, 0x42, 0x49, 0x11, 0x80, 0x01, 0x28, 0x11, 0x28, 0x11, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0x42, 0x28, 0x11, 0x08, 0x49, 0x11, 0x49, 0x11,
+    0x4A, 0x11, 0x4A, 0x11, 0xED, 0x19, 0x55, 0x2B, 0x3B, 0x3C, 0xFF, 0x4C, 0xFF, 0x4C, 0x42, 0x1F,
+    0x4D, 0x00, 0x3F, 0x55, 0x83, 0x42, 0x7F, 0x55, 0x42, 0x9F, 0x55, 0x06, 0xDB, 0x44, 0xD5, 0x3B,
+    0x0D, 0x1A, 0x4A, 0x11, 0x4A, 0x11, 0x49, 0x11, 0x49, 0x11, 0x80, 0x01, 0x28, 0x11, 0x28, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB, 0x42, 0x28, 0x11, 0x07,
+    0x49, 0x11, 0x49, 0x11, 0x4A, 0x11, 0x6B, 0x11, 0x91, 0x22, 0x1B, 0x3C, 0xDF, 0x4C, 0xDF, 0x4C,
+    0x42, 0xFF, 0x4C, 0x8D, 0x08, 0xBF, 0x55, 0xBF, 0x5D, 0xDF, 0x5D, 0xFB, 0x4C, 0xF1, 0x2A, 0x8B,
+    0x11, 0x4A, 0x11, 0x49, 0x11, 0x49, 0x11, 0x80, 0x01, 0x28, 0x11, 0x28, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBB, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0x00, 0x28, 0x11, 0x80, 0x07, 0x49, 0x11,
+    0x49, 0x11, 0x4A, 0x11, 0x6B, 0x11, 0xD4, 0x2A, 0x7D, 0x44, 0xBF, 0x4C, 0xBF, 0x4C, 0x95, 0x07,
+    0xDF, 0x5D, 0xDF, 0x5D, 0x9D, 0x55, 0x94, 0x33, 0x8B, 0x11, 0x4A, 0x11, 0x49, 0x11, 0x49, 0x11,
+    0x80, 0x00, 0x28, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0xBF, 0xBF, 0x8C, 0x7F, 0x08, 0x11,
+    0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x6C, 0x08, 0x11, 0x01, 0x29, 0x11, 0x29, 0x11, 0x42, 0x4A,
+    0x11, 0x02, 0x50, 0x1A, 0x1C, 0x3C, 0x9F, 0x4C, 0x42, 0xBF, 0x4C, 0x97, 0x03, 0xFF, 0x5D, 0xFF,
+    0x5D, 0x5C, 0x4D, 0xB0, 0x22, 0x42, 0x4A, 0x11, 0x01, 0x29, 0x11, 0x29, 0x11, 0x7F, 0x08, 0x11,
+    0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x6C, 0x08, 0x11, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xB7, 0x42, 0x29, 0x11, 0x00, 0x4A, 0x11, 0x80, 0x03, 0x6B, 0x11, 0x99, 0x33, 0x9F, 0x44,
+    0x9F, 0x44, 0x9D, 0x03, 0xFF, 0x5D, 0x1F, 0x5E, 0xD9, 0x44, 0x8B, 0x11, 0x80, 0x00, 0x4A, 0x11,
+    0x80, 0x01, 0x29, 0x11, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB7, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xB6, 0x00, 0x29, 0x11, 0x80, 0x42, 0x4A, 0x11, 0x02, 0x0F, 0x1A, 0x3D, 0x3C, 0x7F, 0x44,
+    0xA1, 0x02, 0x1F, 0x5E, 0xBD, 0x55, 0x6F, 0x22, 0x80, 0x01, 0x4A, 0x11, 0x4A, 0x11, 0x80, 0x00,
+    0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB6, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x00, 0x29,
+    0x11, 0x80, 0x42, 0x4A, 0x11, 0x00, 0x93, 0x22, 0x42, 0x7F, 0x44, 0xA2, 0x02, 0x1F, 0x5E, 0x3F,
+    0x5E, 0x73, 0x2B, 0x81, 0x00, 0x4A, 0x11, 0x80, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xB5, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB4, 0x00, 0x29, 0x11, 0x80, 0x42, 0x4A, 0x11, 0x01, 0x37,
+    0x2B, 0x5F, 0x44, 0xA7, 0x01, 0x3F, 0x5E, 0x77, 0x44, 0x81, 0x00, 0x4A, 0x11, 0x80, 0x00, 0x29,
+    0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB4, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x42, 0x4A, 0x11,
+    0x01, 0x17, 0x2B, 0x5F, 0x44, 0xA9, 0x01, 0x5F, 0x66, 0x77, 0x44, 0x81, 0x00, 0x4A, 0x11, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB3, 0x00, 0x29, 0x11, 0x82, 0x01,
+    0x17, 0x2B, 0x3F, 0x44, 0xAB, 0x01, 0x5F, 0x66, 0x77, 0x44, 0x82, 0x00, 0x29, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xB3, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0x00, 0x29, 0x11, 0x80, 0x00, 0x4A,
+    0x11, 0x80, 0x01, 0x93, 0x22, 0x3F, 0x44, 0xAD, 0x01, 0x5F, 0x66, 0x73, 0x33, 0x80, 0x00, 0x4A,
+    0x11, 0x80, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xB1, 0x00, 0x29, 0x11, 0x80, 0x00, 0x4A, 0x11, 0x80, 0x00, 0xEF, 0x19, 0x42, 0x3F, 0x44, 0xAD,
+    0x01, 0x7F, 0x66, 0x8F, 0x22, 0x80, 0x00, 0x4A, 0x11, 0x80, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xB1, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0x00, 0x4A, 0x11, 0x80, 0x01, 0x6B, 0x11,
+    0xDD, 0x3B, 0xB1, 0x01, 0x1D, 0x5E, 0x8B, 0x11, 0x80, 0x00, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xB2, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x00, 0x29, 0x11, 0x82, 0x01, 0x59, 0x33, 0x1F,
+    0x44, 0xB1, 0x01, 0x7F, 0x66, 0x19, 0x4D, 0x82, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xB0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x00, 0x4A, 0x11, 0x80, 0x01, 0x10, 0x1A, 0x1F, 0x44,
+    0xB3, 0x01, 0x7F, 0x66, 0xF0, 0x2A, 0x80, 0x00, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x29, 0x11, 0x81, 0x01, 0x6B, 0x11, 0xBC, 0x33, 0xB5,
+    0x01, 0xDC, 0x55, 0x8B, 0x11, 0x81, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x00, 0x4A, 0x11, 0x80, 0x01, 0x94, 0x22, 0x1F, 0x3C, 0xB5, 0x01,
+    0x9F, 0x66, 0xD4, 0x33, 0x80, 0x00, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xAE, 0x00, 0x29, 0x11, 0x81, 0x01, 0x6B, 0x11, 0xBD, 0x33, 0xB7, 0x01, 0x3D,
+    0x5E, 0x8B, 0x11, 0x81, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAF, 0x00, 0x4A, 0x11, 0x80, 0x01, 0x31, 0x1A, 0xFF, 0x3B, 0xB7, 0x01, 0x9F, 0x66,
+    0x31, 0x2B, 0x80, 0x00, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAD, 0x00, 0x29, 0x11, 0x82, 0x00, 0x7B, 0x33, 0xB9, 0x00, 0x9B, 0x55, 0x82, 0x00, 0x29,
+    0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x01, 0xAD, 0x11,
+    0xFF, 0x3B, 0xB9, 0x01, 0x9F, 0x66, 0x4D, 0x1A, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xAE, 0x00, 0x4A, 0x11, 0x80, 0x00, 0xB5, 0x22, 0xBB, 0x00, 0x55, 0x3C, 0x80,
+    0x00, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x00,
+    0x29, 0x11, 0x82, 0x00, 0x7B, 0x33, 0xBB, 0x00, 0xBB, 0x55, 0x82, 0x00, 0x29, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xAC, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x6B, 0x11, 0x42, 0xFF, 0x3B,
+    0xB9, 0x01, 0xBF, 0x66, 0x8B, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAD, 0x00, 0x4A, 0x11, 0x80, 0x00, 0x10, 0x1A, 0xBD, 0x00, 0xF0, 0x2A, 0x80, 0x00, 0x4A,
+    0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x74, 0x22,
+    0xBD, 0x00, 0xF4, 0x33, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF,
+    0x00, 0x18, 0x2B, 0xBD, 0x00, 0xF8, 0x44, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAF, 0x00, 0x39, 0x2B, 0xBD, 0x00, 0x59, 0x4D, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0x00, 0x29, 0x11, 0x82, 0x00, 0x9D, 0x33, 0xBD, 0x00, 0x5D,
+    0x5E, 0x82, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xAF, 0x00, 0xDF, 0x3B, 0xBD, 0x00, 0xBF, 0x66, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x9D, 0x33, 0xBD, 0x00,
+    0x5D, 0x5E, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0x00, 0x08,
+    0x11, 0x82, 0x00, 0x39, 0x2B, 0xBD, 0x00, 0x59, 0x4D, 0x82, 0x7F, 0x08, 0x11, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAC, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x18, 0x2B, 0xBD, 0x00, 0xF8, 0x44, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x74, 0x22, 0xBD, 0x00,
+    0xF4, 0x33, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x10,
+    0x1A, 0xBD, 0x00, 0xF0, 0x2A, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xAD, 0x00, 0x29, 0x11, 0x80, 0x00, 0x6B, 0x11, 0xBD, 0x00, 0x8B, 0x11, 0x80, 0x00, 0x29, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x01, 0x4A, 0x11, 0x7B,
+    0x33, 0xBB, 0x01, 0xBB, 0x55, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAC, 0x00, 0x08, 0x11, 0x82, 0x00, 0xB5, 0x22, 0xBB, 0x00, 0x55, 0x3C, 0x82, 0x7F,
+    0x08, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x00, 0x29, 0x11,
+    0x80, 0x00, 0xAD, 0x11, 0xBB, 0x00, 0x4D, 0x1A, 0x80, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x01, 0x4A, 0x11, 0x7B, 0x33, 0xB9, 0x01, 0x9B,
+    0x55, 0x4A, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0x00,
+    0x08, 0x11, 0x82, 0x00, 0x31, 0x1A, 0xB9, 0x00, 0x31, 0x2B, 0x82, 0x7F, 0x08, 0x11, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0x8C, 0x7F, 0x08, 0x19, 0x7F, 0x08, 0x19, 0x7F, 0x08, 0x19, 0x61,
+    0x08, 0x19, 0x04, 0x29, 0x19, 0x29, 0x19, 0x4A, 0x19, 0x6B, 0x19, 0xBD, 0x33, 0xB7, 0x04, 0x3D,
+    0x5E, 0x8B, 0x19, 0x4A, 0x19, 0x29, 0x19, 0x29, 0x19, 0x7F, 0x08, 0x19, 0x7F, 0x08, 0x19, 0x7F,
+    0x08, 0x19, 0x61, 0x08, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x00, 0x08,
+    0x19, 0x81, 0x01, 0x4A, 0x19, 0x94, 0x22, 0xB7, 0x01, 0xD4, 0x3B, 0x4A, 0x19, 0x81, 0x7F, 0x08,
+    0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x00, 0x29, 0x19, 0x80,
+    0x01, 0x6B, 0x19, 0xBC, 0x33, 0xB5, 0x01, 0xDC, 0x55, 0x8B, 0x19, 0x80, 0x00, 0x29, 0x19, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0x00, 0x08, 0x19, 0x81, 0x01,
+    0x4A, 0x19, 0x10, 0x22, 0xB5, 0x01, 0xF0, 0x2A, 0x4A, 0x19, 0x81, 0x7F, 0x08, 0x19, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xB0, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x00, 0x29, 0x19, 0x80, 0x01, 0x4A, 0x19,
+    0x59, 0x33, 0xB3, 0x01, 0x19, 0x4D, 0x4A, 0x19, 0x80, 0x00, 0x29, 0x19, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xB1, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB0, 0x00, 0x08, 0x19, 0x82, 0x01, 0x6B, 0x19, 0xDD,
+    0x3B, 0xB1, 0x01, 0x1D, 0x5E, 0x8B, 0x19, 0x82, 0x7F, 0x08, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0x00, 0x29, 0x19, 0x80, 0x01, 0x4A, 0x19, 0xEF, 0x21, 0xB1,
+    0x01, 0x8F, 0x2A, 0x4A, 0x19, 0x80, 0x00, 0x29, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x00, 0x08, 0x19, 0x80, 0x00, 0x29, 0x19, 0x80, 0x01, 0x4A, 0x19,
+    0x93, 0x2A, 0xAF, 0x01, 0x73, 0x33, 0x4A, 0x19, 0x80, 0x00, 0x29, 0x19, 0x80, 0x7F, 0x08, 0x19,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB2, 0x00, 0x08, 0x19, 0x80, 0x00,
+    0x29, 0x19, 0x80, 0x01, 0x4A, 0x19, 0x17, 0x33, 0xAD, 0x01, 0x77, 0x44, 0x4A, 0x19, 0x80, 0x00,
+    0x29, 0x19, 0x80, 0x7F, 0x08, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB3, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xB3, 0x00, 0x08, 0x19, 0x82, 0x01, 0x4A, 0x19, 0x17, 0x33, 0xAB, 0x00, 0x77, 0x44, 0x42, 0x4A,
+    0x19, 0x80, 0x7F, 0x08, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB4, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5,
+    0x00, 0x29, 0x19, 0x81, 0x01, 0x4A, 0x19, 0x37, 0x33, 0xA9, 0x00, 0x77, 0x44, 0x42, 0x4A, 0x19,
+    0x00, 0x29, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB4, 0x00,
+    0x08, 0x19, 0x80, 0x00, 0x29, 0x19, 0x81, 0x01, 0x4A, 0x19, 0x93, 0x2A, 0xA7, 0x00, 0x73, 0x33,
+    0x42, 0x4A, 0x19, 0x00, 0x29, 0x19, 0x80, 0x7F, 0x08, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x00, 0x08, 0x19, 0x80, 0x00, 0x29, 0x19, 0x81, 0x02, 0x4A, 0x19,
+    0x0F, 0x22, 0x3D, 0x3C, 0xA3, 0x01, 0xBD, 0x55, 0x6F, 0x22, 0x42, 0x4A, 0x19, 0x00, 0x29, 0x19,
+    0x80, 0x7F, 0x08, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB6, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB6, 0x00,
+    0x08, 0x19, 0x80, 0x01, 0x29, 0x19, 0x29, 0x19, 0x80, 0x02, 0x4A, 0x19, 0x6B, 0x19, 0x99, 0x33,
+    0xA1, 0x02, 0xD9, 0x44, 0x8B, 0x19, 0x4A, 0x19, 0x80, 0x42, 0x29, 0x19, 0x7F, 0x08, 0x19, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xB7, 0xBF, 0xBF, 0x8C, 0x7F, 0x28, 0x19, 0x7F, 0x28, 0x19, 0x7F, 0x28, 0x19,
+    0x6C, 0x28, 0x19, 0x01, 0x49, 0x19, 0x49, 0x19, 0x80, 0x03, 0x4A, 0x19, 0x6A, 0x19, 0x50, 0x22,
+    0x1C, 0x3C, 0x9D, 0x03, 0x5C, 0x4D, 0xD0, 0x2A, 0x6A, 0x19, 0x4A, 0x19, 0x80, 0x01, 0x49, 0x19,
+    0x49, 0x19, 0x7F, 0x28, 0x19, 0x7F, 0x28, 0x19, 0x7F, 0x28, 0x19, 0x6C, 0x28, 0x19, 0xBF, 0xBF,
+    0x8C, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9, 0x00, 0x28, 0x19, 0x80, 0x00, 0x49, 0x19, 0x80, 0x04,
+    0x4A, 0x19, 0x6A, 0x19, 0x8B, 0x19, 0xF4, 0x2A, 0x7D, 0x44, 0x99, 0x04, 0x9D, 0x55, 0x94, 0x33,
+    0xAB, 0x19, 0x6A, 0x19, 0x4A, 0x19, 0x80, 0x00, 0x49, 0x19, 0x80, 0x7F, 0x28, 0x19, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0x00, 0x28, 0x19, 0x80, 0x07, 0x49, 0x19,
+    0x49, 0x19, 0x4A, 0x19, 0x4A, 0x19, 0x6A, 0x19, 0x8B, 0x19, 0x91, 0x2A, 0x1B, 0x3C, 0x95, 0x05,
+    0xFB, 0x4C, 0x11, 0x2B, 0xAB, 0x19, 0x6A, 0x19, 0x4A, 0x19, 0x4A, 0x19, 0x42, 0x49, 0x19, 0x7F,
+    0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB, 0x01, 0x28, 0x19,
+    0x28, 0x19, 0x80, 0x08, 0x49, 0x19, 0x49, 0x19, 0x4A, 0x19, 0x4A, 0x19, 0x6A, 0x19, 0x6A, 0x19,
+    0x0D, 0x22, 0x56, 0x33, 0x3B, 0x3C, 0x8F, 0x06, 0xDB, 0x44, 0xD6, 0x3B, 0x2D, 0x22, 0x6A, 0x19,
+    0x6A, 0x19, 0x4A, 0x19, 0x4A, 0x19, 0x42, 0x49, 0x19, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0x01, 0x28, 0x19, 0x28, 0x19, 0x80, 0x01, 0x49, 0x19,
+    0x49, 0x19, 0x42, 0x4A, 0x19, 0x07, 0x6A, 0x19, 0x6A, 0x19, 0x8B, 0x19, 0x70, 0x22, 0x34, 0x2B,
+    0xF8, 0x3B, 0x19, 0x3C, 0xFD, 0x4C, 0x83, 0x07, 0x3D, 0x4D, 0x79, 0x44, 0x38, 0x3C, 0x74, 0x33,
+    0xB0, 0x2A, 0xAB, 0x19, 0x6A, 0x19, 0x6A, 0x19, 0x42, 0x4A, 0x19, 0x42, 0x49, 0x19, 0x7F, 0x28,
+    0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x01, 0x28, 0x19, 0x28,
+    0x19, 0x80, 0x42, 0x49, 0x19, 0x43, 0x4A, 0x19, 0x4B, 0x6A, 0x19, 0x43, 0x4A, 0x19, 0x43, 0x49,
+    0x19, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x81, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x81, 0x01, 0x28, 0x19, 0x28, 0x19, 0x81, 0x42, 0x49, 0x19, 0x80, 0x4C, 0x4A, 0x19, 0x44, 0x49,
+    0x19, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08,
+    0x44, 0xA4, 0x08, 0x46, 0x83, 0x00, 0xBF, 0xBF, 0xBF, 0xB7, 0x42, 0x28, 0x19, 0x81, 0x4F, 0x49,
+    0x19, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBA, 0x46, 0x83, 0x00, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08,
+    0x44, 0xA4, 0x08, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x45, 0x28, 0x19, 0x85, 0x7F, 0x28,
+    0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x8C, 0x7F, 0x28,
+    0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x92, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0x7F,
+    0xA5, 0x08, 0x7F, 0xA5, 0x08, 0x44, 0xA5, 0x08, 0x46, 0x84, 0x00, 0xBF, 0xBF, 0xBF, 0xBB, 0x00,
+    0x89, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0x8A, 0x46, 0x84, 0x00, 0x7F, 0xA5, 0x08, 0x7F, 0xA5, 0x08,
+    0x44, 0xA5, 0x08, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x01, 0x6C, 0x42, 0x97, 0xAD, 0x81, 0x01,
+    0x1C, 0xDF, 0x89, 0x21, 0x81, 0x01, 0x9A, 0xCE, 0x89, 0x21, 0x86, 0x00, 0x89, 0x21, 0x84, 0x02,
+    0x6F, 0x63, 0x1C, 0xDF, 0xB4, 0x8C, 0x8B, 0x01, 0x1C, 0xDF, 0x0E, 0x53, 0x82, 0x01, 0xD1, 0x73,
+    0x97, 0xAD, 0x89, 0x4A, 0x89, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAC, 0x0A, 0xEA, 0x31, 0x1C, 0xDF, 0x1C, 0xDF, 0xFF, 0xFF, 0x1C, 0xDF, 0x1C, 0xDF, 0xFF,
+    0xFF, 0x1C, 0xDF, 0x1C, 0xDF, 0x89, 0x21, 0x7D, 0xEF, 0x47, 0x28, 0x19, 0x02, 0xB4, 0x8C, 0x9A,
+    0xCE, 0x6C, 0x42, 0x81, 0x08, 0x7D, 0xEF, 0x35, 0x9D, 0xEA, 0x31, 0x28, 0x19, 0xFF, 0xFF, 0x7D,
+    0xEF, 0x7D, 0xEF, 0xFF, 0xFF, 0x7D, 0xEF, 0x85, 0x00, 0x6F, 0x63, 0x44, 0x9A, 0xCE, 0x01, 0x7D,
+    0xEF, 0x7D, 0xEF, 0x43, 0x9A, 0xCE, 0x00, 0x0E, 0x53, 0x83, 0x00, 0xF8, 0xBD, 0x49, 0xFF, 0xFF,
+    0x00, 0x7D, 0xEF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x0A,
+    0x28, 0x19, 0x28, 0x19, 0x6C, 0x42, 0xB4, 0x8C, 0x28, 0x19, 0x28, 0x19, 0xF8, 0xBD, 0x89, 0x21,
+    0x28, 0x19, 0x6C, 0x42, 0x1C, 0xDF, 0x43, 0xD1, 0x73, 0x83, 0x04, 0x28, 0x19, 0x0E, 0x53, 0x7D,
+    0xEF, 0x6F, 0x63, 0x89, 0x21, 0x80, 0x42, 0x28, 0x19, 0x80, 0x02, 0x28, 0x19, 0x28, 0x19, 0x89,
+    0x21, 0x86, 0x01, 0x7D, 0xEF, 0x0E, 0x53, 0x43, 0xEA, 0x31, 0x01, 0xB4, 0x8C, 0xF8, 0xBD, 0x43,
+    0xEA, 0x31, 0x44, 0x28, 0x19, 0x80, 0x00, 0x0E, 0x53, 0x42, 0x28, 0x19, 0x01, 0x7D, 0xEF, 0xEA,
+    0x31, 0x42, 0x28, 0x19, 0x00, 0x89, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAD, 0x04, 0x97, 0xAD, 0xF8, 0xBD, 0x9A, 0xCE, 0xD1, 0x73, 0x97, 0xAD, 0x80, 0x03,
+    0x9A, 0xCE, 0xD1, 0x73, 0x52, 0x84, 0x97, 0xAD, 0x82, 0x00, 0xFF, 0xFF, 0x84, 0x00, 0x28, 0x19,
+    0x42, 0x89, 0x21, 0x8D, 0x00, 0xB4, 0x8C, 0x80, 0x44, 0x28, 0x19, 0x01, 0xD1, 0x73, 0x97, 0xAD,
+    0x48, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x01,
+    0x89, 0x21, 0x6F, 0x63, 0x81, 0x08, 0x89, 0x21, 0x6F, 0x63, 0x52, 0x84, 0x1C, 0xDF, 0x89, 0x21,
+    0xB4, 0x8C, 0x89, 0x21, 0xEA, 0x31, 0xF8, 0xBD, 0x85, 0x01, 0x28, 0x19, 0x28, 0x19, 0x8D, 0x01,
+    0x0E, 0x53, 0xFF, 0xFF, 0x81, 0x00, 0xD1, 0x73, 0x42, 0x7D, 0xEF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x42, 0x7D, 0xEF, 0x00, 0x9A, 0xCE, 0x85, 0x00, 0x1C, 0xDF, 0x42, 0x9A, 0xCE, 0x00, 0xFF, 0xFF,
+    0x44, 0x9A, 0xCE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0x0A,
+    0x52, 0x84, 0xF8, 0xBD, 0xF8, 0xBD, 0x0E, 0x53, 0x52, 0x84, 0x97, 0xAD, 0x97, 0xAD, 0x35, 0x9D,
+    0xF8, 0xBD, 0x28, 0x19, 0x9A, 0xCE, 0x80, 0x01, 0x52, 0x84, 0xD1, 0x73, 0x82, 0x03, 0x6C, 0x42,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x8D, 0x02, 0x6C, 0x42, 0xFF, 0xFF, 0xD1, 0x73, 0x82, 0x07,
+    0xB4, 0x8C, 0x28, 0x19, 0x28, 0x19, 0xD1, 0x73, 0x97, 0xAD, 0x28, 0x19, 0x28, 0x19, 0x6C, 0x42,
+    0x86, 0x00, 0x52, 0x84, 0x42, 0x0E, 0x53, 0x01, 0x7D, 0xEF, 0xD1, 0x73, 0x42, 0x0E, 0x53, 0x00,
+    0x6F, 0x63, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0x04, 0x28,
+    0x19, 0xB4, 0x8C, 0xD1, 0x73, 0x89, 0x21, 0x9A, 0xCE, 0x42, 0x28, 0x19, 0x00, 0x89, 0x21, 0x80,
+    0x00, 0x1C, 0xDF, 0x80, 0x01, 0x0E, 0x53, 0x89, 0x21, 0x82, 0x03, 0x28, 0x19, 0x28, 0x19, 0xEA,
+    0x31, 0xFF, 0xFF, 0x8D, 0x02, 0xEA, 0x31, 0x6F, 0x63, 0x89, 0x21, 0x91, 0x00, 0x0E, 0x53, 0x42,
+    0x28, 0x19, 0x80, 0x00, 0xEA, 0x31, 0x42, 0x28, 0x19, 0x00, 0x89, 0x21, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0x08, 0x89, 0x21, 0xFF, 0xFF, 0x9A, 0xCE, 0x9A,
+    0xCE, 0xFF, 0xFF, 0x1C, 0xDF, 0x9A, 0xCE, 0x52, 0x84, 0x28, 0x19, 0x80, 0x01, 0x7D, 0xEF, 0x6C,
+    0x42, 0x46, 0x28, 0x19, 0x00, 0x89, 0x21, 0x85, 0x00, 0x89, 0x21, 0x87, 0x01, 0x28, 0x19, 0x28,
+    0x19, 0x83, 0x07, 0x7D, 0xEF, 0xF8, 0xBD, 0xF8, 0xBD, 0x1C, 0xDF, 0x7D, 0xEF, 0xF8, 0xBD, 0xF8,
+    0xBD, 0x9A, 0xCE, 0x85, 0x00, 0x1C, 0xDF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAD, 0x05, 0x9A, 0xCE, 0x7D, 0xEF, 0x28, 0x19, 0x28, 0x19, 0x1C, 0xDF, 0x89, 0x21,
+    0x42, 0x28, 0x19, 0x02, 0x89, 0x21, 0xFF, 0xFF, 0x52, 0x84, 0x89, 0x04, 0xEA, 0x31, 0xFF, 0xFF,
+    0x52, 0x84, 0x9A, 0xCE, 0xF8, 0xBD, 0x8C, 0x05, 0xEA, 0x31, 0x52, 0x84, 0x6C, 0x42, 0x6C, 0x42,
+    0x97, 0xAD, 0x35, 0x9D, 0x42, 0x6C, 0x42, 0x00, 0xEA, 0x31, 0x84, 0x01, 0x7D, 0xEF, 0xFF, 0xFF,
+    0x42, 0x7D, 0xEF, 0x00, 0xFF, 0xFF, 0x45, 0x7D, 0xEF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x08, 0x6C, 0x42, 0x35, 0x9D, 0xFF, 0xFF, 0x9A, 0xCE, 0x9A, 0xCE,
+    0xFF, 0xFF, 0x9A, 0xCE, 0x9A, 0xCE, 0x6C, 0x42, 0x80, 0x02, 0x0E, 0x53, 0x1C, 0xDF, 0x9A, 0xCE,
+    0x89, 0x04, 0x97, 0xAD, 0x7D, 0xEF, 0xB4, 0x8C, 0x6C, 0x42, 0x28, 0x19, 0x81, 0x02, 0xF8, 0xBD,
+    0x1C, 0xDF, 0x9A, 0xCE, 0x87, 0x01, 0x89, 0x21, 0x1C, 0xDF, 0x80, 0x02, 0x28, 0x19, 0x9A, 0xCE,
+    0x0E, 0x53, 0x48, 0x28, 0x19, 0x01, 0xFF, 0xFF, 0xEA, 0x31, 0x42, 0x89, 0x21, 0x01, 0x7D, 0xEF,
+    0x6C, 0x42, 0x42, 0x89, 0x21, 0x00, 0x6C, 0x42, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xAC, 0x08, 0x28, 0x19, 0x28, 0x19, 0x7D, 0xEF, 0x6F, 0x63, 0x6F, 0x63, 0x7D,
+    0xEF, 0x6F, 0x63, 0x6F, 0x63, 0xEA, 0x31, 0x80, 0x01, 0x97, 0xAD, 0x6F, 0x63, 0x80, 0x00, 0xEA,
+    0x31, 0x88, 0x00, 0xEA, 0x31, 0x43, 0x28, 0x19, 0x81, 0x01, 0x89, 0x21, 0x89, 0x21, 0x45, 0x28,
+    0x19, 0x82, 0x04, 0x28, 0x19, 0xEA, 0x31, 0x1C, 0xDF, 0x35, 0x9D, 0x1C, 0xDF, 0x48, 0x28, 0x19,
+    0x01, 0xEA, 0x31, 0x1C, 0xDF, 0x43, 0x28, 0x19, 0x80, 0x00, 0xEA, 0x31, 0x42, 0x28, 0x19, 0x00,
+    0x89, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0x04, 0xEA,
+    0x31, 0x7D, 0xEF, 0x28, 0x19, 0x6F, 0x63, 0xF8, 0xBD, 0x85, 0x00, 0xD1, 0x73, 0x80, 0x00, 0xD1,
+    0x73, 0x44, 0x28, 0x19, 0x81, 0x47, 0x28, 0x19, 0x83, 0x02, 0x28, 0x19, 0x6F, 0x63, 0xFF, 0xFF,
+    0x80, 0x00, 0x0E, 0x53, 0x87, 0x01, 0x52, 0x84, 0x35, 0x9D, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x08, 0xFF, 0xFF, 0x97, 0xAD, 0x97, 0xAD, 0xFF, 0xFF, 0x97,
+    0xAD, 0x97, 0xAD, 0xD1, 0x73, 0x9A, 0xCE, 0x52, 0x84, 0x80, 0x00, 0x28, 0x19, 0x80, 0x00, 0x52,
+    0x84, 0x83, 0x05, 0x35, 0x9D, 0x9A, 0xCE, 0xEA, 0x31, 0x35, 0x9D, 0x9A, 0xCE, 0x6F, 0x63, 0x82,
+    0x00, 0x89, 0x21, 0x81, 0x02, 0x89, 0x21, 0xEA, 0x31, 0x89, 0x21, 0x86, 0x09, 0x6C, 0x42, 0x35,
+    0x9D, 0x7D, 0xEF, 0x0E, 0x53, 0x0E, 0x53, 0xF8, 0xBD, 0x7D, 0xEF, 0x35, 0x9D, 0x6F, 0x63, 0xEA,
+    0x31, 0x82, 0x02, 0x89, 0x21, 0x7D, 0xEF, 0xEA, 0x31, 0x88, 0x00, 0xEA, 0x31, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x00, 0x7D, 0xEF, 0x44, 0xEA, 0x31, 0x01,
+    0x6F, 0x63, 0xF8, 0xBD, 0x43, 0x28, 0x19, 0x00, 0xF8, 0xBD, 0x82, 0x0A, 0xEA, 0x31, 0x1C, 0xDF,
+    0x89, 0x21, 0x28, 0x19, 0x28, 0x19, 0x6C, 0x42, 0x97, 0xAD, 0x7D, 0xEF, 0xFF, 0xFF, 0x7D, 0xEF,
+    0x7D, 0xEF, 0x43, 0xFF, 0xFF, 0x00, 0x6F, 0x63, 0x85, 0x03, 0xEA, 0x31, 0x1C, 0xDF, 0x52, 0x84,
+    0x89, 0x21, 0x42, 0x28, 0x19, 0x04, 0xEA, 0x31, 0xD1, 0x73, 0x97, 0xAD, 0x1C, 0xDF, 0xEA, 0x31,
+    0x81, 0x01, 0x52, 0x84, 0xB4, 0x8C, 0x44, 0x28, 0x19, 0x81, 0x00, 0x89, 0x21, 0x42, 0xFF, 0xFF,
+    0x00, 0x35, 0x9D, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAE, 0x58,
+    0x28, 0x19, 0x01, 0x89, 0x21, 0x89, 0x21, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x95,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0x7F, 0x28, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x97,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xAF, 0x01, 0xD4, 0x6B, 0x69, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xAA, 0x01, 0xAF, 0x4A, 0xD4, 0x6B, 0xBF, 0xA1, 0x01, 0xAF, 0x4A, 0xD4, 0x6B, 0x8D, 0x01, 0x0C,
+    0x32, 0x5B, 0x9D, 0x8E, 0x01, 0x77, 0x84, 0xD4, 0x6B, 0x88, 0x4D, 0x69, 0x21, 0x84, 0x4A, 0x69,
+    0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0x05, 0x0C, 0x32, 0x77, 0x84,
+    0x5B, 0x9D, 0x5B, 0x9D, 0x15, 0x74, 0xCA, 0x29, 0x81, 0x00, 0x31, 0x5B, 0x47, 0xBC, 0xAD, 0x82,
+    0x02, 0xAF, 0x4A, 0xBC, 0xAD, 0xCF, 0x4A, 0x84, 0x02, 0xD4, 0x6B, 0xBC, 0xAD, 0x0C, 0x32, 0x82,
+    0x05, 0x69, 0x21, 0xD4, 0x6B, 0x19, 0x95, 0xBC, 0xAD, 0xB8, 0x8C, 0x0C, 0x32, 0x83, 0x05, 0x69,
+    0x21, 0xD4, 0x6B, 0x19, 0x95, 0x5B, 0x9D, 0x15, 0x74, 0x69, 0x21, 0x83, 0x00, 0xAF, 0x4A, 0x45,
+    0xBC, 0xAD, 0x00, 0x6D, 0x42, 0x84, 0x02, 0x69, 0x21, 0x5B, 0x9D, 0x15, 0x74, 0x83, 0x05, 0x69,
+    0x21, 0xD4, 0x6B, 0x19, 0x95, 0x5B, 0x9D, 0x15, 0x74, 0x69, 0x21, 0x84, 0x03, 0x72, 0x63, 0x5B,
+    0x9D, 0x5B, 0x9D, 0xD4, 0x6B, 0x93, 0x01, 0xAF, 0x4A, 0xBC, 0xAD, 0x84, 0x01, 0xB8, 0x8C, 0xD4,
+    0x6B, 0x84, 0x01, 0xCF, 0x4A, 0x5B, 0x9D, 0x83, 0x05, 0xCA, 0x29, 0x15, 0x74, 0x19, 0x95, 0x5B,
+    0x9D, 0x77, 0x84, 0xAF, 0x4A, 0x83, 0x01, 0xAF, 0x4A, 0xBC, 0xAD, 0x8D, 0x03, 0x72, 0x63, 0x5B,
+    0x9D, 0x5B, 0x9D, 0xD4, 0x6B, 0x8C, 0x02, 0x69, 0x21, 0x5B, 0x9D, 0x15, 0x74, 0x89, 0x04, 0x6D,
+    0x42, 0xB8, 0x8C, 0x5B, 0x9D, 0x77, 0x84, 0xCA, 0x29, 0xA9, 0x01, 0x0C, 0x32, 0x5B, 0x9D, 0x87,
+    0x00, 0x69, 0x21, 0x4D, 0xBC, 0xAD, 0x00, 0xCA, 0x29, 0x82, 0x00, 0x77, 0x84, 0x49, 0xBC, 0xAD,
+    0x00, 0x5B, 0x9D, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x07, 0xCA, 0x29,
+    0xBC, 0xAD, 0x15, 0x74, 0xAF, 0x4A, 0x6D, 0x42, 0xD4, 0x6B, 0xBC, 0xAD, 0xCA, 0x29, 0x80, 0x00,
+    0x28, 0x19, 0x42, 0x69, 0x21, 0x01, 0x5B, 0x9D, 0x31, 0x5B, 0x42, 0x69, 0x21, 0x84, 0x00, 0xB8,
+    0x8C, 0x84, 0x00, 0x5B, 0x9D, 0x84, 0x00, 0xB8, 0x8C, 0x80, 0x04, 0x0C, 0x32, 0x0C, 0x32, 0x15,
+    0x74, 0xBC, 0xAD, 0xCA, 0x29, 0x81, 0x01, 0x69, 0x21, 0x5B, 0x9D, 0x80, 0x03, 0x0C, 0x32, 0x0C,
+    0x32, 0x77, 0x84, 0x19, 0x95, 0x85, 0x44, 0x69, 0x21, 0x45, 0x28, 0x19, 0x01, 0xD4, 0x6B, 0xBC,
+    0xAD, 0x83, 0x01, 0x69, 0x21, 0x5B, 0x9D, 0x80, 0x03, 0x0C, 0x32, 0x0C, 0x32, 0x77, 0x84, 0x19,
+    0x95, 0x83, 0x05, 0x15, 0x74, 0xB8, 0x8C, 0xCA, 0x29, 0xCA, 0x29, 0x15, 0x74, 0xB8, 0x8C, 0x99,
+    0x01, 0x31, 0x5B, 0x19, 0x95, 0x84, 0x01, 0x77, 0x84, 0xD4, 0x6B, 0x82, 0x01, 0xCF, 0x4A, 0xBC,
+    0xAD, 0x80, 0x04, 0xAF, 0x4A, 0x6D, 0x42, 0x31, 0x5B, 0x5B, 0x9D, 0xAF, 0x4A, 0x91, 0x05, 0x15,
+    0x74, 0xB8, 0x8C, 0xCA, 0x29, 0xCA, 0x29, 0x15, 0x74, 0xB8, 0x8C, 0x8B, 0x01, 0xD4, 0x6B, 0xBC,
+    0xAD, 0x89, 0x05, 0x0C, 0x32, 0xBC, 0xAD, 0xCF, 0x4A, 0xCA, 0x29, 0xD4, 0x6B, 0x5B, 0x9D, 0x92,
+    0x00, 0xCA, 0x29, 0x44, 0xB8, 0x8C, 0x01, 0x19, 0x95, 0xBC, 0xAD, 0x44, 0xB8, 0x8C, 0x00, 0x77,
+    0x84, 0x81, 0x00, 0xCA, 0x29, 0x4D, 0xB8, 0x8C, 0x00, 0x0C, 0x32, 0x80, 0x4B, 0x28, 0x19, 0x80,
+    0x00, 0xCA, 0x29, 0x44, 0x28, 0x19, 0x80, 0x00, 0x6D, 0x42, 0x42, 0x28, 0x19, 0x01, 0x5B, 0x9D,
+    0xCA, 0x29, 0x42, 0x28, 0x19, 0x00, 0x69, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x86, 0x01, 0x72, 0x63, 0xB8, 0x8C, 0x43, 0x28, 0x19, 0x00, 0x69, 0x21, 0x45, 0x28, 0x19,
+    0x80, 0x00, 0xCF, 0x4A, 0x45, 0x28, 0x19, 0x80, 0x02, 0x77, 0x84, 0x5B, 0x9D, 0xCA, 0x29, 0x82,
+    0x02, 0x6D, 0x42, 0xB8, 0x8C, 0x5B, 0x9D, 0x83, 0x44, 0x28, 0x19, 0x01, 0x5B, 0x9D, 0xCF, 0x4A,
+    0x81, 0x01, 0x28, 0x19, 0x0C, 0x32, 0x42, 0x28, 0x19, 0x02, 0x69, 0x21, 0xBC, 0xAD, 0x0C, 0x32,
+    0x84, 0x49, 0x28, 0x19, 0x02, 0x0C, 0x32, 0xBC, 0xAD, 0xD4, 0x6B, 0x83, 0x01, 0x28, 0x19, 0x0C,
+    0x32, 0x42, 0x28, 0x19, 0x02, 0x69, 0x21, 0xBC, 0xAD, 0x0C, 0x32, 0x81, 0x02, 0x69, 0x21, 0xBC,
+    0xAD, 0xCA, 0x29, 0x42, 0x28, 0x19, 0x01, 0x19, 0x95, 0xAF, 0x4A, 0x98, 0x02, 0xCA, 0x29, 0xBC,
+    0xAD, 0xCA, 0x29, 0x83, 0x01, 0xBC, 0xAD, 0x6D, 0x42, 0x81, 0x02, 0x69, 0x21, 0xBC, 0xAD, 0x31,
+    0x5B, 0x43, 0x28, 0x19, 0x00, 0x69, 0x21, 0x43, 0x28, 0x19, 0x8D, 0x02, 0x69, 0x21, 0xBC, 0xAD,
+    0xCA, 0x29, 0x42, 0x28, 0x19, 0x01, 0x19, 0x95, 0xAF, 0x4A, 0x89, 0x02, 0x0C, 0x32, 0xBC, 0xAD,
+    0xD4, 0x6B, 0x89, 0x01, 0xD4, 0x6B, 0x15, 0x74, 0x42, 0x28, 0x19, 0x01, 0x19, 0x95, 0xCF, 0x4A,
+    0x91, 0x01, 0x0C, 0x32, 0x5B, 0x9D, 0x43, 0x6D, 0x42, 0x00, 0x31, 0x5B, 0x80, 0x43, 0x6D, 0x42,
+    0x01, 0xCF, 0x4A, 0x5B, 0x9D, 0x81, 0x04, 0x28, 0x19, 0x6D, 0x42, 0x6D, 0x42, 0x15, 0x74, 0x77,
+    0x84, 0x45, 0x6D, 0x42, 0x80, 0x03, 0x15, 0x74, 0x6D, 0x42, 0x6D, 0x42, 0x69, 0x21, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xA6, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0x00, 0x19, 0x95, 0x83, 0x46, 0x28, 0x19, 0x88,
+    0x02, 0xB8, 0x8C, 0xD4, 0x6B, 0x31, 0x5B, 0x82, 0x01, 0xD4, 0x6B, 0x31, 0x5B, 0x89, 0x01, 0xBC,
+    0xAD, 0xAF, 0x4A, 0x82, 0x44, 0x28, 0x19, 0x01, 0x5B, 0x9D, 0xAF, 0x4A, 0x8E, 0x02, 0x19, 0x95,
+    0x72, 0x63, 0x72, 0x63, 0x84, 0x44, 0x28, 0x19, 0x01, 0x5B, 0x9D, 0xAF, 0x4A, 0x81, 0x00, 0x0C,
+    0x32, 0x80, 0x43, 0x28, 0x19, 0x01, 0x72, 0x63, 0x15, 0x74, 0x98, 0x02, 0x28, 0x19, 0x19, 0x95,
+    0x31, 0x5B, 0x82, 0x00, 0x6D, 0x42, 0x80, 0x42, 0x28, 0x19, 0x01, 0xD4, 0x6B, 0x19, 0x95, 0x49,
+    0x28, 0x19, 0x8D, 0x00, 0x0C, 0x32, 0x80, 0x43, 0x28, 0x19, 0x01, 0x72, 0x63, 0x15, 0x74, 0x89,
+    0x02, 0x19, 0x95, 0x72, 0x63, 0x72, 0x63, 0x89, 0x01, 0xBC, 0xAD, 0xAF, 0x4A, 0x82, 0x01, 0x72,
+    0x63, 0x77, 0x84, 0x92, 0x00, 0x19, 0x95, 0x43, 0x28, 0x19, 0x01, 0x0C, 0x32, 0x5B, 0x9D, 0x43,
+    0x28, 0x19, 0x00, 0xCA, 0x29, 0x83, 0x04, 0x28, 0x19, 0x28, 0x19, 0x69, 0x21, 0x5B, 0x9D, 0x69,
+    0x21, 0x43, 0x28, 0x19, 0x02, 0xCA, 0x29, 0xBC, 0xAD, 0xCA, 0x29, 0x45, 0x28, 0x19, 0x00, 0xCF,
+    0x4A, 0x45, 0xBC, 0xAD, 0x00, 0x69, 0x21, 0x89, 0x00, 0x19, 0x95, 0x42, 0xB8, 0x8C, 0x00, 0xBC,
+    0xAD, 0x44, 0xB8, 0x8C, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x03, 0x0C,
+    0x32, 0xBC, 0xAD, 0x15, 0x74, 0xCA, 0x29, 0x92, 0x01, 0x6D, 0x42, 0x19, 0x95, 0x82, 0x02, 0x5B,
+    0x9D, 0x69, 0x21, 0xBC, 0xAD, 0x86, 0x02, 0xCA, 0x29, 0x15, 0x74, 0x77, 0x84, 0x47, 0x28, 0x19,
+    0x02, 0x69, 0x21, 0xBC, 0xAD, 0x0C, 0x32, 0x8D, 0x02, 0xCF, 0x4A, 0x5B, 0x9D, 0x28, 0x19, 0x89,
+    0x02, 0x69, 0x21, 0xBC, 0xAD, 0x0C, 0x32, 0x81, 0x00, 0xCA, 0x29, 0x80, 0x00, 0x69, 0x21, 0x82,
+    0x01, 0x31, 0x5B, 0xB8, 0x8C, 0x99, 0x01, 0x72, 0x63, 0x77, 0x84, 0x82, 0x01, 0xD4, 0x6B, 0x15,
+    0x74, 0x82, 0x01, 0x19, 0x95, 0x72, 0x63, 0x97, 0x00, 0xCA, 0x29, 0x80, 0x00, 0x69, 0x21, 0x82,
+    0x01, 0x31, 0x5B, 0xB8, 0x8C, 0x88, 0x02, 0xCF, 0x4A, 0x5B, 0x9D, 0x28, 0x19, 0x8B, 0x00, 0xCA,
+    0x29, 0x82, 0x01, 0xCF, 0x4A, 0x19, 0x95, 0xA4, 0x02, 0x28, 0x19, 0xD4, 0x6B, 0x72, 0x63, 0x83,
+    0x01, 0xD4, 0x6B, 0x15, 0x74, 0x46, 0x28, 0x19, 0x80, 0x00, 0x15, 0x74, 0x43, 0x28, 0x19, 0x8B,
+    0x00, 0x31, 0x5B, 0x42, 0x6D, 0x42, 0x01, 0x5B, 0x9D, 0xCF, 0x4A, 0x42, 0x6D, 0x42, 0x00, 0xAF,
+    0x4A, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0x8C, 0x7F, 0x29, 0x19, 0x7A, 0x29, 0x19, 0x04,
+    0x0D, 0x32, 0xB8, 0x8C, 0xBC, 0xAD, 0x16, 0x74, 0x0D, 0x32, 0x46, 0x29, 0x19, 0x80, 0x00, 0xD0,
+    0x4A, 0x45, 0x29, 0x19, 0x80, 0x07, 0x1A, 0x95, 0x29, 0x19, 0x5B, 0x9D, 0xCB, 0x29, 0x29, 0x19,
+    0xAF, 0x4A, 0x77, 0x84, 0x29, 0x19, 0x80, 0x00, 0x0D, 0x32, 0x43, 0x29, 0x19, 0x03, 0xCB, 0x29,
+    0xBC, 0xAD, 0xBC, 0xAD, 0x77, 0x84, 0x48, 0x29, 0x19, 0x01, 0xD0, 0x4A, 0x5B, 0x9D, 0x43, 0x29,
+    0x19, 0x81, 0x43, 0xBC, 0xAD, 0x00, 0x31, 0x5B, 0x42, 0x29, 0x19, 0x05, 0x6A, 0x21, 0xBC, 0xAD,
+    0x6E, 0x42, 0x29, 0x19, 0x73, 0x63, 0x16, 0x74, 0x47, 0x29, 0x19, 0x01, 0xD0, 0x4A, 0x5B, 0x9D,
+    0x43, 0x29, 0x19, 0x06, 0xB8, 0x8C, 0x77, 0x84, 0x6A, 0x21, 0x6A, 0x21, 0x31, 0x5B, 0x5B, 0x9D,
+    0x5B, 0x9D, 0x47, 0x29, 0x19, 0x81, 0x47, 0x29, 0x19, 0x81, 0x45, 0x29, 0x19, 0x01, 0x0D, 0x32,
+    0xBC, 0xAD, 0x42, 0x29, 0x19, 0x01, 0x5B, 0x9D, 0xAF, 0x4A, 0x42, 0x29, 0x19, 0x01, 0xBC, 0xAD,
+    0xAF, 0x4A, 0x49, 0x29, 0x19, 0x81, 0x4C, 0x29, 0x19, 0x06, 0xB8, 0x8C, 0x77, 0x84, 0x6A, 0x21,
+    0x6A, 0x21, 0x31, 0x5B, 0x5B, 0x9D, 0x5B, 0x9D, 0x47, 0x29, 0x19, 0x05, 0x6A, 0x21, 0xBC, 0xAD,
+    0x6E, 0x42, 0x29, 0x19, 0x73, 0x63, 0x16, 0x74, 0x47, 0x29, 0x19, 0x00, 0xCB, 0x29, 0x80, 0x00,
+    0x6A, 0x21, 0x42, 0x29, 0x19, 0x01, 0xAF, 0x4A, 0xBC, 0xAD, 0x47, 0x29, 0x19, 0x81, 0x47, 0x29,
+    0x19, 0x01, 0x0D, 0x32, 0x1A, 0x95, 0x43, 0x29, 0x19, 0x00, 0x0D, 0x32, 0x80, 0x43, 0x29, 0x19,
+    0x00, 0xCB, 0x29, 0x80, 0x45, 0x29, 0x19, 0x07, 0x6A, 0x21, 0x5B, 0x9D, 0x0D, 0x32, 0x29, 0x19,
+    0x29, 0x19, 0xCB, 0x29, 0xBC, 0xAD, 0xCB, 0x29, 0x46, 0x29, 0x19, 0x01, 0xD0, 0x4A, 0xD4, 0x6B,
+    0x43, 0x29, 0x19, 0x80, 0x02, 0x6A, 0x21, 0x29, 0x19, 0x29, 0x19, 0x80, 0x00, 0xCB, 0x29, 0x44,
+    0x29, 0x19, 0x80, 0x00, 0x6E, 0x42, 0x42, 0x29, 0x19, 0x80, 0x00, 0xCB, 0x29, 0x42, 0x29, 0x19,
+    0x00, 0x6A, 0x21, 0x80, 0x7F, 0x29, 0x19, 0x79, 0x29, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x87, 0x05, 0x29, 0x19, 0x29, 0x19, 0x6E, 0x42, 0x77, 0x84, 0xBC, 0xAD, 0xD4, 0x6B, 0x90,
+    0x01, 0xD4, 0x6B, 0x73, 0x63, 0x80, 0x01, 0x16, 0x74, 0xD0, 0x4A, 0x86, 0x02, 0x29, 0x19, 0xCB,
+    0x29, 0x6E, 0x42, 0x80, 0x01, 0x1A, 0x95, 0x6A, 0x21, 0x86, 0x01, 0x5B, 0x9D, 0xD0, 0x4A, 0x85,
+    0x43, 0xCB, 0x29, 0x00, 0x6A, 0x21, 0x82, 0x02, 0x16, 0x74, 0x16, 0x74, 0x29, 0x19, 0x8A, 0x01,
+    0x5B, 0x9D, 0xD0, 0x4A, 0x83, 0x03, 0x6A, 0x21, 0x16, 0x74, 0x5B, 0x9D, 0x1A, 0x95, 0x80, 0x01,
+    0x31, 0x5B, 0x1A, 0x95, 0x99, 0x02, 0x29, 0x19, 0x5B, 0x9D, 0xAF, 0x4A, 0x80, 0x01, 0xCB, 0x29,
+    0xBC, 0xAD, 0x43, 0x29, 0x19, 0x84, 0x42, 0xBC, 0xAD, 0x00, 0x77, 0x84, 0x91, 0x03, 0x6A, 0x21,
+    0x16, 0x74, 0x5B, 0x9D, 0x1A, 0x95, 0x80, 0x01, 0x31, 0x5B, 0x1A, 0x95, 0x87, 0x02, 0x16, 0x74,
+    0x16, 0x74, 0x29, 0x19, 0x91, 0x00, 0x5B, 0x9D, 0x93, 0x43, 0x6A, 0x21, 0x00, 0x6E, 0x42, 0x80,
+    0x43, 0x6A, 0x21, 0x00, 0x6E, 0x42, 0x86, 0x03, 0x29, 0x19, 0xD0, 0x4A, 0x5B, 0x9D, 0x6A, 0x21,
+    0x80, 0x01, 0x1A, 0x95, 0x31, 0x5B, 0x47, 0x29, 0x19, 0x90, 0x00, 0x1A, 0x95, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x91, 0xBF, 0xBF, 0xBF, 0xBF, 0x89, 0x04, 0x29, 0x19, 0x29, 0x19, 0x6E, 0x42, 0xBC, 0xAD,
+    0x31, 0x5B, 0x8F, 0x01, 0x0D, 0x32, 0x1A, 0x95, 0x80, 0x01, 0x5B, 0x9D, 0x6A, 0x21, 0x87, 0x42,
+    0x29, 0x19, 0x01, 0x77, 0x84, 0x16, 0x74, 0x85, 0x01, 0x16, 0x74, 0xB8, 0x8C, 0x44, 0x29, 0x19,
+    0x81, 0x46, 0x29, 0x19, 0x02, 0x0D, 0x32, 0xBC, 0xAD, 0x6A, 0x21, 0x8A, 0x01, 0x16, 0x74, 0xB8,
+    0x8C, 0x49, 0x29, 0x19, 0x01, 0x73, 0x63, 0x77, 0x84, 0x9A, 0x01, 0xD4, 0x6B, 0x16, 0x74, 0x80,
+    0x01, 0x31, 0x5B, 0x77, 0x84, 0x83, 0x01, 0x1A, 0x95, 0x31, 0x5B, 0x82, 0x02, 0xCB, 0x29, 0xCB,
+    0x29, 0xD4, 0x6B, 0x92, 0x44, 0x29, 0x19, 0x01, 0x73, 0x63, 0x77, 0x84, 0x86, 0x02, 0x0D, 0x32,
+    0xBC, 0xAD, 0x6A, 0x21, 0x8B, 0x00, 0x29, 0x19, 0x80, 0x00, 0xCB, 0x29, 0x82, 0x01, 0xD0, 0x4A,
+    0x1A, 0x95, 0x92, 0x4B, 0xBC, 0xAD, 0x87, 0x04, 0x29, 0x19, 0xD4, 0x6B, 0xB8, 0x8C, 0x77, 0x84,
+    0x77, 0x84, 0x48, 0x29, 0x19, 0x90, 0x01, 0x5B, 0x9D, 0xBC, 0xAD, 0x42, 0x5B, 0x9D, 0x00, 0xBC,
+    0xAD, 0x45, 0x5B, 0x9D, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0xBF, 0xBF, 0x8B, 0x02, 0x29,
+    0x19, 0x16, 0x74, 0x77, 0x84, 0x8F, 0x00, 0x29, 0x19, 0x80, 0x02, 0x73, 0x63, 0x16, 0x74, 0x29,
+    0x19, 0x8A, 0x01, 0x31, 0x5B, 0x1A, 0x95, 0x84, 0x02, 0x73, 0x63, 0x5B, 0x9D, 0x6A, 0x21, 0x8D,
+    0x00, 0x16, 0x74, 0x80, 0x42, 0x5B, 0x9D, 0x03, 0xBC, 0xAD, 0xBC, 0xAD, 0x5B, 0x9D, 0x0D, 0x32,
+    0x83, 0x02, 0x73, 0x63, 0x5B, 0x9D, 0x6A, 0x21, 0x89, 0x01, 0xB8, 0x8C, 0x73, 0x63, 0x9A, 0x01,
+    0x6E, 0x42, 0x5B, 0x9D, 0x80, 0x01, 0xB8, 0x8C, 0xD0, 0x4A, 0x83, 0x01, 0x16, 0x74, 0x1A, 0x95,
+    0x82, 0x02, 0x29, 0x19, 0x29, 0x19, 0x31, 0x5B, 0x97, 0x01, 0xB8, 0x8C, 0x73, 0x63, 0x86, 0x00,
+    0x16, 0x74, 0x80, 0x42, 0x5B, 0x9D, 0x03, 0xBC, 0xAD, 0xBC, 0xAD, 0x5B, 0x9D, 0x0D, 0x32, 0x86,
+    0x01, 0x5B, 0x9D, 0xAF, 0x4A, 0x82, 0x01, 0x73, 0x63, 0x77, 0x84, 0x91, 0x01, 0xCB, 0x29, 0x16,
+    0x74, 0x43, 0x29, 0x19, 0x01, 0x0D, 0x32, 0x5B, 0x9D, 0x43, 0x29, 0x19, 0x01, 0xCB, 0x29, 0xD4,
+    0x6B, 0x87, 0x03, 0x6A, 0x21, 0xBC, 0xAD, 0xBC, 0xAD, 0xCB, 0x29, 0x89, 0x45, 0xBC, 0xAD, 0x89,
+    0x01, 0xBC, 0xAD, 0xCB, 0x29, 0x42, 0x6A, 0x21, 0x01, 0x5B, 0x9D, 0x0D, 0x32, 0x42, 0x6A, 0x21,
+    0x00, 0x0D, 0x32, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x01, 0xD0, 0x4A,
+    0x6A, 0x21, 0x83, 0x01, 0xB8, 0x8C, 0xD4, 0x6B, 0x90, 0x02, 0x31, 0x5B, 0xBC, 0xAD, 0xAF, 0x4A,
+    0x86, 0x00, 0x0D, 0x32, 0x83, 0x01, 0x16, 0x74, 0x77, 0x84, 0x83, 0x02, 0x31, 0x5B, 0x5B, 0x9D,
+    0x0D, 0x32, 0x45, 0x29, 0x19, 0x88, 0x44, 0x6A, 0x21, 0x02, 0xD4, 0x6B, 0x77, 0x84, 0x6A, 0x21,
+    0x43, 0x29, 0x19, 0x02, 0x31, 0x5B, 0x5B, 0x9D, 0x0D, 0x32, 0x49, 0x29, 0x19, 0x02, 0x0D, 0x32,
+    0xBC, 0xAD, 0x6A, 0x21, 0x9A, 0x04, 0x29, 0x19, 0xBC, 0xAD, 0x6E, 0x42, 0xBC, 0xAD, 0x6A, 0x21,
+    0x83, 0x02, 0xCB, 0x29, 0xBC, 0xAD, 0xD0, 0x4A, 0x9B, 0x02, 0x0D, 0x32, 0xBC, 0xAD, 0x6A, 0x21,
+    0x86, 0x44, 0x6A, 0x21, 0x02, 0xD4, 0x6B, 0x77, 0x84, 0x6A, 0x21, 0x47, 0x29, 0x19, 0x01, 0xD4,
+    0x6B, 0x16, 0x74, 0x82, 0x01, 0x1A, 0x95, 0xD0, 0x4A, 0x91, 0x45, 0x29, 0x19, 0x85, 0x48, 0x29,
+    0x19, 0x05, 0x6E, 0x42, 0x5B, 0x9D, 0x77, 0x84, 0x16, 0x74, 0x5B, 0x9D, 0xAF, 0x4A, 0x88, 0x00,
+    0x16, 0x74, 0x44, 0x6A, 0x21, 0x42, 0x29, 0x19, 0x85, 0x01, 0xCB, 0x29, 0x1A, 0x95, 0x43, 0x29,
+    0x19, 0x80, 0x00, 0xCB, 0x29, 0x42, 0x29, 0x19, 0x00, 0x6A, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0x87,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x07, 0xB8, 0x8C, 0x5B, 0x9D, 0x31, 0x5B, 0x6E, 0x42, 0x6E, 0x42,
+    0x16, 0x74, 0xBC, 0xAD, 0xCB, 0x29, 0x90, 0x01, 0xCB, 0x29, 0x77, 0x84, 0x42, 0x29, 0x19, 0x83,
+    0x07, 0x0D, 0x32, 0xBC, 0xAD, 0x73, 0x63, 0x6E, 0x42, 0xCB, 0x29, 0x73, 0x63, 0xBC, 0xAD, 0x6E,
+    0x42, 0x82, 0x02, 0x73, 0x63, 0xBC, 0xAD, 0x6E, 0x42, 0x43, 0x6A, 0x21, 0x8B, 0x44, 0x29, 0x19,
+    0x01, 0x73, 0x63, 0x16, 0x74, 0x43, 0x29, 0x19, 0x02, 0x73, 0x63, 0xBC, 0xAD, 0x6E, 0x42, 0x43,
+    0x6A, 0x21, 0x82, 0x05, 0x77, 0x84, 0x31, 0x5B, 0xCB, 0x29, 0xAF, 0x4A, 0x5B, 0x9D, 0x73, 0x63,
+    0x48, 0x29, 0x19, 0x8B, 0x44, 0xCB, 0x29, 0x82, 0x02, 0x16, 0x74, 0x1A, 0x95, 0xB8, 0x8C, 0x45,
+    0x29, 0x19, 0x07, 0xD0, 0x4A, 0xBC, 0xAD, 0x16, 0x74, 0xAF, 0x4A, 0x0D, 0x32, 0xD0, 0x4A, 0x1A,
+    0x95, 0x16, 0x74, 0x84, 0x44, 0xCB, 0x29, 0x87, 0x05, 0x77, 0x84, 0x31, 0x5B, 0xCB, 0x29, 0xAF,
+    0x4A, 0x5B, 0x9D, 0x73, 0x63, 0x43, 0x29, 0x19, 0x01, 0x16, 0x74, 0x5B, 0x9D, 0x81, 0x44, 0x29,
+    0x19, 0x01, 0x73, 0x63, 0x16, 0x74, 0x43, 0x29, 0x19, 0x01, 0x16, 0x74, 0x5B, 0x9D, 0x82, 0x05,
+    0xCB, 0x29, 0xBC, 0xAD, 0x31, 0x5B, 0xCB, 0x29, 0xD4, 0x6B, 0x5B, 0x9D, 0x48, 0x29, 0x19, 0x9C,
+    0x09, 0xCB, 0x29, 0xD4, 0x6B, 0xBC, 0xAD, 0xD0, 0x4A, 0x29, 0x19, 0x29, 0x19, 0xD0, 0x4A, 0xBC,
+    0xAD, 0x16, 0x74, 0xCB, 0x29, 0x85, 0x01, 0x6A, 0x21, 0xCB, 0x29, 0x47, 0x29, 0x19, 0x85, 0x01,
+    0x31, 0x5B, 0xD4, 0x6B, 0xBF, 0xBF, 0xBF, 0xBF, 0x91, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0x04, 0x29,
+    0x19, 0x31, 0x5B, 0x77, 0x84, 0x5B, 0x9D, 0x5B, 0x9D, 0x80, 0x00, 0xCB, 0x29, 0x45, 0x29, 0x19,
+    0x8B, 0x44, 0x29, 0x19, 0x83, 0x06, 0x29, 0x19, 0x0D, 0x32, 0x16, 0x74, 0x1A, 0x95, 0xBC, 0xAD,
+    0xB8, 0x8C, 0x6E, 0x42, 0x42, 0x29, 0x19, 0x00, 0x6E, 0x42, 0x46, 0xBC, 0xAD, 0x95, 0x00, 0x6E,
+    0x42, 0x46, 0xBC, 0xAD, 0x82, 0x04, 0x0D, 0x32, 0x77, 0x84, 0xBC, 0xAD, 0x1A, 0x95, 0xD0, 0x4A,
+    0x49, 0x29, 0x19, 0x8B, 0x44, 0xBC, 0xAD, 0x00, 0xCB, 0x29, 0x81, 0x02, 0xAF, 0x4A, 0xBC, 0xAD,
+    0x31, 0x5B, 0x85, 0x01, 0x29, 0x19, 0x0D, 0x32, 0x80, 0x03, 0x1A, 0x95, 0x5B, 0x9D, 0xB8, 0x8C,
+    0x31, 0x5B, 0x43, 0x29, 0x19, 0x81, 0x44, 0xBC, 0xAD, 0x00, 0xCB, 0x29, 0x86, 0x04, 0x0D, 0x32,
+    0x77, 0x84, 0xBC, 0xAD, 0x1A, 0x95, 0xD0, 0x4A, 0x44, 0x29, 0x19, 0x01, 0x73, 0x63, 0x1A, 0x95,
+    0x8C, 0x01, 0x73, 0x63, 0x1A, 0x95, 0x82, 0x05, 0x29, 0x19, 0x6E, 0x42, 0xB8, 0x8C, 0x5B, 0x9D,
+    0x77, 0x84, 0xCB, 0x29, 0xA3, 0x04, 0xAF, 0x4A, 0xB8, 0x8C, 0xBC, 0xAD, 0x16, 0x74, 0xCB, 0x29,
+    0x43, 0x29, 0x19, 0x00, 0xCB, 0x29, 0x80, 0x02, 0xBC, 0xAD, 0xB8, 0x8C, 0xD0, 0x4A, 0x83, 0x46,
+    0x29, 0x19, 0x02, 0xCB, 0x29, 0x6A, 0x21, 0xCB, 0x29, 0x84, 0x02, 0x6A, 0x21, 0x5B, 0x9D, 0xCB,
+    0x29, 0x88, 0x00, 0xCB, 0x29, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0xBF, 0xBF, 0x87, 0x7F,
+    0x29, 0x19, 0x83, 0x5E, 0x29, 0x19, 0x89, 0x7F, 0x29, 0x19, 0x59, 0x29, 0x19, 0x99, 0x03, 0x6A,
+    0x21, 0x1A, 0x95, 0x31, 0x5B, 0x6A, 0x21, 0x47, 0x29, 0x19, 0x03, 0x6A, 0x21, 0x31, 0x5B, 0xB8,
+    0x8C, 0x6A, 0x21, 0x88, 0x04, 0xCB, 0x29, 0xBC, 0xAD, 0xBC, 0xAD, 0x5B, 0x9D, 0x16, 0x74, 0x43,
+    0x29, 0x19, 0x01, 0x31, 0x5B, 0x73, 0x63, 0x44, 0x29, 0x19, 0x81, 0x00, 0x6A, 0x21, 0x42, 0xBC,
+    0xAD, 0x00, 0xD4, 0x6B, 0xBF, 0xBF, 0xBF, 0xBF, 0x86, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9E, 0x7F, 0x29, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAA, 0x7F, 0x29, 0x19, 0xA3, 0x7F, 0x29, 0x19, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x90, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x01, 0x13, 0x74, 0x1A, 0xB6, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAB, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA5, 0x00, 0x0F, 0x53, 0x42, 0xDC, 0xCE, 0x02,
+    0x1A, 0xB6, 0xD6, 0x8C, 0x4D, 0x3A, 0x84, 0x01, 0x50, 0x5B, 0xD6, 0x8C, 0x8B, 0x00, 0xB1, 0x6B,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9E, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0x05, 0x8A, 0x21,
+    0xEB, 0x31, 0xAE, 0x4A, 0x74, 0x84, 0xDC, 0xCE, 0x50, 0x5B, 0x83, 0x4C, 0x29, 0x19, 0x01, 0x8A,
+    0x21, 0xDC, 0xCE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9E, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7,
+    0x43, 0x29, 0x19, 0x02, 0x50, 0x5B, 0xDC, 0xCE, 0xEB, 0x31, 0x8F, 0x00, 0xEB, 0x31, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0x02, 0x29, 0x19, 0x1A, 0xB6,
+    0x74, 0x84, 0x82, 0x01, 0xB1, 0x6B, 0x98, 0xA5, 0x82, 0x05, 0xEB, 0x31, 0x37, 0x9D, 0x7B, 0xC6,
+    0x7B, 0xC6, 0x74, 0x84, 0x8A, 0x21, 0x80, 0x00, 0x13, 0x74, 0x43, 0xDC, 0xCE, 0x00, 0x50, 0x5B,
+    0x81, 0x01, 0x13, 0x74, 0x1A, 0xB6, 0x9B, 0x04, 0xEB, 0x31, 0xD6, 0x8C, 0x7B, 0xC6, 0x7B, 0xC6,
+    0x74, 0x84, 0x82, 0x0B, 0xB1, 0x6B, 0x74, 0x84, 0xEB, 0x31, 0x37, 0x9D, 0x7B, 0xC6, 0xD6, 0x8C,
+    0x8A, 0x21, 0x8A, 0x21, 0x74, 0x84, 0x7B, 0xC6, 0x1A, 0xB6, 0xAE, 0x4A, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xA7, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x01, 0x13, 0x74, 0x98, 0xA5, 0x87, 0x00, 0x98,
+    0xA5, 0x80, 0x03, 0xEB, 0x31, 0xEB, 0x31, 0x13, 0x74, 0xEB, 0x31, 0x80, 0x01, 0x29, 0x19, 0xAE,
+    0x4A, 0x80, 0x01, 0xEB, 0x31, 0x8A, 0x21, 0x42, 0x29, 0x19, 0x01, 0xD6, 0x8C, 0x7B, 0xC6, 0x9A,
+    0x01, 0xEB, 0x31, 0xDC, 0xCE, 0x80, 0x03, 0x4D, 0x3A, 0x4D, 0x3A, 0xD6, 0x8C, 0xEB, 0x31, 0x82,
+    0x0A, 0x1A, 0xB6, 0x98, 0xA5, 0x0F, 0x53, 0x4D, 0x3A, 0x1A, 0xB6, 0x37, 0x9D, 0x98, 0xA5, 0xB1,
+    0x6B, 0x4D, 0x3A, 0xD6, 0x8C, 0x7B, 0xC6, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xAC, 0x01, 0x50, 0x5B, 0x7B, 0xC6, 0x87, 0x01, 0xDC, 0xCE, 0x0F, 0x53, 0x45, 0x29,
+    0x19, 0x00, 0x4D, 0x3A, 0x80, 0x61, 0x29, 0x19, 0x01, 0x37, 0x9D, 0x37, 0x9D, 0x46, 0x29, 0x19,
+    0x80, 0x0B, 0x7B, 0xC6, 0x8A, 0x21, 0x29, 0x19, 0x29, 0x19, 0x50, 0x5B, 0xDC, 0xCE, 0x4D, 0x3A,
+    0x29, 0x19, 0x29, 0x19, 0x8A, 0x21, 0xDC, 0xCE, 0x4D, 0x3A, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA6,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x00, 0xB1, 0x6B, 0x88, 0x02, 0x74, 0x84, 0x7B, 0xC6, 0x50,
+    0x5B, 0xA8, 0x01, 0xDC, 0xCE, 0x0F, 0x53, 0x87, 0x00, 0x98, 0xA5, 0x42, 0x29, 0x19, 0x00, 0xAE,
+    0x4A, 0x80, 0x43, 0x29, 0x19, 0x80, 0x00, 0xAE, 0x4A, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA6, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xAC, 0x01, 0x74, 0x84, 0x98, 0xA5, 0x87, 0x04, 0x29, 0x19, 0x0F, 0x53,
+    0x1A, 0xB6, 0x7B, 0xC6, 0xB1, 0x6B, 0x92, 0x00, 0x4D, 0x3A, 0x42, 0x7B, 0xC6, 0x00, 0x37, 0x9D,
+    0x81, 0x00, 0x4D, 0x3A, 0x42, 0x7B, 0xC6, 0x00, 0x37, 0x9D, 0x86, 0x00, 0x8A, 0x21, 0x80, 0x00,
+    0x4D, 0x3A, 0x8B, 0x00, 0x4D, 0x3A, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xAC, 0x01, 0x1A, 0xB6, 0x74, 0x84, 0x88, 0x04, 0x29, 0x19, 0x29, 0x19, 0xAE, 0x4A, 0x7B,
+    0xC6, 0x13, 0x74, 0x91, 0x00, 0x29, 0x19, 0x43, 0x8A, 0x21, 0x81, 0x00, 0x29, 0x19, 0x43, 0x8A,
+    0x21, 0x86, 0x00, 0x29, 0x19, 0x80, 0x00, 0x0F, 0x53, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xAB, 0x02, 0xB1, 0x6B, 0xDC, 0xCE, 0x8A, 0x21, 0x8A, 0x02, 0x29, 0x19,
+    0x13, 0x74, 0x98, 0xA5, 0x83, 0x00, 0xEB, 0x31, 0x8D, 0x52, 0x29, 0x19, 0x01, 0x98, 0xA5, 0x37,
+    0x9D, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0x05, 0x8A, 0x21,
+    0xEB, 0x31, 0x0F, 0x53, 0xD6, 0x8C, 0xDC, 0xCE, 0x50, 0x5B, 0x43, 0x29, 0x19, 0x83, 0x06, 0x4D,
+    0x3A, 0x1A, 0xB6, 0x0F, 0x53, 0x8A, 0x21, 0xAE, 0x4A, 0x1A, 0xB6, 0x13, 0x74, 0x81, 0x00, 0x29,
+    0x19, 0x80, 0x02, 0x74, 0x84, 0xEB, 0x31, 0xEB, 0x31, 0x81, 0x01, 0xD6, 0x8C, 0x7B, 0xC6, 0x9A,
+    0x06, 0x4D, 0x3A, 0xDC, 0xCE, 0x74, 0x84, 0x4D, 0x3A, 0x4D, 0x3A, 0x74, 0x84, 0x50, 0x5B, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7, 0x02, 0xDC, 0xCE, 0xDC, 0xCE,
+    0x1A, 0xB6, 0x80, 0x00, 0x4D, 0x3A, 0x44, 0x29, 0x19, 0x83, 0x05, 0x29, 0x19, 0x0F, 0x53, 0x98,
+    0xA5, 0xDC, 0xCE, 0x7B, 0xC6, 0x13, 0x74, 0x43, 0x29, 0x19, 0x03, 0x0F, 0x53, 0x7B, 0xC6, 0x7B,
+    0xC6, 0xB1, 0x6B, 0x81, 0x01, 0x13, 0x74, 0x1A, 0xB6, 0x9A, 0x04, 0x29, 0x19, 0x4D, 0x3A, 0x37,
+    0x9D, 0x7B, 0xC6, 0x1A, 0xB6, 0x80, 0x00, 0x8A, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB5, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xA5, 0x7F, 0x29, 0x19, 0x7F, 0x29, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0x8C,
+    0x7F, 0x49, 0x19, 0x7F, 0x49, 0x19, 0x7F, 0x49, 0x19, 0x7F, 0x49, 0x19, 0x7F, 0x49, 0x19, 0x7F,
+    0x49, 0x19, 0x7F, 0x49, 0x19, 0x7F, 0x49, 0x19, 0x45, 0x49, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xA3, 0x00, 0xEB, 0x29, 0x81, 0x00, 0x28, 0x11, 0x7F, 0x07,
+    0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11, 0x7F, 0x07, 0x11,
+    0x7F, 0x07, 0x11, 0x4F, 0x07, 0x11, 0x00, 0x28, 0x11, 0xBF, 0xBF, 0xA6, 0xBF, 0xBF, 0xA4, 0x00,
+    0x28, 0x11, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x91, 0x02, 0x07, 0x11, 0x07,
+    0x11, 0x28, 0x11, 0xBF, 0xBF, 0xA4, 0x7F, 0xA5, 0x10, 0x7F, 0xA5, 0x10, 0x44, 0xA5, 0x10, 0x46,
+    0x84, 0x08, 0x98, 0x7F, 0x07, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x94, 0x00, 0x07, 0x11,
+    0x98, 0x46, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0x7F, 0xA5, 0x10, 0x44, 0xA5, 0x10, 0xBF, 0xBF, 0xA3,
+    0x00, 0xEA, 0x29, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x95, 0x00, 0x28, 0x11, 0xBF, 0xBF,
+    0xA3, 0xBF, 0xBF, 0xA3, 0x00, 0xCA, 0x29, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x95, 0x00,
+    0x07, 0x11, 0xBF, 0xBF, 0xA3, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0x8C, 0x56,
+    0x4A, 0x19, 0x00, 0xEB, 0x29, 0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x7F, 0x08,
+    0x11, 0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x7F, 0x08, 0x11, 0x55, 0x08, 0x11, 0x00, 0x29, 0x11,
+    0x56, 0x4A, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xA3, 0x00, 0xEC, 0x29, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x95, 0x57, 0x4A, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xA4, 0x00, 0x29, 0x11,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x93, 0x00, 0x29, 0x11, 0xBF, 0xBF, 0xA4, 0xBF, 0xBF,
+    0xA4, 0x02, 0x4A, 0x19, 0x4A, 0x19, 0x29, 0x11, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x8F,
+    0x00, 0x29, 0x11, 0x59, 0x4A, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xA3, 0x7F, 0x4A, 0x19, 0x7F,
+    0x4A, 0x19, 0x7F, 0x4A, 0x19, 0x7F, 0x4A, 0x19, 0x7F, 0x4A, 0x19, 0x7F, 0x4A, 0x19, 0x7F, 0x4A,
+    0x19, 0x6E, 0x4A, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0x84, 0x00, 0xA5, 0x10, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x93, 0x7F, 0xA5, 0x10,
+    0xBF, 0x85, 0xBF, 0xBF, 0x8B, 0x00, 0x8B, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x85, 0x00, 0x8B, 0x21, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF, 0x8C, 0x00, 0x6A, 0x19, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x00, 0x6A, 0x19, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x8B, 0x01,
+    0x49, 0x19, 0x8B, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x01, 0x8B, 0x21,
+    0x49, 0x19, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF, 0x8B, 0x01, 0xE6, 0x10, 0xAB, 0x21, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x83, 0x01, 0xAB, 0x21, 0xE6, 0x10, 0xBF, 0xBF, 0x8B, 0xBF, 0xBF,
+    0x85, 0x00, 0xA5, 0x10, 0x84, 0x00, 0x84, 0x08, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x85, 0x45, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x86, 0xBF, 0xBF, 0x8C, 0x01, 0x6A, 0x19, 0x6A,
+    0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x81, 0x01, 0x6A, 0x19, 0x6A, 0x19, 0xBF,
+    0xBF, 0x8C, 0xBF, 0xBF, 0x8C, 0x01, 0xE6, 0x10, 0xAB, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x81, 0x01, 0xAB, 0x21, 0xE6, 0x10, 0xBF, 0xBF, 0x8C, 0xBF, 0xBF, 0x86, 0x00, 0xA5,
+    0x10, 0x84, 0x02, 0x84, 0x08, 0x8B, 0x21, 0x6A, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x01, 0x6A, 0x19, 0x8B, 0x21, 0x45, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x87, 0xBF, 0xBF,
+    0x8D, 0x01, 0xE6, 0x10, 0xAB, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x01, 0xAB,
+    0x21, 0xE6, 0x10, 0xBF, 0xBF, 0x8D, 0xBF, 0xBF, 0x8D, 0x02, 0x84, 0x08, 0x8A, 0x21, 0x8B, 0x21,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0x01, 0x8B, 0x21, 0x8A, 0x21, 0x46, 0x84, 0x08,
+    0xBF, 0xBF, 0x87, 0xBF, 0xBF, 0x87, 0x00, 0xA5, 0x10, 0x85, 0x01, 0x84, 0x08, 0xAB, 0x21, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBD, 0x00, 0xAB, 0x21, 0x46, 0x84, 0x08, 0x7F, 0xA5, 0x10,
+    0xBF, 0x88, 0xBF, 0xBF, 0x8F, 0x01, 0xE6, 0x10, 0xAB, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBB, 0x01, 0xAB, 0x21, 0xE6, 0x10, 0xBF, 0xBF, 0x8F, 0xBF, 0xBF, 0x88, 0x00, 0xA5, 0x10,
+    0x85, 0x02, 0x84, 0x08, 0x28, 0x11, 0xCC, 0x29, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9,
+    0x01, 0xCC, 0x29, 0x28, 0x11, 0x46, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x89, 0xBF, 0xBF, 0x89,
+    0x00, 0xA5, 0x10, 0x85, 0x02, 0x84, 0x08, 0x49, 0x19, 0xCC, 0x29, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xB7, 0x01, 0xCC, 0x29, 0x49, 0x19, 0x46, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x8A,
+    0xBF, 0xBF, 0x91, 0x02, 0x84, 0x08, 0x28, 0x11, 0xAB, 0x21, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xB5, 0x01, 0xAB, 0x21, 0x28, 0x11, 0x47, 0x84, 0x08, 0xBF, 0xBF, 0x8A, 0xBF, 0xBF, 0x8A,
+    0x00, 0xA5, 0x10, 0x86, 0x03, 0x84, 0x08, 0xE6, 0x10, 0xAB, 0x21, 0x8B, 0x21, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x02, 0x8B, 0x21, 0xAB, 0x21, 0xE6, 0x10, 0x47, 0x84, 0x08, 0x7F,
+    0xA5, 0x10, 0xBF, 0x8B, 0xBF, 0xBF, 0x8B, 0x00, 0xA5, 0x10, 0x86, 0x04, 0x84, 0x08, 0x84, 0x08,
+    0x8A, 0x21, 0xAB, 0x21, 0x6A, 0x19, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAD, 0x02, 0x6A,
+    0x19, 0xAB, 0x21, 0x8A, 0x21, 0x48, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x8C, 0xBF, 0xBF, 0x8C,
+    0x00, 0xA5, 0x10, 0x87, 0x04, 0x84, 0x08, 0xE6, 0x10, 0x8B, 0x21, 0xAB, 0x21, 0x6A, 0x19, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA9, 0x03, 0x6A, 0x19, 0xAB, 0x21, 0x8B, 0x21, 0xE6, 0x10,
+    0x48, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x8D, 0xBF, 0xBF, 0x8D, 0x00, 0xA5, 0x10, 0x87, 0x02,
+    0x84, 0x08, 0x84, 0x08, 0xE6, 0x10, 0x80, 0x03, 0xAB, 0x21, 0xAB, 0x21, 0x8B, 0x21, 0x6A, 0x19,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA1, 0x03, 0x6A, 0x19, 0x8B, 0x21, 0xAB, 0x21, 0xAB,
+    0x21, 0x80, 0x00, 0xE6, 0x10, 0x49, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x8E, 0xBF, 0xBF, 0x8E,
+    0x00, 0xA5, 0x10, 0x88, 0x42, 0x84, 0x08, 0x03, 0xE6, 0x10, 0x49, 0x19, 0x8B, 0x21, 0x8B, 0x21,
+    0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x7F,
+    0xCC, 0x29, 0x7F, 0xCC, 0x29, 0x5F, 0xCC, 0x29, 0x03, 0x8B, 0x21, 0x8B, 0x21, 0x49, 0x19, 0xE6,
+    0x10, 0x4B, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x8F, 0xBF, 0xBF, 0x8F, 0x00, 0xA5, 0x10, 0x8A,
+    0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x7F,
+    0x84, 0x08, 0x7F, 0x84, 0x08, 0x72, 0x84, 0x08, 0x7F, 0xA5, 0x10, 0xBF, 0x90, 0xBF, 0xBF, 0x90,
+    0x01, 0xA5, 0x10, 0xA5, 0x10, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB9, 0x7F, 0xA5, 0x10,
+    0xBF, 0x92, 0xBF, 0xBF, 0x92, 0x00, 0xA5, 0x10, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB7,
+    0x7F, 0xA5, 0x10, 0xBF, 0x93, 0xBF, 0xBF, 0x93, 0x01, 0xA5, 0x10, 0xA5, 0x10, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xB3, 0x7F, 0xA5, 0x10, 0xBF, 0x95, 0x7F, 0xC5, 0x10, 0x7F, 0xC5, 0x10,
+    0x57, 0xC5, 0x10, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08, 0x7F,
+    0xA4, 0x08, 0x7F, 0xA4, 0x08, 0x7F, 0xA4, 0x08, 0x6F, 0xA4, 0x08, 0x7F, 0xC5, 0x10, 0x7F, 0xC5,
+    0x10, 0x57, 0xC5, 0x10, 0xBF, 0xBF, 0x97, 0x43, 0xC5, 0x10, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xA7, 0x7F, 0xC5, 0x10, 0xBF, 0x9B, 0xBF, 0xBF, 0x9B, 0x44, 0xC5, 0x10, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9D, 0x7F, 0xC5, 0x10, 0xBF, 0xA0, 0xBF, 0xBF, 0xA0, 0x7F, 0xC5, 0x10,
+    0x7F, 0xC5, 0x10, 0x7F, 0xC5, 0x10, 0x7F, 0xC5, 0x10, 0x7F, 0xC5, 0x10, 0x7F, 0xC5, 0x10, 0x7F,
+    0xC5, 0x10, 0x7F, 0xC5, 0x10, 0xBF, 0xBE, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10,
+    0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F,
+    0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x7F, 0xC6, 0x10, 0x5F, 0xC6, 0x10, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F, 0xBF, 0xBF, 0xBF,
+    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x9F,
+};
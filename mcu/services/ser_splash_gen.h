@@ -0,0 +1,19 @@
+#pragma once
+
+/* 由 project/tools/splash_gen.py 根据启动界面渲染生成，请勿手工修改 */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ser_rle565 码流：w x h RGB565，逐行编码 */
+extern const uint16_t ser_splash_gen_w;
+extern const uint16_t ser_splash_gen_h;
+extern const uint32_t ser_splash_gen_len;
+extern const uint8_t ser_splash_gen_rle[];
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,569 @@
+#include "ser_timer.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define LEVEL_SHIFT(l) ((l) * SER_TIMER_WHEEL_BITS)
+#define SLOT_MASK (SER_TIMER_WHEEL_SLOTS - 1u)
+
+_Static_assert(SER_TIMER_WHEEL_SLOTS == 64u, "occupancy bitmap is 64-bit");
+
+/* ---------------- 链表 ---------------- */
+
+void ser_timer_list_init(ser_timer_list_t *list)
+{
+  list->head = NULL;
+  list->tail = &list->head;
+}
+
+void ser_timer_list_push(ser_timer_list_t *list, ser_timer_t *t)
+{
+  t->next = NULL;
+  t->pprev = list->tail;
+  *list->tail = t;
+  list->tail = &t->next;
+}
+
+void ser_timer_list_remove(ser_timer_list_t *list, ser_timer_t *t)
+{
+  *t->pprev = t->next;
+  if (t->next != NULL)
+  {
+    t->next->pprev = t->pprev;
+  }
+  else
+  {
+    list->tail = t->pprev;
+  }
+  t->next = NULL;
+  t->pprev = NULL;
+}
+
+ser_timer_t *ser_timer_list_pop(ser_timer_list_t *list)
+{
+  ser_timer_t *t = list->head;
+  if (t != NULL)
+  {
+    ser_timer_list_remove(list, t);
+  }
+  return t;
+}
+
+/* ---------------- 时间轮 ---------------- */
+
+static inline uint64_t ror64(uint64_t v, uint32_t n)
+{
+  n &= 63u;
+  return (n == 0u) ? v : ((v >> n) | (v << (64u - n)));
+}
+
+void ser_timer_wheel_init(ser_timer_wheel_t *w, uint64_t now)
+{
+  memset(w, 0, sizeof(*w));
+  w->now = now;
+}
+
+/* eff >= w->now：按距离选级，槽号取 eff 在该级的绝对下标 */
+static void wheel_place(ser_timer_wheel_t *w, ser_timer_t *t, uint64_t eff)
+{
+  uint64_t delta = eff - w->now;
+  if (delta >= SER_TIMER_WHEEL_SPAN)
+  {
+    /* 太远：先放在最高级最远处，下沉时按真实到期时刻重新放置 */
+    delta = SER_TIMER_WHEEL_SPAN - 1u;
+    eff = w->now + delta;
+  }
+
+  uint32_t level = 0;
+  while (level < SER_TIMER_WHEEL_LEVELS - 1u &&
+         delta >= (1ull << LEVEL_SHIFT(level + 1u)))
+  {
+    level++;
+  }
+  uint32_t slot = (uint32_t)(eff >> LEVEL_SHIFT(level)) & SLOT_MASK;
+
+  ser_timer_t **head = &w->slot[level][slot];
+  t->next = *head;
+  if (t->next != NULL)
+  {
+    t->next->pprev = &t->next;
+  }
+  *head = t;
+  t->pprev = head;
+  t->level = (uint8_t)level;
+  t->slot = (uint8_t)slot;
+
+  w->occupied[level] |= 1ull << slot;
+  w->count++;
+}
+
+void ser_timer_wheel_add(ser_timer_wheel_t *w, ser_timer_t *t)
+{
+  uint64_t eff = (t->expires > w->now) ? t->expires : w->now + 1u;
+  wheel_place(w, t, eff);
+}
+
+void ser_timer_wheel_del(ser_timer_wheel_t *w, ser_timer_t *t)
+{
+  *t->pprev = t->next;
+  if (t->next != NULL)
+  {
+    t->next->pprev = t->pprev;
+  }
+  if (w->slot[t->level][t->slot] == NULL)
+  {
+    w->occupied[t->level] &= ~(1ull << t->slot);
+  }
+  t->next = NULL;
+  t->pprev = NULL;
+  w->count--;
+}
+
+uint64_t ser_timer_wheel_next(const ser_timer_wheel_t *w)
+{
+  uint64_t best = UINT64_MAX;
+  for (uint32_t level = 0; level < SER_TIMER_WHEEL_LEVELS; level++)
+  {
+    uint64_t occ = w->occupied[level];
+    if (occ == 0u)
+    {
+      continue;
+    }
+
+    /*
+     * 该级下一个边界起按槽号旋转，最低位即最近的非空槽：
+     * 第 k 个边界 (base + k) << shift 处理槽 (base + k) & 63，k = 1..64
+     */
+    uint32_t shift = LEVEL_SHIFT(level);
+    uint64_t base = w->now >> shift;
+    uint64_t rot = ror64(occ, (uint32_t)(base + 1u));
+    uint64_t k = (uint64_t)__builtin_ctzll(rot) + 1u;
+    uint64_t t = (base + k) << shift;
+    if (t < best)
+    {
+      best = t;
+    }
+  }
+  return best;
+}
+
+/* 把 (level, slot) 整条链摘下，按 now 重新放置（下沉） */
+static void wheel_cascade(ser_timer_wheel_t *w, uint32_t level, uint32_t slot)
+{
+  ser_timer_t *t = w->slot[level][slot];
+  w->slot[level][slot] = NULL;
+  w->occupied[level] &= ~(1ull << slot);
+
+  while (t != NULL)
+  {
+    ser_timer_t *next = t->next;
+    w->count--;
+    /* 到期时刻就是当前 tick 的进第 0 级当前槽，紧接着处理 */
+    wheel_place(w, t, (t->expires > w->now) ? t->expires : w->now);
+    t = next;
+  }
+}
+
+uint32_t ser_timer_wheel_advance(ser_timer_wheel_t *w, uint64_t to,
+                                 ser_timer_list_t *expired)
+{
+  uint32_t n = 0;
+  for (;;)
+  {
+    uint64_t tick = ser_timer_wheel_next(w);
+    if (tick > to)
+    {
+      if (to > w->now)
+      {
+        w->now = to;
+      }
+      return n;
+    }
+    w->now = tick;
+
+    /* 先高级后低级：高级下沉的定时器不会落进本 tick 要下沉的低级槽 */
+    for (uint32_t level = SER_TIMER_WHEEL_LEVELS - 1u; level > 0u; level--)
+    {
+      uint32_t shift = LEVEL_SHIFT(level);
+      if ((tick & ((1ull << shift) - 1u)) != 0u)
+      {
+        continue;
+      }
+      uint32_t slot = (uint32_t)(tick >> shift) & SLOT_MASK;
+      if ((w->occupied[level] & (1ull << slot)) != 0u)
+      {
+        wheel_cascade(w, level, slot);
+      }
+    }
+
+    uint32_t slot = (uint32_t)tick & SLOT_MASK;
+    ser_timer_t *t = w->slot[0][slot];
+    w->slot[0][slot] = NULL;
+    w->occupied[0] &= ~(1ull << slot);
+    while (t != NULL)
+    {
+      ser_timer_t *next = t->next;
+      w->count--;
+      ser_timer_list_push(expired, t);
+      n++;
+      t = next;
+    }
+  }
+}
+
+/* ---------------- 服务（MCU） ---------------- */
+
+#if !defined(SER_TIMER_HOST) || !SER_TIMER_HOST
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dri_time_us.h"
+#include "stm32f4xx_hal.h"
+
+/* TIM3：16 位，100kHz（10us 一格），单次模式，溢出（更新）中断 */
+#define TIM_HZ 100000u
+#define TIM_MAX_COUNTS 0xFFFFu
+
+static ser_timer_wheel_t s_wheel;
+static ser_timer_list_t s_fired; /* 待在中断里回调 */
+static ser_timer_list_t s_queue; /* 待在工作任务里回调 */
+
+static TIM_HandleTypeDef s_htim3;
+static TaskHandle_t s_worker = NULL;
+static bool s_inited = false;
+static uint64_t s_armed = UINT64_MAX; /* 硬件定时器对准的 tick */
+static uint64_t s_us_q32 = 0;         /* 每 us 的 tick 数（Q32，向上取整） */
+
+static ser_timer_stats_t s_stats;
+
+static uint32_t timer_lock(void)
+{
+  uint32_t key = __get_PRIMASK();
+  __disable_irq();
+  return key;
+}
+
+static void timer_unlock(uint32_t key)
+{
+  __set_PRIMASK(key);
+}
+
+uint64_t ser_timer_now(void)
+{
+  return dri_time_cycles64() >> SER_TIMER_TICK_SHIFT;
+}
+
+uint32_t ser_timer_us_to_ticks(uint32_t us)
+{
+  return (uint32_t)(((uint64_t)us * s_us_q32 + 0xFFFFFFFFu) >> 32);
+}
+
+/* 调用方已持锁：让 TIM3 在 tick 处（或之后尽快）中断一次 */
+static void hw_arm(uint64_t tick)
+{
+  TIM_TypeDef *tim = s_htim3.Instance;
+  tim->CR1 &= ~TIM_CR1_CEN;
+  s_armed = tick;
+  if (tick == UINT64_MAX)
+  {
+    return;
+  }
+
+  uint64_t target = tick << SER_TIMER_TICK_SHIFT;
+  uint64_t now = dri_time_cycles64();
+  if (target <= now)
+  {
+    HAL_NVIC_SetPendingIRQ(TIM3_IRQn);
+    return;
+  }
+
+  /* 向上取整到 10us；太远时先到上限，中断里重新对准 */
+  uint64_t us = dri_time_cycles64_to_us(target - now);
+  uint64_t counts = (us + (1000000u / TIM_HZ) - 1u) / (1000000u / TIM_HZ);
+  if (counts < 2u)
+  {
+    counts = 2u;
+  }
+  if (counts > TIM_MAX_COUNTS)
+  {
+    counts = TIM_MAX_COUNTS;
+  }
+
+  tim->CNT = 0u;
+  tim->ARR = (uint32_t)counts - 1u;
+  tim->SR = ~(uint32_t)TIM_SR_UIF;
+  tim->CR1 |= TIM_CR1_CEN;
+}
+
+/* 调用方已持锁：时间轮变化后，最近时刻提前了才需要重新对准 */
+static void hw_update(void)
+{
+  uint64_t next = ser_timer_wheel_next(&s_wheel);
+  if (next < s_armed)
+  {
+    hw_arm(next);
+  }
+}
+
+/* 调用方已持锁：从所在链表摘下 */
+static bool detach(ser_timer_t *t)
+{
+  switch (t->state)
+  {
+  case SER_TIMER_ARMED:
+    ser_timer_wheel_del(&s_wheel, t);
+    break;
+  case SER_TIMER_PENDING:
+    ser_timer_list_remove(
+        (t->ctx == SER_TIMER_CTX_ISR) ? &s_fired : &s_queue, t);
+    break;
+  default:
+    return false;
+  }
+  t->state = SER_TIMER_IDLE;
+  return true;
+}
+
+/* 调用方已持锁：周期定时器按上次到期 + 周期重新插入，落后时跳过错过的周期 */
+static void rearm(ser_timer_t *t, uint64_t now)
+{
+  if (t->period == 0u)
+  {
+    t->state = SER_TIMER_IDLE;
+    return;
+  }
+
+  uint64_t next = t->expires + t->period;
+  if (next <= now)
+  {
+    next += ((now - next) / t->period + 1u) * t->period;
+  }
+  t->expires = next;
+  ser_timer_wheel_add(&s_wheel, t);
+  t->state = SER_TIMER_ARMED;
+}
+
+static void note_late(uint64_t expires)
+{
+  uint64_t due = expires << SER_TIMER_TICK_SHIFT;
+  uint64_t now = dri_time_cycles64();
+  if (now > due)
+  {
+    uint64_t late = dri_time_cycles64_to_us(now - due);
+    if (late > s_stats.late_max_us)
+    {
+      s_stats.late_max_us = (late > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)late;
+    }
+  }
+}
+
+/* 取出一个待回调的定时器并完成状态转换；没有返回 false */
+static bool take(ser_timer_list_t *list, ser_timer_cb_t *cb, void **arg,
+                 uint64_t *expires)
+{
+  uint32_t key = timer_lock();
+  ser_timer_t *t = ser_timer_list_pop(list);
+  if (t == NULL)
+  {
+    timer_unlock(key);
+    return false;
+  }
+
+  *cb = t->cb;
+  *arg = t->arg;
+  *expires = t->expires;
+  rearm(t, ser_timer_now());
+  hw_update();
+  timer_unlock(key);
+  return true;
+}
+
+void ser_timer_irq_handler(void)
+{
+  TIM_TypeDef *tim = s_htim3.Instance;
+  tim->SR = ~(uint32_t)TIM_SR_UIF;
+  s_stats.irqs++;
+
+  bool wake_worker = false;
+  uint32_t key = timer_lock();
+  s_armed = UINT64_MAX;
+
+  ser_timer_list_t expired;
+  ser_timer_list_init(&expired);
+  (void)ser_timer_wheel_advance(&s_wheel, ser_timer_now(), &expired);
+
+  ser_timer_t *t;
+  while ((t = ser_timer_list_pop(&expired)) != NULL)
+  {
+    t->state = SER_TIMER_PENDING;
+    if (t->ctx == SER_TIMER_CTX_ISR)
+    {
+      ser_timer_list_push(&s_fired, t);
+    }
+    else
+    {
+      ser_timer_list_push(&s_queue, t);
+      wake_worker = true;
+    }
+  }
+  hw_arm(ser_timer_wheel_next(&s_wheel));
+  timer_unlock(key);
+
+  /* 回调不持锁：期间更高优先级的中断仍可 start/stop */
+  ser_timer_cb_t cb;
+  void *arg;
+  uint64_t expires;
+  while (take(&s_fired, &cb, &arg, &expires))
+  {
+    note_late(expires);
+    s_stats.fired_isr++;
+    cb(arg);
+  }
+
+  if (wake_worker && s_worker != NULL)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(s_worker, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+void ser_timer_task(void *argument)
+{
+  (void)argument;
+  s_worker = xTaskGetCurrentTaskHandle();
+
+  for (;;)
+  {
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    ser_timer_cb_t cb;
+    void *arg;
+    uint64_t expires;
+    while (take(&s_queue, &cb, &arg, &expires))
+    {
+      note_late(expires);
+      s_stats.fired_task++;
+      cb(arg);
+    }
+  }
+}
+
+bool ser_timer_init(void)
+{
+  if (s_inited)
+  {
+    return true;
+  }
+
+  uint32_t hz = dri_time_hz();
+  if (hz == 0u)
+  {
+    return false;
+  }
+  /* ticks/us = hz / (1e6 * 2^shift)，Q32 向上取整 */
+  uint64_t den = 1000000ull << SER_TIMER_TICK_SHIFT;
+  s_us_q32 = (((uint64_t)hz << 32) + den - 1u) / den;
+
+  /* APB1 分频不为 1 时定时器时钟为 PCLK1 的 2 倍（本工程 45MHz -> 90MHz） */
+  uint32_t clk = HAL_RCC_GetPCLK1Freq();
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1)
+  {
+    clk *= 2u;
+  }
+
+  s_htim3.Instance = TIM3;
+  s_htim3.Init.Prescaler = clk / TIM_HZ - 1u;
+  s_htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+  s_htim3.Init.Period = TIM_MAX_COUNTS;
+  s_htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  s_htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&s_htim3) != HAL_OK)
+  {
+    return false;
+  }
+
+  /* 单次模式：溢出后自动停；只有溢出产生更新中断（Init 里的 UG 不算） */
+  TIM_TypeDef *tim = s_htim3.Instance;
+  tim->CR1 |= TIM_CR1_OPM | TIM_CR1_URS;
+  tim->SR = ~(uint32_t)TIM_SR_UIF;
+  __HAL_TIM_ENABLE_IT(&s_htim3, TIM_IT_UPDATE);
+
+  ser_timer_wheel_init(&s_wheel, ser_timer_now());
+  ser_timer_list_init(&s_fired);
+  ser_timer_list_init(&s_queue);
+  s_inited = true;
+  return true;
+}
+
+void ser_timer_setup(ser_timer_t *t, ser_timer_ctx_t ctx, ser_timer_cb_t cb,
+                     void *arg)
+{
+  memset(t, 0, sizeof(*t));
+  t->cb = cb;
+  t->arg = arg;
+  t->ctx = (uint8_t)ctx;
+  t->state = SER_TIMER_IDLE;
+}
+
+bool ser_timer_start_us(ser_timer_t *t, uint32_t delay_us, uint32_t period_us)
+{
+  if (!s_inited || t == NULL || t->cb == NULL)
+  {
+    return false;
+  }
+
+  uint32_t delay = ser_timer_us_to_ticks(delay_us);
+  uint32_t period = ser_timer_us_to_ticks(period_us);
+
+  uint32_t key = timer_lock();
+  (void)detach(t);
+
+  uint64_t now = ser_timer_now();
+  if (s_wheel.count == 0u && now > s_wheel.now)
+  {
+    /* 空闲时时间轮停在最后一次处理的时刻，直接跳到现在 */
+    s_wheel.now = now;
+  }
+
+  /* 当前 tick 已过去一部分，+1 保证至少等满 delay_us */
+  t->expires = now + delay + 1u;
+  t->period = period;
+  ser_timer_wheel_add(&s_wheel, t);
+  t->state = SER_TIMER_ARMED;
+  hw_update();
+  timer_unlock(key);
+  return true;
+}
+
+bool ser_timer_stop(ser_timer_t *t)
+{
+  if (t == NULL)
+  {
+    return false;
+  }
+
+  uint32_t key = timer_lock();
+  bool was = detach(t);
+  timer_unlock(key);
+  return was;
+}
+
+bool ser_timer_is_active(const ser_timer_t *t)
+{
+  return t != NULL && t->state != SER_TIMER_IDLE;
+}
+
+void ser_timer_get_stats(ser_timer_stats_t *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = s_stats;
+  }
+}
+
+void ser_timer_reset_stats(void)
+{
+  memset(&s_stats, 0, sizeof(s_stats));
+}
+#endif
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：软件定时器（分层时间轮 + 一个单次触发的硬件定时器）
+ *
+ * 背景：
+ * - configUSE_TIMERS = 0，周期性工作（如 120ms 超声波采样）各自是一个
+ *   vTaskDelay 循环的任务，每个都要一份栈
+ *
+ * 时间轮：
+ * - 时间单位为 tick = 2^SER_TIMER_TICK_SHIFT 个 CPU cycle（180MHz 下约 91us），
+ *   时钟取自 dri_time_cycles64，tick 为 64 位绝对值，不回绕
+ * - 4 级 × 64 槽：第 L 级每槽跨 64^L 个 tick，共覆盖 2^24 个 tick（约 25 分钟），
+ *   更远的先放在最高级，到期前逐级下沉（cascade）
+ * - 插入 / 取消 O(1)：定时器侵入式挂在槽链表上（pprev 指针），每级一个 64 位占用位图
+ * - 下一个需要处理的时刻（到期或下沉）由各级位图旋转后求最低位得到，O(级数)
+ *
+ * 驱动：
+ * - TIM3 单次（one-pulse）模式，只在下一个需要处理的时刻中断一次；
+ *   空闲（没有定时器）时不产生任何中断。16 位计数 10us 一格，超过约 655ms 时分段
+ * - 中断里把时间轮推进到当前时刻，取出到期的定时器：
+ *   - SER_TIMER_CTX_ISR：直接在中断里回调（须短、只用 FromISR API）
+ *   - SER_TIMER_CTX_TASK：挂到共享工作任务的队列，任务通知唤醒后依次回调
+ * - 周期定时器在回调之前按上次到期时刻 + 周期重新插入（不累积误差），
+ *   工作任务落后超过一个周期时跳过错过的周期
+ *
+ * 并发：
+ * - 时间轮与工作队列由 PRIMASK 短临界区保护（都是 O(1) 操作），
+ *   任务与中断（优先级不高于 configMAX_SYSCALL_INTERRUPT_PRIORITY）均可 start/stop
+ * - 回调里可以 start/stop 任意定时器（包括自己）
+ *
+ * 可移植性：
+ * - 时间轮本体（ser_timer_wheel_*）与平台无关，只操作调用方给的实例；
+ *   主机构建（SER_TIMER_HOST=1）只保留这一部分，用于正确性测试与基准测试
+ */
+
+#ifndef SER_TIMER_TICK_SHIFT
+#define SER_TIMER_TICK_SHIFT 14u
+#endif
+
+#define SER_TIMER_WHEEL_BITS 6u
+#define SER_TIMER_WHEEL_SLOTS (1u << SER_TIMER_WHEEL_BITS)
+#define SER_TIMER_WHEEL_LEVELS 4u
+/* 时间轮能直接放下的最远距离（tick） */
+#define SER_TIMER_WHEEL_SPAN                                                   \
+  (1ull << (SER_TIMER_WHEEL_BITS * SER_TIMER_WHEEL_LEVELS))
+
+typedef enum
+{
+  SER_TIMER_CTX_ISR = 0,
+  SER_TIMER_CTX_TASK,
+} ser_timer_ctx_t;
+
+typedef enum
+{
+  SER_TIMER_IDLE = 0,
+  SER_TIMER_ARMED,   /* 在时间轮里 */
+  SER_TIMER_PENDING, /* 已到期，在工作任务队列里 */
+} ser_timer_state_t;
+
+typedef void (*ser_timer_cb_t)(void *arg);
+
+/* 调用方持有（通常为静态变量），ser_timer_setup 之后字段只由本模块修改 */
+typedef struct ser_timer
+{
+  struct ser_timer *next;
+  struct ser_timer **pprev;
+  uint64_t expires; /* 绝对 tick */
+  uint32_t period;  /* tick，0 为单次 */
+  ser_timer_cb_t cb;
+  void *arg;
+  uint8_t ctx;   /* ser_timer_ctx_t */
+  uint8_t state; /* ser_timer_state_t */
+  uint8_t level; /* 在时间轮里时所在的级与槽 */
+  uint8_t slot;
+} ser_timer_t;
+
+/* 定时器链表（到期列表/工作队列）：tail 指向最后一个节点的 next（空时指向 head） */
+typedef struct
+{
+  ser_timer_t *head;
+  ser_timer_t **tail;
+} ser_timer_list_t;
+
+typedef struct
+{
+  uint64_t now; /* 已处理到的 tick */
+  uint64_t occupied[SER_TIMER_WHEEL_LEVELS];
+  ser_timer_t *slot[SER_TIMER_WHEEL_LEVELS][SER_TIMER_WHEEL_SLOTS];
+  uint32_t count;
+} ser_timer_wheel_t;
+
+/* ---- 时间轮本体（不加锁，调用方负责互斥） ---- */
+
+void ser_timer_list_init(ser_timer_list_t *list);
+void ser_timer_list_push(ser_timer_list_t *list, ser_timer_t *t);
+ser_timer_t *ser_timer_list_pop(ser_timer_list_t *list);
+void ser_timer_list_remove(ser_timer_list_t *list, ser_timer_t *t);
+
+void ser_timer_wheel_init(ser_timer_wheel_t *w, uint64_t now);
+
+/* 按 t->expires 插入；已过期（<= now）的放到 now + 1 */
+void ser_timer_wheel_add(ser_timer_wheel_t *w, ser_timer_t *t);
+
+/* 从时间轮摘下（t 必须在这个时间轮里） */
+void ser_timer_wheel_del(ser_timer_wheel_t *w, ser_timer_t *t);
+
+/* 下一个需要处理（到期或下沉）的 tick，> now；空时返回 UINT64_MAX */
+uint64_t ser_timer_wheel_next(const ser_timer_wheel_t *w);
+
+/* 推进到 to（含），到期的定时器按到期顺序追加到 expired，返回个数 */
+uint32_t ser_timer_wheel_advance(ser_timer_wheel_t *w, uint64_t to,
+                                 ser_timer_list_t *expired);
+
+/* ---- 服务（MCU） ---- */
+
+#if !defined(SER_TIMER_HOST) || !SER_TIMER_HOST
+typedef struct
+{
+  uint32_t fired_isr;
+  uint32_t fired_task;
+  uint32_t irqs;        /* TIM3 中断次数（含只做下沉/分段的） */
+  uint32_t late_max_us; /* 回调开始时刻相对到期 tick 的最大延迟 */
+} ser_timer_stats_t;
+
+/* 初始化 TIM3 与时间轮（调度器启动前调用，需在 dri_time_us_init 之后） */
+bool ser_timer_init(void);
+
+/* 工作任务入口（由 app 任务表静态创建）：执行 SER_TIMER_CTX_TASK 的回调 */
+#ifndef SER_TIMER_TASK_STACK
+#define SER_TIMER_TASK_STACK 512u
+#endif
+void ser_timer_task(void *argument);
+
+void ser_timer_setup(ser_timer_t *t, ser_timer_ctx_t ctx, ser_timer_cb_t cb,
+                     void *arg);
+
+/*
+ * 启动（已在运行则重新开始）：delay_us 后首次到期，period_us 为 0 则只触发一次
+ * 到期时刻向上取整到 tick，至少等满 delay_us
+ */
+bool ser_timer_start_us(ser_timer_t *t, uint32_t delay_us, uint32_t period_us);
+
+/* 停止；在时间轮或工作队列里都能取消，返回之前是否在运行 */
+bool ser_timer_stop(ser_timer_t *t);
+
+bool ser_timer_is_active(const ser_timer_t *t);
+
+/* 当前 tick 与换算 */
+uint64_t ser_timer_now(void);
+uint32_t ser_timer_us_to_ticks(uint32_t us);
+
+void ser_timer_get_stats(ser_timer_stats_t *stats);
+void ser_timer_reset_stats(void);
+
+/* TIM3_IRQHandler 中调用 */
+void ser_timer_irq_handler(void);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
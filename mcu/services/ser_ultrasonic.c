@@ -1,40 +1,216 @@
 #include "ser_ultrasonic.h"
 
-#include "FreeRTOS.h"
-#include "task.h"
+#include <stddef.h>
+#include <string.h>
 
 #include "dev_ultrasonic.h"
+#include "dri_time_us.h"
+#include "ser_bus.h"
+#include "ser_timer.h"
 
-static volatile uint32_t s_latest_mm = 0;
-static volatile uint8_t s_latest_valid = 0;
+enum
+{
+#define SER_US_X_COUNT(ch, sector, group, range_mm) +1
+  SENSOR_NUM = 0 SER_ULTRASONIC_SENSOR_TABLE(SER_US_X_COUNT)
+#undef SER_US_X_COUNT
+};
+
+_Static_assert(SENSOR_NUM <= SER_ULTRASONIC_PLAN_MAX,
+               "too many ultrasonic sensors");
+_Static_assert(SER_ULTRASONIC_PLAN_MAX <= SER_BUS_RANGES_MAX,
+               "ranges topic too small");
+
+typedef struct
+{
+  uint8_t ch;
+  uint8_t sector;
+  uint8_t group;
+  uint32_t range_mm;
+} us_desc_t;
+
+static const us_desc_t s_desc[SENSOR_NUM] = {
+#define SER_US_X_DESC(ch, sector, group, range_mm) {ch, sector, group, range_mm},
+    SER_ULTRASONIC_SENSOR_TABLE(SER_US_X_DESC)
+#undef SER_US_X_DESC
+};
+
+/* 每路：单次触发定时器 + 串扰门限 */
+typedef struct
+{
+  ser_timer_t fire;
+  ser_ultrasonic_gate_t gate;
+  volatile bool fired; /* 本周期 TRIG 已发出 */
+} us_sensor_t;
+
+/* UI 绑定：距离（mm），无效时为 -1；由总线订阅回调转发 */
+static ser_lvgl_subject_t s_distance_subject;
+static ser_bus_sub_t s_distance_sub;
+
+static ser_ultrasonic_plan_t s_plan;
+static bool s_planned = false;
+static us_sensor_t s_sensor[SENSOR_NUM];
+static ser_timer_t s_cycle_timer;
+static uint32_t s_cycle = 0;
+static uint32_t s_rng = 1u;
+
+static void distance_to_subject(ser_bus_topic_t topic, const void *payload,
+                                void *arg)
+{
+  (void)topic;
+  ser_lvgl_subject_publish((ser_lvgl_subject_t *)arg,
+                           ((const ser_bus_distance_t *)payload)->mm);
+}
+
+/* xorshift32：触发抖动只需要与回波无关，不需要密码学强度 */
+static uint32_t rng_next(void)
+{
+  uint32_t x = s_rng;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  s_rng = x;
+  return x;
+}
 
-static void ultrasonic_task(void *argument)
+static void fire_cb(void *arg)
 {
-  (void)argument;
+  uint32_t i = (uint32_t)(uintptr_t)arg;
+  s_sensor[i].fired = dev_ultrasonic_trigger(s_desc[i].ch);
+}
 
-  (void)dev_ultrasonic_init();
+/* 上一周期的读数（有干扰方的过门限）整批发布（第 0 路另发 distance） */
+static void publish_cycle(void)
+{
+  uint32_t ticket;
+  ser_bus_ranges_t *r = ser_bus_claim_ranges(&ticket);
+  if (r == NULL)
+  {
+    return;
+  }
 
-  for (;;)
+  memset(r, 0, sizeof(*r));
+  r->cycle = s_cycle;
+  r->n = SENSOR_NUM;
+  for (uint32_t i = 0; i < SENSOR_NUM; i++)
   {
+    us_sensor_t *s = &s_sensor[i];
     uint32_t mm = 0;
-    if (dev_ultrasonic_measure_mm(&mm))
+    int32_t raw = (s->fired && dev_ultrasonic_result_mm(s_desc[i].ch, &mm))
+                      ? (int32_t)mm
+                      : -1;
+    uint32_t rejected = s->gate.rejected;
+
+    /* 没有干扰方的路不会收到别人的声波：有效读数直接发布，不等连续一致 */
+    bool ok;
+    if (s_plan.conflict[i] != 0u)
     {
-      s_latest_mm = mm;
-      s_latest_valid = 1u;
+      ok = ser_ultrasonic_gate(&s->gate, raw, (int32_t)s_desc[i].range_mm,
+                               SER_ULTRASONIC_GATE_TOL_MM);
     }
     else
     {
-      s_latest_valid = 0u;
+      ok = raw >= 0 && raw <= (int32_t)s_desc[i].range_mm;
+    }
+
+    r->mm[i] = -1;
+    if (ok)
+    {
+      r->mm[i] = raw;
+      r->valid |= (uint8_t)(1u << i);
+    }
+    else if (s->gate.rejected != rejected)
+    {
+      r->rejected |= (uint8_t)(1u << i);
+    }
+  }
+  int32_t mm0 = r->mm[0];
+  ser_bus_commit(SER_BUS_TOPIC_ranges, ticket);
+
+  ser_bus_distance_t *d = ser_bus_claim_distance(&ticket);
+  if (d != NULL)
+  {
+    d->mm = mm0;
+    ser_bus_commit(SER_BUS_TOPIC_distance, ticket);
+  }
+}
+
+/* 周期开始：发布上一周期，再按排程起点 + 抖动安排本周期各路的 TRIG */
+static void cycle_cb(void *arg)
+{
+  (void)arg;
+  if (s_cycle != 0u)
+  {
+    publish_cycle();
+  }
+  s_cycle++;
+
+  for (uint32_t i = 0; i < SENSOR_NUM; i++)
+  {
+    s_sensor[i].fired = false;
+    uint32_t delay = s_plan.offset_us[i] +
+                     rng_next() % (SER_ULTRASONIC_DITHER_US + 1u);
+    (void)ser_timer_start_us(&s_sensor[i].fire, delay, 0u);
+  }
+}
+
+static bool build_plan(void)
+{
+  ser_ultrasonic_sensor_t sensors[SENSOR_NUM];
+  for (uint32_t i = 0; i < SENSOR_NUM; i++)
+  {
+    if (s_desc[i].ch >= dev_ultrasonic_count())
+    {
+      return false;
     }
+    /* 往返 1mm 约 5.8us */
+    sensors[i].window_us =
+        SER_ULTRASONIC_RISE_US + s_desc[i].range_mm * 58u / 10u;
+    sensors[i].sector = s_desc[i].sector;
+    sensors[i].group = s_desc[i].group;
+  }
+
+  const ser_ultrasonic_plan_cfg_t cfg = {
+      .dither_us = SER_ULTRASONIC_DITHER_US,
+      .guard_us = SER_ULTRASONIC_GUARD_US,
+      .min_cycle_us = SER_ULTRASONIC_MIN_CYCLE_US,
+      .spread = SER_ULTRASONIC_SPREAD,
+  };
+  return ser_ultrasonic_plan_build(sensors, SENSOR_NUM, &cfg, &s_plan);
+}
+
+bool ser_ultrasonic_init(void)
+{
+  ser_lvgl_subject_init(&s_distance_subject, -1);
+  s_distance_sub.cb = distance_to_subject;
+  s_distance_sub.arg = &s_distance_subject;
+  (void)ser_bus_subscribe(SER_BUS_TOPIC_distance, &s_distance_sub);
+
+  /* GPIO 在这里（启动图 IO 通道）完成；硬件失败则不启动采样 */
+  if (!dev_ultrasonic_init() || !build_plan())
+  {
+    return false;
+  }
+  s_planned = true;
 
-    vTaskDelay(pdMS_TO_TICKS(120));
+  s_rng = dri_time_cycles_now() | 1u;
+  for (uint32_t i = 0; i < SENSOR_NUM; i++)
+  {
+    ser_ultrasonic_gate_init(&s_sensor[i].gate);
+    ser_timer_setup(&s_sensor[i].fire, SER_TIMER_CTX_TASK, fire_cb,
+                    (void *)(uintptr_t)i);
   }
+  ser_timer_setup(&s_cycle_timer, SER_TIMER_CTX_TASK, cycle_cb, NULL);
+  return ser_timer_start_us(&s_cycle_timer, 0u, s_plan.cycle_us);
 }
 
-void ser_ultrasonic_start(void)
+bool ser_ultrasonic_get_plan(ser_ultrasonic_plan_t *plan)
 {
-  (void)xTaskCreate(ultrasonic_task, "ultra", 512, NULL,
-                    tskIDLE_PRIORITY + 1, NULL);
+  if (plan == NULL || !s_planned)
+  {
+    return false;
+  }
+  *plan = s_plan;
+  return true;
 }
 
 bool ser_ultrasonic_get_latest_mm(uint32_t *mm)
@@ -44,11 +220,17 @@ bool ser_ultrasonic_get_latest_mm(uint32_t *mm)
     return false;
   }
 
-  if (!s_latest_valid)
+  ser_bus_distance_t d;
+  if (!ser_bus_read_distance(&d) || d.mm < 0)
   {
     return false;
   }
 
-  *mm = s_latest_mm;
+  *mm = (uint32_t)d.mm;
   return true;
 }
+
+ser_lvgl_subject_t *ser_ultrasonic_distance_subject(void)
+{
+  return &s_distance_subject;
+}
@@ -3,22 +3,84 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "ser_lvgl_bind.h"
+#include "ser_ultrasonic_plan.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /*
- * services/ 层：超声波测距服务
+ * services/ 层：多路超声波测距服务
  *
- * - 独立任务周期采样距离（避免阻塞 LVGL 任务）
- * - 提供最新距离给 UI 显示
+ * - 传感器按下表描述（通道、朝向、频率组、量程），初始化时由 ser_ultrasonic_plan
+ *   算出排程：互不干扰的几路同时发射、回波窗口重叠，互相干扰的错开
+ * - 一个周期定时器（ser_timer，周期 = 排程周期）在每个周期开始时：
+ *   取上一周期各路 ECHO 中断测得的脉宽 -> 串扰门限（只用于排程中有干扰方的几路）
+ *   -> 一次发布到总线 ranges 主题；
+ *   再为每路启动单次定时器，在“排程起点 + 随机抖动”处发 TRIG
+ * - 第 0 路同时发布到 distance 主题（UI 显示与遥测沿用），无效为 -1
+ * - 回调都在共享的定时器工作任务里，等回波期间不占 CPU
+ */
+
+/*
+ * 传感器表：X(ch, sector, group, range_mm)
+ * - ch：dev_ultrasonic 通道号（board/ 通道表顺序）
+ * - sector：朝向扇区（SER_ULTRASONIC_SECTORS 等分，0 为正前方，顺时针）
+ * - group：频率组（载频不同的模块互不干扰；同型号都填 0）
+ * - range_mm：最远量程，决定回波窗口（越短周期越短）
+ */
+#ifndef SER_ULTRASONIC_SENSOR_TABLE
+// clang-format off
+#define SER_ULTRASONIC_SENSOR_TABLE(X)                                         \
+  X(0, 0, 0, 5600)
+// clang-format on
+#endif
+
+/* TRIG 到 ECHO 拉高的延迟（模块发 8 个 40kHz 脉冲的时间，留余量） */
+#ifndef SER_ULTRASONIC_RISE_US
+#define SER_ULTRASONIC_RISE_US 500u
+#endif
+
+/* 排程参数：触发抖动（主机仿真：3ms 配合 3 次一致把模型外串扰的误收压到 1% 以下） */
+#ifndef SER_ULTRASONIC_DITHER_US
+#define SER_ULTRASONIC_DITHER_US 3000u
+#endif
+#ifndef SER_ULTRASONIC_GUARD_US
+#define SER_ULTRASONIC_GUARD_US 6000u
+#endif
+/* 同一模块两次触发的最小间隔（无回波时 ECHO 约 38ms 后才超时拉低） */
+#ifndef SER_ULTRASONIC_MIN_CYCLE_US
+#define SER_ULTRASONIC_MIN_CYCLE_US 40000u
+#endif
+#ifndef SER_ULTRASONIC_SPREAD
+#define SER_ULTRASONIC_SPREAD 1u
+#endif
+
+/*
+ * 串扰门限：连续几次读数的最大差（mm）；目标每周期移动超过它时读数也会被拒绝
+ * 没有干扰方的路（例如默认的单路）不过门限，快速移动的目标照常输出
  */
+#ifndef SER_ULTRASONIC_GATE_TOL_MM
+#define SER_ULTRASONIC_GATE_TOL_MM 40u
+#endif
 
-void ser_ultrasonic_start(void);
+/*
+ * 初始化 subject / 总线订阅 / 测距硬件（启动图 IO 通道调用），生成排程并启动周期定时器
+ * 硬件初始化失败或传感器表无效返回 false，subject 保持无效值（-1）
+ * 总线订阅回调（UI subject、遥测编码）在定时器工作任务的栈上执行
+ */
+bool ser_ultrasonic_init(void);
 
-/* 读取最新一次有效距离（mm）；无有效数据返回 false */
+/* 当前排程（诊断用）；未初始化返回 false */
+bool ser_ultrasonic_get_plan(ser_ultrasonic_plan_t *plan);
+
+/* 读取第 0 路最新一次有效距离（mm）；无有效数据返回 false */
 bool ser_ultrasonic_get_latest_mm(uint32_t *mm);
 
+/* 距离 subject：第 0 路每周期发布（mm，无效为 -1），供 UI 绑定 */
+ser_lvgl_subject_t *ser_ultrasonic_distance_subject(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
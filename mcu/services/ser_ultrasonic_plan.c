@@ -0,0 +1,267 @@
+#include "ser_ultrasonic_plan.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define PLAN_SUBSETS (1u << SER_ULTRASONIC_PLAN_MAX)
+
+/* 子集动态规划工作区：best[m] 为 m 的最小时隙总长，pick[m] 为其中第一个时隙 */
+static uint32_t s_best[PLAN_SUBSETS];
+static uint8_t s_pick[PLAN_SUBSETS];
+
+bool ser_ultrasonic_plan_conflicts(const ser_ultrasonic_sensor_t *a,
+                                   const ser_ultrasonic_sensor_t *b,
+                                   uint8_t spread)
+{
+  if (a->group != b->group)
+  {
+    return false;
+  }
+
+  uint32_t d = (a->sector >= b->sector) ? (uint32_t)(a->sector - b->sector)
+                                        : (uint32_t)(b->sector - a->sector);
+  d %= SER_ULTRASONIC_SECTORS;
+  if (d > SER_ULTRASONIC_SECTORS - d)
+  {
+    d = SER_ULTRASONIC_SECTORS - d;
+  }
+  return d <= spread;
+}
+
+static uint32_t max_u32(uint32_t a, uint32_t b)
+{
+  return (a > b) ? a : b;
+}
+
+/* m 内两两不干扰 */
+static bool independent(const ser_ultrasonic_plan_t *plan, uint32_t m)
+{
+  for (uint32_t i = 0; i < plan->n; i++)
+  {
+    if ((m & (1u << i)) != 0u && (plan->conflict[i] & m) != 0u)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static uint32_t span_of(const uint32_t *len, uint32_t m)
+{
+  uint32_t span = 0;
+  for (uint32_t i = 0; m != 0u; i++, m >>= 1)
+  {
+    if ((m & 1u) != 0u)
+    {
+      span = max_u32(span, len[i]);
+    }
+  }
+  return span;
+}
+
+/* 最小总长的时隙划分；时隙依次写入 slot_mask，返回时隙数 */
+static uint32_t partition(const ser_ultrasonic_plan_t *plan, const uint32_t *len,
+                          uint8_t *slot_mask)
+{
+  uint32_t full = (1u << plan->n) - 1u;
+
+  s_best[0] = 0;
+  for (uint32_t m = 1; m <= full; m++)
+  {
+    /* 只枚举含 m 最低位的子集：同一划分不重复计算 */
+    uint32_t low = m & (~m + 1u);
+    uint32_t rest = m ^ low;
+    s_best[m] = UINT32_MAX;
+
+    for (uint32_t sub = rest;; sub = (sub - 1u) & rest)
+    {
+      uint32_t s = sub | low;
+      if (independent(plan, s) && s_best[m ^ s] != UINT32_MAX)
+      {
+        uint32_t cost = s_best[m ^ s] + span_of(len, s);
+        if (cost < s_best[m])
+        {
+          s_best[m] = cost;
+          s_pick[m] = (uint8_t)s;
+        }
+      }
+      if (sub == 0u)
+      {
+        break;
+      }
+    }
+  }
+
+  uint32_t slots = 0;
+  for (uint32_t m = full; m != 0u; m ^= s_pick[m])
+  {
+    slot_mask[slots++] = s_pick[m];
+  }
+  return slots;
+}
+
+/* 与已放置的干扰方区间都不重叠的最早起点（候选为 0 与各区间终点） */
+static uint32_t earliest_start(const ser_ultrasonic_plan_t *plan,
+                               const uint32_t *len, uint32_t placed, uint32_t i)
+{
+  uint32_t best = UINT32_MAX;
+  uint32_t others = placed & plan->conflict[i];
+
+  for (uint32_t c = 0; c <= plan->n; c++)
+  {
+    uint32_t t;
+    if (c == plan->n)
+    {
+      t = 0;
+    }
+    else if ((others & (1u << c)) != 0u)
+    {
+      t = plan->offset_us[c] + len[c];
+    }
+    else
+    {
+      continue;
+    }
+
+    if (t >= best)
+    {
+      continue;
+    }
+
+    bool ok = true;
+    for (uint32_t j = 0; j < plan->n && ok; j++)
+    {
+      if ((others & (1u << j)) != 0u)
+      {
+        uint32_t s = plan->offset_us[j];
+        ok = (t + len[i] <= s) || (s + len[j] <= t);
+      }
+    }
+    if (ok)
+    {
+      best = t;
+    }
+  }
+  return best;
+}
+
+bool ser_ultrasonic_plan_build(const ser_ultrasonic_sensor_t *sensors,
+                               uint32_t n, const ser_ultrasonic_plan_cfg_t *cfg,
+                               ser_ultrasonic_plan_t *plan)
+{
+  if (sensors == NULL || cfg == NULL || plan == NULL || n == 0u ||
+      n > SER_ULTRASONIC_PLAN_MAX)
+  {
+    return false;
+  }
+
+  memset(plan, 0, sizeof(*plan));
+  plan->n = (uint8_t)n;
+
+  uint32_t len[SER_ULTRASONIC_PLAN_MAX];
+  for (uint32_t i = 0; i < n; i++)
+  {
+    len[i] = cfg->dither_us + sensors[i].window_us + cfg->guard_us;
+    plan->serial_us += len[i];
+    for (uint32_t j = 0; j < n; j++)
+    {
+      if (j != i &&
+          ser_ultrasonic_plan_conflicts(&sensors[i], &sensors[j], cfg->spread))
+      {
+        plan->conflict[i] |= (uint8_t)(1u << j);
+      }
+    }
+  }
+
+  uint8_t slot_mask[SER_ULTRASONIC_PLAN_MAX];
+  plan->slots = (uint8_t)partition(plan, len, slot_mask);
+  plan->slotted_us = s_best[(1u << n) - 1u];
+
+  /* 按时隙顺序放置，时隙内长的在前 */
+  uint32_t placed = 0;
+  for (uint32_t k = 0; k < plan->slots; k++)
+  {
+    uint32_t todo = slot_mask[k];
+    while (todo != 0u)
+    {
+      uint32_t pick = 0;
+      for (uint32_t i = 0; i < n; i++)
+      {
+        if ((todo & (1u << i)) != 0u &&
+            ((todo & (1u << pick)) == 0u || len[i] > len[pick]))
+        {
+          pick = i;
+        }
+      }
+      plan->offset_us[pick] = earliest_start(plan, len, placed, pick);
+      placed |= 1u << pick;
+      todo &= ~(1u << pick);
+    }
+  }
+
+  /* 周期：自身间隔、窗口在周期内结束、跨周期不与干扰方重叠 */
+  uint32_t cycle = cfg->min_cycle_us;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    cycle = max_u32(cycle, len[i]);
+    cycle = max_u32(cycle, plan->offset_us[i] + cfg->dither_us +
+                               sensors[i].window_us);
+    for (uint32_t j = 0; j < n; j++)
+    {
+      uint32_t end_j = plan->offset_us[j] + len[j];
+      if ((plan->conflict[i] & (1u << j)) != 0u && end_j > plan->offset_us[i])
+      {
+        cycle = max_u32(cycle, end_j - plan->offset_us[i]);
+      }
+    }
+  }
+  plan->cycle_us = cycle;
+  plan->serial_us = max_u32(plan->serial_us, cfg->min_cycle_us);
+  plan->slotted_us = max_u32(plan->slotted_us, cfg->min_cycle_us);
+  return true;
+}
+
+void ser_ultrasonic_gate_init(ser_ultrasonic_gate_t *g)
+{
+  for (uint32_t i = 0; i < SER_ULTRASONIC_GATE_AGREE; i++)
+  {
+    g->hist[i] = -1;
+  }
+  g->rejected = 0;
+}
+
+bool ser_ultrasonic_gate(ser_ultrasonic_gate_t *g, int32_t raw_mm,
+                         int32_t max_mm, uint32_t tol_mm)
+{
+  if (raw_mm > max_mm)
+  {
+    raw_mm = -1;
+  }
+
+  int32_t lo = raw_mm;
+  int32_t hi = raw_mm;
+  for (uint32_t i = SER_ULTRASONIC_GATE_AGREE - 1u; i > 0u; i--)
+  {
+    g->hist[i] = g->hist[i - 1u];
+    if (g->hist[i] < lo)
+    {
+      lo = g->hist[i];
+    }
+    if (g->hist[i] > hi)
+    {
+      hi = g->hist[i];
+    }
+  }
+  g->hist[0] = raw_mm;
+
+  if (raw_mm < 0)
+  {
+    return false;
+  }
+  if (lo < 0 || (uint32_t)(hi - lo) > tol_mm)
+  {
+    g->rejected++;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * services/ 层：多路超声波排程与串扰门限（与平台无关，主机/MCU 共用）
+ *
+ * 问题：
+ * - 超声波模块的接收端不区分“自己的回波”和“别人的发射”：
+ *   两个互相听得见的模块同时工作，先到的那个声波就结束了 ECHO 脉冲
+ * - 全部轮流测（一次一个）最安全，但总采样率 = 1 / 各窗口之和
+ *
+ * 干扰模型：
+ * - 朝向按 SER_ULTRASONIC_SECTORS 等分（扇区 0..N-1，环形）；扇区距离不超过 spread
+ *   且频率组（载频）相同的两路视为互相干扰，其它组合可以同时工作
+ * - 每路的占用区间 = 触发抖动上限 + 回波窗口 + 保护时间（多径余响衰减）
+ *
+ * 排程（ser_ultrasonic_plan_build，n <= SER_ULTRASONIC_PLAN_MAX，初始化时算一次）：
+ * 1. 时隙划分：把传感器分成若干互不干扰的组（同组同时发射），
+ *    时隙长 = 组内最长占用区间；对全部子集做动态规划，求时隙总长最小的划分（O(3^n)）
+ * 2. 压缩：按时隙顺序逐个放置，每路取“与已放置的干扰方区间都不重叠”的最早起点，
+ *    短窗口的传感器可以提前进入下一组的空隙（回波窗口在几何允许处重叠）
+ * 3. 周期：满足首尾衔接（下一周期的起点不早于干扰方本周期区间结束）、
+ *    每路回波窗口在本周期内结束、以及模块自身的最小触发间隔
+ *
+ * 串扰门限（ser_ultrasonic_gate）：
+ * - 模型之外的串扰（反射、模型偏差）用触发抖动识别：每次触发随机延迟 0..dither，
+ *   别人的声波相对自己触发时刻的到达时间随之随机变化，真实回波不变
+ * - 连续 SER_ULTRASONIC_GATE_AGREE 次原始读数两两相差不超过 tol 才输出，
+ *   超出窗口（超量程/被后续发射截断）的读数直接判无效
+ */
+
+#define SER_ULTRASONIC_PLAN_MAX 8u
+
+#ifndef SER_ULTRASONIC_SECTORS
+#define SER_ULTRASONIC_SECTORS 8u
+#endif
+
+typedef struct
+{
+  uint32_t window_us; /* 回波窗口：ECHO 拉高延迟 + 最远量程往返 */
+  uint8_t sector;     /* 朝向扇区 */
+  uint8_t group;      /* 频率组：不同组互不干扰 */
+} ser_ultrasonic_sensor_t;
+
+typedef struct
+{
+  uint32_t dither_us; /* 触发抖动上限 */
+  uint32_t guard_us;  /* 窗口结束后到干扰方下一次发射的保护时间 */
+  uint32_t min_cycle_us; /* 同一模块两次触发的最小间隔（无回波时 ECHO 超时） */
+  uint8_t spread;        /* 扇区距离 <= spread 视为互相干扰 */
+} ser_ultrasonic_plan_cfg_t;
+
+typedef struct
+{
+  uint8_t n;
+  uint8_t slots;                                  /* 时隙数（压缩前） */
+  uint8_t conflict[SER_ULTRASONIC_PLAN_MAX];      /* 干扰位图（不含自身） */
+  uint32_t offset_us[SER_ULTRASONIC_PLAN_MAX];    /* 周期内的触发起点 */
+  uint32_t cycle_us;                              /* 周期 */
+  uint32_t slotted_us;  /* 只做时隙划分时的周期 */
+  uint32_t serial_us;   /* 全部轮流测时的周期 */
+} ser_ultrasonic_plan_t;
+
+/* 干扰判定（对称） */
+bool ser_ultrasonic_plan_conflicts(const ser_ultrasonic_sensor_t *a,
+                                   const ser_ultrasonic_sensor_t *b,
+                                   uint8_t spread);
+
+/* 生成排程；n 为 0 或超过上限返回 false。内部用静态工作区，不可重入 */
+bool ser_ultrasonic_plan_build(const ser_ultrasonic_sensor_t *sensors,
+                               uint32_t n, const ser_ultrasonic_plan_cfg_t *cfg,
+                               ser_ultrasonic_plan_t *plan);
+
+/* ---- 串扰门限 ---- */
+
+#ifndef SER_ULTRASONIC_GATE_AGREE
+#define SER_ULTRASONIC_GATE_AGREE 3u
+#endif
+
+typedef struct
+{
+  int32_t hist[SER_ULTRASONIC_GATE_AGREE]; /* 最近的原始读数，-1 为无效 */
+  uint32_t rejected;                       /* 有读数但未通过门限的次数 */
+} ser_ultrasonic_gate_t;
+
+void ser_ultrasonic_gate_init(ser_ultrasonic_gate_t *g);
+
+/*
+ * 输入一次原始读数（mm，-1 为无回波）与该路回波窗口对应的最远距离；
+ * 通过返回 true（输出即 raw_mm），否则返回 false
+ */
+bool ser_ultrasonic_gate(ser_ultrasonic_gate_t *g, int32_t raw_mm,
+                         int32_t max_mm, uint32_t tol_mm);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
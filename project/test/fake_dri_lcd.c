@@ -0,0 +1,164 @@
+#include "fake_dri_lcd.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dri_dma2d.h"
+
+fake_dri_lcd_t g_fake_lcd;
+
+uint32_t dri_lcd_fb_bytes_per_pixel(dri_lcd_fb_format_t fmt)
+{
+  switch (fmt)
+  {
+  case DRI_LCD_FB_ARGB8888:
+    return 4u;
+  case DRI_LCD_FB_L8:
+    return 1u;
+  default:
+    return 2u;
+  }
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_init(const dri_lcd_ltdc_cfg_t *cfg)
+{
+  free(g_fake_lcd.fb);
+  memset(&g_fake_lcd, 0, sizeof(g_fake_lcd));
+  g_fake_lcd.cfg = *cfg;
+  g_fake_lcd.fb = calloc((size_t)cfg->width * cfg->height,
+                         dri_lcd_fb_bytes_per_pixel(cfg->fb_format));
+  return (g_fake_lcd.fb != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_load_clut(uint32_t layer_idx,
+                                         const uint32_t *clut, uint32_t n)
+{
+  if (layer_idx > DRI_LCD_LAYER_1 || clut == NULL || n == 0u ||
+      n > DRI_LCD_CLUT_MAX)
+  {
+    return HAL_ERROR;
+  }
+  memcpy(g_fake_lcd.clut[layer_idx], clut, n * sizeof(uint32_t));
+  g_fake_lcd.clut_n[layer_idx] = n;
+  g_fake_lcd.clut_loads++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_layer_config(uint32_t layer_idx,
+                                            const dri_lcd_ltdc_layer_cfg_t *cfg)
+{
+  (void)layer_idx;
+  (void)cfg;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_layer_disable(uint32_t layer_idx)
+{
+  (void)layer_idx;
+  return HAL_OK;
+}
+
+void dri_lcd_ltdc_enable(bool on)
+{
+  (void)on;
+}
+
+dri_lcd_fb_format_t dri_lcd_fb_format(void)
+{
+  return g_fake_lcd.cfg.fb_format;
+}
+
+void dri_lcd_fill_raw(uint32_t value)
+{
+  const uint32_t n = g_fake_lcd.cfg.width * g_fake_lcd.cfg.height;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    switch (dri_lcd_fb_bytes_per_pixel(g_fake_lcd.cfg.fb_format))
+    {
+    case 1u:
+      g_fake_lcd.fb[i] = (uint8_t)value;
+      break;
+    case 4u:
+      ((uint32_t *)g_fake_lcd.fb)[i] = value;
+      break;
+    default:
+      ((uint16_t *)g_fake_lcd.fb)[i] = (uint16_t)value;
+      break;
+    }
+  }
+}
+
+void *dri_lcd_framebuffer(void)
+{
+  return g_fake_lcd.fb;
+}
+
+HAL_StatusTypeDef dri_lcd_ltdc_scan_pos(dri_lcd_ltdc_scan_t *out)
+{
+  (void)out;
+  return HAL_ERROR;
+}
+
+uint32_t dri_lcd_ltdc_pixel_clock_hz(void)
+{
+  return 0u;
+}
+
+/* 地址在 64 位主机上只有低 32 位，按帧缓冲所在的高位补全 */
+static uint16_t *host_ptr(uint32_t addr, const void *near)
+{
+  return (uint16_t *)(((uintptr_t)near & ~(uintptr_t)0xFFFFFFFFu) | addr);
+}
+
+HAL_StatusTypeDef dri_dma2d_copy_rgb565(uint32_t dst_addr, uint32_t src_addr,
+                                        uint16_t width, uint16_t height,
+                                        uint16_t dst_offset,
+                                        uint16_t src_offset)
+{
+  if (!g_fake_lcd.dma2d_on)
+  {
+    return HAL_ERROR;
+  }
+  g_fake_lcd.dma2d_calls++;
+
+  uint32_t rows;
+  switch (g_fake_lcd.dma2d_result)
+  {
+  case HAL_OK:
+    rows = height;
+    break;
+  case HAL_TIMEOUT:
+    rows = height / 2u;
+    break;
+  default:
+    return g_fake_lcd.dma2d_result;
+  }
+
+  /* DMA2D 的顺序：逐行、行内从左到右 */
+  uint16_t *dst = host_ptr(dst_addr, &g_fake_lcd);
+  const uint16_t *src = host_ptr(src_addr, &g_fake_lcd);
+  for (uint32_t y = 0; y < rows; y++)
+  {
+    for (uint32_t x = 0; x < width; x++)
+    {
+      dst[x] = src[x];
+    }
+    dst += width + dst_offset;
+    src += width + src_offset;
+  }
+  return g_fake_lcd.dma2d_result;
+}
+
+HAL_StatusTypeDef dri_dma2d_fill_loop_start(uint32_t dst_addr, uint16_t width,
+                                            uint16_t height, uint32_t argb8888)
+{
+  (void)dst_addr;
+  (void)width;
+  (void)height;
+  (void)argb8888;
+  return HAL_ERROR;
+}
+
+void dri_dma2d_fill_loop_stop(void)
+{
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * 主机测试用的 dri_lcd_ltdc / dri_dma2d 替身（fake_dri_lcd.c）
+ *
+ * - dri_lcd_ltdc_init 按配置在主机内存中分配帧缓冲（framebuffer_addr 被忽略）
+ * - dri_lcd_ltdc_load_clut 记录装载到各图层的 CLUT，测试直接比对
+ * - DMA2D 默认返回 HAL_ERROR（未启动），dev_lcd 走 CPU 路径；
+ *   dma2d_on 置位后拷贝按 dma2d_result 模拟：HAL_OK 整块拷贝，
+ *   HAL_TIMEOUT 只搬了前一半行就中止，其它值不动目的区域
+ *   （dri_lcd_ltdc_init 会清零这些字段）
+ */
+
+#include "dri_lcd_ltdc.h"
+
+typedef struct
+{
+  dri_lcd_ltdc_cfg_t cfg;
+  uint8_t *fb;
+  uint32_t clut[2][DRI_LCD_CLUT_MAX];
+  uint32_t clut_n[2];
+  uint32_t clut_loads;
+  bool dma2d_on;
+  HAL_StatusTypeDef dma2d_result;
+  uint32_t dma2d_calls;
+} fake_dri_lcd_t;
+
+extern fake_dri_lcd_t g_fake_lcd;
@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+ * 主机测试公共宏（project/test，不进固件）
+ *
+ * - TEST_CHECK 失败时打印位置并计数，不中断；前 20 条之后只计数
+ * - main 以 return test_done(); 结束：打印结果，失败返回 1（ctest 判失败）
+ * - 基准用 test_now_ns 计时；xorshift 随机数保证每次运行序列相同
+ * - test_fork 在子进程中跑一个场景：LVGL 与各服务的静态状态每次从头开始
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static int s_test_fails = 0;
+
+#define TEST_CHECK(cond)                                                       \
+  do                                                                           \
+  {                                                                            \
+    if (!(cond))                                                               \
+    {                                                                          \
+      if (s_test_fails++ < 20)                                                 \
+      {                                                                        \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);                 \
+      }                                                                        \
+    }                                                                          \
+  } while (0)
+
+static inline int test_done(void)
+{
+  printf("%s (%d failed checks)\n", (s_test_fails != 0) ? "FAIL" : "OK",
+         s_test_fails);
+  return (s_test_fails != 0) ? 1 : 0;
+}
+
+static inline uint64_t test_now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t s_test_rng = 0x9E3779B97F4A7C15ull;
+
+static inline void test_seed(uint64_t seed)
+{
+  s_test_rng = (seed != 0u) ? seed : 0x9E3779B97F4A7C15ull;
+}
+
+static inline uint64_t test_rand(void)
+{
+  s_test_rng ^= s_test_rng << 13;
+  s_test_rng ^= s_test_rng >> 7;
+  s_test_rng ^= s_test_rng << 17;
+  return s_test_rng;
+}
+
+/* [0, n) */
+static inline uint32_t test_rand_n(uint32_t n)
+{
+  return (n != 0u) ? (uint32_t)(test_rand() % n) : 0u;
+}
+
+/*
+ * 子进程中运行 fn(arg)，结束时把 out 指向的 size 字节（子进程里的值）经管道带回
+ * 子进程异常退出或结果不完整时返回 false
+ */
+static inline bool test_fork(void (*fn)(void *arg), void *arg, void *out,
+                             size_t size)
+{
+  int fds[2];
+  if (pipe(fds) != 0)
+  {
+    return false;
+  }
+
+  const pid_t pid = fork();
+  if (pid == 0)
+  {
+    close(fds[0]);
+    fn(arg);
+    const ssize_t n = write(fds[1], out, size);
+    _exit((n == (ssize_t)size) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  size_t got = 0;
+  while (pid > 0 && got < size)
+  {
+    const ssize_t n = read(fds[0], (unsigned char *)out + got, size - got);
+    if (n <= 0)
+    {
+      break;
+    }
+    got += (size_t)n;
+  }
+  close(fds[0]);
+
+  int status = 0;
+  if (pid > 0)
+  {
+    (void)waitpid(pid, &status, 0);
+  }
+  return got == size && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
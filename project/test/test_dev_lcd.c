@@ -0,0 +1,366 @@
+/*
+ * dev_lcd 像素格式转换（主机测试）
+ *
+ * 同一源文件按 LCD_FB_FORMAT 编两次：
+ * - L8：默认 RGB332 调色板与自定义 16 色调色板下，测试图经 dev_lcd_flush_rgb565
+ *   量化后的索引图与 golden/ 下的金样逐字节比对；CLUT 装载内容、全部 65536 个
+ *   RGB565 颜色的反查表结果（对照暴力最近色搜索）、读回还原
+ * - ARGB4444：写入/读回的分量截断与扩展
+ * 两次都查 dev_lcd_copy_rgb565（重叠上移）：DMA2D 完成、没能启动（CPU 补拷）
+ * 都得到正确结果；传输中途失败返回 false，且不再用 CPU 补拷
+ *
+ * 量化规则有意改变时用 --update 重新生成金样（并检查差异后随代码一起提交）
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "dev_lcd.h"
+#include "dev_lcd_panel.h"
+#include "fake_dri_lcd.h"
+#include "test.h"
+
+#define IMG_W 128u
+#define IMG_H 96u
+
+static uint16_t s_img[IMG_W * IMG_H];
+static bool s_update = false;
+
+static uint16_t rgb888_to_565(uint32_t r, uint32_t g, uint32_t b)
+{
+  return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+/*
+ * 测试图：四条 R/G/B/灰度渐变带、色相环扫描、随机色块；
+ * 覆盖调色板边界两侧的颜色与大量不落在调色板上的颜色
+ */
+static void make_test_image(void)
+{
+  for (uint32_t y = 0; y < IMG_H; y++)
+  {
+    for (uint32_t x = 0; x < IMG_W; x++)
+    {
+      const uint32_t v = x * 255u / (IMG_W - 1u);
+      uint16_t c;
+      if (y < 8u)
+      {
+        c = rgb888_to_565(v, 0, 0);
+      }
+      else if (y < 16u)
+      {
+        c = rgb888_to_565(0, v, 0);
+      }
+      else if (y < 24u)
+      {
+        c = rgb888_to_565(0, 0, v);
+      }
+      else if (y < 32u)
+      {
+        c = rgb888_to_565(v, v, v);
+      }
+      else if (y < 64u)
+      {
+        /* 色相 x，亮度随 y 递减 */
+        const uint32_t h = x * 6u * 256u / IMG_W;
+        const uint32_t f = h & 0xFFu;
+        const uint32_t l = 255u - (y - 32u) * 6u;
+        uint32_t r, g, b;
+        switch (h >> 8)
+        {
+        case 0:
+          r = 255u, g = f, b = 0u;
+          break;
+        case 1:
+          r = 255u - f, g = 255u, b = 0u;
+          break;
+        case 2:
+          r = 0u, g = 255u, b = f;
+          break;
+        case 3:
+          r = 0u, g = 255u - f, b = 255u;
+          break;
+        case 4:
+          r = f, g = 0u, b = 255u;
+          break;
+        default:
+          r = 255u, g = 0u, b = 255u - f;
+          break;
+        }
+        c = rgb888_to_565(r * l / 255u, g * l / 255u, b * l / 255u);
+      }
+      else
+      {
+        c = (uint16_t)test_rand();
+      }
+      s_img[y * IMG_W + x] = c;
+    }
+  }
+}
+
+#if LCD_FB_FORMAT == LCD_FB_FMT_L8
+
+/* 16 色调色板（非规则分布，逼出最近色搜索的各个分支） */
+static const uint32_t s_pal16[16] = {
+    0x000000u, 0x1D2B53u, 0x7E2553u, 0x008751u, 0xAB5236u, 0x5F574Fu,
+    0xC2C3C7u, 0xFFF1E8u, 0xFF004Du, 0xFFA300u, 0xFFEC27u, 0x00E436u,
+    0x29ADFFu, 0x83769Cu, 0xFF77A8u, 0xFFCCAAu,
+};
+
+/* 与 dev_lcd 相同的键值中心与 2:4:1 加权距离，逐项暴力搜索 */
+static uint8_t nearest_ref(uint16_t c, const uint32_t *pal, uint32_t n)
+{
+  const int32_t r = (int32_t)((c >> 12) & 0x0Fu) * 17;
+  const int32_t g = (int32_t)((c >> 7) & 0x0Fu) * 17;
+  const int32_t b = (int32_t)((c >> 1) & 0x0Fu) * 17;
+  uint32_t best = 0, best_d = 0xFFFFFFFFu;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    const int32_t dr = r - (int32_t)((pal[i] >> 16) & 0xFFu);
+    const int32_t dg = g - (int32_t)((pal[i] >> 8) & 0xFFu);
+    const int32_t db = b - (int32_t)(pal[i] & 0xFFu);
+    const uint32_t d = (uint32_t)(2 * dr * dr + 4 * dg * dg + db * db);
+    if (d < best_d)
+    {
+      best_d = d;
+      best = i;
+    }
+  }
+  return (uint8_t)best;
+}
+
+/* 金样为 PGM（P5），像素值即 L8 索引 */
+static void check_golden(const char *name, const uint8_t *px)
+{
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%s", TEST_GOLDEN_DIR, name);
+
+  if (s_update)
+  {
+    FILE *f = fopen(path, "wb");
+    TEST_CHECK(f != NULL);
+    if (f != NULL)
+    {
+      fprintf(f, "P5\n%u %u\n255\n", IMG_W, IMG_H);
+      TEST_CHECK(fwrite(px, 1u, IMG_W * IMG_H, f) == IMG_W * IMG_H);
+      fclose(f);
+      printf("updated %s\n", path);
+    }
+    return;
+  }
+
+  static uint8_t gold[IMG_W * IMG_H];
+  unsigned w = 0, h = 0, maxv = 0;
+  FILE *f = fopen(path, "rb");
+  TEST_CHECK(f != NULL);
+  if (f == NULL)
+  {
+    return;
+  }
+  TEST_CHECK(fscanf(f, "P5 %u %u %u", &w, &h, &maxv) == 3);
+  (void)fgetc(f);
+  TEST_CHECK(w == IMG_W && h == IMG_H && maxv == 255u);
+  TEST_CHECK(fread(gold, 1u, sizeof(gold), f) == sizeof(gold));
+  fclose(f);
+
+  uint32_t diff = 0;
+  for (uint32_t i = 0; i < IMG_W * IMG_H; i++)
+  {
+    diff += (gold[i] != px[i]);
+  }
+  if (diff != 0u)
+  {
+    printf("%s: %u px differ from golden\n", name, diff);
+  }
+  TEST_CHECK(diff == 0u);
+}
+
+/* 测试图写进帧缓冲左上角，取出索引图 */
+static void flush_image(uint8_t *out)
+{
+  dev_lcd_flush_rgb565(0, 0, IMG_W - 1, IMG_H - 1, s_img);
+  const uint8_t *fb = (const uint8_t *)dev_lcd_framebuffer();
+  for (uint32_t y = 0; y < IMG_H; y++)
+  {
+    memcpy(out + y * IMG_W, fb + y * dev_lcd_width(), IMG_W);
+  }
+}
+
+static void check_readback(const uint32_t *pal)
+{
+  uint16_t row[IMG_W];
+  const uint8_t *fb = (const uint8_t *)dev_lcd_framebuffer();
+  for (uint32_t y = 0; y < IMG_H; y += 7u)
+  {
+    TEST_CHECK(dev_lcd_read_rgb565(0, (int32_t)y, IMG_W - 1, row));
+    for (uint32_t x = 0; x < IMG_W; x++)
+    {
+      const uint32_t c = pal[fb[y * dev_lcd_width() + x]];
+      TEST_CHECK(row[x] == rgb888_to_565(c >> 16, (c >> 8) & 0xFFu,
+                                         c & 0xFFu));
+    }
+  }
+}
+
+static void test_l8(void)
+{
+  static uint8_t idx[IMG_W * IMG_H];
+  static uint32_t rgb332[256];
+
+  TEST_CHECK(dev_lcd_init() == HAL_OK);
+  TEST_CHECK(!dev_lcd_is_native_rgb565());
+  TEST_CHECK(dev_lcd_bytes_per_pixel() == 1u);
+
+  /* 默认 RGB332：CLUT 为各分量等分，索引即分量高位截取 */
+  TEST_CHECK(g_fake_lcd.clut_n[DRI_LCD_LAYER_0] == 256u);
+  for (uint32_t i = 0; i < 256u; i++)
+  {
+    rgb332[i] = (((i >> 5) * 255u / 7u) << 16) |
+                ((((i >> 2) & 7u) * 255u / 7u) << 8) | ((i & 3u) * 255u / 3u);
+    TEST_CHECK(g_fake_lcd.clut[DRI_LCD_LAYER_0][i] == rgb332[i]);
+  }
+  TEST_CHECK(rgb332[0x00] == 0x000000u && rgb332[0xFF] == 0xFFFFFFu &&
+             rgb332[0xE0] == 0xFF0000u && rgb332[0x1C] == 0x00FF00u &&
+             rgb332[0x03] == 0x0000FFu);
+  for (uint32_t c = 0; c < 0x10000u; c++)
+  {
+    const uint8_t want = (uint8_t)(((c >> 13) << 5) | (((c >> 8) & 7u) << 2) |
+                                   ((c >> 3) & 3u));
+    TEST_CHECK(dev_lcd_quantize_rgb565((uint16_t)c) == want);
+  }
+
+  flush_image(idx);
+  check_golden("lcd_l8_rgb332.pgm", idx);
+  check_readback(rgb332);
+
+  /* 自定义调色板：装载到 CLUT，反查表与暴力搜索一致 */
+  TEST_CHECK(dev_lcd_set_palette(NULL, 16u) != HAL_OK);
+  TEST_CHECK(dev_lcd_set_palette(s_pal16, 0u) != HAL_OK);
+  TEST_CHECK(dev_lcd_set_palette(s_pal16, DRI_LCD_CLUT_MAX + 1u) != HAL_OK);
+  const uint32_t loads = g_fake_lcd.clut_loads;
+  TEST_CHECK(dev_lcd_set_palette(s_pal16, 16u) == HAL_OK);
+  TEST_CHECK(g_fake_lcd.clut_loads == loads + 1u);
+  TEST_CHECK(g_fake_lcd.clut_n[DRI_LCD_LAYER_0] == 16u);
+  TEST_CHECK(memcmp(g_fake_lcd.clut[DRI_LCD_LAYER_0], s_pal16,
+                    sizeof(s_pal16)) == 0);
+  for (uint32_t c = 0; c < 0x10000u; c++)
+  {
+    TEST_CHECK(dev_lcd_quantize_rgb565((uint16_t)c) ==
+               nearest_ref((uint16_t)c, s_pal16, 16u));
+  }
+
+  flush_image(idx);
+  check_golden("lcd_l8_pal16.pgm", idx);
+  check_readback(s_pal16);
+}
+
+#elif LCD_FB_FORMAT == LCD_FB_FMT_ARGB4444
+
+static void test_argb4444(void)
+{
+  TEST_CHECK(dev_lcd_init() == HAL_OK);
+  TEST_CHECK(!dev_lcd_is_native_rgb565());
+  TEST_CHECK(dev_lcd_bytes_per_pixel() == 2u);
+  TEST_CHECK(g_fake_lcd.clut_loads == 0u);
+
+  dev_lcd_flush_rgb565(0, 0, IMG_W - 1, IMG_H - 1, s_img);
+  const uint16_t *fb = (const uint16_t *)dev_lcd_framebuffer();
+  uint16_t row[IMG_W];
+  for (uint32_t y = 0; y < IMG_H; y++)
+  {
+    TEST_CHECK(dev_lcd_read_rgb565(0, (int32_t)y, IMG_W - 1, row));
+    for (uint32_t x = 0; x < IMG_W; x++)
+    {
+      /* 不透明，各分量取高 4 位；读回时 4 位复制到高低位 */
+      const uint16_t c = s_img[y * IMG_W + x];
+      const uint32_t r = c >> 12, g = (c >> 7) & 0xFu, b = (c >> 1) & 0xFu;
+      TEST_CHECK(fb[y * dev_lcd_width() + x] ==
+                 (uint16_t)(0xF000u | (r << 8) | (g << 4) | b));
+      TEST_CHECK(row[x] == rgb888_to_565(r * 17u, g * 17u, b * 17u));
+    }
+  }
+
+  /* 单色填充走同一转换 */
+  dev_lcd_fill_rgb565(LCD_COLOR_RED_RGB565);
+  TEST_CHECK(fb[0] == 0xFF00u);
+  TEST_CHECK(fb[dev_lcd_width() * dev_lcd_height() - 1u] == 0xFF00u);
+}
+
+#endif
+
+#define COPY_STRIDE 40u
+#define COPY_ROWS 30u
+
+static uint16_t s_copy[COPY_STRIDE * COPY_ROWS];
+static uint16_t s_copy_orig[COPY_STRIDE * COPY_ROWS];
+static uint16_t s_copy_ref[COPY_STRIDE * COPY_ROWS];
+
+/* 20x10 的矩形上移 4 行、左移 3 列（源与目的重叠，目的地址较低） */
+static bool copy_once(void)
+{
+  memcpy(s_copy, s_copy_orig, sizeof(s_copy));
+  return dev_lcd_copy_rgb565(&s_copy[8u * COPY_STRIDE + 5u],
+                             &s_copy[12u * COPY_STRIDE + 8u], 20u, 10u,
+                             COPY_STRIDE);
+}
+
+static void test_copy(void)
+{
+  for (uint32_t i = 0; i < COPY_STRIDE * COPY_ROWS; i++)
+  {
+    s_copy_orig[i] = (uint16_t)(i * 2654435761u >> 16);
+  }
+  memcpy(s_copy_ref, s_copy_orig, sizeof(s_copy_ref));
+  for (uint32_t y = 0; y < 10u; y++)
+  {
+    memmove(&s_copy_ref[(8u + y) * COPY_STRIDE + 5u],
+            &s_copy_ref[(12u + y) * COPY_STRIDE + 8u], 20u * sizeof(uint16_t));
+  }
+
+  /* 默认替身：DMA2D 不可用，CPU 拷贝 */
+  TEST_CHECK(copy_once());
+  TEST_CHECK(memcmp(s_copy, s_copy_ref, sizeof(s_copy)) == 0);
+
+  static const HAL_StatusTypeDef not_started[] = {HAL_OK, HAL_BUSY, HAL_ERROR};
+  g_fake_lcd.dma2d_on = true;
+  for (uint32_t i = 0; i < 3u; i++)
+  {
+    g_fake_lcd.dma2d_result = not_started[i];
+    const uint32_t calls = g_fake_lcd.dma2d_calls;
+    TEST_CHECK(copy_once());
+    TEST_CHECK(g_fake_lcd.dma2d_calls == calls + 1u);
+    TEST_CHECK(memcmp(s_copy, s_copy_ref, sizeof(s_copy)) == 0);
+  }
+
+  /* 中途失败：前 5 行已搬，后 5 行保持原样（没有 CPU 补拷） */
+  g_fake_lcd.dma2d_result = HAL_TIMEOUT;
+  TEST_CHECK(!copy_once());
+  TEST_CHECK(memcmp(s_copy, s_copy_ref, 13u * COPY_STRIDE * sizeof(uint16_t)) ==
+             0);
+  TEST_CHECK(memcmp(&s_copy[13u * COPY_STRIDE], &s_copy_orig[13u * COPY_STRIDE],
+                    (COPY_ROWS - 13u) * COPY_STRIDE * sizeof(uint16_t)) == 0);
+  g_fake_lcd.dma2d_on = false;
+
+  /* 参数无效 */
+  TEST_CHECK(!dev_lcd_copy_rgb565(s_copy, s_copy, 41u, 1u, COPY_STRIDE));
+  TEST_CHECK(!dev_lcd_copy_rgb565(s_copy, NULL, 1u, 1u, COPY_STRIDE));
+}
+
+int main(int argc, char **argv)
+{
+  s_update = (argc > 1 && strcmp(argv[1], "--update") == 0);
+  make_test_image();
+
+#if LCD_FB_FORMAT == LCD_FB_FMT_L8
+  test_l8();
+#elif LCD_FB_FORMAT == LCD_FB_FMT_ARGB4444
+  test_argb4444();
+#endif
+  test_copy();
+
+  /* 越界写入整块丢弃，越界读回失败 */
+  uint16_t px[4] = {0};
+  dev_lcd_flush_rgb565((int32_t)dev_lcd_width() - 1, 0,
+                       (int32_t)dev_lcd_width(), 1, px);
+  TEST_CHECK(!dev_lcd_read_rgb565(0, (int32_t)dev_lcd_height(), 0, px));
+  return test_done();
+}
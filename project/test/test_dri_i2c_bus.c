@@ -0,0 +1,632 @@
+/*
+ * drivers/dri_i2c_bus：队列化 I2C 总线状态机 + 模拟从机
+ *
+ * 模拟 port（DRI_I2C_BUS_HOST=1）：
+ * - 虚拟时钟 1 tick = 1us；每段传输耗时 20us + 每字节 10us，在 poll 中推进并完成
+ * - 从机：0x50 为 8 位寄存器地址的 EEPROM，0x5D 为 16 位寄存器地址（GT9xx 风格），
+ *   其它地址 NACK；可注入下一段 FAULT（BERR/ARLO）或卡死（不完成，靠超时）
+ *
+ * 场景：
+ * - 各操作与寄存器地址宽度；优先级（同级 FIFO）；chain 不让出总线、中途失败即停
+ * - 故障/超时后下一次传输前恢复；排队中的请求超时出队；取消排队/传输中的请求
+ * - done 回调里重新提交；HOLD 探测；按器件统计
+ * - 随机压力：异步提交随机优先级的读写并随机注入故障/卡死，检查每个请求恰好完成一次、
+ *   启动时队列中没有更高优先级的请求、从机内容与参考模型一致
+ * - 基准：每段传输的状态机开销（主机）
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dri_i2c_bus.h"
+
+#define ADDR_EE 0x50u
+#define ADDR_TP 0x5Du
+#define ADDR_NONE 0x33u
+#define EE_SIZE 256u
+#define TP_SIZE 0x1000u
+#define HANG_US 1000000u
+
+#define STRESS_REQS 64u
+#define STRESS_ROUNDS 20000u
+#define BENCH_XFERS 200000u
+
+typedef struct
+{
+  uint32_t now;
+  const dri_i2c_req_t *cur;
+  uint32_t t_end;
+  bool fault_next;
+  bool hang_next;
+  bool recover_fail;
+  uint32_t starts;
+  uint32_t aborts;
+  uint32_t recovers;
+  uint32_t probes;
+  uint16_t order[64];
+  uint32_t order_n;
+  uint8_t ee[EE_SIZE];
+  uint8_t tp[TP_SIZE];
+} sim_t;
+
+static sim_t s_sim;
+static dri_i2c_bus_t s_bus;
+static uint32_t s_prio_violations;
+
+static uint8_t *slave_mem(uint16_t addr, uint32_t *size)
+{
+  if (addr == ADDR_EE)
+  {
+    *size = EE_SIZE;
+    return s_sim.ee;
+  }
+  if (addr == ADDR_TP)
+  {
+    *size = TP_SIZE;
+    return s_sim.tp;
+  }
+  return NULL;
+}
+
+/* 一段传输在从机上的效果；越界按 NACK */
+static dri_i2c_result_t slave_apply(const dri_i2c_req_t *s)
+{
+  uint32_t size = 0;
+  uint8_t *mem = slave_mem(s->addr, &size);
+  if (mem == NULL)
+  {
+    return DRI_I2C_NACK;
+  }
+
+  uint32_t reg;
+  switch ((dri_i2c_op_t)s->op)
+  {
+  case DRI_I2C_OP_MEM_READ:
+    reg = s->mem_addr;
+    if (reg + s->rlen > size)
+      return DRI_I2C_NACK;
+    memcpy(s->rbuf, &mem[reg], s->rlen);
+    return DRI_I2C_OK;
+  case DRI_I2C_OP_MEM_WRITE:
+    reg = s->mem_addr;
+    if (reg + s->wlen > size)
+      return DRI_I2C_NACK;
+    memcpy(&mem[reg], s->wbuf, s->wlen);
+    return DRI_I2C_OK;
+  case DRI_I2C_OP_WRITE_READ:
+    /* wbuf 为寄存器地址（大端，长度即地址宽度） */
+    reg = (s->wlen == 2u) ? ((uint32_t)s->wbuf[0] << 8 | s->wbuf[1])
+                          : s->wbuf[0];
+    if (reg + s->rlen > size)
+      return DRI_I2C_NACK;
+    memcpy(s->rbuf, &mem[reg], s->rlen);
+    return DRI_I2C_OK;
+  case DRI_I2C_OP_WRITE:
+    /* 首字节寄存器地址，其余写入 */
+    reg = s->wbuf[0];
+    if (reg + s->wlen - 1u > size)
+      return DRI_I2C_NACK;
+    memcpy(&mem[reg], &s->wbuf[1], s->wlen - 1u);
+    return DRI_I2C_OK;
+  case DRI_I2C_OP_READ:
+    memcpy(s->rbuf, mem, s->rlen);
+    return DRI_I2C_OK;
+  default:
+    return DRI_I2C_NACK;
+  }
+}
+
+static dri_i2c_result_t sim_start(void *ctx, const dri_i2c_req_t *s)
+{
+  sim_t *sim = (sim_t *)ctx;
+  TEST_CHECK(sim->cur == NULL); /* 同一时刻只有一段在传输 */
+  sim->cur = s;
+  sim->starts++;
+
+  /* 启动时队列里不应有比当前链首优先级更高的请求 */
+  for (const dri_i2c_req_t *q = s_bus.queue; q != NULL; q = q->next)
+  {
+    s_prio_violations += (q->prio > s_bus.active->prio) ? 1u : 0u;
+  }
+  sim->t_end = sim->now + (sim->hang_next ? HANG_US
+                                          : 20u + 10u * (s->wlen + s->rlen));
+  sim->hang_next = false;
+  if (sim->order_n < 64u)
+  {
+    sim->order[sim->order_n++] = s->mem_addr;
+  }
+  return DRI_I2C_OK;
+}
+
+static void sim_abort(void *ctx)
+{
+  sim_t *sim = (sim_t *)ctx;
+  sim->cur = NULL;
+  sim->aborts++;
+}
+
+static bool sim_recover(void *ctx)
+{
+  sim_t *sim = (sim_t *)ctx;
+  sim->recovers++;
+  return !sim->recover_fail;
+}
+
+static dri_i2c_result_t sim_probe(void *ctx, uint16_t addr, uint32_t trials,
+                                  uint32_t timeout_us)
+{
+  (void)trials;
+  (void)timeout_us;
+  sim_t *sim = (sim_t *)ctx;
+  uint32_t size;
+  sim->probes++;
+  sim->now += 100u;
+  return (slave_mem(addr, &size) != NULL) ? DRI_I2C_OK : DRI_I2C_NACK;
+}
+
+static uint32_t sim_now(void *ctx)
+{
+  return ((sim_t *)ctx)->now;
+}
+
+/* 推进 1us；到点的传输完成（完成回调里可能启动下一段） */
+static void sim_poll(void *ctx)
+{
+  sim_t *sim = (sim_t *)ctx;
+  sim->now++;
+  if (sim->cur == NULL || (int32_t)(sim->now - sim->t_end) < 0)
+  {
+    return;
+  }
+
+  const dri_i2c_req_t *s = sim->cur;
+  sim->cur = NULL;
+  dri_i2c_result_t res;
+  if (sim->fault_next)
+  {
+    sim->fault_next = false;
+    res = DRI_I2C_FAULT;
+  }
+  else
+  {
+    res = slave_apply(s);
+  }
+  dri_i2c_bus_complete(&s_bus, res);
+}
+
+static const dri_i2c_bus_port_t s_port = {
+    .start = sim_start,
+    .abort = sim_abort,
+    .recover = sim_recover,
+    .probe = sim_probe,
+    .now = sim_now,
+    .poll = sim_poll,
+};
+
+static void reset(void)
+{
+  memset(&s_sim, 0, sizeof(s_sim));
+  s_sim.now = 0xFFFFF000u; /* 时钟回绕 */
+  dri_i2c_bus_init(&s_bus, &s_port, &s_sim, 1u);
+}
+
+static void run_until_idle(void)
+{
+  for (uint32_t i = 0; i < 10u * HANG_US; i++)
+  {
+    dri_i2c_bus_poll(&s_bus);
+    if (s_bus.active == NULL && s_bus.queue == NULL)
+    {
+      return;
+    }
+    sim_poll(&s_sim);
+  }
+  TEST_CHECK(false);
+}
+
+static void mem_req(dri_i2c_req_t *r, uint8_t op, uint16_t addr, uint16_t reg,
+                    uint8_t *buf, uint16_t len)
+{
+  memset(r, 0, sizeof(*r));
+  r->op = op;
+  r->addr = addr;
+  r->mem_addr = reg;
+  r->mem_addr_size = 1u;
+  if (op == DRI_I2C_OP_MEM_WRITE)
+  {
+    r->wbuf = buf;
+    r->wlen = len;
+  }
+  else
+  {
+    r->rbuf = buf;
+    r->rlen = len;
+  }
+}
+
+static uint32_t s_done_n;
+static void count_cb(dri_i2c_req_t *req, void *arg)
+{
+  (void)req;
+  (void)arg;
+  s_done_n++;
+}
+
+static void test_ops(void)
+{
+  reset();
+  uint8_t w[4] = {1, 2, 3, 4};
+  uint8_t r[4] = {0};
+
+  TEST_CHECK(dri_i2c_bus_mem_write(&s_bus, ADDR_EE, 0x10, 1, w, 4, 1000) ==
+             DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0x10, 1, r, 4, 1000) ==
+             DRI_I2C_OK);
+  TEST_CHECK(memcmp(r, w, 4) == 0);
+
+  /* 16 位寄存器地址 */
+  const uint8_t st = 0x81u;
+  TEST_CHECK(dri_i2c_bus_mem_write(&s_bus, ADDR_TP, 0x084Eu, 2, &st, 1,
+                                   1000) == DRI_I2C_OK);
+  const uint8_t reg[2] = {0x08u, 0x4Eu};
+  uint8_t v = 0;
+  TEST_CHECK(dri_i2c_bus_write_read(&s_bus, ADDR_TP, reg, 2, &v, 1, 1000) ==
+             DRI_I2C_OK);
+  TEST_CHECK(v == 0x81u);
+
+  /* 普通写：首字节寄存器地址 */
+  const uint8_t wr[3] = {0x20u, 0xAAu, 0xBBu};
+  TEST_CHECK(dri_i2c_bus_write(&s_bus, ADDR_EE, wr, 3, 1000) == DRI_I2C_OK);
+  TEST_CHECK(s_sim.ee[0x20] == 0xAAu && s_sim.ee[0x21] == 0xBBu);
+
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_NONE, 0, 1, r, 1, 1000) ==
+             DRI_I2C_NACK);
+
+  /* 参数错误 */
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0, 3, r, 1, 1000) ==
+             DRI_I2C_INVALID);
+  TEST_CHECK(dri_i2c_bus_write(&s_bus, ADDR_EE, NULL, 1, 1000) ==
+             DRI_I2C_INVALID);
+
+  /* 探测：HOLD 独占总线后调用 port->probe */
+  TEST_CHECK(dri_i2c_bus_probe(&s_bus, ADDR_TP, 1, 1000) == DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_probe(&s_bus, ADDR_NONE, 1, 1000) == DRI_I2C_NACK);
+  TEST_CHECK(s_sim.probes == 2u);
+
+  dri_i2c_dev_stats_t d;
+  TEST_CHECK(dri_i2c_bus_get_dev_stats(&s_bus, ADDR_NONE, &d));
+  TEST_CHECK(d.nacks == 2u && d.xfers == 2u);
+  TEST_CHECK(dri_i2c_bus_get_dev_stats(&s_bus, ADDR_EE, &d));
+  TEST_CHECK(d.xfers == 3u && d.nacks == 0u);
+  TEST_CHECK(d.lat_min_us == 50u && d.lat_max_us == 60u);
+  TEST_CHECK(!dri_i2c_bus_get_dev_stats(&s_bus, 0x11u, &d));
+}
+
+static void test_priority(void)
+{
+  reset();
+  static uint8_t r[8];
+  dri_i2c_req_t first;
+  dri_i2c_req_t q[5];
+  static const uint8_t prio[5] = {1, 5, 3, 5, 1};
+
+  s_done_n = 0;
+  mem_req(&first, DRI_I2C_OP_MEM_READ, ADDR_EE, 0x80, r, 1);
+  first.done = count_cb;
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &first) == DRI_I2C_OK);
+  for (uint32_t i = 0; i < 5u; i++)
+  {
+    mem_req(&q[i], DRI_I2C_OP_MEM_READ, ADDR_EE, (uint16_t)i, &r[i], 1);
+    q[i].prio = prio[i];
+    q[i].done = count_cb;
+    TEST_CHECK(dri_i2c_bus_submit(&s_bus, &q[i]) == DRI_I2C_OK);
+  }
+  /* 仍在队列中的请求不能再次提交 */
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &q[0]) == DRI_I2C_INVALID);
+
+  run_until_idle();
+  static const uint16_t expect[6] = {0x80, 1, 3, 2, 0, 4};
+  TEST_CHECK(s_done_n == 6u && s_sim.order_n == 6u);
+  TEST_CHECK(memcmp(s_sim.order, expect, sizeof(expect)) == 0);
+
+  dri_i2c_bus_stats_t st;
+  dri_i2c_bus_get_stats(&s_bus, &st);
+  TEST_CHECK(st.queue_peak == 5u);
+  TEST_CHECK(st.submitted == 6u && st.completed == 6u);
+  dri_i2c_dev_stats_t d;
+  TEST_CHECK(dri_i2c_bus_get_dev_stats(&s_bus, ADDR_EE, &d));
+  TEST_CHECK(d.wait_max_us >= 5u * 30u);
+}
+
+static void test_chain(void)
+{
+  reset();
+  uint8_t v[2] = {9, 8};
+  uint8_t out[2] = {0};
+  uint8_t other = 0;
+  const uint8_t reg = 0x20u;
+
+  /* 写寄存器 -> 重复起始读回；中间提交的高优先级请求不插入链中 */
+  dri_i2c_req_t c1;
+  dri_i2c_req_t c2;
+  dri_i2c_req_t hi;
+  mem_req(&c1, DRI_I2C_OP_MEM_WRITE, ADDR_TP, reg, v, 2);
+  memset(&c2, 0, sizeof(c2));
+  c2.op = DRI_I2C_OP_WRITE_READ;
+  c2.addr = ADDR_TP;
+  c2.wbuf = &reg;
+  c2.wlen = 1;
+  c2.rbuf = out;
+  c2.rlen = 2;
+  c2.mem_addr = 0xC2u; /* WRITE_READ 不用 mem_addr，只用来记录启动顺序 */
+  c1.chain = &c2;
+  mem_req(&hi, DRI_I2C_OP_MEM_READ, ADDR_EE, 0x11u, &other, 1);
+  hi.prio = 9;
+
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &c1) == DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &hi) == DRI_I2C_OK);
+  run_until_idle();
+  TEST_CHECK(c1.result == DRI_I2C_OK && c1.state == DRI_I2C_REQ_DONE);
+  TEST_CHECK(out[0] == 9u && out[1] == 8u);
+  TEST_CHECK(s_sim.order_n == 3u && s_sim.order[0] == 0x20u &&
+             s_sim.order[1] == 0xC2u && s_sim.order[2] == 0x11u);
+
+  /* 中途失败：后续段不执行，结果记在链首 */
+  dri_i2c_req_t f1;
+  dri_i2c_req_t f2;
+  dri_i2c_req_t f3;
+  mem_req(&f1, DRI_I2C_OP_MEM_WRITE, ADDR_EE, 0x40, v, 1);
+  mem_req(&f2, DRI_I2C_OP_MEM_WRITE, ADDR_NONE, 0x41, v, 1);
+  mem_req(&f3, DRI_I2C_OP_MEM_WRITE, ADDR_EE, 0x42, v, 1);
+  f1.chain = &f2;
+  f2.chain = &f3;
+  s_sim.ee[0x42] = 0;
+  TEST_CHECK(dri_i2c_bus_xfer(&s_bus, &f1) == DRI_I2C_NACK);
+  TEST_CHECK(s_sim.ee[0x40] == 9u && s_sim.ee[0x42] == 0u);
+
+  /* 链成环：拒绝 */
+  f3.chain = &f1;
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &f1) == DRI_I2C_INVALID);
+}
+
+static void test_fault_timeout(void)
+{
+  reset();
+  uint8_t r = 0;
+
+  /* 故障：本次返回 FAULT，下一次传输前恢复 */
+  s_sim.fault_next = true;
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0, 1, &r, 1, 1000) ==
+             DRI_I2C_FAULT);
+  TEST_CHECK(s_sim.recovers == 0u);
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0, 1, &r, 1, 1000) ==
+             DRI_I2C_OK);
+  TEST_CHECK(s_sim.recovers == 1u);
+
+  /* 卡死：超时停外设，下一次前恢复；恢复失败计数 */
+  s_sim.hang_next = true;
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0, 1, &r, 1, 500) ==
+             DRI_I2C_TIMEOUT);
+  TEST_CHECK(s_sim.aborts == 1u);
+  s_sim.recover_fail = true;
+  TEST_CHECK(dri_i2c_bus_mem_read(&s_bus, ADDR_EE, 0, 1, &r, 1, 1000) ==
+             DRI_I2C_OK);
+  s_sim.recover_fail = false;
+
+  dri_i2c_bus_stats_t st;
+  dri_i2c_bus_get_stats(&s_bus, &st);
+  TEST_CHECK(st.recoveries == 2u && st.recover_failed == 1u);
+  dri_i2c_dev_stats_t d;
+  TEST_CHECK(dri_i2c_bus_get_dev_stats(&s_bus, ADDR_EE, &d));
+  TEST_CHECK(d.faults == 1u && d.timeouts == 1u);
+
+  /* 排队中超时：前一个卡死，后一个在队列里等到超时出队，不启动 */
+  dri_i2c_req_t a;
+  dri_i2c_req_t b;
+  mem_req(&a, DRI_I2C_OP_MEM_READ, ADDR_EE, 0, &r, 1);
+  mem_req(&b, DRI_I2C_OP_MEM_READ, ADDR_EE, 1, &r, 1);
+  a.timeout_us = 2000u;
+  b.timeout_us = 300u;
+  s_sim.hang_next = true;
+  const uint32_t starts = s_sim.starts;
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &a) == DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &b) == DRI_I2C_OK);
+  run_until_idle();
+  TEST_CHECK(a.result == DRI_I2C_TIMEOUT && b.result == DRI_I2C_TIMEOUT);
+  TEST_CHECK(s_sim.starts == starts + 1u);
+
+  /* 取消：排队中的直接出队；传输中的停外设 */
+  mem_req(&a, DRI_I2C_OP_MEM_READ, ADDR_EE, 0, &r, 1);
+  mem_req(&b, DRI_I2C_OP_MEM_READ, ADDR_EE, 1, &r, 1);
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &a) == DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &b) == DRI_I2C_OK);
+  TEST_CHECK(dri_i2c_bus_cancel(&s_bus, &b, DRI_I2C_CANCELLED));
+  TEST_CHECK(dri_i2c_bus_cancel(&s_bus, &a, DRI_I2C_CANCELLED));
+  TEST_CHECK(!dri_i2c_bus_cancel(&s_bus, &a, DRI_I2C_CANCELLED));
+  TEST_CHECK(a.result == DRI_I2C_CANCELLED && b.result == DRI_I2C_CANCELLED);
+  TEST_CHECK(s_sim.cur == NULL && s_bus.active == NULL);
+}
+
+/* done 回调里重新提交同一个请求（周期性采样的用法） */
+static dri_i2c_req_t s_resub;
+static uint32_t s_resub_left;
+static void resubmit_cb(dri_i2c_req_t *req, void *arg)
+{
+  (void)arg;
+  if (s_resub_left > 0u)
+  {
+    s_resub_left--;
+    TEST_CHECK(dri_i2c_bus_submit(&s_bus, req) == DRI_I2C_OK);
+  }
+}
+
+static void test_resubmit(void)
+{
+  reset();
+  static uint8_t r;
+  mem_req(&s_resub, DRI_I2C_OP_MEM_READ, ADDR_EE, 0, &r, 1);
+  s_resub.done = resubmit_cb;
+  s_resub_left = 10u;
+  TEST_CHECK(dri_i2c_bus_submit(&s_bus, &s_resub) == DRI_I2C_OK);
+  run_until_idle();
+  TEST_CHECK(s_resub_left == 0u && s_sim.starts == 11u);
+}
+
+/* ==========================
+ * 随机压力
+ * ========================== */
+typedef struct
+{
+  dri_i2c_req_t req;
+  uint8_t buf[4];
+  uint32_t done;
+  uint8_t expect[4]; /* 读：提交时参考模型中的内容（同地址无并发写时有效） */
+} stress_slot_t;
+
+static stress_slot_t s_slot[STRESS_REQS];
+static uint8_t s_model[EE_SIZE];
+
+static void stress_cb(dri_i2c_req_t *req, void *arg)
+{
+  stress_slot_t *sl = (stress_slot_t *)arg;
+  sl->done++;
+  if (req->result == DRI_I2C_OK && req->op == DRI_I2C_OP_MEM_WRITE)
+  {
+    memcpy(&s_model[req->mem_addr], req->wbuf, req->wlen);
+  }
+}
+
+static void test_stress(void)
+{
+  reset();
+  memset(s_slot, 0, sizeof(s_slot));
+  memset(s_model, 0, sizeof(s_model));
+  s_prio_violations = 0;
+  test_seed(35u);
+
+  uint32_t submitted = 0;
+  uint32_t completed = 0;
+  uint32_t read_ok = 0;
+  uint32_t read_bad = 0;
+  for (uint32_t round = 0; round < STRESS_ROUNDS; round++)
+  {
+    stress_slot_t *sl = &s_slot[test_rand_n(STRESS_REQS)];
+    if (sl->req.state != DRI_I2C_REQ_QUEUED &&
+        sl->req.state != DRI_I2C_REQ_ACTIVE)
+    {
+      /* 上一轮结果：读到的内容与读完成时的模型一致（每个槽位固定地址段，见下） */
+      if (sl->req.state == DRI_I2C_REQ_DONE &&
+          sl->req.op == DRI_I2C_OP_MEM_READ && sl->req.result == DRI_I2C_OK)
+      {
+        read_ok++;
+        read_bad += (memcmp(sl->buf, sl->expect, sl->req.rlen) != 0) ? 1u : 0u;
+      }
+      completed += sl->done;
+      sl->done = 0;
+
+      /* 每个槽位只访问自己的 4 字节，读写不相互竞争 */
+      const uint16_t reg = (uint16_t)((sl - s_slot) * 4u);
+      const bool write = test_rand_n(2u) == 0u;
+      const uint16_t len = (uint16_t)(1u + test_rand_n(4u));
+      if (write)
+      {
+        for (uint32_t i = 0; i < len; i++)
+        {
+          sl->buf[i] = (uint8_t)test_rand();
+        }
+      }
+      mem_req(&sl->req, write ? DRI_I2C_OP_MEM_WRITE : DRI_I2C_OP_MEM_READ,
+              ADDR_EE, reg, sl->buf, len);
+      sl->req.prio = (uint8_t)test_rand_n(4u);
+      sl->req.timeout_us = 200u + test_rand_n(4000u);
+      sl->req.done = stress_cb;
+      sl->req.arg = sl;
+      memcpy(sl->expect, &s_model[reg], 4u);
+
+      const uint32_t r = test_rand_n(100u);
+      s_sim.fault_next = s_sim.fault_next || r < 3u;
+      s_sim.hang_next = s_sim.hang_next || r == 3u;
+      TEST_CHECK(dri_i2c_bus_submit(&s_bus, &sl->req) == DRI_I2C_OK);
+      submitted++;
+    }
+
+    const uint32_t steps = test_rand_n(60u);
+    for (uint32_t i = 0; i < steps; i++)
+    {
+      sim_poll(&s_sim);
+      dri_i2c_bus_poll(&s_bus);
+    }
+  }
+  run_until_idle();
+  for (uint32_t i = 0; i < STRESS_REQS; i++)
+  {
+    completed += s_slot[i].done;
+  }
+
+  dri_i2c_bus_stats_t st;
+  dri_i2c_bus_get_stats(&s_bus, &st);
+  dri_i2c_dev_stats_t d;
+  (void)dri_i2c_bus_get_dev_stats(&s_bus, ADDR_EE, &d);
+  printf("stress: %u requests, %u reads checked, %u faults, %u timeouts, "
+         "%u recoveries, queue peak %u, wait max %u us\n",
+         (unsigned)submitted, (unsigned)read_ok, (unsigned)d.faults,
+         (unsigned)d.timeouts, (unsigned)st.recoveries,
+         (unsigned)st.queue_peak, (unsigned)d.wait_max_us);
+
+  TEST_CHECK(completed == submitted);
+  TEST_CHECK(st.submitted == submitted && st.completed == submitted);
+  TEST_CHECK(read_bad == 0u && read_ok > 0u);
+  TEST_CHECK(memcmp(s_model, s_sim.ee, sizeof(s_model)) == 0);
+  TEST_CHECK(s_prio_violations == 0u);
+  TEST_CHECK(d.faults > 0u && d.timeouts > 0u);
+}
+
+/* 只算状态机：传输在 start 里立即完成 */
+static dri_i2c_result_t fast_start(void *ctx, const dri_i2c_req_t *s)
+{
+  (void)ctx;
+  (void)s;
+  return DRI_I2C_OK;
+}
+
+static void bench(void)
+{
+  static const dri_i2c_bus_port_t port = {
+      .start = fast_start,
+      .abort = sim_abort,
+      .recover = sim_recover,
+      .probe = sim_probe,
+      .now = sim_now,
+      .poll = NULL,
+  };
+  memset(&s_sim, 0, sizeof(s_sim));
+  dri_i2c_bus_init(&s_bus, &port, &s_sim, 1u);
+
+  uint8_t r = 0;
+  dri_i2c_req_t req;
+  mem_req(&req, DRI_I2C_OP_MEM_READ, ADDR_EE, 0, &r, 1);
+  const uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_XFERS; i++)
+  {
+    (void)dri_i2c_bus_submit(&s_bus, &req);
+    dri_i2c_bus_complete(&s_bus, DRI_I2C_OK);
+  }
+  const double ns = (double)(test_now_ns() - t0) / BENCH_XFERS;
+  TEST_CHECK(req.state == DRI_I2C_REQ_DONE);
+  printf("submit+complete: %.0f ns per transfer (host)\n", ns);
+}
+
+int main(void)
+{
+  test_ops();
+  test_priority();
+  test_chain();
+  test_fault_timeout();
+  test_resubmit();
+  test_stress();
+  bench();
+  return test_done();
+}
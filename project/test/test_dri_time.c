@@ -0,0 +1,234 @@
+/*
+ * drivers/dri_time_us：64 位 cycle 时钟与定点换算
+ *
+ * - 换算：cycles -> us/ns（32 位与 64 位输入）、us -> cycles 与 128 位整数除法逐值比对；
+ *   2^64/hz 以内必须精确，更长时最多多 1
+ * - 回绕：模拟计数器每步前进不足一个 32 位周期，64 位扩展与真实值处处相等
+ * - 并发：一个线程推进计数器并观测，四个线程读，读数单调且落在读前后的真实值之间
+ * 基准：定点换算与 64 位除法的主机耗时
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "dri_time_us.h"
+#include "test.h"
+
+#define CONV_ROUNDS 300000u
+#define WRAP_STEPS 200000u
+#define READERS 4u
+#define READER_ROUNDS 300000u
+#define BENCH_N 20000000u
+
+typedef unsigned __int128 u128;
+
+/* 模拟的 64 位真实计数，端口只暴露低 32 位 */
+static _Atomic uint64_t s_true;
+
+static uint32_t port_read(void)
+{
+  return (uint32_t)atomic_load(&s_true);
+}
+
+static pthread_mutex_t s_mu = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t port_lock(void)
+{
+  pthread_mutex_lock(&s_mu);
+  return 0u;
+}
+
+static void port_unlock(uint32_t key)
+{
+  (void)key;
+  pthread_mutex_unlock(&s_mu);
+}
+
+static dri_time_port_t s_port = {
+    .read = port_read,
+    .hz = 180000000u,
+};
+
+static void test_conversions(uint32_t hz)
+{
+  atomic_store(&s_true, 0u);
+  s_port.hz = hz;
+  dri_time_host_init(&s_port);
+  TEST_CHECK(dri_time_hz() == hz);
+
+  const u128 exact_lim = ((u128)1 << 64) / hz;
+  uint64_t us_lim = ((uint64_t)1 << 32) * 1000000u / hz;
+  if (us_lim > 0xFFFFFFFFu)
+  {
+    us_lim = 0xFFFFFFFFu;
+  }
+
+  for (uint32_t i = 0; i < CONV_ROUNDS; i++)
+  {
+    /* 先扫最大的 32 位输入，再随机 */
+    const uint32_t c = (i < 1000u) ? 0xFFFFFFFFu - i : (uint32_t)test_rand();
+    TEST_CHECK(dri_time_cycles_to_us(c) == (uint32_t)((u128)c * 1000000u / hz));
+    TEST_CHECK(dri_time_cycles_to_ns(c) ==
+               (uint64_t)((u128)c * 1000000000u / hz));
+
+    /* 各数量级的 64 位输入 */
+    const uint64_t c64 = test_rand() >> test_rand_n(64u);
+    const u128 want_us = (u128)c64 * 1000000u / hz;
+    const u128 want_ns = (u128)c64 * 1000000000u / hz;
+    const uint64_t got_us = dri_time_cycles64_to_us(c64);
+    const uint64_t got_ns = dri_time_cycles64_to_ns(c64);
+    if (c64 < exact_lim)
+    {
+      TEST_CHECK(got_us == (uint64_t)want_us);
+      TEST_CHECK(got_ns == (uint64_t)want_ns);
+    }
+    else
+    {
+      TEST_CHECK(got_us - (uint64_t)want_us <= 1u);
+      if ((want_ns >> 64) == 0u)
+      {
+        TEST_CHECK(got_ns - (uint64_t)want_ns <= 1u);
+      }
+    }
+
+    const uint32_t us = (uint32_t)(test_rand() % us_lim);
+    TEST_CHECK(dri_time_us_to_cycles(us) ==
+               (uint32_t)((uint64_t)us * hz / 1000000u));
+  }
+}
+
+static void test_wrap(uint32_t hz)
+{
+  atomic_store(&s_true, 0u);
+  s_port.hz = hz;
+  dri_time_host_init(&s_port);
+
+  uint32_t bad = 0;
+  for (uint32_t i = 0; i < WRAP_STEPS; i++)
+  {
+    /* 每步 1 .. 2^32-1 个 cycle：两次观测之间不超过一个周期 */
+    atomic_fetch_add(&s_true, (test_rand() % 0xFFFFFFFFull) + 1u);
+    bad += (dri_time_cycles64() != atomic_load(&s_true)) ? 1u : 0u;
+  }
+  TEST_CHECK(bad == 0u);
+
+  /* 派生时钟与换算一致 */
+  const uint64_t t = atomic_load(&s_true);
+  TEST_CHECK(dri_time_now_us64() == dri_time_cycles64_to_us(t));
+  TEST_CHECK(dri_time_now_ns64() == dri_time_cycles64_to_ns(t));
+  TEST_CHECK(dri_time_now_ms() == (uint32_t)((u128)t * 1000u / hz));
+}
+
+static atomic_bool s_stop;
+static atomic_uint s_bad;
+
+static void *writer_main(void *arg)
+{
+  (void)arg;
+  uint64_t rng = 0x2545F4914F6CDD1Dull;
+  while (!atomic_load(&s_stop))
+  {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    /* 相当于 SysTick：每次推进后观测一次，步长远小于 2^32 */
+    atomic_fetch_add(&s_true, (rng & 0x3FFFFFFFu) + 1u);
+    (void)dri_time_cycles64();
+  }
+  return NULL;
+}
+
+static void *reader_main(void *arg)
+{
+  (void)arg;
+  uint64_t prev = 0;
+  uint32_t bad = 0;
+  for (uint32_t i = 0; i < READER_ROUNDS; i++)
+  {
+    const uint64_t before = atomic_load(&s_true);
+    const uint64_t v = dri_time_cycles64();
+    const uint64_t after = atomic_load(&s_true);
+    bad += (v < prev || v < before || v > after) ? 1u : 0u;
+    prev = v;
+  }
+  atomic_fetch_add(&s_bad, bad);
+  return NULL;
+}
+
+static void test_concurrent(void)
+{
+  /* 从回绕前夕开始 */
+  atomic_store(&s_true, 0xFFFFFFF0ull);
+  s_port.hz = 180000000u;
+  s_port.lock = port_lock;
+  s_port.unlock = port_unlock;
+  dri_time_host_init(&s_port);
+  atomic_store(&s_stop, false);
+  atomic_store(&s_bad, 0u);
+
+  pthread_t writer;
+  pthread_t readers[READERS];
+  TEST_CHECK(pthread_create(&writer, NULL, writer_main, NULL) == 0);
+  for (uint32_t i = 0; i < READERS; i++)
+  {
+    TEST_CHECK(pthread_create(&readers[i], NULL, reader_main, NULL) == 0);
+  }
+  for (uint32_t i = 0; i < READERS; i++)
+  {
+    pthread_join(readers[i], NULL);
+  }
+  atomic_store(&s_stop, true);
+  pthread_join(writer, NULL);
+
+  TEST_CHECK(atomic_load(&s_bad) == 0u);
+  TEST_CHECK(atomic_load(&s_true) > 0x100000000ull);
+  TEST_CHECK(dri_time_cycles64() == atomic_load(&s_true));
+
+  s_port.lock = NULL;
+  s_port.unlock = NULL;
+}
+
+static void bench(void)
+{
+  s_port.hz = 180000000u;
+  dri_time_host_init(&s_port);
+  volatile uint64_t sink = 0;
+  /* 除数经 volatile 读出，避免编译器把除法换成常数乘法 */
+  volatile uint64_t hz = s_port.hz;
+
+  uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_N; i++)
+  {
+    sink += dri_time_cycles64_to_ns((uint64_t)i * 7919u);
+  }
+  const double scale_ns = (double)(test_now_ns() - t0) / BENCH_N;
+
+  const uint64_t d = hz;
+  t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_N; i++)
+  {
+    sink += (uint64_t)i * 7919u * 1000000000u / d;
+  }
+  const double div_ns = (double)(test_now_ns() - t0) / BENCH_N;
+  (void)sink;
+
+  printf("cycles64_to_ns: %.2f ns, u64 division %.2f ns (host)\n", scale_ns,
+         div_ns);
+}
+
+int main(void)
+{
+  static const uint32_t hzs[] = {
+      180000000u, 168000000u, 16000000u, 1000000u, 123456789u, 4294967295u,
+  };
+
+  test_seed(42u);
+  for (uint32_t i = 0; i < sizeof(hzs) / sizeof(hzs[0]); i++)
+  {
+    test_conversions(hzs[i]);
+    test_wrap(hzs[i]);
+  }
+  test_concurrent();
+  bench();
+  return test_done();
+}
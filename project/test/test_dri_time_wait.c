@@ -0,0 +1,310 @@
+/*
+ * drivers/dri_time_wait：截止时间等待（先睡眠、后自旋）
+ *
+ * 虚拟时钟：每读一次计数器前进一轮轮询（POLL_CYCLES）并计入 CPU 占用；
+ * sleep_until 直接跳到唤醒时刻再加 1~6us 的唤醒延迟（比较中断 + 任务切换），
+ * 睡眠期间每 1ms 模拟一次 SysTick 观测计数器。
+ * - 纯自旋与睡眠+自旋：从不早于截止时间返回，晚到不超过两轮轮询；睡眠时 CPU 基本空闲
+ * - 完成条件：事件中断经 dri_time_wait_wake 唤醒等待者，返回时刻紧跟事件；
+ *   不登记等待者时睡到截止前才发现，但结果仍正确
+ * - 条件始终不成立时按截止时间超时返回 false
+ * - sleep_until 睡不了（不足 1 tick 且无比较通道）时全部自旋
+ * - 截止时间跨多个 32 位 CYCCNT 周期
+ * 基准：各场景的返回抖动与 CPU 占用（模拟）
+ */
+#include <stdio.h>
+
+#include "dri_time_us.h"
+#include "dri_time_wait.h"
+#include "test.h"
+
+#define HZ 180000000u
+#define CYCLES_PER_US (HZ / 1000000u)
+#define POLL_CYCLES 24u
+#define TICK_CYCLES (HZ / 1000u)
+#define WAITS 20000u
+/* 纯自旋每轮轮询都要模拟一次读数：次数与时长取小 */
+#define SPIN_WAITS 2000u
+#define SPIN_MAX_US 2000u
+#define SLEEP_MAX_US 40000u
+
+static uint64_t s_t;    /* 真实时间（cycle） */
+static uint64_t s_busy; /* 任务上下文读计数器的总开销 */
+static bool s_in_isr;
+static bool s_can_sleep = true;
+static bool s_sleep_fails;
+
+/* 事件：到 s_event 时刻发生，中断里唤醒登记的等待者 */
+static uint64_t s_event = UINT64_MAX;
+static dri_time_waiter_t s_waiter;
+static bool s_woken;
+
+static uint32_t port_read(void)
+{
+  if (!s_in_isr)
+  {
+    s_t += POLL_CYCLES;
+    s_busy += POLL_CYCLES;
+  }
+  return (uint32_t)s_t;
+}
+
+static uint64_t wake_latency(void)
+{
+  return (uint64_t)CYCLES_PER_US * (1u + test_rand_n(6u));
+}
+
+/* 从 s_t 前进到 until，途中每个 tick 观测一次计数器，事件到点时在中断里处理 */
+static void advance_isr(uint64_t until)
+{
+  s_in_isr = true;
+  while (s_t < until)
+  {
+    uint64_t next = s_t + TICK_CYCLES;
+    if (next > until)
+    {
+      next = until;
+    }
+    if (s_t < s_event && s_event <= next)
+    {
+      s_t = s_event;
+      dri_time_wait_wake(&s_waiter);
+    }
+    s_t = next;
+    (void)dri_time_cycles64();
+  }
+  s_in_isr = false;
+}
+
+static void *port_self(void)
+{
+  return s_can_sleep ? (void *)&s_waiter : NULL;
+}
+
+static bool port_sleep_until(void *task, uint64_t wake_at)
+{
+  (void)task;
+  if (s_sleep_fails)
+  {
+    return false;
+  }
+  s_woken = false;
+  if (s_event < wake_at)
+  {
+    if (s_event > s_t)
+    {
+      advance_isr(s_event);
+    }
+    else
+    {
+      /* 事件发生在登记之后、睡眠之前：通知已挂起，睡眠立即返回 */
+      dri_time_wait_wake(&s_waiter);
+    }
+  }
+  /* 没被 wake 提前唤醒就睡满 */
+  if (!s_woken)
+  {
+    advance_isr(wake_at);
+  }
+  advance_isr(s_t + wake_latency());
+  return true;
+}
+
+static void port_wake(void *task)
+{
+  (void)task;
+  s_woken = true;
+}
+
+static const dri_time_wait_port_t s_wait_port = {
+    .self = port_self,
+    .sleep_until = port_sleep_until,
+    .wake = port_wake,
+};
+
+static bool event_cond(void *arg)
+{
+  (void)arg;
+  return s_t >= s_event;
+}
+
+static bool never_cond(void *arg)
+{
+  (void)arg;
+  return false;
+}
+
+typedef enum
+{
+  RUN_DELAY, /* 不带条件 */
+  RUN_EVENT, /* 条件在截止前成立 */
+  RUN_NEVER, /* 条件始终不成立 */
+} run_kind_t;
+
+typedef struct
+{
+  uint32_t waits;
+  uint32_t ok;
+  uint32_t early; /* 早于目标时刻返回 */
+  uint64_t late_max;
+  uint64_t late_sum;
+  double busy;    /* CPU 占用比例 */
+  double reclaim; /* 睡眠时长占等待总时长 */
+  dri_time_wait_stats_t stats;
+} run_result_t;
+
+static run_result_t run(run_kind_t kind, dri_time_waiter_t *w, uint32_t waits,
+                        uint32_t max_us)
+{
+  run_result_t r = {.waits = waits};
+  uint64_t total = 0;
+  const uint64_t busy0 = s_busy;
+  dri_time_wait_reset_stats();
+
+  for (uint32_t i = 0; i < waits; i++)
+  {
+    const uint32_t us = 30u + test_rand_n(max_us - 30u);
+    const uint64_t t0 = s_t;
+    const uint64_t deadline = t0 + dri_time_us_to_cycles(us);
+    uint64_t target = deadline;
+    bool ok;
+    if (kind == RUN_EVENT)
+    {
+      s_event = t0 + dri_time_us_to_cycles(test_rand_n(us));
+      target = s_event;
+      ok = dri_time_wait_until(w, deadline, event_cond, NULL);
+    }
+    else
+    {
+      ok = dri_time_wait_until(w, deadline,
+                               (kind == RUN_NEVER) ? never_cond : NULL, NULL);
+    }
+    s_event = UINT64_MAX;
+
+    r.ok += ok ? 1u : 0u;
+    if (s_t < target)
+    {
+      r.early++;
+    }
+    else
+    {
+      const uint64_t late = s_t - target;
+      r.late_sum += late;
+      r.late_max = (late > r.late_max) ? late : r.late_max;
+    }
+    total += s_t - t0;
+    const uint64_t now = dri_time_cycles64();
+    TEST_CHECK(now == s_t);
+  }
+
+  dri_time_wait_get_stats(&r.stats);
+  r.busy = (double)(s_busy - busy0) / (double)total;
+  r.reclaim = (double)r.stats.sleep_cycles / (double)r.stats.wait_cycles;
+  return r;
+}
+
+static void report(const char *name, const run_result_t *r)
+{
+  printf("%-24s late mean %5.2f us max %5.2f us, cpu busy %5.1f%%, "
+         "sleeps/wait %.2f (sim)\n",
+         name, (double)r->late_sum / r->waits / CYCLES_PER_US,
+         (double)r->late_max / CYCLES_PER_US, 100.0 * r->busy,
+         (double)r->stats.sleeps / r->waits);
+}
+
+static void test_delay(void)
+{
+  s_can_sleep = false;
+  run_result_t spin = run(RUN_DELAY, NULL, SPIN_WAITS, SPIN_MAX_US);
+  TEST_CHECK(spin.ok == SPIN_WAITS && spin.early == 0u);
+  TEST_CHECK(spin.late_max <= 2u * POLL_CYCLES);
+  TEST_CHECK(spin.stats.sleeps == 0u && spin.stats.waits == SPIN_WAITS);
+  TEST_CHECK(spin.busy > 0.99);
+  report("spin, delay", &spin);
+
+  s_can_sleep = true;
+  run_result_t sleep = run(RUN_DELAY, NULL, WAITS, SLEEP_MAX_US);
+  TEST_CHECK(sleep.ok == WAITS && sleep.early == 0u);
+  TEST_CHECK(sleep.late_max <= 2u * POLL_CYCLES);
+  TEST_CHECK(sleep.stats.late_max_cycles <= 2u * POLL_CYCLES);
+  TEST_CHECK(sleep.stats.sleeps >= WAITS);
+  TEST_CHECK(sleep.busy < 0.01 && sleep.reclaim > 0.99);
+  report("sleep+spin, delay", &sleep);
+}
+
+static void test_cond(void)
+{
+  s_can_sleep = true;
+
+  /* 登记等待者：事件中断提前唤醒，返回不晚于唤醒延迟 + 两轮轮询 */
+  run_result_t woke = run(RUN_EVENT, &s_waiter, WAITS, SLEEP_MAX_US);
+  TEST_CHECK(woke.ok == WAITS && woke.early == 0u);
+  TEST_CHECK(woke.stats.cond_hits == WAITS);
+  TEST_CHECK(woke.late_max <= 6u * CYCLES_PER_US + 2u * POLL_CYCLES);
+  TEST_CHECK(woke.busy < 0.01);
+  TEST_CHECK(s_waiter.task == NULL);
+  report("sleep+spin, cond, wake", &woke);
+
+  /* 不登记：睡到截止前才重查条件，仍然成立返回 */
+  run_result_t late = run(RUN_EVENT, NULL, WAITS, SLEEP_MAX_US);
+  TEST_CHECK(late.ok == WAITS && late.early == 0u);
+  TEST_CHECK(late.late_max > woke.late_max);
+  report("sleep+spin, cond", &late);
+
+  /* 纯自旋：每轮轮询都查条件 */
+  s_can_sleep = false;
+  run_result_t spin = run(RUN_EVENT, NULL, SPIN_WAITS, SPIN_MAX_US);
+  TEST_CHECK(spin.ok == SPIN_WAITS && spin.early == 0u);
+  TEST_CHECK(spin.late_max <= 2u * POLL_CYCLES);
+  report("spin, cond", &spin);
+
+  /* 条件不成立：超时返回 false，时刻与无条件等待相同 */
+  s_can_sleep = true;
+  run_result_t never = run(RUN_NEVER, &s_waiter, WAITS, SLEEP_MAX_US);
+  TEST_CHECK(never.ok == 0u && never.early == 0u);
+  TEST_CHECK(never.stats.cond_hits == 0u);
+  TEST_CHECK(never.late_max <= 2u * POLL_CYCLES);
+}
+
+static void test_sleep_fails(void)
+{
+  s_can_sleep = true;
+  s_sleep_fails = true;
+  run_result_t r = run(RUN_DELAY, NULL, SPIN_WAITS, SPIN_MAX_US);
+  TEST_CHECK(r.ok == SPIN_WAITS && r.early == 0u);
+  TEST_CHECK(r.late_max <= 2u * POLL_CYCLES);
+  TEST_CHECK(r.stats.sleeps == 0u);
+  TEST_CHECK(r.busy > 0.99);
+  s_sleep_fails = false;
+}
+
+static void test_long_wait(void)
+{
+  /* 60s 约为 2.5 个 CYCCNT 周期：截止时刻仍须精确 */
+  s_can_sleep = true;
+  const uint64_t deadline = dri_time_cycles64() + 60ull * HZ;
+  TEST_CHECK(dri_time_wait_until(NULL, deadline, NULL, NULL));
+  TEST_CHECK(s_t >= deadline && s_t - deadline <= 2u * POLL_CYCLES);
+  const uint64_t now = dri_time_cycles64();
+  TEST_CHECK(now == s_t);
+}
+
+int main(void)
+{
+  static const dri_time_port_t time_port = {
+      .read = port_read,
+      .hz = HZ,
+  };
+
+  test_seed(43u);
+  /* 从回绕前夕开始，前几次等待就跨过 32 位边界 */
+  s_t = 0xFFFF0000u;
+  dri_time_host_init(&time_port);
+  TEST_CHECK(dri_time_wait_init(&s_wait_port));
+
+  test_delay();
+  test_cond();
+  test_sleep_fails();
+  test_long_wait();
+  return test_done();
+}
@@ -0,0 +1,425 @@
+/*
+ * services/ser_boot：启动步骤图的检查、调度与报告（SER_BOOT_HOST=1）
+ *
+ * 用虚拟时钟（1 cycle = 1us，t0 在 32 位回绕点之前）与协作式“任务”驱动：
+ * - app_main 的步骤表：触摸复位/探测期间让出给 LVGL 通道，首帧早于触摸完成；
+ *   触摸失败时 indev 标记 skip、首帧不受影响；报告逐行核对
+ * - port->wait：缺的依赖位正确，等待中另一通道推进后继续，超时返回 false
+ * - 图检查：越界/自依赖/成环/MAIN 依赖其它通道/通道越界/步骤过多
+ * - 随机图：随机依赖、通道、失败与嵌套抢占；每步至多执行一次、执行时依赖全部成功、
+ *   开始时刻不早于依赖的结束时刻，依赖失败的步骤与里程碑都不执行
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_boot.h"
+
+#define B SER_BOOT_BIT
+#define T0 0xFFFF0000u
+#define RANDOM_GRAPHS 2000u
+
+static ser_boot_graph_t s_g;
+static uint32_t s_now;
+
+static uint32_t sim_now(void *ctx)
+{
+  (void)ctx;
+  return s_now;
+}
+
+static const ser_boot_port_t s_port = {.now = sim_now, .hz = 1000000u};
+
+/* ==========================
+ * app_main 的步骤表
+ * ========================== */
+enum
+{
+  SDRAM = 0,
+  LCD,
+  SPLASH,
+  ULTRASONIC,
+  TOUCH,
+  DISPLAY,
+  UI,
+  FIRST_FRAME,
+  INDEV,
+  APP_N,
+};
+
+static char s_order[128];
+static bool s_touch_ok;
+
+static void log_step(const char *name)
+{
+  strncat(s_order, name, sizeof(s_order) - strlen(s_order) - 1u);
+  strncat(s_order, " ", sizeof(s_order) - strlen(s_order) - 1u);
+}
+
+static bool step_cost(void *arg)
+{
+  log_step(s_g.steps[(uintptr_t)arg].name);
+  s_now += 100u;
+  return true;
+}
+
+/* LVGL 任务的一次循环：推进通道，UI 建好后刷新一帧 */
+static void lvgl_loop(void)
+{
+  (void)ser_boot_graph_run(&s_g, SER_BOOT_LANE_LVGL, 0u);
+  if (ser_boot_graph_state(&s_g, UI) == SER_BOOT_OK &&
+      ser_boot_graph_state(&s_g, FIRST_FRAME) == SER_BOOT_PENDING)
+  {
+    s_now += 5000u;
+    TEST_CHECK(ser_boot_graph_complete(&s_g, FIRST_FRAME));
+    log_step("frame");
+  }
+}
+
+/* 复位/探测约 150ms，期间 HAL_Delay 让出 CPU */
+static bool step_touch(void *arg)
+{
+  (void)arg;
+  s_now += 50000u;
+  lvgl_loop();
+  s_now += 100000u;
+  log_step(s_touch_ok ? "touch" : "touch(fail)");
+  return s_touch_ok;
+}
+
+static const ser_boot_step_t s_app[APP_N] = {
+    [SDRAM] = {"sdram", SER_BOOT_LANE_MAIN, 0u, step_cost, (void *)SDRAM},
+    [LCD] = {"lcd", SER_BOOT_LANE_MAIN, B(SDRAM), step_cost, (void *)LCD},
+    [SPLASH] = {"splash", SER_BOOT_LANE_MAIN, B(LCD), step_cost,
+                (void *)SPLASH},
+    [ULTRASONIC] = {"ultrasonic", SER_BOOT_LANE_IO, 0u, step_cost,
+                    (void *)ULTRASONIC},
+    [TOUCH] = {"touch", SER_BOOT_LANE_IO, B(LCD), step_touch, NULL},
+    [DISPLAY] = {"display", SER_BOOT_LANE_LVGL, B(LCD), step_cost,
+                 (void *)DISPLAY},
+    [UI] = {"ui", SER_BOOT_LANE_LVGL, B(DISPLAY) | B(ULTRASONIC), step_cost,
+            (void *)UI},
+    [FIRST_FRAME] = {"first_frame", SER_BOOT_LANE_LVGL, B(UI), NULL, NULL},
+    [INDEV] = {"indev", SER_BOOT_LANE_LVGL, B(DISPLAY) | B(TOUCH), step_cost,
+               (void *)INDEV},
+};
+
+static void test_app_graph(bool touch_ok)
+{
+  s_order[0] = '\0';
+  s_touch_ok = touch_ok;
+  s_now = T0;
+  TEST_CHECK(ser_boot_graph_init(&s_g, s_app, APP_N, FIRST_FRAME, &s_port,
+                                 NULL));
+
+  /* main()：调度器启动前 */
+  TEST_CHECK(ser_boot_graph_run(&s_g, SER_BOOT_LANE_MAIN, 0u));
+  TEST_CHECK(!ser_boot_graph_complete(&s_g, FIRST_FRAME)); /* 依赖未满足 */
+  TEST_CHECK(!ser_boot_graph_complete(&s_g, SDRAM));       /* 不是里程碑 */
+  s_now += 1000u;
+  ser_boot_graph_mark_sched(&s_g);
+
+  /* LVGL 任务先跑：display 后 ui 等 ultrasonic，不阻塞 */
+  lvgl_loop();
+  TEST_CHECK(ser_boot_graph_state(&s_g, UI) == SER_BOOT_PENDING);
+  TEST_CHECK(ser_boot_graph_state(&s_g, INDEV) == SER_BOOT_PENDING);
+
+  /* 启动任务：ultrasonic，touch 期间 LVGL 建 UI 并出首帧 */
+  TEST_CHECK(ser_boot_graph_run(&s_g, SER_BOOT_LANE_IO, 0u));
+  lvgl_loop();
+  TEST_CHECK(ser_boot_graph_all_done(&s_g));
+  TEST_CHECK(ser_boot_graph_run(&s_g, SER_BOOT_LANE_LVGL, 0u));
+
+  const char *expect =
+      touch_ok ? "sdram lcd splash display ultrasonic ui frame touch indev "
+               : "sdram lcd splash display ultrasonic ui frame touch(fail) ";
+  TEST_CHECK(strcmp(s_order, expect) == 0);
+  TEST_CHECK(ser_boot_graph_state(&s_g, TOUCH) ==
+             (touch_ok ? SER_BOOT_OK : SER_BOOT_FAILED));
+  TEST_CHECK(ser_boot_graph_state(&s_g, INDEV) ==
+             (touch_ok ? SER_BOOT_OK : SER_BOOT_SKIPPED));
+  TEST_CHECK(ser_boot_graph_state(&s_g, FIRST_FRAME) == SER_BOOT_OK);
+
+  /* 报告：header + 每步一行 + sched + ttff；t0 前后跨过回绕点 */
+  char line[SER_BOOT_MAX_STEPS * 4u];
+  uint32_t lines = 0;
+  for (uint32_t i = 0; ser_boot_graph_format(&s_g, i, line, sizeof(line)) > 0;
+       i++)
+  {
+    printf("  %s\n", line);
+    lines++;
+  }
+  TEST_CHECK(lines == APP_N + 3u);
+  (void)ser_boot_graph_format(&s_g, 1u + SDRAM, line, sizeof(line));
+  TEST_CHECK(strcmp(line, "boot,sdram,0,0,100,ok") == 0);
+  (void)ser_boot_graph_format(&s_g, APP_N + 1u, line, sizeof(line));
+  TEST_CHECK(strcmp(line, "boot,sched_us,1300") == 0);
+  (void)ser_boot_graph_format(&s_g, APP_N + 2u, line, sizeof(line));
+  TEST_CHECK(strcmp(line, "boot,ttff_us,56600") == 0);
+  (void)ser_boot_graph_format(&s_g, 1u + TOUCH, line, sizeof(line));
+  TEST_CHECK(strcmp(line, touch_ok ? "boot,touch,2,1500,156600,ok"
+                                   : "boot,touch,2,1500,156600,fail") == 0);
+  if (!touch_ok)
+  {
+    (void)ser_boot_graph_format(&s_g, 1u + INDEV, line, sizeof(line));
+    TEST_CHECK(strcmp(line, "boot,indev,1,156600,156600,skip") == 0);
+  }
+
+  /* 截断 */
+  char small[10];
+  TEST_CHECK(ser_boot_graph_format(&s_g, 0u, small, sizeof(small)) ==
+             (int)strlen(small));
+  TEST_CHECK(strlen(small) == sizeof(small) - 1u);
+}
+
+/* ==========================
+ * port->wait
+ * ========================== */
+static uint32_t s_wait_mask;
+static uint32_t s_wait_calls;
+static bool s_wait_ok;
+
+static bool sim_wait(void *ctx, uint32_t mask, uint32_t timeout_ms)
+{
+  (void)ctx;
+  TEST_CHECK(timeout_ms == 20u);
+  s_wait_mask = mask;
+  s_wait_calls++;
+  if (!s_wait_ok)
+  {
+    return false;
+  }
+  /* 等待期间另一任务推进 LVGL 通道 */
+  s_now += 10u;
+  (void)ser_boot_graph_run(&s_g, SER_BOOT_LANE_LVGL, 0u);
+  return true;
+}
+
+static void test_wait(void)
+{
+  static const ser_boot_port_t port = {
+      .now = sim_now, .hz = 1000000u, .wait = sim_wait};
+  static const ser_boot_step_t steps[] = {
+      {"io_a", SER_BOOT_LANE_IO, 0u, step_cost, (void *)0},
+      {"lv", SER_BOOT_LANE_LVGL, B(0), step_cost, (void *)1},
+      {"io_b", SER_BOOT_LANE_IO, B(1), step_cost, (void *)2},
+  };
+
+  for (uint32_t k = 0; k < 2u; k++)
+  {
+    s_wait_ok = (k == 0u);
+    s_wait_calls = 0;
+    s_order[0] = '\0';
+    TEST_CHECK(ser_boot_graph_init(&s_g, steps, 3u, -1, &port, NULL));
+
+    /* wait_ms 为 0：不等待 */
+    TEST_CHECK(!ser_boot_graph_run(&s_g, SER_BOOT_LANE_IO, 0u));
+    TEST_CHECK(s_wait_calls == 0u);
+
+    TEST_CHECK(ser_boot_graph_run(&s_g, SER_BOOT_LANE_IO, 20u) == s_wait_ok);
+    TEST_CHECK(s_wait_calls == 1u && s_wait_mask == B(1));
+    TEST_CHECK(strcmp(s_order, s_wait_ok ? "io_a lv io_b " : "io_a ") == 0);
+
+    /* 无 ttff 里程碑：报告只到 sched_us */
+    char line[64];
+    TEST_CHECK(ser_boot_graph_format(&s_g, 3u + 2u, line, sizeof(line)) == 0);
+  }
+}
+
+/* ==========================
+ * 图检查
+ * ========================== */
+static void test_check(void)
+{
+  const ser_boot_step_t ok[] = {
+      {"a", SER_BOOT_LANE_MAIN, 0u, step_cost, NULL},
+      {"b", SER_BOOT_LANE_IO, B(0), step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(ok, 2u) == -1);
+  TEST_CHECK(ser_boot_graph_check(s_app, APP_N) == -1);
+  TEST_CHECK(ser_boot_graph_check(NULL, 2u) == 0);
+  TEST_CHECK(ser_boot_graph_check(ok, 0u) == 0);
+
+  const ser_boot_step_t out_of_range[] = {
+      {"a", SER_BOOT_LANE_IO, 0u, step_cost, NULL},
+      {"b", SER_BOOT_LANE_IO, B(2), step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(out_of_range, 2u) == 1);
+
+  const ser_boot_step_t self[] = {
+      {"a", SER_BOOT_LANE_IO, B(0), step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(self, 1u) == 0);
+
+  const ser_boot_step_t cycle[] = {
+      {"a", SER_BOOT_LANE_IO, 0u, step_cost, NULL},
+      {"b", SER_BOOT_LANE_IO, B(2), step_cost, NULL},
+      {"c", SER_BOOT_LANE_LVGL, B(1), step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(cycle, 3u) == 1);
+
+  const ser_boot_step_t main_waits[] = {
+      {"a", SER_BOOT_LANE_LVGL, 0u, step_cost, NULL},
+      {"b", SER_BOOT_LANE_MAIN, B(0), step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(main_waits, 2u) == 1);
+
+  const ser_boot_step_t bad_lane[] = {
+      {"a", SER_BOOT_LANE_NUM, 0u, step_cost, NULL},
+  };
+  TEST_CHECK(ser_boot_graph_check(bad_lane, 1u) == 0);
+
+  static ser_boot_step_t many[SER_BOOT_MAX_STEPS + 1u];
+  TEST_CHECK(ser_boot_graph_check(many, SER_BOOT_MAX_STEPS + 1u) == 0);
+
+  /* init 拒绝非法表与越界的首帧编号 */
+  TEST_CHECK(!ser_boot_graph_init(&s_g, cycle, 3u, -1, &s_port, NULL));
+  TEST_CHECK(!ser_boot_graph_init(&s_g, ok, 2u, 2, &s_port, NULL));
+}
+
+/* ==========================
+ * 随机图
+ * ========================== */
+static ser_boot_step_t s_rand[SER_BOOT_MAX_STEPS];
+static bool s_fail[SER_BOOT_MAX_STEPS];
+static uint32_t s_runs[SER_BOOT_MAX_STEPS];
+static uint8_t s_lane_stack[8];
+static uint32_t s_depth;
+static uint32_t s_errors;
+
+static bool run_lane(uint8_t lane);
+
+static bool step_random(void *arg)
+{
+  const uint32_t i = (uint32_t)(uintptr_t)arg;
+  const ser_boot_step_t *s = &s_rand[i];
+
+  s_runs[i]++;
+  s_errors += (s->lane != s_lane_stack[s_depth - 1u]) ? 1u : 0u;
+  for (uint32_t d = 0; d < s_g.n; d++)
+  {
+    if ((s->deps & B(d)) != 0u &&
+        (ser_boot_graph_state(&s_g, d) != SER_BOOT_OK ||
+         (int32_t)(s_g.t_start[i] - s_g.t_end[d]) < 0))
+    {
+      s_errors++;
+    }
+  }
+
+  s_now += 1u + test_rand_n(100u);
+  /* 模拟被其它通道的任务抢占 */
+  if (s_depth < 4u && test_rand_n(4u) == 0u)
+  {
+    (void)run_lane((uint8_t)(SER_BOOT_LANE_LVGL + test_rand_n(2u)));
+  }
+  s_now += test_rand_n(100u);
+  return !s_fail[i];
+}
+
+static bool run_lane(uint8_t lane)
+{
+  s_lane_stack[s_depth++] = lane;
+  const bool done = ser_boot_graph_run(&s_g, lane, 0u);
+  s_depth--;
+  return done;
+}
+
+static void test_random(void)
+{
+  uint32_t skipped = 0;
+  uint32_t milestones = 0;
+
+  test_seed(37u);
+  for (uint32_t it = 0; it < RANDOM_GRAPHS; it++)
+  {
+    const uint32_t n = 1u + test_rand_n(SER_BOOT_MAX_STEPS);
+    uint32_t main_mask = 0;
+    uint32_t milestone_mask = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      ser_boot_step_t *s = &s_rand[i];
+      s->name = "s";
+      s->lane = (uint8_t)test_rand_n(SER_BOOT_LANE_NUM);
+      /* 里程碑只作终点（首帧），不被依赖 */
+      s->deps = (i > 0u) ? (test_rand() & test_rand() & (B(i) - 1u) &
+                            ~milestone_mask)
+                         : 0u;
+      if (s->lane == SER_BOOT_LANE_MAIN)
+      {
+        s->deps &= main_mask;
+        main_mask |= B(i);
+      }
+      s->fn = (s->lane != SER_BOOT_LANE_MAIN && test_rand_n(6u) == 0u)
+                  ? NULL
+                  : step_random;
+      milestone_mask |= (s->fn == NULL) ? B(i) : 0u;
+      s->arg = (void *)(uintptr_t)i;
+      s_fail[i] = test_rand_n(8u) == 0u;
+      s_runs[i] = 0;
+    }
+
+    s_now = T0 + test_rand_n(0x20000u);
+    TEST_CHECK(ser_boot_graph_check(s_rand, n) == -1);
+    TEST_CHECK(ser_boot_graph_init(&s_g, s_rand, n, -1, &s_port, NULL));
+    TEST_CHECK(run_lane(SER_BOOT_LANE_MAIN));
+
+    for (uint32_t round = 0; round < 4u * n + 8u; round++)
+    {
+      (void)run_lane((uint8_t)(SER_BOOT_LANE_LVGL + test_rand_n(2u)));
+      for (uint32_t m = 0; m < n; m++)
+      {
+        if ((milestone_mask & B(m)) != 0u && test_rand_n(2u) == 0u)
+        {
+          (void)ser_boot_graph_complete(&s_g, m);
+        }
+      }
+      if (ser_boot_graph_all_done(&s_g))
+      {
+        break;
+      }
+    }
+    TEST_CHECK(ser_boot_graph_all_done(&s_g));
+
+    /* 逐步核对：失败向后传播，里程碑只由 complete 结束 */
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      bad |= (s_rand[i].deps & bad) != 0u ? B(i) : 0u;
+      const bool dep_bad = (s_rand[i].deps & bad) != 0u;
+      const ser_boot_state_t st = ser_boot_graph_state(&s_g, i);
+      if (s_rand[i].fn == NULL)
+      {
+        milestones++;
+        s_errors += (st != (dep_bad ? SER_BOOT_PENDING : SER_BOOT_OK)) ? 1u
+                                                                        : 0u;
+        continue;
+      }
+      if (dep_bad)
+      {
+        skipped++;
+        s_errors += (st != SER_BOOT_SKIPPED || s_runs[i] != 0u) ? 1u : 0u;
+        continue;
+      }
+      s_errors += (s_runs[i] != 1u) ? 1u : 0u;
+      s_errors +=
+          (st != (s_fail[i] ? SER_BOOT_FAILED : SER_BOOT_OK)) ? 1u : 0u;
+      bad |= s_fail[i] ? B(i) : 0u;
+    }
+  }
+  TEST_CHECK(s_errors == 0u);
+  printf("random graphs: %u, %u skipped steps, %u milestones\n",
+         (unsigned)RANDOM_GRAPHS, (unsigned)skipped, (unsigned)milestones);
+}
+
+int main(void)
+{
+  test_app_graph(true);
+  test_app_graph(false);
+  test_wait();
+  test_check();
+  test_random();
+  return test_done();
+}
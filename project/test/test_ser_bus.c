@@ -0,0 +1,325 @@
+/*
+ * services/ser_bus：主题槽位、订阅与统计（SER_BUS_HOST=1）
+ *
+ * 模拟时钟 168MHz（与 MCU 相同），32 位 now 与 64 位 now64 同源：
+ * - 平均发布频率：10Hz 发布 60s、1kHz 发布 10h，跨过多次 32 位回绕仍准确；清零后重新计
+ * - 发布 -> 读取延迟跨 32 位回绕；回调耗时、通知位与中断标志
+ * - seqlock：读期间被追上一圈时 read_end 失败并计 stale；
+ *   槽位被后来的 claim 占用时旧 commit 丢弃
+ * - 并发：一个线程持续发布 ranges（各路读数相同），另一个线程 ser_bus_read，
+ *   读到的负载必须一致（不撕裂）且周期号不倒退
+ * - 基准：publish / read 的主机耗时
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_bus.h"
+
+#define HZ 168000000u
+#define T0 ((uint64_t)0xFFFFFFFFu - HZ / 100u) /* 10ms 后第一次回绕 */
+#define CONC_PUBLISHES 2000000u
+#define BENCH_OPS 2000000u
+
+static uint64_t s_cyc;
+static uint32_t s_notes;
+static uint32_t s_note_bits;
+static bool s_note_isr;
+static bool s_isr;
+
+static uint32_t sim_now(void)
+{
+  return (uint32_t)s_cyc;
+}
+
+static uint64_t sim_now64(void)
+{
+  return s_cyc;
+}
+
+static void sim_notify(void *task, uint32_t bits, bool from_isr)
+{
+  (void)task;
+  s_notes++;
+  s_note_bits |= bits;
+  s_note_isr = from_isr;
+}
+
+static bool sim_in_isr(void)
+{
+  return s_isr;
+}
+
+static const ser_bus_port_t s_port = {
+    .now = sim_now,
+    .now64 = sim_now64,
+    .hz = HZ,
+    .notify = sim_notify,
+    .in_isr = sim_in_isr,
+};
+
+static uint32_t ms_to_cyc(uint32_t ms)
+{
+  return ms * (HZ / 1000u);
+}
+
+static void test_rate(void)
+{
+  ser_bus_stats_t st;
+  s_cyc = T0;
+  TEST_CHECK(ser_bus_init(&s_port));
+
+  /* 10Hz x 60s：间隔远超 32 位计数的 25.6s 周期 */
+  ser_bus_distance_t d = {0};
+  for (uint32_t i = 0; i < 600u; i++)
+  {
+    s_cyc += ms_to_cyc(100u);
+    TEST_CHECK(ser_bus_publish_distance(&d));
+  }
+  ser_bus_get_stats(SER_BUS_TOPIC_distance, &st);
+  TEST_CHECK(st.publishes == 600u && st.rate_mhz == 10000u);
+
+  /* 没有发布的主题 */
+  ser_bus_get_stats(SER_BUS_TOPIC_ranges, &st);
+  TEST_CHECK(st.publishes == 0u && st.rate_mhz == 0u);
+
+  /* 清零后 1kHz x 10h：publishes * hz * 1000 超出 64 位 */
+  ser_bus_reset_stats(SER_BUS_TOPIC_distance);
+  const uint32_t n = 36000000u;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    s_cyc += ms_to_cyc(1u);
+    (void)ser_bus_publish_distance(&d);
+  }
+  ser_bus_get_stats(SER_BUS_TOPIC_distance, &st);
+  TEST_CHECK(st.publishes == n && st.rate_mhz == 1000000u);
+  printf("rate after 10h at 1kHz: %u mHz\n", (unsigned)st.rate_mhz);
+
+  /* 无效参数 */
+  memset(&st, 0xFF, sizeof(st));
+  ser_bus_get_stats(SER_BUS_TOPIC_NUM, &st);
+  TEST_CHECK(st.publishes == 0u);
+  const ser_bus_port_t no64 = {.now = sim_now, .hz = HZ};
+  TEST_CHECK(!ser_bus_init(&no64));
+}
+
+static uint32_t s_cb_calls;
+static int32_t s_cb_mm;
+
+static void cb_distance(ser_bus_topic_t topic, const void *payload, void *arg)
+{
+  TEST_CHECK(topic == SER_BUS_TOPIC_distance && arg == &s_cb_calls);
+  s_cb_calls++;
+  s_cb_mm = ((const ser_bus_distance_t *)payload)->mm;
+  s_cyc += 168u * 7u; /* 回调耗时 7us */
+}
+
+static void test_subscribe_latency(void)
+{
+  static ser_bus_sub_t cb_sub = {.cb = cb_distance, .arg = &s_cb_calls};
+  static ser_bus_sub_t task_sub = {.task = (void *)1, .bits = 0x10u};
+  static ser_bus_sub_t empty_sub;
+  ser_bus_stats_t st;
+
+  s_cyc = T0;
+  TEST_CHECK(ser_bus_init(&s_port));
+  TEST_CHECK(ser_bus_subscribe(SER_BUS_TOPIC_distance, &cb_sub));
+  TEST_CHECK(ser_bus_subscribe(SER_BUS_TOPIC_distance, &task_sub));
+  TEST_CHECK(!ser_bus_subscribe(SER_BUS_TOPIC_distance, &cb_sub));
+  TEST_CHECK(!ser_bus_subscribe(SER_BUS_TOPIC_distance, &empty_sub));
+
+  ser_bus_distance_t d;
+  TEST_CHECK(!ser_bus_read_distance(&d)); /* 从未发布 */
+  TEST_CHECK(ser_bus_seq(SER_BUS_TOPIC_distance) == 0u);
+
+  /* 中断里发布（零拷贝 claim/commit），任务里读；中间跨过 32 位回绕 */
+  s_isr = true;
+  uint32_t ticket;
+  ser_bus_distance_t *slot = ser_bus_claim_distance(&ticket);
+  TEST_CHECK(slot != NULL);
+  slot->mm = 1234;
+  ser_bus_commit(SER_BUS_TOPIC_distance, ticket);
+  s_isr = false;
+  TEST_CHECK(s_cb_calls == 1u && s_cb_mm == 1234);
+  TEST_CHECK(s_notes == 1u && s_note_bits == 0x10u && s_note_isr);
+
+  s_cyc += ms_to_cyc(30u);
+  TEST_CHECK(ser_bus_read_distance(&d) && d.mm == 1234);
+  TEST_CHECK(ser_bus_seq(SER_BUS_TOPIC_distance) == ticket);
+
+  ser_bus_get_stats(SER_BUS_TOPIC_distance, &st);
+  TEST_CHECK(st.callbacks == 1u && st.notifies == 1u && st.cb_max_us == 7u);
+  TEST_CHECK(st.reads == 1u && st.lat_last_us == 30007u &&
+             st.lat_max_us == 30007u && st.lat_sum_us == 30007u);
+
+  TEST_CHECK(ser_bus_payload_size(SER_BUS_TOPIC_ranges) ==
+             sizeof(ser_bus_ranges_t));
+  TEST_CHECK(strcmp(ser_bus_topic_name(SER_BUS_TOPIC_ranges), "ranges") == 0);
+  TEST_CHECK(ser_bus_topic_name(SER_BUS_TOPIC_NUM) == NULL);
+}
+
+static void test_seqlock(void)
+{
+  ser_bus_stats_t st;
+  s_cyc = T0;
+  TEST_CHECK(ser_bus_init(&s_port));
+
+  ser_bus_distance_t d = {.mm = 1};
+  TEST_CHECK(ser_bus_publish_distance(&d));
+
+  /* 读期间再发布 SLOTS-1 次：槽位未被复用，读有效 */
+  uint32_t token;
+  const ser_bus_distance_t *p =
+      ser_bus_read_begin(SER_BUS_TOPIC_distance, &token);
+  TEST_CHECK(p != NULL && p->mm == 1);
+  for (uint32_t i = 0; i + 1u < SER_BUS_SLOTS; i++)
+  {
+    d.mm = 100 + (int32_t)i;
+    TEST_CHECK(ser_bus_publish_distance(&d));
+  }
+  TEST_CHECK(p->mm == 1);
+  TEST_CHECK(ser_bus_read_end(SER_BUS_TOPIC_distance, token));
+
+  /* 再多一次：被追上一圈 */
+  p = ser_bus_read_begin(SER_BUS_TOPIC_distance, &token);
+  for (uint32_t i = 0; i < SER_BUS_SLOTS; i++)
+  {
+    d.mm = 200 + (int32_t)i;
+    TEST_CHECK(ser_bus_publish_distance(&d));
+  }
+  TEST_CHECK(!ser_bus_read_end(SER_BUS_TOPIC_distance, token));
+  TEST_CHECK(ser_bus_read_distance(&d) &&
+             d.mm == 200 + (int32_t)SER_BUS_SLOTS - 1);
+
+  /* 发布者之间相差一整圈：先 claim 的 commit 被丢弃 */
+  ser_bus_get_stats(SER_BUS_TOPIC_distance, &st);
+  const uint32_t pubs = st.publishes;
+  uint32_t old_ticket;
+  ser_bus_distance_t *old = ser_bus_claim_distance(&old_ticket);
+  old->mm = -5;
+  for (uint32_t i = 0; i < SER_BUS_SLOTS; i++)
+  {
+    d.mm = 300 + (int32_t)i;
+    TEST_CHECK(ser_bus_publish_distance(&d));
+  }
+  const uint32_t seq = ser_bus_seq(SER_BUS_TOPIC_distance);
+  ser_bus_commit(SER_BUS_TOPIC_distance, old_ticket);
+  TEST_CHECK(ser_bus_seq(SER_BUS_TOPIC_distance) == seq);
+  ser_bus_get_stats(SER_BUS_TOPIC_distance, &st);
+  TEST_CHECK(st.publishes == pubs + SER_BUS_SLOTS);
+  TEST_CHECK(st.stale == 1u);
+  TEST_CHECK(ser_bus_read_distance(&d) &&
+             d.mm == 300 + (int32_t)SER_BUS_SLOTS - 1);
+}
+
+/* ==========================
+ * 并发读写
+ * ========================== */
+static volatile bool s_stop;
+
+static uint32_t real_now(void)
+{
+  return (uint32_t)test_now_ns();
+}
+
+static uint64_t real_now64(void)
+{
+  return test_now_ns();
+}
+
+static void *publisher(void *arg)
+{
+  (void)arg;
+  for (uint32_t c = 1; c <= CONC_PUBLISHES; c++)
+  {
+    uint32_t ticket;
+    ser_bus_ranges_t *r = ser_bus_claim_ranges(&ticket);
+    r->cycle = c;
+    r->n = SER_BUS_RANGES_MAX;
+    for (uint32_t i = 0; i < SER_BUS_RANGES_MAX; i++)
+    {
+      r->mm[i] = (int32_t)c;
+    }
+    ser_bus_commit(SER_BUS_TOPIC_ranges, ticket);
+  }
+  s_stop = true;
+  return NULL;
+}
+
+static void test_concurrent(void)
+{
+  static const ser_bus_port_t port = {
+      .now = real_now, .now64 = real_now64, .hz = 1000000000u};
+  TEST_CHECK(ser_bus_init(&port));
+  s_stop = false;
+
+  pthread_t th;
+  TEST_CHECK(pthread_create(&th, NULL, publisher, NULL) == 0);
+
+  uint32_t reads = 0;
+  uint32_t torn = 0;
+  uint32_t backwards = 0;
+  uint32_t last = 0;
+  while (!s_stop)
+  {
+    ser_bus_ranges_t r;
+    if (!ser_bus_read_ranges(&r))
+    {
+      continue;
+    }
+    reads++;
+    for (uint32_t i = 0; i < SER_BUS_RANGES_MAX; i++)
+    {
+      torn += (r.mm[i] != (int32_t)r.cycle) ? 1u : 0u;
+    }
+    backwards += (r.cycle < last) ? 1u : 0u;
+    last = r.cycle;
+  }
+  (void)pthread_join(th, NULL);
+
+  ser_bus_stats_t st;
+  ser_bus_get_stats(SER_BUS_TOPIC_ranges, &st);
+  printf("concurrent: %u reads, %u retried (stale), %u publishes\n",
+         (unsigned)reads, (unsigned)st.stale, (unsigned)st.publishes);
+  TEST_CHECK(torn == 0u && backwards == 0u);
+  TEST_CHECK(st.publishes == CONC_PUBLISHES);
+}
+
+static void bench(void)
+{
+  static const ser_bus_port_t port = {
+      .now = real_now, .now64 = real_now64, .hz = 1000000000u};
+  TEST_CHECK(ser_bus_init(&port));
+
+  ser_bus_distance_t d = {0};
+  uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_OPS; i++)
+  {
+    d.mm = (int32_t)i;
+    (void)ser_bus_publish_distance(&d);
+  }
+  const double pub_ns = (double)(test_now_ns() - t0) / BENCH_OPS;
+
+  t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_OPS; i++)
+  {
+    (void)ser_bus_read_distance(&d);
+  }
+  const double read_ns = (double)(test_now_ns() - t0) / BENCH_OPS;
+  TEST_CHECK(d.mm == (int32_t)BENCH_OPS - 1);
+  printf("publish %.1f ns, read %.1f ns (host)\n", pub_ns, read_ns);
+}
+
+int main(void)
+{
+  test_rate();
+  test_subscribe_latency();
+  test_seqlock();
+  test_concurrent();
+  bench();
+  return test_done();
+}
@@ -0,0 +1,338 @@
+/*
+ * services/ser_img565：带重启行索引的压缩 RGB565 容器
+ *
+ * - 随机往返：宽高、源行距、重启间隔随机，编码长度不超过 bound，cap 少 1 字节时返回 0；
+ *   整图与随机矩形 decode_area 与源相同，目标缓冲两侧哨兵不被写
+ * - 游标：seek 多解的行数为 y % key_rows，随后按随机行数分条带 read 进同一块
+ *   条带缓冲（与 LVGL 解码器相同的用法），逐条带与源相同
+ * - 非法容器：magic / 尺寸 / 索引个数 / 偏移不递增或越界、截断的码流，
+ *   open 或解码返回 false；越界的 seek / read 返回 false
+ * 基准：真实启动界面（ser_lvgl_ui_boot，800x480）的压缩后大小，整图解码与
+ * 几种裁剪窗口解码的耗时
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_img565.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_rle565.h"
+
+#define ROUNDS 2000u
+#define MAX_W 200u
+#define MAX_H 70u
+#define MAX_KEY 20u
+#define MAX_BAND 17u
+#define GUARD 16u
+#define DISP_W 800u
+#define DISP_H 480u
+#define BENCH_REPS 50u
+
+#define ENC_CAP                                                                \
+  (SER_IMG565_HDR_BYTES + MAX_H * 4u + MAX_H * SER_RLE565_ROW_MAX_BYTES(MAX_W))
+
+static uint16_t s_src[MAX_H * (MAX_W + 8u)];
+static uint16_t s_dst[GUARD + MAX_H * MAX_W + GUARD];
+static uint16_t s_band[MAX_BAND * MAX_W];
+static uint8_t s_enc[ENC_CAP];
+
+static uint16_t s_fb[DISP_W * DISP_H];
+static uint16_t s_fb_dec[DISP_W * DISP_H];
+static uint8_t s_fb_enc[SER_IMG565_HDR_BYTES + DISP_H * 4u +
+                        DISP_H * SER_RLE565_ROW_MAX_BYTES(DISP_W)];
+
+/* 像素按 随机 / 同左 / 同上 / 常量 混合，各操作码都会出现 */
+static void fill_random(uint32_t w, uint32_t h, uint32_t stride)
+{
+  const uint16_t k = (uint16_t)test_rand();
+  for (uint32_t y = 0; y < h; y++)
+  {
+    for (uint32_t x = 0; x < w; x++)
+    {
+      uint16_t *p = &s_src[y * stride + x];
+      switch (test_rand_n(4u))
+      {
+      case 0:
+        *p = (uint16_t)test_rand();
+        break;
+      case 1:
+        *p = (x > 0u) ? p[-1] : k;
+        break;
+      case 2:
+        *p = (y > 0u) ? p[-(int32_t)stride] : k;
+        break;
+      default:
+        *p = k;
+        break;
+      }
+    }
+  }
+}
+
+static void set_guards(void)
+{
+  for (uint32_t i = 0; i < GUARD; i++)
+  {
+    s_dst[i] = 0xDEADu;
+    s_dst[GUARD + MAX_H * MAX_W + i] = 0xDEADu;
+  }
+}
+
+static bool guards_intact(void)
+{
+  for (uint32_t i = 0; i < GUARD; i++)
+  {
+    if (s_dst[i] != 0xDEADu || s_dst[GUARD + MAX_H * MAX_W + i] != 0xDEADu)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* dst（行距 dst_stride）的 w x h 与源 (x1, y1) 起的矩形相同 */
+static bool same_as_src(const uint16_t *dst, uint32_t dst_stride,
+                        uint32_t stride, uint32_t x1, uint32_t y1, uint32_t w,
+                        uint32_t h)
+{
+  for (uint32_t y = 0; y < h; y++)
+  {
+    if (memcmp(&dst[y * dst_stride], &s_src[(y1 + y) * stride + x1], w * 2u) !=
+        0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void test_round_trip(void)
+{
+  uint16_t *dst = &s_dst[GUARD];
+  uint32_t fails = 0;
+
+  for (uint32_t it = 0; it < ROUNDS; it++)
+  {
+    const uint32_t w = 1u + test_rand_n(MAX_W);
+    const uint32_t h = 1u + test_rand_n(MAX_H);
+    const uint32_t stride = w + test_rand_n(8u);
+    const uint32_t key_rows = 1u + test_rand_n(MAX_KEY);
+    fill_random(w, h, stride);
+
+    const uint32_t cap = ser_img565_bound(w, h, key_rows);
+    const uint32_t n =
+        ser_img565_encode(s_src, w, h, stride, key_rows, s_enc, cap);
+    fails += (n == 0u || n > cap) ? 1u : 0u;
+    fails += (ser_img565_encode(s_src, w, h, stride, key_rows, s_enc,
+                                n - 1u) != 0u)
+                 ? 1u
+                 : 0u;
+    (void)ser_img565_encode(s_src, w, h, stride, key_rows, s_enc, n);
+
+    ser_img565_t img;
+    if (!ser_img565_open(&img, s_enc, n) || img.w != w || img.h != h ||
+        img.key_rows != key_rows)
+    {
+      fails++;
+      continue;
+    }
+
+    /* 整图 */
+    set_guards();
+    fails += ser_img565_decode_area(&img, 0, 0, w - 1u, h - 1u, dst, w) ? 0u
+                                                                        : 1u;
+    fails += same_as_src(dst, w, stride, 0, 0, w, h) ? 0u : 1u;
+
+    /* 随机矩形 */
+    const uint32_t x1 = test_rand_n(w);
+    const uint32_t x2 = x1 + test_rand_n(w - x1);
+    const uint32_t y1 = test_rand_n(h);
+    const uint32_t y2 = y1 + test_rand_n(h - y1);
+    const uint32_t cw = x2 - x1 + 1u;
+    fails += ser_img565_decode_area(&img, x1, y1, x2, y2, dst, cw) ? 0u : 1u;
+    fails += same_as_src(dst, cw, stride, x1, y1, cw, y2 - y1 + 1u) ? 0u : 1u;
+    fails += guards_intact() ? 0u : 1u;
+
+    /* 游标：定位行与各条带都写进同一块条带缓冲 */
+    ser_img565_cursor_t cur;
+    fails += ser_img565_seek(&cur, &img, x1, x2, y1, s_band) ? 0u : 1u;
+    fails += (cur.skipped == y1 % key_rows) ? 0u : 1u;
+    uint32_t y = y1;
+    while (y <= y2)
+    {
+      uint32_t rows = 1u + test_rand_n(MAX_BAND);
+      rows = (rows > y2 - y + 1u) ? y2 - y + 1u : rows;
+      if (!ser_img565_read(&cur, s_band, cw, rows))
+      {
+        fails++;
+        break;
+      }
+      fails += same_as_src(s_band, cw, stride, x1, y, cw, rows) ? 0u : 1u;
+      y += rows;
+    }
+    /* 解到底之后再读越界 */
+    if (y2 == h - 1u)
+    {
+      fails += ser_img565_read(&cur, s_band, cw, 1u) ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(fails == 0u);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static void test_reject(void)
+{
+  const uint32_t w = 37u;
+  const uint32_t h = 50u;
+  const uint32_t key_rows = 8u;
+  fill_random(w, h, w);
+  const uint32_t n = ser_img565_encode(s_src, w, h, w, key_rows, s_enc,
+                                       ser_img565_bound(w, h, key_rows));
+  const uint32_t head = SER_IMG565_HDR_BYTES + 7u * 4u;
+  static uint8_t bad[ENC_CAP];
+  ser_img565_t img;
+
+  /* 参数 */
+  TEST_CHECK(ser_img565_encode(s_src, 0u, h, w, key_rows, s_enc, n) == 0u);
+  TEST_CHECK(ser_img565_encode(s_src, w, h, w, 0u, s_enc, n) == 0u);
+  TEST_CHECK(ser_img565_bound(w, h, 0u) == 0u);
+  TEST_CHECK(!ser_img565_open(&img, s_enc, SER_IMG565_HDR_BYTES - 1u));
+  TEST_CHECK(!ser_img565_open(&img, s_enc, head - 1u));
+  TEST_CHECK(ser_img565_open(&img, s_enc, n));
+
+  /* 头字段：magic、宽为 0、索引个数与高度不符 */
+  memcpy(bad, s_enc, n);
+  bad[0] ^= 1u;
+  TEST_CHECK(!ser_img565_open(&img, bad, n));
+  memcpy(bad, s_enc, n);
+  bad[4] = 0u;
+  bad[5] = 0u;
+  TEST_CHECK(!ser_img565_open(&img, bad, n));
+  memcpy(bad, s_enc, n);
+  bad[10] ^= 1u;
+  TEST_CHECK(!ser_img565_open(&img, bad, n));
+
+  /* 偏移不递增、越过码流 */
+  memcpy(bad, s_enc, n);
+  put_u32(&bad[SER_IMG565_HDR_BYTES + 3u * 4u], 0u);
+  TEST_CHECK(!ser_img565_open(&img, bad, n));
+  memcpy(bad, s_enc, n);
+  put_u32(&bad[SER_IMG565_HDR_BYTES + 6u * 4u], n - head);
+  TEST_CHECK(!ser_img565_open(&img, bad, n));
+
+  /* 截断的码流：最后一个重启行仍在范围内时 open 成功，解到末尾失败 */
+  TEST_CHECK(ser_img565_open(&img, s_enc, n - 1u));
+  TEST_CHECK(!ser_img565_decode_area(&img, 0, 0, w - 1u, h - 1u, &s_dst[GUARD],
+                                     w));
+
+  /* 越界的 seek / read */
+  ser_img565_cursor_t cur;
+  TEST_CHECK(ser_img565_open(&img, s_enc, n));
+  TEST_CHECK(!ser_img565_seek(&cur, &img, 5u, 4u, 0u, s_band));
+  TEST_CHECK(!ser_img565_seek(&cur, &img, 0u, w, 0u, s_band));
+  TEST_CHECK(!ser_img565_seek(&cur, &img, 0u, 0u, h, s_band));
+  TEST_CHECK(ser_img565_seek(&cur, &img, 0u, w - 1u, h - 2u, s_band));
+  TEST_CHECK(!ser_img565_read(&cur, s_band, w, 3u));
+  TEST_CHECK(!ser_img565_decode_area(&img, 0u, 9u, w - 1u, 8u, s_band, w));
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static void bench_boot_screen(void)
+{
+  static ser_lvgl_ui_boot_t ui;
+  static const struct
+  {
+    const char *name;
+    uint32_t x1;
+    uint32_t y1;
+    uint32_t x2;
+    uint32_t y2;
+  } clips[] = {
+      {"full 800x480", 0u, 0u, DISP_W - 1u, DISP_H - 1u},
+      {"center 400x240", 200u, 120u, 599u, 359u},
+      {"bottom 800x60", 0u, 420u, DISP_W - 1u, DISP_H - 1u},
+      {"right 100x480", 700u, 0u, DISP_W - 1u, DISP_H - 1u},
+  };
+
+  lv_init();
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  ser_lvgl_ui_boot_create(&ui);
+  ser_lvgl_ui_boot_set_distance(&ui, 1234);
+  lv_refr_now(disp);
+
+  const uint32_t n =
+      ser_img565_encode(s_fb, DISP_W, DISP_H, DISP_W, SER_IMG565_KEY_ROWS,
+                        s_fb_enc, sizeof(s_fb_enc));
+  ser_img565_t img;
+  TEST_CHECK(n != 0u && ser_img565_open(&img, s_fb_enc, n));
+  printf("boot screen %ux%u: %u -> %u bytes (%.1fx), key rows %u\n",
+         (unsigned)DISP_W, (unsigned)DISP_H, (unsigned)sizeof(s_fb),
+         (unsigned)n, (double)sizeof(s_fb) / n,
+         (unsigned)SER_IMG565_KEY_ROWS);
+
+  double full_ns = 0.0;
+  for (uint32_t c = 0; c < sizeof(clips) / sizeof(clips[0]); c++)
+  {
+    const uint32_t cw = clips[c].x2 - clips[c].x1 + 1u;
+    const uint32_t ch = clips[c].y2 - clips[c].y1 + 1u;
+    bool ok = true;
+    const uint64_t t0 = test_now_ns();
+    for (uint32_t i = 0; i < BENCH_REPS; i++)
+    {
+      ok = ok && ser_img565_decode_area(&img, clips[c].x1, clips[c].y1,
+                                        clips[c].x2, clips[c].y2, s_fb_dec,
+                                        cw);
+    }
+    const double ns = (double)(test_now_ns() - t0) / BENCH_REPS;
+    TEST_CHECK(ok);
+    for (uint32_t y = 0; y < ch; y++)
+    {
+      ok = ok && memcmp(&s_fb_dec[y * cw],
+                        &s_fb[(clips[c].y1 + y) * DISP_W + clips[c].x1],
+                        cw * 2u) == 0;
+    }
+    TEST_CHECK(ok);
+
+    if (c == 0u)
+    {
+      full_ns = ns;
+      printf("%-15s %6.0f us, %.0f MB/s out (host)\n", clips[c].name,
+             ns / 1e3, (double)sizeof(s_fb) / ns * 1e3);
+      continue;
+    }
+    printf("%-15s %6.0f us (%.1fx less than full decode, host)\n",
+           clips[c].name, ns / 1e3, full_ns / ns);
+  }
+}
+
+int main(void)
+{
+  test_seed(50u);
+  test_round_trip();
+  test_reject();
+  bench_boot_screen();
+  return test_done();
+}
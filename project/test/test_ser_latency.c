@@ -0,0 +1,176 @@
+/*
+ * services/ser_latency：touch-to-photon 各段直方图
+ *
+ * 用模拟的触摸/刷新序列驱动（1 cycle = 1us，时间从 32 位回绕点之前开始）：
+ * - 各段耗时随机，已知真值；p50/p95/p99 按桶上界报告，
+ *   必须 >= 真值且不超过真值的 1/8 + 1us（分桶误差）；min/max/count 精确
+ * - 状态机：上一个样本未上屏时新输入只计 coalesced；事件回调完成前开始的刷新、
+ *   没有 flush 的刷新都不结束样本；超时未上屏计 no_frame
+ * - ser_latency_format 截断时返回实际写入长度
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_latency.h"
+
+#define SAMPLES 2000u
+#define T0 0xFFF00000u /* 约 1s 后回绕 */
+
+static uint32_t s_truth[SER_LATENCY_STAGE_NUM][SAMPLES];
+
+/* 扫描估算替身：按行号线性，便于核对 */
+static uint32_t scanout_us(int32_t y1, int32_t y2)
+{
+  (void)y1;
+  return 100u + (uint32_t)y2 * 10u;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+  const uint32_t x = *(const uint32_t *)a;
+  const uint32_t y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+static uint32_t truth_pct(uint32_t stage, uint32_t pct)
+{
+  uint32_t rank = (SAMPLES * pct + 99u) / 100u;
+  return s_truth[stage][rank - 1u];
+}
+
+static bool pct_ok(uint32_t got, uint32_t truth)
+{
+  return got >= truth && got <= truth + truth / 8u + 1u;
+}
+
+static void test_histograms(void)
+{
+  ser_latency_init(1000000u, scanout_us);
+  test_seed(33u);
+
+  uint32_t t = T0;
+  for (uint32_t i = 0; i < SAMPLES; i++)
+  {
+    /* 跨越几个数量级，覆盖多个 2 的幂区间 */
+    const uint32_t touch = 200u + test_rand_n(800u);
+    const uint32_t indev = 50u + test_rand_n(test_rand_n(4u) == 0u ? 5000u : 300u);
+    const uint32_t wait = test_rand_n(33000u);
+    const uint32_t render = 500u + test_rand_n(15000u);
+    const int32_t y2 = (int32_t)test_rand_n(480u);
+    const uint32_t tail = test_rand_n(50u);
+
+    const uint32_t t_int = t;
+    const uint32_t t_read = t_int + touch;
+    ser_latency_input(t_int, t_read, true);
+    ser_latency_input(t_int, t_read + 1u, false); /* 坐标未变：忽略 */
+    const uint32_t t_input = t_read + indev;
+    ser_latency_input_done(t_input);
+
+    /* 一次空刷新不结束样本 */
+    ser_latency_refr_start(t_input + wait / 2u);
+    ser_latency_refr_ready(t_input + wait / 2u);
+
+    const uint32_t t_refr = t_input + wait;
+    ser_latency_refr_start(t_refr);
+    ser_latency_flush(t_refr + render / 2u, y2 / 2, y2 / 2);
+    ser_latency_flush(t_refr + render, y2 / 4, y2);
+    ser_latency_refr_ready(t_refr + render + tail);
+
+    const uint32_t scan = scanout_us(0, y2) + tail;
+    s_truth[SER_LATENCY_TOUCH][i] = touch;
+    s_truth[SER_LATENCY_INDEV][i] = indev;
+    s_truth[SER_LATENCY_WAIT][i] = wait;
+    s_truth[SER_LATENCY_RENDER][i] = render;
+    s_truth[SER_LATENCY_SCANOUT][i] = scan;
+    s_truth[SER_LATENCY_TOTAL][i] = touch + indev + wait + render + scan;
+
+    t = t_refr + render + tail + 1000u;
+  }
+  TEST_CHECK(t < T0); /* 确实跨过了回绕点 */
+
+  ser_latency_stats_t st;
+  ser_latency_get_stats(&st);
+  TEST_CHECK(st.samples == SAMPLES);
+  TEST_CHECK(st.coalesced == 0u && st.no_frame == 0u);
+
+  for (uint32_t s = 0; s < SER_LATENCY_STAGE_NUM; s++)
+  {
+    qsort(s_truth[s], SAMPLES, sizeof(uint32_t), cmp_u32);
+    ser_latency_summary_t sum;
+    TEST_CHECK(ser_latency_get((ser_latency_stage_t)s, &sum));
+    TEST_CHECK(sum.count == SAMPLES);
+    TEST_CHECK(sum.min_us == s_truth[s][0]);
+    TEST_CHECK(sum.max_us == s_truth[s][SAMPLES - 1u]);
+    TEST_CHECK(pct_ok(sum.p50_us, truth_pct(s, 50u)));
+    TEST_CHECK(pct_ok(sum.p95_us, truth_pct(s, 95u)));
+    TEST_CHECK(pct_ok(sum.p99_us, truth_pct(s, 99u)));
+  }
+
+  char buf[512];
+  const uint32_t n = ser_latency_format(buf, sizeof(buf));
+  TEST_CHECK(n == strlen(buf));
+  fputs(buf, stdout);
+
+  /* 截断 */
+  char small[40];
+  TEST_CHECK(ser_latency_format(small, sizeof(small)) == strlen(small));
+  TEST_CHECK(strlen(small) == sizeof(small) - 1u);
+}
+
+static void test_state_machine(void)
+{
+  ser_latency_init(1000000u, NULL);
+  ser_latency_stats_t st;
+  ser_latency_summary_t sum;
+
+  /* 未上屏期间的第二个输入只计数；回调完成前开始的刷新不算 */
+  ser_latency_input(1000u, 1100u, true);
+  ser_latency_input(2000u, 2100u, true);
+  ser_latency_refr_start(1150u);
+  ser_latency_flush(1160u, 0, 10);
+  ser_latency_refr_ready(1170u);
+  ser_latency_input_done(1200u);
+  ser_latency_refr_start(1300u);
+  ser_latency_flush(1400u, 0, 10);
+  ser_latency_refr_ready(1400u);
+  ser_latency_get_stats(&st);
+  TEST_CHECK(st.samples == 1u && st.coalesced == 1u);
+  TEST_CHECK(ser_latency_get(SER_LATENCY_TOTAL, &sum));
+  TEST_CHECK(sum.max_us == 400u);
+  TEST_CHECK(ser_latency_get(SER_LATENCY_WAIT, &sum));
+  TEST_CHECK(sum.max_us == 100u);
+
+  /* 超时：只有空刷新，超过 SER_LATENCY_TIMEOUT_MS 后丢弃 */
+  const uint32_t t = 10000u;
+  const uint32_t late = t + SER_LATENCY_TIMEOUT_MS * 1000u + 1u;
+  ser_latency_input(t, t + 100u, true);
+  ser_latency_input_done(t + 200u);
+  ser_latency_refr_start(late);
+  ser_latency_refr_ready(late);
+  ser_latency_get_stats(&st);
+  TEST_CHECK(st.no_frame == 1u && st.samples == 1u);
+
+  /* 超时后的新输入开始新样本（旧样本计 no_frame） */
+  ser_latency_input(t, t + 100u, true);
+  ser_latency_input(late, late + 100u, true);
+  ser_latency_input_done(late + 150u);
+  ser_latency_refr_start(late + 200u);
+  ser_latency_flush(late + 300u, 5, 5);
+  ser_latency_refr_ready(late + 300u);
+  ser_latency_get_stats(&st);
+  TEST_CHECK(st.no_frame == 2u && st.samples == 2u && st.coalesced == 1u);
+
+  ser_latency_reset();
+  TEST_CHECK(!ser_latency_get(SER_LATENCY_TOTAL, &sum));
+}
+
+int main(void)
+{
+  test_histograms();
+  test_state_machine();
+  return test_done();
+}
@@ -0,0 +1,441 @@
+/*
+ * services/ser_lvgl_anim：批量样式属性动画
+ *
+ * - 取值与 lv_anim 对齐：5 种路径 x 5 种时长 x 4 种区间（含反向、越过 1024 步长），
+ *   单次、带回放与重复、重复不回放、带延时，每毫秒比较一次，误差不超过区间的
+ *   4/1024（另加 1 像素取整），250 像素位移不超过 1 像素；跨轮那一帧停在终值
+ * - 语义：启动即应用起始值；同对象同属性替换；stop 单个 / 全部；对象删除后动画移除；
+ *   参数非法、数组满时失败并计数；结束后定时器暂停；opa 夹紧到 0..255
+ * - 合并刷新：同一对象每帧至多一次样式刷新
+ * 基准：N 个动画（每对象 2 个属性）lv_anim / ser_lvgl_anim 的动画阶段耗时与每帧失效次数
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "src/core/lv_refr_private.h"
+#include "ser_lvgl_anim.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define BENCH_FRAMES 1000u
+
+typedef struct
+{
+  uint32_t worst_q10;
+  uint32_t worst_px_250;
+  double anim_ns_per_step;
+  double inv_per_frame;
+  uint32_t child_fails;
+} run_result_t;
+
+static uint8_t s_buf[DISP_W * 40 * 2];
+static uint32_t s_ms;
+static uint32_t s_inv;
+static run_result_t s_res;
+
+static const lv_anim_path_cb_t s_lv_paths[SER_LVGL_ANIM_PATH_COUNT] = {
+    lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out,
+    lv_anim_path_ease_in_out, lv_anim_path_overshoot};
+
+static uint32_t tick_cb(void)
+{
+  return s_ms;
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static void inv_cb(lv_event_t *e)
+{
+  (void)e;
+  s_inv++;
+}
+
+static lv_display_t *make_display(void)
+{
+  lv_init();
+  lv_tick_set_cb(tick_cb);
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_buf, NULL, sizeof(s_buf),
+                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  return disp;
+}
+
+static void set_x(void *obj, int32_t v)
+{
+  lv_obj_set_x((lv_obj_t *)obj, v);
+}
+
+static void set_bg_opa(void *obj, int32_t v)
+{
+  lv_obj_set_style_bg_opa((lv_obj_t *)obj, (lv_opa_t)v, 0);
+}
+
+/* ---- 取值与 lv_anim 对齐 ---- */
+
+/* 两个动画定时器默认 33 ms 一跳且相位不同；逐毫秒比较时都改成每毫秒一跳 */
+static void timers_every_ms(void)
+{
+  for (lv_timer_t *t = lv_timer_get_next(NULL); t != NULL;
+       t = lv_timer_get_next(t))
+  {
+    lv_timer_set_period(t, 1u);
+  }
+}
+
+typedef struct
+{
+  uint16_t reverse_ms;
+  uint16_t delay_ms;
+  uint16_t repeat;
+} timing_t;
+
+static void run_values(void *arg)
+{
+  (void)arg;
+  static const uint16_t durs[] = {50u, 160u, 333u, 1000u, 4000u};
+  static const int32_t ranges[][2] = {
+      {0, 250}, {300, -200}, {-1000, 3000}, {0, 10}};
+  static const timing_t timings[] = {
+      {0u, 0u, 1u}, {0u, 70u, 1u}, {1u, 0u, 3u}, {0u, 0u, 2u}};
+
+  lv_display_t *disp = make_display();
+  lv_display_delete_refr_timer(disp);
+  lv_obj_t *scr = lv_screen_active();
+
+  uint32_t worst_q10 = 0;
+  uint32_t worst_px_250 = 0;
+  for (uint32_t ti = 0; ti < sizeof(timings) / sizeof(timings[0]); ti++)
+  {
+    for (uint32_t p = 0; p < SER_LVGL_ANIM_PATH_COUNT; p++)
+    {
+      for (uint32_t di = 0; di < sizeof(durs) / sizeof(durs[0]); di++)
+      {
+        for (uint32_t ri = 0; ri < sizeof(ranges) / sizeof(ranges[0]); ri++)
+        {
+          const uint16_t dur = durs[di];
+          /* 回放时长取正向的一半（至少 1） */
+          const uint16_t rev =
+              (timings[ti].reverse_ms != 0u) ? (uint16_t)(dur / 2u + 1u) : 0u;
+          lv_obj_t *a = lv_obj_create(scr);
+          lv_obj_t *b = lv_obj_create(scr);
+
+          lv_anim_t an;
+          lv_anim_init(&an);
+          lv_anim_set_var(&an, a);
+          lv_anim_set_exec_cb(&an, set_x);
+          lv_anim_set_values(&an, ranges[ri][0], ranges[ri][1]);
+          lv_anim_set_duration(&an, dur);
+          lv_anim_set_reverse_duration(&an, rev);
+          lv_anim_set_delay(&an, timings[ti].delay_ms);
+          lv_anim_set_repeat_count(&an, timings[ti].repeat);
+          lv_anim_set_path_cb(&an, s_lv_paths[p]);
+          (void)lv_anim_start(&an);
+
+          const ser_lvgl_anim_cfg_t c = {
+              .obj = b,
+              .prop = SER_LVGL_ANIM_X,
+              .path = (ser_lvgl_anim_path_t)p,
+              .from = ranges[ri][0],
+              .to = ranges[ri][1],
+              .duration_ms = dur,
+              .reverse_ms = rev,
+              .delay_ms = timings[ti].delay_ms,
+              .repeat = timings[ti].repeat,
+          };
+          TEST_CHECK(ser_lvgl_anim_start(&c));
+          timers_every_ms();
+
+          const uint32_t range =
+              (uint32_t)labs((long)(ranges[ri][1] - ranges[ri][0]));
+          const uint32_t total = timings[ti].delay_ms +
+                                 (uint32_t)(dur + rev) * timings[ti].repeat;
+          (void)lv_timer_handler();
+          for (uint32_t t = 0; t <= total + 40u; t++)
+          {
+            s_ms++;
+            (void)lv_timer_handler();
+            const uint32_t e = (uint32_t)labs(
+                (long)(lv_obj_get_style_x(a, 0) - lv_obj_get_style_x(b, 0)));
+            /* 误差折算成区间的 1/1024（向上取整），先扣掉 1 像素的取整 */
+            const uint32_t e_q10 =
+                (e > 1u) ? ((e - 1u) * 1024u + range - 1u) / range : 0u;
+            worst_q10 = (e_q10 > worst_q10) ? e_q10 : worst_q10;
+            if (ri == 0u)
+            {
+              worst_px_250 = (e > worst_px_250) ? e : worst_px_250;
+            }
+          }
+          /* 都已结束，停在同一个终值 */
+          TEST_CHECK(lv_obj_get_style_x(a, 0) == lv_obj_get_style_x(b, 0));
+          TEST_CHECK(ser_lvgl_anim_count() == 0u);
+          lv_obj_delete(a);
+          lv_obj_delete(b);
+        }
+      }
+    }
+  }
+  s_res.worst_q10 = worst_q10;
+  s_res.worst_px_250 = worst_px_250;
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+/* ---- 语义 ---- */
+
+static void run_api(void *arg)
+{
+  (void)arg;
+  lv_display_t *disp = make_display();
+  lv_display_delete_refr_timer(disp);
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_t *a = lv_obj_create(scr);
+  lv_obj_t *b = lv_obj_create(scr);
+
+  ser_lvgl_anim_cfg_t c = {.obj = a,
+                           .prop = SER_LVGL_ANIM_X,
+                           .path = SER_LVGL_ANIM_PATH_LINEAR,
+                           .from = 10,
+                           .to = 110,
+                           .duration_ms = 100u};
+
+  /* 非法参数 */
+  TEST_CHECK(!ser_lvgl_anim_start(NULL));
+  ser_lvgl_anim_cfg_t bad = c;
+  bad.obj = NULL;
+  TEST_CHECK(!ser_lvgl_anim_start(&bad));
+  bad = c;
+  bad.prop = SER_LVGL_ANIM_PROP_COUNT;
+  TEST_CHECK(!ser_lvgl_anim_start(&bad));
+  bad = c;
+  bad.path = SER_LVGL_ANIM_PATH_COUNT;
+  TEST_CHECK(!ser_lvgl_anim_start(&bad));
+  TEST_CHECK(ser_lvgl_anim_count() == 0u);
+
+  /* 启动即应用起始值；线性走到一半 */
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  TEST_CHECK(lv_obj_get_style_x(a, 0) == 10);
+  s_ms += 50u;
+  (void)lv_timer_handler();
+  TEST_CHECK(LV_ABS(lv_obj_get_style_x(a, 0) - 60) <= 1);
+
+  /* 同属性替换：个数不变，新起点立即生效 */
+  c.from = 500;
+  c.to = 600;
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  TEST_CHECK(ser_lvgl_anim_count() == 1u);
+  TEST_CHECK(lv_obj_get_style_x(a, 0) == 500);
+
+  /* 另一属性与另一对象 */
+  c.prop = SER_LVGL_ANIM_BG_OPA;
+  c.from = -50;
+  c.to = 400;
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  TEST_CHECK(lv_obj_get_style_bg_opa(a, 0) == 0); /* 夹紧 */
+  c.obj = b;
+  c.prop = SER_LVGL_ANIM_Y;
+  c.from = 0;
+  c.to = 100;
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  TEST_CHECK(ser_lvgl_anim_count() == 3u);
+
+  /* stop 单个：值保持 */
+  s_ms += 30u;
+  (void)lv_timer_handler();
+  const int32_t x_kept = lv_obj_get_style_x(a, 0);
+  ser_lvgl_anim_stop(a, SER_LVGL_ANIM_X);
+  TEST_CHECK(ser_lvgl_anim_count() == 2u);
+  s_ms += 30u;
+  (void)lv_timer_handler();
+  TEST_CHECK(lv_obj_get_style_x(a, 0) == x_kept);
+
+  /* 删除对象：动画随之移除 */
+  lv_obj_delete(b);
+  TEST_CHECK(ser_lvgl_anim_count() == 1u);
+
+  /* 跑完：终值（夹紧），全部移除 */
+  s_ms += 200u;
+  (void)lv_timer_handler();
+  TEST_CHECK(lv_obj_get_style_bg_opa(a, 0) == 255);
+  TEST_CHECK(ser_lvgl_anim_count() == 0u);
+
+  /* stop 全部 */
+  c.obj = a;
+  c.prop = SER_LVGL_ANIM_Y;
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  c.prop = SER_LVGL_ANIM_OPA;
+  TEST_CHECK(ser_lvgl_anim_start(&c));
+  ser_lvgl_anim_stop(a, SER_LVGL_ANIM_PROP_COUNT);
+  TEST_CHECK(ser_lvgl_anim_count() == 0u);
+
+  /* 数组满 */
+  ser_lvgl_anim_reset_stats();
+  c.prop = SER_LVGL_ANIM_X;
+  c.repeat = SER_LVGL_ANIM_REPEAT_INFINITE;
+  uint32_t started = 0;
+  for (uint32_t i = 0; i <= SER_LVGL_ANIM_MAX; i++)
+  {
+    c.obj = lv_obj_create(scr);
+    started += ser_lvgl_anim_start(&c) ? 1u : 0u;
+  }
+  TEST_CHECK(started == SER_LVGL_ANIM_MAX);
+  ser_lvgl_anim_stats_t st;
+  ser_lvgl_anim_get_stats(&st);
+  TEST_CHECK(st.full == 1u && st.active_max == SER_LVGL_ANIM_MAX);
+
+  /* 清空后定时器暂停：不再计帧 */
+  lv_obj_clean(scr);
+  TEST_CHECK(ser_lvgl_anim_count() == 0u);
+  ser_lvgl_anim_reset_stats();
+  s_ms += 100u;
+  (void)lv_timer_handler();
+  ser_lvgl_anim_get_stats(&st);
+  TEST_CHECK(st.frames == 0u);
+
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+/* ---- 基准 ---- */
+
+typedef struct
+{
+  bool batched;
+  uint32_t n;
+} bench_cfg_t;
+
+static void run_bench(void *arg)
+{
+  const bench_cfg_t *cfg = (const bench_cfg_t *)arg;
+  lv_display_t *disp = make_display();
+  lv_display_add_event_cb(disp, inv_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_obj_t *scr = lv_screen_active();
+
+  const uint32_t objs = cfg->n / 2u;
+  static lv_obj_t *o[SER_LVGL_ANIM_MAX];
+  for (uint32_t i = 0; i < objs; i++)
+  {
+    o[i] = lv_obj_create(scr);
+    lv_obj_set_size(o[i], 20, 20);
+    lv_obj_set_pos(o[i], (int32_t)((i * 23u) % (DISP_W - 300u)),
+                   (int32_t)((i * 7u) % (DISP_H - 20u)));
+  }
+  lv_refr_now(disp);
+
+  for (uint32_t i = 0; i < objs; i++)
+  {
+    const uint32_t p = i % SER_LVGL_ANIM_PATH_COUNT;
+    const uint16_t dur = (uint16_t)(400u + (i * 37u) % 600u);
+    if (!cfg->batched)
+    {
+      lv_anim_t a;
+      lv_anim_init(&a);
+      lv_anim_set_var(&a, o[i]);
+      lv_anim_set_exec_cb(&a, set_x);
+      lv_anim_set_values(&a, 0, 250);
+      lv_anim_set_duration(&a, dur);
+      lv_anim_set_reverse_duration(&a, dur);
+      lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+      lv_anim_set_path_cb(&a, s_lv_paths[p]);
+      (void)lv_anim_start(&a);
+      lv_anim_set_exec_cb(&a, set_bg_opa);
+      lv_anim_set_values(&a, 40, 255);
+      lv_anim_set_duration(&a, dur + 100u);
+      lv_anim_set_reverse_duration(&a, dur + 100u);
+      (void)lv_anim_start(&a);
+    }
+    else
+    {
+      ser_lvgl_anim_cfg_t c = {.obj = o[i],
+                               .prop = SER_LVGL_ANIM_X,
+                               .path = (ser_lvgl_anim_path_t)p,
+                               .from = 0,
+                               .to = 250,
+                               .duration_ms = dur,
+                               .reverse_ms = dur,
+                               .repeat = SER_LVGL_ANIM_REPEAT_INFINITE};
+      TEST_CHECK(ser_lvgl_anim_start(&c));
+      c.prop = SER_LVGL_ANIM_BG_OPA;
+      c.from = 40;
+      c.to = 255;
+      c.duration_ms = (uint16_t)(dur + 100u);
+      c.reverse_ms = c.duration_ms;
+      TEST_CHECK(ser_lvgl_anim_start(&c));
+    }
+  }
+
+  /* 只跑动画与布局，不渲染；每帧清掉失效区域，下一帧的失效都会计数 */
+  lv_display_delete_refr_timer(disp);
+  uint64_t anim_ns = 0;
+  s_inv = 0;
+  for (uint32_t f = 0; f < BENCH_FRAMES; f++)
+  {
+    s_ms += 33u;
+    const uint64_t t0 = test_now_ns();
+    (void)lv_timer_handler();
+    const uint64_t t1 = test_now_ns();
+    lv_obj_update_layout(scr);
+    anim_ns += t1 - t0;
+    lv_inv_area(disp, NULL);
+  }
+  s_res.anim_ns_per_step = (double)anim_ns / ((double)cfg->n * BENCH_FRAMES);
+  s_res.inv_per_frame = (double)s_inv / BENCH_FRAMES;
+
+  if (cfg->batched)
+  {
+    /* 每对象每帧至多一次样式刷新 */
+    ser_lvgl_anim_stats_t st;
+    ser_lvgl_anim_get_stats(&st);
+    TEST_CHECK(st.refreshes <= st.frames * objs);
+    TEST_CHECK(st.writes <= st.steps);
+  }
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+static void bench(void)
+{
+  static const uint32_t sizes[] = {64u, 200u, 400u};
+  for (uint32_t z = 0; z < sizeof(sizes) / sizeof(sizes[0]); z++)
+  {
+    bench_cfg_t cfg = {.batched = false, .n = sizes[z]};
+    TEST_CHECK(test_fork(run_bench, &cfg, &s_res, sizeof(s_res)));
+    const run_result_t ref = s_res;
+    cfg.batched = true;
+    TEST_CHECK(test_fork(run_bench, &cfg, &s_res, sizeof(s_res)));
+    const run_result_t acc = s_res;
+    TEST_CHECK(ref.child_fails == 0u && acc.child_fails == 0u);
+    TEST_CHECK(acc.inv_per_frame < ref.inv_per_frame);
+    printf("n=%3u: lv_anim %.0f ns/anim, %.0f inv/frame -> ser_lvgl_anim "
+           "%.0f ns/anim, %.0f inv/frame (host)\n",
+           (unsigned)sizes[z], ref.anim_ns_per_step, ref.inv_per_frame,
+           acc.anim_ns_per_step, acc.inv_per_frame);
+  }
+}
+
+int main(void)
+{
+  TEST_CHECK(test_fork(run_api, NULL, &s_res, sizeof(s_res)));
+  TEST_CHECK(s_res.child_fails == 0u);
+
+  TEST_CHECK(test_fork(run_values, NULL, &s_res, sizeof(s_res)));
+  TEST_CHECK(s_res.child_fails == 0u);
+  TEST_CHECK(s_res.worst_q10 <= 4u);
+  TEST_CHECK(s_res.worst_px_250 <= 1u);
+  printf("values vs lv_anim: worst %u/1024 of the range, %u px on a 250 px "
+         "move\n",
+         (unsigned)s_res.worst_q10, (unsigned)s_res.worst_px_250);
+
+  bench();
+  return test_done();
+}
@@ -0,0 +1,303 @@
+/*
+ * services/ser_lvgl_bind：从传感器采样到像素的延迟与更新率
+ *
+ * 在虚拟时间线上跑真实的启动界面（ser_lvgl_ui_boot）与 lvgl_task 主循环模型：
+ * - poll：原做法，lv_timer 每 200ms 读最新采样并无条件重设控件
+ * - push：subject 发布 -> 任务通知立即唤醒 -> ser_lvgl_bind_process 分发变化值
+ *
+ * 时间模型：
+ * - 采样每 SAMPLE_PERIOD_US 到达一次（随机游走，部分采样与上次相同）
+ * - lvgl_task 与 ser_lvgl_task 一致：睡到下一个 LVGL 定时器（至多 5ms），通知会唤醒
+ * - 渲染耗时按刷新的像素数折算（RENDER_NS_PER_PX，F429 软件渲染的估计值），
+ *   只影响两种模式的绝对延迟，不影响比较
+ *
+ * 延迟 = 采样到达 -> 包含读数控件的区域刷新完成，只统计上屏的值；
+ * 采样值在显示前被新值覆盖记为“丢失”（轮询模式的主要代价）。
+ * 每种模式在子进程中跑（LVGL 与各服务的静态状态不重复初始化），结果经管道传回
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dri_time_us.h"
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_bind.h"
+#include "ser_lvgl_ui_boot.h"
+
+#define DISP_W 800
+#define DISP_H 480
+
+#define SIM_US (20u * 1000000u)
+#define SAMPLE_PERIOD_US 60000u
+#define POLL_PERIOD_MS 200u
+#define IDLE_MAX_MS 5u /* SER_LVGL_IDLE_MAX_MS */
+#define RENDER_NS_PER_PX 30u
+
+#define LAT_MAX 1024u
+
+typedef enum
+{
+  MODE_POLL,
+  MODE_PUSH,
+} sim_mode_t;
+
+typedef struct
+{
+  uint32_t samples;
+  uint32_t changed;      /* 与上一个采样不同的采样数 */
+  uint32_t ui_updates;   /* 调用 ser_lvgl_ui_boot_set_distance 的次数 */
+  uint32_t shown;        /* 上屏的变化值个数 */
+  uint64_t flushed_px;
+  uint32_t lat_n;
+  uint32_t lat_us[LAT_MAX];
+  ser_lvgl_bind_stats_t bind;
+} sim_result_t;
+
+static uint64_t s_now_us;
+static bool s_notified;
+
+static sim_result_t s_res;
+static ser_lvgl_ui_boot_t s_ui;
+static int32_t s_sample_mm;       /* 最新采样（poll 模式由定时器读取） */
+static uint64_t s_sample_us;      /* 最新采样的到达时间 */
+static int32_t s_ui_mm = -2;      /* 控件上当前的值 */
+static uint64_t s_ui_sample_us;   /* 该值对应采样的到达时间 */
+static bool s_ui_dirty;           /* 已写入控件、尚未刷新到像素 */
+
+static uint32_t host_read(void)
+{
+  return (uint32_t)s_now_us;
+}
+
+static uint32_t host_tick_ms(void)
+{
+  return (uint32_t)(s_now_us / 1000u);
+}
+
+void ser_lvgl_bind_host_notify(void *consumer)
+{
+  *(bool *)consumer = true;
+}
+
+static void ui_apply(int32_t mm)
+{
+  s_res.ui_updates++;
+  if (mm != s_ui_mm)
+  {
+    s_ui_mm = mm;
+    s_ui_sample_us = s_sample_us;
+    s_ui_dirty = true;
+  }
+  ser_lvgl_ui_boot_set_distance(&s_ui, mm);
+}
+
+static void push_observer(void *target, int32_t mm)
+{
+  (void)target;
+  ui_apply(mm);
+}
+
+static void poll_timer_cb(lv_timer_t *t)
+{
+  (void)t;
+  ui_apply(s_sample_mm);
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)px_map;
+  const uint32_t px = (uint32_t)lv_area_get_width(area) *
+                      (uint32_t)lv_area_get_height(area);
+  s_res.flushed_px += px;
+  s_now_us += ((uint64_t)px * RENDER_NS_PER_PX) / 1000u;
+
+  lv_area_t label;
+  lv_obj_get_coords(s_ui.dist_label, &label);
+  const bool hit = area->x1 <= label.x2 && area->x2 >= label.x1 &&
+                   area->y1 <= label.y2 && area->y2 >= label.y1;
+  if (hit && s_ui_dirty)
+  {
+    s_ui_dirty = false;
+    s_res.shown++;
+    if (s_res.lat_n < LAT_MAX)
+    {
+      s_res.lat_us[s_res.lat_n++] = (uint32_t)(s_now_us - s_ui_sample_us);
+    }
+  }
+  lv_display_flush_ready(disp);
+}
+
+static int32_t next_sample(int32_t prev)
+{
+  const uint32_t r = test_rand_n(100u);
+  if (r < 30u)
+  {
+    return prev;
+  }
+  if (r < 32u)
+  {
+    return -1;
+  }
+  int32_t v = (prev < 0) ? 800 : prev;
+  v += (int32_t)test_rand_n(101u) - 50;
+  return (v < 30) ? 30 : ((v > 4000) ? 4000 : v);
+}
+
+static void sim_run(sim_mode_t mode)
+{
+  static const dri_time_port_t port = {.read = host_read, .hz = 1000000u};
+  static ser_lvgl_subject_t subject;
+
+  dri_time_host_init(&port);
+  test_seed(27u);
+
+  lv_init();
+  lv_tick_set_cb(host_tick_ms);
+  uint16_t *fb = calloc((size_t)DISP_W * DISP_H, sizeof(uint16_t));
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, fb, NULL, DISP_W * DISP_H * 2u,
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  ser_lvgl_ui_boot_create(&s_ui);
+
+  /* 与固件相同的接线：ser_ultrasonic 初始化 subject，ser_lvgl_boot_ui 绑定 */
+  if (mode == MODE_PUSH)
+  {
+    ser_lvgl_subject_init(&subject, -1);
+    ser_lvgl_bind_set_consumer(&s_notified);
+    (void)ser_lvgl_subject_add_observer(&subject, push_observer, NULL);
+  }
+  else
+  {
+    (void)lv_timer_create(poll_timer_cb, POLL_PERIOD_MS, NULL);
+  }
+
+  /* 初值分发与首帧不计入 */
+  ser_lvgl_bind_stats_t base;
+  (void)ser_lvgl_bind_process();
+  lv_refr_now(disp);
+  ser_lvgl_bind_get_stats(&base);
+  memset(&s_res, 0, sizeof(s_res));
+  s_ui_dirty = false;
+
+  int32_t prev = -1;
+  uint64_t t_sample = SAMPLE_PERIOD_US;
+  while (s_now_us < SIM_US)
+  {
+    if (mode == MODE_PUSH)
+    {
+      (void)ser_lvgl_bind_process();
+    }
+    uint32_t next_ms = lv_timer_handler();
+    uint64_t t_wake = s_now_us +
+        1000u * (uint64_t)((next_ms < IDLE_MAX_MS) ? next_ms : IDLE_MAX_MS);
+
+    /* 本轮期间（渲染中或睡眠中）到达的采样；push 模式的通知立即唤醒 */
+    while (t_sample <= t_wake)
+    {
+      if (t_sample > s_now_us)
+      {
+        s_now_us = t_sample;
+      }
+      const int32_t mm = next_sample(prev);
+      s_res.samples++;
+      s_res.changed += (mm != prev) ? 1u : 0u;
+      prev = mm;
+      s_sample_mm = mm;
+      s_sample_us = t_sample;
+      t_sample += SAMPLE_PERIOD_US;
+      if (mode == MODE_PUSH)
+      {
+        ser_lvgl_subject_publish(&subject, mm);
+      }
+    }
+    if (s_notified)
+    {
+      s_notified = false;
+      t_wake = s_now_us;
+    }
+    if (t_wake > s_now_us)
+    {
+      s_now_us = t_wake;
+    }
+  }
+
+  ser_lvgl_bind_get_stats(&s_res.bind);
+  s_res.bind.publishes -= base.publishes;
+  s_res.bind.deliveries -= base.deliveries;
+  s_res.bind.unchanged -= base.unchanged;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+  const uint32_t x = *(const uint32_t *)a;
+  const uint32_t y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+static uint32_t pct(const sim_result_t *r, uint32_t p)
+{
+  return (r->lat_n != 0u) ? r->lat_us[(r->lat_n - 1u) * p / 100u] : 0u;
+}
+
+static void sim_entry(void *arg)
+{
+  sim_run(*(const sim_mode_t *)arg);
+}
+
+/* 子进程中跑一种模式（LVGL 与 ser_lvgl_bind 的静态状态互不影响） */
+static bool sim_fork(sim_mode_t mode, sim_result_t *out)
+{
+  if (!test_fork(sim_entry, &mode, &s_res, sizeof(s_res)))
+  {
+    return false;
+  }
+  *out = s_res;
+  qsort(out->lat_us, out->lat_n, sizeof(uint32_t), cmp_u32);
+  return true;
+}
+
+static void report(const char *name, const sim_result_t *r)
+{
+  const double sim_s = SIM_US / 1e6;
+  printf("%s: samples=%u changed=%u ui_updates=%.1f/s shown=%u lost=%u "
+         "latency p50=%.1fms p99=%.1fms max=%.1fms flushed=%.0fkpx/s\n",
+         name, (unsigned)r->samples, (unsigned)r->changed,
+         r->ui_updates / sim_s, (unsigned)r->shown,
+         (unsigned)(r->changed - r->shown), pct(r, 50u) / 1e3,
+         pct(r, 99u) / 1e3, pct(r, 100u) / 1e3, r->flushed_px / sim_s / 1e3);
+}
+
+int main(void)
+{
+  static sim_result_t poll;
+  static sim_result_t push;
+
+  TEST_CHECK(sim_fork(MODE_POLL, &poll));
+  TEST_CHECK(sim_fork(MODE_PUSH, &push));
+  report("poll 200ms", &poll);
+  report("push      ", &push);
+
+  /* 同一随机序列 */
+  TEST_CHECK(poll.samples == push.samples && poll.changed == push.changed);
+
+  /* push：每个变化的采样都上屏，相同值不触发 observer */
+  TEST_CHECK(push.shown == push.changed);
+  TEST_CHECK(push.ui_updates == push.changed);
+  TEST_CHECK(push.bind.publishes == push.samples);
+  TEST_CHECK(push.bind.deliveries == push.changed);
+  TEST_CHECK(push.bind.unchanged == push.samples - push.changed);
+
+  /* 延迟上界：一个 LVGL 刷新周期 + 渲染；轮询则要等到下一个 200ms 定时器 */
+  TEST_CHECK(pct(&push, 100u) < 1000u * (LV_DEF_REFR_PERIOD + 10u));
+  TEST_CHECK(pct(&push, 50u) < pct(&poll, 50u));
+  TEST_CHECK(poll.shown < poll.changed);
+
+  return test_done();
+}
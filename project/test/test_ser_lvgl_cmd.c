@@ -0,0 +1,250 @@
+/*
+ * services/ser_lvgl_cmd：多生产者单消费者 UI 命令队列
+ *
+ * - 未初始化时投递失败
+ * - 单线程：先进先出、队列满时投递失败且计数、按批执行与 pending、下标多圈回绕
+ * - 多线程：4 个生产者（满时重试）与 1 个消费者（按批执行，无唤醒时让出 CPU）并发，
+ *   每个生产者的命令按投递顺序执行，不丢、不重复
+ * 基准：无争用的投递 + 执行；多生产者并发时的吞吐与 CAS 重试
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "ser_lvgl_cmd.h"
+#include "test.h"
+
+#define PRODUCERS 4u
+#define PER_PRODUCER 50000u
+#define BENCH_N 1000000u
+
+static uint32_t port_now(void)
+{
+  return (uint32_t)test_now_ns();
+}
+
+/* 唤醒只记一个标志：notify 要便宜，生产者之间才有真实的争用 */
+static atomic_uint s_notifies;
+static atomic_bool s_wake;
+
+static void port_notify(bool from_isr)
+{
+  (void)from_isr;
+  atomic_fetch_add_explicit(&s_notifies, 1u, memory_order_relaxed);
+  atomic_store_explicit(&s_wake, true, memory_order_release);
+}
+
+static const ser_lvgl_cmd_port_t s_port = {
+    .now = port_now,
+    .hz = 1000000000u,
+    .notify = port_notify,
+};
+
+/* 单线程场景：记录执行顺序 */
+static int32_t s_log[SER_LVGL_CMD_DEPTH * 2u];
+static uint32_t s_log_n;
+
+static void log_cmd(void *obj, int32_t value)
+{
+  (void)obj;
+  if (s_log_n < sizeof(s_log) / sizeof(s_log[0]))
+  {
+    s_log[s_log_n] = value;
+  }
+  s_log_n++;
+}
+
+static void test_single(void)
+{
+  TEST_CHECK(!ser_lvgl_cmd_post(log_cmd, NULL, 1));
+
+  TEST_CHECK(ser_lvgl_cmd_init(&s_port));
+  TEST_CHECK(!ser_lvgl_cmd_pending());
+  TEST_CHECK(!ser_lvgl_cmd_post(NULL, NULL, 1));
+
+  /* 填满 */
+  for (uint32_t i = 0; i < SER_LVGL_CMD_DEPTH; i++)
+  {
+    TEST_CHECK(ser_lvgl_cmd_post(log_cmd, NULL, (int32_t)i));
+  }
+  TEST_CHECK(!ser_lvgl_cmd_post(log_cmd, NULL, -1));
+  TEST_CHECK(ser_lvgl_cmd_pending());
+  TEST_CHECK(atomic_load(&s_notifies) >= 1u);
+
+  /* 按批执行 */
+  s_log_n = 0;
+  TEST_CHECK(ser_lvgl_cmd_drain(SER_LVGL_CMD_BATCH) == SER_LVGL_CMD_BATCH);
+  TEST_CHECK(s_log_n == SER_LVGL_CMD_BATCH);
+  TEST_CHECK(ser_lvgl_cmd_pending());
+  TEST_CHECK(ser_lvgl_cmd_drain(SER_LVGL_CMD_DEPTH) ==
+             SER_LVGL_CMD_DEPTH - SER_LVGL_CMD_BATCH);
+  TEST_CHECK(!ser_lvgl_cmd_pending());
+  TEST_CHECK(ser_lvgl_cmd_drain(SER_LVGL_CMD_BATCH) == 0u);
+  uint32_t bad = 0;
+  for (uint32_t i = 0; i < SER_LVGL_CMD_DEPTH; i++)
+  {
+    bad += (s_log[i] != (int32_t)i) ? 1u : 0u;
+  }
+  TEST_CHECK(bad == 0u);
+
+  ser_lvgl_cmd_stats_t st;
+  ser_lvgl_cmd_get_stats(&st);
+  TEST_CHECK(st.posts == SER_LVGL_CMD_DEPTH && st.full == 1u);
+  TEST_CHECK(st.executed == SER_LVGL_CMD_DEPTH && st.batches == 2u);
+  TEST_CHECK(st.batch_max == SER_LVGL_CMD_DEPTH - SER_LVGL_CMD_BATCH);
+  TEST_CHECK(st.depth_max == SER_LVGL_CMD_DEPTH);
+  TEST_CHECK(st.retries == 0u && st.stalls == 0u);
+
+  /* 多圈回绕：每次投递随机条数再全部执行，顺序连续 */
+  int32_t next_post = 0;
+  int32_t next_exec = 0;
+  bad = 0;
+  for (uint32_t round = 0; round < 1000u; round++)
+  {
+    const uint32_t k = 1u + test_rand_n(SER_LVGL_CMD_DEPTH);
+    for (uint32_t i = 0; i < k; i++)
+    {
+      TEST_CHECK(ser_lvgl_cmd_post(log_cmd, NULL, next_post++));
+    }
+    s_log_n = 0;
+    TEST_CHECK(ser_lvgl_cmd_drain(SER_LVGL_CMD_DEPTH) == k);
+    for (uint32_t i = 0; i < k; i++)
+    {
+      bad += (s_log[i] != next_exec++) ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(bad == 0u);
+
+  ser_lvgl_cmd_reset_stats();
+  ser_lvgl_cmd_get_stats(&st);
+  TEST_CHECK(st.posts == 0u && st.executed == 0u && st.full == 0u);
+}
+
+/* ---- 多线程 ---- */
+
+static uint32_t s_last[PRODUCERS];
+static uint32_t s_order_err;
+static uint32_t s_executed;
+static atomic_uint s_full_retries;
+static atomic_bool s_done;
+
+static void seq_cmd(void *obj, int32_t value)
+{
+  const uint32_t p = (uint32_t)(uintptr_t)obj;
+  s_order_err += ((uint32_t)value != s_last[p] + 1u) ? 1u : 0u;
+  s_last[p] = (uint32_t)value;
+  s_executed++;
+}
+
+static void *producer_main(void *arg)
+{
+  for (uint32_t seq = 1; seq <= PER_PRODUCER; seq++)
+  {
+    while (!ser_lvgl_cmd_post(seq_cmd, arg, (int32_t)seq))
+    {
+      atomic_fetch_add(&s_full_retries, 1u);
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+/* 与 ser_lvgl_task 相同的节奏：执行一批，还有积压就不睡 */
+static void *consumer_main(void *arg)
+{
+  (void)arg;
+  for (;;)
+  {
+    (void)ser_lvgl_cmd_drain(SER_LVGL_CMD_BATCH);
+    if (ser_lvgl_cmd_pending())
+    {
+      continue;
+    }
+    if (atomic_load(&s_done))
+    {
+      break;
+    }
+    /* 相当于 ulTaskNotifyTake：没有唤醒就让出 CPU */
+    if (!atomic_exchange(&s_wake, false))
+    {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void test_threads(void)
+{
+  TEST_CHECK(ser_lvgl_cmd_init(&s_port));
+  atomic_store(&s_done, false);
+
+  pthread_t consumer;
+  pthread_t producers[PRODUCERS];
+  const uint64_t t0 = test_now_ns();
+  TEST_CHECK(pthread_create(&consumer, NULL, consumer_main, NULL) == 0);
+  for (uint32_t p = 0; p < PRODUCERS; p++)
+  {
+    TEST_CHECK(pthread_create(&producers[p], NULL, producer_main,
+                              (void *)(uintptr_t)p) == 0);
+  }
+  for (uint32_t p = 0; p < PRODUCERS; p++)
+  {
+    pthread_join(producers[p], NULL);
+  }
+  atomic_store(&s_done, true);
+  port_notify(false);
+  pthread_join(consumer, NULL);
+  const uint64_t t1 = test_now_ns();
+
+  TEST_CHECK(s_order_err == 0u);
+  TEST_CHECK(s_executed == PRODUCERS * PER_PRODUCER);
+  for (uint32_t p = 0; p < PRODUCERS; p++)
+  {
+    TEST_CHECK(s_last[p] == PER_PRODUCER);
+  }
+
+  ser_lvgl_cmd_stats_t st;
+  ser_lvgl_cmd_get_stats(&st);
+  TEST_CHECK(st.posts == PRODUCERS * PER_PRODUCER);
+  TEST_CHECK(st.executed == st.posts);
+  TEST_CHECK(st.full == atomic_load(&s_full_retries));
+  TEST_CHECK(st.batch_max <= SER_LVGL_CMD_BATCH);
+  TEST_CHECK(st.depth_max <= SER_LVGL_CMD_DEPTH);
+  printf("%u producers: %.1f M cmd/s, retries/post %.4f, full %u, "
+         "stalls %u, avg batch %.2f (host)\n",
+         (unsigned)PRODUCERS, (double)st.posts * 1e3 / (double)(t1 - t0),
+         (double)st.retries / st.posts, (unsigned)st.full,
+         (unsigned)st.stalls, (double)st.executed / st.batches);
+}
+
+static void nop_cmd(void *obj, int32_t value)
+{
+  (void)obj;
+  (void)value;
+}
+
+static void bench(void)
+{
+  TEST_CHECK(ser_lvgl_cmd_init(&s_port));
+  const uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_N; i += SER_LVGL_CMD_BATCH)
+  {
+    for (uint32_t k = 0; k < SER_LVGL_CMD_BATCH; k++)
+    {
+      (void)ser_lvgl_cmd_post(nop_cmd, NULL, (int32_t)k);
+    }
+    (void)ser_lvgl_cmd_drain(SER_LVGL_CMD_BATCH);
+  }
+  printf("post + drain: %.1f ns/cmd (uncontended, host)\n",
+         (double)(test_now_ns() - t0) / BENCH_N);
+}
+
+int main(void)
+{
+  test_seed(46u);
+  test_single();
+  test_threads();
+  bench();
+  return test_done();
+}
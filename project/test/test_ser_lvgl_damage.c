@@ -0,0 +1,257 @@
+/*
+ * services/ser_lvgl_damage：大量零散小失效
+ *
+ * 场景：屏幕上 32x16 个 8x8 小方块，每帧随机改 48 个的颜色（48 次失效，
+ * 超过 LV_INV_BUF_SIZE），对比：
+ * - LVGL 原生：inv_areas 溢出后整屏重绘
+ * - 挂接 ser_lvgl_damage：按瓦片合并，带数有上限，不退化为整屏
+ * 每帧统计刷新的像素数与主机耗时；每 8 帧与整屏重绘比对，确认没有漏画的区域。
+ * 主机耗时只作参考：LVGL 每个区域都要遍历 512 个子对象，区域数从 1 变成 ~32 后
+ * 遍历开销超过省下的填充（主机填充很快）；目标板上软件填充按像素计费，以像素数为准。
+ *
+ * PARTIAL 模式（条带缓冲 + 瓦片哈希）：
+ * - 刷新能结束（渲染中 LVGL 为计算条带行数发出的失效询问不能被改写，否则死循环）
+ * - 面板内容与整屏重绘一致；方块颜色改了又改回时，哈希命中的瓦片跳过写出
+ *
+ * 每种模式在子进程中跑（damage 挂接后不能撤销）
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dev_lcd.h"
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_damage.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define COLS 32u
+#define ROWS 16u
+#define CELL 8
+#define FRAMES 200u
+#define CHANGES 48u
+#define CHECK_EVERY 8u
+#define STRIP_H 64u /* 瓦片高度的整数倍：条带内有完整瓦片参与哈希 */
+
+typedef enum
+{
+  RUN_DIRECT_LVGL,
+  RUN_DIRECT_DAMAGE,
+  RUN_PARTIAL_DAMAGE,
+} run_mode_t;
+
+typedef struct
+{
+  uint64_t px;
+  uint64_t ns;
+  uint32_t full_frames; /* 整屏重绘的帧数 */
+  uint32_t mismatches;  /* 与整屏重绘不一致的检查点 */
+  uint64_t lcd_px;      /* PARTIAL：写入面板的像素 */
+  ser_lvgl_damage_stats_t stats;
+} run_result_t;
+
+static uint16_t s_fb[DISP_W * DISP_H];  /* DIRECT 渲染目标 / PARTIAL 条带 */
+static uint16_t s_lcd[DISP_W * DISP_H]; /* PARTIAL：面板帧缓冲 */
+static uint16_t s_ref[DISP_W * DISP_H];
+static lv_display_t *s_disp;
+static lv_obj_t *s_cells[ROWS][COLS];
+static uint32_t s_color[ROWS][COLS];
+static run_mode_t s_mode;
+static run_result_t s_res;
+static bool s_full;
+
+/* dev_lcd 替身：ser_lvgl_damage 只用到尺寸与 RGB565 写出 */
+uint16_t dev_lcd_width(void)
+{
+  return DISP_W;
+}
+
+uint16_t dev_lcd_height(void)
+{
+  return DISP_H;
+}
+
+void dev_lcd_flush_rgb565_stride(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const uint16_t *px,
+                                 uint32_t src_stride)
+{
+  const uint32_t w = (uint32_t)(x2 - x1 + 1);
+  for (int32_t y = y1; y <= y2; y++)
+  {
+    memcpy(&s_lcd[(uint32_t)y * DISP_W + (uint32_t)x1],
+           &px[(uint32_t)(y - y1) * src_stride], w * sizeof(uint16_t));
+  }
+  s_res.lcd_px += (uint64_t)w * (uint64_t)(y2 - y1 + 1);
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  const uint32_t px = (uint32_t)lv_area_get_size(area);
+  s_res.px += px;
+  s_full = s_full || px == (uint32_t)DISP_W * DISP_H;
+  if (s_mode == RUN_PARTIAL_DAMAGE)
+  {
+    (void)ser_lvgl_damage_flush(area, (const uint16_t *)px_map);
+  }
+  lv_display_flush_ready(disp);
+}
+
+static uint32_t rand_color(void)
+{
+  return (uint32_t)test_rand() & 0xFFFFFFu;
+}
+
+static void set_cell(uint32_t r, uint32_t c, uint32_t color)
+{
+  s_color[r][c] = color;
+  lv_obj_set_style_bg_color(s_cells[r][c], lv_color_hex(color), 0);
+}
+
+/* 整屏重绘后与增量结果比对（PARTIAL 比较面板内容，且不走哈希） */
+static bool matches_full_redraw(void)
+{
+  uint16_t *out = (s_mode == RUN_PARTIAL_DAMAGE) ? s_lcd : s_fb;
+  memcpy(s_ref, out, sizeof(s_ref));
+  ser_lvgl_damage_forget();
+  const run_result_t keep = s_res;
+  lv_obj_invalidate(lv_screen_active());
+  lv_refr_now(s_disp);
+  s_res = keep;
+  return memcmp(s_ref, out, sizeof(s_ref)) == 0;
+}
+
+static void run(void *arg)
+{
+  s_mode = *(const run_mode_t *)arg;
+
+  lv_init();
+  s_disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_disp, flush_cb);
+  if (s_mode == RUN_PARTIAL_DAMAGE)
+  {
+    lv_display_set_buffers(s_disp, s_fb, NULL, DISP_W * STRIP_H * 2u,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+  }
+  else
+  {
+    lv_display_set_buffers(s_disp, s_fb, NULL, sizeof(s_fb),
+                           LV_DISPLAY_RENDER_MODE_DIRECT);
+  }
+  if (s_mode != RUN_DIRECT_LVGL)
+  {
+    TEST_CHECK(ser_lvgl_damage_attach(s_disp, s_mode == RUN_PARTIAL_DAMAGE));
+  }
+
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_set_style_bg_color(scr, lv_color_hex(0x0B1020), 0);
+  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+  test_seed(31u);
+  for (uint32_t r = 0; r < ROWS; r++)
+  {
+    for (uint32_t c = 0; c < COLS; c++)
+    {
+      lv_obj_t *o = lv_obj_create(scr);
+      lv_obj_remove_style_all(o);
+      lv_obj_set_style_bg_opa(o, LV_OPA_COVER, 0);
+      lv_obj_set_size(o, CELL, CELL);
+      lv_obj_set_pos(o, (int32_t)(c * DISP_W / COLS) + 8,
+                     (int32_t)(r * DISP_H / ROWS) + 11);
+      s_cells[r][c] = o;
+      set_cell(r, c, rand_color());
+    }
+  }
+  lv_refr_now(s_disp);
+  memset(&s_res, 0, sizeof(s_res));
+
+  for (uint32_t f = 0; f < FRAMES; f++)
+  {
+    for (uint32_t i = 0; i < CHANGES; i++)
+    {
+      set_cell(test_rand_n(ROWS), test_rand_n(COLS), rand_color());
+    }
+    s_full = false;
+    const uint64_t t0 = test_now_ns();
+    lv_refr_now(s_disp);
+    s_res.ns += test_now_ns() - t0;
+    s_res.full_frames += s_full ? 1u : 0u;
+
+    if ((f % CHECK_EVERY) == 0u && !matches_full_redraw())
+    {
+      s_res.mismatches++;
+    }
+  }
+
+  /* PARTIAL：同一帧内改色后又改回，失效的瓦片内容与上次写出的相同 */
+  if (s_mode == RUN_PARTIAL_DAMAGE)
+  {
+    const uint32_t old = s_color[3][5];
+    ser_lvgl_damage_stats_t before;
+    ser_lvgl_damage_get_stats(&before);
+    set_cell(3, 5, old ^ 0xFFFFFFu);
+    set_cell(3, 5, old);
+    lv_refr_now(s_disp);
+    ser_lvgl_damage_get_stats(&s_res.stats);
+    s_res.stats.tiles_skipped -= before.tiles_skipped;
+    s_res.mismatches += matches_full_redraw() ? 0u : 1u;
+    return;
+  }
+  ser_lvgl_damage_get_stats(&s_res.stats);
+}
+
+static void report(const char *name, const run_result_t *r)
+{
+  printf("%s: %.0f px/frame, %.0f us/frame (host), full redraws %u/%u\n",
+         name, (double)r->px / FRAMES, r->ns / 1e3 / FRAMES,
+         (unsigned)r->full_frames, (unsigned)FRAMES);
+}
+
+int main(void)
+{
+  static run_result_t lvgl;
+  static run_result_t damage;
+  static run_result_t partial;
+  run_mode_t m;
+
+  m = RUN_DIRECT_LVGL;
+  TEST_CHECK(test_fork(run, &m, &s_res, sizeof(s_res)));
+  lvgl = s_res;
+  m = RUN_DIRECT_DAMAGE;
+  TEST_CHECK(test_fork(run, &m, &s_res, sizeof(s_res)));
+  damage = s_res;
+  m = RUN_PARTIAL_DAMAGE;
+  TEST_CHECK(test_fork(run, &m, &s_res, sizeof(s_res)));
+  partial = s_res;
+
+  report("lvgl   ", &lvgl);
+  report("damage ", &damage);
+  report("partial", &partial);
+  printf("damage: %u invalidations, %u coarse rebuilds, %u areas in last "
+         "frame; partial: %.0f px/frame to panel\n",
+         (unsigned)damage.stats.invalidations,
+         (unsigned)damage.stats.coarse_rebuilds,
+         (unsigned)damage.stats.last_areas,
+         (double)partial.lcd_px / FRAMES);
+
+  /* 原生 LVGL 在该负载下每帧都整屏重绘；挂接后不会 */
+  TEST_CHECK(lvgl.full_frames == FRAMES);
+  TEST_CHECK(damage.full_frames == 0u);
+  TEST_CHECK(damage.px * 2u < lvgl.px);
+  TEST_CHECK(damage.stats.invalidations >= FRAMES * CHANGES);
+
+  /* 增量结果与整屏重绘一致 */
+  TEST_CHECK(lvgl.mismatches == 0u);
+  TEST_CHECK(damage.mismatches == 0u);
+  TEST_CHECK(partial.mismatches == 0u);
+
+  /* PARTIAL：刷新结束（未卡死），哈希命中跳过写出 */
+  TEST_CHECK(partial.full_frames == 0u);
+  TEST_CHECK(partial.stats.tiles_skipped > 0u);
+
+  return test_done();
+}
@@ -0,0 +1,307 @@
+/*
+ * services/ser_lvgl_img：ser_img565 资源的 LVGL 解码器
+ *
+ * 资源取自真实启动界面（ser_lvgl_ui_boot，800x480）与其中 240x160 一块
+ * （重启间隔 7 行，与 16 行条带错开），经 ser_lvgl_img_create 画在 800x480 DIRECT
+ * 帧缓冲上，每帧与逐像素合成的参照相同：
+ * - 整屏、再次重绘、局部失效（失效区外不被写）、左上 / 右下部分移出屏幕
+ * - 条带模式（图片缓存关闭，默认）：open 不解码、逐条带解码，解码像素等于可见像素，
+ *   定位多解的行数为 裁剪区首行 % key_rows；局部失效只解失效区
+ * - 缓存模式：整图解码一次放入图片缓存，之后各帧命中缓存不再 open；
+ *   放不下 LVGL heap 的整屏图退回条带模式
+ * - 未带 SER_LVGL_IMG_FLAG 的普通 RGB565 资源仍由 LVGL 自带解码器处理
+ * 基准：各帧解码像素与条带数
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "src/misc/cache/instance/lv_image_cache.h"
+#include "ser_img565.h"
+#include "ser_lvgl_img.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_rle565.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define CROP_X 280
+#define CROP_Y 160
+#define CROP_W 240
+#define CROP_H 160
+#define CROP_KEY_ROWS 7u
+#define BG 0xF81Fu /* 屏幕背景（品红），与图片内容区分 */
+
+#define ENC_CAP                                                                \
+  (SER_IMG565_HDR_BYTES + DISP_H * 4u +                                        \
+   DISP_H * SER_RLE565_ROW_MAX_BYTES(DISP_W))
+
+typedef enum
+{
+  IMG_FULL, /* 整屏 800x480 */
+  IMG_CROP, /* 240x160 */
+  IMG_RAW,  /* 240x160 不压缩、不带标记 */
+} img_kind_t;
+
+typedef enum
+{
+  CASE_FULL,
+  CASE_REDRAW,
+  CASE_PARTIAL,
+  CASE_TOP_LEFT,
+  CASE_BOTTOM_RIGHT,
+  CASE_COUNT,
+} case_t;
+
+typedef struct
+{
+  img_kind_t img;
+  bool cache;
+} run_cfg_t;
+
+typedef struct
+{
+  uint32_t mismatched[CASE_COUNT];
+  uint32_t visible[CASE_COUNT];
+  uint32_t first_row[CASE_COUNT]; /* 裁剪区在图片中的首行 */
+  ser_lvgl_img_stats_t stats[CASE_COUNT];
+  uint32_t child_fails;
+} run_result_t;
+
+static uint16_t s_src[DISP_W * DISP_H];
+static uint16_t s_crop[CROP_W * CROP_H];
+static uint8_t s_enc_full[ENC_CAP];
+static uint8_t s_enc_crop[ENC_CAP];
+static uint16_t s_fb[DISP_W * DISP_H];
+static run_result_t s_res;
+static lv_image_dsc_t s_dsc[3];
+
+static const lv_area_t s_partial = {123, 77, 456, 301};
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static lv_display_t *make_display(void)
+{
+  lv_init();
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  return disp;
+}
+
+/* 子进程：渲染启动界面到 s_src */
+static void render_boot(void *arg)
+{
+  static ser_lvgl_ui_boot_t ui;
+  (void)arg;
+  lv_display_t *disp = make_display();
+  ser_lvgl_ui_boot_create(&ui);
+  ser_lvgl_ui_boot_set_distance(&ui, 1234);
+  lv_refr_now(disp);
+  memcpy(s_src, s_fb, sizeof(s_src));
+}
+
+static void make_dsc(lv_image_dsc_t *dsc, uint32_t w, uint32_t h,
+                     const void *data, uint32_t size, bool compressed)
+{
+  memset(dsc, 0, sizeof(*dsc));
+  dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+  dsc->header.cf = LV_COLOR_FORMAT_RGB565;
+  dsc->header.flags = compressed ? SER_LVGL_IMG_FLAG : 0u;
+  dsc->header.w = w;
+  dsc->header.h = h;
+  dsc->header.stride = w * 2u;
+  dsc->data = data;
+  dsc->data_size = size;
+}
+
+static void img_size(img_kind_t kind, int32_t *w, int32_t *h)
+{
+  *w = (kind == IMG_FULL) ? DISP_W : CROP_W;
+  *h = (kind == IMG_FULL) ? DISP_H : CROP_H;
+}
+
+static uint16_t img_px(img_kind_t kind, int32_t x, int32_t y)
+{
+  return (kind == IMG_FULL) ? s_src[y * DISP_W + x] : s_crop[y * CROP_W + x];
+}
+
+/*
+ * 与参照比较：only 之内为背景上叠图片（图片左上角在 ox, oy），之外应保持 0
+ * 返回不同的像素数；*visible 为图片可见且在 only 内的像素数
+ */
+static uint32_t compare(img_kind_t kind, int32_t ox, int32_t oy,
+                        const lv_area_t *only, uint32_t *visible)
+{
+  int32_t w, h;
+  img_size(kind, &w, &h);
+  uint32_t bad = 0;
+  *visible = 0;
+  for (int32_t y = 0; y < DISP_H; y++)
+  {
+    for (int32_t x = 0; x < DISP_W; x++)
+    {
+      uint16_t want = 0u;
+      if (x >= only->x1 && x <= only->x2 && y >= only->y1 && y <= only->y2)
+      {
+        const int32_t sx = x - ox;
+        const int32_t sy = y - oy;
+        want = BG;
+        if (sx >= 0 && sy >= 0 && sx < w && sy < h)
+        {
+          want = img_px(kind, sx, sy);
+          (*visible)++;
+        }
+      }
+      bad += (s_fb[y * DISP_W + x] != want) ? 1u : 0u;
+    }
+  }
+  return bad;
+}
+
+static void run(void *arg)
+{
+  const run_cfg_t *cfg = (const run_cfg_t *)arg;
+  const lv_area_t screen = {0, 0, DISP_W - 1, DISP_H - 1};
+  int32_t w, h;
+  img_size(cfg->img, &w, &h);
+
+  lv_display_t *disp = make_display();
+  TEST_CHECK(ser_lvgl_img_init());
+  TEST_CHECK(ser_lvgl_img_init());
+  lv_image_cache_resize(cfg->cache ? 1024u * 1024u : 0u, false);
+  TEST_CHECK(lv_image_cache_is_enabled() == cfg->cache);
+
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_set_style_bg_color(scr, lv_color_hex(0xFF00FF), 0);
+  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+  lv_obj_t *img = ser_lvgl_img_create(scr, &s_dsc[cfg->img]);
+  TEST_CHECK(img != NULL);
+  TEST_CHECK(ser_lvgl_img_create(scr, NULL) == NULL);
+
+  for (uint32_t c = 0; c < CASE_COUNT; c++)
+  {
+    int32_t ox = 0;
+    int32_t oy = 0;
+    const lv_area_t *only = &screen;
+    switch ((case_t)c)
+    {
+    case CASE_REDRAW:
+      lv_obj_invalidate(scr);
+      break;
+    case CASE_PARTIAL:
+      /* 失效区外保持 0：DIRECT 模式只画失效区 */
+      memset(s_fb, 0, sizeof(s_fb));
+      lv_obj_invalidate_area(scr, &s_partial);
+      only = &s_partial;
+      break;
+    case CASE_TOP_LEFT:
+      /* 整屏重画：盖掉上一帧留下的 0，移动前后的位置也不会各画一次 */
+      lv_obj_invalidate(scr);
+      ox = -(w * 2 / 5);
+      oy = -(h * 2 / 5);
+      break;
+    case CASE_BOTTOM_RIGHT:
+      lv_obj_invalidate(scr);
+      ox = DISP_W - w * 3 / 5;
+      oy = DISP_H - h * 3 / 5;
+      break;
+    case CASE_FULL:
+    default:
+      break;
+    }
+    lv_obj_set_pos(img, ox, oy);
+    ser_lvgl_img_reset_stats();
+    lv_refr_now(disp);
+    s_res.mismatched[c] = compare(cfg->img, ox, oy, only, &s_res.visible[c]);
+    s_res.first_row[c] = (uint32_t)(LV_MAX(only->y1, oy) - oy);
+    ser_lvgl_img_get_stats(&s_res.stats[c]);
+  }
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+static void check(const run_cfg_t *cfg, const run_result_t *r)
+{
+  static const char *const case_name[CASE_COUNT] = {
+      "full", "redraw", "partial", "top-left", "bottom-right"};
+  static const char *const img_name[] = {"800x480", "240x160", "raw 240x160"};
+
+  for (uint32_t c = 0; c < CASE_COUNT; c++)
+  {
+    const ser_lvgl_img_stats_t *s = &r->stats[c];
+    TEST_CHECK(r->mismatched[c] == 0u);
+    TEST_CHECK(r->visible[c] > 0u);
+    if (cfg->img == IMG_RAW)
+    {
+      /* 不认领：LVGL 自带解码器 */
+      TEST_CHECK(s->opens == 0u && s->px == 0u);
+    }
+    else if (cfg->cache && cfg->img == IMG_CROP)
+    {
+      /* 第一帧整图解码入缓存，之后命中 */
+      TEST_CHECK(s->opens == ((c == CASE_FULL) ? 1u : 0u));
+      TEST_CHECK(s->cached == s->opens && s->bands == 0u);
+    }
+    else
+    {
+      /* 条带：只解可见部分（裁剪区多解的定位行不计入 px） */
+      TEST_CHECK(s->opens >= 1u && s->cached == 0u && s->bands > 0u);
+      TEST_CHECK(s->px == r->visible[c]);
+      const uint32_t key_rows =
+          (cfg->img == IMG_FULL) ? SER_IMG565_KEY_ROWS : CROP_KEY_ROWS;
+      TEST_CHECK(s->rows_skipped == r->first_row[c] % key_rows);
+    }
+
+    printf("%-11s %-5s %-12s: mismatched %u, visible %7u px, decoded %7llu px "
+           "in %3u bands (+%u rows to seek), opens %u, cached %u\n",
+           img_name[cfg->img], cfg->cache ? "cache" : "band", case_name[c],
+           (unsigned)r->mismatched[c], (unsigned)r->visible[c],
+           (unsigned long long)s->px, (unsigned)s->bands,
+           (unsigned)s->rows_skipped, (unsigned)s->opens, (unsigned)s->cached);
+  }
+}
+
+int main(void)
+{
+  TEST_CHECK(test_fork(render_boot, NULL, s_src, sizeof(s_src)));
+  for (uint32_t y = 0; y < CROP_H; y++)
+  {
+    memcpy(&s_crop[y * CROP_W], &s_src[(CROP_Y + y) * DISP_W + CROP_X],
+           CROP_W * 2u);
+  }
+
+  const uint32_t n_full =
+      ser_img565_encode(s_src, DISP_W, DISP_H, DISP_W, SER_IMG565_KEY_ROWS,
+                        s_enc_full, sizeof(s_enc_full));
+  const uint32_t n_crop =
+      ser_img565_encode(s_crop, CROP_W, CROP_H, CROP_W, CROP_KEY_ROWS,
+                        s_enc_crop, sizeof(s_enc_crop));
+  TEST_CHECK(n_full != 0u && n_crop != 0u);
+  make_dsc(&s_dsc[IMG_FULL], DISP_W, DISP_H, s_enc_full, n_full, true);
+  make_dsc(&s_dsc[IMG_CROP], CROP_W, CROP_H, s_enc_crop, n_crop, true);
+  make_dsc(&s_dsc[IMG_RAW], CROP_W, CROP_H, s_crop, sizeof(s_crop), false);
+
+  static const run_cfg_t runs[] = {
+      {IMG_FULL, false}, {IMG_CROP, false}, {IMG_CROP, true},
+      {IMG_FULL, true},  {IMG_RAW, false},
+  };
+  for (uint32_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++)
+  {
+    TEST_CHECK(test_fork(run, (void *)&runs[i], &s_res, sizeof(s_res)));
+    TEST_CHECK(s_res.child_fails == 0u);
+    check(&runs[i], &s_res);
+  }
+  return test_done();
+}
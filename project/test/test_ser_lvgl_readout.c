@@ -0,0 +1,147 @@
+/*
+ * services/ser_lvgl_readout：按字形失效的读数控件
+ *
+ * 同一串距离读数（随机游走，"Dist: %lu.%01lu cm"）分别写入 readout 与 lv_label，
+ * 每次更新后 lv_refr_now，统计刷新的像素数与主机渲染耗时：
+ * - 正确性：增量刷新后的帧缓冲与整屏重绘逐像素相同（不留残影）；
+ *   文本不变时返回 0、不产生刷新
+ * - 基准：readout 的刷新像素应明显少于 lv_label（整块失效）
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_readout.h"
+#include "ser_lvgl_style.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define UPDATES 2000u
+#define CHECK_EVERY 16u
+
+static uint16_t s_fb[DISP_W * DISP_H];
+static uint16_t s_ref[DISP_W * DISP_H];
+static uint64_t s_flushed_px;
+static lv_display_t *s_disp;
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)px_map;
+  s_flushed_px += (uint64_t)lv_area_get_width(area) *
+                  (uint64_t)lv_area_get_height(area);
+  lv_display_flush_ready(disp);
+}
+
+/* 整屏重绘后与增量结果比对 */
+static bool matches_full_redraw(void)
+{
+  memcpy(s_ref, s_fb, sizeof(s_fb));
+  lv_obj_invalidate(lv_screen_active());
+  lv_refr_now(s_disp);
+  return memcmp(s_ref, s_fb, sizeof(s_fb)) == 0;
+}
+
+typedef struct
+{
+  uint64_t px;
+  uint64_t ns;
+} phase_t;
+
+/* readout != NULL 时写 readout，否则写 label */
+static phase_t run_phase(lv_obj_t *readout, lv_obj_t *label)
+{
+  phase_t r = {0};
+  char text[SER_LVGL_READOUT_MAX_CHARS];
+  uint32_t mm = 1234u;
+
+  test_seed(28u);
+  for (uint32_t i = 0; i < UPDATES; i++)
+  {
+    mm += test_rand_n(41u);
+    mm -= 20u;
+    mm = (mm < 30u) ? 30u : ((mm > 4000u) ? 4000u : mm);
+    (void)snprintf(text, sizeof(text), "Dist: %lu.%01lu cm",
+                   (unsigned long)(mm / 10u), (unsigned long)(mm % 10u));
+
+    s_flushed_px = 0;
+    const uint64_t t0 = test_now_ns();
+    if (readout != NULL)
+    {
+      (void)ser_lvgl_readout_set_text(readout, text);
+    }
+    else
+    {
+      lv_label_set_text(label, text);
+    }
+    lv_refr_now(s_disp);
+    r.ns += test_now_ns() - t0;
+    r.px += s_flushed_px;
+
+    if ((i % CHECK_EVERY) == 0u)
+    {
+      TEST_CHECK(matches_full_redraw());
+    }
+  }
+  return r;
+}
+
+int main(void)
+{
+  lv_init();
+  s_disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_disp, flush_cb);
+  lv_display_set_buffers(s_disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_add_style(scr, &ser_lvgl_style_screen, 0);
+
+  /* readout */
+  lv_obj_t *ro = ser_lvgl_readout_create(scr, 16u);
+  lv_obj_add_style(ro, &ser_lvgl_style_readout, 0);
+  lv_obj_center(ro);
+  (void)ser_lvgl_readout_set_text(ro, "Dist: -- cm");
+  lv_refr_now(s_disp);
+
+  /* 文本不变：不失效、不刷新 */
+  s_flushed_px = 0;
+  TEST_CHECK(ser_lvgl_readout_set_text(ro, "Dist: -- cm") == 0u);
+  lv_refr_now(s_disp);
+  TEST_CHECK(s_flushed_px == 0u);
+
+  ser_lvgl_readout_stats_t st0;
+  ser_lvgl_readout_get_stats(&st0);
+  const phase_t pr = run_phase(ro, NULL);
+  ser_lvgl_readout_stats_t st1;
+  ser_lvgl_readout_get_stats(&st1);
+  TEST_CHECK(matches_full_redraw());
+  TEST_CHECK(st1.updates - st0.updates == UPDATES);
+  /* 刷新区域按渲染对齐会略大于失效的字形框，但不会更少 */
+  TEST_CHECK(pr.px >= st1.invalidated_px - st0.invalidated_px);
+  lv_obj_delete(ro);
+
+  /* lv_label（原做法） */
+  lv_obj_t *lb = lv_label_create(scr);
+  lv_obj_add_style(lb, &ser_lvgl_style_readout, 0);
+  lv_obj_center(lb);
+  lv_label_set_text(lb, "Dist: -- cm");
+  lv_refr_now(s_disp);
+  const phase_t pl = run_phase(NULL, lb);
+  TEST_CHECK(matches_full_redraw());
+
+  printf("readout: %.0f px/update %.1f us/update (host)\n",
+         (double)pr.px / UPDATES, pr.ns / 1e3 / UPDATES);
+  printf("label  : %.0f px/update %.1f us/update (host)\n",
+         (double)pl.px / UPDATES, pl.ns / 1e3 / UPDATES);
+  printf("readout/label pixels: %.2f\n", (double)pr.px / (double)pl.px);
+
+  TEST_CHECK(pr.px * 2u < pl.px);
+
+  return test_done();
+}
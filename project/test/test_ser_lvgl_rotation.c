@@ -0,0 +1,341 @@
+/*
+ * 显示方向运行时切换（RGB565 帧缓冲，默认固件配置）
+ *
+ * 按 ser_lvgl 的做法搭被测 display：面板分辨率、0 度 DIRECT 直写帧缓冲，
+ * 挂瓦片脏区与滚动搬移；旋转时按 ser_lvgl_set_rotation 的顺序切换
+ * （dev_lcd 方向 -> 逻辑分辨率 -> DIRECT/PARTIAL 缓冲 -> 整屏失效），
+ * PARTIAL 条带经 ser_rot565 旋转写入帧缓冲。
+ * 参照 display 在逻辑分辨率下 FULL 模式渲染同一界面，逐像素旋转后与帧缓冲比较。
+ *
+ * - 0 -> 90 -> 180 -> 270 -> 0 -> 180 -> 0，每个方向若干帧（滚动 + 改文字 + 改宽度），
+ *   每一帧帧缓冲与参照逐像素相同
+ * - 0 度时滚动搬移生效；旋转期间搬移退回整块重绘（帧缓冲不是渲染目标）
+ * - 瓦片脏区在竖屏 480x800 下仍然接管失效，精确区域不溢出
+ * - 触摸：面板坐标经 dev_lcd_to_logical 换算后落在参照界面的同一像素上
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dev_lcd.h"
+#include "fake_dri_lcd.h"
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "src/display/lv_display_private.h"
+#include "ser_lvgl_damage.h"
+#include "ser_lvgl_scroll.h"
+#include "ser_rot565.h"
+
+#define MAX_W 800u
+#define MAX_H 480u
+#define STRIP_LINES 48u
+#define FRAMES 12u
+
+typedef struct
+{
+  lv_display_t *disp;
+  lv_obj_t *box;
+  lv_obj_t *label;
+  lv_obj_t *bar;
+} scene_t;
+
+static uint16_t s_ref_buf[MAX_W * MAX_H];
+static uint16_t s_strip[MAX_W * STRIP_LINES];
+static uint16_t s_expect[MAX_W * MAX_H];
+static uint32_t s_ms;
+
+static scene_t s_dut;
+static scene_t s_ref;
+static bool s_direct;
+static uint64_t s_rendered_px;
+
+static uint32_t tick_cb(void)
+{
+  return s_ms;
+}
+
+/* ser_lvgl 的 flush（RGB565 帧缓冲部分） */
+static void dut_flush_cb(lv_display_t *disp, const lv_area_t *area,
+                         uint8_t *px_map)
+{
+  const dev_lcd_rotation_t rot = dev_lcd_get_rotation();
+  if (!s_direct && rot != DEV_LCD_ROT_0)
+  {
+    const uint32_t w = (uint32_t)lv_area_get_width(area);
+    const uint32_t h = (uint32_t)lv_area_get_height(area);
+    const int32_t fb_w = (int32_t)dev_lcd_width();
+    const int32_t fb_h = (int32_t)dev_lcd_height();
+    lv_area_t phys = *area;
+    ser_rot565_map_area((ser_rot565_t)rot, fb_w, fb_h, &phys.x1, &phys.y1,
+                        &phys.x2, &phys.y2);
+    TEST_CHECK(phys.x1 >= 0 && phys.y1 >= 0 && phys.x2 < fb_w &&
+               phys.y2 < fb_h);
+    uint16_t *fb = (uint16_t *)dev_lcd_framebuffer() +
+                   (uint32_t)phys.y1 * (uint32_t)fb_w + (uint32_t)phys.x1;
+    ser_rot565_rotate(fb, (uint32_t)fb_w, (const uint16_t *)px_map, w, w, h,
+                      (ser_rot565_t)rot);
+  }
+  lv_display_flush_ready(disp);
+}
+
+static void ref_flush_cb(lv_display_t *disp, const lv_area_t *area,
+                         uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static void render_start_cb(lv_event_t *e)
+{
+  lv_display_t *d = (lv_display_t *)lv_event_get_target(e);
+  for (uint32_t i = 0; i < d->inv_p; i++)
+  {
+    if (!d->inv_area_joined[i])
+    {
+      s_rendered_px += (uint64_t)lv_area_get_size(&d->inv_areas[i]);
+    }
+  }
+}
+
+/* ser_lvgl 的 lvgl_buffers_apply（RGB565 帧缓冲） */
+static void dut_buffers_apply(dev_lcd_rotation_t rot)
+{
+  s_direct = (rot == DEV_LCD_ROT_0);
+  if (s_direct)
+  {
+    lv_display_set_buffers(
+        s_dut.disp, dev_lcd_framebuffer(), NULL,
+        (uint32_t)dev_lcd_width() * (uint32_t)dev_lcd_height() * 2u,
+        LV_DISPLAY_RENDER_MODE_DIRECT);
+  }
+  else
+  {
+    lv_display_set_buffers(s_dut.disp, s_strip, NULL, sizeof(s_strip),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+  }
+}
+
+static void set_rotation(dev_lcd_rotation_t rot)
+{
+  /* ser_lvgl_set_rotation 的顺序 */
+  dev_lcd_set_rotation(rot);
+  lv_display_set_resolution(s_dut.disp, dev_lcd_logical_width(),
+                            dev_lcd_logical_height());
+  dut_buffers_apply(rot);
+  lv_obj_invalidate(lv_display_get_layer_sys(s_dut.disp));
+
+  lv_display_set_resolution(s_ref.disp, dev_lcd_logical_width(),
+                            dev_lcd_logical_height());
+  lv_obj_invalidate(lv_display_get_layer_sys(s_ref.disp));
+}
+
+static void build_scene(scene_t *sc)
+{
+  lv_display_set_default(sc->disp);
+  lv_obj_t *scr = lv_display_get_screen_active(sc->disp);
+  lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+  lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+
+  sc->label = lv_label_create(scr);
+  lv_label_set_text(sc->label, "distance");
+
+  sc->bar = lv_obj_create(scr);
+  lv_obj_set_size(sc->bar, lv_pct(50), 36);
+  lv_obj_set_style_bg_color(sc->bar, lv_color_hex(0xC04020), 0);
+  lv_obj_set_style_radius(sc->bar, 10, 0);
+
+  sc->box = lv_obj_create(scr);
+  lv_obj_set_size(sc->box, lv_pct(90), lv_pct(60));
+  lv_obj_set_flex_flow(sc->box, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_style_bg_opa(sc->box, LV_OPA_COVER, 0);
+  lv_obj_set_style_bg_color(sc->box, lv_color_hex(0xF0F0F0), 0);
+  for (uint32_t i = 0; i < 40u; i++)
+  {
+    lv_obj_t *l = lv_label_create(sc->box);
+    lv_label_set_text_fmt(l, "Reading %02u: %u mm", (unsigned)i,
+                          (unsigned)(i * 37u));
+  }
+}
+
+static void step(scene_t *sc, uint32_t n)
+{
+  lv_label_set_text_fmt(sc->label, "distance %u mm", (unsigned)(n * 13u));
+  lv_obj_set_width(sc->bar, lv_pct((int32_t)(20u + (n * 7u) % 70u)));
+  /* 来回滚动，不碰到两端 */
+  lv_obj_scroll_by(sc->box, 0, ((n / 6u) % 2u != 0u) ? 9 : -9, LV_ANIM_OFF);
+}
+
+/* 参照帧逐像素旋转到面板坐标后与帧缓冲比较；返回不同的像素数 */
+static uint32_t compare(void)
+{
+  const int32_t pw = (int32_t)dev_lcd_width();
+  const int32_t ph = (int32_t)dev_lcd_height();
+  const int32_t lw = (int32_t)dev_lcd_logical_width();
+  const int32_t lh = (int32_t)dev_lcd_logical_height();
+  const dev_lcd_rotation_t rot = dev_lcd_get_rotation();
+
+  for (int32_t y = 0; y < lh; y++)
+  {
+    for (int32_t x = 0; x < lw; x++)
+    {
+      int32_t px = x;
+      int32_t py = y;
+      switch (rot)
+      {
+      case DEV_LCD_ROT_90:
+        px = y;
+        py = ph - 1 - x;
+        break;
+      case DEV_LCD_ROT_180:
+        px = pw - 1 - x;
+        py = ph - 1 - y;
+        break;
+      case DEV_LCD_ROT_270:
+        px = pw - 1 - y;
+        py = x;
+        break;
+      default:
+        break;
+      }
+      s_expect[py * pw + px] = s_ref_buf[y * lw + x];
+    }
+  }
+
+  const uint16_t *fb = (const uint16_t *)dev_lcd_framebuffer();
+  uint32_t bad = 0;
+  for (int32_t i = 0; i < pw * ph; i++)
+  {
+    bad += (fb[i] != s_expect[i]) ? 1u : 0u;
+  }
+  return bad;
+}
+
+/* 面板四角与中心的触摸点换算到逻辑坐标后，参照界面该点的颜色与帧缓冲相同 */
+static uint32_t check_touch(void)
+{
+  const uint16_t pw = dev_lcd_width();
+  const uint16_t ph = dev_lcd_height();
+  const uint16_t pts[5][2] = {{0u, 0u},
+                              {(uint16_t)(pw - 1u), 0u},
+                              {0u, (uint16_t)(ph - 1u)},
+                              {(uint16_t)(pw - 1u), (uint16_t)(ph - 1u)},
+                              {(uint16_t)(pw / 3u), (uint16_t)(ph / 4u)}};
+  const uint16_t *fb = (const uint16_t *)dev_lcd_framebuffer();
+  uint32_t bad = 0;
+  for (uint32_t i = 0; i < 5u; i++)
+  {
+    uint16_t x = pts[i][0];
+    uint16_t y = pts[i][1];
+    dev_lcd_to_logical(&x, &y);
+    bad += (x >= dev_lcd_logical_width() || y >= dev_lcd_logical_height() ||
+            s_ref_buf[(uint32_t)y * dev_lcd_logical_width() + x] !=
+                fb[(uint32_t)pts[i][1] * pw + pts[i][0]])
+               ? 1u
+               : 0u;
+  }
+  return bad;
+}
+
+int main(void)
+{
+  static const dev_lcd_rotation_t seq[] = {
+      DEV_LCD_ROT_0,   DEV_LCD_ROT_90, DEV_LCD_ROT_180, DEV_LCD_ROT_270,
+      DEV_LCD_ROT_0,   DEV_LCD_ROT_180, DEV_LCD_ROT_0};
+
+  TEST_CHECK(dev_lcd_init() == HAL_OK);
+  TEST_CHECK(dev_lcd_is_native_rgb565());
+  TEST_CHECK(dev_lcd_width() == MAX_W && dev_lcd_height() == MAX_H);
+  if (!dev_lcd_is_native_rgb565() || dev_lcd_width() != MAX_W ||
+      dev_lcd_height() != MAX_H)
+  {
+    return test_done();
+  }
+
+  lv_init();
+  lv_tick_set_cb(tick_cb);
+
+  /* 被测：与 ser_lvgl_boot_display 相同，先按 0 度挂接 */
+  dev_lcd_set_rotation(DEV_LCD_ROT_0);
+  s_dut.disp = lv_display_create(dev_lcd_width(), dev_lcd_height());
+  lv_display_set_color_format(s_dut.disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_dut.disp, dut_flush_cb);
+  dut_buffers_apply(DEV_LCD_ROT_0);
+  TEST_CHECK(ser_lvgl_damage_attach(s_dut.disp, false));
+  TEST_CHECK(ser_lvgl_scroll_init(s_dut.disp));
+  lv_display_add_event_cb(s_dut.disp, render_start_cb, LV_EVENT_RENDER_START,
+                          NULL);
+
+  s_ref.disp = lv_display_create(dev_lcd_width(), dev_lcd_height());
+  lv_display_set_color_format(s_ref.disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_ref.disp, ref_flush_cb);
+  lv_display_set_buffers(s_ref.disp, s_ref_buf, NULL, sizeof(s_ref_buf),
+                         LV_DISPLAY_RENDER_MODE_FULL);
+
+  build_scene(&s_dut);
+  build_scene(&s_ref);
+  TEST_CHECK(ser_lvgl_scroll_attach(s_dut.box));
+  lv_refr_now(NULL);
+
+  uint32_t n = 0;
+  for (uint32_t k = 0; k < sizeof(seq) / sizeof(seq[0]); k++)
+  {
+    if (seq[k] != dev_lcd_get_rotation())
+    {
+      set_rotation(seq[k]);
+    }
+
+    ser_lvgl_scroll_stats_t st0;
+    ser_lvgl_damage_stats_t dm0;
+    ser_lvgl_scroll_get_stats(&st0);
+    ser_lvgl_damage_get_stats(&dm0);
+    uint32_t bad_frames = 0;
+    s_rendered_px = 0;
+    for (uint32_t f = 0; f < FRAMES; f++, n++)
+    {
+      step(&s_dut, n);
+      step(&s_ref, n);
+      s_ms += 16u;
+      lv_timer_handler();
+      lv_refr_now(NULL);
+      bad_frames += (compare() != 0u) ? 1u : 0u;
+    }
+    TEST_CHECK(bad_frames == 0u);
+    TEST_CHECK(check_touch() == 0u);
+
+    /* 切换后的第一次滚动赶上整屏失效，照常重绘 */
+    ser_lvgl_scroll_stats_t st1;
+    ser_lvgl_scroll_get_stats(&st1);
+    const uint32_t blits = st1.blits - st0.blits;
+    const uint32_t scrolls = st1.scrolls - st0.scrolls;
+    TEST_CHECK(scrolls >= FRAMES);
+    if (seq[k] == DEV_LCD_ROT_0)
+    {
+      TEST_CHECK(s_direct && blits + 1u >= scrolls);
+    }
+    else
+    {
+      TEST_CHECK(!s_direct && blits == 0u);
+    }
+
+    /* 瓦片脏区仍在接管失效（竖屏 480x800 在 SER_LVGL_DAMAGE_MAX_W/H 之内） */
+    ser_lvgl_damage_stats_t dm1;
+    ser_lvgl_damage_get_stats(&dm1);
+    TEST_CHECK(dm1.invalidations - dm0.invalidations >= FRAMES);
+    TEST_CHECK(dm1.exact_overflow == 0u);
+
+    const uint64_t screen = (uint64_t)dev_lcd_width() * dev_lcd_height();
+    printf("rot %3u (%ux%u, %s): %u mismatched frames, %u/%u scrolls "
+           "blitted, %.2f screens rendered per frame (host)\n",
+           (unsigned)seq[k] * 90u, (unsigned)dev_lcd_logical_width(),
+           (unsigned)dev_lcd_logical_height(),
+           s_direct ? "DIRECT" : "PARTIAL", (unsigned)bad_frames,
+           (unsigned)blits, (unsigned)scrolls,
+           (double)s_rendered_px / (double)screen / FRAMES);
+  }
+  return test_done();
+}
@@ -0,0 +1,410 @@
+/*
+ * services/ser_lvgl_scroll：滚动时搬移已渲染像素
+ *
+ * 800x480 DIRECT 单缓冲，560x400 的容器（边框 + 圆角），两种内容（列表 / 长文本）
+ * 三种滚动方式（逐步拖动、scroll_to 动画、每帧两次滚动 + 列表项 / 标题改内容），
+ * 每种分别以 LVGL 原生整块重绘、attach 后搬移、搬移且拷贝隔几次中途失败
+ * （只搬了一半行）各跑一遍（子进程），要求：
+ * - 每一帧的帧缓冲逐像素相同
+ * - 搬移确实发生，且每帧渲染的像素明显少于整块重绘
+ * - 拷贝中途失败时退回整块重绘（帧缓冲同样逐像素相同）
+ * - 远端画面（每帧按 ser_fbstream_mark 的脏瓦片从帧缓冲取回）与帧缓冲相同：
+ *   搬移不经过 flush，漏标时远端要等到关键帧才更新
+ * 另查 init 拒绝双缓冲与 PARTIAL 模式。
+ * 拷贝替身按 DMA2D 的方式逐行、行内从左到右逐像素拷贝，能发现重叠拆块方向的错误。
+ * 基准：每帧渲染像素（原生 / 搬移）
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dev_lcd.h"
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "src/display/lv_display_private.h"
+#include "ser_fbstream.h"
+#include "ser_lvgl_damage.h"
+#include "ser_lvgl_scroll.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define FRAMES 120u
+#define TILE SER_FBSTREAM_TILE
+#define TX ((DISP_W + TILE - 1u) / TILE)
+#define TY ((DISP_H + TILE - 1u) / TILE)
+
+typedef enum
+{
+  SCENE_LIST,
+  SCENE_TEXT,
+} scene_t;
+
+typedef enum
+{
+  MOTION_DRAG,  /* 每帧 scroll_by 一步 */
+  MOTION_ANIM,  /* scroll_to 动画 */
+  MOTION_MULTI, /* 每帧两次滚动 + 改内容 */
+} motion_t;
+
+typedef struct
+{
+  scene_t scene;
+  motion_t motion;
+  bool accel;
+  uint32_t fail_every; /* 每隔几次拷贝中途失败一次，0 为不失败 */
+} run_cfg_t;
+
+typedef struct
+{
+  uint32_t hash[FRAMES];
+  uint64_t px;
+  uint32_t child_fails;
+  uint32_t stale_frames; /* 远端画面与帧缓冲不同的帧数 */
+  ser_lvgl_scroll_stats_t stats;
+} run_result_t;
+
+static uint16_t s_fb[DISP_W * DISP_H];
+static uint16_t s_fb2[DISP_W * DISP_H];
+static uint16_t s_remote[DISP_W * DISP_H];
+static uint32_t s_dirty[TY];
+static run_result_t s_res;
+static uint32_t s_ms;
+static uint32_t s_fail_every;
+static uint32_t s_copy_n;
+
+/* dev_lcd 替身：scroll 只用拷贝，damage 只用尺寸（DIRECT 模式不写出） */
+uint16_t dev_lcd_width(void)
+{
+  return DISP_W;
+}
+
+uint16_t dev_lcd_height(void)
+{
+  return DISP_H;
+}
+
+void dev_lcd_flush_rgb565_stride(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const uint16_t *px,
+                                 uint32_t src_stride)
+{
+  (void)x1;
+  (void)y1;
+  (void)x2;
+  (void)y2;
+  (void)px;
+  (void)src_stride;
+}
+
+/* 注入失败时像 DMA2D 中途出错一样只搬了前一半行 */
+bool dev_lcd_copy_rgb565(uint16_t *dst, const uint16_t *src, uint32_t w,
+                         uint32_t h, uint32_t stride)
+{
+  const bool fail = s_fail_every != 0u && ++s_copy_n % s_fail_every == 0u;
+  if (fail)
+  {
+    h /= 2u;
+  }
+  for (uint32_t y = 0; y < h; y++)
+  {
+    for (uint32_t x = 0; x < w; x++)
+    {
+      dst[x] = src[x];
+    }
+    dst += stride;
+    src += stride;
+  }
+  return !fail;
+}
+
+/* ser_fbstream 替身：同样裁剪到屏幕、按瓦片记位图 */
+void ser_fbstream_mark(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+  x1 = x1 < 0 ? 0 : x1;
+  y1 = y1 < 0 ? 0 : y1;
+  x2 = x2 >= DISP_W ? DISP_W - 1 : x2;
+  y2 = y2 >= DISP_H ? DISP_H - 1 : y2;
+  if (x1 > x2 || y1 > y2)
+  {
+    return;
+  }
+  const uint32_t mask = (uint32_t)(((1ull << ((uint32_t)x2 / TILE + 1u)) - 1u) &
+                                   ~((1ull << ((uint32_t)x1 / TILE)) - 1u));
+  for (uint32_t ty = (uint32_t)y1 / TILE; ty <= (uint32_t)y2 / TILE; ty++)
+  {
+    s_dirty[ty] |= mask;
+  }
+}
+
+/* 远端取走脏瓦片；返回远端与帧缓冲是否一致 */
+static bool remote_sync(void)
+{
+  for (uint32_t ty = 0; ty < TY; ty++)
+  {
+    for (uint32_t tx = 0; tx < TX; tx++)
+    {
+      if ((s_dirty[ty] & (1u << tx)) == 0u)
+      {
+        continue;
+      }
+      for (uint32_t y = ty * TILE; y < (ty + 1u) * TILE && y < DISP_H; y++)
+      {
+        const uint32_t x = tx * TILE;
+        const uint32_t w = (x + TILE <= DISP_W) ? TILE : DISP_W - x;
+        memcpy(&s_remote[y * DISP_W + x], &s_fb[y * DISP_W + x],
+               w * sizeof(uint16_t));
+      }
+    }
+    s_dirty[ty] = 0u;
+  }
+  return memcmp(s_remote, s_fb, sizeof(s_fb)) == 0;
+}
+
+static uint32_t tick_cb(void)
+{
+  return s_ms;
+}
+
+static uint32_t fnv1a(const uint16_t *p, uint32_t n)
+{
+  uint32_t h = 2166136261u;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    h = (h ^ p[i]) * 16777619u;
+  }
+  return h;
+}
+
+/* 与 ser_lvgl 的 flush 一样标记脏区 */
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)px_map;
+  ser_fbstream_mark(area->x1, area->y1, area->x2, area->y2);
+  lv_display_flush_ready(disp);
+}
+
+/* 渲染开始时统计本帧要画的像素（合并后的失效区域） */
+static void render_start_cb(lv_event_t *e)
+{
+  lv_display_t *d = (lv_display_t *)lv_event_get_target(e);
+  for (uint32_t i = 0; i < d->inv_p; i++)
+  {
+    if (!d->inv_area_joined[i])
+    {
+      s_res.px += (uint64_t)lv_area_get_size(&d->inv_areas[i]);
+    }
+  }
+}
+
+static lv_display_t *make_display(void *buf2, lv_display_render_mode_t mode)
+{
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_fb, buf2, sizeof(s_fb), mode);
+  return disp;
+}
+
+static lv_obj_t *make_scene(scene_t scene)
+{
+  lv_obj_t *scr = lv_screen_active();
+  lv_obj_t *title = lv_label_create(scr);
+  lv_label_set_text(title, "scroll");
+  lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 8);
+
+  lv_obj_t *box = lv_obj_create(scr);
+  lv_obj_set_size(box, 560, 400);
+  if (scene == SCENE_LIST)
+  {
+    lv_obj_set_flex_flow(box, LV_FLEX_FLOW_COLUMN);
+    for (uint32_t i = 0; i < 60u; i++)
+    {
+      lv_obj_t *it = lv_obj_create(box);
+      lv_obj_set_size(it, lv_pct(100), 44);
+      lv_obj_set_style_bg_color(it, lv_color_hex(0x203040u + i * 0x010203u),
+                                0);
+      lv_obj_t *l = lv_label_create(it);
+      lv_label_set_text_fmt(l, LV_SYMBOL_FILE "  Item %02u  settings entry",
+                            (unsigned)i);
+      lv_obj_center(l);
+    }
+  }
+  else
+  {
+    static char text[12000];
+    size_t len = 0;
+    for (uint32_t i = 0; i < 60u; i++)
+    {
+      len += (size_t)snprintf(&text[len], sizeof(text) - len,
+                              "%u. The quick brown fox jumps over the lazy "
+                              "dog; pack my box with five dozen jugs.\n",
+                              (unsigned)i);
+    }
+    lv_obj_t *l = lv_label_create(box);
+    lv_obj_set_width(l, lv_pct(100));
+    lv_label_set_text_static(l, text);
+  }
+  lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+  lv_obj_set_style_bg_color(box, lv_color_hex(0xF0F0F0), 0);
+  lv_obj_set_style_border_width(box, 2, 0);
+  lv_obj_set_style_radius(box, 8, 0);
+  lv_obj_set_style_pad_all(box, 10, 0);
+  lv_obj_align(box, LV_ALIGN_BOTTOM_MID, 0, -16);
+  return box;
+}
+
+static void step(lv_obj_t *box, const run_cfg_t *cfg, uint32_t k)
+{
+  static const int32_t steps[10] = {7, 7, 12, 3, 20, 1, 9, -5, -11, 30};
+  /* 每 40 帧换一次方向 */
+  const int32_t dir = ((k / 40u) % 2u != 0u) ? 1 : -1;
+
+  switch (cfg->motion)
+  {
+  case MOTION_DRAG:
+    lv_obj_scroll_by(box, 0, dir * steps[k % 10u], LV_ANIM_OFF);
+    break;
+  case MOTION_ANIM:
+    if (k % 30u == 0u)
+    {
+      lv_obj_scroll_to_y(box, ((k / 30u) % 2u != 0u) ? 0 : 1200, LV_ANIM_ON);
+    }
+    break;
+  case MOTION_MULTI:
+  default:
+    lv_obj_scroll_by(box, 0, dir * steps[k % 10u], LV_ANIM_OFF);
+    if (cfg->scene == SCENE_LIST)
+    {
+      lv_obj_t *it = lv_obj_get_child(box, (int32_t)((k * 7u) % 20u));
+      lv_label_set_text_fmt(lv_obj_get_child(it, 0), "changed %u",
+                            (unsigned)k);
+    }
+    else
+    {
+      /* 改整段文字会让容器整块失效，改容器外的标题 */
+      lv_label_set_text_fmt(lv_obj_get_child(lv_screen_active(), 0),
+                            "scroll %u", (unsigned)k);
+    }
+    lv_obj_scroll_by(box, 0, (k % 2u != 0u) ? 4 : -6, LV_ANIM_OFF);
+    break;
+  }
+}
+
+static void run(void *arg)
+{
+  const run_cfg_t *cfg = (const run_cfg_t *)arg;
+
+  s_fail_every = cfg->fail_every;
+  lv_init();
+  lv_tick_set_cb(tick_cb);
+  lv_display_t *disp = make_display(NULL, LV_DISPLAY_RENDER_MODE_DIRECT);
+  TEST_CHECK(ser_lvgl_damage_attach(disp, false));
+  if (cfg->accel)
+  {
+    TEST_CHECK(ser_lvgl_scroll_init(disp));
+  }
+  lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+
+  lv_obj_t *box = make_scene(cfg->scene);
+  if (cfg->accel)
+  {
+    TEST_CHECK(ser_lvgl_scroll_attach(box));
+  }
+  lv_refr_now(disp);
+  s_res.px = 0;
+  s_res.stale_frames = 0;
+  /* 关键帧 */
+  memcpy(s_remote, s_fb, sizeof(s_fb));
+  memset(s_dirty, 0, sizeof(s_dirty));
+
+  for (uint32_t k = 0; k < FRAMES; k++)
+  {
+    step(box, cfg, k);
+    s_ms += 16u;
+    lv_timer_handler();
+    lv_refr_now(disp);
+    s_res.hash[k] = fnv1a(s_fb, DISP_W * DISP_H);
+    s_res.stale_frames += remote_sync() ? 0u : 1u;
+  }
+  ser_lvgl_scroll_get_stats(&s_res.stats);
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+/* 只接受 DIRECT 单缓冲 */
+static void run_reject(void *arg)
+{
+  (void)arg;
+  lv_init();
+  lv_display_t *dbl = make_display(s_fb2, LV_DISPLAY_RENDER_MODE_DIRECT);
+  TEST_CHECK(ser_lvgl_damage_attach(dbl, false));
+  TEST_CHECK(!ser_lvgl_scroll_init(dbl));
+
+  lv_display_t *partial = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(partial, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(partial, flush_cb);
+  lv_display_set_buffers(partial, s_fb2, NULL, DISP_W * 40u * 2u,
+                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  TEST_CHECK(!ser_lvgl_scroll_init(partial));
+  s_res.child_fails = (uint32_t)s_test_fails;
+}
+
+int main(void)
+{
+  static const char *const scene_name[] = {"list", "text"};
+  static const char *const motion_name[] = {"drag", "anim", "multi"};
+  static run_result_t ref;
+  static run_result_t acc;
+  static run_result_t fail;
+
+  TEST_CHECK(test_fork(run_reject, NULL, &s_res, sizeof(s_res)));
+  TEST_CHECK(s_res.child_fails == 0u);
+
+  for (uint32_t sc = SCENE_LIST; sc <= SCENE_TEXT; sc++)
+  {
+    for (uint32_t mo = MOTION_DRAG; mo <= MOTION_MULTI; mo++)
+    {
+      run_cfg_t cfg = {.scene = (scene_t)sc, .motion = (motion_t)mo};
+      cfg.accel = false;
+      TEST_CHECK(test_fork(run, &cfg, &s_res, sizeof(s_res)));
+      ref = s_res;
+      cfg.accel = true;
+      TEST_CHECK(test_fork(run, &cfg, &s_res, sizeof(s_res)));
+      acc = s_res;
+      cfg.fail_every = 5u;
+      TEST_CHECK(test_fork(run, &cfg, &s_res, sizeof(s_res)));
+      fail = s_res;
+      TEST_CHECK(ref.child_fails == 0u && acc.child_fails == 0u &&
+                 fail.child_fails == 0u);
+
+      uint32_t mismatched = 0;
+      uint32_t fail_mismatched = 0;
+      for (uint32_t k = 0; k < FRAMES; k++)
+      {
+        mismatched += (ref.hash[k] != acc.hash[k]) ? 1u : 0u;
+        fail_mismatched += (ref.hash[k] != fail.hash[k]) ? 1u : 0u;
+      }
+      TEST_CHECK(mismatched == 0u);
+      TEST_CHECK(fail_mismatched == 0u);
+      TEST_CHECK(ref.stale_frames == 0u && acc.stale_frames == 0u &&
+                 fail.stale_frames == 0u);
+      TEST_CHECK(acc.stats.copy_failed == 0u);
+      TEST_CHECK(fail.stats.copy_failed > 0u && fail.stats.blits > 0u);
+      TEST_CHECK(acc.stats.blits > 0u);
+      TEST_CHECK(acc.px * 3u < ref.px);
+
+      printf("%s/%-5s: %6llu -> %6llu px/frame, blits %u, fallbacks %u, "
+             "copies %u, mismatched frames %u, stale remote frames %u; "
+             "injected copy failures %u, mismatched frames %u (host)\n",
+             scene_name[sc], motion_name[mo],
+             (unsigned long long)(ref.px / FRAMES),
+             (unsigned long long)(acc.px / FRAMES), (unsigned)acc.stats.blits,
+             (unsigned)acc.stats.fallbacks, (unsigned)acc.stats.copies,
+             (unsigned)mismatched, (unsigned)acc.stale_frames,
+             (unsigned)fail.stats.copy_failed, (unsigned)fail_mismatched);
+    }
+  }
+  return test_done();
+}
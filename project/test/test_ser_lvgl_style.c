@@ -0,0 +1,258 @@
+/*
+ * services/ser_lvgl_style：常量样式表与解析结果缓存
+ *
+ * 常量样式表 vs 本地样式（原 lv_obj_set_style_* 做法）：
+ * - 同一个启动界面建两遍：一遍直接用常量样式；另一遍建好后把每个对象挂的常量样式
+ *   逐属性改写成本地样式（等价于原来的 lv_obj_set_style_* 调用）
+ * - 统计 LVGL heap 的块数/字节与本地样式写入次数（每次写入扩展一次本地样式数组），
+ *   两遍渲染结果必须逐像素相同；再比较整屏重绘耗时（属性查找路径不同）
+ *
+ * 解析结果缓存（readout 的绘制参数）：
+ * - 重绘只在第一次解析；状态切换 / 增删样式后重新解析并按新样式绘制；
+ *   本地改不影响布局的属性后显式失效
+ * - 基准：lv_obj_init_draw_label_dsc 与缓存命中的耗时
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_obj_private.h"
+#include "src/core/lv_obj_style_private.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_readout.h"
+#include "ser_lvgl_style.h"
+#include "ser_lvgl_ui_boot.h"
+
+#define DISP_W 800
+#define DISP_H 480
+#define REDRAWS 50u
+#define LOOKUPS 200000u
+
+static uint16_t s_fb[DISP_W * DISP_H];
+static uint16_t s_ref[DISP_W * DISP_H];
+static lv_display_t *s_disp;
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+typedef struct
+{
+  size_t blocks;
+  size_t bytes;
+} heap_t;
+
+static heap_t heap_now(void)
+{
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  return (heap_t){.blocks = mon.used_cnt,
+                  .bytes = mon.total_size - mon.free_size};
+}
+
+/* 把 obj 及子对象上的常量样式改写为本地属性；返回写入的属性数 */
+static uint32_t const_to_local(lv_obj_t *obj)
+{
+  uint32_t sets = 0;
+  for (uint32_t i = 0; i < obj->style_cnt;)
+  {
+    const lv_style_t *style = obj->styles[i].style;
+    const lv_style_selector_t sel = obj->styles[i].selector;
+    if (!lv_style_is_const(style))
+    {
+      i++;
+      continue;
+    }
+
+    const lv_style_const_prop_t *p =
+        (const lv_style_const_prop_t *)style->values_and_props;
+    for (; p->prop != LV_STYLE_PROP_INV; p++)
+    {
+      /* 已有本地值时它本来就优先，保持不变 */
+      lv_style_value_t v;
+      if (lv_obj_get_local_style_prop(obj, p->prop, &v, sel) !=
+          LV_STYLE_RES_FOUND)
+      {
+        lv_obj_set_local_style_prop(obj, p->prop, p->value, sel);
+        sets++;
+      }
+    }
+    lv_obj_remove_style(obj, (lv_style_t *)style, sel);
+  }
+
+  const uint32_t n = lv_obj_get_child_count(obj);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    sets += const_to_local(lv_obj_get_child(obj, (int32_t)i));
+  }
+  return sets;
+}
+
+static double redraw_us(void)
+{
+  const uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < REDRAWS; i++)
+  {
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(s_disp);
+  }
+  return (test_now_ns() - t0) / 1e3 / REDRAWS;
+}
+
+static void test_const_vs_local(void)
+{
+  static ser_lvgl_ui_boot_t ui_const;
+  static ser_lvgl_ui_boot_t ui_local;
+
+  /* 常量样式 */
+  lv_obj_t *scr_const = lv_obj_create(NULL);
+  lv_screen_load(scr_const);
+  const heap_t h0 = heap_now();
+  ser_lvgl_ui_boot_create(&ui_const);
+  const heap_t h1 = heap_now();
+  lv_refr_now(s_disp);
+  memcpy(s_ref, s_fb, sizeof(s_fb));
+  const double t_const = redraw_us();
+
+  /* 本地样式 */
+  lv_obj_t *scr_local = lv_obj_create(NULL);
+  lv_screen_load(scr_local);
+  const heap_t h2 = heap_now();
+  ser_lvgl_ui_boot_create(&ui_local);
+  const uint32_t sets = const_to_local(scr_local);
+  const heap_t h3 = heap_now();
+  lv_refr_now(s_disp);
+  TEST_CHECK(memcmp(s_ref, s_fb, sizeof(s_fb)) == 0);
+  const double t_local = redraw_us();
+
+  printf("const styles: heap +%zu blocks +%zu bytes, redraw %.0f us (host)\n",
+         h1.blocks - h0.blocks, h1.bytes - h0.bytes, t_const);
+  printf("local styles: heap +%zu blocks +%zu bytes, %u local props, "
+         "redraw %.0f us (host)\n",
+         h3.blocks - h2.blocks, h3.bytes - h2.bytes, (unsigned)sets, t_local);
+
+  TEST_CHECK(sets > 0u);
+  TEST_CHECK(h3.bytes - h2.bytes > h1.bytes - h0.bytes);
+}
+
+static uint32_t count_px(uint16_t c)
+{
+  uint32_t n = 0;
+  for (uint32_t i = 0; i < DISP_W * DISP_H; i++)
+  {
+    n += (s_fb[i] == c) ? 1u : 0u;
+  }
+  return n;
+}
+
+static void test_cache(void)
+{
+  static const lv_style_const_prop_t s_red_props[] = {
+      LV_STYLE_CONST_TEXT_COLOR(SER_LVGL_HEX(0xFF0000)),
+      LV_STYLE_CONST_TEXT_OPA(LV_OPA_COVER), LV_STYLE_CONST_PROPS_END};
+  LV_STYLE_CONST_INIT(s_red, s_red_props);
+
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_screen_load(scr);
+  lv_obj_add_style(scr, &ser_lvgl_style_screen, 0);
+  lv_obj_t *card = lv_obj_create(scr);
+  lv_obj_add_style(card, &ser_lvgl_style_card, 0);
+  lv_obj_set_size(card, 400, 200);
+  lv_obj_center(card);
+  lv_obj_t *ro = ser_lvgl_readout_create(card, 16u);
+  lv_obj_add_style(ro, &ser_lvgl_style_readout, 0);
+  lv_obj_add_style(ro, &s_red, LV_STATE_CHECKED);
+  lv_obj_center(ro);
+  (void)ser_lvgl_readout_set_text(ro, "Dist: 88.8 cm");
+
+  /* 重绘只解析一次 */
+  ser_lvgl_style_cache_stats_t s0;
+  ser_lvgl_style_cache_stats_t s1;
+  lv_refr_now(s_disp);
+  ser_lvgl_style_cache_get_stats(&s0);
+  for (uint32_t i = 0; i < 10u; i++)
+  {
+    lv_obj_invalidate(ro);
+    lv_refr_now(s_disp);
+  }
+  ser_lvgl_style_cache_get_stats(&s1);
+  TEST_CHECK(s1.misses == s0.misses);
+  TEST_CHECK(s1.hits >= s0.hits + 10u);
+  TEST_CHECK(count_px(0xF800u) == 0u);
+
+  /* 状态切换：失效，按 CHECKED 样式绘制 */
+  lv_obj_add_state(ro, LV_STATE_CHECKED);
+  lv_refr_now(s_disp);
+  ser_lvgl_style_cache_get_stats(&s0);
+  TEST_CHECK(s0.misses == s1.misses + 1u);
+  TEST_CHECK(count_px(0xF800u) > 0u);
+
+  lv_obj_remove_state(ro, LV_STATE_CHECKED);
+  lv_refr_now(s_disp);
+  TEST_CHECK(count_px(0xF800u) == 0u);
+
+  /* 增删样式（STYLE_CHANGED） */
+  lv_obj_add_style(ro, &s_red, 0);
+  lv_refr_now(s_disp);
+  TEST_CHECK(count_px(0xF800u) > 0u);
+  lv_obj_remove_style(ro, &s_red, 0);
+  lv_refr_now(s_disp);
+  TEST_CHECK(count_px(0xF800u) == 0u);
+
+  /* 本地改颜色不发事件：显式失效（经父对象递归） */
+  lv_obj_set_style_text_color(ro, lv_color_hex(0x0000FF), 0);
+  lv_obj_set_style_text_opa(ro, LV_OPA_COVER, 0);
+  ser_lvgl_style_cache_invalidate(card);
+  lv_refr_now(s_disp);
+  TEST_CHECK(count_px(0x001Fu) > 0u);
+
+  /* 查找耗时：readout 在 card / screen 之下，opa 与文本属性都要沿父链解析 */
+  ser_lvgl_style_cache_t cache;
+  ser_lvgl_style_cache_attach(ro, &cache);
+  lv_draw_label_dsc_t dsc;
+  volatile uint32_t sink = 0;
+  uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < LOOKUPS; i++)
+  {
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(ro, LV_PART_MAIN, &dsc);
+    sink += dsc.color.blue;
+  }
+  const double t_resolve = (test_now_ns() - t0) / (double)LOOKUPS;
+  t0 = test_now_ns();
+  for (uint32_t i = 0; i < LOOKUPS; i++)
+  {
+    dsc = *ser_lvgl_style_cache_label(ro, &cache);
+    sink += dsc.color.blue;
+  }
+  const double t_cached = (test_now_ns() - t0) / (double)LOOKUPS;
+  TEST_CHECK(memcmp(&dsc, ser_lvgl_style_cache_label(ro, &cache),
+                    sizeof(dsc)) == 0);
+  TEST_CHECK(dsc.color.blue == 0xFFu && dsc.color.red == 0u);
+
+  printf("label dsc: resolve %.0f ns, cached %.0f ns (host)\n", t_resolve,
+         t_cached);
+}
+
+int main(void)
+{
+  lv_init();
+  s_disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_disp, flush_cb);
+  lv_display_set_buffers(s_disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+
+  test_const_vs_local();
+  test_cache();
+
+  return test_done();
+}
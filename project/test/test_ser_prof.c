@@ -0,0 +1,280 @@
+/*
+ * services/ser_prof：事件记录、打包与二进制流格式
+ *
+ * - 模拟 lv_refr 的嵌套 begin/end（refr > draw 任务 > flush），中途以随机大小的
+ *   缓冲 drain；按 prof2trace.py 的规则解包：INFO 在最前，名字先于引用它的事件，
+ *   事件时间戳单调、begin/end 成对嵌套，收到的事件数等于记录数
+ * - 不 drain 写满环形缓冲：多出的事件丢弃计数，DROP 包报告累计值，已记录的不被覆盖
+ * - 基准：一对 begin/end 的主机耗时
+ * 抓包写到 prof_capture.bin，随后由 test_prof2trace 用 prof2trace.py 解码
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_prof.h"
+
+#define FRAMES 300u
+#define DRAWS 6u
+#define BENCH_PAIRS 200000u
+#define CAPTURE "prof_capture.bin"
+
+#define PKT_INFO 1u
+#define PKT_NAME 2u
+#define PKT_EVENTS 3u
+#define PKT_DROP 4u
+
+#define MAX_DEPTH 8u
+
+static const char *const s_draw_tags[DRAWS] = {
+    "fill", "border", "label", "image", "line", "arc",
+};
+
+typedef struct
+{
+  uint32_t clock_hz;
+  uint32_t events;
+  uint32_t drop_total;
+  uint32_t errors;
+  uint32_t max_depth;
+  bool named[SER_PROF_MAX_TAGS];
+  uint32_t last_ts;
+  uint16_t stack[MAX_DEPTH];
+  uint32_t depth;
+} decoder_t;
+
+static uint16_t get_u16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static void decode_events(decoder_t *d, const uint8_t *p, uint32_t len)
+{
+  d->errors += (len % 8u != 0u) ? 1u : 0u;
+  for (uint32_t i = 0; i + 8u <= len; i += 8u)
+  {
+    const uint32_t ts = get_u32(&p[i]);
+    const uint16_t id = get_u16(&p[i + 4u]);
+    const uint8_t phase = p[i + 6u];
+
+    d->events++;
+    d->errors += (id >= SER_PROF_MAX_TAGS || !d->named[id]) ? 1u : 0u;
+    d->errors += (d->events > 1u && (int32_t)(ts - d->last_ts) < 0) ? 1u : 0u;
+    d->last_ts = ts;
+
+    if (phase == 0u)
+    {
+      if (d->depth >= MAX_DEPTH)
+      {
+        d->errors++;
+        continue;
+      }
+      d->stack[d->depth++] = id;
+      d->max_depth = (d->depth > d->max_depth) ? d->depth : d->max_depth;
+    }
+    else if (d->depth == 0u || d->stack[--d->depth] != id)
+    {
+      d->errors++;
+    }
+  }
+}
+
+/* 按 A5 5A | type | len(u16 LE) | payload 解包；返回消费的字节数 */
+static uint32_t decode(decoder_t *d, const uint8_t *buf, uint32_t n)
+{
+  uint32_t i = 0;
+  while (i + 5u <= n)
+  {
+    if (buf[i] != 0xA5u || buf[i + 1u] != 0x5Au)
+    {
+      d->errors++;
+      return n;
+    }
+    const uint8_t type = buf[i + 2u];
+    const uint16_t len = get_u16(&buf[i + 3u]);
+    const uint8_t *p = &buf[i + 5u];
+    if (i + 5u + len > n)
+    {
+      d->errors++;
+      return n;
+    }
+
+    /* INFO 必须在最前：没有时钟频率无法换算时间 */
+    if (type != PKT_INFO && d->clock_hz == 0u)
+    {
+      d->errors++;
+    }
+    switch (type)
+    {
+    case PKT_INFO:
+      d->clock_hz = get_u32(p);
+      d->errors += (get_u16(&p[4]) != 1u) ? 1u : 0u;
+      break;
+    case PKT_NAME:
+      if (p[2] == 0u && get_u16(p) < SER_PROF_MAX_TAGS)
+      {
+        d->named[get_u16(p)] = true;
+      }
+      break;
+    case PKT_EVENTS:
+      decode_events(d, p, len);
+      break;
+    case PKT_DROP:
+      d->drop_total = get_u32(p);
+      break;
+    default:
+      d->errors++;
+      break;
+    }
+    i += 5u + len;
+  }
+  return i;
+}
+
+static void drain_to(decoder_t *d, FILE *f, uint32_t cap)
+{
+  uint8_t buf[512];
+  uint32_t n;
+  while ((n = ser_prof_drain(buf, cap)) != 0u)
+  {
+    TEST_CHECK(n <= cap);
+    TEST_CHECK(decode(d, buf, n) == n);
+    if (f != NULL)
+    {
+      (void)fwrite(buf, 1, n, f);
+    }
+  }
+}
+
+static void spin(uint32_t n)
+{
+  for (volatile uint32_t i = 0; i < n; i++)
+  {
+  }
+}
+
+static void frame(void)
+{
+  ser_prof_begin("refr");
+  for (uint32_t i = 0; i < DRAWS; i++)
+  {
+    ser_prof_begin(s_draw_tags[i]);
+    spin(100u);
+    ser_prof_end(s_draw_tags[i]);
+  }
+  ser_prof_begin("flush");
+  spin(300u);
+  ser_prof_end("flush");
+  ser_prof_end("refr");
+}
+
+static void test_stream(void)
+{
+  static decoder_t d;
+  FILE *f = fopen(CAPTURE, "wb");
+  TEST_CHECK(f != NULL);
+
+  /* cap 小于 64 字节不输出 */
+  uint8_t small[63];
+  TEST_CHECK(ser_prof_drain(small, sizeof(small)) == 0u);
+
+  test_seed(32u);
+  for (uint32_t k = 0; k < FRAMES; k++)
+  {
+    frame();
+    if (test_rand_n(4u) == 0u)
+    {
+      drain_to(&d, f, 64u + test_rand_n(449u));
+    }
+  }
+  drain_to(&d, f, 64u);
+  if (f != NULL)
+  {
+    (void)fclose(f);
+  }
+
+  ser_prof_stats_t st;
+  ser_prof_get_stats(&st);
+  printf("stream: %u events, %u tags, max depth %u\n", (unsigned)d.events,
+         (unsigned)st.tags, (unsigned)d.max_depth);
+
+  TEST_CHECK(d.errors == 0u);
+  TEST_CHECK(d.clock_hz == 1000000000u);
+  TEST_CHECK(st.dropped == 0u && d.drop_total == 0u);
+  TEST_CHECK(st.recorded == FRAMES * (DRAWS + 2u) * 2u);
+  TEST_CHECK(st.sent == st.recorded && d.events == st.recorded);
+  TEST_CHECK(st.tags == DRAWS + 2u);
+  TEST_CHECK(d.depth == 0u && d.max_depth == 2u);
+}
+
+static void test_overflow(void)
+{
+  static decoder_t d;
+  ser_prof_stats_t st0;
+  ser_prof_stats_t st1;
+
+  /* 接在 test_stream 之后：INFO 与名字已经发过，解码状态视为已知 */
+  d.clock_hz = 1u;
+  for (uint32_t i = 0; i < SER_PROF_MAX_TAGS; i++)
+  {
+    d.named[i] = true;
+  }
+
+  ser_prof_get_stats(&st0);
+  const uint32_t pairs = SER_PROF_RING_EVENTS / 2u + 100u;
+  for (uint32_t i = 0; i < pairs; i++)
+  {
+    ser_prof_begin("fill");
+    ser_prof_end("fill");
+  }
+  ser_prof_get_stats(&st1);
+  TEST_CHECK(st1.recorded - st0.recorded == SER_PROF_RING_EVENTS);
+  TEST_CHECK(st1.dropped - st0.dropped == 200u);
+
+  drain_to(&d, NULL, 512u);
+  ser_prof_get_stats(&st1);
+  TEST_CHECK(d.errors == 0u);
+  TEST_CHECK(d.events == SER_PROF_RING_EVENTS);
+  TEST_CHECK(d.drop_total == st1.dropped);
+  TEST_CHECK(st1.sent == st1.recorded);
+}
+
+static void bench(void)
+{
+  uint8_t buf[512];
+  uint64_t ns = 0;
+  uint32_t done = 0;
+  while (done < BENCH_PAIRS)
+  {
+    const uint32_t n = SER_PROF_RING_EVENTS / 2u;
+    const uint64_t t0 = test_now_ns();
+    for (uint32_t i = 0; i < n; i++)
+    {
+      ser_prof_begin("refr");
+      ser_prof_end("refr");
+    }
+    ns += test_now_ns() - t0;
+    done += n;
+    while (ser_prof_drain(buf, sizeof(buf)) != 0u)
+    {
+    }
+  }
+  printf("begin+end: %.1f ns/pair (host)\n", (double)ns / done);
+}
+
+int main(void)
+{
+  test_stream();
+  test_overflow();
+  bench();
+  return test_done();
+}
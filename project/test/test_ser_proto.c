@@ -0,0 +1,374 @@
+/*
+ * services/ser_proto：COBS/CRC-16 编解码、接收环解析与模糊测试（SER_PROTO_HOST=1）
+ *
+ * - CRC-16/CCITT-FALSE 标准校验值；分段计算与一次计算相同
+ * - COBS：随机原文（含大量 0x00 与 254 字节边界附近的长度）分段编码、两段解码、
+ *   原地解码往返；编码长度不超过 SER_COBS_MAX_ENC，cap 少 1 字节时失败
+ * - 全部消息类型 encode -> ser_proto_frame -> handler 拿到相同负载
+ * - 接收环：随机分块写入、跨越环尾、开头半帧；溢出与超长帧后重新同步
+ * - 模糊：随机字节与单比特翻转的合法帧喂 ser_proto_frame 和接收环，
+ *   翻转后的帧不能被当作原消息分发
+ * - 基准：编码与接收环解析的主机吞吐
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_proto.h"
+
+#define RING 512u
+#define COBS_ROUNDS 50000u
+#define STREAM_FRAMES 200000u
+#define FUZZ_ROUNDS 500000u
+#define BENCH_BYTES (1u << 20)
+
+static uint8_t s_ring[RING];
+
+static uint32_t s_got[SER_PROTO_MSG_NUM];
+static uint8_t s_last[sizeof(ser_proto_any_t)];
+static uint32_t s_last_token;
+static uint32_t s_order_errors;
+
+static void on_msg(ser_proto_msg_t msg, const void *payload, void *arg)
+{
+  (void)arg;
+  s_got[msg]++;
+  memcpy(s_last, payload, ser_proto_msg_size(msg));
+}
+
+/* 流测试：ping.token 必须逐个递增 */
+static void on_ping_seq(ser_proto_msg_t msg, const void *payload, void *arg)
+{
+  (void)arg;
+  ser_proto_ping_t p;
+  memcpy(&p, payload, sizeof(p));
+  s_got[msg]++;
+  s_order_errors += (p.token != s_last_token + 1u) ? 1u : 0u;
+  s_last_token = p.token;
+}
+
+static void register_all(ser_proto_handler_t fn)
+{
+  for (uint32_t i = 0; i < SER_PROTO_MSG_NUM; i++)
+  {
+    TEST_CHECK(ser_proto_on((ser_proto_msg_t)i, fn, NULL));
+  }
+  memset(s_got, 0, sizeof(s_got));
+  ser_proto_reset_stats();
+}
+
+static void test_crc(void)
+{
+  const uint8_t check[] = "123456789";
+  TEST_CHECK(ser_crc16(SER_CRC16_INIT, check, 9u) == 0x29B1u);
+
+  uint8_t buf[300];
+  test_seed(40u);
+  for (uint32_t i = 0; i < sizeof(buf); i++)
+  {
+    buf[i] = (uint8_t)test_rand();
+  }
+  const uint16_t whole = ser_crc16(SER_CRC16_INIT, buf, sizeof(buf));
+  const uint16_t part =
+      ser_crc16(ser_crc16(SER_CRC16_INIT, buf, 117u), buf + 117u, 183u);
+  TEST_CHECK(whole == part);
+}
+
+static void test_cobs(void)
+{
+  static uint8_t raw[1100];
+  static uint8_t enc[SER_COBS_MAX_ENC(sizeof(raw))];
+  static uint8_t dec[sizeof(raw)];
+  uint32_t fails = 0;
+
+  test_seed(401u);
+  for (uint32_t it = 0; it < COBS_ROUNDS; it++)
+  {
+    /* 一半轮次取 254 字节边界附近的长度、不含 0x00 */
+    const bool boundary = test_rand_n(2u) == 0u;
+    const uint32_t n = boundary ? 254u * (1u + test_rand_n(4u)) - 2u +
+                                      test_rand_n(5u)
+                                : test_rand_n(sizeof(raw));
+    const uint32_t zero_1_in = 1u + test_rand_n(8u);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      raw[i] = (!boundary && test_rand_n(zero_1_in) == 0u)
+                   ? 0u
+                   : (uint8_t)(1u + test_rand_n(255u));
+    }
+
+    ser_cobs_enc_t e;
+    ser_cobs_enc_begin(&e, enc, sizeof(enc));
+    const uint32_t k = test_rand_n(n + 1u);
+    ser_cobs_enc_put(&e, raw, k);
+    ser_cobs_enc_put(&e, raw + k, n - k);
+    const uint32_t m = ser_cobs_enc_end(&e);
+    fails += (m == 0u || m > SER_COBS_MAX_ENC(n)) ? 1u : 0u;
+    fails += (memchr(enc, 0, m) != NULL) ? 1u : 0u;
+
+    /* cap 正好 / 少 1 字节 */
+    ser_cobs_enc_begin(&e, enc, m - 1u);
+    ser_cobs_enc_put(&e, raw, n);
+    fails += (ser_cobs_enc_end(&e) != 0u) ? 1u : 0u;
+    ser_cobs_enc_begin(&e, enc, m);
+    ser_cobs_enc_put(&e, raw, n);
+    fails += (ser_cobs_enc_end(&e) != m) ? 1u : 0u;
+
+    /* 两段解码（环形缓冲跨越末尾） */
+    const uint32_t s = test_rand_n(m + 1u);
+    const int32_t d = ser_cobs_decode(enc, s, enc + s, m - s, dec, sizeof(dec));
+    fails += (d != (int32_t)n || memcmp(dec, raw, n) != 0) ? 1u : 0u;
+    /* 输出空间不足 */
+    if (n > 0u)
+    {
+      fails += (ser_cobs_decode(enc, m, NULL, 0u, dec, n - 1u) != -1) ? 1u : 0u;
+    }
+
+    /* 原地解码 */
+    const int32_t d2 = ser_cobs_decode(enc, m, NULL, 0u, enc, m);
+    fails += (d2 != (int32_t)n || memcmp(enc, raw, n) != 0) ? 1u : 0u;
+  }
+  TEST_CHECK(fails == 0u);
+
+  /* 码字节为 0x00、码字节越界 */
+  const uint8_t has_zero[] = {0x02u, 0x11u, 0x00u};
+  const uint8_t overrun[] = {0x05u, 0x11u, 0x22u};
+  TEST_CHECK(ser_cobs_decode(has_zero, 3u, NULL, 0u, dec, sizeof(dec)) == -1);
+  TEST_CHECK(ser_cobs_decode(overrun, 3u, NULL, 0u, dec, sizeof(dec)) == -1);
+}
+
+static void test_messages(void)
+{
+  register_all(on_msg);
+  uint8_t wire[SER_PROTO_MAX_WIRE];
+  uint8_t payload[sizeof(ser_proto_any_t)];
+
+  test_seed(402u);
+  for (uint32_t i = 0; i < SER_PROTO_MSG_NUM; i++)
+  {
+    const ser_proto_msg_t msg = (ser_proto_msg_t)i;
+    const uint16_t size = ser_proto_msg_size(msg);
+    TEST_CHECK(ser_proto_msg_of_id(ser_proto_msg_id(msg)) == msg);
+    for (uint32_t rep = 0; rep < 100u; rep++)
+    {
+      for (uint32_t b = 0; b < size; b++)
+      {
+        /* 负载里多放 0x00，走 COBS 的各种分段 */
+        payload[b] = (test_rand_n(3u) == 0u) ? 0u : (uint8_t)test_rand();
+      }
+      const uint32_t n = ser_proto_encode(msg, payload, wire, sizeof(wire));
+      TEST_CHECK(n >= 4u && n <= SER_PROTO_MAX_WIRE && wire[n - 1u] == 0u);
+      TEST_CHECK(ser_proto_encode(msg, payload, wire, n - 1u) == 0u);
+      (void)ser_proto_encode(msg, payload, wire, n);
+      TEST_CHECK(ser_proto_frame(wire, n - 1u));
+      TEST_CHECK(memcmp(s_last, payload, size) == 0);
+    }
+    TEST_CHECK(s_got[i] == 100u);
+  }
+
+  /* 未知 id / 无 handler / 负载为 NULL */
+  TEST_CHECK(ser_proto_msg_of_id(0x7Fu) == SER_PROTO_MSG_NUM);
+  TEST_CHECK(ser_proto_encode(SER_PROTO_MSG_ping, NULL, wire, sizeof(wire)) ==
+             0u);
+  const ser_proto_distance_t dist = {.mm = 5};
+  const uint32_t n =
+      ser_proto_encode(SER_PROTO_MSG_distance, &dist, wire, sizeof(wire));
+  TEST_CHECK(ser_proto_on(SER_PROTO_MSG_distance, NULL, NULL));
+  TEST_CHECK(!ser_proto_frame(wire, n - 1u));
+  ser_proto_stats_t st;
+  ser_proto_get_stats(&st);
+  TEST_CHECK(st.unhandled == 1u && st.crc_err == 0u && st.cobs_err == 0u);
+}
+
+/* 把一段字节写进环（不检查覆盖，由调用方决定何时 poll） */
+static uint32_t ring_put(uint32_t wr, const uint8_t *p, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+  {
+    s_ring[(wr + i) & (RING - 1u)] = p[i];
+  }
+  return wr + n;
+}
+
+static void test_stream(void)
+{
+  register_all(on_ping_seq);
+  s_last_token = 0u;
+  s_order_errors = 0u;
+
+  ser_proto_rx_t rx;
+  /* 写位置从 32 位回绕前开始 */
+  uint32_t wr = 0xFFFFF000u;
+  ser_proto_rx_init(&rx, s_ring, RING);
+  ser_proto_rx_resync(&rx, wr);
+
+  /* 中途接入：第一个分隔符前的半帧丢弃 */
+  const uint8_t half[] = {0x55u, 0x66u, 0x77u, 0x00u};
+  wr = ring_put(wr, half, sizeof(half));
+
+  test_seed(403u);
+  uint8_t wire[SER_PROTO_MAX_WIRE];
+  uint32_t pending = 0;
+  uint32_t polled = 0;
+  for (uint32_t i = 1; i <= STREAM_FRAMES; i++)
+  {
+    const ser_proto_ping_t p = {.token = i};
+    const uint32_t n = ser_proto_encode(SER_PROTO_MSG_ping, &p, wire,
+                                        sizeof(wire));
+    /* 环里未处理的数据不超过环大小（模拟任务及时处理） */
+    if (pending + n > RING || test_rand_n(3u) == 0u)
+    {
+      polled += ser_proto_rx_poll(&rx, wr);
+      pending = 0;
+    }
+    wr = ring_put(wr, wire, n);
+    pending += n;
+  }
+  polled += ser_proto_rx_poll(&rx, wr);
+
+  ser_proto_stats_t st;
+  ser_proto_get_stats(&st);
+  TEST_CHECK(polled == STREAM_FRAMES && s_got[SER_PROTO_MSG_ping] ==
+                                            STREAM_FRAMES);
+  TEST_CHECK(s_order_errors == 0u);
+  TEST_CHECK(st.crc_err == 0u && st.cobs_err == 0u && st.len_err == 0u &&
+             st.overrun == 0u && st.too_long == 0u);
+
+  /* 溢出：一次写入超过环大小，丢弃后从下一个分隔符继续 */
+  uint8_t junk[RING + 40u];
+  memset(junk, 0x11, sizeof(junk));
+  wr = ring_put(wr, junk, sizeof(junk));
+  TEST_CHECK(ser_proto_rx_poll(&rx, wr) == 0u);
+  ser_proto_ping_t p = {.token = s_last_token + 1u};
+  uint32_t n = ser_proto_encode(SER_PROTO_MSG_ping, &p, wire, sizeof(wire));
+  wr = ring_put(wr, half, sizeof(half)); /* 半帧收尾 */
+  wr = ring_put(wr, wire, n);
+  TEST_CHECK(ser_proto_rx_poll(&rx, wr) == 1u);
+
+  /* 超长：超过 SER_PROTO_MAX_WIRE 仍无分隔符 */
+  uint8_t longf[SER_PROTO_MAX_WIRE + 8u];
+  memset(longf, 0x22, sizeof(longf));
+  wr = ring_put(wr, longf, sizeof(longf));
+  TEST_CHECK(ser_proto_rx_poll(&rx, wr) == 0u);
+  p.token = s_last_token + 1u;
+  n = ser_proto_encode(SER_PROTO_MSG_ping, &p, wire, sizeof(wire));
+  wr = ring_put(wr, half + 3, 1u);
+  wr = ring_put(wr, wire, n);
+  TEST_CHECK(ser_proto_rx_poll(&rx, wr) == 1u);
+
+  ser_proto_get_stats(&st);
+  TEST_CHECK(st.overrun == 1u && st.too_long == 1u && s_order_errors == 0u);
+}
+
+static void test_fuzz(void)
+{
+  register_all(on_msg);
+  ser_proto_rx_t rx;
+  ser_proto_rx_init(&rx, s_ring, RING);
+  uint32_t wr = 0;
+
+  uint8_t f[SER_PROTO_MAX_WIRE + 64u];
+  uint32_t flipped = 0;
+  uint32_t undetected = 0;
+
+  test_seed(404u);
+  for (uint32_t it = 0; it < FUZZ_ROUNDS; it++)
+  {
+    if (test_rand_n(2u) == 0u)
+    {
+      /* 合法帧翻转一个比特：不能作为原消息被分发 */
+      ser_proto_bus_stats_t b = {.topic = (uint8_t)test_rand(),
+                                 .publishes = test_rand(),
+                                 .rate_mhz = test_rand() & 0xFFu,
+                                 .stale = 0u};
+      const uint32_t n =
+          ser_proto_encode(SER_PROTO_MSG_bus_stats, &b, f, sizeof(f)) - 1u;
+      f[test_rand_n(n)] ^= (uint8_t)(1u << test_rand_n(8u));
+      memset(s_got, 0, sizeof(s_got));
+      (void)ser_proto_frame(f, n);
+      flipped++;
+      for (uint32_t i = 0; i < SER_PROTO_MSG_NUM; i++)
+      {
+        undetected += s_got[i];
+      }
+    }
+    else
+    {
+      const uint32_t n = test_rand_n(sizeof(f));
+      for (uint32_t i = 0; i < n; i++)
+      {
+        f[i] = (uint8_t)test_rand();
+      }
+      (void)ser_proto_frame(f, n);
+    }
+
+    /* 接收环：随机噪声，夹杂分隔符 */
+    const uint32_t c = test_rand_n(200u);
+    for (uint32_t i = 0; i < c; i++)
+    {
+      s_ring[(wr + i) & (RING - 1u)] =
+          (test_rand_n(8u) == 0u) ? 0u : (uint8_t)test_rand();
+    }
+    wr += c;
+    (void)ser_proto_rx_poll(&rx, wr);
+  }
+
+  ser_proto_stats_t st;
+  ser_proto_get_stats(&st);
+  printf("fuzz: %u bit flips, %u undetected; crc %u cobs %u len %u "
+         "unknown %u too_long %u overrun %u frames %u\n",
+         (unsigned)flipped, (unsigned)undetected, (unsigned)st.crc_err,
+         (unsigned)st.cobs_err, (unsigned)st.len_err, (unsigned)st.unknown,
+         (unsigned)st.too_long, (unsigned)st.overrun, (unsigned)st.frames);
+  TEST_CHECK(undetected == 0u);
+}
+
+static void bench(void)
+{
+  static uint8_t stream[BENCH_BYTES];
+  static uint8_t work[BENCH_BYTES];
+  register_all(on_msg);
+
+  /* 最长的消息（bus_stats）连续排满 */
+  ser_proto_bus_stats_t b = {0};
+  uint32_t len = 0;
+  uint32_t frames = 0;
+  const uint64_t t0 = test_now_ns();
+  while (len + SER_PROTO_MAX_WIRE <= sizeof(stream))
+  {
+    b.publishes = len;
+    len += ser_proto_encode(SER_PROTO_MSG_bus_stats, &b, stream + len,
+                            SER_PROTO_MAX_WIRE);
+    frames++;
+  }
+  const double enc_ns = (double)(test_now_ns() - t0) / frames;
+
+  uint64_t best = UINT64_MAX;
+  for (uint32_t rep = 0; rep < 10u; rep++)
+  {
+    memcpy(work, stream, len);
+    ser_proto_rx_t rx;
+    ser_proto_rx_init(&rx, work, sizeof(work));
+    const uint64_t t = test_now_ns();
+    TEST_CHECK(ser_proto_rx_poll(&rx, len) == frames - 1u); /* 第一帧按半帧丢弃 */
+    const uint64_t dt = test_now_ns() - t;
+    best = (dt < best) ? dt : best;
+  }
+  printf("encode %.0f ns/frame, parse %.0f MB/s (%u-byte frames, host)\n",
+         enc_ns, (double)len / (double)best * 1e3,
+         (unsigned)(len / frames));
+}
+
+int main(void)
+{
+  test_crc();
+  test_cobs();
+  test_messages();
+  test_stream();
+  test_fuzz();
+  bench();
+  return test_done();
+}
@@ -0,0 +1,312 @@
+/*
+ * services/ser_rle565：行内游程 + 行间差分编码
+ *
+ * - 随机往返：像素按 随机 / 同左 / 同上 / 常量 混合，宽高与行距随机；
+ *   编码长度不超过 h * SER_RLE565_ROW_MAX_BYTES(w)，cap 少 1 字节时返回 0
+ * - 按列窗口解码（decode_row_clip，含原地更新）与整行解码的对应列相同
+ * - 截断与随机改写的码流：解码返回 false 或正常结束，不越界写（输出缓冲两侧哨兵）
+ * - 基准：真实启动界面（ser_lvgl_ui_boot，800x480）的压缩率与编解码吞吐；
+ *   按 ser_fbstream 的包格式写出 fb_capture.bin，由 test_fbview 交给 fbview.py 解码
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_rle565.h"
+
+#define DISP_W 800u
+#define DISP_H 480u
+#define ROUNDS 3000u
+#define MAX_W 300u
+#define MAX_H 24u
+#define GUARD 16u
+#define BENCH_REPS 20u
+#define CAPTURE "fb_capture.bin"
+
+static uint16_t s_src[MAX_H * (MAX_W + 8u)];
+static uint16_t s_dst[GUARD + MAX_H * MAX_W + GUARD];
+static uint8_t s_enc[MAX_H * SER_RLE565_ROW_MAX_BYTES(MAX_W)];
+
+static uint16_t s_fb[DISP_W * DISP_H];
+static uint16_t s_fb_dec[DISP_W * DISP_H];
+static uint8_t s_fb_enc[DISP_H * SER_RLE565_ROW_MAX_BYTES(DISP_W)];
+
+static void fill_random(uint32_t w, uint32_t h, uint32_t stride)
+{
+  const uint16_t k = (uint16_t)test_rand();
+  for (uint32_t y = 0; y < h; y++)
+  {
+    for (uint32_t x = 0; x < w; x++)
+    {
+      uint16_t *p = &s_src[y * stride + x];
+      switch (test_rand_n(4u))
+      {
+      case 0:
+        *p = (uint16_t)test_rand();
+        break;
+      case 1:
+        *p = (x > 0u) ? p[-1] : k;
+        break;
+      case 2:
+        *p = (y > 0u) ? p[-(int32_t)stride] : k;
+        break;
+      default:
+        *p = k;
+        break;
+      }
+    }
+  }
+}
+
+static bool guards_intact(void)
+{
+  for (uint32_t i = 0; i < GUARD; i++)
+  {
+    if (s_dst[i] != 0xDEADu ||
+        s_dst[GUARD + MAX_H * MAX_W + i] != 0xDEADu)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void set_guards(void)
+{
+  for (uint32_t i = 0; i < GUARD; i++)
+  {
+    s_dst[i] = 0xDEADu;
+    s_dst[GUARD + MAX_H * MAX_W + i] = 0xDEADu;
+  }
+}
+
+static void test_round_trip(void)
+{
+  uint16_t *dst = &s_dst[GUARD];
+  uint32_t fails = 0;
+
+  test_seed(34u);
+  for (uint32_t it = 0; it < ROUNDS; it++)
+  {
+    const uint32_t w = 1u + test_rand_n(MAX_W);
+    const uint32_t h = 1u + test_rand_n(MAX_H);
+    const uint32_t stride = w + test_rand_n(8u);
+    fill_random(w, h, stride);
+
+    const uint32_t cap = h * SER_RLE565_ROW_MAX_BYTES(w);
+    const uint32_t n = ser_rle565_encode(s_src, w, h, stride, s_enc, cap);
+    fails += (n == 0u || n > cap) ? 1u : 0u;
+    fails += (ser_rle565_encode(s_src, w, h, stride, s_enc, n - 1u) != 0u) ? 1u
+                                                                            : 0u;
+    (void)ser_rle565_encode(s_src, w, h, stride, s_enc, n);
+
+    set_guards();
+    if (!ser_rle565_decode(s_enc, n, dst, w, h, w))
+    {
+      fails++;
+      continue;
+    }
+    for (uint32_t y = 0; y < h; y++)
+    {
+      fails += (memcmp(&dst[y * w], &s_src[y * stride], w * 2u) != 0) ? 1u
+                                                                       : 0u;
+    }
+
+    /* 截断的码流 */
+    fails += ser_rle565_decode(s_enc, n - 1u, dst, w, h, w) ? 1u : 0u;
+    fails += guards_intact() ? 0u : 1u;
+  }
+  TEST_CHECK(fails == 0u);
+}
+
+static void test_clip(void)
+{
+  static uint16_t win[MAX_W];
+  static uint16_t win_prev[MAX_W];
+  uint32_t fails = 0;
+
+  test_seed(341u);
+  for (uint32_t it = 0; it < ROUNDS / 4u; it++)
+  {
+    const uint32_t w = 1u + test_rand_n(MAX_W);
+    const uint32_t h = 1u + test_rand_n(MAX_H);
+    fill_random(w, h, w);
+    const uint32_t n = ser_rle565_encode(
+        s_src, w, h, w, s_enc, h * SER_RLE565_ROW_MAX_BYTES(w));
+
+    const uint32_t x1 = test_rand_n(w);
+    const uint32_t x2 = x1 + test_rand_n(w - x1);
+    const uint32_t ww = x2 - x1 + 1u;
+    const bool in_place = test_rand_n(2u) == 0u;
+
+    /* 整行解码作参照；窗口解码的 prev 只含窗口列 */
+    const uint8_t *src_full = s_enc;
+    const uint8_t *src_win = s_enc;
+    for (uint32_t y = 0; y < h; y++)
+    {
+      const uint16_t *prev_full = (y > 0u) ? &s_dst[(y - 1u) * w] : NULL;
+      fails += ser_rle565_decode_row(&src_full, s_enc + n, &s_dst[y * w],
+                                     prev_full, w)
+                   ? 0u
+                   : 1u;
+
+      uint16_t *out = in_place ? win_prev : win;
+      const uint16_t *prev = (y > 0u) ? win_prev : NULL;
+      fails += ser_rle565_decode_row_clip(&src_win, s_enc + n, out, prev, w,
+                                          x1, x2)
+                   ? 0u
+                   : 1u;
+      fails += (memcmp(out, &s_dst[y * w + x1], ww * 2u) != 0) ? 1u : 0u;
+      if (!in_place)
+      {
+        memcpy(win_prev, win, ww * 2u);
+      }
+      fails += (src_win != src_full) ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(fails == 0u);
+}
+
+static void test_corrupt(void)
+{
+  uint16_t *dst = &s_dst[GUARD];
+  uint32_t decoded = 0;
+
+  test_seed(342u);
+  set_guards();
+  for (uint32_t it = 0; it < ROUNDS; it++)
+  {
+    const uint32_t w = 1u + test_rand_n(MAX_W);
+    const uint32_t h = 1u + test_rand_n(MAX_H);
+    fill_random(w, h, w);
+    const uint32_t n = ser_rle565_encode(
+        s_src, w, h, w, s_enc, h * SER_RLE565_ROW_MAX_BYTES(w));
+
+    const uint32_t flips = 1u + test_rand_n(8u);
+    for (uint32_t i = 0; i < flips; i++)
+    {
+      s_enc[test_rand_n(n)] = (uint8_t)test_rand();
+    }
+    decoded += ser_rle565_decode(s_enc, n, dst, w, h, w) ? 1u : 0u;
+  }
+  TEST_CHECK(guards_intact());
+  printf("corrupt streams: %u/%u still decoded (within bounds)\n",
+         (unsigned)decoded, (unsigned)ROUNDS);
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static void put_hdr(FILE *f, uint8_t type, uint16_t len)
+{
+  const uint8_t h[5] = {0xA5u, 0x5Au, type, (uint8_t)len,
+                        (uint8_t)(len >> 8)};
+  (void)fwrite(h, 1, sizeof(h), f);
+}
+
+static void put_u16(FILE *f, uint16_t v)
+{
+  const uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+  (void)fwrite(b, 1, sizeof(b), f);
+}
+
+/* ser_fbstream 的整屏帧：FRAME | RECT（每包第一行不参考上一行）... | END */
+static void write_capture(uint32_t rows_per_pkt)
+{
+  FILE *f = fopen(CAPTURE, "wb");
+  TEST_CHECK(f != NULL);
+  if (f == NULL)
+  {
+    return;
+  }
+
+  const uint8_t frame[9] = {0, 0, 0, 0, (uint8_t)DISP_W,
+                            (uint8_t)(DISP_W >> 8), (uint8_t)DISP_H,
+                            (uint8_t)(DISP_H >> 8), 1u};
+  put_hdr(f, 0x10u, sizeof(frame));
+  (void)fwrite(frame, 1, sizeof(frame), f);
+
+  for (uint32_t y = 0; y < DISP_H; y += rows_per_pkt)
+  {
+    const uint32_t n = ser_rle565_encode(&s_fb[y * DISP_W], DISP_W,
+                                         rows_per_pkt, DISP_W, s_fb_enc,
+                                         sizeof(s_fb_enc));
+    put_hdr(f, 0x11u, (uint16_t)(8u + n));
+    put_u16(f, 0u);
+    put_u16(f, (uint16_t)y);
+    put_u16(f, (uint16_t)DISP_W);
+    put_u16(f, (uint16_t)rows_per_pkt);
+    (void)fwrite(s_fb_enc, 1, n, f);
+  }
+
+  const uint8_t end[4] = {0, 0, 0, 0};
+  put_hdr(f, 0x12u, sizeof(end));
+  (void)fwrite(end, 1, sizeof(end), f);
+  (void)fclose(f);
+}
+
+static void bench_boot_screen(void)
+{
+  static ser_lvgl_ui_boot_t ui;
+
+  lv_init();
+  lv_display_t *disp = lv_display_create(DISP_W, DISP_H);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  ser_lvgl_ui_boot_create(&ui);
+  ser_lvgl_ui_boot_set_distance(&ui, 1234);
+  lv_refr_now(disp);
+
+  uint32_t n = 0;
+  uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_REPS; i++)
+  {
+    n = ser_rle565_encode(s_fb, DISP_W, DISP_H, DISP_W, s_fb_enc,
+                          sizeof(s_fb_enc));
+  }
+  const double enc_ns = (double)(test_now_ns() - t0) / BENCH_REPS;
+
+  t0 = test_now_ns();
+  bool ok = true;
+  for (uint32_t i = 0; i < BENCH_REPS; i++)
+  {
+    ok = ok && ser_rle565_decode(s_fb_enc, n, s_fb_dec, DISP_W, DISP_H,
+                                 DISP_W);
+  }
+  const double dec_ns = (double)(test_now_ns() - t0) / BENCH_REPS;
+  TEST_CHECK(ok);
+  TEST_CHECK(memcmp(s_fb, s_fb_dec, sizeof(s_fb)) == 0);
+
+  const double raw = (double)sizeof(s_fb);
+  printf("boot screen %ux%u: %u -> %u bytes (%.1fx), encode %.0f MB/s, "
+         "decode %.0f MB/s (host)\n",
+         (unsigned)DISP_W, (unsigned)DISP_H, (unsigned)sizeof(s_fb),
+         (unsigned)n, raw / n, raw / enc_ns * 1e3, raw / dec_ns * 1e3);
+  TEST_CHECK(n * 4u < sizeof(s_fb));
+
+  /* ser_fbstream 以 32 行瓦片带为单位发送 */
+  write_capture(32u);
+}
+
+int main(void)
+{
+  test_round_trip();
+  test_clip();
+  test_corrupt();
+  bench_boot_screen();
+  return test_done();
+}
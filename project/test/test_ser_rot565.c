@@ -0,0 +1,219 @@
+/*
+ * services/ser_rot565：RGB565 分块旋转
+ *
+ * - 随机尺寸（含奇数、不足一块）、行距、起始偏移（非字对齐）与方向，
+ *   结果与逐像素旋转相同，目标矩形外（行距空隙、两侧哨兵）不被写
+ * - map_area：小屏幕上穷举所有矩形，与逐点换算的外接矩形相同
+ * 基准：竖屏条带 480x48 与整屏 480x800 写入 800x480 帧缓冲，逐像素 / 分块
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_rot565.h"
+
+#define ROUNDS 3000u
+#define MAX_SIDE 70u
+#define PAD 5u
+#define GUARD 4u
+#define FB_W 800u
+#define FB_H 480u
+
+#define SRC_WORDS (MAX_SIDE * (MAX_SIDE + PAD) + GUARD)
+#define DST_WORDS (GUARD + MAX_SIDE * (MAX_SIDE + PAD) + GUARD)
+
+static uint16_t s_src[SRC_WORDS];
+static uint16_t s_got[DST_WORDS];
+static uint16_t s_want[DST_WORDS];
+
+static uint16_t s_fb[FB_W * FB_H];
+static uint16_t s_strip[FB_W * FB_H];
+
+/* 逻辑 (x, y) -> 物理坐标，物理尺寸 pw x ph（与头文件中的约定相同） */
+static void map_point(ser_rot565_t rot, int32_t pw, int32_t ph, int32_t x,
+                      int32_t y, int32_t *px, int32_t *py)
+{
+  switch (rot)
+  {
+  case SER_ROT565_90:
+    *px = y;
+    *py = ph - 1 - x;
+    break;
+  case SER_ROT565_180:
+    *px = pw - 1 - x;
+    *py = ph - 1 - y;
+    break;
+  case SER_ROT565_270:
+    *px = pw - 1 - y;
+    *py = x;
+    break;
+  case SER_ROT565_0:
+  default:
+    *px = x;
+    *py = y;
+    break;
+  }
+}
+
+/* 逐像素参考：dst 为目标矩形左上角，目标矩形内的物理坐标按 w x h 的逻辑屏幕换算 */
+static void rotate_naive(uint16_t *dst, uint32_t dst_stride,
+                         const uint16_t *src, uint32_t src_stride, uint32_t w,
+                         uint32_t h, ser_rot565_t rot)
+{
+  const bool swap = (rot == SER_ROT565_90 || rot == SER_ROT565_270);
+  const int32_t pw = (int32_t)(swap ? h : w);
+  const int32_t ph = (int32_t)(swap ? w : h);
+  for (uint32_t y = 0; y < h; y++)
+  {
+    for (uint32_t x = 0; x < w; x++)
+    {
+      int32_t px, py;
+      map_point(rot, pw, ph, (int32_t)x, (int32_t)y, &px, &py);
+      dst[(uint32_t)py * dst_stride + (uint32_t)px] = src[y * src_stride + x];
+    }
+  }
+}
+
+static void test_rotate(void)
+{
+  uint32_t bad = 0;
+  for (uint32_t round = 0; round < ROUNDS; round++)
+  {
+    const uint32_t w = 1u + test_rand_n(MAX_SIDE);
+    const uint32_t h = 1u + test_rand_n(MAX_SIDE);
+    const ser_rot565_t rot = (ser_rot565_t)test_rand_n(4u);
+    const uint32_t src_stride = w + test_rand_n(PAD);
+    const bool swap = (rot == SER_ROT565_90 || rot == SER_ROT565_270);
+    const uint32_t dw = swap ? h : w;
+    const uint32_t dst_stride = dw + test_rand_n(PAD);
+    /* 奇数偏移：源和目标都不是字对齐 */
+    const uint32_t src_off = test_rand_n(2u);
+    const uint32_t dst_off = GUARD + test_rand_n(2u);
+
+    for (uint32_t i = 0; i < SRC_WORDS; i++)
+    {
+      s_src[i] = (uint16_t)test_rand();
+    }
+    memset(s_got, 0xA5, sizeof(s_got));
+    memset(s_want, 0xA5, sizeof(s_want));
+
+    ser_rot565_rotate(&s_got[dst_off], dst_stride, &s_src[src_off],
+                      src_stride, w, h, rot);
+    rotate_naive(&s_want[dst_off], dst_stride, &s_src[src_off], src_stride, w,
+                 h, rot);
+    if (memcmp(s_got, s_want, sizeof(s_got)) != 0)
+    {
+      if (bad++ < 5u)
+      {
+        printf("mismatch: %ux%u rot %u, strides %u/%u\n", (unsigned)w,
+               (unsigned)h, (unsigned)rot * 90u, (unsigned)src_stride,
+               (unsigned)dst_stride);
+      }
+    }
+  }
+  TEST_CHECK(bad == 0u);
+}
+
+static int32_t min_i32(int32_t a, int32_t b)
+{
+  return (a < b) ? a : b;
+}
+
+static int32_t max_i32(int32_t a, int32_t b)
+{
+  return (a > b) ? a : b;
+}
+
+static void test_map_area(void)
+{
+  const int32_t pw = 7;
+  const int32_t ph = 5;
+  uint32_t bad = 0;
+  for (uint32_t r = 0; r < 4u; r++)
+  {
+    const ser_rot565_t rot = (ser_rot565_t)r;
+    const bool swap = (rot == SER_ROT565_90 || rot == SER_ROT565_270);
+    const int32_t lw = swap ? ph : pw;
+    const int32_t lh = swap ? pw : ph;
+    for (int32_t x1 = 0; x1 < lw; x1++)
+    {
+      for (int32_t x2 = x1; x2 < lw; x2++)
+      {
+        for (int32_t y1 = 0; y1 < lh; y1++)
+        {
+          for (int32_t y2 = y1; y2 < lh; y2++)
+          {
+            int32_t ax, ay, bx, by;
+            map_point(rot, pw, ph, x1, y1, &ax, &ay);
+            map_point(rot, pw, ph, x2, y2, &bx, &by);
+            int32_t m[4] = {x1, y1, x2, y2};
+            ser_rot565_map_area(rot, pw, ph, &m[0], &m[1], &m[2], &m[3]);
+            bad += (m[0] != min_i32(ax, bx) || m[1] != min_i32(ay, by) ||
+                    m[2] != max_i32(ax, bx) || m[3] != max_i32(ay, by))
+                       ? 1u
+                       : 0u;
+          }
+        }
+      }
+    }
+  }
+  TEST_CHECK(bad == 0u);
+}
+
+static void bench(void)
+{
+  static const struct
+  {
+    uint32_t w;
+    uint32_t h;
+    uint32_t reps;
+  } sizes[] = {{480u, 48u, 400u}, {480u, 800u, 30u}};
+
+  for (uint32_t i = 0; i < FB_W * FB_H; i++)
+  {
+    s_strip[i] = (uint16_t)(i * 2654435761u);
+  }
+  for (uint32_t z = 0; z < sizeof(sizes) / sizeof(sizes[0]); z++)
+  {
+    const uint32_t w = sizes[z].w;
+    const uint32_t h = sizes[z].h;
+    for (uint32_t r = 1; r < 4u; r += 2u)
+    {
+      const ser_rot565_t rot = (ser_rot565_t)r;
+      int32_t x1 = 0, y1 = 0, x2 = (int32_t)w - 1, y2 = (int32_t)h - 1;
+      ser_rot565_map_area(rot, FB_W, FB_H, &x1, &y1, &x2, &y2);
+      uint16_t *dst = &s_fb[(uint32_t)y1 * FB_W + (uint32_t)x1];
+
+      uint64_t t0 = test_now_ns();
+      for (uint32_t k = 0; k < sizes[z].reps; k++)
+      {
+        rotate_naive(dst, FB_W, s_strip, w, w, h, rot);
+      }
+      const uint64_t naive_ns = test_now_ns() - t0;
+      t0 = test_now_ns();
+      for (uint32_t k = 0; k < sizes[z].reps; k++)
+      {
+        ser_rot565_rotate(dst, FB_W, s_strip, w, w, h, rot);
+      }
+      const uint64_t tiled_ns = test_now_ns() - t0;
+
+      const double mpx = (double)w * h * sizes[z].reps * 1e3;
+      printf("%ux%u rot %3u: per-pixel %.0f Mpx/s, tiled %.0f Mpx/s "
+             "(%.2fx, host)\n",
+             (unsigned)w, (unsigned)h, (unsigned)r * 90u, mpx / naive_ns,
+             mpx / tiled_ns, (double)naive_ns / tiled_ns);
+    }
+  }
+}
+
+int main(void)
+{
+  test_seed(48u);
+  test_rotate();
+  test_map_area();
+  bench();
+  return test_done();
+}
@@ -0,0 +1,232 @@
+/*
+ * services/ser_sdram_bench：测量与配置档选择（SER_SDRAM_BENCH_HOST=1，主机内存）
+ *
+ * - 测量：4MB 主机内存上各项结果非 0、校验无错；输出主机自身的参考数据
+ * - 选择：模拟 port 的时钟按配置档放慢（档越慢计数越快），
+ *   best 为校验无错、in_spec 且最重负载下 seq_rd+seq_wr 最高的档；
+ *   切换失败的档输出 "apply failed" 并跳过；load_set 拒绝的组合不输出
+ * - 报告：每行 10 个 CSV 字段；截断时返回实际写入长度
+ * - profile_count 为 0：只测当前配置，best 为 current
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "ser_sdram_bench.h"
+
+#define REGION_BYTES (4u * 1024u * 1024u)
+#define LINES_MAX 32u
+
+typedef struct
+{
+  uint32_t cur; /* 当前配置档 */
+  uint32_t applies;
+  bool ltdc;
+  bool dma2d;
+  char lines[LINES_MAX][SER_SDRAM_BENCH_LINE_MAX];
+  uint32_t line_n;
+} sim_port_t;
+
+/* 配置档：名称 / 相对耗时（越大越慢）/ 是否在规格内 / 切换能否成功 */
+static const struct
+{
+  const char *name;
+  uint32_t slow;
+  bool in_spec;
+  bool apply_ok;
+} s_prof[] = {
+    {"default", 8u, true, true},
+    {"cas2", 3u, true, true},
+    {"overclock", 1u, false, true}, /* 最快但不在规格内 */
+    {"broken", 1u, true, false},    /* 切换失败 */
+};
+#define PROF_N (sizeof(s_prof) / sizeof(s_prof[0]))
+
+static uint32_t sim_now(void *ctx)
+{
+  const sim_port_t *p = (const sim_port_t *)ctx;
+  /* 负载越重越慢：LTDC +1/4，DMA2D +1/2 */
+  const uint64_t scale = 4u * s_prof[p->cur].slow + (p->ltdc ? 1u : 0u) +
+                         (p->dma2d ? 2u : 0u);
+  return (uint32_t)(test_now_ns() * scale / 4u);
+}
+
+static const char *sim_name(void *ctx, uint32_t idx)
+{
+  (void)ctx;
+  return s_prof[idx].name;
+}
+
+static bool sim_in_spec(void *ctx, uint32_t idx)
+{
+  (void)ctx;
+  return s_prof[idx].in_spec;
+}
+
+static bool sim_apply(void *ctx, uint32_t idx)
+{
+  sim_port_t *p = (sim_port_t *)ctx;
+  p->applies++;
+  if (!s_prof[idx].apply_ok)
+  {
+    return false;
+  }
+  p->cur = idx;
+  return true;
+}
+
+/* DMA2D 负载只在 default 档可用（其余档拒绝该组合） */
+static bool sim_load(void *ctx, bool ltdc, bool dma2d)
+{
+  sim_port_t *p = (sim_port_t *)ctx;
+  if (dma2d && p->cur != 0u)
+  {
+    return false;
+  }
+  p->ltdc = ltdc;
+  p->dma2d = dma2d;
+  return true;
+}
+
+static void sim_emit(void *ctx, const char *line)
+{
+  sim_port_t *p = (sim_port_t *)ctx;
+  if (p->line_n < LINES_MAX)
+  {
+    (void)snprintf(p->lines[p->line_n++], SER_SDRAM_BENCH_LINE_MAX, "%s",
+                   line);
+  }
+}
+
+static uint32_t count_char(const char *s, char c)
+{
+  uint32_t n = 0;
+  for (; *s != '\0'; s++)
+  {
+    n += (*s == c) ? 1u : 0u;
+  }
+  return n;
+}
+
+static uint32_t host_now(void *ctx)
+{
+  (void)ctx;
+  return (uint32_t)test_now_ns();
+}
+
+static void test_measure(void *mem)
+{
+  static const ser_sdram_bench_port_t port = {.now = host_now,
+                                              .hz = 1000000000u};
+  ser_sdram_bench_result_t r;
+  ser_sdram_bench_measure(&port, NULL, mem, REGION_BYTES, &r);
+
+  char line[SER_SDRAM_BENCH_LINE_MAX];
+  (void)ser_sdram_bench_format_header(line, sizeof(line));
+  printf("%s\n", line);
+  (void)ser_sdram_bench_format(line, sizeof(line), "host", false, false, &r);
+  printf("%s\n", line);
+
+  TEST_CHECK(r.errors == 0u);
+  TEST_CHECK(r.seq_read_kbps > 0u && r.seq_write_kbps > 0u &&
+             r.copy_kbps > 0u);
+  TEST_CHECK(r.rand_read_ns > 0u);
+
+  /* 区域太小：不测，结果全 0 */
+  ser_sdram_bench_measure(&port, NULL, mem, 1024u, &r);
+  TEST_CHECK(r.seq_read_kbps == 0u && r.errors == 0u);
+}
+
+static void test_select(void *mem)
+{
+  static sim_port_t sim;
+  const ser_sdram_bench_port_t port = {
+      .now = sim_now,
+      .hz = 1000000000u,
+      .profile_count = PROF_N,
+      .profile_name = sim_name,
+      .profile_in_spec = sim_in_spec,
+      .profile_apply = sim_apply,
+      .load_set = sim_load,
+      .emit = sim_emit,
+  };
+
+  /* 选择只看相对快慢，用小区域缩短时间 */
+  const int32_t best = ser_sdram_bench_run(&port, &sim, mem, 256u * 1024u);
+  for (uint32_t i = 0; i < sim.line_n; i++)
+  {
+    printf("  %s\n", sim.lines[i]);
+  }
+
+  TEST_CHECK(best == 1); /* cas2：在规格内最快；overclock 不在规格内 */
+  TEST_CHECK(sim.applies == PROF_N);
+  TEST_CHECK(!sim.ltdc && !sim.dma2d); /* 结束时撤掉负载 */
+
+  /* header + default 4 行 + cas2 2 行 + overclock 2 行 + apply failed + best */
+  TEST_CHECK(sim.line_n == 1u + 4u + 2u + 2u + 1u + 1u);
+  TEST_CHECK(sim.lines[0][0] == '#');
+  for (uint32_t i = 1; i < 9u; i++)
+  {
+    TEST_CHECK(count_char(sim.lines[i], ',') == 9u);
+    TEST_CHECK(strncmp(sim.lines[i], "sdram,", 6) == 0);
+    TEST_CHECK(strcmp(strrchr(sim.lines[i], ','), ",0") == 0); /* errors */
+  }
+  TEST_CHECK(strcmp(sim.lines[9], "# sdram,broken,apply failed") == 0);
+  TEST_CHECK(strcmp(sim.lines[10], "sdram,best,cas2") == 0);
+}
+
+static void test_current_only(void *mem)
+{
+  static sim_port_t sim;
+  const ser_sdram_bench_port_t port = {
+      .now = host_now,
+      .hz = 1000000000u,
+      .emit = sim_emit,
+  };
+  TEST_CHECK(ser_sdram_bench_run(&port, &sim, mem, 64u * 1024u) == 0);
+  TEST_CHECK(sim.line_n == 3u);
+  TEST_CHECK(strncmp(sim.lines[1], "sdram,current,0,0,", 18) == 0);
+  TEST_CHECK(strcmp(sim.lines[2], "sdram,best,current") == 0);
+}
+
+static void test_format(void)
+{
+  const ser_sdram_bench_result_t r = {.seq_read_kbps = 95345u,
+                                      .seq_write_kbps = 120400u,
+                                      .copy_kbps = 61299u,
+                                      .rand_read_ns = 121u,
+                                      .rand_write_ns = 45u,
+                                      .errors = 3u};
+  char buf[SER_SDRAM_BENCH_LINE_MAX];
+  const int n = ser_sdram_bench_format(buf, sizeof(buf), "cas2", true, false,
+                                       &r);
+  TEST_CHECK(strcmp(buf, "sdram,cas2,1,0,95.3,120.4,61.2,121,45,3") == 0);
+  TEST_CHECK(n == (int)strlen(buf));
+
+  char small[12];
+  TEST_CHECK(ser_sdram_bench_format(small, sizeof(small), "cas2", true, false,
+                                    &r) == (int)strlen(small));
+  TEST_CHECK(strlen(small) == sizeof(small) - 1u);
+}
+
+int main(void)
+{
+  void *mem = malloc(REGION_BYTES);
+  TEST_CHECK(mem != NULL);
+  if (mem == NULL)
+  {
+    return test_done();
+  }
+
+  test_format();
+  test_measure(mem);
+  test_select(mem);
+  test_current_only(mem);
+
+  free(mem);
+  return test_done();
+}
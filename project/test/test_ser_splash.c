@@ -0,0 +1,97 @@
+/*
+ * services/ser_splash：提交的开机画面与 LVGL 第一帧逐像素相同
+ *
+ * 同一源文件按 LCD_FB_FORMAT 编两次：
+ * - RGB565：ser_splash_show 原地解码到帧缓冲
+ * - ARGB8888：逐行解码经 dev_lcd_flush_rgb565 转换
+ * 两者都先把帧缓冲填成别的颜色，再按 dev_lcd_read_rgb565 读回与主机 LVGL 渲染的
+ * 启动界面（ser_lvgl_ui_boot_create，与 splash_gen.py 相同）比对。
+ * 启动界面改动后没有重新生成 ser_splash_gen.c 时这里失败。
+ * 基准：ser_splash_show 的主机耗时
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "dev_lcd.h"
+#include "dev_lcd_panel.h"
+#include "fake_dri_lcd.h"
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_splash.h"
+#include "ser_splash_gen.h"
+
+#define MAX_W 1024u
+#define MAX_H 600u
+#define BENCH_REPS 20u
+
+static uint16_t s_ref[MAX_W * MAX_H];
+static uint16_t s_row[MAX_W];
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+/* 与 splash_host.c 相同：DIRECT 模式整帧渲染 */
+static void render_reference(uint32_t w, uint32_t h)
+{
+  static ser_lvgl_ui_boot_t ui;
+
+  lv_init();
+  lv_display_t *disp = lv_display_create((int32_t)w, (int32_t)h);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, s_ref, NULL, w * h * 2u,
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+  ser_lvgl_ui_boot_create(&ui);
+  lv_refr_now(disp);
+}
+
+int main(void)
+{
+  TEST_CHECK(dev_lcd_init() == HAL_OK);
+  const uint32_t w = dev_lcd_width();
+  const uint32_t h = dev_lcd_height();
+  TEST_CHECK(w == ser_splash_gen_w && h == ser_splash_gen_h);
+  TEST_CHECK(w <= MAX_W && h <= MAX_H);
+  if (w != ser_splash_gen_w || h != ser_splash_gen_h || w > MAX_W ||
+      h > MAX_H)
+  {
+    return test_done();
+  }
+
+  render_reference(w, h);
+  dev_lcd_fill_rgb565(0xF81Fu);
+  TEST_CHECK(ser_splash_show());
+
+  uint32_t bad_rows = 0;
+  for (uint32_t y = 0; y < h; y++)
+  {
+    TEST_CHECK(dev_lcd_read_rgb565(0, (int32_t)y, (int32_t)w - 1, s_row));
+    bad_rows += (memcmp(s_row, &s_ref[y * w], w * 2u) != 0) ? 1u : 0u;
+  }
+  if (bad_rows != 0u)
+  {
+    printf("splash differs from the LVGL boot screen in %u rows: "
+           "rerun project/tools/splash_gen.py\n",
+           (unsigned)bad_rows);
+  }
+  TEST_CHECK(bad_rows == 0u);
+
+  const uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < BENCH_REPS; i++)
+  {
+    (void)ser_splash_show();
+  }
+  printf("splash %ux%u: %u bytes, show %.0f us (host, %u bpp)\n",
+         (unsigned)w, (unsigned)h, (unsigned)ser_splash_gen_len,
+         (double)(test_now_ns() - t0) / BENCH_REPS / 1e3,
+         (unsigned)(dev_lcd_bytes_per_pixel() * 8u));
+  return test_done();
+}
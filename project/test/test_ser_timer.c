@@ -0,0 +1,291 @@
+/*
+ * services/ser_timer：分级时间轮本体（SER_TIMER_HOST=1 只编译这一部分）
+ *
+ * - 随机增删与推进（单 tick、小步、跨级、超出 SPAN 的远期定时器）：
+ *   每次推进到期的恰好是 (from, to] 内的定时器，按到期顺序输出，计数一致
+ * - ser_timer_wheel_next：不早于最近的到期/下沉点，推进到它之前不会漏出定时器
+ * - 已过期的 expires 放到 now + 1
+ * - 链表 push/pop/remove 与 tail 维护
+ * 基准：add/del、按 next 逐点推进、周期定时器稳态的主机耗时
+ */
+#include <stdio.h>
+
+#include "ser_timer.h"
+#include "test.h"
+
+#define N 20000u
+#define ROUNDS 3000u
+#define PERIODIC 1000u
+
+static ser_timer_t s_t[N];
+static uint64_t s_eff[N]; /* 实际到期 tick */
+static bool s_armed[N];
+static ser_timer_wheel_t s_w;
+
+static uint64_t rand_delay(void)
+{
+  /* 覆盖各级：< 64、< 4096、< 2^18、< 2^24，以及超过 SPAN 的 2^27 */
+  switch (test_rand_n(5u))
+  {
+  case 0:
+    return test_rand() % 64u;
+  case 1:
+    return test_rand() % 4096u;
+  case 2:
+    return test_rand() % (1u << 18);
+  case 3:
+    return test_rand() % (1u << 24);
+  default:
+    return test_rand() % (1ull << 27);
+  }
+}
+
+static void arm(uint32_t i)
+{
+  s_t[i].expires = s_w.now + rand_delay();
+  s_eff[i] = (s_t[i].expires > s_w.now) ? s_t[i].expires : s_w.now + 1u;
+  ser_timer_wheel_add(&s_w, &s_t[i]);
+  s_armed[i] = true;
+}
+
+static void check_advance(uint64_t to)
+{
+  ser_timer_list_t expired;
+  ser_timer_list_init(&expired);
+  const uint64_t from = s_w.now;
+  const uint32_t n = ser_timer_wheel_advance(&s_w, to, &expired);
+  TEST_CHECK(s_w.now == to);
+
+  uint32_t popped = 0;
+  uint64_t last = 0;
+  ser_timer_t *t;
+  while ((t = ser_timer_list_pop(&expired)) != NULL)
+  {
+    const uint32_t i = (uint32_t)(t - s_t);
+    TEST_CHECK(s_armed[i]);
+    TEST_CHECK(s_eff[i] > from && s_eff[i] <= to);
+    TEST_CHECK(s_eff[i] >= last);
+    last = s_eff[i];
+    s_armed[i] = false;
+    popped++;
+  }
+  TEST_CHECK(popped == n);
+  TEST_CHECK(expired.head == NULL && expired.tail == &expired.head);
+
+  uint32_t late = 0;
+  for (uint32_t i = 0; i < N; i++)
+  {
+    late += (s_armed[i] && s_eff[i] <= to) ? 1u : 0u;
+  }
+  TEST_CHECK(late == 0u);
+}
+
+static uint64_t earliest_armed(void)
+{
+  uint64_t e = UINT64_MAX;
+  for (uint32_t i = 0; i < N; i++)
+  {
+    if (s_armed[i] && s_eff[i] < e)
+    {
+      e = s_eff[i];
+    }
+  }
+  return e;
+}
+
+static void test_random(void)
+{
+  /* 起点不对齐任何一级的槽边界 */
+  ser_timer_wheel_init(&s_w, 1234567u);
+  for (uint32_t i = 0; i < N; i++)
+  {
+    arm(i);
+  }
+
+  for (uint32_t round = 0; round < ROUNDS; round++)
+  {
+    for (uint32_t k = 0; k < 50u; k++)
+    {
+      const uint32_t i = test_rand_n(N);
+      if (s_armed[i])
+      {
+        ser_timer_wheel_del(&s_w, &s_t[i]);
+        s_armed[i] = false;
+      }
+      else
+      {
+        arm(i);
+      }
+    }
+
+    const uint64_t next = ser_timer_wheel_next(&s_w);
+    TEST_CHECK(next > s_w.now && next <= earliest_armed());
+
+    switch (round % 5u)
+    {
+    case 0:
+      /* 逐 tick */
+      for (uint32_t s = 0; s < 100u; s++)
+      {
+        check_advance(s_w.now + 1u);
+      }
+      break;
+    case 1:
+      /* 推进到 next 的前一刻不应有定时器到期，再推进到 next */
+      check_advance(next - 1u);
+      check_advance(next);
+      break;
+    case 2:
+      check_advance(s_w.now + test_rand_n(64u));
+      break;
+    case 3:
+      check_advance(s_w.now + test_rand_n(5000u));
+      break;
+    default:
+      check_advance(s_w.now + test_rand_n(1u << 20));
+      break;
+    }
+
+    uint32_t armed = 0;
+    for (uint32_t i = 0; i < N; i++)
+    {
+      armed += s_armed[i] ? 1u : 0u;
+    }
+    TEST_CHECK(armed == s_w.count);
+  }
+
+  /* 推进到全部到期 */
+  check_advance(s_w.now + (1ull << 28));
+  TEST_CHECK(s_w.count == 0u);
+  TEST_CHECK(ser_timer_wheel_next(&s_w) == UINT64_MAX);
+}
+
+static void test_past_expiry(void)
+{
+  ser_timer_wheel_init(&s_w, 1000u);
+  s_t[0].expires = 10u;
+  s_t[1].expires = 1000u;
+  ser_timer_wheel_add(&s_w, &s_t[0]);
+  ser_timer_wheel_add(&s_w, &s_t[1]);
+  TEST_CHECK(ser_timer_wheel_next(&s_w) == 1001u);
+
+  ser_timer_list_t expired;
+  ser_timer_list_init(&expired);
+  TEST_CHECK(ser_timer_wheel_advance(&s_w, 1001u, &expired) == 2u);
+  TEST_CHECK(s_w.count == 0u);
+}
+
+static void test_list(void)
+{
+  ser_timer_list_t l;
+  ser_timer_list_init(&l);
+  TEST_CHECK(ser_timer_list_pop(&l) == NULL);
+  for (uint32_t i = 0; i < 4u; i++)
+  {
+    ser_timer_list_push(&l, &s_t[i]);
+  }
+
+  /* 删中间、删尾，之后 push 仍接在尾部 */
+  ser_timer_list_remove(&l, &s_t[1]);
+  ser_timer_list_remove(&l, &s_t[3]);
+  ser_timer_list_push(&l, &s_t[4]);
+  TEST_CHECK(ser_timer_list_pop(&l) == &s_t[0]);
+  TEST_CHECK(ser_timer_list_pop(&l) == &s_t[2]);
+  TEST_CHECK(ser_timer_list_pop(&l) == &s_t[4]);
+  TEST_CHECK(ser_timer_list_pop(&l) == NULL);
+  TEST_CHECK(l.tail == &l.head);
+
+  /* 删唯一节点 */
+  ser_timer_list_push(&l, &s_t[5]);
+  ser_timer_list_remove(&l, &s_t[5]);
+  TEST_CHECK(l.head == NULL && l.tail == &l.head);
+}
+
+static void bench(void)
+{
+  ser_timer_wheel_init(&s_w, 0u);
+  uint64_t t0 = test_now_ns();
+  for (uint32_t i = 0; i < N; i++)
+  {
+    s_t[i].expires = s_w.now + 1u + test_rand_n(1u << 20);
+    ser_timer_wheel_add(&s_w, &s_t[i]);
+  }
+  uint64_t t1 = test_now_ns();
+  for (uint32_t i = 0; i < N; i++)
+  {
+    ser_timer_wheel_del(&s_w, &s_t[i]);
+  }
+  uint64_t t2 = test_now_ns();
+  printf("add %.1f ns, del %.1f ns (%u timers, host)\n",
+         (double)(t1 - t0) / N, (double)(t2 - t1) / N, (unsigned)N);
+
+  /* 按 next 逐点推进直到清空：每次唤醒的开销 */
+  for (uint32_t i = 0; i < N; i++)
+  {
+    s_t[i].expires = s_w.now + 1u + test_rand_n(1u << 20);
+    ser_timer_wheel_add(&s_w, &s_t[i]);
+  }
+  ser_timer_list_t expired;
+  uint32_t fired = 0;
+  uint32_t wakeups = 0;
+  t0 = test_now_ns();
+  while (s_w.count != 0u)
+  {
+    ser_timer_list_init(&expired);
+    fired += ser_timer_wheel_advance(&s_w, ser_timer_wheel_next(&s_w),
+                                     &expired);
+    wakeups++;
+  }
+  t1 = test_now_ns();
+  TEST_CHECK(fired == N);
+  printf("drain: %u timers, %u wakeups, %.1f ns/wakeup (host)\n",
+         (unsigned)fired, (unsigned)wakeups, (double)(t1 - t0) / wakeups);
+
+  /* 周期定时器稳态：1000 个 1..1400 tick 周期，到期后按周期重新插入 */
+  static uint32_t period[PERIODIC];
+  ser_timer_wheel_init(&s_w, 0u);
+  for (uint32_t i = 0; i < PERIODIC; i++)
+  {
+    period[i] = 1u + test_rand_n(1400u);
+    s_t[i].expires = period[i];
+    ser_timer_wheel_add(&s_w, &s_t[i]);
+  }
+  const uint64_t end = 110000u;
+  uint64_t fires = 0;
+  uint64_t late = 0;
+  t0 = test_now_ns();
+  for (;;)
+  {
+    const uint64_t next = ser_timer_wheel_next(&s_w);
+    if (next > end)
+    {
+      break;
+    }
+    ser_timer_list_init(&expired);
+    (void)ser_timer_wheel_advance(&s_w, next, &expired);
+    ser_timer_t *t;
+    while ((t = ser_timer_list_pop(&expired)) != NULL)
+    {
+      late += (t->expires != s_w.now) ? 1u : 0u;
+      fires++;
+      t->expires += period[t - s_t];
+      ser_timer_wheel_add(&s_w, t);
+    }
+  }
+  t1 = test_now_ns();
+  TEST_CHECK(late == 0u);
+  printf("periodic: %u timers, %llu fires over %llu ticks, %.1f ns/fire "
+         "incl. re-add (host)\n",
+         (unsigned)PERIODIC, (unsigned long long)fires,
+         (unsigned long long)end, (double)(t1 - t0) / (double)fires);
+}
+
+int main(void)
+{
+  test_seed(44u);
+  test_random();
+  test_past_expiry();
+  test_list();
+  bench();
+  return test_done();
+}
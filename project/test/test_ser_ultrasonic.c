@@ -0,0 +1,280 @@
+/*
+ * services/ser_ultrasonic：周期发布（ser_bus 主机版 + 定时器/测距替身）
+ *
+ * 定时器替身按排程逐周期调用周期回调与各路 TRIG 回调，ECHO 读数由测试给出：
+ * - 没有干扰方的路（默认单路表）：以 0.25..2.5 m/s 往返移动的目标，
+ *   每个读数在下一周期原样发布到 ranges / distance / subject，不出现 -1；
+ *   无回波、超量程发布 -1，恢复后立即有效
+ * - 有干扰方的路（两路同扇区的表，test_ser_ultrasonic_pair）：仍过串扰门限，
+ *   连续 AGREE 次一致才输出，单次串扰读数被拒绝并计入 rejected
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "dev_ultrasonic.h"
+#include "dri_time_us.h"
+#include "ser_bus.h"
+#include "ser_timer.h"
+#include "ser_ultrasonic.h"
+
+#define CH_MAX 8u
+#define TIMERS_MAX 16u
+
+static ser_timer_t *s_timers[TIMERS_MAX];
+static uint32_t s_timer_n;
+static ser_timer_t *s_cycle_timer;
+static uint32_t s_cycle_us;
+
+static int32_t s_echo[CH_MAX]; /* 本周期 ECHO 测得的距离，-1 为无回波 */
+static bool s_triggered[CH_MAX];
+static int32_t s_subject_value;
+static uint32_t s_subject_publishes;
+static uint32_t s_cyc;
+
+/* ---- 替身 ---- */
+
+bool dev_ultrasonic_init(void)
+{
+  return true;
+}
+
+uint8_t dev_ultrasonic_count(void)
+{
+  return CH_MAX;
+}
+
+bool dev_ultrasonic_trigger(uint8_t ch)
+{
+  s_triggered[ch] = true;
+  return true;
+}
+
+bool dev_ultrasonic_result_mm(uint8_t ch, uint32_t *mm)
+{
+  if (!s_triggered[ch] || s_echo[ch] < 0)
+  {
+    return false;
+  }
+  *mm = (uint32_t)s_echo[ch];
+  return true;
+}
+
+void ser_timer_setup(ser_timer_t *t, ser_timer_ctx_t ctx, ser_timer_cb_t cb,
+                     void *arg)
+{
+  memset(t, 0, sizeof(*t));
+  t->cb = cb;
+  t->arg = arg;
+  t->ctx = (uint8_t)ctx;
+  if (s_timer_n < TIMERS_MAX)
+  {
+    s_timers[s_timer_n++] = t;
+  }
+}
+
+bool ser_timer_start_us(ser_timer_t *t, uint32_t delay_us, uint32_t period_us)
+{
+  t->expires = delay_us;
+  t->period = period_us;
+  t->state = SER_TIMER_ARMED;
+  if (period_us != 0u)
+  {
+    s_cycle_timer = t;
+    s_cycle_us = period_us;
+  }
+  return true;
+}
+
+void ser_lvgl_subject_init(ser_lvgl_subject_t *subject, int32_t initial)
+{
+  (void)subject;
+  s_subject_value = initial;
+}
+
+void ser_lvgl_subject_publish(ser_lvgl_subject_t *subject, int32_t value)
+{
+  (void)subject;
+  s_subject_value = value;
+  s_subject_publishes++;
+}
+
+uint32_t dri_time_cycles_now(void)
+{
+  return s_cyc;
+}
+
+static uint32_t sim_now(void)
+{
+  return s_cyc;
+}
+
+static uint64_t sim_now64(void)
+{
+  return s_cyc;
+}
+
+static void sim_notify(void *task, uint32_t bits, bool from_isr)
+{
+  (void)task;
+  (void)bits;
+  (void)from_isr;
+}
+
+static const ser_bus_port_t s_port = {
+    .now = sim_now,
+    .now64 = sim_now64,
+    .hz = 168000000u,
+    .notify = sim_notify,
+};
+
+/*
+ * 跑一个周期：周期回调（发布上一周期）-> 各路 TRIG -> 本周期的 ECHO 读数
+ * echo 为 NULL 时各路无回波
+ */
+static void run_cycle(const int32_t *echo, uint32_t n)
+{
+  s_cyc += s_cycle_us * 168u;
+  s_cycle_timer->cb(s_cycle_timer->arg);
+  memset(s_triggered, 0, sizeof(s_triggered));
+  for (uint32_t i = 0; i < s_timer_n; i++)
+  {
+    ser_timer_t *t = s_timers[i];
+    if (t != s_cycle_timer && t->state == SER_TIMER_ARMED)
+    {
+      t->state = SER_TIMER_IDLE;
+      t->cb(t->arg);
+    }
+  }
+  for (uint32_t ch = 0; ch < CH_MAX; ch++)
+  {
+    s_echo[ch] = (echo != NULL && ch < n) ? echo[ch] : -1;
+  }
+}
+
+/* 按周期数往返：speed_mm_s 的目标在 300..5000mm 之间来回 */
+static int32_t target_mm(uint32_t k, uint32_t speed_mm_s)
+{
+  const uint32_t lo = 300u;
+  const uint32_t span = 4700u;
+  uint32_t d = (uint32_t)(((uint64_t)k * s_cycle_us * speed_mm_s / 1000000u) %
+                          (2u * span));
+  return (int32_t)(lo + (d < span ? d : 2u * span - d));
+}
+
+/* 单路（无干扰方）：快速移动的目标每周期都有读数，且不滞后 */
+static void test_solo(const ser_ultrasonic_plan_t *plan)
+{
+  static const uint32_t speeds[] = {250u, 1000u, 1500u, 2500u};
+  ser_bus_ranges_t r;
+  ser_bus_distance_t d;
+
+  for (uint32_t si = 0; si < sizeof(speeds) / sizeof(speeds[0]); si++)
+  {
+    uint32_t invalid = 0;
+    uint32_t lagged = 0;
+    int32_t prev = -1;
+    for (uint32_t k = 0; k < 400u; k++)
+    {
+      const int32_t mm = target_mm(k, speeds[si]);
+      run_cycle(&mm, 1u);
+      if (prev >= 0)
+      {
+        TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_ranges, &r));
+        TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_distance, &d));
+        invalid += (d.mm < 0 || (r.valid & 1u) == 0u) ? 1u : 0u;
+        lagged += (d.mm >= 0 && d.mm != prev) ? 1u : 0u;
+        TEST_CHECK(r.mm[0] == d.mm && s_subject_value == d.mm);
+      }
+      prev = mm;
+    }
+    TEST_CHECK(invalid == 0u);
+    TEST_CHECK(lagged == 0u);
+    printf("solo %4u mm/s (%u mm/cycle): invalid %u, lagged %u\n",
+           (unsigned)speeds[si],
+           (unsigned)(speeds[si] * plan->cycle_us / 1000000u),
+           (unsigned)invalid, (unsigned)lagged);
+  }
+
+  /* 无回波、超量程：-1；恢复后下一次发布立即有效 */
+  const int32_t far = 5601;
+  const int32_t back = 1234;
+  run_cycle(NULL, 0u);
+  run_cycle(&far, 1u);
+  TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_distance, &d) && d.mm == -1);
+  run_cycle(&back, 1u);
+  TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_distance, &d) && d.mm == -1);
+  run_cycle(&back, 1u);
+  TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_distance, &d) && d.mm == back);
+  uint32_t mm = 0;
+  TEST_CHECK(ser_ultrasonic_get_latest_mm(&mm) && mm == (uint32_t)back);
+}
+
+/* 有干扰方：连续一致才输出，单次串扰读数被拒绝 */
+static void test_gated(const ser_ultrasonic_plan_t *plan)
+{
+  ser_bus_ranges_t r;
+  int32_t echo[CH_MAX];
+  const uint32_t n = plan->n;
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    echo[i] = 1500 + (int32_t)i * 200;
+  }
+  /* 第 k 个周期的读数在第 k+1 个周期发布 */
+  for (uint32_t k = 0; k < SER_ULTRASONIC_GATE_AGREE; k++)
+  {
+    run_cycle(echo, n);
+    if (k != 0u)
+    {
+      TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_ranges, &r) && r.valid == 0u);
+    }
+  }
+  run_cycle(echo, n);
+  TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_ranges, &r));
+  TEST_CHECK(r.valid == (uint8_t)((1u << n) - 1u));
+  TEST_CHECK(r.mm[1] == echo[1]);
+
+  /* 第 1 路收到一次别人的声波 */
+  const int32_t real = echo[1];
+  echo[1] = 400;
+  run_cycle(echo, n);
+  echo[1] = real;
+  run_cycle(echo, n);
+  TEST_CHECK(ser_bus_read(SER_BUS_TOPIC_ranges, &r));
+  TEST_CHECK((r.valid & 2u) == 0u && (r.rejected & 2u) != 0u);
+  TEST_CHECK((r.valid & 1u) != 0u && r.mm[0] == echo[0]);
+}
+
+int main(void)
+{
+  TEST_CHECK(ser_bus_init(&s_port));
+  TEST_CHECK(ser_ultrasonic_init());
+  TEST_CHECK(s_cycle_timer != NULL);
+
+  ser_ultrasonic_plan_t plan;
+  TEST_CHECK(ser_ultrasonic_get_plan(&plan));
+  TEST_CHECK(plan.cycle_us == s_cycle_us);
+
+  uint32_t solo = 0;
+  for (uint32_t i = 0; i < plan.n; i++)
+  {
+    solo += (plan.conflict[i] == 0u) ? 1u : 0u;
+  }
+  printf("%u sensor(s), %u without interferer, cycle %u us\n",
+         (unsigned)plan.n, (unsigned)solo, (unsigned)plan.cycle_us);
+
+  if (solo == plan.n)
+  {
+    test_solo(&plan);
+  }
+  else
+  {
+    test_gated(&plan);
+  }
+  TEST_CHECK(s_subject_publishes > 0u);
+  return test_done();
+}
@@ -0,0 +1,476 @@
+/*
+ * services/ser_ultrasonic_plan：多路超声波排程与串扰门限
+ *
+ * - 干扰判定：对称、扇区环形回绕、不同频率组互不干扰
+ * - 随机场景（1..8 路、随机扇区/频率组/窗口/配置）：
+ *   - 互相干扰的两路占用区间在周期内与跨周期都不重叠
+ *   - 每路回波窗口在周期内结束，周期不小于最小触发间隔
+ *   - 压缩后周期 <= 时隙划分 <= 全部轮流
+ *   - 时隙划分总长与穷举全部划分的最优值相同（n <= 6）
+ * - 全部独立时同时发射，全部干扰时退化为轮流
+ * - 门限：连续 AGREE 次相差不超过 tol 才输出，无回波/超量程使历史失效
+ * 模拟：8 路环形布置（相邻互听 + 模型外的两对反射），ECHO 取上升沿后听到的第一个声波；
+ * 对比轮流、压缩排程、同时发射三种方式的原始采样率与门限后的误读率
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ser_ultrasonic_plan.h"
+#include "test.h"
+
+#define RANDOM_PLANS 3000u
+#define BRUTE_MAX_N 6u
+
+static bool overlap(uint32_t a, uint32_t alen, uint32_t b, uint32_t blen)
+{
+  return a < b + blen && b < a + alen;
+}
+
+static void test_conflicts(void)
+{
+  ser_ultrasonic_sensor_t a = {.sector = 0, .group = 0};
+  ser_ultrasonic_sensor_t b = {.sector = SER_ULTRASONIC_SECTORS - 1u};
+
+  /* 0 与 N-1 相邻（环形） */
+  TEST_CHECK(ser_ultrasonic_plan_conflicts(&a, &b, 1u));
+  TEST_CHECK(ser_ultrasonic_plan_conflicts(&b, &a, 1u));
+  TEST_CHECK(!ser_ultrasonic_plan_conflicts(&a, &b, 0u));
+
+  b.sector = SER_ULTRASONIC_SECTORS / 2u;
+  TEST_CHECK(!ser_ultrasonic_plan_conflicts(&a, &b, 1u));
+  TEST_CHECK(ser_ultrasonic_plan_conflicts(&a, &b,
+                                           SER_ULTRASONIC_SECTORS / 2u));
+
+  /* 同扇区不同频率组 */
+  b.sector = 0;
+  b.group = 1;
+  TEST_CHECK(!ser_ultrasonic_plan_conflicts(&a, &b, 4u));
+}
+
+/* 穷举：按编号顺序把每路放进已有时隙或新开一个，返回最小总长 */
+static uint32_t brute_best(const ser_ultrasonic_plan_t *p, const uint32_t *len,
+                           uint32_t i, uint8_t *slot_of, uint32_t slots)
+{
+  if (i == p->n)
+  {
+    uint32_t total = 0;
+    for (uint32_t s = 0; s < slots; s++)
+    {
+      uint32_t span = 0;
+      for (uint32_t k = 0; k < p->n; k++)
+      {
+        if (slot_of[k] == s && len[k] > span)
+        {
+          span = len[k];
+        }
+      }
+      total += span;
+    }
+    return total;
+  }
+
+  uint32_t best = UINT32_MAX;
+  for (uint32_t s = 0; s <= slots; s++)
+  {
+    bool ok = true;
+    for (uint32_t k = 0; k < i && ok; k++)
+    {
+      ok = !(slot_of[k] == s && (p->conflict[i] & (1u << k)) != 0u);
+    }
+    if (!ok)
+    {
+      continue;
+    }
+    slot_of[i] = (uint8_t)s;
+    uint32_t v = brute_best(p, len, i + 1u, slot_of, (s == slots) ? slots + 1u
+                                                                  : slots);
+    best = (v < best) ? v : best;
+  }
+  return best;
+}
+
+static void check_plan(const ser_ultrasonic_sensor_t *s, uint32_t n,
+                       const ser_ultrasonic_plan_cfg_t *cfg,
+                       const ser_ultrasonic_plan_t *p)
+{
+  uint32_t len[SER_ULTRASONIC_PLAN_MAX];
+  for (uint32_t i = 0; i < n; i++)
+  {
+    len[i] = cfg->dither_us + s[i].window_us + cfg->guard_us;
+  }
+
+  const uint32_t c = p->cycle_us;
+  TEST_CHECK(p->n == n && p->slots >= 1u && p->slots <= n);
+  TEST_CHECK(c >= cfg->min_cycle_us);
+  TEST_CHECK(c <= p->slotted_us && p->slotted_us <= p->serial_us);
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    TEST_CHECK(c >= len[i]);
+    TEST_CHECK(p->offset_us[i] + cfg->dither_us + s[i].window_us <= c);
+    for (uint32_t j = 0; j < n; j++)
+    {
+      const bool conf =
+          (i != j) && ser_ultrasonic_plan_conflicts(&s[i], &s[j], cfg->spread);
+      TEST_CHECK(((p->conflict[i] >> j) & 1u) == (conf ? 1u : 0u));
+      if (!conf)
+      {
+        continue;
+      }
+      /* 本周期与下一周期 */
+      TEST_CHECK(!overlap(p->offset_us[i], len[i], p->offset_us[j], len[j]));
+      TEST_CHECK(
+          !overlap(p->offset_us[i] + c, len[i], p->offset_us[j], len[j]));
+    }
+  }
+
+  if (n <= BRUTE_MAX_N)
+  {
+    uint8_t slot_of[SER_ULTRASONIC_PLAN_MAX];
+    uint32_t best = brute_best(p, len, 0u, slot_of, 0u);
+    if (best < cfg->min_cycle_us)
+    {
+      best = cfg->min_cycle_us;
+    }
+    TEST_CHECK(p->slotted_us == best);
+  }
+}
+
+static void test_random_plans(void)
+{
+  static ser_ultrasonic_plan_t plan;
+  ser_ultrasonic_sensor_t s[SER_ULTRASONIC_PLAN_MAX];
+
+  for (uint32_t round = 0; round < RANDOM_PLANS; round++)
+  {
+    const uint32_t n = 1u + test_rand_n(SER_ULTRASONIC_PLAN_MAX);
+    const ser_ultrasonic_plan_cfg_t cfg = {
+        .dither_us = test_rand_n(4000u),
+        .guard_us = test_rand_n(8000u),
+        .min_cycle_us = test_rand_n(60000u),
+        .spread = (uint8_t)test_rand_n(3u),
+    };
+    for (uint32_t i = 0; i < n; i++)
+    {
+      s[i].window_us = 500u + test_rand_n(23000u);
+      s[i].sector = (uint8_t)test_rand_n(SER_ULTRASONIC_SECTORS);
+      s[i].group = (uint8_t)test_rand_n(2u);
+    }
+    TEST_CHECK(ser_ultrasonic_plan_build(s, n, &cfg, &plan));
+    check_plan(s, n, &cfg, &plan);
+  }
+}
+
+static void test_extremes(void)
+{
+  static ser_ultrasonic_plan_t plan;
+  ser_ultrasonic_sensor_t s[SER_ULTRASONIC_PLAN_MAX];
+  const ser_ultrasonic_plan_cfg_t cfg = {
+      .dither_us = 1000u,
+      .guard_us = 2000u,
+      .min_cycle_us = 0u,
+      .spread = 0u,
+  };
+
+  /* 各占一个扇区：同时发射 */
+  for (uint32_t i = 0; i < SER_ULTRASONIC_PLAN_MAX; i++)
+  {
+    s[i] = (ser_ultrasonic_sensor_t){.window_us = 1000u * (i + 1u),
+                                     .sector = (uint8_t)i};
+  }
+  TEST_CHECK(ser_ultrasonic_plan_build(s, SER_ULTRASONIC_PLAN_MAX, &cfg,
+                                       &plan));
+  TEST_CHECK(plan.slots == 1u);
+  for (uint32_t i = 0; i < SER_ULTRASONIC_PLAN_MAX; i++)
+  {
+    TEST_CHECK(plan.offset_us[i] == 0u);
+  }
+  TEST_CHECK(plan.cycle_us == 1000u + 8000u + 2000u);
+
+  /* 同一扇区：轮流 */
+  for (uint32_t i = 0; i < SER_ULTRASONIC_PLAN_MAX; i++)
+  {
+    s[i].sector = 3u;
+  }
+  TEST_CHECK(ser_ultrasonic_plan_build(s, SER_ULTRASONIC_PLAN_MAX, &cfg,
+                                       &plan));
+  TEST_CHECK(plan.slots == SER_ULTRASONIC_PLAN_MAX);
+  TEST_CHECK(plan.cycle_us == plan.serial_us);
+
+  TEST_CHECK(!ser_ultrasonic_plan_build(s, 0u, &cfg, &plan));
+  TEST_CHECK(!ser_ultrasonic_plan_build(s, SER_ULTRASONIC_PLAN_MAX + 1u, &cfg,
+                                        &plan));
+  TEST_CHECK(!ser_ultrasonic_plan_build(NULL, 1u, &cfg, &plan));
+}
+
+static void test_gate(void)
+{
+  ser_ultrasonic_gate_t g;
+  ser_ultrasonic_gate_init(&g);
+
+  /* 前 AGREE-1 次历史不足 */
+  for (uint32_t i = 0; i + 1u < SER_ULTRASONIC_GATE_AGREE; i++)
+  {
+    TEST_CHECK(!ser_ultrasonic_gate(&g, 1000 + (int32_t)i, 4000, 40u));
+  }
+  TEST_CHECK(ser_ultrasonic_gate(&g, 1010, 4000, 40u));
+  TEST_CHECK(ser_ultrasonic_gate(&g, 1040, 4000, 40u));
+
+  /* 跳变：直到新值连续 AGREE 次才接受 */
+  TEST_CHECK(!ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+  TEST_CHECK(!ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+  TEST_CHECK(ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+
+  /* 超量程视为无回波，之后重新积累 */
+  TEST_CHECK(!ser_ultrasonic_gate(&g, 4001, 4000, 40u));
+  TEST_CHECK(!ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+  TEST_CHECK(!ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+  TEST_CHECK(ser_ultrasonic_gate(&g, 2000, 4000, 40u));
+
+  /* 无回波本身不计入 rejected */
+  const uint32_t rej = g.rejected;
+  TEST_CHECK(!ser_ultrasonic_gate(&g, -1, 4000, 40u));
+  TEST_CHECK(g.rejected == rej);
+  TEST_CHECK(rej == 6u);
+}
+
+/* ---- 串扰模拟 ---- */
+
+#define SIM_N 8u
+#define SIM_CYCLES 3000u
+#define SIM_RISE_US 500.0
+#define SIM_TIMEOUT_US 38000.0
+#define SIM_US_PER_MM 2.915 /* 单程 */
+#define SIM_TOL_MM 40u
+#define SIM_WRONG_MM 30.0
+
+typedef enum
+{
+  SIM_SERIAL,
+  SIM_COMPACT,
+  SIM_NAIVE, /* 全部同时发射 */
+} sim_mode_t;
+
+typedef struct
+{
+  ser_ultrasonic_sensor_t s[SIM_N];
+  bool hear[SIM_N][SIM_N];
+  double path_mm[SIM_N][SIM_N];
+  double dist_mm[SIM_N];
+} sim_scene_t;
+
+typedef struct
+{
+  double cycle_ms;
+  double raw_per_s;
+  double out_per_s;
+  double false_accept; /* 门限后输出中的误读比例 */
+} sim_result_t;
+
+static double sim_rand01(void)
+{
+  return (double)(test_rand() & 0xFFFFFFu) / 16777216.0;
+}
+
+static void sim_scene(sim_scene_t *sc)
+{
+  static const double range_mm[SIM_N] = {4000, 1500, 4000, 1500,
+                                         4000, 1500, 4000, 1500};
+  memset(sc, 0, sizeof(*sc));
+  for (uint32_t i = 0; i < SIM_N; i++)
+  {
+    sc->s[i].sector = (uint8_t)i;
+    sc->s[i].window_us = (uint32_t)(SIM_RISE_US + range_mm[i] * 5.8);
+    sc->dist_mm[i] = 300.0 + i * 350.0;
+  }
+  /* 模型内：相邻扇区互听 */
+  for (uint32_t i = 0; i < SIM_N; i++)
+  {
+    for (uint32_t j = 0; j < SIM_N; j++)
+    {
+      uint32_t d = (i > j) ? i - j : j - i;
+      d = (d > SIM_N / 2u) ? SIM_N - d : d;
+      if (d == 1u)
+      {
+        sc->hear[i][j] = true;
+        sc->path_mm[i][j] =
+            200.0 + fmin(sc->dist_mm[i], sc->dist_mm[j]);
+      }
+    }
+  }
+  /* 模型外：0<->4、2<->6 经墙面反射互听 */
+  static const uint32_t refl[2][2] = {{0, 4}, {2, 6}};
+  for (uint32_t q = 0; q < 2u; q++)
+  {
+    const uint32_t a = refl[q][0];
+    const uint32_t b = refl[q][1];
+    sc->hear[a][b] = sc->hear[b][a] = true;
+    sc->path_mm[a][b] = sc->path_mm[b][a] = 1800.0;
+  }
+}
+
+static sim_result_t sim_run(sim_scene_t *sc,
+                            const ser_ultrasonic_plan_cfg_t *cfg,
+                            sim_mode_t mode)
+{
+  static ser_ultrasonic_plan_t plan;
+  static double rise[SIM_CYCLES + 1u][SIM_N];
+  TEST_CHECK(ser_ultrasonic_plan_build(sc->s, SIM_N, cfg, &plan));
+
+  uint32_t off[SIM_N];
+  double c;
+  if (mode == SIM_COMPACT)
+  {
+    memcpy(off, plan.offset_us, sizeof(off));
+    c = plan.cycle_us;
+  }
+  else if (mode == SIM_SERIAL)
+  {
+    uint32_t t = 0;
+    for (uint32_t i = 0; i < SIM_N; i++)
+    {
+      off[i] = t;
+      t += cfg->dither_us + sc->s[i].window_us + cfg->guard_us;
+    }
+    c = plan.serial_us;
+  }
+  else
+  {
+    uint32_t m = cfg->min_cycle_us;
+    for (uint32_t i = 0; i < SIM_N; i++)
+    {
+      const uint32_t len = cfg->dither_us + sc->s[i].window_us + cfg->guard_us;
+      off[i] = 0;
+      m = (len > m) ? len : m;
+    }
+    c = m;
+  }
+
+  for (uint32_t k = 0; k <= SIM_CYCLES; k++)
+  {
+    for (uint32_t i = 0; i < SIM_N; i++)
+    {
+      rise[k][i] = k * c + off[i] + test_rand_n(cfg->dither_us + 1u) +
+                   SIM_RISE_US;
+    }
+  }
+
+  ser_ultrasonic_gate_t g[SIM_N];
+  for (uint32_t i = 0; i < SIM_N; i++)
+  {
+    ser_ultrasonic_gate_init(&g[i]);
+  }
+
+  uint32_t raw = 0;
+  uint32_t out = 0;
+  uint32_t wrong = 0;
+  for (uint32_t k = 1; k < SIM_CYCLES; k++)
+  {
+    for (uint32_t i = 0; i < SIM_N; i++)
+    {
+      /* ECHO 在听到的第一个声波处结束：自己的回波、别人上/本/下一周期的发射、
+       * 自己上一周期的三倍程多径 */
+      const double r = rise[k][i];
+      const double d = sc->dist_mm[i] + (sim_rand01() - 0.5) * 6.0;
+      double fall = fmin(r + SIM_TIMEOUT_US, r + d * 2.0 * SIM_US_PER_MM);
+      for (uint32_t kk = k - 1u; kk <= k + 1u; kk++)
+      {
+        for (uint32_t j = 0; j < SIM_N; j++)
+        {
+          if (sc->hear[i][j])
+          {
+            const double t = rise[kk][j] + sc->path_mm[i][j] * SIM_US_PER_MM;
+            fall = (t > r && t < fall) ? t : fall;
+          }
+        }
+      }
+      const double mp = rise[k - 1u][i] + 3.0 * sc->dist_mm[i] * 2.0 *
+                                              SIM_US_PER_MM;
+      fall = (mp > r && mp < fall) ? mp : fall;
+
+      /* 下一周期开始时收集 */
+      int32_t mm = -1;
+      if (fall <= (k + 1u) * c && fall < r + SIM_TIMEOUT_US)
+      {
+        mm = (int32_t)(((fall - r) * 10.0 + 29.0) / 58.0);
+        raw++;
+      }
+      const int32_t max_mm =
+          (int32_t)((sc->s[i].window_us - SIM_RISE_US) * 10.0 / 58.0);
+      if (ser_ultrasonic_gate(&g[i], mm, max_mm, SIM_TOL_MM))
+      {
+        out++;
+        wrong += (fabs(mm - sc->dist_mm[i]) > SIM_WRONG_MM) ? 1u : 0u;
+      }
+    }
+    for (uint32_t i = 0; i < SIM_N; i++)
+    {
+      sc->dist_mm[i] += (sim_rand01() - 0.5) * 4.0;
+    }
+  }
+
+  const double secs = (SIM_CYCLES - 1u) * c / 1e6;
+  return (sim_result_t){
+      .cycle_ms = c / 1000.0,
+      .raw_per_s = raw / secs,
+      .out_per_s = out / secs,
+      .false_accept = (out != 0u) ? (double)wrong / out : 0.0,
+  };
+}
+
+static void sim_report(const char *name, const sim_result_t *r)
+{
+  printf("%-8s cycle %5.1f ms, raw %5.1f/s, out %5.1f/s, "
+         "false accept %5.2f%% (sim)\n",
+         name, r->cycle_ms, r->raw_per_s, r->out_per_s,
+         100.0 * r->false_accept);
+}
+
+static void test_sim(void)
+{
+  static sim_scene_t scene;
+  static sim_scene_t sc;
+  const ser_ultrasonic_plan_cfg_t cfg = {
+      .dither_us = 3000u,
+      .guard_us = 6000u,
+      .min_cycle_us = 40000u,
+      .spread = 1u,
+  };
+  sim_scene(&scene);
+
+  sc = scene;
+  const sim_result_t serial = sim_run(&sc, &cfg, SIM_SERIAL);
+  sc = scene;
+  const sim_result_t compact = sim_run(&sc, &cfg, SIM_COMPACT);
+  sc = scene;
+  const sim_result_t naive = sim_run(&sc, &cfg, SIM_NAIVE);
+  sim_report("serial", &serial);
+  sim_report("compact", &compact);
+  sim_report("naive", &naive);
+
+  /* 压缩排程至少是轮流的三倍采样率，门限后误读仍在 2% 以内；同时发射不可用 */
+  TEST_CHECK(compact.raw_per_s > 3.0 * serial.raw_per_s);
+  TEST_CHECK(compact.false_accept < 0.02);
+  TEST_CHECK(naive.false_accept > 0.2);
+
+  /* 不加抖动时门限识别不了反射串扰 */
+  ser_ultrasonic_plan_cfg_t no_dither = cfg;
+  no_dither.dither_us = 0u;
+  sc = scene;
+  const sim_result_t fixed = sim_run(&sc, &no_dither, SIM_COMPACT);
+  sim_report("no-dith", &fixed);
+  TEST_CHECK(fixed.false_accept > 10.0 * compact.false_accept);
+}
+
+int main(void)
+{
+  test_seed(45u);
+  test_conflicts();
+  test_random_plans();
+  test_extremes();
+  test_gate();
+  test_sim();
+  return test_done();
+}
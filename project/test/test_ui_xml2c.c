@@ -0,0 +1,575 @@
+/*
+ * project/tools/ui_xml2c.py：生成代码与解释执行的 XML 渲染结果逐像素相同
+ *
+ * - 生成侧：编译进来的 ser_lvgl_gen_boot.c（随仓库提交，由 boot.xml 生成）
+ * - 解释侧：本文件在运行时读 services/ui/boot.xml，按文档顺序逐个属性调用 LVGL API
+ *  （与 lv_xml 加载器的语义相同；工程里的 LVGL 没有带 lv_xml 的实现）
+ * - 两棵树分别在 800x480 与 480x272 下渲染，比较帧缓冲与各命名对象的坐标
+ *
+ * 解释器只支持生成器的子集（lv_obj / lv_label，尺寸/位置/对齐/标志/文本/共享样式，
+ * 以及生成器扩展 align_to）；遇到不认识的标签或属性直接判失败，
+ * boot.xml 用到新特性时需要同时补上这里
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#include "lvgl.h"
+#include "src/core/lv_refr.h"
+#include "ser_lvgl_gen_boot.h"
+#include "ser_lvgl_style.h"
+
+#define MAX_W 800
+#define MAX_H 480
+#define MAX_ATTRS 16u
+#define MAX_NAMED 16u
+
+static uint16_t s_fb[MAX_W * MAX_H];
+static uint16_t s_ref[MAX_W * MAX_H];
+static lv_display_t *s_disp;
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+/* ===== 最小 XML 读取（标签、属性、注释、自闭合；无命名空间/CDATA） ===== */
+
+typedef struct
+{
+  char tag[32];
+  char key[MAX_ATTRS][32];
+  char val[MAX_ATTRS][128];
+  uint32_t n;
+  bool closing;     /* </tag> */
+  bool self_closed; /* <tag/> */
+} xml_tag_t;
+
+static const char *skip_ws(const char *p)
+{
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+  {
+    p++;
+  }
+  return p;
+}
+
+static void unescape(char *s)
+{
+  static const struct
+  {
+    const char *ent;
+    char c;
+  } k_ents[] = {{"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'},
+                {"&quot;", '"'}, {"&apos;", '\''}};
+  char *w = s;
+  for (const char *r = s; *r != '\0';)
+  {
+    bool hit = false;
+    for (uint32_t i = 0; i < sizeof(k_ents) / sizeof(k_ents[0]); i++)
+    {
+      const size_t n = strlen(k_ents[i].ent);
+      if (strncmp(r, k_ents[i].ent, n) == 0)
+      {
+        *w++ = k_ents[i].c;
+        r += n;
+        hit = true;
+        break;
+      }
+    }
+    if (!hit)
+    {
+      *w++ = *r++;
+    }
+  }
+  *w = '\0';
+}
+
+/* 读下一个元素标签；返回 NULL 表示结束或格式错误（*err 置位） */
+static const char *xml_next(const char *p, xml_tag_t *t, bool *err)
+{
+  for (;;)
+  {
+    p = strchr(p, '<');
+    if (p == NULL)
+    {
+      return NULL;
+    }
+    if (strncmp(p, "<!--", 4) == 0)
+    {
+      p = strstr(p, "-->");
+      if (p == NULL)
+      {
+        *err = true;
+        return NULL;
+      }
+      p += 3;
+      continue;
+    }
+    if (p[1] == '?')
+    {
+      p = strstr(p, "?>");
+      if (p == NULL)
+      {
+        *err = true;
+        return NULL;
+      }
+      p += 2;
+      continue;
+    }
+    break;
+  }
+
+  memset(t, 0, sizeof(*t));
+  p++;
+  if (*p == '/')
+  {
+    t->closing = true;
+    p++;
+  }
+  size_t n = 0;
+  while (*p != '\0' && *p != '>' && *p != '/' && *p != ' ' && *p != '\t' &&
+         *p != '\r' && *p != '\n' && n + 1u < sizeof(t->tag))
+  {
+    t->tag[n++] = *p++;
+  }
+
+  for (;;)
+  {
+    p = skip_ws(p);
+    if (*p == '>')
+    {
+      return p + 1;
+    }
+    if (p[0] == '/' && p[1] == '>')
+    {
+      t->self_closed = true;
+      return p + 2;
+    }
+    if (*p == '\0' || t->n >= MAX_ATTRS)
+    {
+      *err = true;
+      return NULL;
+    }
+
+    const char *eq = strchr(p, '=');
+    if (eq == NULL || eq[1] != '"' || (size_t)(eq - p) >= sizeof(t->key[0]))
+    {
+      *err = true;
+      return NULL;
+    }
+    memcpy(t->key[t->n], p, (size_t)(eq - p));
+    const char *v = eq + 2;
+    const char *end = strchr(v, '"');
+    if (end == NULL || (size_t)(end - v) >= sizeof(t->val[0]))
+    {
+      *err = true;
+      return NULL;
+    }
+    memcpy(t->val[t->n], v, (size_t)(end - v));
+    unescape(t->val[t->n]);
+    t->n++;
+    p = end + 1;
+  }
+}
+
+/* ===== 解释执行 ===== */
+
+typedef struct
+{
+  char name[32];
+  lv_obj_t *obj;
+} named_t;
+
+static named_t s_named[MAX_NAMED];
+static uint32_t s_named_n;
+
+static lv_obj_t *find_named(const char *name)
+{
+  for (uint32_t i = 0; i < s_named_n; i++)
+  {
+    if (strcmp(s_named[i].name, name) == 0)
+    {
+      return s_named[i].obj;
+    }
+  }
+  return NULL;
+}
+
+/* 共享样式表中的样式（名字与 ser_lvgl_style_<name> 一一对应） */
+static const lv_style_t *find_style(const char *name)
+{
+#define STYLE_LOOKUP(n, ...)                                                   \
+  if (strcmp(name, #n) == 0)                                                   \
+  {                                                                            \
+    return &ser_lvgl_style_##n;                                                \
+  }
+  SER_LVGL_STYLE_TABLE(STYLE_LOOKUP)
+#undef STYLE_LOOKUP
+  return NULL;
+}
+
+static bool parse_align(const char *s, lv_align_t *out)
+{
+  static const struct
+  {
+    const char *name;
+    lv_align_t align;
+  } k_aligns[] = {
+      {"default", LV_ALIGN_DEFAULT},
+      {"top_left", LV_ALIGN_TOP_LEFT},
+      {"top_mid", LV_ALIGN_TOP_MID},
+      {"top_right", LV_ALIGN_TOP_RIGHT},
+      {"bottom_left", LV_ALIGN_BOTTOM_LEFT},
+      {"bottom_mid", LV_ALIGN_BOTTOM_MID},
+      {"bottom_right", LV_ALIGN_BOTTOM_RIGHT},
+      {"left_mid", LV_ALIGN_LEFT_MID},
+      {"right_mid", LV_ALIGN_RIGHT_MID},
+      {"center", LV_ALIGN_CENTER},
+      {"out_top_left", LV_ALIGN_OUT_TOP_LEFT},
+      {"out_top_mid", LV_ALIGN_OUT_TOP_MID},
+      {"out_top_right", LV_ALIGN_OUT_TOP_RIGHT},
+      {"out_bottom_left", LV_ALIGN_OUT_BOTTOM_LEFT},
+      {"out_bottom_mid", LV_ALIGN_OUT_BOTTOM_MID},
+      {"out_bottom_right", LV_ALIGN_OUT_BOTTOM_RIGHT},
+      {"out_left_top", LV_ALIGN_OUT_LEFT_TOP},
+      {"out_left_mid", LV_ALIGN_OUT_LEFT_MID},
+      {"out_left_bottom", LV_ALIGN_OUT_LEFT_BOTTOM},
+      {"out_right_top", LV_ALIGN_OUT_RIGHT_TOP},
+      {"out_right_mid", LV_ALIGN_OUT_RIGHT_MID},
+      {"out_right_bottom", LV_ALIGN_OUT_RIGHT_BOTTOM},
+  };
+  for (uint32_t i = 0; i < sizeof(k_aligns) / sizeof(k_aligns[0]); i++)
+  {
+    if (strcmp(s, k_aligns[i].name) == 0)
+    {
+      *out = k_aligns[i].align;
+      return true;
+    }
+  }
+  return false;
+}
+
+static int32_t parse_size(const char *s)
+{
+  if (strcmp(s, "content") == 0)
+  {
+    return LV_SIZE_CONTENT;
+  }
+  const size_t n = strlen(s);
+  if (n > 0u && s[n - 1u] == '%')
+  {
+    return lv_pct((int32_t)strtol(s, NULL, 0));
+  }
+  return (int32_t)strtol(s, NULL, 0);
+}
+
+static bool parse_flag(const char *key, lv_obj_flag_t *out)
+{
+  static const struct
+  {
+    const char *name;
+    lv_obj_flag_t flag;
+  } k_flags[] = {
+      {"hidden", LV_OBJ_FLAG_HIDDEN},
+      {"clickable", LV_OBJ_FLAG_CLICKABLE},
+      {"scrollable", LV_OBJ_FLAG_SCROLLABLE},
+      {"scroll_elastic", LV_OBJ_FLAG_SCROLL_ELASTIC},
+      {"scroll_momentum", LV_OBJ_FLAG_SCROLL_MOMENTUM},
+      {"event_bubble", LV_OBJ_FLAG_EVENT_BUBBLE},
+  };
+  for (uint32_t i = 0; i < sizeof(k_flags) / sizeof(k_flags[0]); i++)
+  {
+    if (strcmp(key, k_flags[i].name) == 0)
+    {
+      *out = k_flags[i].flag;
+      return true;
+    }
+  }
+  return false;
+}
+
+/* 按文档顺序应用一个属性；不支持的属性返回 false */
+static bool apply_attr(lv_obj_t *obj, const char *tag, const char *key,
+                       const char *val)
+{
+  lv_obj_flag_t flag;
+  lv_align_t align;
+
+  if (strcmp(key, "name") == 0 || strcmp(key, "extends") == 0)
+  {
+    return true;
+  }
+  if (strcmp(key, "width") == 0)
+  {
+    lv_obj_set_width(obj, parse_size(val));
+    return true;
+  }
+  if (strcmp(key, "height") == 0)
+  {
+    lv_obj_set_height(obj, parse_size(val));
+    return true;
+  }
+  if (strcmp(key, "x") == 0)
+  {
+    lv_obj_set_x(obj, (int32_t)strtol(val, NULL, 0));
+    return true;
+  }
+  if (strcmp(key, "y") == 0)
+  {
+    lv_obj_set_y(obj, (int32_t)strtol(val, NULL, 0));
+    return true;
+  }
+  if (strcmp(key, "align") == 0)
+  {
+    if (!parse_align(val, &align))
+    {
+      return false;
+    }
+    lv_obj_set_align(obj, align);
+    return true;
+  }
+  if (strcmp(key, "text") == 0 && strcmp(tag, "lv_label") == 0)
+  {
+    lv_label_set_text(obj, val);
+    return true;
+  }
+  if (strcmp(key, "styles") == 0)
+  {
+    char buf[128];
+    (void)snprintf(buf, sizeof(buf), "%s", val);
+    for (char *s = strtok(buf, " "); s != NULL; s = strtok(NULL, " "))
+    {
+      const lv_style_t *style = find_style(s);
+      if (style == NULL)
+      {
+        return false;
+      }
+      lv_obj_add_style(obj, (lv_style_t *)style, 0);
+    }
+    return true;
+  }
+  if (parse_flag(key, &flag))
+  {
+    if (strcmp(val, "true") == 0)
+    {
+      lv_obj_add_flag(obj, flag);
+    }
+    else
+    {
+      lv_obj_remove_flag(obj, flag);
+    }
+    return true;
+  }
+  if (strcmp(key, "align_to") == 0)
+  {
+    char base[32];
+    char al[32];
+    int x = 0;
+    int y = 0;
+    if (sscanf(val, "%31s %31s %d %d", base, al, &x, &y) != 4 ||
+        find_named(base) == NULL || !parse_align(al, &align))
+    {
+      return false;
+    }
+    lv_obj_align_to(obj, find_named(base), align, x, y);
+    return true;
+  }
+  return false;
+}
+
+/* 解释 <component><view ...>...</view></component>；失败返回 false */
+static bool interpret(const char *xml, lv_obj_t *parent)
+{
+  lv_obj_t *stack[8];
+  uint32_t depth = 0;
+  bool err = false;
+  bool in_view = false;
+  xml_tag_t t;
+
+  s_named_n = 0;
+  for (const char *p = xml_next(xml, &t, &err); p != NULL;
+       p = xml_next(p, &t, &err))
+  {
+    if (strcmp(t.tag, "component") == 0)
+    {
+      continue;
+    }
+    if (t.closing)
+    {
+      if (depth == 0u)
+      {
+        return false;
+      }
+      depth--;
+      continue;
+    }
+
+    const char *widget = t.tag;
+    if (strcmp(t.tag, "view") == 0)
+    {
+      if (in_view)
+      {
+        return false;
+      }
+      in_view = true;
+      widget = "lv_obj";
+      for (uint32_t i = 0; i < t.n; i++)
+      {
+        if (strcmp(t.key[i], "extends") == 0)
+        {
+          widget = t.val[i];
+        }
+      }
+    }
+
+    lv_obj_t *up = (depth == 0u) ? parent : stack[depth - 1u];
+    lv_obj_t *obj = NULL;
+    if (strcmp(widget, "lv_obj") == 0)
+    {
+      obj = lv_obj_create(up);
+    }
+    else if (strcmp(widget, "lv_label") == 0)
+    {
+      obj = lv_label_create(up);
+    }
+    else
+    {
+      printf("unsupported widget <%s>\n", widget);
+      return false;
+    }
+
+    for (uint32_t i = 0; i < t.n; i++)
+    {
+      if (strcmp(t.key[i], "name") == 0 && s_named_n < MAX_NAMED)
+      {
+        (void)snprintf(s_named[s_named_n].name, sizeof(s_named[0].name),
+                       "%s", t.val[i]);
+        s_named[s_named_n++].obj = obj;
+      }
+      if (!apply_attr(obj, widget, t.key[i], t.val[i]))
+      {
+        printf("unsupported attribute %s=\"%s\" on <%s>\n", t.key[i],
+               t.val[i], t.tag);
+        return false;
+      }
+    }
+
+    if (!t.self_closed)
+    {
+      if (depth >= sizeof(stack) / sizeof(stack[0]))
+      {
+        return false;
+      }
+      stack[depth++] = obj;
+    }
+  }
+  return !err && in_view && depth == 0u;
+}
+
+static char *read_file(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    return NULL;
+  }
+  (void)fseek(f, 0, SEEK_END);
+  const long n = ftell(f);
+  (void)fseek(f, 0, SEEK_SET);
+  char *buf = malloc((size_t)n + 1u);
+  if (buf != NULL && fread(buf, 1, (size_t)n, f) == (size_t)n)
+  {
+    buf[n] = '\0';
+  }
+  else
+  {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+  return buf;
+}
+
+static void check_size(const char *xml, int32_t w, int32_t h)
+{
+  lv_display_set_resolution(s_disp, w, h);
+
+  /* 生成代码 */
+  lv_obj_t *scr_gen = lv_obj_create(NULL);
+  lv_obj_add_style(scr_gen, &ser_lvgl_style_screen, 0);
+  lv_screen_load(scr_gen);
+  ser_lvgl_gen_boot_t gen;
+  ser_lvgl_gen_boot_create(scr_gen, &gen);
+  lv_refr_now(s_disp);
+  memcpy(s_ref, s_fb, sizeof(s_fb));
+
+  /* 解释执行 */
+  lv_obj_t *scr_xml = lv_obj_create(NULL);
+  lv_obj_add_style(scr_xml, &ser_lvgl_style_screen, 0);
+  lv_screen_load(scr_xml);
+  TEST_CHECK(interpret(xml, scr_xml));
+  lv_refr_now(s_disp);
+
+  /* 坐标先比（失败时更容易定位），再比像素 */
+  const struct
+  {
+    const char *name;
+    lv_obj_t *obj;
+  } k_gen[] = {{"card", gen.card},
+               {"badge", gen.badge},
+               {"title", gen.title},
+               {"subtitle", gen.subtitle}};
+  for (uint32_t i = 0; i < sizeof(k_gen) / sizeof(k_gen[0]); i++)
+  {
+    lv_obj_t *o = find_named(k_gen[i].name);
+    TEST_CHECK(o != NULL);
+    if (o == NULL)
+    {
+      continue;
+    }
+    lv_area_t a;
+    lv_area_t b;
+    lv_obj_get_coords(k_gen[i].obj, &a);
+    lv_obj_get_coords(o, &b);
+    if (memcmp(&a, &b, sizeof(a)) != 0)
+    {
+      printf("%dx%d %s: generated (%d,%d)-(%d,%d) xml (%d,%d)-(%d,%d)\n",
+             (int)w, (int)h, k_gen[i].name, (int)a.x1, (int)a.y1, (int)a.x2,
+             (int)a.y2, (int)b.x1, (int)b.y1, (int)b.x2, (int)b.y2);
+    }
+    TEST_CHECK(memcmp(&a, &b, sizeof(a)) == 0);
+  }
+  TEST_CHECK(memcmp(s_ref, s_fb, (size_t)w * (size_t)h * 2u) == 0);
+
+  lv_obj_delete(scr_gen);
+}
+
+int main(void)
+{
+  char *xml = read_file(UI_XML_DIR "/boot.xml");
+  TEST_CHECK(xml != NULL);
+  if (xml == NULL)
+  {
+    return test_done();
+  }
+
+  lv_init();
+  s_disp = lv_display_create(MAX_W, MAX_H);
+  lv_display_set_color_format(s_disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(s_disp, flush_cb);
+  lv_display_set_buffers(s_disp, s_fb, NULL, sizeof(s_fb),
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+
+  check_size(xml, 800, 480);
+  check_size(xml, 480, 272);
+
+  free(xml);
+  return test_done();
+}
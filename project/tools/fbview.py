@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ser_fbstream 二进制流 -> PNG 序列（主机侧工具）
+
+输入：串口抓到的原始字节流（可与 ser_prof 数据混在一起，未知包整包跳过）
+    包格式：A5 5A | type(u8) | len(u16 LE) | payload
+    0x10 FRAME {u32 seq, u16 width, u16 height, u8 flags(bit0=整屏)}
+    0x11 RECT  {u16 x, u16 y, u16 w, u16 h, rle565 行数据 * h}
+    0x12 END   {u32 seq}
+
+rle565（每行独立，操作码不跨行，见 mcu/services/ser_rle565.h）：
+    0b00nnnnnn LIT n+1 个像素 u16 LE
+    0b01nnnnnn RUN 1 个像素重复 n+1 次
+    0b10nnnnnn ROW 复制上一行同位置 n+1 个像素
+
+用法：
+    python3 fbview.py capture.bin -o frames/
+    python3 fbview.py --port /dev/ttyUSB0 --seconds 30 -o frames/
+    python3 fbview.py capture.bin --stats          # 只统计压缩率，不写 PNG
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+KNOWN_TYPES = (1, 2, 3, 4, 0x10, 0x11, 0x12)
+
+
+def read_port(port, baud, seconds):
+    try:
+        import serial  # pyserial
+    except ImportError:
+        sys.stderr.write("--port requires pyserial (pip install pyserial)\n")
+        sys.exit(1)
+    import time
+
+    data = bytearray()
+    with serial.Serial(port, baud, timeout=0.1) as s:
+        t_end = time.time() + seconds
+        while time.time() < t_end:
+            data += s.read(4096)
+    return bytes(data)
+
+
+def packets(data):
+    """按 A5 5A 同步头切包；长度越界时向后 1 字节重新同步"""
+    i = 0
+    n = len(data)
+    while i + 5 <= n:
+        if data[i] != 0xA5 or data[i + 1] != 0x5A:
+            i += 1
+            continue
+        ptype = data[i + 2]
+        plen = data[i + 3] | (data[i + 4] << 8)
+        if ptype not in KNOWN_TYPES or i + 5 + plen > n:
+            i += 1
+            continue
+        yield ptype, data[i + 5:i + 5 + plen]
+        i += 5 + plen
+
+
+def decode_rows(buf, off, w, h):
+    """解码 h 行，返回 (行列表, 新偏移)；码流损坏时抛 ValueError"""
+    rows = []
+    prev = None
+    for _ in range(h):
+        row = [0] * w
+        i = 0
+        while i < w:
+            if off >= len(buf):
+                raise ValueError("truncated row")
+            op = buf[off]
+            off += 1
+            cnt = (op & 0x3F) + 1
+            kind = op & 0xC0
+            if i + cnt > w:
+                raise ValueError("run crosses row end")
+            if kind == 0x00:
+                if off + cnt * 2 > len(buf):
+                    raise ValueError("truncated literal")
+                row[i:i + cnt] = struct.unpack_from("<%dH" % cnt, buf, off)
+                off += cnt * 2
+            elif kind == 0x40:
+                if off + 2 > len(buf):
+                    raise ValueError("truncated run")
+                row[i:i + cnt] = [buf[off] | (buf[off + 1] << 8)] * cnt
+                off += 2
+            elif kind == 0x80:
+                if prev is None:
+                    raise ValueError("ROW op on first row")
+                row[i:i + cnt] = prev[i:i + cnt]
+            else:
+                raise ValueError("reserved op")
+            i += cnt
+        rows.append(row)
+        prev = row
+    return rows, off
+
+
+_LUT = None
+
+
+def rgb565_lut():
+    """RGB565 -> 3 字节 RGB888 查表（首次使用时生成）"""
+    global _LUT
+    if _LUT is None:
+        _LUT = []
+        for c in range(65536):
+            r = (c >> 11) & 0x1F
+            g = (c >> 5) & 0x3F
+            b = c & 0x1F
+            _LUT.append(bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4),
+                               (b << 3) | (b >> 2))))
+    return _LUT
+
+
+def write_png(path, w, h, fb):
+    lut = rgb565_lut()
+    raw = bytearray()
+    for y in range(h):
+        raw.append(0)
+        raw += b"".join(lut[c] for c in fb[y * w:(y + 1) * w])
+
+    def chunk(tag, body):
+        c = struct.pack(">I", len(body)) + tag + body
+        return c + struct.pack(">I", zlib.crc32(tag + body) & 0xFFFFFFFF)
+
+    png = b"\x89PNG\r\n\x1a\n"
+    png += chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0))
+    png += chunk(b"IDAT", zlib.compress(bytes(raw), 6))
+    png += chunk(b"IEND", b"")
+    with open(path, "wb") as f:
+        f.write(png)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="ser_fbstream stream -> PNG frames")
+    ap.add_argument("input", nargs="?", help="raw capture file")
+    ap.add_argument("--port", help="read directly from a serial port")
+    ap.add_argument("--baud", type=int, default=921600)
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("-o", "--output", help="directory for frame_<seq>.png")
+    ap.add_argument("--stats", action="store_true",
+                    help="print per-frame compression ratio")
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_port(args.port, args.baud, args.seconds)
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+    else:
+        ap.error("either an input file or --port is required")
+    if not args.output and not args.stats:
+        ap.error("nothing to do: give -o and/or --stats")
+    if args.output:
+        os.makedirs(args.output, exist_ok=True)
+
+    fb = None
+    w = h = 0
+    synced = False  # 收到第一个整屏之前画面不完整，不输出
+    seq = None
+    frame_raw = frame_enc = 0
+    tot_raw = tot_enc = 0
+    n_frames = n_bad = 0
+
+    for ptype, p in packets(data):
+        if ptype == 0x10 and len(p) >= 9:
+            seq, fw, fh, flags = struct.unpack_from("<IHHB", p)
+            if fb is None or (fw, fh) != (w, h):
+                w, h = fw, fh
+                fb = [0] * (w * h)
+                synced = False
+            if flags & 1:
+                synced = True
+            frame_raw = frame_enc = 0
+        elif ptype == 0x11 and fb is not None and len(p) >= 8:
+            x, y, rw, rh = struct.unpack_from("<HHHH", p)
+            if x + rw > w or y + rh > h:
+                n_bad += 1
+                continue
+            try:
+                rows, _ = decode_rows(p, 8, rw, rh)
+            except ValueError:
+                n_bad += 1
+                continue
+            for k, row in enumerate(rows):
+                base = (y + k) * w + x
+                fb[base:base + rw] = row
+            frame_raw += rw * rh * 2
+            frame_enc += len(p) + 5
+        elif ptype == 0x12 and fb is not None and len(p) >= 4:
+            (end_seq,) = struct.unpack_from("<I", p)
+            if end_seq != seq:
+                continue
+            tot_raw += frame_raw
+            tot_enc += frame_enc
+            n_frames += 1
+            if args.stats:
+                ratio = frame_raw / frame_enc if frame_enc else 0.0
+                print("frame %6d  raw %8d  enc %7d  ratio %6.2f"
+                      % (seq, frame_raw, frame_enc, ratio))
+            if synced and args.output:
+                write_png(os.path.join(args.output, "frame_%06d.png" % seq),
+                          w, h, fb)
+
+    ratio = tot_raw / tot_enc if tot_enc else 0.0
+    sys.stderr.write("%d frames, %d bad rects, raw %d B -> %d B (%.2fx)\n"
+                     % (n_frames, n_bad, tot_raw, tot_enc, ratio))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+图片资源生成器（主机侧工具）：PNG -> 压缩 lv_image_dsc_t
+
+用途：
+- 读 PNG（8 位灰度/RGB/调色板，可带 alpha；alpha 按 --bg 背景色预混合），
+  转成 RGB565（与 lv_color_to_u16 相同的截断）
+- 用主机编译器把 img_host.c + ser_img565/ser_rle565 编成 img_host：
+  编码为 ser_img565 容器（逐行 rle565 + 重启行索引），整图与随机裁剪窗口解码比对
+- 生成 services/ser_img_<name>.c/.h（随仓库提交），固件里由 ser_lvgl_img 解码器绘制：
+    ser_lvgl_img_create(parent, &ser_img_<name>);
+
+用法：
+    python3 img_gen.py logo.png --mcu <mcu 目录> -o <输出目录> [--name logo]
+                       [--key-rows 16] [--bg 000000] [--cc cc] [--bench]
+--bench 额外报告主机解码吞吐（整图 / LVGL 式条带流 / 裁剪窗口，对照原样 memcpy）
+CMake 中 services/img/*.png 比生成文件新时自动重新生成，也可手动 `ninja img_gen`
+"""
+
+import argparse
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+# 与图片容器相关的 services 源文件（不依赖 LVGL/RTOS/外设）
+SER_SOURCES = [
+    "ser_img565.c",
+    "ser_rle565.c",
+]
+
+
+class PngError(Exception):
+    pass
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def unfilter(raw, w, h, bpp):
+    """逐行反滤波，返回去掉滤波字节后的像素字节"""
+    stride = w * bpp
+    out = bytearray(stride * h)
+    prev = bytearray(stride)
+    pos = 0
+    for y in range(h):
+        ft = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        if ft == 1:
+            for i in range(bpp, stride):
+                line[i] = (line[i] + line[i - bpp]) & 0xFF
+        elif ft == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xFF
+        elif ft == 3:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif ft == 4:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                up_left = prev[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + paeth(left, prev[i], up_left)) & 0xFF
+        elif ft != 0:
+            raise PngError("bad filter type %d" % ft)
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+    return out
+
+
+def read_png(path):
+    """返回 (w, h, rgba 字节)；只支持 8 位、非隔行"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise PngError("not a PNG file")
+
+    pos = 8
+    idat = b""
+    plte = b""
+    trns = b""
+    hdr = None
+    while pos + 8 <= len(data):
+        n, tag = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + n]
+        pos += 12 + n
+        if tag == b"IHDR":
+            hdr = struct.unpack(">IIBBBBB", body)
+        elif tag == b"PLTE":
+            plte = body
+        elif tag == b"tRNS":
+            trns = body
+        elif tag == b"IDAT":
+            idat += body
+        elif tag == b"IEND":
+            break
+    if hdr is None:
+        raise PngError("missing IHDR")
+
+    w, h, depth, ctype, _, _, interlace = hdr
+    if depth != 8 or interlace != 0:
+        raise PngError("only 8-bit non-interlaced PNG is supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if channels is None:
+        raise PngError("bad color type %d" % ctype)
+
+    px = unfilter(zlib.decompress(idat), w, h, channels)
+    rgba = bytearray(w * h * 4)
+    for i in range(w * h):
+        s = px[i * channels:(i + 1) * channels]
+        if ctype == 0:
+            c = (s[0], s[0], s[0], 255)
+        elif ctype == 2:
+            c = (s[0], s[1], s[2], 255)
+        elif ctype == 3:
+            k = s[0]
+            a = trns[k] if k < len(trns) else 255
+            c = (plte[k * 3], plte[k * 3 + 1], plte[k * 3 + 2], a)
+        elif ctype == 4:
+            c = (s[0], s[0], s[0], s[1])
+        else:
+            c = (s[0], s[1], s[2], s[3])
+        rgba[i * 4:i * 4 + 4] = bytes(c)
+    return w, h, rgba
+
+
+def to_rgb565(rgba, bg):
+    """alpha 对 bg 预混合后转 RGB565 小端；返回 (字节, 是否有半透明像素)"""
+    out = bytearray(len(rgba) // 2)
+    blended = False
+    for i in range(len(rgba) // 4):
+        r, g, b, a = rgba[i * 4:i * 4 + 4]
+        if a != 255:
+            blended = True
+            r = (r * a + bg[0] * (255 - a) + 127) // 255
+            g = (g * a + bg[1] * (255 - a) + 127) // 255
+            b = (b * a + bg[2] * (255 - a) + 127) // 255
+        c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+        out[i * 2] = c & 0xFF
+        out[i * 2 + 1] = c >> 8
+    return out, blended
+
+
+def build_host(cc, mcu_dir, tools_dir, build_dir):
+    ser_dir = os.path.join(mcu_dir, "services")
+    srcs = [os.path.join(tools_dir, "img_host.c")]
+    srcs += [os.path.join(ser_dir, s) for s in SER_SOURCES]
+    exe = os.path.join(build_dir, "img_host")
+    cmd = [cc, "-O2", "-std=gnu11", "-Wall", "-I", ser_dir, "-o", exe] + srcs
+    subprocess.check_call(cmd)
+    return exe
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("    " + ", ".join("0x%02X" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def header(name, src, w, h, raw, size):
+    return "\n".join([
+        "#pragma once",
+        "",
+        "/* 由 project/tools/img_gen.py 根据 %s 生成，请勿手工修改 */" % src,
+        "",
+        '#include "lvgl.h"',
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "/* %dx%d RGB565，ser_img565 容器 %d 字节（原样 %d 字节），"
+        "需 ser_lvgl_img_init */" % (w, h, size, raw),
+        "extern const lv_image_dsc_t ser_img_%s;" % name,
+        "",
+        "#ifdef __cplusplus",
+        '} /*extern "C"*/',
+        "#endif",
+        "",
+    ])
+
+
+def source(name, src, w, h, data):
+    return "\n".join([
+        "/* 由 project/tools/img_gen.py 根据 %s 生成，请勿手工修改 */" % src,
+        "",
+        '#include "ser_img_%s.h"' % name,
+        "",
+        '#include "ser_lvgl_img.h"',
+        "",
+        "static const uint8_t ser_img_%s_data[%d] = {" % (name, len(data)),
+        c_array(data),
+        "};",
+        "",
+        "const lv_image_dsc_t ser_img_%s = {" % name,
+        "    .header =",
+        "        {",
+        "            .magic = LV_IMAGE_HEADER_MAGIC,",
+        "            .cf = LV_COLOR_FORMAT_RGB565,",
+        "            .flags = SER_LVGL_IMG_FLAG,",
+        "            .w = %du," % w,
+        "            .h = %du," % h,
+        "            .stride = %du," % (w * 2),
+        "        },",
+        "    .data_size = %du," % len(data),
+        "    .data = ser_img_%s_data," % name,
+        "};",
+        "",
+    ])
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                os.utime(path, None)
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="PNG -> compressed lv_image_dsc_t")
+    ap.add_argument("png", help="input PNG")
+    ap.add_argument("--mcu", required=True, help="mcu directory")
+    ap.add_argument("-o", "--out-dir", required=True, help="output directory")
+    ap.add_argument("--name", help="C name (default: PNG file name)")
+    ap.add_argument("--key-rows", type=int, default=16,
+                    help="restart row interval (default 16)")
+    ap.add_argument("--bg", default="000000",
+                    help="RRGGBB background for alpha (default 000000)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"),
+                    help="host C compiler")
+    ap.add_argument("--bench", action="store_true",
+                    help="report host decode throughput")
+    args = ap.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.png))[0]
+    name = re.sub(r"[^0-9A-Za-z_]", "_", name).lower()
+    if name[0].isdigit():
+        name = "_" + name  # 与 CMake string(MAKE_C_IDENTIFIER) 一致
+    try:
+        bg = bytes.fromhex(args.bg)
+        if len(bg) != 3:
+            raise ValueError
+    except ValueError:
+        sys.stderr.write("bad --bg %s\n" % args.bg)
+        return 1
+    if not 0 < args.key_rows <= 0xFFFF:
+        sys.stderr.write("bad --key-rows %d\n" % args.key_rows)
+        return 1
+
+    try:
+        w, h, rgba = read_png(args.png)
+    except (OSError, PngError, zlib.error) as e:
+        sys.stderr.write("img_gen: %s: %s\n" % (args.png, e))
+        return 1
+    px, blended = to_rgb565(rgba, bg)
+    if blended:
+        sys.stderr.write("img_gen: %s: alpha blended onto #%s\n"
+                         % (args.png, args.bg))
+
+    tools_dir = os.path.dirname(os.path.abspath(__file__))
+    build_dir = tempfile.mkdtemp(prefix="img_")
+    try:
+        exe = build_host(args.cc, os.path.abspath(args.mcu), tools_dir,
+                         build_dir)
+        raw = os.path.join(build_dir, "in.raw")
+        out = os.path.join(build_dir, "out.bin")
+        with open(raw, "wb") as f:
+            f.write(px)
+        cmd = [exe, str(w), str(h), str(args.key_rows), raw, out]
+        if args.bench:
+            cmd.append("--bench")
+        subprocess.check_call(cmd)
+        with open(out, "rb") as f:
+            data = f.read()
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.stderr.write("img_gen: error: %s\n" % e)
+        return 1
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+
+    src = os.path.basename(args.png)
+    base = os.path.join(args.out_dir, "ser_img_" + name)
+    write_if_changed(base + ".h", header(name, src, w, h, w * h * 2,
+                                         len(data)))
+    write_if_changed(base + ".c", source(name, src, w, h, data))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
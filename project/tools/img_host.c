@@ -0,0 +1,215 @@
+/*
+ * 图片资源主机编码器（由 img_gen.py 编译运行，不进固件）
+ *
+ * - 读入 RGB565 原始像素（小端，行连续），编码为 ser_img565 容器
+ * - 立即整图解码、多组裁剪窗口解码并逐像素比对
+ * - --bench：测主机解码吞吐（整图 / 按 LVGL 条带流式 / 裁剪窗口），
+ *   以原样存储时的 memcpy 为参照
+ *
+ * 用法：img_host <width> <height> <key_rows> <in.raw> <out.bin> [--bench]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ser_img565.h"
+
+#define BAND_ROWS 16u
+
+static double now_s(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint32_t s_seed = 1u;
+static uint32_t rnd(uint32_t n)
+{
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return (s_seed >> 8) % n;
+}
+
+static int check_area(const ser_img565_t *img, const uint16_t *px, uint32_t w,
+                      uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2,
+                      uint16_t *buf)
+{
+  const uint32_t cw = x2 - x1 + 1u;
+  if (!ser_img565_decode_area(img, x1, y1, x2, y2, buf, cw))
+  {
+    fprintf(stderr, "decode failed (%u,%u)-(%u,%u)\n", x1, y1, x2, y2);
+    return 1;
+  }
+  for (uint32_t y = y1; y <= y2; y++)
+  {
+    if (memcmp(buf + (y - y1) * cw, px + y * w + x1, cw * 2u) != 0)
+    {
+      fprintf(stderr, "mismatch (%u,%u)-(%u,%u) row %u\n", x1, y1, x2, y2, y);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* 按 LVGL get_area 的方式：定位一次，逐条带解码到同一块条带缓冲 */
+static int stream_area(const ser_img565_t *img, uint32_t x1, uint32_t y1,
+                       uint32_t x2, uint32_t y2, uint16_t *band)
+{
+  const uint32_t cw = x2 - x1 + 1u;
+  ser_img565_cursor_t cur;
+  if (!ser_img565_seek(&cur, img, x1, x2, y1, band))
+  {
+    return 1;
+  }
+  for (uint32_t y = y1; y <= y2; y += BAND_ROWS)
+  {
+    uint32_t n = y2 - y + 1u;
+    if (n > BAND_ROWS)
+      n = BAND_ROWS;
+    if (!ser_img565_read(&cur, band, cw, n))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* 重复执行到至少 0.2 秒，返回单次微秒数 */
+#define BENCH(us, stmt)                                                        \
+  do                                                                           \
+  {                                                                            \
+    uint32_t reps_ = 0;                                                        \
+    double t0_ = now_s(), t1_;                                                 \
+    do                                                                         \
+    {                                                                          \
+      stmt;                                                                    \
+      reps_++;                                                                 \
+      t1_ = now_s();                                                           \
+    } while (t1_ - t0_ < 0.2);                                                 \
+    (us) = (t1_ - t0_) * 1e6 / (double)reps_;                                  \
+  } while (0)
+
+static void bench(const ser_img565_t *img, const uint16_t *px, uint32_t w,
+                  uint32_t h, uint16_t *buf)
+{
+  const double mb = (double)w * h * 2.0 / 1e6;
+  double us_raw, us_full, us_band;
+  volatile int sink = 0;
+
+  BENCH(us_raw, memcpy(buf, px, (size_t)w * h * 2u));
+  BENCH(us_full, sink += !ser_img565_decode_area(img, 0, 0, w - 1u, h - 1u,
+                                                 buf, w));
+  BENCH(us_band, sink += stream_area(img, 0, 0, w - 1u, h - 1u, buf));
+  printf("bench full %ux%u: raw memcpy %.1fus (%.0f MB/s) | decode %.1fus "
+         "(%.0f MB/s out) | 16-row bands %.1fus (%.0f MB/s out)\n",
+         w, h, us_raw, mb / us_raw * 1e6, us_full, mb / us_full * 1e6,
+         us_band, mb / us_band * 1e6);
+
+  /* 裁剪窗口：中心 1/4、底部 1/8 条、右侧 1/8 条；对照“整图解码再裁剪” */
+  const struct
+  {
+    const char *name;
+    uint32_t x1, y1, x2, y2;
+  } win[] = {
+      {"center 1/4", w / 4u, h / 4u, w / 4u + w / 2u - 1u,
+       h / 4u + h / 2u - 1u},
+      {"bottom 1/8", 0u, h - (h + 7u) / 8u, w - 1u, h - 1u},
+      {"right 1/8", w - (w + 7u) / 8u, 0u, w - 1u, h - 1u},
+  };
+  for (uint32_t i = 0; i < sizeof(win) / sizeof(win[0]); i++)
+  {
+    double us;
+    BENCH(us, sink += stream_area(img, win[i].x1, win[i].y1, win[i].x2,
+                                  win[i].y2, buf));
+    const double px_n =
+        (double)(win[i].x2 - win[i].x1 + 1u) * (win[i].y2 - win[i].y1 + 1u);
+    printf("bench clip %-10s %4ux%-4u: %.1fus (%.0f Mpx/s, %.1fx faster "
+           "than full decode)\n",
+           win[i].name, win[i].x2 - win[i].x1 + 1u, win[i].y2 - win[i].y1 + 1u,
+           us, px_n / us, us_full / us);
+  }
+  (void)sink;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 6 && !(argc == 7 && strcmp(argv[6], "--bench") == 0))
+  {
+    fprintf(stderr,
+            "usage: %s <width> <height> <key_rows> <in.raw> <out.bin> "
+            "[--bench]\n",
+            argv[0]);
+    return 2;
+  }
+
+  const uint32_t w = (uint32_t)strtoul(argv[1], NULL, 0);
+  const uint32_t h = (uint32_t)strtoul(argv[2], NULL, 0);
+  const uint32_t key_rows = (uint32_t)strtoul(argv[3], NULL, 0);
+  if (w == 0u || h == 0u || w > 0xFFFFu || h > 0xFFFFu || key_rows == 0u)
+  {
+    fprintf(stderr, "bad size\n");
+    return 2;
+  }
+
+  uint16_t *px = malloc((size_t)w * h * 2u);
+  uint16_t *buf = malloc((size_t)w * h * 2u);
+  const uint32_t cap = ser_img565_bound(w, h, key_rows);
+  uint8_t *out = malloc(cap);
+  if (px == NULL || buf == NULL || out == NULL)
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  FILE *f = fopen(argv[4], "rb");
+  if (f == NULL || fread(px, 2u, (size_t)w * h, f) != (size_t)w * h)
+  {
+    fprintf(stderr, "read %s failed\n", argv[4]);
+    return 1;
+  }
+  fclose(f);
+
+  const uint32_t len = ser_img565_encode(px, w, h, w, key_rows, out, cap);
+  ser_img565_t img;
+  if (len == 0u || !ser_img565_open(&img, out, len))
+  {
+    fprintf(stderr, "encode failed\n");
+    return 1;
+  }
+
+  /* 整图、单像素角落、随机窗口 */
+  int bad = check_area(&img, px, w, 0, 0, w - 1u, h - 1u, buf);
+  bad |= check_area(&img, px, w, w - 1u, h - 1u, w - 1u, h - 1u, buf);
+  for (uint32_t i = 0; i < 500u && !bad; i++)
+  {
+    uint32_t x1 = rnd(w), y1 = rnd(h);
+    uint32_t x2 = x1 + rnd(w - x1), y2 = y1 + rnd(h - y1);
+    bad |= check_area(&img, px, w, x1, y1, x2, y2, buf);
+  }
+  if (bad)
+  {
+    return 1;
+  }
+
+  f = fopen(argv[5], "wb");
+  if (f == NULL || fwrite(out, 1u, len, f) != len)
+  {
+    fprintf(stderr, "write %s failed\n", argv[5]);
+    return 1;
+  }
+  fclose(f);
+
+  printf("img: %ux%u raw=%u bytes -> %u bytes (%.1f%%), key_rows=%u\n", w, h,
+         w * h * 2u, len, 100.0 * len / (w * h * 2.0), key_rows);
+  if (argc == 7)
+  {
+    bench(&img, px, w, h, buf);
+  }
+
+  free(px);
+  free(buf);
+  free(out);
+  return 0;
+}
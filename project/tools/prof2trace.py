@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ser_prof 二进制流 -> Chrome / Perfetto trace JSON（主机侧工具）
+
+输入：串口抓到的原始字节流（或主机构建里 ser_prof_drain 写出的文件）
+    包格式：A5 5A | type(u8) | len(u16 LE) | payload
+    1 INFO   {u32 clock_hz, u16 version}
+    2 NAME   {u16 id, u8 kind(0=标签,1=线程), bytes name}
+    3 EVENTS {n * (u32 ts, u16 tag_id, u8 phase(0=B,1=E), u8 tid)}
+    4 DROP   {u32 dropped_total}
+
+输出：chrome://tracing 或 ui.perfetto.dev 可直接打开的 JSON
+
+用法：
+    python3 prof2trace.py capture.bin -o trace.json
+    python3 prof2trace.py --port /dev/ttyUSB0 --baud 921600 --seconds 10 -o trace.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TID_NAMES = {0xFF: "isr", 0xFE: "main"}
+
+# 同一串口上的其它包（ser_fbstream 0x10~0x12）整包跳过，避免在其负载里误同步
+KNOWN_TYPES = (1, 2, 3, 4, 0x10, 0x11, 0x12)
+
+
+def read_port(port, baud, seconds):
+    try:
+        import serial  # pyserial
+    except ImportError:
+        sys.stderr.write("--port requires pyserial (pip install pyserial)\n")
+        sys.exit(1)
+    import time
+
+    data = bytearray()
+    with serial.Serial(port, baud, timeout=0.1) as s:
+        t_end = time.time() + seconds
+        while time.time() < t_end:
+            data += s.read(4096)
+    return bytes(data)
+
+
+def packets(data):
+    """按 A5 5A 同步头切包；长度越界时向后 1 字节重新同步"""
+    i = 0
+    n = len(data)
+    while i + 5 <= n:
+        if data[i] != 0xA5 or data[i + 1] != 0x5A:
+            i += 1
+            continue
+        ptype = data[i + 2]
+        plen = data[i + 3] | (data[i + 4] << 8)
+        if ptype not in KNOWN_TYPES or i + 5 + plen > n:
+            i += 1
+            continue
+        if ptype in (1, 2, 3, 4):
+            yield ptype, data[i + 5:i + 5 + plen]
+        i += 5 + plen
+
+
+def decode(data):
+    clock_hz = None
+    tags = {}
+    threads = {}
+    events = []
+    dropped = 0
+
+    # 32-bit 时间戳展开为 64-bit（假设相邻事件间隔小于一个回绕周期）
+    last_ts = None
+    epoch = 0
+
+    for ptype, payload in packets(data):
+        if ptype == 1 and len(payload) >= 6:
+            clock_hz, _ver = struct.unpack_from("<IH", payload)
+        elif ptype == 2 and len(payload) >= 3:
+            pid, kind = struct.unpack_from("<HB", payload)
+            name = payload[3:].decode("utf-8", "replace")
+            (threads if kind == 1 else tags)[pid] = name
+        elif ptype == 4 and len(payload) >= 4:
+            dropped = struct.unpack_from("<I", payload)[0]
+        elif ptype == 3:
+            for off in range(0, len(payload) - len(payload) % 8, 8):
+                ts, tag, phase, tid = struct.unpack_from("<IHBB", payload, off)
+                if last_ts is not None and ts < last_ts and last_ts - ts > 0x80000000:
+                    epoch += 1 << 32
+                last_ts = ts
+                events.append((epoch + ts, tag, phase, tid))
+
+    if clock_hz is None:
+        raise ValueError("no INFO packet found (capture too short?)")
+    return clock_hz, tags, threads, events, dropped
+
+
+def to_trace(clock_hz, tags, threads, events, dropped):
+    out = []
+    if not events:
+        return {"traceEvents": out}
+
+    t0 = events[0][0]
+    scale = 1e6 / float(clock_hz)  # -> 微秒
+    seen_tids = set()
+
+    for ts, tag, phase, tid in events:
+        seen_tids.add(tid)
+        out.append({
+            "name": tags.get(tag, "tag#%d" % tag),
+            "cat": "lvgl",
+            "ph": "B" if phase == 0 else "E",
+            "ts": (ts - t0) * scale,
+            "pid": 1,
+            "tid": tid,
+        })
+
+    for tid in sorted(seen_tids):
+        out.append({
+            "name": "thread_name",
+            "ph": "M",
+            "pid": 1,
+            "tid": tid,
+            "args": {"name": threads.get(tid, TID_NAMES.get(tid, "task%d" % tid))},
+        })
+    out.append({"name": "process_name", "ph": "M", "pid": 1,
+                "args": {"name": "mcu"}})
+
+    return {
+        "traceEvents": out,
+        "displayTimeUnit": "ns",
+        "otherData": {"clock_hz": clock_hz, "dropped_events": dropped},
+    }
+
+
+def main():
+    ap = argparse.ArgumentParser(description="ser_prof stream -> trace JSON")
+    ap.add_argument("input", nargs="?", help="raw capture file")
+    ap.add_argument("--port", help="read directly from a serial port")
+    ap.add_argument("--baud", type=int, default=921600)
+    ap.add_argument("--seconds", type=float, default=5.0)
+    ap.add_argument("-o", "--output", required=True, help="trace JSON path")
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_port(args.port, args.baud, args.seconds)
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+    else:
+        ap.error("either an input file or --port is required")
+
+    try:
+        trace = to_trace(*decode(data))
+    except ValueError as e:
+        sys.stderr.write("error: %s\n" % e)
+        return 1
+
+    with open(args.output, "w") as f:
+        json.dump(trace, f)
+
+    n = sum(1 for e in trace["traceEvents"] if e["ph"] in ("B", "E"))
+    sys.stderr.write("%d events, %d dropped on target\n"
+                     % (n, trace.get("otherData", {}).get("dropped_events", 0)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ser_proto 上位机（主机侧工具）
+
+帧格式（见 mcu/services/ser_proto.h）：
+    COBS( id(u8) | payload | crc16(u16 LE) ) | 00
+    crc16 = CRC-16/CCITT-FALSE（poly 0x1021, init 0xFFFF），覆盖 id + payload
+消息表与 mcu/services/ser_proto_msgs.h 保持一致（负载小端、packed）
+
+用法：
+    python3 proto.py --port /dev/ttyUSB0 ping
+    python3 proto.py --port /dev/ttyUSB0 bus-stats 0
+    python3 proto.py --port /dev/ttyUSB0 telemetry on --seconds 10
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+# id: (名称, struct 格式, 字段)
+MSGS = {
+    0x01: ("ping", "<I", ("token",)),
+    0x02: ("bus_stats_req", "<B", ("topic",)),
+    0x03: ("telemetry_cfg", "<B", ("distance",)),
+    0x81: ("pong", "<II", ("token", "uptime_ms")),
+    0x82: ("bus_stats", "<BIIIII",
+           ("topic", "publishes", "rate_mhz", "lat_last_us", "lat_max_us",
+            "stale")),
+    0x90: ("distance", "<i", ("mm",)),
+}
+IDS = {v[0]: k for k, v in MSGS.items()}
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_pos = 0
+    code = 1
+    for b in data:
+        if b:
+            out.append(b)
+            code += 1
+        if not b or code == 0xFF:
+            out[code_pos] = code
+            code_pos = len(out)
+            out.append(0)
+            code = 1
+    out[code_pos] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        code = data[i]
+        if code == 0 or i + code > n:
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < n:
+            out.append(0)
+    return bytes(out)
+
+
+def encode(name, *values):
+    mid = IDS[name]
+    raw = bytes([mid]) + struct.pack(MSGS[mid][1], *values)
+    crc = crc16(raw)
+    return cobs_encode(raw + struct.pack("<H", crc)) + b"\x00"
+
+
+def decode(frame):
+    """一帧（不含分隔符）-> (名称, dict)；损坏/未知返回 None"""
+    raw = cobs_decode(frame)
+    if raw is None or len(raw) < 3:
+        return None
+    if crc16(raw[:-2]) != struct.unpack("<H", raw[-2:])[0]:
+        return None
+    msg = MSGS.get(raw[0])
+    if msg is None or struct.calcsize(msg[1]) != len(raw) - 3:
+        return None
+    return msg[0], dict(zip(msg[2], struct.unpack(msg[1], raw[1:-2])))
+
+
+class Link:
+    def __init__(self, port, baud):
+        try:
+            import serial  # pyserial
+        except ImportError:
+            sys.stderr.write("requires pyserial (pip install pyserial)\n")
+            sys.exit(1)
+        self.s = serial.Serial(port, baud, timeout=0.05)
+        self.buf = bytearray()
+
+    def send(self, name, *values):
+        self.s.write(encode(name, *values))
+
+    def frames(self, seconds):
+        """同一串口上的 ser_prof / ser_fbstream 数据会被当作坏帧丢弃"""
+        t_end = time.time() + seconds
+        while time.time() < t_end:
+            self.buf += self.s.read(4096)
+            while True:
+                z = self.buf.find(0)
+                if z < 0:
+                    break
+                frame = bytes(self.buf[:z])
+                del self.buf[:z + 1]
+                msg = decode(frame) if frame else None
+                if msg is not None:
+                    yield msg
+
+    def request(self, name, values, reply, seconds=1.0):
+        self.send(name, *values)
+        for mname, fields in self.frames(seconds):
+            if mname == reply:
+                return fields
+        return None
+
+
+def main():
+    ap = argparse.ArgumentParser(description="ser_proto host client")
+    ap.add_argument("--port", required=True)
+    ap.add_argument("--baud", type=int, default=921600)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    sub.add_parser("ping")
+    p = sub.add_parser("bus-stats")
+    p.add_argument("topic", type=int)
+    p = sub.add_parser("telemetry")
+    p.add_argument("state", choices=("on", "off"))
+    p.add_argument("--seconds", type=float, default=5.0)
+    args = ap.parse_args()
+
+    link = Link(args.port, args.baud)
+    if args.cmd == "ping":
+        token = int(time.time() * 1000) & 0xFFFFFFFF
+        t0 = time.time()
+        rsp = link.request("ping", (token,), "pong")
+        if rsp is None or rsp["token"] != token:
+            print("no reply")
+            return 1
+        print("pong uptime=%u ms rtt=%.1f ms" %
+              (rsp["uptime_ms"], (time.time() - t0) * 1000.0))
+    elif args.cmd == "bus-stats":
+        rsp = link.request("bus_stats_req", (args.topic,), "bus_stats")
+        if rsp is None:
+            print("no reply")
+            return 1
+        print(", ".join("%s=%s" % kv for kv in rsp.items()))
+    else:
+        link.send("telemetry_cfg", 1 if args.state == "on" else 0)
+        if args.state == "on":
+            for name, fields in link.frames(args.seconds):
+                if name == "distance":
+                    print("%.3f distance %d mm" % (time.time(), fields["mm"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
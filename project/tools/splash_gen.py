@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+开机画面生成器（主机侧工具）
+
+用途：
+- 用主机编译器把 LVGL + 启动界面代码（ser_lvgl_ui_boot.c 等）编成 splash_host，
+  按固件同一份 lv_conf.h 渲染第一帧（RGB565，DIRECT 模式整帧）
+- 渲染结果用 ser_rle565 编码，splash_host 内解码比对并报告主机解码速度
+- 码流生成 services/ser_splash_gen.c/.h（随仓库提交），app_init 里直接解到帧缓冲，
+  LVGL 接手后的第一帧与之逐像素相同
+
+启动界面（boot.xml / 样式 / ser_lvgl_ui_boot.c / 字体）改动后需要重新生成：
+    python3 splash_gen.py --mcu <mcu 目录> -o <输出目录> [--size 800x480] [--cc cc]
+CMake 中找到主机 C 编译器时随构建自动重新生成，也可手动 `ninja splash_gen`
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# 与启动界面渲染相关的 services 源文件（不依赖 RTOS/外设）
+SER_SOURCES = [
+    "ser_lvgl_ui_boot.c",
+    "ser_lvgl_anim.c",
+    "ser_lvgl_gen_boot.c",
+    "ser_lvgl_readout.c",
+    "ser_lvgl_style.c",
+    "ser_rle565.c",
+]
+
+
+def write_if_changed(path, text):
+    """
+    内容不变时不改写；但更新时间戳，否则构建系统会认为输出仍比依赖旧，
+    每次构建都重新渲染（编整个 LVGL，约半分钟）
+    """
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                os.utime(path, None)
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def build_host(cc, mcu_dir, tools_dir, build_dir):
+    lvgl_dir = os.path.join(mcu_dir, "Libraries", "lvgl")
+    ser_dir = os.path.join(mcu_dir, "services")
+    srcs = [os.path.join(tools_dir, "splash_host.c")]
+    srcs += [os.path.join(ser_dir, s) for s in SER_SOURCES]
+    srcs += sorted(glob.glob(os.path.join(lvgl_dir, "src", "**", "*.c"),
+                             recursive=True))
+
+    exe = os.path.join(build_dir, "splash_host")
+    conf = os.path.join(tools_dir, "splash_lv_conf.h")
+    cmd = [cc, "-O2", "-std=gnu11", "-w",
+           '-DLV_CONF_PATH="%s"' % conf,
+           "-I", lvgl_dir, "-I", ser_dir,
+           "-o", exe] + srcs + ["-lm"]
+    subprocess.check_call(cmd)
+    return exe
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("    " + ", ".join("0x%02X" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def header():
+    return "\n".join([
+        "#pragma once",
+        "",
+        "/* 由 project/tools/splash_gen.py 根据启动界面渲染生成，请勿手工修改 */",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "/* ser_rle565 码流：w x h RGB565，逐行编码 */",
+        "extern const uint16_t ser_splash_gen_w;",
+        "extern const uint16_t ser_splash_gen_h;",
+        "extern const uint32_t ser_splash_gen_len;",
+        "extern const uint8_t ser_splash_gen_rle[];",
+        "",
+        "#ifdef __cplusplus",
+        '} /*extern "C"*/',
+        "#endif",
+        "",
+    ])
+
+
+def source(w, h, data):
+    return "\n".join([
+        "/* 由 project/tools/splash_gen.py 根据启动界面渲染生成，请勿手工修改 */",
+        "",
+        '#include "ser_splash_gen.h"',
+        "",
+        "const uint16_t ser_splash_gen_w = %du;" % w,
+        "const uint16_t ser_splash_gen_h = %du;" % h,
+        "const uint32_t ser_splash_gen_len = %du;" % len(data),
+        "",
+        "const uint8_t ser_splash_gen_rle[%d] = {" % len(data),
+        c_array(data),
+        "};",
+        "",
+    ])
+
+
+def main():
+    ap = argparse.ArgumentParser(description="render boot screen -> RLE C array")
+    ap.add_argument("--mcu", required=True, help="mcu directory")
+    ap.add_argument("-o", "--out-dir", required=True, help="output directory")
+    ap.add_argument("--size", default="800x480", help="WxH (default 800x480)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"),
+                    help="host C compiler")
+    args = ap.parse_args()
+
+    try:
+        w, h = (int(v) for v in args.size.lower().split("x"))
+    except ValueError:
+        sys.stderr.write("bad --size %s\n" % args.size)
+        return 1
+
+    tools_dir = os.path.dirname(os.path.abspath(__file__))
+    build_dir = tempfile.mkdtemp(prefix="splash_")
+    try:
+        exe = build_host(args.cc, os.path.abspath(args.mcu), tools_dir,
+                         build_dir)
+        out = os.path.join(build_dir, "splash.rle")
+        subprocess.check_call([exe, str(w), str(h), out])
+        with open(out, "rb") as f:
+            data = f.read()
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.stderr.write("splash_gen: error: %s\n" % e)
+        return 1
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+
+    base = os.path.join(args.out_dir, "ser_splash_gen")
+    write_if_changed(base + ".h", header())
+    write_if_changed(base + ".c", source(w, h, data))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,114 @@
+/*
+ * 开机画面主机渲染器（由 splash_gen.py 编译运行，不进固件）
+ *
+ * - 用固件同一份 LVGL 配置与 ser_lvgl_ui_boot_create 渲染第一帧（RGB565）
+ * - ser_rle565 编码后立即解码比对，并测解码速度
+ * - 码流写到输出文件，由 splash_gen.py 生成 C 数组
+ *
+ * 用法：splash_host <width> <height> <out.rle>
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lvgl.h"
+#include "ser_lvgl_ui_boot.h"
+#include "ser_rle565.h"
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area,
+                     uint8_t *px_map)
+{
+  (void)area;
+  (void)px_map;
+  lv_display_flush_ready(disp);
+}
+
+static double now_s(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 4)
+  {
+    fprintf(stderr, "usage: %s <width> <height> <out.rle>\n", argv[0]);
+    return 2;
+  }
+
+  const uint32_t w = (uint32_t)strtoul(argv[1], NULL, 0);
+  const uint32_t h = (uint32_t)strtoul(argv[2], NULL, 0);
+  if (w == 0u || h == 0u)
+  {
+    fprintf(stderr, "bad size\n");
+    return 2;
+  }
+
+  const uint32_t fb_bytes = w * h * 2u;
+  uint16_t *fb = calloc(w * h, sizeof(uint16_t));
+  uint16_t *chk = calloc(w * h, sizeof(uint16_t));
+  const uint32_t cap = h * SER_RLE565_ROW_MAX_BYTES(w);
+  uint8_t *rle = malloc(cap);
+  if (fb == NULL || chk == NULL || rle == NULL)
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  /* 与 ser_lvgl_boot_display 的 DIRECT 模式一致：整帧缓冲即渲染目标 */
+  lv_init();
+  lv_display_t *disp = lv_display_create((int32_t)w, (int32_t)h);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_set_buffers(disp, fb, NULL, fb_bytes,
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
+
+  static ser_lvgl_ui_boot_t ui;
+  ser_lvgl_ui_boot_create(&ui);
+  lv_refr_now(disp);
+
+  const uint32_t len = ser_rle565_encode(fb, w, h, w, rle, cap);
+  if (len == 0u)
+  {
+    fprintf(stderr, "encode failed\n");
+    return 1;
+  }
+
+  /* 解码校验：与渲染结果逐像素相同 */
+  if (!ser_rle565_decode(rle, len, chk, w, h, w) ||
+      memcmp(fb, chk, fb_bytes) != 0)
+  {
+    fprintf(stderr, "decode mismatch\n");
+    return 1;
+  }
+
+  /* 解码速度：至少跑 0.2s 取平均 */
+  uint32_t iters = 0;
+  const double t0 = now_s();
+  double dt = 0.0;
+  do
+  {
+    (void)ser_rle565_decode(rle, len, chk, w, h, w);
+    iters++;
+    dt = now_s() - t0;
+  } while (dt < 0.2);
+
+  FILE *f = fopen(argv[3], "wb");
+  if (f == NULL || fwrite(rle, 1, len, f) != len)
+  {
+    fprintf(stderr, "write %s failed\n", argv[3]);
+    return 1;
+  }
+  fclose(f);
+
+  printf("splash: %ux%u raw=%u rle=%u (%.1f%%) decode=%.1fus/frame "
+         "(%.0f MB/s out, host)\n",
+         (unsigned)w, (unsigned)h, (unsigned)fb_bytes, (unsigned)len,
+         100.0 * len / fb_bytes, dt / iters * 1e6,
+         (double)fb_bytes * iters / dt / 1e6);
+  return 0;
+}
@@ -0,0 +1,19 @@
+/*
+ * 主机渲染开机画面用的 LVGL 配置（splash_gen.py 经 LV_CONF_PATH 指定）
+ *
+ * 与固件共用 mcu/Libraries/lvgl/lv_conf.h，只把 LVGL heap 从 SDRAM 固定地址
+ * 改为静态数组、OSAL 改为无操作系统（主机单线程渲染）；其余配置
+ *（字体/主题/颜色深度）保持一致，渲染结果逐像素相同
+ */
+#ifndef SPLASH_LV_CONF_H
+#define SPLASH_LV_CONF_H
+
+#include "lv_conf.h"
+
+#undef LV_MEM_ADR
+#define LV_MEM_ADR 0
+
+#undef LV_USE_OS
+#define LV_USE_OS LV_OS_NONE
+
+#endif
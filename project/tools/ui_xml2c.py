@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+UI XML -> C 生成器（主机侧工具）
+
+用途：
+- 界面用 LVGL XML 描述（与 LVGL 编辑器 / lv_xml 的组件格式一致的子集）
+- 构建时生成创建同一棵对象树的 C 代码，样式展开为 const lv_style_t（Flash）
+- MCU 上不需要 lv_xml 运行时解析：无启动解析耗时，也不占 LVGL heap
+
+输入格式（子集）：
+    <component>
+      <styles>
+        <style name="chip" radius="8" bg_color="0x3D7BFF" bg_opa="cover"/>
+      </styles>
+      <view extends="lv_obj" name="card" styles="card" width="72%">
+        <lv_obj name="badge" width="64" height="64" styles="chip" align="top_mid"/>
+        <lv_label name="title" text="..." align_to="badge out_bottom_mid 0 12"/>
+      </view>
+    </component>
+
+- 控件：lv_obj / lv_label
+- 通用属性：name / width / height / x / y / align / styles / text
+- 标志属性：scrollable / clickable / hidden ...（true/false -> add/remove flag）
+- 本地样式：style_<prop>="..."（生成 lv_obj_set_style_<prop>）
+- 扩展属性：align_to="<目标name> <align> <x> <y>"（对应 lv_obj_align_to，
+  目标须在前面定义）。lv_xml 运行时没有该属性：用到它的 XML 只能经本生成器使用，
+  不能原样交给 lv_xml 加载器或 LVGL 编辑器
+- 生成结果由 project/test/test_ui_xml2c.c 校验：测试在主机上解释执行同一份 XML
+ （支持 align_to），与生成代码的渲染结果逐像素比较
+- styles 中引用的样式名：在本文件 <styles> 中定义的生成到输出 .c；
+  未定义的视为共享样式表中的 ser_lvgl_style_<name>（见 ser_lvgl_style_table.h）
+
+输出（以 boot.xml 为例）：
+- ser_lvgl_gen_boot.h：ser_lvgl_gen_boot_t（所有带 name 的对象指针）+ 创建函数声明
+- ser_lvgl_gen_boot.c：const 样式表 + ser_lvgl_gen_boot_create(parent, out)
+
+用法：
+    python3 ui_xml2c.py <input.xml> -o <输出目录>
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+WIDGETS = {
+    "lv_obj": "lv_obj_create",
+    "lv_label": "lv_label_create",
+}
+
+FLAGS = {
+    "hidden": "LV_OBJ_FLAG_HIDDEN",
+    "clickable": "LV_OBJ_FLAG_CLICKABLE",
+    "scrollable": "LV_OBJ_FLAG_SCROLLABLE",
+    "scroll_elastic": "LV_OBJ_FLAG_SCROLL_ELASTIC",
+    "scroll_momentum": "LV_OBJ_FLAG_SCROLL_MOMENTUM",
+    "event_bubble": "LV_OBJ_FLAG_EVENT_BUBBLE",
+}
+
+# 枚举型样式属性：值加前缀后转大写
+ENUM_PROPS = {
+    "bg_grad_dir": "LV_GRAD_DIR_",
+    "text_align": "LV_TEXT_ALIGN_",
+    "text_decor": "LV_TEXT_DECOR_",
+    "border_side": "LV_BORDER_SIDE_",
+    "base_dir": "LV_BASE_DIR_",
+    "align": "LV_ALIGN_",
+    "blend_mode": "LV_BLEND_MODE_",
+}
+
+# 简写属性：展开为多个真实属性
+SHORTHAND = {
+    "pad_all": ("pad_top", "pad_bottom", "pad_left", "pad_right"),
+    "pad_hor": ("pad_left", "pad_right"),
+    "pad_ver": ("pad_top", "pad_bottom"),
+    "pad_gap": ("pad_row", "pad_column"),
+    "margin_all": ("margin_top", "margin_bottom", "margin_left", "margin_right"),
+}
+
+IDENT_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+class GenError(Exception):
+    pass
+
+
+def c_ident(name, what):
+    if not IDENT_RE.match(name):
+        raise GenError("invalid %s name: %r" % (what, name))
+    return name
+
+
+def c_string(text):
+    """UTF-8 原样输出（源文件本身为 UTF-8），只转义引号/反斜杠/换行"""
+    out = text.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n")
+    return '"%s"' % out
+
+
+def parse_color(v):
+    s = v.strip()
+    if s.startswith("#"):
+        s = "0x" + s[1:]
+    if not re.match(r"^0[xX][0-9A-Fa-f]{6}$", s):
+        raise GenError("invalid color: %r" % v)
+    return "0x" + s[2:].upper()
+
+
+def parse_opa(v):
+    s = v.strip().lower()
+    if s in ("cover", "100%"):
+        return "LV_OPA_COVER"
+    if s in ("transp", "0%"):
+        return "LV_OPA_TRANSP"
+    if s.endswith("%"):
+        pct = int(s[:-1])
+        if pct % 10 == 0 and 0 < pct < 100:
+            return "LV_OPA_%d" % pct
+        return "%d" % (pct * 255 // 100)
+    return "%d" % int(s, 0)
+
+
+def parse_size(v):
+    s = v.strip().lower()
+    if s == "content":
+        return "LV_SIZE_CONTENT"
+    if s.endswith("%"):
+        return "lv_pct(%d)" % int(s[:-1])
+    return "%d" % int(s, 0)
+
+
+def style_value(prop, v, const):
+    """样式属性值 -> C 表达式（const 表用常量表达式，本地样式用函数调用）"""
+    if prop.endswith("_color"):
+        hexv = parse_color(v)
+        return ("SER_LVGL_HEX(%s)" if const else "lv_color_hex(%s)") % hexv
+    if prop == "opa" or prop.endswith("_opa"):
+        return parse_opa(v)
+    if prop in ENUM_PROPS:
+        return ENUM_PROPS[prop] + v.strip().upper()
+    if prop.endswith("_font"):
+        return "&" + c_ident(v.strip(), "font")
+    if prop in ("width", "height", "min_width", "max_width", "min_height",
+                "max_height"):
+        s = v.strip()
+        if const and s.endswith("%"):
+            return "LV_PCT(%d)" % int(s[:-1])
+        return parse_size(s)
+    return "%d" % int(v.strip(), 0)
+
+
+def expand_props(attrs):
+    props = []
+    for k, v in attrs:
+        for p in SHORTHAND.get(k, (k,)):
+            props.append((p, v))
+    return props
+
+
+class Gen:
+    def __init__(self, ui_name):
+        self.ui = ui_name
+        self.styles = []  # [(name, [(prop, value)])]
+        self.local_styles = set()
+        self.named = []  # 带 name 的对象（按出现顺序）
+        self.body = []
+        self.auto_id = 0
+
+    def parse_styles(self, node):
+        for st in node:
+            if st.tag != "style":
+                raise GenError("unexpected <%s> in <styles>" % st.tag)
+            name = c_ident(st.get("name", ""), "style")
+            attrs = [(k, v) for k, v in st.attrib.items() if k != "name"]
+            if not attrs:
+                raise GenError("style %r has no properties" % name)
+            self.styles.append((name, expand_props(attrs)))
+            self.local_styles.add(name)
+
+    def style_ref(self, name):
+        name = c_ident(name, "style")
+        if name in self.local_styles:
+            return "&s_style_%s" % name
+        return "&ser_lvgl_style_%s" % name
+
+    def obj_var(self, node):
+        name = node.get("name")
+        if name:
+            c_ident(name, "object")
+            if name in self.named:
+                raise GenError("duplicate object name: %r" % name)
+            self.named.append(name)
+            return "out->%s" % name
+        self.auto_id += 1
+        return "o%d" % self.auto_id
+
+    def emit_obj(self, node, parent_var, widget):
+        if widget not in WIDGETS:
+            raise GenError("unsupported widget: <%s>" % widget)
+        var = self.obj_var(node)
+        b = self.body
+        if not var.startswith("out->"):
+            b.append("  lv_obj_t *%s = %s(%s);" % (var, WIDGETS[widget], parent_var))
+        else:
+            b.append("  %s = %s(%s);" % (var, WIDGETS[widget], parent_var))
+
+        for s in node.get("styles", "").split():
+            b.append("  lv_obj_add_style(%s, %s, 0);" % (var, self.style_ref(s)))
+
+        local = [(k[len("style_"):], v) for k, v in node.attrib.items()
+                 if k.startswith("style_")]
+        for prop, v in expand_props(local):
+            b.append("  lv_obj_set_style_%s(%s, %s, 0);"
+                     % (prop, var, style_value(prop, v, False)))
+
+        w, h = node.get("width"), node.get("height")
+        if w is not None and h is not None:
+            b.append("  lv_obj_set_size(%s, %s, %s);" % (var, parse_size(w), parse_size(h)))
+        elif w is not None:
+            b.append("  lv_obj_set_width(%s, %s);" % (var, parse_size(w)))
+        elif h is not None:
+            b.append("  lv_obj_set_height(%s, %s);" % (var, parse_size(h)))
+
+        for k, flag in FLAGS.items():
+            v = node.get(k)
+            if v is None:
+                continue
+            on = v.strip().lower() == "true"
+            b.append("  lv_obj_%s_flag(%s, %s);" % ("add" if on else "remove", var, flag))
+
+        text = node.get("text")
+        if text is not None:
+            if widget != "lv_label":
+                raise GenError("text= only valid on lv_label")
+            b.append("  lv_label_set_text(%s, %s);" % (var, c_string(text)))
+
+        align = node.get("align")
+        x, y = int(node.get("x", "0"), 0), int(node.get("y", "0"), 0)
+        if align is not None:
+            b.append("  lv_obj_align(%s, LV_ALIGN_%s, %d, %d);" % (var, align.upper(), x, y))
+        elif node.get("x") is not None or node.get("y") is not None:
+            b.append("  lv_obj_set_pos(%s, %d, %d);" % (var, x, y))
+
+        align_to = node.get("align_to")
+        if align_to is not None:
+            parts = align_to.split()
+            if len(parts) != 4:
+                raise GenError("align_to expects '<name> <align> <x> <y>': %r" % align_to)
+            base = c_ident(parts[0], "object")
+            if base not in self.named:
+                raise GenError("align_to target %r not defined before use" % base)
+            b.append("  lv_obj_align_to(%s, out->%s, LV_ALIGN_%s, %d, %d);"
+                     % (var, base, parts[1].upper(), int(parts[2], 0), int(parts[3], 0)))
+
+        b.append("")
+        for child in node:
+            self.emit_obj(child, var, child.tag)
+
+    def parse(self, root):
+        if root.tag not in ("component", "screen"):
+            raise GenError("root must be <component> or <screen>")
+        view = None
+        for node in root:
+            if node.tag == "styles":
+                self.parse_styles(node)
+            elif node.tag == "view":
+                view = node
+            elif node.tag in ("consts", "api", "images", "fonts"):
+                raise GenError("<%s> is not supported by this generator" % node.tag)
+            else:
+                raise GenError("unexpected <%s>" % node.tag)
+        if view is None:
+            raise GenError("missing <view>")
+        if root.tag == "screen":
+            # 屏幕：直接在 parent（通常是 lv_screen_active()）上应用属性
+            if view.get("name") or view.get("width") or view.get("align"):
+                raise GenError("<screen> view only supports styles/flags")
+            for s in view.get("styles", "").split():
+                self.body.append("  lv_obj_add_style(parent, %s, 0);" % self.style_ref(s))
+            self.body.append("")
+            for child in view:
+                self.emit_obj(child, "parent", child.tag)
+        else:
+            self.emit_obj(view, "parent", view.get("extends", "lv_obj"))
+
+    def header(self, src_name):
+        g = "ser_lvgl_gen_%s" % self.ui
+        lines = [
+            "#pragma once",
+            "",
+            "/* 由 project/tools/ui_xml2c.py 根据 %s 生成，请勿手工修改 */" % src_name,
+            "",
+            "#ifdef __cplusplus",
+            'extern "C" {',
+            "#endif",
+            "",
+            "#if defined(__has_include)",
+            '#if __has_include("lvgl.h")',
+            '#include "lvgl.h"',
+            "",
+            "typedef struct",
+            "{",
+        ]
+        for n in self.named:
+            lines.append("  lv_obj_t *%s;" % n)
+        if not self.named:
+            lines.append("  lv_obj_t *root;")
+        lines += [
+            "} %s_t;" % g,
+            "",
+            "/* 在 parent 下创建对象树；带 name 的对象指针写入 out（只能在 LVGL 上下文调用） */",
+            "void %s_create(lv_obj_t *parent, %s_t *out);" % (g, g),
+            "",
+            "#endif",
+            "#endif",
+            "",
+            "#ifdef __cplusplus",
+            "} /*extern \"C\"*/",
+            "#endif",
+            "",
+        ]
+        return "\n".join(lines)
+
+    def source(self, src_name):
+        g = "ser_lvgl_gen_%s" % self.ui
+        lines = [
+            "/* 由 project/tools/ui_xml2c.py 根据 %s 生成，请勿手工修改 */" % src_name,
+            "",
+            '#include "%s.h"' % g,
+            "",
+            "#if defined(__has_include)",
+            '#if __has_include("lvgl.h")',
+            '#include "ser_lvgl_style.h"',
+            "",
+        ]
+        for name, props in self.styles:
+            lines.append("static const lv_style_const_prop_t s_style_%s_props[] = {" % name)
+            for prop, v in props:
+                lines.append("    LV_STYLE_CONST_%s(%s)," % (prop.upper(), style_value(prop, v, True)))
+            lines.append("    LV_STYLE_CONST_PROPS_END};")
+            lines.append("static LV_STYLE_CONST_INIT(s_style_%s, s_style_%s_props);" % (name, name))
+            lines.append("")
+        lines += [
+            "void %s_create(lv_obj_t *parent, %s_t *out)" % (g, g),
+            "{",
+        ]
+        body = list(self.body)
+        while body and body[-1] == "":
+            body.pop()
+        lines += body
+        lines += [
+            "}",
+            "",
+            "#endif",
+            "#endif",
+            "",
+        ]
+        return "\n".join(lines)
+
+
+def write_if_changed(path, text):
+    """内容不变时不改写，避免无谓地触发重新编译"""
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="LVGL XML -> C generator")
+    ap.add_argument("xml", help="input XML (component or screen)")
+    ap.add_argument("-o", "--out-dir", required=True, help="output directory")
+    args = ap.parse_args()
+
+    ui_name = c_ident(os.path.splitext(os.path.basename(args.xml))[0], "ui")
+    try:
+        root = ET.parse(args.xml).getroot()
+        gen = Gen(ui_name)
+        gen.parse(root)
+    except (ET.ParseError, GenError, ValueError) as e:
+        sys.stderr.write("%s: error: %s\n" % (args.xml, e))
+        return 1
+
+    src_name = os.path.basename(args.xml)
+    base = os.path.join(args.out_dir, "ser_lvgl_gen_%s" % ui_name)
+    write_if_changed(base + ".h", gen.header(src_name))
+    write_if_changed(base + ".c", gen.source(src_name))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())